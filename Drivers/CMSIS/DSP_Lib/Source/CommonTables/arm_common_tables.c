@@ -21221,6 +21221,46 @@ const q31_t armRecipTableQ31[64] = {
   0x41CCDDB6, 0x4146A3C6, 0x40C28923, 0x40408102
 };
 
+/*    
+* @brief  Q32 table of 2^(-(i + 1)/32), i = 0 to 31, for the fixed-point exponentials    
+*/
+const uint32_t armExp2TableQ32[32] = {
+  0xFA83B2DB, 0xF5257D15, 0xEFE4B99C, 0xEAC0C6E8, 0xE5B906E7, 0xE0CCDEEC,
+  0xDBFBB798, 0xD744FCCB, 0xD2A81D92, 0xCE248C15, 0xC9B9BD86, 0xC5672A11,
+  0xC12C4CCA, 0xBD08A39F, 0xB8FBAF47, 0xB504F334, 0xB123F582, 0xAD583EEA,
+  0xA9A15AB5, 0xA5FED6AA, 0xA2704303, 0x9EF53261, 0x9B8D39BA, 0x9837F052,
+  0x94F4EFA9, 0x91C3D374, 0x8EA4398B, 0x8B95C1E4, 0x88980E81, 0x85AAC368,
+  0x82CD8699, 0x80000000
+};
+
+/*    
+* @brief  Q31 table of 1/c, c = 1 + (i + 0.5)/32, i = 0 to 31, for the fixed-point logarithms    
+*/
+const q31_t armLogInvTableQ31[32] = {
+  0x7E07E07E, 0x7A44C6B0, 0x76B981DB, 0x73615A24,
+  0x70381C0E, 0x6D3A06D4, 0x6A63BD82, 0x67B23A54,
+  0x6522C3F3, 0x62B2E43E, 0x60606060, 0x5E293206,
+  0x5C0B8170, 0x5A05A05A, 0x58160581, 0x563B48C2,
+  0x54741FAC, 0x52BF5A81, 0x511BE196, 0x4F88B2F4,
+  0x4E04E04E, 0x4C8F8D29, 0x4B27ED36, 0x49CD42E2,
+  0x487EDE05, 0x473C1AB7, 0x46046046, 0x44D72045,
+  0x43B3D5B0, 0x429A042A, 0x4189374C, 0x40810204
+};
+
+/*    
+* @brief  Q31 table of log(c), c = 1 + (i + 0.5)/32, i = 0 to 31, for the fixed-point logarithms    
+*/
+const q31_t armLogTableQ31[32] = {
+  0x01FC0A8B, 0x05DD163E, 0x09A0EBCB, 0x0D49369D,
+  0x10D77E7D, 0x144D2B6D, 0x17AB8902, 0x1AF3C94F,
+  0x1E27076E, 0x214649C5, 0x245283F8, 0x274C98AB,
+  0x2A355B0E, 0x2D0D903D, 0x2FD5F077, 0x328F2838,
+  0x3539D935, 0x37D69B3B, 0x3A65FCFC, 0x3CE884C4,
+  0x3F5EB11F, 0x41C8F970, 0x4427CE79, 0x467B9AD2,
+  0x48C4C35F, 0x4B03A7B5, 0x4D38A276, 0x4F6409AA,
+  0x51862F08, 0x539F6047, 0x55AFE757, 0x57B80AA5
+};
+
 const uint16_t armBitRevIndexTable16[ARMBITREVINDEXTABLE__16_TABLE_LENGTH] = 
 {
    //8x2, size 20
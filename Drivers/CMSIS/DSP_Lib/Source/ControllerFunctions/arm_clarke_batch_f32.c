@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_clarke_batch_f32.c   
+*    
+* Description:	Floating-point Clarke transform of a block of samples    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupController    
+ */
+
+/**    
+ * @addtogroup clarke    
+ * @{    
+ */
+
+/**    
+ * @brief  Floating-point Clarke transform of a block of samples    
+ * @param[in]  *pIa                points to the input three-phase coordinates <code>a</code>.    
+ * @param[in]  *pIb                points to the input three-phase coordinates <code>b</code>.    
+ * @param[out] *pIalpha            points to the output two-phase orthogonal vector axis alpha.    
+ * @param[out] *pIbeta             points to the output two-phase orthogonal vector axis beta.    
+ * @param[in]  blockSize           number of samples to transform.    
+ * @return none.    
+ *    
+ * \par    
+ * Each sample is transformed as by <code>arm_clarke_f32()</code>.  The outputs may be the input arrays.    
+ */
+
+void arm_clarke_batch_f32(
+  const float32_t * pIa,
+  const float32_t * pIb,
+  float32_t * pIalpha,
+  float32_t * pIbeta,
+  uint32_t blockSize)
+{
+  float32_t ia, ib;                                /*  temporary variables                   */
+  uint32_t blkCnt;                               /*  loop counter                          */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    ia = pIa[0];
+    ib = pIb[0];
+
+    /* Ialpha = Ia, Ibeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
+    pIalpha[0] = ia;
+    pIbeta[0] = ((float32_t) 0.57735026919 * ia + (float32_t) 1.15470053838 * ib);
+
+    ia = pIa[1];
+    ib = pIb[1];
+
+    /* Ialpha = Ia, Ibeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
+    pIalpha[1] = ia;
+    pIbeta[1] = ((float32_t) 0.57735026919 * ia + (float32_t) 1.15470053838 * ib);
+
+    ia = pIa[2];
+    ib = pIb[2];
+
+    /* Ialpha = Ia, Ibeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
+    pIalpha[2] = ia;
+    pIbeta[2] = ((float32_t) 0.57735026919 * ia + (float32_t) 1.15470053838 * ib);
+
+    ia = pIa[3];
+    ib = pIb[3];
+
+    /* Ialpha = Ia, Ibeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
+    pIalpha[3] = ia;
+    pIbeta[3] = ((float32_t) 0.57735026919 * ia + (float32_t) 1.15470053838 * ib);
+
+    pIa += 4u;
+    pIb += 4u;
+    pIalpha += 4u;
+    pIbeta += 4u;
+
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    ia = pIa[0];
+    ib = pIb[0];
+
+    /* Ialpha = Ia, Ibeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
+    pIalpha[0] = ia;
+    pIbeta[0] = ((float32_t) 0.57735026919 * ia + (float32_t) 1.15470053838 * ib);
+
+    pIa++;
+    pIb++;
+    pIalpha++;
+    pIbeta++;
+
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of clarke group    
+ */
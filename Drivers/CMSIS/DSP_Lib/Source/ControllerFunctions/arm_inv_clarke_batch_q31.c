@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_inv_clarke_batch_q31.c   
+*    
+* Description:	Q31 inverse Clarke transform of a block of samples    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupController    
+ */
+
+/**    
+ * @addtogroup inv_clarke    
+ * @{    
+ */
+
+/**    
+ * @brief  Q31 inverse Clarke transform of a block of samples    
+ * @param[in]  *pIalpha        points to the input two-phase orthogonal vector axis alpha.    
+ * @param[in]  *pIbeta         points to the input two-phase orthogonal vector axis beta.    
+ * @param[out] *pIa            points to the output three-phase coordinates <code>a</code>.    
+ * @param[out] *pIb            points to the output three-phase coordinates <code>b</code>.    
+ * @param[in]  blockSize       number of samples to transform.    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * Each sample is transformed as by <code>arm_inv_clarke_q31()</code>, with saturation on the subtraction.    
+ * The outputs may be the input arrays.    
+ */
+
+void arm_inv_clarke_batch_q31(
+  const q31_t * pIalpha,
+  const q31_t * pIbeta,
+  q31_t * pIa,
+  q31_t * pIb,
+  uint32_t blockSize)
+{
+  q31_t ialpha, ibeta;                           /*  temporary variables                   */
+  q31_t product1, product2;                      /*  intermediate products                 */
+  uint32_t blkCnt;                               /*  loop counter                          */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    ialpha = pIalpha[0];
+    ibeta = pIbeta[0];
+
+    /* (1/2) * Ialpha and (sqrt(3)/2) * Ibeta, in 2.62 format truncated to 1.31 */
+    product1 = (q31_t) (((q63_t) (ialpha) * (0x40000000)) >> 31);
+    product2 = (q31_t) (((q63_t) (ibeta) * (0x6ED9EBA1)) >> 31);
+
+    pIa[0] = ialpha;
+    pIb[0] = __QSUB(product2, product1);
+
+    ialpha = pIalpha[1];
+    ibeta = pIbeta[1];
+
+    /* (1/2) * Ialpha and (sqrt(3)/2) * Ibeta, in 2.62 format truncated to 1.31 */
+    product1 = (q31_t) (((q63_t) (ialpha) * (0x40000000)) >> 31);
+    product2 = (q31_t) (((q63_t) (ibeta) * (0x6ED9EBA1)) >> 31);
+
+    pIa[1] = ialpha;
+    pIb[1] = __QSUB(product2, product1);
+
+    ialpha = pIalpha[2];
+    ibeta = pIbeta[2];
+
+    /* (1/2) * Ialpha and (sqrt(3)/2) * Ibeta, in 2.62 format truncated to 1.31 */
+    product1 = (q31_t) (((q63_t) (ialpha) * (0x40000000)) >> 31);
+    product2 = (q31_t) (((q63_t) (ibeta) * (0x6ED9EBA1)) >> 31);
+
+    pIa[2] = ialpha;
+    pIb[2] = __QSUB(product2, product1);
+
+    ialpha = pIalpha[3];
+    ibeta = pIbeta[3];
+
+    /* (1/2) * Ialpha and (sqrt(3)/2) * Ibeta, in 2.62 format truncated to 1.31 */
+    product1 = (q31_t) (((q63_t) (ialpha) * (0x40000000)) >> 31);
+    product2 = (q31_t) (((q63_t) (ibeta) * (0x6ED9EBA1)) >> 31);
+
+    pIa[3] = ialpha;
+    pIb[3] = __QSUB(product2, product1);
+
+    pIalpha += 4u;
+    pIbeta += 4u;
+    pIa += 4u;
+    pIb += 4u;
+
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    ialpha = pIalpha[0];
+    ibeta = pIbeta[0];
+
+    /* (1/2) * Ialpha and (sqrt(3)/2) * Ibeta, in 2.62 format truncated to 1.31 */
+    product1 = (q31_t) (((q63_t) (ialpha) * (0x40000000)) >> 31);
+    product2 = (q31_t) (((q63_t) (ibeta) * (0x6ED9EBA1)) >> 31);
+
+    pIa[0] = ialpha;
+    pIb[0] = __QSUB(product2, product1);
+
+    pIalpha++;
+    pIbeta++;
+    pIa++;
+    pIb++;
+
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of inv_clarke group    
+ */
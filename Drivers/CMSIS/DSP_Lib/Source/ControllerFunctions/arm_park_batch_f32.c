@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_park_batch_f32.c   
+*    
+* Description:	Floating-point Park transform of a block of samples    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupController    
+ */
+
+/**    
+ * @addtogroup park    
+ * @{    
+ */
+
+/**    
+ * @brief  Floating-point Park transform of a block of samples    
+ * @param[in]  *pIalpha            points to the input two-phase vector coordinates alpha.    
+ * @param[in]  *pIbeta             points to the input two-phase vector coordinates beta.    
+ * @param[out] *pId                points to the output rotor reference frame d.    
+ * @param[out] *pIq                points to the output rotor reference frame q.    
+ * @param[in]  *pSinVal            points to the sine values of the rotation angles theta.    
+ * @param[in]  *pCosVal            points to the cosine values of the rotation angles theta.    
+ * @param[in]  blockSize           number of samples to transform.    
+ * @return none.    
+ *    
+ * \par    
+ * Each sample is transformed as by <code>arm_park_f32()</code> with its own angle.  The outputs may be the input arrays.    
+ */
+
+void arm_park_batch_f32(
+  const float32_t * pIalpha,
+  const float32_t * pIbeta,
+  float32_t * pId,
+  float32_t * pIq,
+  const float32_t * pSinVal,
+  const float32_t * pCosVal,
+  uint32_t blockSize)
+{
+  float32_t ialpha, ibeta, s, co;                /*  temporary variables                   */
+  uint32_t blkCnt;                               /*  loop counter                          */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Loop unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    ialpha = pIalpha[0];
+    ibeta = pIbeta[0];
+    s = pSinVal[0];
+    co = pCosVal[0];
+
+    /* Id = Ialpha * cos + Ibeta * sin, Iq = - Ialpha * sin + Ibeta * cos */
+    pId[0] = ialpha * co + ibeta * s;
+    pIq[0] = -ialpha * s + ibeta * co;
+
+    ialpha = pIalpha[1];
+    ibeta = pIbeta[1];
+    s = pSinVal[1];
+    co = pCosVal[1];
+
+    /* Id = Ialpha * cos + Ibeta * sin, Iq = - Ialpha * sin + Ibeta * cos */
+    pId[1] = ialpha * co + ibeta * s;
+    pIq[1] = -ialpha * s + ibeta * co;
+
+    ialpha = pIalpha[2];
+    ibeta = pIbeta[2];
+    s = pSinVal[2];
+    co = pCosVal[2];
+
+    /* Id = Ialpha * cos + Ibeta * sin, Iq = - Ialpha * sin + Ibeta * cos */
+    pId[2] = ialpha * co + ibeta * s;
+    pIq[2] = -ialpha * s + ibeta * co;
+
+    ialpha = pIalpha[3];
+    ibeta = pIbeta[3];
+    s = pSinVal[3];
+    co = pCosVal[3];
+
+    /* Id = Ialpha * cos + Ibeta * sin, Iq = - Ialpha * sin + Ibeta * cos */
+    pId[3] = ialpha * co + ibeta * s;
+    pIq[3] = -ialpha * s + ibeta * co;
+
+    pIalpha += 4u;
+    pIbeta += 4u;
+    pSinVal += 4u;
+    pCosVal += 4u;
+    pId += 4u;
+    pIq += 4u;
+
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    ialpha = pIalpha[0];
+    ibeta = pIbeta[0];
+    s = pSinVal[0];
+    co = pCosVal[0];
+
+    /* Id = Ialpha * cos + Ibeta * sin, Iq = - Ialpha * sin + Ibeta * cos */
+    pId[0] = ialpha * co + ibeta * s;
+    pIq[0] = -ialpha * s + ibeta * co;
+
+    pIalpha++;
+    pIbeta++;
+    pSinVal++;
+    pCosVal++;
+    pId++;
+    pIq++;
+
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of park group    
+ */
@@ -0,0 +1,189 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_pid_batch_f32.c   
+*    
+* Description:	Floating-point batched PID Control    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupController    
+ */
+
+/**    
+ * @addtogroup PID    
+ * @{    
+ */
+
+/**    
+ * @brief  Process function for a batch of floating-point PID Controls.    
+ * @param[in,out] *S    points to an instance of the floating-point batched PID structure.    
+ * @param[in]     *pSrc points to the input samples, one per loop.    
+ * @param[out]    *pDst points to the output samples, one per loop, may be <code>pSrc</code>.    
+ * @return none.    
+ *    
+ * \par    
+ * Every loop <code>i</code> computes, as <code>arm_pid_f32()</code> does for one loop,    
+ * <pre>    
+ *    y[n] = y[n-1] + A0[i] * x[n] + A1[i] * x[n-1] + A2[i] * x[n-2]    
+ * </pre>    
+ * With limits the output is clamped to <code>[lo[i], hi[i]]</code>; see \ref arm_pid_batch_init_f32()    
+ * for the anti-windup option.    
+ */
+
+void arm_pid_batch_f32(
+  const arm_pid_batch_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  uint32_t N = S->numLoops;                      /*  number of loops                       */
+  const float32_t *pA0 = S->pCoeffs;             /*  gains A0                              */
+  const float32_t *pA1 = pA0 + N;                /*  gains A1                              */
+  const float32_t *pA2 = pA1 + N;                /*  gains A2                              */
+  float32_t *pX1 = S->pState;                    /*  x[n-1]                                */
+  float32_t *pX2 = pX1 + N;                      /*  x[n-2]                                */
+  float32_t *pY1 = pX2 + N;                      /*  y[n-1]                                */
+  const float32_t *pLo, *pHi;                    /*  output limits                         */
+  float32_t in, out, lim;                        /*  temporary variables                   */
+  uint32_t blkCnt;                               /*  loop counter                          */
+#ifndef ARM_MATH_CM0_FAMILY
+  float32_t in1, in2, out1, out2;                /*  temporary variables of two loops      */
+#endif
+
+  if(S->pLimits == NULL)
+  {
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling, two independent loops at a time */
+    blkCnt = N >> 1u;
+
+    while(blkCnt > 0u)
+    {
+      in1 = pSrc[0];
+      in2 = pSrc[1];
+
+      /* y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] */
+      out1 = (pA0[0] * in1) + (pA1[0] * pX1[0]) + (pA2[0] * pX2[0]) + pY1[0];
+      out2 = (pA0[1] * in2) + (pA1[1] * pX1[1]) + (pA2[1] * pX2[1]) + pY1[1];
+
+      /* Update state */
+      pX2[0] = pX1[0];
+      pX2[1] = pX1[1];
+      pX1[0] = in1;
+      pX1[1] = in2;
+      pY1[0] = out1;
+      pY1[1] = out2;
+
+      pDst[0] = out1;
+      pDst[1] = out2;
+
+      pSrc += 2u;
+      pDst += 2u;
+      pA0 += 2u;
+      pA1 += 2u;
+      pA2 += 2u;
+      pX1 += 2u;
+      pX2 += 2u;
+      pY1 += 2u;
+
+      blkCnt--;
+    }
+
+    blkCnt = N % 0x2u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = N;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(blkCnt > 0u)
+    {
+      in = *pSrc++;
+
+      /* y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] */
+      out = (*pA0++ * in) + (*pA1++ * *pX1) + (*pA2++ * *pX2) + *pY1;
+
+      /* Update state */
+      *pX2++ = *pX1;
+      *pX1++ = in;
+      *pY1++ = out;
+
+      *pDst++ = out;
+
+      blkCnt--;
+    }
+  }
+  else
+  {
+    pLo = S->pLimits;
+    pHi = pLo + N;
+    blkCnt = N;
+
+    while(blkCnt > 0u)
+    {
+      in = *pSrc++;
+
+      /* y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] */
+      out = (*pA0++ * in) + (*pA1++ * *pX1) + (*pA2++ * *pX2) + *pY1;
+
+      /* Clamp to the limits */
+      lim = (out < *pLo) ? *pLo : out;
+      lim = (lim > *pHi) ? *pHi : lim;
+      pLo++;
+      pHi++;
+
+      /* Update state, the integrator holds the limited output with anti-windup */
+      *pX2++ = *pX1;
+      *pX1++ = in;
+      *pY1++ = S->antiWindup ? lim : out;
+
+      *pDst++ = lim;
+
+      blkCnt--;
+    }
+  }
+}
+
+/**    
+ * @} end of PID group    
+ */
@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_pid_batch_init_f32.c   
+*    
+* Description:	Floating-point batched PID Control initialization function    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupController    
+ */
+
+/**    
+ * @addtogroup PID    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for a batch of floating-point PID Controls.    
+ * @param[in,out] *S           points to an instance of the floating-point batched PID structure.    
+ * @param[in]     numLoops     number of loops N.    
+ * @param[in]     *pKp         points to the proportional gains, N values.    
+ * @param[in]     *pKi         points to the integral gains, N values.    
+ * @param[in]     *pKd         points to the derivative gains, N values.    
+ * @param[out]    *pCoeffs     points to the derived gains, 3*N values.    
+ * @param[out]    *pState      points to the state, 3*N values.    
+ * @param[in]     *pLimits     points to the output limits, the N lower limits followed by the N upper limits, or NULL.    
+ * @param[in]     antiWindup   1 to hold the integrator at the limits, 0 to let it run on.    
+ * @return none.    
+ *    
+ * \par Description:    
+ * \par    
+ * The derived gains are computed as by <code>arm_pid_init_f32()</code> and stored as arrays,    
+ * <code>{A0[0..N-1], A1[0..N-1], A2[0..N-1]}</code>; the state holds <code>{x[n-1][0..N-1], x[n-2][0..N-1], y[n-1][0..N-1]}</code>    
+ * and is cleared.  Gains and limits may be changed between calls by writing the arrays, or by calling the    
+ * initialization function again, which also clears the state.    
+ * \par    
+ * In this form of the controller <code>y[n-1]</code> is the integrator.  With <code>antiWindup</code> the limited    
+ * output is fed back, so the integrator stops at the limit and the output leaves it as soon as the error changes    
+ * sign.  Without it only the output is clamped and the integrator keeps integrating; the outputs are then the    
+ * clamped outputs of <code>arm_pid_f32()</code>.    
+ */
+
+void arm_pid_batch_init_f32(
+  arm_pid_batch_instance_f32 * S,
+  uint16_t numLoops,
+  const float32_t * pKp,
+  const float32_t * pKi,
+  const float32_t * pKd,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  const float32_t * pLimits,
+  uint8_t antiWindup)
+{
+  uint32_t i;
+
+  for(i = 0u; i < numLoops; i++)
+  {
+    /* A0 = Kp + Ki + Kd, A1 = -Kp - 2 * Kd, A2 = Kd */
+    pCoeffs[i] = pKp[i] + pKi[i] + pKd[i];
+    pCoeffs[numLoops + i] = (-pKp[i]) - (2.0f * pKd[i]);
+    pCoeffs[2u * numLoops + i] = pKd[i];
+  }
+
+  memset(pState, 0, 3u * numLoops * sizeof(float32_t));
+
+  S->numLoops = numLoops;
+  S->antiWindup = antiWindup;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->pLimits = pLimits;
+}
+
+/**    
+ * @} end of PID group    
+ */
@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_pid_batch_init_q31.c   
+*    
+* Description:	Q31 batched PID Control initialization function    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupController    
+ */
+
+/**    
+ * @addtogroup PID    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for a batch of Q31 PID Controls.    
+ * @param[in,out] *S           points to an instance of the Q31 batched PID structure.    
+ * @param[in]     numLoops     number of loops N.    
+ * @param[in]     *pKp         points to the proportional gains, N values.    
+ * @param[in]     *pKi         points to the integral gains, N values.    
+ * @param[in]     *pKd         points to the derivative gains, N values.    
+ * @param[out]    *pCoeffs     points to the derived gains, 3*N values.    
+ * @param[out]    *pState      points to the state, 3*N values.    
+ * @param[in]     *pLimits     points to the output limits, the N lower limits followed by the N upper limits, or NULL.    
+ * @param[in]     antiWindup   1 to hold the integrator at the limits, 0 to let it run on.    
+ * @return none.    
+ *    
+ * \par Description:    
+ * \par    
+ * The derived gains are computed with saturation as by <code>arm_pid_init_q31()</code>; the layout of the    
+ * arrays and the limits are described for <code>arm_pid_batch_init_f32()</code>.  The state is cleared.    
+ */
+
+void arm_pid_batch_init_q31(
+  arm_pid_batch_instance_q31 * S,
+  uint16_t numLoops,
+  const q31_t * pKp,
+  const q31_t * pKi,
+  const q31_t * pKd,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  const q31_t * pLimits,
+  uint8_t antiWindup)
+{
+  uint32_t i;
+
+#ifdef ARM_MATH_CM0_FAMILY
+
+  q31_t temp;
+
+#endif /* #ifdef ARM_MATH_CM0_FAMILY */
+
+  for(i = 0u; i < numLoops; i++)
+  {
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* A0 = Kp + Ki + Kd, A1 = -Kp - 2 * Kd */
+    pCoeffs[i] = __QADD(__QADD(pKp[i], pKi[i]), pKd[i]);
+    pCoeffs[numLoops + i] = -__QADD(__QADD(pKd[i], pKd[i]), pKp[i]);
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    temp = clip_q63_to_q31((q63_t) pKp[i] + pKi[i]);
+    pCoeffs[i] = clip_q63_to_q31((q63_t) temp + pKd[i]);
+
+    temp = clip_q63_to_q31((q63_t) pKd[i] + pKd[i]);
+    pCoeffs[numLoops + i] = -clip_q63_to_q31((q63_t) temp + pKp[i]);
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    /* A2 = Kd */
+    pCoeffs[2u * numLoops + i] = pKd[i];
+  }
+
+  memset(pState, 0, 3u * numLoops * sizeof(q31_t));
+
+  S->numLoops = numLoops;
+  S->antiWindup = antiWindup;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->pLimits = pLimits;
+}
+
+/**    
+ * @} end of PID group    
+ */
@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_pid_batch_q15.c   
+*    
+* Description:	Q15 batched PID Control    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupController    
+ */
+
+/**    
+ * @addtogroup PID    
+ * @{    
+ */
+
+/**    
+ * @brief  Process function for a batch of Q15 PID Controls.    
+ * @param[in,out] *S    points to an instance of the Q15 batched PID structure.    
+ * @param[in]     *pSrc points to the input samples, one per loop.    
+ * @param[out]    *pDst points to the output samples, one per loop, may be <code>pSrc</code>.    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * Every loop is computed as by <code>arm_pid_q15()</code>: the 2.30 products and <code>y[n-1]</code> are accumulated    
+ * in a 64-bit accumulator without risk of overflow, truncated to 34.15 format and saturated to 1.15 format.    
+ * With limits the result is then clamped to <code>[lo[i], hi[i]]</code>.    
+ * \par    
+ * <code>x[n-1]</code> and <code>x[n-2]</code> of a loop are stored next to each other, as are <code>A1</code> and    
+ * <code>A2</code>, so that both products are formed by one dual multiply-accumulate.    
+ */
+
+void arm_pid_batch_q15(
+  const arm_pid_batch_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst)
+{
+  uint32_t N = S->numLoops;                      /*  number of loops                       */
+  const q15_t *pA0 = S->pCoeffs;                 /*  gains A0                              */
+  const q15_t *pA12 = pA0 + N;                   /*  gains A1, A2 pairs                    */
+  q15_t *pX12 = S->pState;                       /*  x[n-1], x[n-2] pairs                  */
+  q15_t *pY1 = pX12 + 2u * N;                    /*  y[n-1]                                */
+  const q15_t *pLo = NULL, *pHi = NULL;          /*  output limits                         */
+  q63_t acc;                                     /*  accumulator                           */
+  q15_t in, out, lim;                            /*  temporary variables                   */
+  uint32_t blkCnt;                               /*  loop counter                          */
+
+  if(S->pLimits != NULL)
+  {
+    pLo = S->pLimits;
+    pHi = pLo + N;
+  }
+
+  blkCnt = N;
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* acc = A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] */
+    acc = (q31_t) *pA0++ * in;
+    acc = (q63_t) __SMLALD((uint32_t) *__SIMD32_CONST(pA12), (uint32_t) *__SIMD32_CONST(pX12), (uint64_t) acc);
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* acc = A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] */
+    acc = (q31_t) *pA0++ * in;
+    acc += (q31_t) pA12[0] * pX12[0];
+    acc += (q31_t) pA12[1] * pX12[1];
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    /* acc += y[n-1], saturate the output */
+    acc += (q31_t) *pY1 * 32768;
+    out = (q15_t) (__SSAT((acc >> 15), 16));
+    lim = out;
+
+    if(pLo != NULL)
+    {
+      /* Clamp to the limits */
+      lim = (lim < *pLo) ? *pLo : lim;
+      lim = (lim > *pHi) ? *pHi : lim;
+      pLo++;
+      pHi++;
+
+      /* the integrator holds the limited output with anti-windup */
+      if(S->antiWindup)
+      {
+        out = lim;
+      }
+    }
+
+    /* Update state */
+    pX12[1] = pX12[0];
+    pX12[0] = in;
+    *pY1++ = out;
+
+    *pDst++ = lim;
+
+    pA12 += 2u;
+    pX12 += 2u;
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of PID group    
+ */
@@ -0,0 +1,207 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_pid_batch_q31.c   
+*    
+* Description:	Q31 batched PID Control    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupController    
+ */
+
+/**    
+ * @addtogroup PID    
+ * @{    
+ */
+
+/**    
+ * @brief  Process function for a batch of Q31 PID Controls.    
+ * @param[in,out] *S    points to an instance of the Q31 batched PID structure.    
+ * @param[in]     *pSrc points to the input samples, one per loop.    
+ * @param[out]    *pDst points to the output samples, one per loop, may be <code>pSrc</code>.    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * Every loop is computed as by <code>arm_pid_q31()</code>: the products are accumulated in 2.62 format    
+ * with a single guard bit, truncated to 1.31 format and <code>y[n-1]</code> is added without saturation.    
+ * With limits the result is then clamped to <code>[lo[i], hi[i]]</code>.    
+ */
+
+void arm_pid_batch_q31(
+  const arm_pid_batch_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst)
+{
+  uint32_t N = S->numLoops;                      /*  number of loops                       */
+  const q31_t *pA0 = S->pCoeffs;                 /*  gains A0                              */
+  const q31_t *pA1 = pA0 + N;                    /*  gains A1                              */
+  const q31_t *pA2 = pA1 + N;                    /*  gains A2                              */
+  q31_t *pX1 = S->pState;                        /*  x[n-1]                                */
+  q31_t *pX2 = pX1 + N;                          /*  x[n-2]                                */
+  q31_t *pY1 = pX2 + N;                          /*  y[n-1]                                */
+  const q31_t *pLo, *pHi;                        /*  output limits                         */
+  q63_t acc;                                     /*  accumulator                           */
+  q31_t in, out, lim;                            /*  temporary variables                   */
+  uint32_t blkCnt;                               /*  loop counter                          */
+#ifndef ARM_MATH_CM0_FAMILY
+  q63_t acc2;                                    /*  accumulator of the second loop        */
+  q31_t in2, out2;                               /*  temporaries of the second loop        */
+#endif
+
+  if(S->pLimits == NULL)
+  {
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling, two independent loops at a time */
+    blkCnt = N >> 1u;
+
+    while(blkCnt > 0u)
+    {
+      in = pSrc[0];
+      in2 = pSrc[1];
+
+      /* acc = A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] */
+      acc = (q63_t) pA0[0] * in;
+      acc2 = (q63_t) pA0[1] * in2;
+      acc += (q63_t) pA1[0] * pX1[0];
+      acc2 += (q63_t) pA1[1] * pX1[1];
+      acc += (q63_t) pA2[0] * pX2[0];
+      acc2 += (q63_t) pA2[1] * pX2[1];
+
+      /* convert to 1.31 format and add y[n-1] */
+      out = (q31_t) (acc >> 31u) + pY1[0];
+      out2 = (q31_t) (acc2 >> 31u) + pY1[1];
+
+      /* Update state */
+      pX2[0] = pX1[0];
+      pX2[1] = pX1[1];
+      pX1[0] = in;
+      pX1[1] = in2;
+      pY1[0] = out;
+      pY1[1] = out2;
+
+      pDst[0] = out;
+      pDst[1] = out2;
+
+      pSrc += 2u;
+      pDst += 2u;
+      pA0 += 2u;
+      pA1 += 2u;
+      pA2 += 2u;
+      pX1 += 2u;
+      pX2 += 2u;
+      pY1 += 2u;
+
+      blkCnt--;
+    }
+
+    blkCnt = N % 0x2u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = N;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(blkCnt > 0u)
+    {
+      in = *pSrc++;
+
+      /* acc = A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] */
+      acc = (q63_t) *pA0++ * in;
+      acc += (q63_t) *pA1++ * *pX1;
+      acc += (q63_t) *pA2++ * *pX2;
+
+      /* convert to 1.31 format and add y[n-1] */
+      out = (q31_t) (acc >> 31u) + *pY1;
+
+      /* Update state */
+      *pX2++ = *pX1;
+      *pX1++ = in;
+      *pY1++ = out;
+
+      *pDst++ = out;
+
+      blkCnt--;
+    }
+  }
+  else
+  {
+    pLo = S->pLimits;
+    pHi = pLo + N;
+    blkCnt = N;
+
+    while(blkCnt > 0u)
+    {
+      in = *pSrc++;
+
+      /* acc = A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] */
+      acc = (q63_t) *pA0++ * in;
+      acc += (q63_t) *pA1++ * *pX1;
+      acc += (q63_t) *pA2++ * *pX2;
+
+      /* convert to 1.31 format and add y[n-1] */
+      out = (q31_t) (acc >> 31u) + *pY1;
+
+      /* Clamp to the limits */
+      lim = (out < *pLo) ? *pLo : out;
+      lim = (lim > *pHi) ? *pHi : lim;
+      pLo++;
+      pHi++;
+
+      /* Update state, the integrator holds the limited output with anti-windup */
+      *pX2++ = *pX1;
+      *pX1++ = in;
+      *pY1++ = S->antiWindup ? lim : out;
+
+      *pDst++ = lim;
+
+      blkCnt--;
+    }
+  }
+}
+
+/**    
+ * @} end of PID group    
+ */
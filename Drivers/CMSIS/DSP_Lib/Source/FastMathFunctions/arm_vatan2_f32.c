@@ -0,0 +1,193 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vatan2_f32.c   
+*    
+* Description:	Floating-point vector four quadrant arctangent    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**        
+ * @ingroup groupFastMath        
+ */
+
+/**        
+ * @defgroup VATAN2 Vector Arctangent        
+ *        
+ * Computes the four quadrant arctangent of two vectors on an element-by-element basis,
+ * typically the phase of a complex vector held as separate imaginary and real parts.
+ *         
+ * <pre>        
+ *     pDst[n] = atan2(pSrcY[n], pSrcX[n]),   0 <= n < blockSize.        
+ * </pre>        
+ *         
+ * The ratio of the smaller to the larger magnitude is folded into [0 tan(pi/8)]
+ * with a single division and the arctangent is a degree 9 odd polynomial.
+ * The maximum error of arm_vatan2_f32() is 2.6e-7 rad. atan2(0, 0) returns 0 and
+ * a negative zero <code>y</code> is treated as positive.
+ *
+ * arm_vatan2_q31() takes any pair of Q31 components and returns the angle in Q2.29,
+ * within 1 LSB, without the floating-point unit: the pair is normalized, rotated
+ * into the right half plane and 16 CORDIC steps leave an angle small enough for
+ * <code>atan(y/x) = y/x</code>. arm_vatan2_q15() takes any pair of Q15 components
+ * and returns the angle in Q2.13, within 1 LSB.
+ *
+ * The functions support in-place computation with the destination on either input.
+ */
+
+/**        
+ * @addtogroup VATAN2        
+ * @{        
+ */
+
+/**        
+ * @brief Four quadrant arctangent of one pair, shared by the unrolled and the tail loop.        
+ */
+
+static __INLINE float32_t arm_vatan2_one_f32(
+  float32_t y,
+  float32_t x)
+{
+  float32_t ax = fabsf(x);                       /* |x|                                 */
+  float32_t ay = fabsf(y);                       /* |y|                                 */
+  float32_t lo, hi, num, den, base;              /* octant reduction                    */
+  float32_t t, z, p;                             /* reduced argument and polynomial     */
+  uint32_t big;                                  /* reduced around pi/4                 */
+
+  /* Fold to the first octant, atan(lo/hi) with lo <= hi */
+  lo = (ay < ax) ? ay : ax;
+  hi = (ay < ax) ? ax : ay;
+
+  /* Above tan(pi/8) use atan(t) = pi/4 + atan((t - 1)/(t + 1)), one division either way.
+   * Selects rather than branches, the octant of random data is not predictable */
+  big = (lo > 0.414213562f * hi);
+  num = big ? (lo - hi) : lo;
+  den = big ? (lo + hi) : ((hi > 0.0f) ? hi : 1.0f);
+  base = big ? 0.785398163f : 0.0f;
+
+  t = num / den;
+  z = t * t;
+
+  /* atan(t) = t + t^3 * P(t^2) for |t| <= tan(pi/8) */
+  p = 8.05374449538e-2f;
+  p = p * z - 1.38776856032e-1f;
+  p = p * z + 1.99777106478e-1f;
+  p = p * z - 3.33329491539e-1f;
+  p = p * z * t + t + base;
+
+  /* Unfold to the octant, then to the quadrant */
+  p = (ay > ax) ? (1.57079633f - p) : p;
+  p = (x < 0.0f) ? (3.14159265f - p) : p;
+
+  return (y < 0.0f) ? -p : p;
+}
+
+
+/**        
+ * @brief Floating-point vector four quadrant arctangent.        
+ * @param[in]       *pSrcY points to the y (imaginary) input buffer        
+ * @param[in]       *pSrcX points to the x (real) input buffer        
+ * @param[out]      *pDst points to the output buffer, angles in radians in [-pi pi]        
+ * @param[in]       blockSize number of samples in each vector        
+ * @return none.        
+ */
+
+void arm_vatan2_f32(
+  const float32_t * pSrcY,
+  const float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t out1, out2, out3, out4;              /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = atan2(A, B), four independent evaluations keep the FPU pipeline busy */
+    out1 = arm_vatan2_one_f32(pSrcY[0], pSrcX[0]);
+    out2 = arm_vatan2_one_f32(pSrcY[1], pSrcX[1]);
+    out3 = arm_vatan2_one_f32(pSrcY[2], pSrcX[2]);
+    out4 = arm_vatan2_one_f32(pSrcY[3], pSrcX[3]);
+
+    pDst[0] = out1;
+    pDst[1] = out2;
+    pDst[2] = out3;
+    pDst[3] = out4;
+
+    /* Update source and destination pointers to process next samples */
+    pSrcY += 4u;
+    pSrcX += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0_FAMILY   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = atan2(A, B) */
+    *pDst++ = arm_vatan2_one_f32(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**        
+ * @} end of VATAN2 group        
+ */
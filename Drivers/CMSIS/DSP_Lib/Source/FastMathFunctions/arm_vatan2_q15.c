@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vatan2_q15.c   
+*    
+* Description:	Q15 vector four quadrant arctangent    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**        
+ * @ingroup groupFastMath        
+ */
+
+/**        
+ * @addtogroup VATAN2        
+ * @{        
+ */
+
+#define ARM_VATAN2_Q15_CHUNK  32u
+
+/**        
+ * @brief Q15 vector four quadrant arctangent.        
+ * @param[in]       *pSrcY points to the y (imaginary) input buffer        
+ * @param[in]       *pSrcX points to the x (real) input buffer        
+ * @param[out]      *pDst points to the output buffer, angles in Q2.13        
+ * @param[in]       blockSize number of samples in each vector        
+ * @return none.        
+ */
+
+void arm_vatan2_q15(
+  const q15_t * pSrcY,
+  const q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t bufY[ARM_VATAN2_Q15_CHUNK];          /* y chunk, then the angles            */
+  float32_t bufX[ARM_VATAN2_Q15_CHUNK];          /* x chunk                             */
+  float32_t y;                                   /* floating-point result               */
+  uint32_t blkCnt, i;                            /* chunk length and index              */
+
+  while(blockSize > 0u)
+  {
+    blkCnt = (blockSize < ARM_VATAN2_Q15_CHUNK) ? blockSize : ARM_VATAN2_Q15_CHUNK;
+
+    /* Only the ratio matters, so the integer values are used as they are */
+    for(i = 0u; i < blkCnt; i++)
+    {
+      bufY[i] = (float32_t) pSrcY[i];
+      bufX[i] = (float32_t) pSrcX[i];
+    }
+
+    arm_vatan2_f32(bufY, bufX, bufY, blkCnt);
+
+    /* To Q2.13 with rounding, pi is 25736 */
+    for(i = 0u; i < blkCnt; i++)
+    {
+      y = bufY[i] * 8192.0f;
+      pDst[i] = (q15_t) ((y > 0.0f) ? (y + 0.5f) : (y - 0.5f));
+    }
+
+    /* Update pointers and the remaining length */
+    pSrcY += blkCnt;
+    pSrcX += blkCnt;
+    pDst += blkCnt;
+    blockSize -= blkCnt;
+  }
+}
+
+/**        
+ * @} end of VATAN2 group        
+ */
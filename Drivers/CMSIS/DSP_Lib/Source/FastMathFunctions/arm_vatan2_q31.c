@@ -0,0 +1,204 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vatan2_q31.c   
+*    
+* Description:	Q31 vector four quadrant arctangent    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**        
+ * @ingroup groupFastMath        
+ */
+
+/**        
+ * @addtogroup VATAN2        
+ * @{        
+ */
+
+/* Q61 arctangents atan(2^-i) of the CORDIC steps */
+static const q63_t armVatan2Q31Atan[16] = {
+  0x1921FB54442D1847, 0x0ED63382B0DDA7B4, 0x07D6DD7E4B203759,
+  0x03FAB7535585EDB9, 0x01FF55BB72CFDE9C, 0x00FFEAADDD4BB125,
+  0x007FFD556EEDCA6B, 0x003FFFAAAB77752E, 0x001FFFF5555BBBB7,
+  0x000FFFFEAAAADDDE, 0x0007FFFFD55556EF, 0x0003FFFFFAAAAAB7,
+  0x0001FFFFFF555556, 0x0000FFFFFFEAAAAB, 0x00007FFFFFFD5555,
+  0x00003FFFFFFFAAAB
+};
+
+/**        
+ * @brief Four quadrant arctangent of one Q31 pair in Q2.29, shared by the unrolled and the tail loop.        
+ */
+
+static __INLINE q31_t arm_vatan2_one_q31(
+  q31_t y,
+  q31_t x)
+{
+  q63_t xs, ys, t;                               /* rotated vector                      */
+  q63_t z;                                       /* angle in Q61                        */
+  uint32_t m, s, i;                              /* magnitude bits, shift and step      */
+
+  m = ((x < 0) ? 0u - (uint32_t) x : (uint32_t) x) | ((y < 0) ? 0u - (uint32_t) y : (uint32_t) y);
+  if(m == 0u)
+  {
+    return 0;
+  }
+
+  /* Scale the larger magnitude to [2^55 2^56), so the truncation in the steps stays far below the result */
+  s = __CLZ(m) + 24u;
+  xs = (q63_t) x * ((q63_t) 1 << s);
+  ys = (q63_t) y * ((q63_t) 1 << s);
+
+  /* Left half plane: rotate by -pi/2 or pi/2 first, as CORDIC only converges within 1.74 rad */
+  z = 0;
+  if(xs < 0)
+  {
+    t = xs;
+    if(ys >= 0)
+    {
+      xs = ys;
+      ys = -t;
+      z = 0x3243F6A8885A308D;
+    }
+    else
+    {
+      xs = -ys;
+      ys = t;
+      z = -0x3243F6A8885A308D;
+    }
+  }
+
+  /* Vectoring: each step rotates towards y = 0 by atan(2^-i), the gain does not matter */
+  for(i = 0u; i < 16u; i++)
+  {
+    t = xs;
+    if(ys >= 0)
+    {
+      xs += ys >> i;
+      ys -= t >> i;
+      z += armVatan2Q31Atan[i];
+    }
+    else
+    {
+      xs -= ys >> i;
+      ys += t >> i;
+      z -= armVatan2Q31Atan[i];
+    }
+  }
+
+  /* The remaining angle is below 2^-15, where atan(y/x) = y/x within 2^-46, taken in Q32 */
+  z += (ys / (xs >> 32)) * ((q63_t) 1 << 29);
+
+  /* Q61 to Q2.29 with rounding, pi is 0x6487ED51 */
+  return (q31_t) ((z + 0x80000000) >> 32);
+}
+
+
+/**        
+ * @brief Q31 vector four quadrant arctangent.        
+ * @param[in]       *pSrcY points to the y (imaginary) input buffer        
+ * @param[in]       *pSrcX points to the x (real) input buffer        
+ * @param[out]      *pDst points to the output buffer, angles in Q2.29        
+ * @param[in]       blockSize number of samples in each vector        
+ * @return none.        
+ */
+
+void arm_vatan2_q31(
+  const q31_t * pSrcY,
+  const q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t out1, out2, out3, out4;                  /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = atan2(A, B), four independent evaluations hide the loop overhead */
+    out1 = arm_vatan2_one_q31(pSrcY[0], pSrcX[0]);
+    out2 = arm_vatan2_one_q31(pSrcY[1], pSrcX[1]);
+    out3 = arm_vatan2_one_q31(pSrcY[2], pSrcX[2]);
+    out4 = arm_vatan2_one_q31(pSrcY[3], pSrcX[3]);
+
+    pDst[0] = out1;
+    pDst[1] = out2;
+    pDst[2] = out3;
+    pDst[3] = out4;
+
+    /* Update source and destination pointers to process next samples */
+    pSrcY += 4u;
+    pSrcX += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0_FAMILY   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = atan2(A, B) */
+    *pDst++ = arm_vatan2_one_q31(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**        
+ * @} end of VATAN2 group        
+ */
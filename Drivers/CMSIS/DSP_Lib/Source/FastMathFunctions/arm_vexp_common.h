@@ -0,0 +1,177 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vexp_common.h   
+*    
+* Description:	Exponential kernels shared by the fast math functions    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#ifndef _ARM_VEXP_COMMON_H
+#define _ARM_VEXP_COMMON_H
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/*
+ * Private to the fast math functions: the exponential kernels of
+ * arm_vexp, arm_vtanh and arm_vsigmoid, kept in one place so the
+ * floating-point and the fixed-point variants each have a single copy.
+ */
+
+/**        
+ * @brief Reduced floating-point exponential, x = k*ln(2) + r with |r| <= ln(2)/2.        
+ * @param[in]       x is the argument, clamped by the caller to [-87.34 88.38]        
+ * @param[out]      *pScale receives 2^k        
+ * @return exp(r) - 1, without the leading 1 so that small results keep their precision.        
+ */
+
+static __INLINE float32_t arm_vexpm1_reduced_f32(
+  float32_t x,
+  float32_t * pScale)
+{
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } k, s;                                        /* rounded x/ln(2) and 2^k             */
+  float32_t kf, r, p;                            /* k, reduced argument and polynomial  */
+
+  /* k = round(x / ln 2) by adding 1.5*2^23, the integer ends up in the low mantissa bits */
+  k.f = x * 1.44269504089f + 12582912.0f;
+  kf = k.f - 12582912.0f;
+
+  /* r = x - k*ln(2) with ln(2) split in two, so the product of the high part is exact */
+  r = x - kf * 0.693359375f;
+  r = r + kf * 2.12194440e-4f;
+
+  /* exp(r) - 1 = r + r^2/2 + ... + r^7/5040 */
+  p = 1.9875691500e-4f;
+  p = p * r + 1.3981999507e-3f;
+  p = p * r + 8.3334519073e-3f;
+  p = p * r + 4.1665795894e-2f;
+  p = p * r + 1.6666665459e-1f;
+  p = p * r + 5.0000001201e-1f;
+  p = p * r * r + r;
+
+  /* 2^k straight into the exponent field, k + 127 is in [1 254] over the clamped range */
+  s.u = (k.u - 0x4B400000u + 127u) << 23;
+  *pScale = s.f;
+
+  return p;
+}
+
+
+/**        
+ * @brief Floating-point exponential of one value, within 1 ulp.        
+ * @param[in]       x is the argument        
+ * @return exp(x), 0 below -87.34 and exp(88.38) above 88.38.        
+ */
+
+static __INLINE float32_t arm_vexp_one_f32(
+  float32_t x)
+{
+  float32_t s, p;                                /* 2^k and exp(r) - 1                  */
+  float32_t in = x;                              /* unclamped input                     */
+
+  if(x > 88.3762589f)
+  {
+    x = 88.3762589f;
+  }
+  if(x < -87.3365479f)
+  {
+    x = -87.3365479f;
+  }
+
+  p = arm_vexpm1_reduced_f32(x, &s);
+
+  return (in < -87.3365479f) ? 0.0f : (p + 1.0f) * s;
+}
+
+
+/**        
+ * @brief Scales a non-negative fixed-point value by log2(e).        
+ * @param[in]       a is the value, with any number of fraction bits        
+ * @return a*log2(e) with 30 more fraction bits, truncated.        
+ */
+
+static __INLINE uint64_t arm_vexp_log2e_q(
+  uint32_t a)
+{
+  /* log2(e) in Q30 and the next 32 bits, so the product is exact to one LSB */
+  return (uint64_t) a * 0x5C551D94u + (((uint64_t) a * 0xAE0BF85Eu) >> 32);
+}
+
+
+/**        
+ * @brief Fixed-point 2^-u for u >= 0, within 2^-32 relative.        
+ * @param[in]       u is the exponent in Q36        
+ * @return 2^-u in Q62, 1.0 is 2^62 and anything below 2^-62 is 0.        
+ */
+
+static __INLINE uint64_t arm_vexp2_neg_q62(
+  uint64_t u)
+{
+  uint64_t e;                                    /* 2^-f in Q62                         */
+  uint32_t k = (uint32_t) (u >> 36);             /* integer part                        */
+  uint32_t f = (uint32_t) (u >> 31) & 0x1Fu;     /* top 5 bits of the fraction          */
+  uint32_t t, w, h;                              /* table value, remainder, polynomial  */
+
+  if(k > 62u)
+  {
+    return 0u;
+  }
+
+  /* 2^-u = 2^-k * 2^(-(f + 1)/32) * exp(w), w = ((f + 1)/32 - fraction)*ln(2) in (0 0.0217] in Q36 */
+  t = armExp2TableQ32[f];
+  w = (uint32_t) (((uint64_t) (0x80000000u - ((uint32_t) u & 0x7FFFFFFFu)) * 0xB17217F8u + 0x80000000u) >> 32);
+
+  /* exp(w) - 1 = w + w^2/2 + w^3/6 + w^4/24 + w^5/120, the coefficients in Q32 */
+  h = 0x0AAAAAABu + (uint32_t) (((uint64_t) w * 0x02222222u) >> 36);
+  h = 0x2AAAAAABu + (uint32_t) (((uint64_t) w * h) >> 36);
+  h = 0x80000000u + (uint32_t) (((uint64_t) w * h) >> 36);
+  h = (uint32_t) (((uint64_t) w * h + 0x800000000u) >> 36);
+  h = w + (uint32_t) (((uint64_t) w * h + 0x80000000u) >> 32);
+
+  /* 2^(-(f + 1)/32) * (1 + h) in Q62, at most 1.0, then 2^-k */
+  e = ((uint64_t) t << 30) + (((uint64_t) t * h + 0x20u) >> 6);
+  if(e > ((uint64_t) 1 << 62))
+  {
+    e = (uint64_t) 1 << 62;
+  }
+
+  return e >> k;
+}
+
+#endif /* _ARM_VEXP_COMMON_H */
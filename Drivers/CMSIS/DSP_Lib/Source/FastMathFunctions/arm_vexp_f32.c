@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vexp_f32.c   
+*    
+* Description:	Floating-point vector exponential    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_vexp_common.h"
+
+/**        
+ * @ingroup groupFastMath        
+ */
+
+/**        
+ * @defgroup VEXP Vector Exponential        
+ *        
+ * Computes the natural exponential of a vector on an element-by-element basis.        
+ *         
+ * <pre>        
+ *     pDst[n] = exp(pSrc[n]),   0 <= n < blockSize.        
+ * </pre>        
+ *         
+ * The argument is split into <code>x = k*ln(2) + r</code> with <code>|r| <= ln(2)/2</code>,
+ * <code>exp(r)</code> is a degree 7 polynomial and <code>2^k</code> is written straight
+ * into the exponent field. The maximum error is 1 ulp (8.1e-8 relative).
+ * Arguments below -87.33 return 0 and arguments above 88.37 return <code>exp(88.37)</code>,
+ * so the output is never infinite. NaN inputs are not detected.
+ *
+ * arm_vexp_q31() takes inputs in Q5.26, the output format of arm_vlog_q31(), and
+ * returns Q31 within 1 LSB without the floating-point unit: <code>2^-u</code> with
+ * <code>u = -x*log2(e)</code> comes from a 32 entry table of powers of 2^(1/32) and a
+ * degree 5 polynomial in 64-bit integer arithmetic. arm_vexp_q15() takes inputs in
+ * Q4.11, the output format of arm_vlog_q15(), goes through arm_vexp_f32() and is
+ * within 1 LSB. Zero and positive inputs saturate to the largest fraction.
+ *
+ * The functions support in-place computation.
+ */
+
+/**        
+ * @addtogroup VEXP        
+ * @{        
+ */
+
+/**        
+ * @brief Floating-point vector exponential.        
+ * @param[in]       *pSrc points to the input buffer        
+ * @param[out]      *pDst points to the output buffer        
+ * @param[in]       blockSize number of samples in each vector        
+ * @return none.        
+ */
+
+void arm_vexp_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t out1, out2, out3, out4;              /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = exp(A), four independent evaluations keep the FPU pipeline busy */
+    out1 = arm_vexp_one_f32(pSrc[0]);
+    out2 = arm_vexp_one_f32(pSrc[1]);
+    out3 = arm_vexp_one_f32(pSrc[2]);
+    out4 = arm_vexp_one_f32(pSrc[3]);
+
+    pDst[0] = out1;
+    pDst[1] = out2;
+    pDst[2] = out3;
+    pDst[3] = out4;
+
+    /* Update source and destination pointers to process next samples */
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0_FAMILY   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = exp(A) */
+    *pDst++ = arm_vexp_one_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**        
+ * @} end of VEXP group        
+ */
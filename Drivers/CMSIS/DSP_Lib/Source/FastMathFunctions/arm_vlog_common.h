@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vlog_common.h   
+*    
+* Description:	Logarithm kernel shared by the fast math functions    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#ifndef _ARM_VLOG_COMMON_H
+#define _ARM_VLOG_COMMON_H
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/*
+ * Private to the fast math functions: the fixed-point logarithm kernel of
+ * arm_vlog_q31 and arm_vlog10_q31, returned before the final rounding so
+ * that the base 10 variant scales the full precision result.
+ */
+
+/**        
+ * @brief Natural logarithm of one positive Q31 value.        
+ * @param[in]       x is the argument, greater than 0        
+ * @return log(x / 2^31) in Q31, in [-31*log(2) 0], within 5 LSB.        
+ */
+
+static __INLINE q63_t arm_vlog_wide_q31(
+  q31_t x)
+{
+  q31_t d, r, t;                                 /* offset from the center, log(1 + r)  */
+  uint32_t u, s, i;                              /* normalized input, shift and index   */
+
+  /* x = u * 2^-s with u in [2^31 2^32), log(x / 2^31) = log(u / 2^31) - s*log(2) */
+  s = __CLZ(x);
+  u = (uint32_t) x << s;
+
+  /* u / 2^31 = c * (1 + r), c the center of the interval picked by the top 5 fraction bits */
+  i = (u >> 26) & 0x1Fu;
+  d = (q31_t) ((u & 0x7FFFFFFFu) - (i << 26) - 0x02000000u);
+  r = (q31_t) (((q63_t) d * armLogInvTableQ31[i]) >> 31);
+
+  /* log(1 + r) = r - r^2/2 + r^3/3 - r^4/4, the next term is below 2^-32 as |r| <= 2^-6 */
+  t = 0x2AAAAAAB - (r >> 2);
+  t = (q31_t) (((q63_t) r * t) >> 31) - 0x40000000;
+  t = (q31_t) (((q63_t) r * t) >> 31);
+  t = r + (q31_t) (((q63_t) r * t) >> 31);
+
+  /* log(c) + log(1 + r) - s*log(2) */
+  return (q63_t) armLogTableQ31[i] + t - (q63_t) s * 0x58B90BFC;
+}
+
+#endif /* _ARM_VLOG_COMMON_H */
@@ -0,0 +1,200 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vlog_f32.c   
+*    
+* Description:	Floating-point vector natural logarithm    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**        
+ * @ingroup groupFastMath        
+ */
+
+/**        
+ * @defgroup VLOG Vector Logarithm        
+ *        
+ * Computes the logarithm of a vector on an element-by-element basis.        
+ *         
+ * <pre>        
+ *     pDst[n] = log(pSrc[n]),   0 <= n < blockSize.        
+ * </pre>        
+ *         
+ * The floating-point functions split the input into <code>2^k * m</code> with
+ * <code>m</code> in [sqrt(1/2) sqrt(2)) and evaluate <code>log(m)</code> as a degree 9
+ * polynomial in <code>m - 1</code>. The maximum error of arm_vlog_f32() is 1 ulp
+ * (7.8e-8 relative, 3.9e-8 absolute near 1). arm_vlog10_f32() scales the
+ * natural logarithm and is within 2 ulp. Zero, negative and denormal inputs return
+ * -FLT_MAX (-FLT_MAX*log10(e) for arm_vlog10_f32()) so a log-magnitude spectrum of
+ * silence stays finite; infinite and NaN inputs are not detected.
+ *
+ * The fixed-point functions take inputs in (0 1) and return the natural logarithm
+ * in a format with enough integer bits for the whole range: Q5.26 for
+ * arm_vlog_q31() and Q4.11 for arm_vlog_q15(). Non-positive inputs saturate to the
+ * most negative output. arm_vlog_q31() is within 1 LSB using a 32 entry table and
+ * a degree 4 polynomial in fixed point; arm_vlog_q15() goes through
+ * arm_vlog_f32() and is within 1 LSB. The base 10 variants return Q4.27 and Q3.12:
+ * arm_vlog10_q31() scales the unrounded Q31 natural logarithm of the same kernel
+ * and arm_vlog10_q15() goes through arm_vlog10_f32(), both within 1 LSB.
+ *
+ * The functions support in-place computation.
+ */
+
+/**        
+ * @addtogroup VLOG        
+ * @{        
+ */
+
+/**        
+ * @brief Natural logarithm of one value, shared by the unrolled and the tail loop.        
+ */
+
+static __INLINE float32_t arm_vlog_one_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } m;                                           /* mantissa in [sqrt(1/2) sqrt(2))     */
+  float32_t e, z, y;                             /* exponent, square and polynomial     */
+  float32_t in = x;                              /* original input                      */
+  int32_t k;                                     /* binary exponent                     */
+
+  /* x = 2^k * m, subtracting the bits of sqrt(1/2) (0x3F3504F3) centers m on 1 */
+  m.f = x;
+  k = (int32_t) ((m.u + 0x004AFB0Du) >> 23) - 127;
+  m.u -= (uint32_t) k << 23;
+
+  e = (float32_t) k;
+  x = m.f - 1.0f;
+  z = x * x;
+
+  /* log(1 + x) = x - x^2/2 + x^3 * P(x) */
+  y = 7.0376836292e-2f;
+  y = y * x - 1.1514610310e-1f;
+  y = y * x + 1.1676998740e-1f;
+  y = y * x - 1.2420140846e-1f;
+  y = y * x + 1.4249322787e-1f;
+  y = y * x - 1.6668057665e-1f;
+  y = y * x + 2.0000714765e-1f;
+  y = y * x - 2.4999993993e-1f;
+  y = y * x + 3.3333331174e-1f;
+  y = y * x * z;
+
+  /* Add k*ln(2) with ln(2) split in two, the small part first */
+  y += e * -2.12194440e-4f;
+  y += -0.5f * z;
+  x += y;
+  x += e * 0.693359375f;
+
+  /* Zero, negative and denormal inputs return -FLT_MAX */
+  return (in >= 1.17549435e-38f) ? x : -3.40282347e+38f;
+}
+
+
+/**        
+ * @brief Floating-point vector natural logarithm.        
+ * @param[in]       *pSrc points to the input buffer        
+ * @param[out]      *pDst points to the output buffer        
+ * @param[in]       blockSize number of samples in each vector        
+ * @return none.        
+ */
+
+void arm_vlog_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t out1, out2, out3, out4;              /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = log(A), four independent evaluations keep the FPU pipeline busy */
+    out1 = arm_vlog_one_f32(pSrc[0]);
+    out2 = arm_vlog_one_f32(pSrc[1]);
+    out3 = arm_vlog_one_f32(pSrc[2]);
+    out4 = arm_vlog_one_f32(pSrc[3]);
+
+    pDst[0] = out1;
+    pDst[1] = out2;
+    pDst[2] = out3;
+    pDst[3] = out4;
+
+    /* Update source and destination pointers to process next samples */
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0_FAMILY   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = log(A) */
+    *pDst++ = arm_vlog_one_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**        
+ * @} end of VLOG group        
+ */
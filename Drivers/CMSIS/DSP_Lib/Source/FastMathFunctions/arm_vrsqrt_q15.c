@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vrsqrt_q15.c   
+*    
+* Description:	Q15 vector reciprocal square root    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**        
+ * @ingroup groupFastMath        
+ */
+
+/**        
+ * @addtogroup VSQRT        
+ * @{        
+ */
+
+#define ARM_VRSQRT_Q15_CHUNK  32u
+
+/**        
+ * @brief Q15 vector reciprocal square root.        
+ * @param[in]       *pSrc points to the input buffer        
+ * @param[out]      *pDst points to the output mantissas in [0.5 1)        
+ * @param[out]      *pShift points to the output exponents, the result is pDst[n] * 2^pShift[n]        
+ * @param[in]       blockSize number of samples in each vector        
+ * @return none.        
+ */
+
+void arm_vrsqrt_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  int16_t * pShift,
+  uint32_t blockSize)
+{
+  float32_t buf[ARM_VRSQRT_Q15_CHUNK];           /* chunk in floating point             */
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } y;                                           /* floating-point result               */
+  int32_t e;                                     /* exponent                            */
+  q31_t m;                                       /* rounded mantissa                    */
+  uint32_t blkCnt, i;                            /* chunk length and index              */
+
+  while(blockSize > 0u)
+  {
+    blkCnt = (blockSize < ARM_VRSQRT_Q15_CHUNK) ? blockSize : ARM_VRSQRT_Q15_CHUNK;
+
+    /* The Q15 value converts exactly */
+    for(i = 0u; i < blkCnt; i++)
+    {
+      buf[i] = (float32_t) pSrc[i] * (1.0f / 32768.0f);
+    }
+
+    arm_vrsqrt_f32(buf, buf, blkCnt);
+
+    /* Mantissa in [0.5 1) and exponent from the float fields, 0 for non-positive inputs */
+    for(i = 0u; i < blkCnt; i++)
+    {
+      y.f = buf[i];
+      if(y.u == 0u)
+      {
+        pDst[i] = 0;
+        pShift[i] = 0;
+      }
+      else
+      {
+        e = (int32_t) (y.u >> 23) - 126;
+        y.u = (y.u & 0x007FFFFFu) | 0x3F000000u;
+        m = (q31_t) (y.f * 32768.0f + 0.5f);
+
+        /* A mantissa that rounds up to 1.0 becomes 0.5 with the next exponent */
+        if(m > 0x7FFF)
+        {
+          m = 0x4000;
+          e++;
+        }
+        pDst[i] = (q15_t) m;
+        pShift[i] = (int16_t) e;
+      }
+    }
+
+    /* Update pointers and the remaining length */
+    pSrc += blkCnt;
+    pDst += blkCnt;
+    pShift += blkCnt;
+    blockSize -= blkCnt;
+  }
+}
+
+/**        
+ * @} end of VSQRT group        
+ */
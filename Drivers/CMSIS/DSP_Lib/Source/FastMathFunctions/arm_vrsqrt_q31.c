@@ -0,0 +1,183 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vrsqrt_q31.c   
+*    
+* Description:	Q31 vector reciprocal square root    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**        
+ * @ingroup groupFastMath        
+ */
+
+/**        
+ * @addtogroup VSQRT        
+ * @{        
+ */
+
+/**        
+ * @brief Reciprocal square root of one Q31 value, shared by the unrolled and the tail loop.        
+ */
+
+static __INLINE q31_t arm_vrsqrt_one_q31(
+  q31_t x,
+  int16_t * pShift)
+{
+  q63_t r;                                       /* residual 1 - a*y^2 in Q59           */
+  uint64_t t, p;                                 /* y^2 and a*y^2                       */
+  float32_t f;                                   /* floating-point estimate             */
+  uint32_t y;                                    /* result                              */
+  uint32_t s;                                    /* even normalization shift            */
+
+  if(x <= 0)
+  {
+    *pShift = 0;
+    return 0;
+  }
+
+  /* Normalize to a = x / 2^31 in [0.25 1) with an even shift, half of it goes to the exponent */
+  s = (__CLZ(x) - 1u) & ~1u;
+  x <<= s;
+
+  /* Estimate of y = 2^30 / sqrt(a) within 2^-22, in (2^30 2^31] */
+  arm_sqrt_f32((float32_t) x, &f);
+  f = 4.97582162e13f / f;
+  if(f > 2147483648.0f)
+  {
+    f = 2147483648.0f;
+  }
+  y = (uint32_t) f;
+
+  /* One Newton-Raphson step on the exact residual, y += y * (1 - a*y^2) / 2 */
+  t = (uint64_t) y * y;
+  p = (uint64_t) x * (uint32_t) (t >> 32) + (((uint64_t) x * (uint32_t) t) >> 32);
+  r = ((q63_t) 1 << 59) - (q63_t) p;
+  y = (uint32_t) ((q63_t) y + (((q63_t) y * (r >> 24) + ((q63_t) 1 << 35)) >> 36));
+
+  /* y read as Q31 is the mantissa 1 / (2*sqrt(a)), a mantissa that rounds up to 1.0 becomes 0.5 with the next exponent */
+  s = (s >> 1) + 1u;
+  if(y > 0x7FFFFFFFu)
+  {
+    y = 0x40000000u;
+    s++;
+  }
+  else if(y < 0x40000000u)
+  {
+    y = 0x40000000u;
+  }
+
+  *pShift = (int16_t) s;
+
+  return (q31_t) y;
+}
+
+
+/**        
+ * @brief Q31 vector reciprocal square root.        
+ * @param[in]       *pSrc points to the input buffer        
+ * @param[out]      *pDst points to the output mantissas in [0.5 1)        
+ * @param[out]      *pShift points to the output exponents, the result is pDst[n] * 2^pShift[n]        
+ * @param[in]       blockSize number of samples in each vector        
+ * @return none.        
+ */
+
+void arm_vrsqrt_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  int16_t * pShift,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t out1, out2, out3, out4;                  /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = 1 / sqrt(A), four independent evaluations hide the divide and multiply latency */
+    out1 = arm_vrsqrt_one_q31(pSrc[0], &pShift[0]);
+    out2 = arm_vrsqrt_one_q31(pSrc[1], &pShift[1]);
+    out3 = arm_vrsqrt_one_q31(pSrc[2], &pShift[2]);
+    out4 = arm_vrsqrt_one_q31(pSrc[3], &pShift[3]);
+
+    pDst[0] = out1;
+    pDst[1] = out2;
+    pDst[2] = out3;
+    pDst[3] = out4;
+
+    /* Update source and destination pointers to process next samples */
+    pSrc += 4u;
+    pDst += 4u;
+    pShift += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0_FAMILY   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = 1 / sqrt(A) */
+    *pDst++ = arm_vrsqrt_one_q31(*pSrc++, pShift++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**        
+ * @} end of VSQRT group        
+ */
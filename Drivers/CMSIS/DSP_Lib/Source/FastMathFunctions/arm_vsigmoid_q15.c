@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vsigmoid_q15.c   
+*    
+* Description:	Q15 vector logistic function    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**        
+ * @ingroup groupFastMath        
+ */
+
+/**        
+ * @addtogroup VSIGMOID        
+ * @{        
+ */
+
+#define ARM_VSIGMOID_Q15_CHUNK  32u
+
+/**        
+ * @brief Q15 vector logistic function.        
+ * @param[in]       *pSrc points to the input buffer, in Q3.12        
+ * @param[out]      *pDst points to the output buffer        
+ * @param[in]       blockSize number of samples in each vector        
+ * @return none.        
+ */
+
+void arm_vsigmoid_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t buf[ARM_VSIGMOID_Q15_CHUNK];         /* chunk in floating point             */
+  float32_t y;                                   /* floating-point result               */
+  uint32_t blkCnt, i;                            /* chunk length and index              */
+
+  while(blockSize > 0u)
+  {
+    blkCnt = (blockSize < ARM_VSIGMOID_Q15_CHUNK) ? blockSize : ARM_VSIGMOID_Q15_CHUNK;
+
+    /* From Q3.12 */
+    for(i = 0u; i < blkCnt; i++)
+    {
+      buf[i] = (float32_t) pSrc[i] * (1.0f / 4096.0f);
+    }
+
+    arm_vsigmoid_f32(buf, buf, blkCnt);
+
+    /* To Q15 with rounding, 1.0 saturates to 0x7FFF */
+    for(i = 0u; i < blkCnt; i++)
+    {
+      y = buf[i] * 32768.0f + 0.5f;
+      pDst[i] = (q15_t) __SSAT((q31_t) y, 16);
+    }
+
+    /* Update pointers and the remaining length */
+    pSrc += blkCnt;
+    pDst += blkCnt;
+    blockSize -= blkCnt;
+  }
+}
+
+/**        
+ * @} end of VSIGMOID group        
+ */
@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vsigmoid_q31.c   
+*    
+* Description:	Q31 vector logistic function    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_vexp_common.h"
+
+/**        
+ * @ingroup groupFastMath        
+ */
+
+/**        
+ * @addtogroup VSIGMOID        
+ * @{        
+ */
+
+/**        
+ * @brief Logistic function of one Q3.28 value in Q31, shared by the unrolled and the tail loop.        
+ */
+
+static __INLINE q31_t arm_vsigmoid_one_q31(
+  q31_t x)
+{
+  uint64_t e, d;                                 /* exp(-|x|) in Q62, 1 + e in Q32      */
+  uint32_t a;                                    /* |x|                                 */
+
+  a = (x < 0) ? 0u - (uint32_t) x : (uint32_t) x;
+
+  /* e = exp(-|x|) = 2^-u with u = |x|*log2(e), from Q58 to Q36 with rounding */
+  e = arm_vexp2_neg_q62((arm_vexp_log2e_q(a) + 0x00200000u) >> 22);
+
+  /* 1 / (1 + e) for x >= 0 and e / (1 + e) below, the divisor rounded to Q32 gives Q31 */
+  d = (((uint64_t) 1 << 62) + e + 0x20000000u) >> 30;
+  e = (((x < 0) ? e * 2u : (uint64_t) 1 << 63) + (d >> 1)) / d;
+
+  return (e > 0x7FFFFFFFu) ? 0x7FFFFFFF : (q31_t) e;
+}
+
+
+/**        
+ * @brief Q31 vector logistic function.        
+ * @param[in]       *pSrc points to the input buffer, in Q3.28        
+ * @param[out]      *pDst points to the output buffer        
+ * @param[in]       blockSize number of samples in each vector        
+ * @return none.        
+ */
+
+void arm_vsigmoid_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t out1, out2, out3, out4;                  /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = sigmoid(A), four independent evaluations hide the multiply latency */
+    out1 = arm_vsigmoid_one_q31(pSrc[0]);
+    out2 = arm_vsigmoid_one_q31(pSrc[1]);
+    out3 = arm_vsigmoid_one_q31(pSrc[2]);
+    out4 = arm_vsigmoid_one_q31(pSrc[3]);
+
+    pDst[0] = out1;
+    pDst[1] = out2;
+    pDst[2] = out3;
+    pDst[3] = out4;
+
+    /* Update source and destination pointers to process next samples */
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0_FAMILY   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = sigmoid(A) */
+    *pDst++ = arm_vsigmoid_one_q31(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**        
+ * @} end of VSIGMOID group        
+ */
@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vsqrt_f32.c   
+*    
+* Description:	Floating-point vector square root    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**        
+ * @ingroup groupFastMath        
+ */
+
+/**        
+ * @defgroup VSQRT Vector Square Root        
+ *        
+ * Computes the square root or the reciprocal square root of a vector on an
+ * element-by-element basis.        
+ *         
+ * <pre>        
+ *     pDst[n] = sqrt(pSrc[n]),       0 <= n < blockSize.        
+ *     pDst[n] = 1 / sqrt(pSrc[n]),   0 <= n < blockSize.        
+ * </pre>        
+ *         
+ * arm_vsqrt_f32() uses the hardware square root through arm_sqrt_f32() and is
+ * correctly rounded. arm_vrsqrt_f32() avoids the division: it starts from the
+ * integer estimate 0x5F375A86 - (x >> 1) and takes three Newton-Raphson steps,
+ * within 2.5 ulp (1.5e-7 relative). Both return 0 for negative inputs and
+ * arm_vrsqrt_f32() also returns 0 for zero and denormal inputs; infinite and
+ * NaN inputs are not detected.
+ *
+ * The fixed-point functions take inputs in [0 1) and are within 1 LSB:
+ * arm_vsqrt_q15() through the floating-point unit and arm_vsqrt_q31() with one
+ * integer correction of a floating-point estimate. Negative inputs return 0.
+ * arm_vrsqrt_q31() and arm_vrsqrt_q15() return the reciprocal square root, which is
+ * above 1, as a mantissa in [0.5 1) and a shift: <code>1/sqrt(x) = pDst[n] * 2^pShift[n]</code>,
+ * within 1 LSB of the mantissa. arm_vrsqrt_q31() corrects a floating-point estimate
+ * with one integer Newton-Raphson step, arm_vrsqrt_q15() goes through arm_vrsqrt_f32().
+ * Zero and negative inputs return 0 with a shift of 0.
+ *
+ * The functions support in-place computation.
+ */
+
+/**        
+ * @addtogroup VSQRT        
+ * @{        
+ */
+
+/**        
+ * @brief Square root of one value, shared by the unrolled and the tail loop.        
+ */
+
+static __INLINE float32_t arm_vsqrt_one_f32(
+  float32_t x)
+{
+  float32_t y;                                   /* square root, 0 for negative inputs  */
+
+  arm_sqrt_f32(x, &y);
+
+  return y;
+}
+
+
+/**        
+ * @brief Floating-point vector square root.        
+ * @param[in]       *pSrc points to the input buffer        
+ * @param[out]      *pDst points to the output buffer        
+ * @param[in]       blockSize number of samples in each vector        
+ * @return none.        
+ */
+
+void arm_vsqrt_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t out1, out2, out3, out4;              /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = sqrt(A), four independent evaluations keep the FPU pipeline busy */
+    out1 = arm_vsqrt_one_f32(pSrc[0]);
+    out2 = arm_vsqrt_one_f32(pSrc[1]);
+    out3 = arm_vsqrt_one_f32(pSrc[2]);
+    out4 = arm_vsqrt_one_f32(pSrc[3]);
+
+    pDst[0] = out1;
+    pDst[1] = out2;
+    pDst[2] = out3;
+    pDst[3] = out4;
+
+    /* Update source and destination pointers to process next samples */
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0_FAMILY   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = sqrt(A) */
+    *pDst++ = arm_vsqrt_one_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**        
+ * @} end of VSQRT group        
+ */
@@ -0,0 +1,171 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_vtanh_f32.c   
+*    
+* Description:	Floating-point vector hyperbolic tangent    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_vexp_common.h"
+
+/**        
+ * @ingroup groupFastMath        
+ */
+
+/**        
+ * @defgroup VTANH Vector Hyperbolic Tangent        
+ *        
+ * Computes the hyperbolic tangent of a vector on an element-by-element basis.        
+ *         
+ * <pre>        
+ *     pDst[n] = tanh(pSrc[n]),   0 <= n < blockSize.        
+ * </pre>        
+ *         
+ * The floating-point function evaluates <code>exp(-2|x|) - 1</code> with the
+ * exponential reduction of arm_vexp_f32() but without adding the leading 1, so
+ * there is no cancellation for small inputs, and needs one division per value.
+ * The maximum error is 2.5 ulp (1.8e-7 relative) over the whole range.
+ *
+ * arm_vtanh_q31() takes inputs in Q3.28 (-8 to 8) and returns Q31 within 1 LSB,
+ * with the fixed-point exponential of arm_vexp_q31() and one 64-bit division.
+ * arm_vtanh_q15() takes inputs in Q3.12 and returns Q15, within 1 LSB.
+ *
+ * The functions support in-place computation.
+ */
+
+/**        
+ * @addtogroup VTANH        
+ * @{        
+ */
+
+/**        
+ * @brief Hyperbolic tangent of one value, shared by the unrolled and the tail loop.        
+ */
+
+static __INLINE float32_t arm_vtanh_one_f32(
+  float32_t x)
+{
+  float32_t a, s, p, em1;                        /* -2|x|, 2^k and exp(a) - 1           */
+
+  /* tanh(|x|) = -expm1(a) / (2 + expm1(a)) with a = -2|x|, beyond |x| = 9 it is 1.0f */
+  a = -2.0f * fabsf(x);
+  if(a < -18.0f)
+  {
+    a = -18.0f;
+  }
+
+  /* exp(a) - 1 = 2^k * (exp(r) - 1) + (2^k - 1), kept without the 1 to avoid cancellation */
+  p = arm_vexpm1_reduced_f32(a, &s);
+  em1 = s * p + (s - 1.0f);
+
+  p = -em1 / (2.0f + em1);
+
+  return (x < 0.0f) ? -p : p;
+}
+
+
+/**        
+ * @brief Floating-point vector hyperbolic tangent.        
+ * @param[in]       *pSrc points to the input buffer        
+ * @param[out]      *pDst points to the output buffer        
+ * @param[in]       blockSize number of samples in each vector        
+ * @return none.        
+ */
+
+void arm_vtanh_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t out1, out2, out3, out4;              /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = tanh(A), four independent evaluations keep the FPU pipeline busy */
+    out1 = arm_vtanh_one_f32(pSrc[0]);
+    out2 = arm_vtanh_one_f32(pSrc[1]);
+    out3 = arm_vtanh_one_f32(pSrc[2]);
+    out4 = arm_vtanh_one_f32(pSrc[3]);
+
+    pDst[0] = out1;
+    pDst[1] = out2;
+    pDst[2] = out3;
+    pDst[3] = out4;
+
+    /* Update source and destination pointers to process next samples */
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0_FAMILY   */
+
+  while(blkCnt > 0u)
+  {
+    /* C = tanh(A) */
+    *pDst++ = arm_vtanh_one_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**        
+ * @} end of VTANH group        
+ */
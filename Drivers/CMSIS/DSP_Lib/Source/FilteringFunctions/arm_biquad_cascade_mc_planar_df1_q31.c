@@ -0,0 +1,264 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_biquad_cascade_mc_planar_df1_q31.c   
+*    
+* Description:	Processing function for the Q31 multichannel planar Biquad cascade filter    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup BiquadCascadeDF1    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the Q31 multichannel Biquad cascade filter.    
+ * @param[in]  *S        points to an instance of the Q31 multichannel Biquad cascade structure.    
+ * @param[in]  *pSrc     points to the block of input data.    
+ * @param[out] *pDst     points to the block of output data.    
+ * @param[in]  blockSize number of samples to process per channel.    
+ * @return none.    
+ *    
+ * \par    
+ * All channels are filtered with the same coefficients and each has its own state.    
+ * <code>pSrc</code> and <code>pDst</code> hold the channels one after the other (planar):
+ * <pre>
+ *     {x0[0], x0[1], ..., x0[blockSize-1], x1[0], x1[1], ..., x1[blockSize-1], ...}
+ * </pre>
+ * so each of them contains <code>numChannels*blockSize</code> values.    
+ * \par    
+ * The output of each channel is bit exact with <code>arm_biquad_cascade_df1_q31()</code> and the scaling and    
+ * overflow behavior is the same.  The coefficients of a stage are loaded once per block; unlike the floating-point    
+ * version the channels are filtered one after the other, since the 4 state variables and 64-bit accumulator    
+ * of a second channel do not fit in the core registers next to those of the first.    
+ */
+
+void arm_biquad_cascade_mc_planar_df1_q31(
+  const arm_biquad_casd_mc_df1_inst_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q63_t acc;                                     /*  accumulator                   */
+  uint32_t lShift = 31u - S->postShift;          /*  Shift to be applied to the output */
+  const q31_t *pIn = pSrc;                       /*  input pointer initialization  */
+  q31_t *pState = S->pState;                     /*  pState pointer initialization */
+  q31_t *pCoeffs = S->pCoeffs;                   /*  coeff pointer initialization  */
+  const q31_t *px;                               /*  channel input pointer         */
+  q31_t *py;                                     /*  channel output pointer        */
+  q31_t Xn1, Xn2, Yn1, Yn2;                      /*  Filter state variables        */
+  q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients           */
+  q31_t Xn;                                      /*  temporary input               */
+  uint32_t numCh = S->numChannels;               /*  number of channels            */
+  uint32_t chOfs = blockSize;                    /*  distance between channels     */
+  uint32_t sample, ch, stage = S->numStages;     /*  loop counters                 */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+    pCoeffs += 5u;
+
+    for(ch = 0u; ch < numCh; ch++)
+    {
+      /* Reading the state values */
+      Xn1 = pState[0];
+      Xn2 = pState[1];
+      Yn1 = pState[2];
+      Yn2 = pState[3];
+
+      px = pIn + ch * chOfs;
+      py = pDst + ch * chOfs;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Apply loop unrolling and compute 4 output values simultaneously. */
+      sample = blockSize >> 2u;
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        Xn = *px;
+        px++;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q63_t) b0 * Xn;
+        acc += (q63_t) b1 * Xn1;
+        acc += (q63_t) b2 * Xn2;
+        acc += (q63_t) a1 * Yn1;
+        acc += (q63_t) a2 * Yn2;
+
+        /* The result is converted to 1.31, Yn2 is reused */
+        Yn2 = (q31_t) (acc >> lShift);
+
+        /* Store the output in the destination buffer. */
+        *py = Yn2;
+        py++;
+
+        /* Read the input */
+        Xn2 = *px;
+        px++;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q63_t) b0 * Xn2;
+        acc += (q63_t) b1 * Xn;
+        acc += (q63_t) b2 * Xn1;
+        acc += (q63_t) a1 * Yn2;
+        acc += (q63_t) a2 * Yn1;
+
+        /* The result is converted to 1.31, Yn1 is reused */
+        Yn1 = (q31_t) (acc >> lShift);
+
+        /* Store the output in the destination buffer. */
+        *py = Yn1;
+        py++;
+
+        /* Read the input */
+        Xn1 = *px;
+        px++;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q63_t) b0 * Xn1;
+        acc += (q63_t) b1 * Xn2;
+        acc += (q63_t) b2 * Xn;
+        acc += (q63_t) a1 * Yn1;
+        acc += (q63_t) a2 * Yn2;
+
+        /* The result is converted to 1.31, Yn2 is reused */
+        Yn2 = (q31_t) (acc >> lShift);
+
+        /* Store the output in the destination buffer. */
+        *py = Yn2;
+        py++;
+
+        /* Read the input */
+        Xn = *px;
+        px++;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q63_t) b0 * Xn;
+        acc += (q63_t) b1 * Xn1;
+        acc += (q63_t) b2 * Xn2;
+        acc += (q63_t) a1 * Yn2;
+        acc += (q63_t) a2 * Yn1;
+
+        /* The result is converted to 1.31, Yn1 is reused */
+        Yn1 = (q31_t) (acc >> lShift);
+
+        /* Store the output in the destination buffer. */
+        *py = Yn1;
+        py++;
+        /* Every time after the output is computed state should be updated. */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+       ** No loop unrolling is used. */
+      sample = (blockSize & 0x3u);
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      sample = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        Xn = *px;
+        px++;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q63_t) b0 * Xn;
+        acc += (q63_t) b1 * Xn1;
+        acc += (q63_t) b2 * Xn2;
+        acc += (q63_t) a1 * Yn1;
+        acc += (q63_t) a2 * Yn2;
+
+        /* The result is converted to 1.31 */
+        acc = acc >> lShift;
+
+        /* Every time after the output is computed state should be updated. */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = (q31_t) acc;
+
+        /* Store the output in the destination buffer. */
+        *py = (q31_t) acc;
+        py++;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /* Store the updated state variables back into the pState array */
+      pState[0] = Xn1;
+      pState[1] = Xn2;
+      pState[2] = Yn1;
+      pState[3] = Yn2;
+      pState += 4u;
+    }
+
+    /* The current stage output is given as the input to the next stage */
+    pIn = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**    
+ * @} end of BiquadCascadeDF1 group    
+ */
@@ -0,0 +1,240 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_biquad_cascade_mc_planar_df2T_f32.c   
+*    
+* Description:	Processing function for the floating-point multichannel planar transposed direct form II Biquad cascade filter    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup BiquadCascadeDF2T    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point multichannel transposed direct form II Biquad cascade filter.    
+ * @param[in]  *S        points to an instance of the filter data structure.    
+ * @param[in]  *pSrc     points to the block of input data.    
+ * @param[out] *pDst     points to the block of output data.    
+ * @param[in]  blockSize number of samples to process per channel.    
+ * @return none.    
+ *    
+ * \par    
+ * All channels are filtered with the same coefficients and each has its own state.    
+ * <code>pSrc</code> and <code>pDst</code> hold the channels one after the other (planar):
+ * <pre>
+ *     {x0[0], x0[1], ..., x0[blockSize-1], x1[0], x1[1], ..., x1[blockSize-1], ...}
+ * </pre>
+ * so each of them contains <code>numChannels*blockSize</code> values.    
+ * \par    
+ * The channels are filtered four at a time in lockstep: the coefficients of a stage are loaded once    
+ * per block and the four independent recursions are interleaved, so each multiply-accumulate has    
+ * three others between it and the one that needs its result.  The remaining 1 to 3 channels are    
+ * filtered one at a time.  The output of each channel is that of <code>arm_biquad_cascade_df2T_f32()</code>.    
+ */
+
+void arm_biquad_cascade_mc_planar_df2T_f32(
+  const arm_biquad_cascade_mc_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  const float32_t *pIn = pSrc;                   /*  source pointer            */
+  float32_t *pState = S->pState;                 /*  State pointer             */
+  float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+  const float32_t *px;                           /*  channel input pointer     */
+  float32_t *py;                                 /*  channel output pointer    */
+  float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+  float32_t Xna, d1a, d2a, acca;                 /*  input, state, output      */
+  uint32_t numCh = S->numChannels;               /*  number of channels        */
+  uint32_t chOfs = blockSize;                    /*  distance between channels */
+  uint32_t sample, ch, stage = S->numStages;     /*  loop counters             */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  float32_t Xnb, Xnc, Xnd;                       /*  inputs of channels b..d   */
+  float32_t d1b, d2b, d1c, d2c, d1d, d2d;        /*  states of channels b..d   */
+  float32_t accb, accc, accd;                    /*  outputs of channels b..d  */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+    pCoeffs += 5u;
+
+    ch = 0u;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Four channels at a time */
+    for(; (ch + 4u) <= numCh; ch += 4u)
+    {
+      /* Reading the state values */
+      d1a = pState[0];
+      d2a = pState[1];
+      d1b = pState[2];
+      d2b = pState[3];
+      d1c = pState[4];
+      d2c = pState[5];
+      d1d = pState[6];
+      d2d = pState[7];
+
+      px = pIn + ch * chOfs;
+      py = pDst + ch * chOfs;
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the inputs of the four channels */
+        Xna = px[0];
+        Xnb = px[chOfs];
+        Xnc = px[2u * chOfs];
+        Xnd = px[3u * chOfs];
+        px++;
+
+        /* y[n] = b0 * x[n] + d1 */
+        acca = b0 * Xna + d1a;
+        accb = b0 * Xnb + d1b;
+        accc = b0 * Xnc + d1c;
+        accd = b0 * Xnd + d1d;
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        d1a = b1 * Xna + d2a;
+        d1b = b1 * Xnb + d2b;
+        d1c = b1 * Xnc + d2c;
+        d1d = b1 * Xnd + d2d;
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        d2a = b2 * Xna;
+        d2b = b2 * Xnb;
+        d2c = b2 * Xnc;
+        d2d = b2 * Xnd;
+
+        d1a += a1 * acca;
+        d1b += a1 * accb;
+        d1c += a1 * accc;
+        d1d += a1 * accd;
+
+        d2a += a2 * acca;
+        d2b += a2 * accb;
+        d2c += a2 * accc;
+        d2d += a2 * accd;
+
+        /* Store the outputs */
+        py[0] = acca;
+        py[chOfs] = accb;
+        py[2u * chOfs] = accc;
+        py[3u * chOfs] = accd;
+        py++;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pState[0] = d1a;
+      pState[1] = d2a;
+      pState[2] = d1b;
+      pState[3] = d2b;
+      pState[4] = d1c;
+      pState[5] = d2c;
+      pState[6] = d1d;
+      pState[7] = d2d;
+      pState += 8u;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    /* The remaining channels one at a time */
+    for(; ch < numCh; ch++)
+    {
+      d1a = pState[0];
+      d2a = pState[1];
+
+      px = pIn + ch * chOfs;
+      py = pDst + ch * chOfs;
+
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        Xna = *px;
+        px++;
+
+        acca = b0 * Xna + d1a;
+        d1a = b1 * Xna + d2a;
+        d2a = b2 * Xna;
+        d1a += a1 * acca;
+        d2a += a2 * acca;
+
+        *py = acca;
+        py++;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      pState[0] = d1a;
+      pState[1] = d2a;
+      pState += 2u;
+    }
+
+    /* The current stage output is given as the input to the next stage */
+    pIn = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**    
+ * @} end of BiquadCascadeDF2T group    
+ */
@@ -0,0 +1,193 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_cic_comp_design_f32.c   
+*    
+* Description:	Kaiser window design of CIC compensation FIR filters    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup FIR_Design    
+ * @{    
+ */
+
+/* Zeroth order modified Bessel function of the first kind, power series */
+static float64_t arm_kaiser_i0(
+  float64_t x)
+{
+  float64_t sum = 1.0, term = 1.0, q = 0.25 * x * x;
+  uint32_t k = 1u;
+
+  do
+  {
+    term *= q / ((float64_t) k * k);
+    sum += term;
+    k++;
+  } while(term > sum * 1e-17);
+
+  return (sum);
+}
+
+/* Kaiser window shape parameter for a stopband attenuation in dB */
+static float64_t arm_kaiser_beta(
+  float64_t attenuation)
+{
+  float64_t beta;
+
+  if(attenuation > 50.0)
+  {
+    beta = 0.1102 * (attenuation - 8.7);
+  }
+  else if(attenuation >= 21.0)
+  {
+    beta = 0.5842 * pow(attenuation - 21.0, 0.4) + 0.07886 * (attenuation - 21.0);
+  }
+  else
+  {
+    beta = 0.0;
+  }
+
+  return (beta);
+}
+
+/**    
+ * @brief Designs a lowpass filter that compensates the passband droop of a CIC decimator.    
+ * @param[in]  numStages    number of stages of the CIC decimator.    
+ * @param[in]  M            decimation factor of the CIC decimator.    
+ * @param[in]  diffDelay    differential delay of the CIC decimator.    
+ * @param[in]  ratio        ratio of the CIC output rate to the input rate of the filter, 1 if the filter directly follows the CIC decimator.    
+ * @param[in]  cutoff       cutoff frequency as a fraction of the input rate of the filter, between 0 and 0.5.    
+ * @param[in]  attenuation  stopband attenuation in dB.    
+ * @param[in]  numTaps      number of filter coefficients.    
+ * @param[out] *pCoeffs     points to the numTaps filter coefficients.    
+ * @return     The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if a parameter is out of range.    
+ *    
+ * \par    
+ * The desired response is the inverse of the normalized CIC response    
+ * <pre>    
+ *    H(f) = (sin(pi*M*diffDelay*f) / (M*diffDelay*sin(pi*f)))^numStages    
+ * </pre>    
+ * (<code>f</code> relative to the CIC input rate) below <code>cutoff</code> and zero above it.  Its impulse    
+ * response is the ideal lowpass response plus a correction for the droop that is integrated numerically;    
+ * it is windowed and scaled to a gain of 1 at DC.  The transition band is centred on <code>cutoff</code>.    
+ * \par    
+ * The filter is symmetric, so the time reversed order used by the FIR functions is the same as the natural order.    
+ */
+
+arm_status arm_cic_comp_design_f32(
+  uint8_t numStages,
+  uint16_t M,
+  uint8_t diffDelay,
+  uint16_t ratio,
+  float32_t cutoff,
+  float32_t attenuation,
+  uint16_t numTaps,
+  float32_t * pCoeffs)
+{
+  float64_t beta = arm_kaiser_beta(attenuation);  /* window shape */
+  float64_t md = (float64_t) M * diffDelay;      /* length of the moving sum of the CIC decimator */
+  float64_t half = 0.5 * (numTaps - 1u);         /* offset of the outermost tap */
+  float64_t fc = cutoff;                         /* cutoff frequency */
+  float64_t df;                                  /* step of the integration grid */
+  float64_t f, fin, h, e;                        /* frequency, at the CIC input, CIC response, correction */
+  float64_t t, c0, c1, c2, step;                 /* tap offset and cosine recurrence */
+  float64_t sum, scale;                          /* DC gain, window scale */
+  uint32_t numPoints = 2u * numTaps;             /* points of the integration grid */
+  uint32_t k, n;                                 /* loop counters */
+
+  if((numTaps == 0u) || (numStages == 0u) || (md == 0.0) || (ratio == 0u) || !(fc > 0.0) || !(fc < 0.5))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Ideal lowpass response sin(2*pi*fc*t) / (pi*t) */
+  for (n = 0u; n < numTaps; n++)
+  {
+    t = n - half;
+    pCoeffs[n] = (float32_t) ((t == 0.0) ? 2.0 * fc : sin(6.28318530717958647692 * fc * t) / (3.14159265358979323846 * t));
+  }
+
+  /* Add 2 * integral over 0..fc of (1/H(f) - 1) * cos(2*pi*f*t) df, midpoint rule */
+  df = fc / numPoints;
+
+  for (k = 0u; k < numPoints; k++)
+  {
+    f = (k + 0.5) * df;
+    fin = f / ((float64_t) ratio * M);
+    h = pow(sin(3.14159265358979323846 * md * fin) / (md * sin(3.14159265358979323846 * fin)), (float64_t) numStages);
+    e = 2.0 * df * (1.0 / h - 1.0);
+
+    /* cos(2*pi*f*t) for t = -half, -half+1, ... by the recurrence cos(x+s) = 2*cos(s)*cos(x) - cos(x-s) */
+    step = 6.28318530717958647692 * f;
+    c0 = cos(step * -half);
+    c1 = cos(step * (1.0 - half));
+    c2 = 2.0 * cos(step);
+
+    for (n = 0u; n < numTaps; n++)
+    {
+      pCoeffs[n] += (float32_t) (e * c0);
+      t = c2 * c1 - c0;
+      c0 = c1;
+      c1 = t;
+    }
+  }
+
+  /* Window and normalize the gain at DC */
+  scale = 1.0 / arm_kaiser_i0(beta);
+  sum = 0.0;
+
+  for (n = 0u; n < numTaps; n++)
+  {
+    t = (half > 0.0) ? (n - half) / half : 0.0;
+    pCoeffs[n] = (float32_t) (pCoeffs[n] * arm_kaiser_i0(beta * sqrt(1.0 - t * t)) * scale);
+    sum += pCoeffs[n];
+  }
+
+  for (n = 0u; n < numTaps; n++)
+  {
+    pCoeffs[n] = (float32_t) (pCoeffs[n] / sum);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of FIR_Design group    
+ */
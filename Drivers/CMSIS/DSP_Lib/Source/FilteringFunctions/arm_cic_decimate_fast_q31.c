@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_cic_decimate_fast_q31.c   
+*    
+* Description:	Fast Q31 CIC decimator with 32-bit registers    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup CIC    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the Q31 CIC decimator (fast version).    
+ * @param[in,out] *S points to an instance of the Q31 CIC decimator structure.    
+ * @param[in]     *pSrc points to the block of input data.    
+ * @param[out]    *pDst points to the block of output data.    
+ * @param[in]     blockSize number of input samples to process.    
+ * @return number of output samples written to pDst.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The input is shifted right by <code>postShift</code> bits and the integrators and combs are 32-bit    
+ * registers in wrap-around arithmetic.  The comb result is in 1.31 format and cannot overflow.    
+ * The low <code>postShift</code> bits of the input are lost; when they are zero the result is the same as    
+ * that of <code>arm_cic_decimate_q31()</code>.    
+ * \par    
+ * The function uses the lower half of the state array of the instance.    
+ */
+
+uint32_t arm_cic_decimate_fast_q31(
+  arm_cic_decimate_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t *pInteg = (uint32_t *) S->pState;     /* integrator registers */
+  uint32_t *pComb = pInteg + S->numStages;       /* comb delay lines */
+  uint32_t *pI, *pC;                             /* stage pointers */
+  uint32_t acc, prev;                            /* integrator and comb values */
+  uint32_t postShift = S->postShift;             /* input shift */
+  uint32_t numStages = S->numStages;             /* number of stages */
+  uint32_t diffDelay = S->diffDelay;             /* comb differential delay */
+  uint32_t phase = S->phase;                     /* inputs since the last output */
+  uint32_t outCnt = 0u;                          /* number of outputs */
+  uint32_t i, k, n;                              /* loop counters */
+
+  while(blockSize > 0u)
+  {
+    /* Number of inputs up to the next output or the end of the block */
+    n = S->M - phase;
+
+    if(n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    blockSize -= n;
+    phase += n;
+
+    /* Integrate the inputs through all stages */
+    do
+    {
+      acc = (uint32_t) (*pSrc++ >> postShift);
+      pI = pInteg;
+      i = numStages;
+
+      do
+      {
+        acc += *pI;
+        *pI++ = acc;
+
+      } while(--i);
+
+    } while(--n);
+
+    if(phase == S->M)
+    {
+      phase = 0u;
+
+      /* Comb the output of the last integrator at the output rate */
+      pC = pComb;
+      i = numStages;
+
+      do
+      {
+        prev = pC[diffDelay - 1u];
+
+        for (k = diffDelay - 1u; k > 0u; k--)
+        {
+          pC[k] = pC[k - 1u];
+        }
+
+        pC[0] = acc;
+        acc -= prev;
+        pC += diffDelay;
+
+      } while(--i);
+
+      *pDst++ = (q31_t) acc;
+      outCnt++;
+    }
+  }
+
+  S->phase = (uint16_t) phase;
+
+  return (outCnt);
+}
+
+/**    
+ * @} end of CIC group    
+ */
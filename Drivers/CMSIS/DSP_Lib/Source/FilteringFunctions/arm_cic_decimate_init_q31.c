@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_cic_decimate_init_q31.c   
+*    
+* Description:	Initialization function for the Q31 CIC decimator    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup CIC    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the Q31 CIC decimator.    
+ * @param[in,out] *S         points to an instance of the Q31 CIC decimator structure.    
+ * @param[in]     numStages  number of integrator and comb stages.    
+ * @param[in]     M          decimation factor.    
+ * @param[in]     diffDelay  differential delay of the combs, normally 1 or 2.    
+ * @param[in]     *pState    points to the state buffer.    
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or    
+ * ARM_MATH_ARGUMENT_ERROR if a parameter is zero or the gain <code>(M*diffDelay)^numStages</code>    
+ * exceeds 2^31.    
+ *    
+ * <b>Description:</b>    
+ * \par    
+ * <code>pState</code> points to the array of state variables.    
+ * <code>pState</code> is of length <code>numStages*(diffDelay+1)</code> 64-bit words.    
+ * The first output is computed from the first <code>M</code> input samples.    
+ */
+
+arm_status arm_cic_decimate_init_q31(
+  arm_cic_decimate_instance_q31 * S,
+  uint8_t numStages,
+  uint16_t M,
+  uint8_t diffDelay,
+  q63_t * pState)
+{
+  uint32_t md = (uint32_t) M * diffDelay;        /* length of the moving sum */
+  uint64_t gain = 1u;                            /* DC gain (M*diffDelay)^numStages */
+  uint32_t i, shift = 0u;                        /* loop counter, ceil(log2(gain)) */
+  arm_status status;
+
+  /* Stop as soon as the gain is too large, so it cannot overflow */
+  for (i = 0u; (i < numStages) && (gain <= 0x80000000u); i++)
+  {
+    gain *= md;
+  }
+
+  while(((uint64_t) 1u << shift) < gain)
+  {
+    shift++;
+  }
+
+  if((numStages == 0u) || (md == 0u) || (gain > 0x80000000u))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    S->numStages = numStages;
+    S->M = M;
+    S->diffDelay = diffDelay;
+    S->postShift = (uint8_t) shift;
+
+    /* The first output is after M input samples */
+    S->phase = 0u;
+
+    /* Clear the integrators and the comb delay lines */
+    memset(pState, 0, (uint32_t) numStages * (diffDelay + 1u) * sizeof(q63_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**    
+ * @} end of CIC group    
+ */
@@ -0,0 +1,197 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_cic_decimate_q31.c   
+*    
+* Description:	Q31 CIC decimator    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @defgroup CIC Cascaded Integrator-Comb (CIC) Decimator    
+ *    
+ * A CIC decimator reduces the sample rate by a large factor <code>M</code> without multiplications.    
+ * It is a cascade of <code>numStages</code> integrators running at the input rate, a downsampler by    
+ * <code>M</code> and <code>numStages</code> combs with a differential delay of <code>diffDelay</code>    
+ * running at the output rate.  Its transfer function at the input rate is:    
+ * <pre>    
+ *    H(z) = ((1 - z^(-M*diffDelay)) / (1 - z^-1))^numStages    
+ * </pre>    
+ * a moving sum of <code>M*diffDelay</code> samples applied <code>numStages</code> times.  The gain at DC    
+ * is <code>G = (M*diffDelay)^numStages</code> and the response droops across the output band and has nulls    
+ * at multiples of the output rate divided by <code>diffDelay</code>, where the signals that alias onto    
+ * low frequencies are.  The stage is normally followed by FIR filters at the lower rate that compensate    
+ * the droop and remove the rest of the aliases (see \ref FIR_Design and \ref DecimateChain).    
+ *    
+ * The typical use is the first stage after a sigma-delta modulator or a fast ADC, for example the    
+ * data of a DFSDM channel when the filter of the DFSDM itself is not enough.    
+ *    
+ * \par Algorithm:    
+ * The integrators overflow for any signal with a DC component.  They work in modulo (wrap-around)    
+ * arithmetic, which makes the combs cancel the overflows exactly as long as the result, whose magnitude    
+ * is at most <code>G</code> times that of the input, fits into the registers.  The output is the comb    
+ * result shifted right by <code>postShift = ceil(log2(G))</code> bits, so the gain of the decimator is    
+ * <code>G / 2^postShift</code>: exactly 1 when <code>M*diffDelay</code> is a power of 2 and between    
+ * 0.5 and 1 otherwise.    
+ * \par    
+ * <code>arm_cic_decimate_q31()</code> uses 64-bit registers and keeps every bit of the input.    
+ * <code>arm_cic_decimate_fast_q31()</code> uses 32-bit registers, which halves the cost of the    
+ * integrators; it shifts the input right by <code>postShift</code> bits before integrating and so drops    
+ * the low <code>postShift</code> bits of the input.  Both functions give the same result when those bits are    
+ * zero, for example for the 24-bit data of a DFSDM channel (bits [31:8] of the data register) and    
+ * <code>postShift</code> up to 8.    
+ * \par    
+ * The functions operate on blocks of input data of any length.  The number of outputs of a call depends on    
+ * the block length and on the number of inputs left over from the previous call and is returned by the    
+ * function; a block of <code>n</code> inputs produces <code>floor(n/M)</code> or <code>ceil(n/M)</code> outputs.    
+ * \par    
+ * <code>pState</code> points to a state array of size <code>numStages*(diffDelay+1)</code> 64-bit words    
+ * that holds the integrators followed by the comb delay lines.    
+ *    
+ * \par Instance Structure    
+ * The parameters and the state of a decimator are stored in an instance data structure.    
+ * A separate instance structure must be defined for each decimator.    
+ * The same instance structure is used by both functions.    
+ *    
+ * \par Initialization Function    
+ * The initialization function checks the parameters, computes <code>postShift</code>, sets the values    
+ * of the internal structure fields and zeros out the state buffer.  The number of stages must be at least 1,    
+ * <code>M</code> and <code>diffDelay</code> must not be zero and <code>ceil(log2(G))</code> must not exceed 31.    
+ */
+
+/**    
+ * @addtogroup CIC    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the Q31 CIC decimator.    
+ * @param[in,out] *S points to an instance of the Q31 CIC decimator structure.    
+ * @param[in]     *pSrc points to the block of input data.    
+ * @param[out]    *pDst points to the block of output data.    
+ * @param[in]     blockSize number of input samples to process.    
+ * @return number of output samples written to pDst.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The integrators and combs are 64-bit registers in wrap-around arithmetic.  The comb result is exact    
+ * and is shifted right by <code>postShift</code> bits to 1.31 format; it cannot overflow.    
+ */
+
+uint32_t arm_cic_decimate_q31(
+  arm_cic_decimate_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint64_t *pInteg = (uint64_t *) S->pState;     /* integrator registers */
+  uint64_t *pComb = pInteg + S->numStages;       /* comb delay lines */
+  uint64_t *pI, *pC;                             /* stage pointers */
+  uint64_t acc, prev;                            /* integrator and comb values */
+  uint32_t numStages = S->numStages;             /* number of stages */
+  uint32_t diffDelay = S->diffDelay;             /* comb differential delay */
+  uint32_t phase = S->phase;                     /* inputs since the last output */
+  uint32_t outCnt = 0u;                          /* number of outputs */
+  uint32_t i, k, n;                              /* loop counters */
+
+  while(blockSize > 0u)
+  {
+    /* Number of inputs up to the next output or the end of the block */
+    n = S->M - phase;
+
+    if(n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    blockSize -= n;
+    phase += n;
+
+    /* Integrate the inputs through all stages */
+    do
+    {
+      acc = (uint64_t) (q63_t) * pSrc++;
+      pI = pInteg;
+      i = numStages;
+
+      do
+      {
+        acc += *pI;
+        *pI++ = acc;
+
+      } while(--i);
+
+    } while(--n);
+
+    if(phase == S->M)
+    {
+      phase = 0u;
+
+      /* Comb the output of the last integrator at the output rate */
+      pC = pComb;
+      i = numStages;
+
+      do
+      {
+        prev = pC[diffDelay - 1u];
+
+        for (k = diffDelay - 1u; k > 0u; k--)
+        {
+          pC[k] = pC[k - 1u];
+        }
+
+        pC[0] = acc;
+        acc -= prev;
+        pC += diffDelay;
+
+      } while(--i);
+
+      *pDst++ = (q31_t) ((q63_t) acc >> S->postShift);
+      outCnt++;
+    }
+  }
+
+  S->phase = (uint16_t) phase;
+
+  return (outCnt);
+}
+
+/**    
+ * @} end of CIC group    
+ */
@@ -0,0 +1,217 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_decimate_chain_design_q31.c   
+*    
+* Description:	Stage selection for the Q31 decimation chain    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup DecimateChain    
+ * @{    
+ */
+
+/* Normalized response of a CIC decimator at frequency f relative to its input rate */
+static float64_t arm_cic_response(
+  uint32_t numStages,
+  uint32_t M,
+  float64_t f)
+{
+  float64_t x = 3.14159265358979323846 * f;
+
+  return (fabs(pow(sin(M * x) / (M * sin(x)), (float64_t) numStages)));
+}
+
+/* Estimated length of a Kaiser window design with a transition width df relative to its sample rate */
+static float64_t arm_kaiser_length(
+  float64_t attenuation,
+  float64_t df)
+{
+  return (ceil((attenuation - 7.95) / (14.36 * df)) + 1.0);
+}
+
+/**    
+ * @brief Chooses the stages of a Q31 decimation chain.    
+ * @param[out] *P           points to the plan to fill in.    
+ * @param[in]  M            total decimation factor.    
+ * @param[in]  cicStages    number of stages of the CIC decimator.    
+ * @param[in]  passband     passband edge as a fraction of the output rate, between 0 and 0.5.    
+ * @param[in]  attenuation  attenuation in dB of the signals that alias into the passband.    
+ * @param[in]  blockSize    largest number of input samples processed per call, a multiple of M.    
+ * @return     The function returns ARM_MATH_SUCCESS, ARM_MATH_LENGTH_ERROR if <code>blockSize</code> is not a    
+ * multiple of <code>M</code> or ARM_MATH_ARGUMENT_ERROR if a parameter is out of range or no chain meets the    
+ * specification.    
+ *    
+ * \par    
+ * Every split of <code>M</code> into a CIC factor of at least 2, up to ARM_DECIMATE_CHAIN_MAX_HALFBANDS    
+ * half-band stages and a final FIR factor between 2 and 255 is considered.  A split is feasible if the CIC    
+ * decimator attenuates the band that aliases onto the passband edge by <code>attenuation</code> relative to    
+ * its response at the edge and its gain fits into 31 bits.  The half-band and FIR lengths follow from the    
+ * Kaiser window estimate for transition bands that end where their aliases would reach the passband.    
+ * The plan with the lowest estimated cost per input sample is kept, counting 2 operations per stage and input    
+ * sample for the 64-bit integrators, 2 per stage and CIC output for the combs and 1 per multiply-accumulate    
+ * of the FIR filters.    
+ */
+
+arm_status arm_decimate_chain_design_q31(
+  arm_decimate_chain_plan_q31 * P,
+  uint32_t M,
+  uint8_t cicStages,
+  float32_t passband,
+  float32_t attenuation,
+  uint32_t blockSize)
+{
+  float64_t p = passband;                        /* passband edge relative to the output rate */
+  float64_t A = attenuation;                     /* required attenuation */
+  float64_t rate;                                /* CIC output rate relative to the output rate */
+  float64_t gain, alias, cost, best = -1.0;      /* CIC gain, alias attenuation, cost of a split and of the best one */
+  float64_t taps;                                /* estimated filter length */
+  uint16_t coeffs[ARM_DECIMATE_CHAIN_MAX_HALFBANDS]; /* half-band lengths of the current split */
+  uint32_t numHb, firM, cicM, firTaps;           /* current split */
+  uint32_t i, n;                                 /* loop counter, block length at a stage */
+
+  if((M < 4u) || (cicStages == 0u) || !(p > 0.0) || !(p < 0.5) || !(A > 0.0))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  if((blockSize == 0u) || ((blockSize % M) != 0u))
+  {
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  for (numHb = 0u; (numHb <= ARM_DECIMATE_CHAIN_MAX_HALFBANDS) && ((M % (1u << numHb)) == 0u); numHb++)
+  {
+    for (firM = 2u; (firM <= 255u) && (firM <= (M >> numHb)); firM++)
+    {
+      if(((M >> numHb) % firM) != 0u)
+      {
+        continue;
+      }
+
+      cicM = (M >> numHb) / firM;
+      rate = (float64_t) firM * (1u << numHb);
+
+      /* The CIC gain must fit into 31 bits */
+      gain = pow((float64_t) cicM, (float64_t) cicStages);
+
+      if((cicM < 2u) || (cicM > 65535u) || (gain > 2147483648.0))
+      {
+        continue;
+      }
+
+      /* Attenuation of the band that aliases onto the passband edge, relative to the edge */
+      alias = 20.0 * log10(arm_cic_response(cicStages, cicM, p / (rate * cicM)) /
+                           arm_cic_response(cicStages, cicM, (rate - p) / (rate * cicM)));
+
+      if(alias < A)
+      {
+        continue;
+      }
+
+      /* CIC integrators and combs */
+      cost = 2.0 * cicStages * (1.0 + 1.0 / cicM);
+
+      /* Half-band stage i runs at rate / 2^i and keeps its aliases out of the passband */
+      for (i = 0u; i < numHb; i++)
+      {
+        taps = arm_kaiser_length(A, 0.5 - 2.0 * p * (1u << i) / rate);
+        coeffs[i] = (uint16_t) ceil((taps + 1.0) / 4.0);
+        cost += (2.0 * coeffs[i] + 1.0) / ((float64_t) cicM * (2u << i));
+      }
+
+      /* The final FIR filter has its transition band between p and 1 - p */
+      taps = arm_kaiser_length(A, (1.0 - 2.0 * p) / firM);
+
+      if(taps > 65535.0)
+      {
+        continue;
+      }
+
+      firTaps = (uint32_t) taps;
+      cost += taps / M;
+
+      if((best < 0.0) || (cost < best))
+      {
+        best = cost;
+        P->cicM = (uint16_t) cicM;
+        P->numHalfbands = (uint8_t) numHb;
+        P->firM = (uint8_t) firM;
+        P->firTaps = (uint16_t) firTaps;
+
+        for (i = 0u; i < numHb; i++)
+        {
+          P->halfbandCoeffs[i] = coeffs[i];
+        }
+      }
+    }
+  }
+
+  if(best < 0.0)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  P->cicStages = cicStages;
+  P->passband = passband;
+  P->attenuation = attenuation;
+  P->cost = (float32_t) best;
+  P->blockSize = blockSize;
+
+  /* Coefficients and state of every stage, then the buffer for the CIC output */
+  n = blockSize / P->cicM;
+  P->numCoeffs = P->firTaps;
+  P->stateLength = n;
+
+  for (i = 0u; i < P->numHalfbands; i++)
+  {
+    P->numCoeffs += P->halfbandCoeffs[i];
+    P->stateLength += 4u * P->halfbandCoeffs[i] - 2u + n;
+    n >>= 1u;
+  }
+
+  P->stateLength += P->firTaps - 1u + n;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of DecimateChain group    
+ */
@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_decimate_chain_init_q31.c   
+*    
+* Description:	Initialization function for the Q31 decimation chain    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup DecimateChain    
+ * @{    
+ */
+
+/**    
+ * @brief Initialization function for the Q31 decimation chain.    
+ * @param[in,out] *S          points to an instance of the Q31 decimation chain structure.    
+ * @param[in]     *P          points to a plan filled in by <code>arm_decimate_chain_design_q31()</code>.    
+ * @param[out]    *pCoeffs    points to the coefficient buffer of <code>P->numCoeffs</code> values.    
+ * @param[in]     *pCicState  points to the CIC state buffer of <code>2*P->cicStages</code> values.    
+ * @param[in]     *pState     points to the state buffer of <code>P->stateLength</code> values.    
+ * @return     The function returns ARM_MATH_SUCCESS or the error status of the stage that failed to initialize.    
+ *    
+ * \par    
+ * The half-band filters and the CIC compensation filter are designed in floating point inside    
+ * <code>pCoeffs</code> and converted to Q31 in place, half-band filters first.  The compensation filter    
+ * also makes up for the gain <code>cicM^cicStages / 2^postShift</code> of the CIC decimator, so that the    
+ * chain has unity gain at DC.  The state buffer holds the states of the half-band and FIR decimators    
+ * followed by the buffer for the CIC output.    
+ */
+
+arm_status arm_decimate_chain_init_q31(
+  arm_decimate_chain_instance_q31 * S,
+  const arm_decimate_chain_plan_q31 * P,
+  q31_t * pCoeffs,
+  q63_t * pCicState,
+  q31_t * pState)
+{
+  arm_status status;                             /* status of the stage initialization */
+  float32_t scale;                               /* inverse of the CIC gain */
+  uint32_t blockSize, i;                         /* block length at a stage, loop counter */
+  uint16_t numCoeffs;                            /* length of a filter */
+
+  status = arm_cic_decimate_init_q31(&S->cic, P->cicStages, P->cicM, 1u, pCicState);
+
+  if(status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  blockSize = P->blockSize / P->cicM;
+  S->numHalfbands = P->numHalfbands;
+
+  /* Half-band decimators */
+  for (i = 0u; i < P->numHalfbands; i++)
+  {
+    numCoeffs = P->halfbandCoeffs[i];
+
+    status = arm_fir_halfband_design_f32(numCoeffs, P->attenuation, (float32_t *) pCoeffs);
+
+    if(status == ARM_MATH_SUCCESS)
+    {
+      arm_float_to_q31((float32_t *) pCoeffs, pCoeffs, numCoeffs);
+      status = arm_fir_halfband_decimate_init_q31(&S->hb[i], numCoeffs, pCoeffs, pState, blockSize);
+    }
+
+    if(status != ARM_MATH_SUCCESS)
+    {
+      return (status);
+    }
+
+    pCoeffs += numCoeffs;
+    pState += 4u * numCoeffs - 2u + blockSize;
+    blockSize >>= 1u;
+  }
+
+  /* CIC compensation and final decimation */
+  numCoeffs = P->firTaps;
+
+  status = arm_cic_comp_design_f32(P->cicStages, P->cicM, 1u, (uint16_t) (1u << P->numHalfbands),
+                                   0.5f / P->firM, P->attenuation, numCoeffs, (float32_t *) pCoeffs);
+
+  if(status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  scale = (float32_t) (pow(2.0, (float64_t) S->cic.postShift) / pow((float64_t) P->cicM, (float64_t) P->cicStages));
+  arm_scale_f32((float32_t *) pCoeffs, scale, (float32_t *) pCoeffs, numCoeffs);
+  arm_float_to_q31((float32_t *) pCoeffs, pCoeffs, numCoeffs);
+
+  status = arm_fir_decimate_init_q31(&S->fir, numCoeffs, P->firM, pCoeffs, pState, blockSize);
+
+  if(status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->pScratch = pState + numCoeffs - 1u + blockSize;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of DecimateChain group    
+ */
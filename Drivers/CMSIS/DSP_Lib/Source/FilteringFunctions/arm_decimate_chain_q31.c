@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_decimate_chain_q31.c   
+*    
+* Description:	Q31 multi-stage decimation chain    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @defgroup DecimateChain Multi-Stage Decimation Chain    
+ *    
+ * Decimates high-rate streams, such as those from a sigma-delta modulator or the DFSDM, by a large factor    
+ * <code>M</code> in three kinds of stages:    
+ * <pre>    
+ *    x[n] --> CIC, cicM --> half-band, 2 --> ... --> half-band, 2 --> FIR, firM --> y[n]    
+ * </pre>    
+ * where <code>M = cicM * 2^numHalfbands * firM</code>.  The CIC decimator takes the bulk of the rate    
+ * reduction without multiplications, the half-band decimators halve the rate at about a quarter of the cost    
+ * of a general FIR filter, and the final FIR decimator compensates the droop of the CIC decimator across    
+ * the passband and sets the final transition band.    
+ *    
+ * \par Designing a chain    
+ * <code>arm_decimate_chain_design_q31()</code> takes the total factor, the number of CIC stages, the passband    
+ * edge as a fraction of the output rate and the attenuation of everything that aliases into the passband.    
+ * It tries every split of <code>M</code> and keeps the one with the lowest estimated number of operations per    
+ * input sample.  The resulting plan gives the sizes of the coefficient and state buffers, which the    
+ * application allocates before calling <code>arm_decimate_chain_init_q31()</code>.  The band between the    
+ * passband edge and half the output rate is a transition band and is not protected against aliasing.    
+ *    
+ * \par    
+ * The initialization designs all filters at run time and needs the floating point library; the plan and the    
+ * coefficients can instead be computed once and kept in flash together with a filled in instance.    
+ *    
+ * \par Fixed-Point Behavior    
+ * The CIC decimator scales its output by <code>2^-postShift</code> and the compensation filter restores unity    
+ * gain at DC.  Towards the passband edge the compensation filter has a gain of up to the inverse of the CIC    
+ * droop, so the input must leave that much headroom.  The half-band decimators saturate their outputs, the    
+ * final FIR decimator behaves as <code>arm_fir_decimate_q31()</code>.    
+ */
+
+/**    
+ * @addtogroup DecimateChain    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the Q31 decimation chain.    
+ * @param[in,out] *S          points to an instance of the Q31 decimation chain structure.    
+ * @param[in]     *pSrc       points to the block of input data.    
+ * @param[out]    *pDst       points to the block of output data.    
+ * @param[in]     blockSize   number of input samples to process, a multiple of <code>M</code> and not larger    
+ * than the block size of the plan.    
+ * @return none.    
+ *    
+ * \par    
+ * Each call produces <code>blockSize / M</code> output samples.  The CIC output is buffered in the scratch    
+ * area of the state buffer and the half-band decimators work on it in place.    
+ */
+
+void arm_decimate_chain_q31(
+  arm_decimate_chain_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pScratch = S->pScratch;                 /* CIC output buffer */
+  uint32_t i, numSamples;                        /* loop counter, samples between the stages */
+
+  numSamples = arm_cic_decimate_q31(&S->cic, pSrc, pScratch, blockSize);
+
+  for (i = 0u; i < S->numHalfbands; i++)
+  {
+    arm_fir_halfband_decimate_q31(&S->hb[i], pScratch, pScratch, numSamples);
+    numSamples >>= 1u;
+  }
+
+  arm_fir_decimate_q31(&S->fir, pScratch, pDst, numSamples);
+}
+
+/**    
+ * @} end of DecimateChain group    
+ */
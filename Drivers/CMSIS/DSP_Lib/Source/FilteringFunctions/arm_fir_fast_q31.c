@@ -71,6 +71,237 @@
  * Use the function <code>arm_fir_init_q31()</code> to initialize the filter structure.    
  */
 
+#if defined(ARM_MATH_CM7) && !defined(ARM_MATH_BIG_ENDIAN)
+
+/* Run the below code for Cortex-M7 */
+
+void arm_fir_fast_q31(
+  const arm_fir_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q31_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q31_t x0, x1, x2, x3, x4;                      /* Temporary variables to hold state */
+  q31_t c0, c1;                                  /* Temporary variables to hold coefficient values */
+  q63_t xx, cc;                                  /* State and coefficient pairs read with one 64-bit load */
+  q31_t *px;                                     /* Temporary pointer for state */
+  q31_t *pb;                                     /* Temporary pointer for coefficient buffer */
+  q31_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
+
+  /* S->pState points to buffer which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1u)]);
+
+  /* Apply loop unrolling and compute 4 output values simultaneously.
+   * The variables acc0 ... acc3 hold output values that are being computed:
+   *
+   *    acc0 =  b[numTaps-1] * x[n-numTaps-1] + b[numTaps-2] * x[n-numTaps-2] + b[numTaps-3] * x[n-numTaps-3] +...+ b[0] * x[0]
+   *    acc1 =  b[numTaps-1] * x[n-numTaps] +   b[numTaps-2] * x[n-numTaps-1] + b[numTaps-3] * x[n-numTaps-2] +...+ b[0] * x[1]
+   *    acc2 =  b[numTaps-1] * x[n-numTaps+1] + b[numTaps-2] * x[n-numTaps] +   b[numTaps-3] * x[n-numTaps-1] +...+ b[0] * x[2]
+   *    acc3 =  b[numTaps-1] * x[n-numTaps+2] + b[numTaps-2] * x[n-numTaps+1] + b[numTaps-3] * x[n-numTaps]   +...+ b[0] * x[3]
+   *
+   * Coefficients and states are read two at a time with 64-bit loads (LDRD), which
+   * the Cortex-M7 issues alongside the SMMLARs of the previous pair.
+   */
+  blkCnt = blockSize >> 2;
+
+  tapCnt = numTaps >> 2;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Copy four new input samples into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    /* Set all accumulators to zero */
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
+
+    /* Initialize state pointer */
+    px = pState;
+
+    /* Initialize coefficient pointer */
+    pb = pCoeffs;
+
+    /* Read the first three samples from the state buffer:
+     *  x[n-numTaps], x[n-numTaps-1], x[n-numTaps-2] */
+    xx = *__SIMD64(px)++;
+    x0 = (q31_t) xx;
+    x1 = (q31_t) (xx >> 32);
+    x2 = *(px++);
+
+    /* Loop unrolling.  Process 4 taps at a time. */
+    i = tapCnt;
+
+    while(i > 0u)
+    {
+      /* Read the b[numTaps], b[numTaps-1] coefficients */
+      cc = *__SIMD64(pb)++;
+      c0 = (q31_t) cc;
+      c1 = (q31_t) (cc >> 32);
+
+      /* Read x[n-numTaps-3], x[n-numTaps-4] samples */
+      xx = *__SIMD64(px)++;
+      x3 = (q31_t) xx;
+      x4 = (q31_t) (xx >> 32);
+
+      /* Perform the multiply-accumulates */
+      multAcc_32x32_keep32_R(acc0, x0, c0);
+      multAcc_32x32_keep32_R(acc1, x1, c0);
+      multAcc_32x32_keep32_R(acc2, x2, c0);
+      multAcc_32x32_keep32_R(acc3, x3, c0);
+
+      multAcc_32x32_keep32_R(acc0, x1, c1);
+      multAcc_32x32_keep32_R(acc1, x2, c1);
+      multAcc_32x32_keep32_R(acc2, x3, c1);
+      multAcc_32x32_keep32_R(acc3, x4, c1);
+
+      /* Read the b[numTaps-2], b[numTaps-3] coefficients */
+      cc = *__SIMD64(pb)++;
+      c0 = (q31_t) cc;
+      c1 = (q31_t) (cc >> 32);
+
+      /* Read x[n-numTaps-5], x[n-numTaps-6] samples */
+      xx = *__SIMD64(px)++;
+      x0 = (q31_t) xx;
+      x1 = (q31_t) (xx >> 32);
+
+      /* Perform the multiply-accumulates */
+      multAcc_32x32_keep32_R(acc0, x2, c0);
+      multAcc_32x32_keep32_R(acc1, x3, c0);
+      multAcc_32x32_keep32_R(acc2, x4, c0);
+      multAcc_32x32_keep32_R(acc3, x0, c0);
+
+      multAcc_32x32_keep32_R(acc0, x3, c1);
+      multAcc_32x32_keep32_R(acc1, x4, c1);
+      multAcc_32x32_keep32_R(acc2, x0, c1);
+      multAcc_32x32_keep32_R(acc3, x1, c1);
+
+      /* Reuse the present sample states for the next 4 taps */
+      x2 = x1;
+      x1 = x0;
+      x0 = x4;
+
+      /* Decrement the loop counter */
+      i--;
+    }
+
+    /* If the filter length is not a multiple of 4, compute the remaining filter taps */
+
+    i = numTaps - (tapCnt * 4u);
+    while(i > 0u)
+    {
+      /* Read coefficients */
+      c0 = *(pb++);
+
+      /* Fetch 1 state variable */
+      x3 = *(px++);
+
+      /* Perform the multiply-accumulates */
+      multAcc_32x32_keep32_R(acc0, x0, c0);
+      multAcc_32x32_keep32_R(acc1, x1, c0);
+      multAcc_32x32_keep32_R(acc2, x2, c0);
+      multAcc_32x32_keep32_R(acc3, x3, c0);
+
+      /* Reuse the present sample states for next sample */
+      x0 = x1;
+      x1 = x2;
+      x2 = x3;
+
+      /* Decrement the loop counter */
+      i--;
+    }
+
+    /* Advance the state pointer by 4 to process the next group of 4 samples */
+    pState = pState + 4;
+
+    /* The results in the 4 accumulators are in 2.30 format.  Convert to 1.31
+     ** Then store the 4 outputs in the destination buffer. */
+    *pDst++ = (q31_t) ((uint32_t) acc0 << 1);
+    *pDst++ = (q31_t) ((uint32_t) acc1 << 1);
+    *pDst++ = (q31_t) ((uint32_t) acc2 << 1);
+    *pDst++ = (q31_t) ((uint32_t) acc3 << 1);
+
+    /* Decrement the samples loop counter */
+    blkCnt--;
+  }
+
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 4u;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy one sample at a time into state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    /* Set the accumulator to zero */
+    acc0 = 0;
+
+    /* Initialize state pointer */
+    px = pState;
+
+    /* Initialize Coefficient pointer */
+    pb = (pCoeffs);
+
+    i = numTaps;
+
+    /* Perform the multiply-accumulates */
+    do
+    {
+      multAcc_32x32_keep32_R(acc0, (*px++), (*(pb++)));
+      i--;
+    } while(i > 0u);
+
+    /* The result is in 2.30 format.  Convert to 1.31    
+     ** Then store the output in the destination buffer. */
+    *pDst++ = (q31_t) ((uint32_t) acc0 << 1);
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1;
+
+    /* Decrement the samples loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.    
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.    
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* Calculate remaining number of copies */
+  tapCnt = (numTaps - 1u);
+
+  /* Copy the remaining q31_t data */
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+
+
+}
+
+#else
+
+/* Run the below code for Cortex-M4 and Cortex-M3 */
+
 IAR_ONLY_LOW_OPTIMIZATION_ENTER
 void arm_fir_fast_q31(
   const arm_fir_instance_q31 * S,
@@ -230,10 +461,10 @@ void arm_fir_fast_q31(
 
     /* The results in the 4 accumulators are in 2.30 format.  Convert to 1.31    
      ** Then store the 4 outputs in the destination buffer. */
-    *pDst++ = (q31_t) (acc0 << 1);
-    *pDst++ = (q31_t) (acc1 << 1);
-    *pDst++ = (q31_t) (acc2 << 1);
-    *pDst++ = (q31_t) (acc3 << 1);
+    *pDst++ = (q31_t) ((uint32_t) acc0 << 1);
+    *pDst++ = (q31_t) ((uint32_t) acc1 << 1);
+    *pDst++ = (q31_t) ((uint32_t) acc2 << 1);
+    *pDst++ = (q31_t) ((uint32_t) acc3 << 1);
 
     /* Decrement the samples loop counter */
     blkCnt--;
@@ -269,7 +500,7 @@ void arm_fir_fast_q31(
 
     /* The result is in 2.30 format.  Convert to 1.31    
      ** Then store the output in the destination buffer. */
-    *pDst++ = (q31_t) (acc0 << 1);
+    *pDst++ = (q31_t) ((uint32_t) acc0 << 1);
 
     /* Advance state pointer by 1 for the next sample */
     pState = pState + 1;
@@ -300,6 +531,9 @@ void arm_fir_fast_q31(
 
 }
 IAR_ONLY_LOW_OPTIMIZATION_EXIT
+
+#endif /* #if defined(ARM_MATH_CM7) && !defined(ARM_MATH_BIG_ENDIAN) */
+
 /**    
  * @} end of FIR group    
  */
@@ -0,0 +1,311 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_fir_fft_f32.c   
+*    
+* Description:	Floating-point FIR filter by partitioned overlap-save FFT convolution    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @defgroup FIR_FFT Finite Impulse Response (FIR) Filter with Partitioned FFT Convolution    
+ *    
+ * These functions compute the same output as the FIR filter functions, but for long filters    
+ * (hundreds to many thousands of taps) they do it by partitioned overlap-save convolution.    
+ * A direct form filter costs <code>numTaps</code> multiply-accumulates per sample; here the filter    
+ * is cut into partitions of <code>P</code> taps, each held as a <code>2*P</code> point spectrum, and every    
+ * <code>P</code> input samples cost one forward and one inverse real FFT (<code>arm_rfft_fast_f32()</code>)    
+ * plus one complex multiply-accumulate per partition and bin, about <code>4*numTaps/P</code> operations per sample.    
+ *    
+ * \par Partitions and latency    
+ * The output of a block is available as soon as the block has been read, the filter has no extra delay    
+ * compared with <code>arm_fir_f32()</code>.  The first partitions are <code>blockSize</code> taps long.    
+ * When <code>maxPartSize</code> is larger than <code>blockSize</code> the partitions later in the filter grow    
+ * by a factor of 4 up to <code>maxPartSize</code> (non-uniform partitioning): a partition of <code>Q</code> taps that    
+ * starts at tap <code>Q</code> or later only needs input older than the current block, so its output for the    
+ * next <code>Q</code> samples is computed in advance, once every <code>Q/blockSize</code> calls.  Long partitions    
+ * cut the FFT and multiply-accumulate work per sample; the price is that the calls at which the long partitions    
+ * are due take longer than the others.  With <code>maxPartSize</code> equal to <code>blockSize</code> all partitions are    
+ * the same length (uniform partitioning) and every call costs the same.    
+ *    
+ * \par Direct form    
+ * Below <code>ARM_FIR_FFT_DIRECT_TAPS</code> taps the FFTs cost more than they save and the filter runs    
+ * <code>arm_fir_f32()</code> instead; the choice is made by the initialization function and the processing function    
+ * behaves the same either way.    
+ *    
+ * \par    
+ * <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>, stored in time reversed order    
+ * as for <code>arm_fir_f32()</code>:    
+ * <pre>    
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}    
+ * </pre>    
+ * The initialization function reads the coefficients into the partition spectra; after that they are only used    
+ * in direct form.    
+ * \par    
+ * <code>pState</code> points to one buffer that holds the input history, the partition spectra, the delay lines of    
+ * input spectra and the FFT work space.  It can be placed in SDRAM; the spectra are read once per block in    
+ * sequential order.  Its length depends on the partitioning and is returned by the initialization function in    
+ * <code>stateLen</code> of the instance.    
+ *    
+ * \par Instance Structure    
+ * The partitioning, the FFT instances and the pointers into the state buffer are stored in an instance data structure.    
+ * A separate instance structure must be defined for each filter.    
+ * The instance structure cannot be initialized statically, <code>arm_fir_fft_init_f32()</code> must be used.    
+ */
+
+/**    
+ * @addtogroup FIR_FFT    
+ * @{    
+ */
+
+/*    
+ * acc += a * b over the bins of two spectra in the packed format of arm_rfft_fast_f32:    
+ * DC and Nyquist are real and stored in the first pair, the other bins are complex.    
+ */
+static void arm_fir_fft_cmac_f32(
+  const float32_t * pA,
+  const float32_t * pB,
+  float32_t * pAcc,
+  uint32_t numBins)
+{
+  float32_t ar, ai, br, bi;
+  uint32_t blkCnt;
+
+  pAcc[0] += pA[0] * pB[0];
+  pAcc[1] += pA[1] * pB[1];
+  pA += 2u;
+  pB += 2u;
+  pAcc += 2u;
+  numBins--;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Loop unrolling */
+  blkCnt = numBins >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    ar = pA[0];
+    ai = pA[1];
+    br = pB[0];
+    bi = pB[1];
+    pAcc[0] += ar * br - ai * bi;
+    pAcc[1] += ar * bi + ai * br;
+
+    ar = pA[2];
+    ai = pA[3];
+    br = pB[2];
+    bi = pB[3];
+    pAcc[2] += ar * br - ai * bi;
+    pAcc[3] += ar * bi + ai * br;
+
+    ar = pA[4];
+    ai = pA[5];
+    br = pB[4];
+    bi = pB[5];
+    pAcc[4] += ar * br - ai * bi;
+    pAcc[5] += ar * bi + ai * br;
+
+    ar = pA[6];
+    ai = pA[7];
+    br = pB[6];
+    bi = pB[7];
+    pAcc[6] += ar * br - ai * bi;
+    pAcc[7] += ar * bi + ai * br;
+
+    pA += 8u;
+    pB += 8u;
+    pAcc += 8u;
+
+    blkCnt--;
+  }
+
+  blkCnt = numBins % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = numBins;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    ar = pA[0];
+    ai = pA[1];
+    br = pB[0];
+    bi = pB[1];
+    pAcc[0] += ar * br - ai * bi;
+    pAcc[1] += ar * bi + ai * br;
+
+    pA += 2u;
+    pB += 2u;
+    pAcc += 2u;
+
+    blkCnt--;
+  }
+}
+
+/*    
+ * Filters one partition level over the output block that follows the input in the history.    
+ * pSrc points just past the newest input sample, pDst receives partSize outputs.    
+ */
+static void arm_fir_fft_run_level_f32(
+  arm_fir_fft_level_f32 * L,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pWork,
+  float32_t * pAcc)
+{
+  uint32_t P = L->partSize, len = 2u * P;
+  uint32_t k, slot;
+
+  /* Spectrum of the newest 2*P inputs into the delay line */
+  L->fdlPos = (L->fdlPos == 0u) ? (L->fdlLen - 1u) : (L->fdlPos - 1u);
+  memcpy(pWork, pSrc - len, len * sizeof(float32_t));
+  arm_rfft_fast_f32(&L->rfft, pWork, L->pFdl + L->fdlPos * len, 0u);
+
+  /* Partition k is applied to the spectrum that is ageOfs + k blocks old */
+  memset(pAcc, 0, len * sizeof(float32_t));
+  slot = L->fdlPos + L->ageOfs;
+
+  for(k = 0u; k < L->numParts; k++)
+  {
+    if(slot >= L->fdlLen)
+    {
+      slot -= L->fdlLen;
+    }
+
+    arm_fir_fft_cmac_f32(L->pCoeffs + k * len, L->pFdl + slot * len, pAcc, P);
+    slot++;
+  }
+
+  /* Overlap-save: the first half of the circular convolution is discarded */
+  arm_rfft_fast_f32(&L->rfft, pAcc, pWork, 1u);
+  memcpy(pDst, pWork + P, P * sizeof(float32_t));
+}
+
+/**    
+ * @brief Processing function for the floating-point partitioned FFT FIR filter.    
+ * @param[in,out] *S         points to an instance of the floating-point FIR FFT filter structure.    
+ * @param[in]     *pSrc      points to the block of input data.    
+ * @param[out]    *pDst      points to the block of output data.    
+ * @param[in]     blockSize  number of samples to process, a multiple of the blockSize given to the initialization function.    
+ * @return none.    
+ *    
+ * \par    
+ * <code>pSrc</code> and <code>pDst</code> may be the same buffer.    
+ */
+
+void arm_fir_fft_f32(
+  arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  arm_fir_fft_level_f32 *L;
+  uint32_t P0 = S->blockSize;
+  uint32_t histKeep = S->histLen >> 1u;
+  uint32_t i;
+  float32_t *pHist;
+
+  for(; blockSize >= P0; blockSize -= P0)
+  {
+    if(S->numLevels == 0u)
+    {
+      /* Short filter, direct form */
+      arm_fir_f32(&S->direct, (float32_t *) pSrc, pDst, P0);
+      pSrc += P0;
+      pDst += P0;
+      continue;
+    }
+
+    /* Append the block to the input history, moving the history to the start of the buffer when it is full */
+    if((S->histPos + P0) > S->histLen)
+    {
+      memmove(S->pHist, S->pHist + S->histPos - histKeep, histKeep * sizeof(float32_t));
+      S->histPos = histKeep;
+    }
+
+    pHist = S->pHist + S->histPos;
+    memcpy(pHist, pSrc, P0 * sizeof(float32_t));
+    S->histPos += P0;
+    pHist += P0;
+
+    /* The first level filters the block just read */
+    arm_fir_fft_run_level_f32(&S->level[0], pHist, pDst, S->pWork, S->pAcc);
+
+    /* The later levels add their output computed in advance */
+    for(i = 1u; i < S->numLevels; i++)
+    {
+      L = &S->level[i];
+      arm_add_f32(pDst, L->pOut + (S->count % L->partSize), pDst, P0);
+    }
+
+    S->count += P0;
+
+    /* and compute it for the next partSize samples when they are due */
+    for(i = 1u; i < S->numLevels; i++)
+    {
+      L = &S->level[i];
+
+      if((S->count % L->partSize) == 0u)
+      {
+        arm_fir_fft_run_level_f32(L, pHist, L->pOut, S->pWork, S->pAcc);
+      }
+    }
+
+    /* All partition sizes divide the largest one */
+    if(S->count == S->level[S->numLevels - 1u].partSize)
+    {
+      S->count = 0u;
+    }
+
+    pSrc += P0;
+    pDst += P0;
+  }
+}
+
+/**    
+ * @} end of FIR_FFT group    
+ */
@@ -0,0 +1,243 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_fir_fft_init_f32.c   
+*    
+* Description:	Initialization function for the floating-point partitioned FFT FIR filter    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup FIR_FFT    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point partitioned FFT FIR filter.    
+ * @param[in,out] *S           points to an instance of the floating-point FIR FFT filter structure.    
+ * @param[in]     numTaps      number of filter coefficients in the filter.    
+ * @param[in]     *pCoeffs     points to the filter coefficient buffer.    
+ * @param[in]     *pState      points to the state buffer.    
+ * @param[in]     stateLen     length of the state buffer in words.    
+ * @param[in]     blockSize    number of samples processed at a time and length of the first partitions, a power of 2 from 16 to 2048.    
+ * @param[in]     maxPartSize  length of the longest partitions, a power of 2 from <code>blockSize</code> to 2048.    
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful,    
+ * ARM_MATH_ARGUMENT_ERROR if <code>blockSize</code> or <code>maxPartSize</code> is not supported or    
+ * ARM_MATH_LENGTH_ERROR if the state buffer is too small.    
+ *    
+ * <b>Description:</b>    
+ * \par    
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:    
+ * <pre>    
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}    
+ * </pre>    
+ * In direct form (<code>numTaps</code> below <code>ARM_FIR_FFT_DIRECT_TAPS</code>) the coefficient array must stay    
+ * valid while the filter is used, otherwise it is only read here.    
+ * \par    
+ * The length of the state buffer needed is written to <code>S->stateLen</code> before the length is checked, so    
+ * a first call with <code>stateLen</code> 0 returns ARM_MATH_LENGTH_ERROR and the length to allocate.    
+ * The state buffer is cleared.    
+ * \par    
+ * The first level has partitions of <code>blockSize</code> taps up to tap <code>4*blockSize</code>, the next one    
+ * partitions of <code>4*blockSize</code> taps up to tap <code>16*blockSize</code>, and so on up to    
+ * <code>maxPartSize</code>; the last level takes the rest of the filter.    
+ */
+
+arm_status arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint32_t numTaps,
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t stateLen,
+  uint16_t blockSize,
+  uint16_t maxPartSize)
+{
+  arm_fir_fft_level_f32 *L;
+  uint32_t P, off, end, len, need, i, k, j, n;
+  float32_t *p;
+
+  if((blockSize < 16u) || (blockSize > 2048u) || ((blockSize & (blockSize - 1u)) != 0u) ||
+     (maxPartSize < blockSize) || (maxPartSize > 2048u) || ((maxPartSize & (maxPartSize - 1u)) != 0u) ||
+     (numTaps == 0u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numTaps = numTaps;
+  S->blockSize = blockSize;
+  S->count = 0u;
+
+  if(numTaps < ARM_FIR_FFT_DIRECT_TAPS)
+  {
+    /* Direct form */
+    S->numLevels = 0u;
+    S->histLen = 0u;
+    S->stateLen = numTaps + blockSize - 1u;
+
+    if(stateLen < S->stateLen)
+    {
+      return (ARM_MATH_LENGTH_ERROR);
+    }
+
+    arm_fir_init_f32(&S->direct, (uint16_t) numTaps, (float32_t *) pCoeffs, pState, blockSize);
+
+    return (ARM_MATH_SUCCESS);
+  }
+
+  /* Plan the levels: partitions of P taps from tap off, with off a multiple of P and at least P after the first level */
+  S->numLevels = 0u;
+  P = blockSize;
+  off = 0u;
+  need = 0u;
+
+  while(off < numTaps)
+  {
+    L = &S->level[S->numLevels];
+
+    if((P < maxPartSize) && (S->numLevels < (ARM_FIR_FFT_MAX_LEVELS - 1u)))
+    {
+      /* The next level starts at its own partition size */
+      end = 4u * P;
+      end = (end > maxPartSize) ? maxPartSize : end;
+      end = ((off + P + end - 1u) / end) * end;
+      end = (end > numTaps) ? numTaps : end;
+    }
+    else
+    {
+      end = numTaps;
+    }
+
+    L->partSize = (uint16_t) P;
+    L->numParts = (end - off + P - 1u) / P;
+    L->ageOfs = (off == 0u) ? 0u : ((off / P) - 1u);
+    L->fdlLen = L->ageOfs + L->numParts;
+    L->fdlPos = 0u;
+
+    /* Partition spectra, delay line and, after the first level, the output computed in advance */
+    need += (L->numParts + L->fdlLen) * 2u * P + ((off == 0u) ? 0u : P);
+
+    S->numLevels++;
+    off += L->numParts * P;
+
+    if((4u * P) <= maxPartSize)
+    {
+      P *= 4u;
+    }
+    else
+    {
+      P = maxPartSize;
+    }
+  }
+
+  /* Input history (2*P kept plus room to append), FFT work buffer and accumulator */
+  P = S->level[S->numLevels - 1u].partSize;
+  S->histLen = 4u * P;
+  need += S->histLen + 4u * P;
+  S->stateLen = need;
+
+  if(stateLen < need)
+  {
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  memset(pState, 0, need * sizeof(float32_t));
+
+  p = pState;
+  S->pHist = p;
+  S->histPos = 2u * P;
+  p += S->histLen;
+  S->pWork = p;
+  p += 2u * P;
+  S->pAcc = p;
+  p += 2u * P;
+
+  off = 0u;
+
+  for(i = 0u; i < S->numLevels; i++)
+  {
+    L = &S->level[i];
+    P = L->partSize;
+    len = 2u * P;
+
+    arm_rfft_fast_init_f32(&L->rfft, (uint16_t) len);
+
+    /* Partition k holds b[off + k*P + j], zero padded to 2*P, as a spectrum */
+    L->pCoeffs = p;
+
+    for(k = 0u; k < L->numParts; k++)
+    {
+      memset(S->pWork, 0, len * sizeof(float32_t));
+
+      for(j = 0u; j < P; j++)
+      {
+        n = off + k * P + j;
+
+        if(n < numTaps)
+        {
+          S->pWork[j] = pCoeffs[numTaps - 1u - n];
+        }
+      }
+
+      arm_rfft_fast_f32(&L->rfft, S->pWork, p, 0u);
+      p += len;
+    }
+
+    L->pFdl = p;
+    p += L->fdlLen * len;
+
+    if(i > 0u)
+    {
+      L->pOut = p;
+      p += P;
+    }
+    else
+    {
+      L->pOut = NULL;
+    }
+
+    off += L->numParts * P;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of FIR_FFT group    
+ */
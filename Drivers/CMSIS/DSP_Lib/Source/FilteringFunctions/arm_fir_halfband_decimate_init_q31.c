@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_fir_halfband_decimate_init_q31.c   
+*    
+* Description:	Initialization function for the Q31 half-band FIR decimator    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup FIR_Halfband    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the Q31 half-band FIR decimator.    
+ * @param[in,out] *S         points to an instance of the Q31 half-band decimator structure.    
+ * @param[in]     numCoeffs  number of non-zero coefficients on one side of the centre tap.    
+ * @param[in]     *pCoeffs   points to the filter coefficients.    
+ * @param[in]     *pState    points to the state buffer.    
+ * @param[in]     blockSize  largest number of input samples processed per call.    
+ * @return    The function returns ARM_MATH_SUCCESS if initialization was successful,    
+ * ARM_MATH_ARGUMENT_ERROR if <code>numCoeffs</code> is zero or ARM_MATH_LENGTH_ERROR if    
+ * <code>blockSize</code> is not a multiple of 2.    
+ *    
+ * <b>Description:</b>    
+ * \par    
+ * <code>pCoeffs</code> points to the <code>numCoeffs</code> non-zero coefficients on one side of the centre tap,    
+ * nearest to the centre tap first.  The filter has <code>4*numCoeffs-1</code> taps.    
+ * \par    
+ * <code>pState</code> points to the array of state variables.    
+ * <code>pState</code> is of length <code>4*numCoeffs-2+blockSize</code> words.    
+ */
+
+arm_status arm_fir_halfband_decimate_init_q31(
+  arm_fir_halfband_decimate_instance_q31 * S,
+  uint16_t numCoeffs,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize)
+{
+  arm_status status;
+
+  if(numCoeffs == 0u)
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  /* The size of the input block must be a multiple of the decimation factor */
+  else if((blockSize & 1u) != 0u)
+  {
+    /* Set status as ARM_MATH_LENGTH_ERROR */
+    status = ARM_MATH_LENGTH_ERROR;
+  }
+  else
+  {
+    /* Assign the number of coefficients and the coefficient pointer */
+    S->numCoeffs = numCoeffs;
+    S->pCoeffs = pCoeffs;
+
+    /* Clear the state buffer.  The size is always (4*numCoeffs - 2 + blockSize) */
+    memset(pState, 0, (4u * numCoeffs - 2u + blockSize) * sizeof(q31_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**    
+ * @} end of FIR_Halfband group    
+ */
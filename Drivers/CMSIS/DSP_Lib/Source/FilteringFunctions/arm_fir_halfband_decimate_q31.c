@@ -0,0 +1,216 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_fir_halfband_decimate_q31.c   
+*    
+* Description:	Q31 half-band FIR decimator    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @defgroup FIR_Halfband Half-Band FIR Decimator    
+ *    
+ * These functions decimate by 2 with a half-band lowpass filter, the usual filter for the stages of    
+ * a decimation chain that halve the sample rate.  A half-band filter of length <code>4*numCoeffs-1</code>    
+ * has its cutoff at a quarter of the input rate, the centre tap equal to 0.5 and every other tap equal    
+ * to zero, and is symmetric:    
+ * <pre>    
+ *    y[n] = 0.5 * x[2n-c] + g[0] * (x[2n-c+1] + x[2n-c-1]) + g[1] * (x[2n-c+3] + x[2n-c-3]) + ...    
+ *           + g[numCoeffs-1] * (x[2n-c+2*numCoeffs-1] + x[2n-c-2*numCoeffs+1])    
+ * </pre>    
+ * with <code>c = 2*numCoeffs-1</code>.  The functions only multiply by the <code>numCoeffs</code> non-zero    
+ * coefficients on one side of the centre tap, so an output costs <code>2*numCoeffs</code> multiply-accumulates    
+ * where <code>arm_fir_decimate_q31()</code> with the same filter needs <code>4*numCoeffs-1</code>.    
+ * \ref arm_fir_halfband_design_f32() designs the coefficients.    
+ *    
+ * The functions operate on blocks of input data whose length is a multiple of 2 and produce half as    
+ * many outputs.  The output may overwrite the input (<code>pDst == pSrc</code>).    
+ *    
+ * \par    
+ * <code>pCoeffs</code> points to the <code>numCoeffs</code> coefficients <code>{g[0], g[1], ..., g[numCoeffs-1]}</code>,    
+ * nearest to the centre tap first.    
+ * \par    
+ * <code>pState</code> points to a state array of size <code>4*numCoeffs-2+blockSize</code>    
+ * that holds the last <code>4*numCoeffs-2</code> input samples followed by room for a block.    
+ *    
+ * \par Instance Structure    
+ * The coefficients and state variables for a filter are stored together in an instance data structure.    
+ * A separate instance structure must be defined for each filter.    
+ * Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.    
+ *    
+ * \par Initialization Function    
+ * The initialization function checks that <code>numCoeffs</code> is not zero and that <code>blockSize</code>    
+ * is a multiple of 2, sets the values of the internal structure fields and zeros out the state buffer.    
+ * To do this manually without calling the init function, assign numCoeffs, pCoeffs and pState and set    
+ * the first <code>4*numCoeffs-2</code> values of pState to zero.    
+ */
+
+/**    
+ * @addtogroup FIR_Halfband    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the Q31 half-band FIR decimator.    
+ * @param[in]  *S points to an instance of the Q31 half-band decimator structure.    
+ * @param[in]  *pSrc points to the block of input data.    
+ * @param[out] *pDst points to the block of output data, may be pSrc.    
+ * @param[in]  blockSize number of input samples to process, a multiple of 2.    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The function is implemented using an internal 64-bit accumulator in 2.62 format with a single    
+ * guard bit.  After all multiply-accumulates are performed the accumulator is truncated to 1.32 format    
+ * and saturated to 1.31 format.  The gain of a half-band filter does not exceed 1 by more than its    
+ * passband ripple, so the guard bit is enough.    
+ */
+
+void arm_fir_halfband_decimate_q31(
+  const arm_fir_halfband_decimate_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* state pointer */
+  q31_t *pStateCurnt;                            /* points to the current sample of the state */
+  q31_t *pCoeffs = S->pCoeffs;                   /* coefficient pointer */
+  q31_t *pb;                                     /* coefficient pointer */
+  q31_t *pxl, *pxh;                              /* samples before and after the centre tap */
+  q31_t c0;                                      /* coefficient */
+  q63_t sum0;                                    /* accumulator */
+  uint32_t numCoeffs = S->numCoeffs;             /* number of coefficients on one side */
+  uint32_t stateLength = 4u * numCoeffs - 2u;    /* samples kept between calls */
+  uint32_t i, tapCnt, blkCnt;                    /* loop counters */
+
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = pState + stateLength;
+
+  /* Total number of output samples to be computed */
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy 2 new input samples into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    /* Centre tap 0.5 */
+    sum0 = (q63_t) pState[2u * numCoeffs - 1u] * 0x40000000;
+
+    /* Samples on either side of the centre tap, nearest first */
+    pxl = pState + (2u * numCoeffs - 2u);
+    pxh = pState + (2u * numCoeffs);
+    pb = pCoeffs;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Process 2 coefficients at a time. */
+    tapCnt = numCoeffs >> 1u;
+
+    while(tapCnt > 0u)
+    {
+      c0 = *pb++;
+      sum0 += (q63_t) pxl[0] * c0;
+      sum0 += (q63_t) pxh[0] * c0;
+
+      c0 = *pb++;
+      sum0 += (q63_t) pxl[-2] * c0;
+      sum0 += (q63_t) pxh[2] * c0;
+
+      pxl -= 4;
+      pxh += 4;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If numCoeffs is odd, compute the remaining coefficient */
+    tapCnt = numCoeffs & 1u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    tapCnt = numCoeffs;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(tapCnt > 0u)
+    {
+      c0 = *pb++;
+      sum0 += (q63_t) * pxl * c0;
+      sum0 += (q63_t) * pxh * c0;
+
+      pxl -= 2;
+      pxh += 2;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* Advance the state pointer by the decimation factor */
+    pState += 2;
+
+    /* The result is in the accumulator, store in the destination buffer. */
+    *pDst++ = clip_q63_to_q31(sum0 >> 31);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last stateLength samples to the start of the state buffer
+     for the next call */
+  pStateCurnt = S->pState;
+  i = stateLength;
+
+  while(i > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+}
+
+/**    
+ * @} end of FIR_Halfband group    
+ */
@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_fir_halfband_design_f32.c   
+*    
+* Description:	Kaiser window design of half-band FIR filters    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @defgroup FIR_Design FIR Filter Design    
+ *    
+ * These functions compute coefficients for the decimation filters of \ref FIR_Halfband and    
+ * \ref DecimateChain at run time, so the filters can follow a sample rate or a decimation factor that is    
+ * only known then.  Both are windowed designs: the ideal impulse response is multiplied by a Kaiser    
+ * window whose shape parameter is chosen for the requested stopband attenuation <code>A</code> in dB:    
+ * <pre>    
+ *    beta = 0.1102 * (A - 8.7)                                  A > 50    
+ *    beta = 0.5842 * (A - 21)^0.4 + 0.07886 * (A - 21)          21 <= A <= 50    
+ *    beta = 0                                                   A < 21    
+ * </pre>    
+ * The width of the transition band, as a fraction of the sample rate, is then about    
+ * <code>(A - 7.95) / (14.36 * (numTaps - 1))</code>.    
+ *    
+ * The coefficients are computed in double precision and stored as floating-point values; they are    
+ * converted to Q31 with <code>arm_float_to_q31()</code>, which may be done in place.    
+ */
+
+/**    
+ * @addtogroup FIR_Design    
+ * @{    
+ */
+
+/* Zeroth order modified Bessel function of the first kind, power series */
+static float64_t arm_kaiser_i0(
+  float64_t x)
+{
+  float64_t sum = 1.0, term = 1.0, q = 0.25 * x * x;
+  uint32_t k = 1u;
+
+  do
+  {
+    term *= q / ((float64_t) k * k);
+    sum += term;
+    k++;
+  } while(term > sum * 1e-17);
+
+  return (sum);
+}
+
+/* Kaiser window shape parameter for a stopband attenuation in dB */
+static float64_t arm_kaiser_beta(
+  float64_t attenuation)
+{
+  float64_t beta;
+
+  if(attenuation > 50.0)
+  {
+    beta = 0.1102 * (attenuation - 8.7);
+  }
+  else if(attenuation >= 21.0)
+  {
+    beta = 0.5842 * pow(attenuation - 21.0, 0.4) + 0.07886 * (attenuation - 21.0);
+  }
+  else
+  {
+    beta = 0.0;
+  }
+
+  return (beta);
+}
+
+/**    
+ * @brief Designs a half-band lowpass filter for the half-band FIR decimator.    
+ * @param[in]  numCoeffs    number of non-zero coefficients on one side of the centre tap, the filter has 4*numCoeffs-1 taps.    
+ * @param[in]  attenuation  stopband attenuation in dB.    
+ * @param[out] *pCoeffs     points to the numCoeffs coefficients, nearest to the centre tap first.    
+ * @return     The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if <code>numCoeffs</code> is zero.    
+ *    
+ * \par    
+ * The ideal half-band response <code>sin(pi*m/2)/(pi*m)</code> is windowed over <code>m = -(2*numCoeffs-1) ... 2*numCoeffs-1</code>.    
+ * The passband and stopband ripples of a half-band filter are equal, so <code>attenuation</code> also sets the    
+ * passband ripple; the transition band is centred on a quarter of the input rate.    
+ */
+
+arm_status arm_fir_halfband_design_f32(
+  uint16_t numCoeffs,
+  float32_t attenuation,
+  float32_t * pCoeffs)
+{
+  float64_t beta = arm_kaiser_beta(attenuation);  /* window shape */
+  float64_t scale;                               /* 1 / I0(beta) */
+  float64_t half = 2.0 * numCoeffs - 1.0;        /* offset of the outermost tap */
+  float64_t m, r;                                /* tap offset and its ratio to half */
+  uint32_t j;                                    /* loop counter */
+
+  if(numCoeffs == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  scale = 1.0 / arm_kaiser_i0(beta);
+
+  for (j = 0u; j < numCoeffs; j++)
+  {
+    /* Odd offset m = 2j+1, sin(pi*m/2) = (-1)^j */
+    m = 2.0 * j + 1.0;
+    r = m / half;
+
+    pCoeffs[j] = (float32_t) ((((j & 1u) ? -1.0 : 1.0) / (3.14159265358979323846 * m)) * arm_kaiser_i0(beta * sqrt(1.0 - r * r)) * scale);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of FIR_Design group    
+ */
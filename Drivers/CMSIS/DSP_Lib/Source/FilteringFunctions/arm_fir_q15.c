@@ -77,9 +77,268 @@
 
 #ifndef ARM_MATH_CM0_FAMILY
 
-/* Run the below code for Cortex-M4 and Cortex-M3 */
+#if defined(ARM_MATH_CM7) && !defined(UNALIGNED_SUPPORT_DISABLE) && !defined(ARM_MATH_BIG_ENDIAN)
+
+/* Run the below code for Cortex-M7 */
+
+void arm_fir_q15(
+  const arm_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px1;                                    /* Temporary q15 pointer for state buffer */
+  q15_t *pb;                                     /* Temporary pointer for coefficient buffer */
+  q31_t x0, x1, x2, c0;                          /* Temporary variables to hold SIMD state and coefficient values */
+  q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps in the filter */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1u)]);
+
+  /* Apply loop unrolling and compute 4 output values simultaneously.
+   * The variables acc0 ... acc3 hold output values that are being computed:
+   *
+   *    acc0 =  b[numTaps-1] * x[n-numTaps-1] + b[numTaps-2] * x[n-numTaps-2] + b[numTaps-3] * x[n-numTaps-3] +...+ b[0] * x[0]
+   *    acc1 =  b[numTaps-1] * x[n-numTaps] +   b[numTaps-2] * x[n-numTaps-1] + b[numTaps-3] * x[n-numTaps-2] +...+ b[0] * x[1]
+   *    acc2 =  b[numTaps-1] * x[n-numTaps+1] + b[numTaps-2] * x[n-numTaps] +   b[numTaps-3] * x[n-numTaps-1] +...+ b[0] * x[2]
+   *    acc3 =  b[numTaps-1] * x[n-numTaps+2] + b[numTaps-2] * x[n-numTaps+1] + b[numTaps-3] * x[n-numTaps]   +...+ b[0] * x[3]
+   *
+   * acc0 and acc2 consume the state pairs at even offsets straight from the buffer.
+   * The pairs at odd offsets needed by acc1 and acc3 are not loaded: they are packed
+   * from two neighbouring even pairs with PKHTB, which leaves the halves swapped, so
+   * they are consumed with SMLALDX.  This halves the state loads and keeps them word
+   * aligned when pState is, where the Cortex-M4 code reads every other pair from an
+   * odd offset.  Each load and PKHTB is placed between multiply-accumulates on
+   * different accumulators so that the Cortex-M7 can dual issue it, and only four
+   * operand registers are live next to the accumulators.
+   */
+
+  blkCnt = blockSize >> 2;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Copy four new input samples into the state buffer.
+     ** Use 32-bit SIMD to move the 16-bit data.  Only requires two copies. */
+    *__SIMD32(pStateCurnt)++ = *__SIMD32(pSrc)++;
+    *__SIMD32(pStateCurnt)++ = *__SIMD32(pSrc)++;
+
+    /* Set all accumulators to zero */
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
+
+    /* Initialize state pointer of type q15 */
+    px1 = pState;
+
+    /* Initialize coeff pointer of type q15 */
+    pb = pCoeffs;
+
+    /* Read the first four samples from the state buffer: x[n-N], x[n-N-1] and x[n-N-2], x[n-N-3] */
+    x0 = _SIMD32_OFFSET(px1);
+    x1 = _SIMD32_OFFSET(px1 + 2u);
+
+    px1 += 4u;
+
+    /* Loop over the number of taps.  Unroll by a factor of 4.
+     ** The last 2 or 4 taps are computed below so that no state is read past
+     ** the newest sample. */
+    tapCnt = (numTaps - 2u) >> 2;
+
+    while(tapCnt > 0u)
+    {
+      /* Read the first two coefficients using SIMD:  b[N] and b[N-1] coefficients */
+      c0 = *__SIMD32(pb)++;
+
+      /* acc0 +=  b[N] * x[n-N] + b[N-1] * x[n-N-1] */
+      acc0 = __SMLALD(x0, c0, acc0);
+
+      /* acc2 +=  b[N] * x[n-N-2] + b[N-1] * x[n-N-3] */
+      acc2 = __SMLALD(x1, c0, acc2);
+
+      /* Pack x[n-N-1], x[n-N-2] */
+      x0 = __PKHTB(x0, x1, 0);
+
+      /* Read state x[n-N-4], x[n-N-5] */
+      x2 = _SIMD32_OFFSET(px1);
+
+      /* acc1 +=  b[N] * x[n-N-1] + b[N-1] * x[n-N-2] */
+      acc1 = __SMLALDX(x0, c0, acc1);
+
+      /* Pack x[n-N-3], x[n-N-4] */
+      x0 = __PKHTB(x1, x2, 0);
+
+      /* acc3 +=  b[N] * x[n-N-3] + b[N-1] * x[n-N-4] */
+      acc3 = __SMLALDX(x0, c0, acc3);
+
+      /* Read coefficients b[N-2], b[N-3] */
+      c0 = *__SIMD32(pb)++;
+
+      /* acc1 +=  b[N-2] * x[n-N-3] + b[N-3] * x[n-N-4] */
+      acc1 = __SMLALDX(x0, c0, acc1);
+
+      /* acc0 +=  b[N-2] * x[n-N-2] + b[N-3] * x[n-N-3] */
+      acc0 = __SMLALD(x1, c0, acc0);
+
+      /* Read state x[n-N-6], x[n-N-7] */
+      x1 = _SIMD32_OFFSET(px1 + 2u);
+
+      /* acc2 +=  b[N-2] * x[n-N-4] + b[N-3] * x[n-N-5] */
+      acc2 = __SMLALD(x2, c0, acc2);
+
+      /* Pack x[n-N-5], x[n-N-6] */
+      x0 = __PKHTB(x2, x1, 0);
+
+      /* acc3 +=  b[N-2] * x[n-N-5] + b[N-3] * x[n-N-6] */
+      acc3 = __SMLALDX(x0, c0, acc3);
+
+      /* x[n-N-4], x[n-N-5] start the next 4 taps */
+      x0 = x2;
+
+      px1 += 4u;
+
+      tapCnt--;
+    }
+
+    /* The last 2 or 4 taps.  The newest state sample is read on its own. */
+    c0 = *__SIMD32(pb)++;
+
+    acc0 = __SMLALD(x0, c0, acc0);
+    acc2 = __SMLALD(x1, c0, acc2);
+
+    x0 = __PKHTB(x0, x1, 0);
+
+    if((numTaps & 0x3u) == 0u)
+    {
+      x2 = _SIMD32_OFFSET(px1);
+    }
+    else
+    {
+      x2 = *px1;
+    }
 
-#ifndef UNALIGNED_SUPPORT_DISABLE
+    acc1 = __SMLALDX(x0, c0, acc1);
+
+    x0 = __PKHTB(x1, x2, 0);
+
+    acc3 = __SMLALDX(x0, c0, acc3);
+
+    if((numTaps & 0x3u) == 0u)
+    {
+      c0 = *__SIMD32(pb)++;
+
+      acc1 = __SMLALDX(x0, c0, acc1);
+      acc0 = __SMLALD(x1, c0, acc0);
+
+      x1 = *(px1 + 2u);
+
+      acc2 = __SMLALD(x2, c0, acc2);
+
+      x0 = __PKHTB(x2, x1, 0);
+
+      acc3 = __SMLALDX(x0, c0, acc3);
+    }
+
+    /* The results in the 4 accumulators are in 2.30 format.  Convert to 1.15 with saturation.
+     ** Then store the 4 outputs in the destination buffer. */
+    *__SIMD32(pDst)++ =
+      __PKHBT(__SSAT((acc0 >> 15), 16), __SSAT((acc1 >> 15), 16), 16);
+    *__SIMD32(pDst)++ =
+      __PKHBT(__SSAT((acc2 >> 15), 16), __SSAT((acc3 >> 15), 16), 16);
+
+    /* Advance the state pointer by 4 to process the next group of 4 samples */
+    pState = pState + 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+  while(blkCnt > 0u)
+  {
+    /* Copy one sample into state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    /* Set the accumulator to zero */
+    acc0 = 0;
+
+    /* Initialize state pointer of type q15 */
+    px1 = pState;
+
+    /* Initialize coeff pointer of type q15 */
+    pb = pCoeffs;
+
+    tapCnt = numTaps >> 1;
+
+    do
+    {
+      c0 = *__SIMD32(pb)++;
+      x0 = *__SIMD32(px1)++;
+
+      acc0 = __SMLALD(x0, c0, acc0);
+      tapCnt--;
+    }
+    while(tapCnt > 0u);
+
+    /* The result is in 2.30 format.  Convert to 1.15 with saturation.
+     ** Then store the output in the destination buffer. */
+    *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* Calculation of count for copying integer writes */
+  tapCnt = (numTaps - 1u) >> 2;
+
+  while(tapCnt > 0u)
+  {
+
+    /* Copy state values to start of state buffer */
+    *__SIMD32(pStateCurnt)++ = *__SIMD32(pState)++;
+    *__SIMD32(pStateCurnt)++ = *__SIMD32(pState)++;
+
+    tapCnt--;
+
+  }
+
+  /* Calculation of count for remaining q15_t data */
+  tapCnt = (numTaps - 1u) % 0x4u;
+
+  /* copy remaining data */
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+}
+
+#elif !defined(UNALIGNED_SUPPORT_DISABLE)
+
+/* Run the below code for Cortex-M4 and Cortex-M3 */
 
 
 void arm_fir_q15(
@@ -593,7 +852,7 @@ void arm_fir_q15(
 }
 
 
-#endif /* #ifndef UNALIGNED_SUPPORT_DISABLE */
+#endif /* #if defined(ARM_MATH_CM7) && !defined(UNALIGNED_SUPPORT_DISABLE) && !defined(ARM_MATH_BIG_ENDIAN) */
 
 #else /* ARM_MATH_CM0_FAMILY */
 
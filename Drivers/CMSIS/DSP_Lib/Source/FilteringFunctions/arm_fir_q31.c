@@ -80,7 +80,237 @@ void arm_fir_q31(
   q31_t *pStateCurnt;                            /* Points to the current sample of the state */
 
 
-#ifndef ARM_MATH_CM0_FAMILY
+#if defined(ARM_MATH_CM7) && !defined(ARM_MATH_BIG_ENDIAN)
+
+  /* Run the below code for Cortex-M7 */
+
+  q31_t x0, x1, x2, x3;                          /* Temporary variables to hold state */
+  q31_t c0, c1;                                  /* Temporary variables to hold coefficient values */
+  q63_t xx, cc;                                  /* State and coefficient pairs read with one 64-bit load */
+  q31_t *px;                                     /* Temporary pointer for state */
+  q31_t *pb;                                     /* Temporary pointer for coefficient buffer */
+  q63_t acc0, acc1, acc2;                        /* Accumulators */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1u)]);
+
+  /* Apply loop unrolling and compute 3 output values simultaneously.
+   * The variables acc0 ... acc2 hold output values that are being computed:
+   *
+   *    acc0 =  b[numTaps-1] * x[n-numTaps-1] + b[numTaps-2] * x[n-numTaps-2] + b[numTaps-3] * x[n-numTaps-3] +...+ b[0] * x[0]
+   *    acc1 =  b[numTaps-1] * x[n-numTaps] +   b[numTaps-2] * x[n-numTaps-1] + b[numTaps-3] * x[n-numTaps-2] +...+ b[0] * x[1]
+   *    acc2 =  b[numTaps-1] * x[n-numTaps+1] + b[numTaps-2] * x[n-numTaps] +   b[numTaps-3] * x[n-numTaps-1] +...+ b[0] * x[2]
+   *
+   * Coefficients and states are read two at a time with 64-bit loads (LDRD), which
+   * the Cortex-M7 issues alongside the SMLALs of the previous pair.  Three 64-bit
+   * accumulators are the most that fit in registers next to the operands.
+   */
+  blkCnt = blockSize / 3;
+  blockSize = blockSize - (3 * blkCnt);
+
+  tapCnt = numTaps >> 2;
+
+  /* First part of the processing with loop unrolling.  Compute 3 outputs at a time.
+   ** a second loop below computes the remaining 1 or 2 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Copy three new input samples into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    /* Set all accumulators to zero */
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+
+    /* Initialize state pointer */
+    px = pState;
+
+    /* Initialize coefficient pointer */
+    pb = pCoeffs;
+
+    /* Read the first two samples from the state buffer:
+     *  x[n-numTaps], x[n-numTaps-1] */
+    xx = *__SIMD64(px)++;
+    x0 = (q31_t) xx;
+    x1 = (q31_t) (xx >> 32);
+
+    /* Loop unrolling.  Process 4 taps at a time. */
+    i = tapCnt;
+
+    while(i > 0u)
+    {
+      /* Read the b[numTaps], b[numTaps-1] coefficients */
+      cc = *__SIMD64(pb)++;
+      c0 = (q31_t) cc;
+      c1 = (q31_t) (cc >> 32);
+
+      /* Read x[n-numTaps-2], x[n-numTaps-3] samples */
+      xx = *__SIMD64(px)++;
+      x2 = (q31_t) xx;
+      x3 = (q31_t) (xx >> 32);
+
+      /* Perform the multiply-accumulates */
+      acc0 += ((q63_t) x0 * c0);
+      acc1 += ((q63_t) x1 * c0);
+      acc2 += ((q63_t) x2 * c0);
+
+      acc0 += ((q63_t) x1 * c1);
+      acc1 += ((q63_t) x2 * c1);
+      acc2 += ((q63_t) x3 * c1);
+
+      /* Read the b[numTaps-2], b[numTaps-3] coefficients */
+      cc = *__SIMD64(pb)++;
+      c0 = (q31_t) cc;
+      c1 = (q31_t) (cc >> 32);
+
+      /* Read x[n-numTaps-4], x[n-numTaps-5] samples */
+      xx = *__SIMD64(px)++;
+      x0 = (q31_t) xx;
+      x1 = (q31_t) (xx >> 32);
+
+      /* Perform the multiply-accumulates */
+      acc0 += ((q63_t) x2 * c0);
+      acc1 += ((q63_t) x3 * c0);
+      acc2 += ((q63_t) x0 * c0);
+
+      acc0 += ((q63_t) x3 * c1);
+      acc1 += ((q63_t) x0 * c1);
+      acc2 += ((q63_t) x1 * c1);
+
+      /* Decrement the loop counter */
+      i--;
+    }
+
+    /* If the filter length is not a multiple of 4, compute the remaining filter taps */
+    if((numTaps & 0x2u) != 0u)
+    {
+      /* Read coefficients */
+      cc = *__SIMD64(pb)++;
+      c0 = (q31_t) cc;
+      c1 = (q31_t) (cc >> 32);
+
+      /* Fetch 2 state variables */
+      xx = *__SIMD64(px)++;
+      x2 = (q31_t) xx;
+      x3 = (q31_t) (xx >> 32);
+
+      /* Perform the multiply-accumulates */
+      acc0 += ((q63_t) x0 * c0);
+      acc1 += ((q63_t) x1 * c0);
+      acc2 += ((q63_t) x2 * c0);
+
+      acc0 += ((q63_t) x1 * c1);
+      acc1 += ((q63_t) x2 * c1);
+      acc2 += ((q63_t) x3 * c1);
+
+      /* Reuse the present sample states for the last tap */
+      x0 = x2;
+      x1 = x3;
+    }
+
+    if((numTaps & 0x1u) != 0u)
+    {
+      /* Read coefficient */
+      c0 = *pb;
+
+      /* Fetch 1 state variable */
+      x2 = *px;
+
+      /* Perform the multiply-accumulates */
+      acc0 += ((q63_t) x0 * c0);
+      acc1 += ((q63_t) x1 * c0);
+      acc2 += ((q63_t) x2 * c0);
+    }
+
+    /* Advance the state pointer by 3 to process the next group of 3 samples */
+    pState = pState + 3;
+
+    /* The results in the 3 accumulators are in 2.62 format.  Convert to 1.31
+     ** Then store the 3 outputs in the destination buffer. */
+    *pDst++ = (q31_t) (acc0 >> 31u);
+    *pDst++ = (q31_t) (acc1 >> 31u);
+    *pDst++ = (q31_t) (acc2 >> 31u);
+
+    /* Decrement the samples loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 3, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+
+  while(blockSize > 0u)
+  {
+    /* Copy one sample at a time into state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    /* Set the accumulator to zero */
+    acc0 = 0;
+
+    /* Initialize state pointer */
+    px = pState;
+
+    /* Initialize Coefficient pointer */
+    pb = (pCoeffs);
+
+    i = numTaps;
+
+    /* Perform the multiply-accumulates */
+    do
+    {
+      acc0 += (q63_t) * (px++) * (*(pb++));
+      i--;
+    } while(i > 0u);
+
+    /* The result is in 2.62 format.  Convert to 1.31
+     ** Then store the output in the destination buffer. */
+    *pDst++ = (q31_t) (acc0 >> 31u);
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1;
+
+    /* Decrement the samples loop counter */
+    blockSize--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  tapCnt = (numTaps - 1u) >> 2u;
+
+  /* copy data */
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+    *pStateCurnt++ = *pState++;
+    *pStateCurnt++ = *pState++;
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+
+  /* Calculate remaining number of copies */
+  tapCnt = (numTaps - 1u) % 0x4u;
+
+  /* Copy the remaining q31_t data */
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+
+#elif !defined(ARM_MATH_CM0_FAMILY)
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
@@ -356,7 +586,7 @@ void arm_fir_q31(
   }
 
 
-#endif /*  #ifndef ARM_MATH_CM0_FAMILY */
+#endif /* #if defined(ARM_MATH_CM7) && !defined(ARM_MATH_BIG_ENDIAN) */
 
 }
 
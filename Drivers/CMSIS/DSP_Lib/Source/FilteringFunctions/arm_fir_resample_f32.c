@@ -0,0 +1,278 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_fir_resample_f32.c   
+*    
+* Description:	Floating-point FIR rational resampler    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Rational Resampler    
+ *    
+ * These functions change the sample rate of a signal by the rational factor <code>L/M</code>.    
+ * Conceptually they are an upsampler (zero stuffer) by <code>L</code>, an FIR lowpass filter and a    
+ * downsampler by <code>M</code>, the cascade of an FIR interpolator and an FIR decimator.    
+ * The cascade computes <code>L</code> filter outputs per input sample and then throws most of them away;    
+ * these functions only compute the outputs that are kept, and each of them with only the one polyphase    
+ * component of the filter that it needs.    
+ * After upsampling, the filter should have a normalized cutoff frequency of <code>1/max(L, M)</code>    
+ * so that it removes both the images of the upsampler and the aliases of the downsampler.    
+ * The user of the function is responsible for providing the filter coefficients.    
+ *    
+ * The functions operate on blocks of input data of any length up to the <code>blockSize</code>    
+ * given to the initialization function.  The number of outputs produced by a call depends on the    
+ * block length and on the position of the resampler, which is carried from one call to the next,    
+ * and is returned by the function.  A block of <code>n</code> input samples produces    
+ * <code>floor(n*L/M)</code> or <code>ceil(n*L/M)</code> outputs; <code>pDst</code> must have room for the latter.    
+ *    
+ * The library provides separate functions for Q15, Q31, and floating-point data types.    
+ *    
+ * \par Algorithm:    
+ * Output <code>y[m]</code> is sample <code>t = m*M</code> of the filtered upsampled signal.    
+ * With <code>n = t / L</code> and <code>p = t % L</code> (the phase) it is:    
+ * <pre>    
+ *    y[m] = b[p] * x[n] + b[p+L] * x[n-1] + ... + b[p+L*(phaseLength-1)] * x[n-phaseLength+1]    
+ * </pre>    
+ * Each output costs <code>phaseLength = numTaps/L</code> multiply-accumulates, so a block of    
+ * <code>n</code> inputs costs about <code>n*numTaps/M</code> of them, where the interpolator and    
+ * decimator cascade needs <code>n*L*numTaps/M</code> for the decimator alone.    
+ * \par    
+ * <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>.    
+ * The coefficients are the same as for the FIR interpolator and are stored in time reversed order:    
+ * \par    
+ * <pre>    
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}    
+ * </pre>    
+ * <code>numTaps</code> must be a multiple of the interpolation factor <code>L</code> and this is checked by the    
+ * initialization functions.  <code>L</code> and <code>M</code> should not have a common factor;    
+ * the functions work if they have, but then every phase filter is longer than it needs to be.    
+ * \par    
+ * <code>pState</code> points to a state array of size <code>blockSize + phaseLength - 1</code>.    
+ * Samples in the state buffer are stored in the order:    
+ * \par    
+ * <pre>    
+ *    {x[n-phaseLength+1], x[n-phaseLength], x[n-phaseLength-1], x[n-phaseLength-2]....x[0], x[1], ..., x[blockSize-1]}    
+ * </pre>    
+ * The state variables and the position of the next output are updated after each block of data is processed,    
+ * the coefficients are untouched.    
+ *    
+ * \par Instance Structure    
+ * The coefficients and state variables for a filter are stored together in an instance data structure.    
+ * A separate instance structure must be defined for each filter.    
+ * Coefficient arrays may be shared among several instances while state variable array should be allocated separately.    
+ * There are separate instance structure declarations for each of the 3 supported data types.    
+ *    
+ * \par Initialization Functions    
+ * There is also an associated initialization function for each data type.    
+ * The initialization function performs the following operations:    
+ * - Sets the values of the internal structure fields.    
+ * - Zeros out the values in the state buffer.    
+ * - Checks to make sure that the length of the filter is a multiple of the interpolation factor.    
+ * To do this manually without calling the init function, assign the follow subfields of the instance structure:    
+ * L (interpolation factor), M (decimation factor), phaseLength (numTaps / L), pos (0), pCoeffs, pState.    
+ * Also set all of the values in pState to zero.    
+ *    
+ * \par    
+ * The instance structure is updated by the processing functions and so cannot be placed into a const data section.    
+ * The code below statically initializes each of the 3 different data type filter instance structures    
+ * <pre>    
+ * arm_fir_resample_instance_f32 S = {L, M, phaseLength, 0, pCoeffs, pState};    
+ * arm_fir_resample_instance_q31 S = {L, M, phaseLength, 0, pCoeffs, pState};    
+ * arm_fir_resample_instance_q15 S = {L, M, phaseLength, 0, pCoeffs, pState};    
+ * </pre>    
+ * Be sure to set the values in the state buffer to zeros when doing static initialization.    
+ *    
+ * \par Fixed-Point Behavior    
+ * Care must be taken when using the fixed-point versions of the FIR resampler functions.    
+ * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered.    
+ * Refer to the function specific documentation below for usage guidelines.    
+ */
+
+/**    
+ * @addtogroup FIR_Resample    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point FIR rational resampler.    
+ * @param[in,out] *S        points to an instance of the floating-point FIR resampler structure.    
+ * @param[in]     *pSrc     points to the block of input data.    
+ * @param[out]    *pDst     points to the block of output data.    
+ * @param[in]     blockSize number of input samples to process, at most the blockSize given to the initialization function.    
+ * @return        number of output samples written to <code>pDst</code>.    
+ */
+
+uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t sum0;                                /* Accumulator */
+  uint32_t L = S->L;                             /* Interpolation factor */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t stepN = S->M / L;                     /* Whole input samples advanced per output */
+  uint32_t stepP = S->M % L;                     /* Phases advanced per output */
+  uint32_t n, p;                                 /* Input sample and phase of the next output */
+  uint32_t outCnt = 0u;                          /* Number of outputs written */
+  uint32_t i, tapCnt;                            /* Loop counters */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1u);
+
+  /* Copy the new input samples into the state buffer */
+  i = blockSize;
+
+  while(i > 0u)
+  {
+    *pStateCurnt++ = *pSrc++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+
+  /* Split the position of the next output into input sample and phase */
+  n = S->pos / L;
+  p = S->pos % L;
+
+  /* Compute every output whose newest input sample is in this block */
+  while(n < blockSize)
+  {
+    /* Set accumulator to zero */
+    sum0 = 0.0f;
+
+    /* Oldest of the phaseLen samples x[n-phaseLen+1] ... x[n] */
+    px = pState + n;
+
+    /* Polyphase component p, walked from b[p+L*(phaseLen-1)] down to b[p] */
+    pb = pCoeffs + (L - 1u - p);
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Process 4 taps at a time. */
+    tapCnt = phaseLen >> 2u;
+
+    while(tapCnt > 0u)
+    {
+      sum0 += px[0] * pb[0];
+      sum0 += px[1] * pb[L];
+      sum0 += px[2] * pb[2u * L];
+      sum0 += px[3] * pb[3u * L];
+
+      px += 4u;
+      pb += 4u * L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the phase length is not a multiple of 4, compute the remaining taps */
+    tapCnt = phaseLen % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    tapCnt = phaseLen;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(tapCnt > 0u)
+    {
+      sum0 += *px++ * *pb;
+      pb += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* Store the result in the destination buffer */
+    *pDst++ = sum0;
+    outCnt++;
+
+    /* Advance to the next output: t += M */
+    n += stepN;
+    p += stepP;
+
+    if(p >= L)
+    {
+      p -= L;
+      n++;
+    }
+  }
+
+  /* Keep the position of the next output relative to the next block */
+  S->pos = ((n - blockSize) * L) + p;
+
+  /* Processing is complete.    
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.    
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* Points to the oldest sample the next call needs */
+  pState = pState + blockSize;
+
+  i = phaseLen - 1u;
+
+  /* Copy the data */
+  while(i > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+
+  return (outCnt);
+}
+
+/**    
+ * @} end of FIR_Resample group    
+ */
@@ -0,0 +1,205 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_fir_resample_q15.c   
+*    
+* Description:	Q15 FIR rational resampler    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup FIR_Resample    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the Q15 FIR rational resampler.    
+ * @param[in,out] *S        points to an instance of the Q15 FIR resampler structure.    
+ * @param[in]     *pSrc     points to the block of input data.    
+ * @param[out]    *pDst     points to the block of output data.    
+ * @param[in]     blockSize number of input samples to process, at most the blockSize given to the initialization function.    
+ * @return        number of output samples written to <code>pDst</code>.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The function is implemented using a 64-bit internal accumulator.    
+ * Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.    
+ * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.    
+ * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.    
+ * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.    
+ * Lastly, the accumulator is saturated to yield a result in 1.15 format.    
+ */
+
+uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+  q63_t sum0;                                    /* Accumulator */
+  uint32_t L = S->L;                             /* Interpolation factor */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t stepN = S->M / L;                     /* Whole input samples advanced per output */
+  uint32_t stepP = S->M % L;                     /* Phases advanced per output */
+  uint32_t n, p;                                 /* Input sample and phase of the next output */
+  uint32_t outCnt = 0u;                          /* Number of outputs written */
+  uint32_t i, tapCnt;                            /* Loop counters */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1u);
+
+  /* Copy the new input samples into the state buffer */
+  i = blockSize;
+
+  while(i > 0u)
+  {
+    *pStateCurnt++ = *pSrc++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+
+  /* Split the position of the next output into input sample and phase */
+  n = S->pos / L;
+  p = S->pos % L;
+
+  /* Compute every output whose newest input sample is in this block */
+  while(n < blockSize)
+  {
+    /* Set accumulator to zero */
+    sum0 = 0;
+
+    /* Oldest of the phaseLen samples x[n-phaseLen+1] ... x[n] */
+    px = pState + n;
+
+    /* Polyphase component p, walked from b[p+L*(phaseLen-1)] down to b[p] */
+    pb = pCoeffs + (L - 1u - p);
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Process 4 taps at a time. */
+    tapCnt = phaseLen >> 2u;
+
+    while(tapCnt > 0u)
+    {
+      sum0 += (q63_t) px[0] * pb[0];
+      sum0 += (q63_t) px[1] * pb[L];
+      sum0 += (q63_t) px[2] * pb[2u * L];
+      sum0 += (q63_t) px[3] * pb[3u * L];
+
+      px += 4u;
+      pb += 4u * L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the phase length is not a multiple of 4, compute the remaining taps */
+    tapCnt = phaseLen % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    tapCnt = phaseLen;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(tapCnt > 0u)
+    {
+      sum0 += (q63_t) *px++ * *pb;
+      pb += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* Store the result in the destination buffer */
+    *pDst++ = (q15_t) (__SSAT((sum0 >> 15), 16));
+    outCnt++;
+
+    /* Advance to the next output: t += M */
+    n += stepN;
+    p += stepP;
+
+    if(p >= L)
+    {
+      p -= L;
+      n++;
+    }
+  }
+
+  /* Keep the position of the next output relative to the next block */
+  S->pos = ((n - blockSize) * L) + p;
+
+  /* Processing is complete.    
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.    
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* Points to the oldest sample the next call needs */
+  pState = pState + blockSize;
+
+  i = phaseLen - 1u;
+
+  /* Copy the data */
+  while(i > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+
+  return (outCnt);
+}
+
+/**    
+ * @} end of FIR_Resample group    
+ */
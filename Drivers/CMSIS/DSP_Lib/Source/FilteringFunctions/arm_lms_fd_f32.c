@@ -0,0 +1,418 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_lms_fd_f32.c   
+*    
+* Description:	Floating-point partitioned frequency-domain block LMS filter    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @defgroup LMS_FD Partitioned Frequency-Domain Block LMS Filter    
+ *    
+ * This function implements the same adaptive filter as the normalized LMS filter functions, an FIR filter    
+ * whose coefficients are adapted so that its output follows the reference input, but for long filters such    
+ * as acoustic echo paths of a thousand taps and more.  A time domain normalized LMS filter costs about    
+ * <code>2*numTaps</code> multiply-accumulates per sample; here filtering and coefficient update are done    
+ * a block of <code>P</code> samples at a time in the frequency domain (partitioned block frequency-domain    
+ * adaptive filter, PBFDAF).    
+ *    
+ * \par Algorithm    
+ * The filter is cut into <code>K = numTaps/P</code> partitions of <code>P</code> taps (rounded up), each held as    
+ * a <code>2*P</code> point spectrum <code>W_k</code> in the packed format of <code>arm_rfft_fast_f32()</code>.    
+ * For every block of <code>P</code> input samples:    
+ * <pre>    
+ *    X_0  = FFT(last 2*P input samples)                 the older spectra X_1 ... X_K-1 are kept from earlier blocks    
+ *    y    = last P samples of IFFT(sum(k) W_k * X_k)    overlap-save, pOut    
+ *    e    = ref - y                                     pErr    
+ *    E    = FFT(P zeros, e)    
+ *    pw   = beta * pw + (1 - beta) * |X_0|^2            per bin, beta = ARM_LMS_FD_POW_BETA    
+ *    W_k += 2*mu/K * conj(X_k) * E / (pw + delta)       k = 0 ... K-1    
+ * </pre>    
+ * Dividing by the smoothed power of each bin gives every frequency its own step size, so coloured input such    
+ * as speech converges about as fast as white noise.  <code>delta</code> is <code>ARM_LMS_FD_REG</code> times the    
+ * mean bin power plus a small constant, which keeps the step of bins with little input power bounded.  With this    
+ * scaling <code>mu</code> has the meaning of the step size of <code>arm_lms_norm_f32()</code>: values from about    
+ * 0.1 to 1 are useful, larger values converge faster and leave more misadjustment.    
+ *    
+ * \par Gradient constraint    
+ * A partition spectrum only stands for <code>P</code> taps while its time domain second half is zero.  The update    
+ * above does not keep it so; the constraint transforms a partition to the time domain, clears the second half and    
+ * transforms it back, two more FFTs per partition.  <code>numConstrain</code> partitions are constrained per block    
+ * in turn (alternating constraint).  <code>numConstrain = K</code> is the exact constrained PBFDAF at    
+ * <code>3 + 2*K</code> FFTs per block.  <code>numConstrain = 1</code> costs 5 FFTs per block independently of the    
+ * filter length and converges as well up to <code>mu</code> = 0.5; above that it leaves a few dB more    
+ * misadjustment.  <code>numConstrain = 0</code> is the unconstrained filter, which converges to a clearly worse    
+ * solution and becomes unstable at smaller step sizes.    
+ *    
+ * \par Cost and latency    
+ * A block costs <code>3 + 2*numConstrain</code> real FFTs of <code>2*P</code> points and about    
+ * <code>16*numTaps</code> floating-point operations for the products with the partition spectra, against    
+ * <code>2*numTaps</code> multiply-accumulates per sample of <code>arm_lms_norm_f32()</code>.  For 1024 taps,    
+ * <code>P</code> = 128 and one constrained partition per block that is more than an order of magnitude less work.    
+ * Larger blocks are cheaper, but the coefficients are only updated once per block, and the output of a block is    
+ * only available once the whole block has been read.    
+ *    
+ * \par    
+ * <code>pState</code> points to one buffer that holds the input history, the partition spectra, the delay line    
+ * of input spectra, the bin powers and the FFT work space.  Its length is returned by the initialization function    
+ * in <code>stateLen</code> of the instance.  The spectra are read once per block in sequential order, so the buffer    
+ * may be placed in SDRAM for long filters.    
+ *    
+ * \par Instance Structure    
+ * The sizes, the step size, the FFT instance and the pointers into the state buffer are stored in an instance data    
+ * structure.  A separate instance structure must be defined for each filter.    
+ * The instance structure cannot be initialized statically, <code>arm_lms_fd_init_f32()</code> must be used.    
+ */
+
+/**    
+ * @addtogroup LMS_FD    
+ * @{    
+ */
+
+/*    
+ * acc += a * b over the bins of two spectra in the packed format of arm_rfft_fast_f32:    
+ * DC and Nyquist are real and stored in the first pair, the other bins are complex.    
+ */
+static void arm_lms_fd_cmac_f32(
+  const float32_t * pA,
+  const float32_t * pB,
+  float32_t * pAcc,
+  uint32_t numBins)
+{
+  float32_t ar, ai, br, bi;
+  uint32_t blkCnt;
+
+  pAcc[0] += pA[0] * pB[0];
+  pAcc[1] += pA[1] * pB[1];
+  pA += 2u;
+  pB += 2u;
+  pAcc += 2u;
+  numBins--;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Loop unrolling */
+  blkCnt = numBins >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    ar = pA[0];
+    ai = pA[1];
+    br = pB[0];
+    bi = pB[1];
+    pAcc[0] += ar * br - ai * bi;
+    pAcc[1] += ar * bi + ai * br;
+
+    ar = pA[2];
+    ai = pA[3];
+    br = pB[2];
+    bi = pB[3];
+    pAcc[2] += ar * br - ai * bi;
+    pAcc[3] += ar * bi + ai * br;
+
+    pA += 4u;
+    pB += 4u;
+    pAcc += 4u;
+
+    blkCnt--;
+  }
+
+  blkCnt = numBins % 0x2u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = numBins;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    ar = pA[0];
+    ai = pA[1];
+    br = pB[0];
+    bi = pB[1];
+    pAcc[0] += ar * br - ai * bi;
+    pAcc[1] += ar * bi + ai * br;
+
+    pA += 2u;
+    pB += 2u;
+    pAcc += 2u;
+
+    blkCnt--;
+  }
+}
+
+/* acc += conj(x) * e, in the same packed format */
+static void arm_lms_fd_cmac_conj_f32(
+  const float32_t * pX,
+  const float32_t * pE,
+  float32_t * pAcc,
+  uint32_t numBins)
+{
+  float32_t xr, xi, er, ei;
+  uint32_t blkCnt;
+
+  pAcc[0] += pX[0] * pE[0];
+  pAcc[1] += pX[1] * pE[1];
+  pX += 2u;
+  pE += 2u;
+  pAcc += 2u;
+  numBins--;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Loop unrolling */
+  blkCnt = numBins >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    xr = pX[0];
+    xi = pX[1];
+    er = pE[0];
+    ei = pE[1];
+    pAcc[0] += xr * er + xi * ei;
+    pAcc[1] += xr * ei - xi * er;
+
+    xr = pX[2];
+    xi = pX[3];
+    er = pE[2];
+    ei = pE[3];
+    pAcc[2] += xr * er + xi * ei;
+    pAcc[3] += xr * ei - xi * er;
+
+    pX += 4u;
+    pE += 4u;
+    pAcc += 4u;
+
+    blkCnt--;
+  }
+
+  blkCnt = numBins % 0x2u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = numBins;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    xr = pX[0];
+    xi = pX[1];
+    er = pE[0];
+    ei = pE[1];
+    pAcc[0] += xr * er + xi * ei;
+    pAcc[1] += xr * ei - xi * er;
+
+    pX += 2u;
+    pE += 2u;
+    pAcc += 2u;
+
+    blkCnt--;
+  }
+}
+
+/*    
+ * Updates the smoothed bin powers with the newest input spectrum and scales the error    
+ * spectrum by the step size of every bin.  The powers are stored per bin, DC first and Nyquist last.    
+ */
+static void arm_lms_fd_step_f32(
+  arm_lms_fd_instance_f32 * S,
+  const float32_t * pX,
+  float32_t * pE)
+{
+  float32_t *pPow = S->pPow;                     /*  smoothed bin powers                   */
+  float32_t beta = ARM_LMS_FD_POW_BETA;          /*  power smoothing factor                */
+  float32_t c = 2.0f * S->mu / (float32_t) S->numParts;   /*  step scale                   */
+  float32_t re, im, pw, sum = 0.0f, delta;
+  uint32_t P = S->blockSize;
+  uint32_t k;
+
+  /* The first block, or the first after silence, starts the average instead of being smoothed into it */
+  if(S->powMean == 0.0f)
+  {
+    beta = 0.0f;
+  }
+
+  pw = beta * pPow[0] + (1.0f - beta) * (pX[0] * pX[0]);
+  pPow[0] = pw;
+  sum += pw;
+  pw = beta * pPow[P] + (1.0f - beta) * (pX[1] * pX[1]);
+  pPow[P] = pw;
+  sum += pw;
+
+  for(k = 1u; k < P; k++)
+  {
+    re = pX[2u * k];
+    im = pX[2u * k + 1u];
+    pw = beta * pPow[k] + (1.0f - beta) * (re * re + im * im);
+    pPow[k] = pw;
+    sum += pw;
+  }
+
+  S->powMean = sum / (float32_t) (P + 1u);
+
+  /* epsilon value 0.000000119209289f as in arm_lms_norm_f32 */
+  delta = ARM_LMS_FD_REG * S->powMean + 0.000000119209289f;
+
+  pE[0] *= c / (pPow[0] + delta);
+  pE[1] *= c / (pPow[P] + delta);
+
+  for(k = 1u; k < P; k++)
+  {
+    pw = c / (pPow[k] + delta);
+    pE[2u * k] *= pw;
+    pE[2u * k + 1u] *= pw;
+  }
+}
+
+/**    
+ * @brief Processing function for the floating-point partitioned frequency-domain block LMS filter.    
+ * @param[in,out] *S          points to an instance of the floating-point frequency-domain LMS filter structure.    
+ * @param[in]     *pSrc       points to the block of input data.    
+ * @param[in]     *pRef       points to the block of reference data.    
+ * @param[out]    *pOut       points to the block of output data.    
+ * @param[out]    *pErr       points to the block of error data.    
+ * @param[in]     blockSize   number of samples to process, a multiple of the blockSize given to the initialization function.    
+ * @return none.    
+ */
+
+void arm_lms_fd_f32(
+  arm_lms_fd_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize)
+{
+  uint32_t P = S->blockSize;                     /*  block and partition length            */
+  uint32_t len = 2u * P;                         /*  FFT length                            */
+  uint32_t K = S->numParts;                      /*  number of partitions                  */
+  uint32_t tail = S->numTaps - (K - 1u) * P;     /*  taps of the last partition            */
+  float32_t *pHist = S->pHist;                   /*  last 2*P input samples                */
+  float32_t *pWork = S->pWork;                   /*  normalized error spectrum             */
+  float32_t *pAcc = S->pAcc;                     /*  spectrum accumulator                  */
+  float32_t *pTmp = S->pTmp;                     /*  FFT input and output                  */
+  float32_t *pW;
+  uint32_t k, slot, con, i;
+  float32_t y;
+
+  for(; blockSize >= P; blockSize -= P)
+  {
+    /* Newest input spectrum into the delay line */
+    memmove(pHist, pHist + P, P * sizeof(float32_t));
+    memcpy(pHist + P, pSrc, P * sizeof(float32_t));
+
+    S->fdlPos = (S->fdlPos == 0u) ? (uint16_t) (K - 1u) : (uint16_t) (S->fdlPos - 1u);
+    memcpy(pTmp, pHist, len * sizeof(float32_t));
+    arm_rfft_fast_f32(&S->rfft, pTmp, S->pFdl + S->fdlPos * len, 0u);
+
+    /* Filter output: partition k is applied to the spectrum that is k blocks old */
+    memset(pAcc, 0, len * sizeof(float32_t));
+    slot = S->fdlPos;
+
+    for(k = 0u; k < K; k++)
+    {
+      arm_lms_fd_cmac_f32(S->pCoeffs + k * len, S->pFdl + slot * len, pAcc, P);
+      slot = (slot + 1u == K) ? 0u : (slot + 1u);
+    }
+
+    /* Overlap-save: the last half of the circular convolution is the output, the error goes into
+       the last half of the error frame */
+    arm_rfft_fast_f32(&S->rfft, pAcc, pTmp, 1u);
+    memset(pAcc, 0, P * sizeof(float32_t));
+
+    for(i = 0u; i < P; i++)
+    {
+      y = pTmp[P + i];
+      pAcc[P + i] = pRef[i] - y;
+      pOut[i] = y;
+    }
+
+    memcpy(pErr, pAcc + P, P * sizeof(float32_t));
+    arm_rfft_fast_f32(&S->rfft, pAcc, pWork, 0u);
+
+    arm_lms_fd_step_f32(S, S->pFdl + S->fdlPos * len, pWork);
+
+    /* Coefficient update */
+    slot = S->fdlPos;
+
+    for(k = 0u; k < K; k++)
+    {
+      arm_lms_fd_cmac_conj_f32(S->pFdl + slot * len, pWork, S->pCoeffs + k * len, P);
+      slot = (slot + 1u == K) ? 0u : (slot + 1u);
+    }
+
+    /* Constraint of numConstrain partitions in turn: to the time domain, taps past the partition
+       cleared, and back */
+    k = S->conPos;
+
+    for(con = 0u; con < S->numConstrain; con++)
+    {
+      pW = S->pCoeffs + k * len;
+      memcpy(pAcc, pW, len * sizeof(float32_t));
+      arm_rfft_fast_f32(&S->rfft, pAcc, pTmp, 1u);
+      i = (k + 1u == K) ? tail : P;
+      memset(pTmp + i, 0, (len - i) * sizeof(float32_t));
+      arm_rfft_fast_f32(&S->rfft, pTmp, pW, 0u);
+      k = (k + 1u == K) ? 0u : (k + 1u);
+    }
+
+    S->conPos = (uint16_t) k;
+
+    pSrc += P;
+    pRef += P;
+    pOut += P;
+    pErr += P;
+  }
+}
+
+/**    
+ * @} end of LMS_FD group    
+ */
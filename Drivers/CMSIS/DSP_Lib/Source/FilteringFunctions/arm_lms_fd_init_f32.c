@@ -0,0 +1,172 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_lms_fd_init_f32.c   
+*    
+* Description:	Floating-point partitioned frequency-domain block LMS filter initialization function    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup LMS_FD    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point partitioned frequency-domain block LMS filter.    
+ * @param[in,out] *S            points to an instance of the floating-point frequency-domain LMS filter structure.    
+ * @param[in]     numTaps       number of filter coefficients in the filter.    
+ * @param[in]     *pCoeffs      points to the initial filter coefficients, NULL to start from zero.    
+ * @param[in]     *pState       points to the state buffer.    
+ * @param[in]     stateLen      length of the state buffer in words.    
+ * @param[in]     blockSize     number of samples processed at a time and length of the partitions, a power of 2 from 16 to 2048.    
+ * @param[in]     mu            step size that controls filter coefficient updates.    
+ * @param[in]     numConstrain  number of partitions whose gradient is constrained per block, 0 to the number of partitions.    
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful,    
+ * ARM_MATH_ARGUMENT_ERROR if <code>blockSize</code> or <code>numConstrain</code> is not supported or    
+ * ARM_MATH_LENGTH_ERROR if the state buffer is too small.    
+ *    
+ * <b>Description:</b>    
+ * \par    
+ * <code>pCoeffs</code> points to an array of <code>numTaps</code> initial coefficients stored in time reversed order    
+ * as for <code>arm_lms_norm_f32()</code>:    
+ * <pre>    
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}    
+ * </pre>    
+ * It is only read here.  The filter has <code>(numTaps + blockSize - 1) / blockSize</code> partitions.    
+ * \par    
+ * The length of the state buffer needed, <code>(4*K + 9)*blockSize + 1</code> words for <code>K</code> partitions,    
+ * is written to <code>S->stateLen</code> before the length is checked, so a first call with <code>stateLen</code> 0    
+ * returns ARM_MATH_LENGTH_ERROR and the length to allocate.  The state buffer is cleared.    
+ */
+
+arm_status arm_lms_fd_init_f32(
+  arm_lms_fd_instance_f32 * S,
+  uint32_t numTaps,
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t stateLen,
+  uint16_t blockSize,
+  float32_t mu,
+  uint16_t numConstrain)
+{
+  uint32_t P = blockSize, len = 2u * blockSize;
+  uint32_t K, need, k, j, n;
+  float32_t *p;
+
+  if((blockSize < 16u) || (blockSize > 2048u) || ((blockSize & (blockSize - 1u)) != 0u) ||
+     (numTaps == 0u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  K = (numTaps + P - 1u) / P;
+
+  if((K > 0xFFFFu) || (numConstrain > K))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numTaps = numTaps;
+  S->blockSize = blockSize;
+  S->numParts = (uint16_t) K;
+  S->numConstrain = numConstrain;
+  S->fdlPos = 0u;
+  S->conPos = 0u;
+  S->mu = mu;
+  S->powMean = 0.0f;
+
+  /* Input history, three FFT buffers, partition spectra, delay line of input spectra and P+1 bin powers */
+  need = 8u * P + 4u * K * P + P + 1u;
+  S->stateLen = need;
+
+  if(stateLen < need)
+  {
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  arm_rfft_fast_init_f32(&S->rfft, (uint16_t) len);
+
+  memset(pState, 0, need * sizeof(float32_t));
+
+  p = pState;
+  S->pHist = p;
+  p += len;
+  S->pWork = p;
+  p += len;
+  S->pAcc = p;
+  p += len;
+  S->pTmp = p;
+  p += len;
+  S->pCoeffs = p;
+  p += K * len;
+  S->pFdl = p;
+  p += K * len;
+  S->pPow = p;
+
+  if(pCoeffs != NULL)
+  {
+    /* Partition k holds b[k*P + j], zero padded to 2*P, as a spectrum */
+    for(k = 0u; k < K; k++)
+    {
+      memset(S->pTmp, 0, len * sizeof(float32_t));
+
+      for(j = 0u; j < P; j++)
+      {
+        n = k * P + j;
+
+        if(n < numTaps)
+        {
+          S->pTmp[j] = pCoeffs[numTaps - 1u - n];
+        }
+      }
+
+      arm_rfft_fast_f32(&S->rfft, S->pTmp, S->pCoeffs + k * len, 0u);
+    }
+
+    memset(S->pTmp, 0, len * sizeof(float32_t));
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of LMS_FD group    
+ */
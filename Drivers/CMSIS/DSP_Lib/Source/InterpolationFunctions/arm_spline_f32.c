@@ -0,0 +1,181 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_spline_f32.c   
+*    
+* Description:	Floating-point cubic spline interpolation    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupInterpolation    
+ */
+
+/**    
+ * @addtogroup Spline    
+ * @{    
+ */
+
+/**    
+ * @brief  Finds the segment i with pX[i] <= x < pX[i+1], given pX[lo] <= x < pX[hi].    
+ */
+
+static __INLINE uint32_t arm_spline_search_f32(
+  const float32_t * pX,
+  uint32_t lo,
+  uint32_t hi,
+  float32_t x)
+{
+  uint32_t mid;
+
+  while((hi - lo) > 1u)
+  {
+    mid = (lo + hi) >> 1u;
+    if(x < pX[mid])
+    {
+      hi = mid;
+    }
+    else
+    {
+      lo = mid;
+    }
+  }
+
+  return (lo);
+}
+
+/**    
+ * @brief  Processing function for the floating-point cubic spline.    
+ * @param[in]  *S         points to an instance of the floating-point spline structure.    
+ * @param[in]  *pSrc      points to the block of input abscissas.    
+ * @param[out] *pDst      points to the block of output values.    
+ * @param[in]  blockSize  number of samples to process.    
+ * @return none.    
+ *    
+ * \par    
+ * Inputs below the first knot return the first table value and inputs above the last knot the last    
+ * table value, as with <code>arm_linear_interp_f32()</code>.    
+ */
+
+void arm_spline_f32(
+  const arm_spline_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  const float32_t *pX = S->pX;                   /* knots */
+  const float32_t *pY = S->pY;                   /* values at the knots */
+  const float32_t *pC;                           /* coefficients of the segment */
+  uint32_t n1 = S->nValues - 1u;                 /* number of segments */
+  float32_t x, t;                                /* input, abscissa within the segment */
+  float32_t xLo, xHi;                            /* first and last knot */
+  float32_t inv;                                 /* 1 / xSpacing */
+  uint32_t i = 0u;                               /* segment index */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  if(pX == NULL)
+  {
+    /* Uniform grid: the segment follows from the input without a search */
+    xLo = S->x1;
+    xHi = (float32_t) n1;
+    inv = 1.0f / S->xSpacing;
+
+    while(blkCnt > 0u)
+    {
+      t = (*pSrc++ - xLo) * inv;
+
+      if(t <= 0.0f)
+      {
+        *pDst++ = pY[0];
+      }
+      else if(t >= xHi)
+      {
+        *pDst++ = pY[n1];
+      }
+      else
+      {
+        i = (uint32_t) t;
+        t -= (float32_t) i;
+        pC = S->pCoeffs + (3u * i);
+        *pDst++ = pY[i] + t * (pC[0] + t * (pC[1] + t * pC[2]));
+      }
+
+      blkCnt--;
+    }
+  }
+  else
+  {
+    /* Arbitrary knots: start at the segment of the previous input, which covers ascending */
+    /* inputs with one or two compares, and search the table otherwise */
+    xLo = pX[0];
+    xHi = pX[n1];
+
+    while(blkCnt > 0u)
+    {
+      x = *pSrc++;
+
+      if(x <= xLo)
+      {
+        *pDst++ = pY[0];
+      }
+      else if(x >= xHi)
+      {
+        *pDst++ = pY[n1];
+      }
+      else
+      {
+        if(x < pX[i])
+        {
+          i = arm_spline_search_f32(pX, 0u, i, x);
+        }
+        else if(x >= pX[i + 1u])
+        {
+          /* x < pX[n1], so pX[i + 2] exists */
+          i = (x < pX[i + 2u]) ? (i + 1u) : arm_spline_search_f32(pX, i + 2u, n1, x);
+        }
+
+        t = x - pX[i];
+        pC = S->pCoeffs + (3u * i);
+        *pDst++ = pY[i] + t * (pC[0] + t * (pC[1] + t * pC[2]));
+      }
+
+      blkCnt--;
+    }
+  }
+}
+
+/**    
+ * @} end of Spline group    
+ */
@@ -0,0 +1,181 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_spline_init_f32.c   
+*    
+* Description:	Floating-point cubic spline initialization function    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupInterpolation    
+ */
+
+/**    
+ * @addtogroup Spline    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point cubic spline.    
+ * @param[out] *S         points to an instance of the floating-point spline structure.    
+ * @param[in]  *pX        points to the knots, nValues strictly ascending values, or NULL for a uniform grid.    
+ * @param[in]  x1         first knot of a uniform grid, ignored with pX.    
+ * @param[in]  xSpacing   knot spacing of a uniform grid, ignored with pX.    
+ * @param[in]  *pY        points to the values at the knots, nValues values.    
+ * @param[in]  nValues    number of knots, at least 2.    
+ * @param[in]  *pSlopes   points to the first derivatives dy/dx at the first and the last knot, or NULL for a natural spline.    
+ * @param[out] *pCoeffs   points to the coefficient buffer, 3*(nValues-1) values.    
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>nValues</code> is less than 2,    
+ * the knots are not strictly ascending or <code>xSpacing</code> is not positive.    
+ *    
+ * \par Description:    
+ * \par    
+ * The second derivatives at the knots are found by solving the tridiagonal spline system with the Thomas    
+ * algorithm.  The forward sweep is kept in the coefficient buffer, so no scratch memory is needed, and the    
+ * back substitution turns it into the polynomial of every segment.  <code>pX</code>, <code>pY</code> and    
+ * <code>pSlopes</code> are not modified; <code>pX</code> and <code>pY</code> must stay valid while the    
+ * instance is in use and may be placed in flash.    
+ */
+
+arm_status arm_spline_init_f32(
+  arm_spline_instance_f32 * S,
+  const float32_t * pX,
+  float32_t x1,
+  float32_t xSpacing,
+  const float32_t * pY,
+  uint32_t nValues,
+  const float32_t * pSlopes,
+  float32_t * pCoeffs)
+{
+  float32_t h0, h1;                              /* lengths of the segments left and right of a knot */
+  float32_t s0, s1;                              /* chord slopes of the segments left and right of a knot */
+  float32_t cp, dp;                              /* forward sweep: reduced upper diagonal and right hand side */
+  float32_t den;                                 /* pivot of the reduced row */
+  float32_t m0, m1;                              /* second derivatives at both ends of a segment */
+  float32_t c, d;                                /* polynomial coefficients */
+  uint32_t i, n1 = nValues - 1u;                 /* loop counter, number of segments */
+
+  if((nValues < 2u) || ((pX == NULL) && !(xSpacing > 0.0f)))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  if(pX != NULL)
+  {
+    for (i = 0u; i < n1; i++)
+    {
+      if(!(pX[i + 1u] > pX[i]))
+      {
+        return (ARM_MATH_ARGUMENT_ERROR);
+      }
+    }
+  }
+
+  /* On a uniform grid the polynomials are in the normalized abscissa u = (x - x1) / xSpacing - i, */
+  /* which is the spline with unit spacing and the end slopes scaled by xSpacing */
+  h1 = (pX != NULL) ? (pX[1] - pX[0]) : 1.0f;
+  s1 = (pY[1] - pY[0]) / h1;
+
+  /* First row: M[0] = 0, or 2 h[0] M[0] + h[0] M[1] = 6 (s[0] - y'[0]) */
+  if(pSlopes != NULL)
+  {
+    cp = 0.5f;
+    dp = 3.0f * (s1 - ((pX != NULL) ? pSlopes[0] : pSlopes[0] * xSpacing)) / h1;
+  }
+  else
+  {
+    cp = 0.0f;
+    dp = 0.0f;
+  }
+  pCoeffs[1] = cp;
+  pCoeffs[2] = dp;
+
+  /* Inner rows: h[i-1] M[i-1] + 2 (h[i-1] + h[i]) M[i] + h[i] M[i+1] = 6 (s[i] - s[i-1]) */
+  for (i = 1u; i < n1; i++)
+  {
+    h0 = h1;
+    s0 = s1;
+    h1 = (pX != NULL) ? (pX[i + 1u] - pX[i]) : 1.0f;
+    s1 = (pY[i + 1u] - pY[i]) / h1;
+
+    den = 2.0f * (h0 + h1) - h0 * cp;
+    cp = h1 / den;
+    dp = (6.0f * (s1 - s0) - h0 * dp) / den;
+    pCoeffs[(3u * i) + 1u] = cp;
+    pCoeffs[(3u * i) + 2u] = dp;
+  }
+
+  /* Last row: M[n-1] = 0, or h[n-2] M[n-2] + 2 h[n-2] M[n-1] = 6 (y'[n-1] - s[n-2]) */
+  if(pSlopes != NULL)
+  {
+    m1 = (6.0f * (((pX != NULL) ? pSlopes[1] : pSlopes[1] * xSpacing) - s1) - h1 * dp) / (h1 * (2.0f - cp));
+  }
+  else
+  {
+    m1 = 0.0f;
+  }
+
+  /* Back substitution from the last segment to the first, which overwrites the sweep with */
+  /* y = y[i] + t * (b + t * (c + t * d)), t = x - x[i] (or u on a uniform grid) */
+  i = n1;
+  while(i > 0u)
+  {
+    i--;
+    m0 = pCoeffs[(3u * i) + 2u] - pCoeffs[(3u * i) + 1u] * m1;
+
+    h1 = (pX != NULL) ? (pX[i + 1u] - pX[i]) : 1.0f;
+    c = 0.5f * m0;
+    d = (m1 - m0) / (6.0f * h1);
+    pCoeffs[3u * i] = (pY[i + 1u] - pY[i]) / h1 - h1 * (c + d * h1);
+    pCoeffs[(3u * i) + 1u] = c;
+    pCoeffs[(3u * i) + 2u] = d;
+
+    m1 = m0;
+  }
+
+  S->nValues = nValues;
+  S->pX = pX;
+  S->pY = pY;
+  S->x1 = x1;
+  S->xSpacing = xSpacing;
+  S->pCoeffs = pCoeffs;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of Spline group    
+ */
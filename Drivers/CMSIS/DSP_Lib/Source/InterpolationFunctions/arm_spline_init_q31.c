@@ -0,0 +1,247 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_spline_init_q31.c   
+*    
+* Description:	Q31 cubic spline initialization function    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupInterpolation    
+ */
+
+/**    
+ * @addtogroup Spline    
+ * @{    
+ */
+
+/**    
+ * @brief  Length of segment i in Q31 units.    
+ */
+
+static __INLINE float32_t arm_spline_len_q31(
+  const q31_t * pX,
+  uint8_t log2Spacing,
+  uint32_t i)
+{
+  return ((pX != NULL) ? (float32_t) ((uint32_t) pX[i + 1u] - (uint32_t) pX[i]) : (float32_t) (1u << log2Spacing));
+}
+
+/**    
+ * @brief  Initialization function for the Q31 cubic spline.    
+ * @param[out] *S           points to an instance of the Q31 spline structure.    
+ * @param[in]  *pX          points to the knots, nValues strictly ascending values, or NULL for a uniform grid.    
+ * @param[in]  x1           first knot of a uniform grid, ignored with pX.    
+ * @param[in]  log2Spacing  knot spacing of a uniform grid is 2^log2Spacing in Q31 units, 0 to 31, ignored with pX.    
+ * @param[in]  *pY          points to the values at the knots, nValues values.    
+ * @param[in]  nValues      number of knots, at least 2.    
+ * @param[in]  *pSlopes     points to the first derivatives dy/dx in 8.24 format at the first and the last knot, or NULL for a natural spline.    
+ * @param[out] *pCoeffs     points to the coefficient buffer, 3*(nValues-1) values on a uniform grid, 4*(nValues-1) values with pX.    
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>nValues</code> is less than 2,    
+ * the knots are not strictly ascending or the uniform grid does not fit in the Q31 range.    
+ *    
+ * \par Description:    
+ * \par    
+ * The spline system is solved in single precision in the coefficient buffer, as by <code>arm_spline_init_f32()</code>.    
+ * The polynomials are stored in the abscissa u in [0, 1) of each segment with a common format 1.31 - postShift,    
+ * where <code>postShift</code> is the smallest shift that holds every coefficient and partial sum.  The linear    
+ * coefficient is taken from the exact table difference, so every segment ends on the next table value.  With    
+ * arbitrary knots the fourth value of a segment is the normalized reciprocal of its length, which replaces the    
+ * division by a multiplication in <code>arm_spline_q31()</code>.    
+ */
+
+arm_status arm_spline_init_q31(
+  arm_spline_instance_q31 * S,
+  const q31_t * pX,
+  q31_t x1,
+  uint8_t log2Spacing,
+  const q31_t * pY,
+  uint32_t nValues,
+  const q31_t * pSlopes,
+  q31_t * pCoeffs)
+{
+  float32_t *pTmp = (float32_t *) pCoeffs;       /* forward sweep and second derivatives */
+  float32_t h0, h1;                              /* lengths of the segments left and right of a knot */
+  float32_t s0, s1;                              /* chord slopes of the segments left and right of a knot */
+  float32_t cp, dp;                              /* forward sweep: reduced upper diagonal and right hand side */
+  float32_t den;                                 /* pivot of the reduced row */
+  float32_t m0, m1, mN;                          /* second derivatives */
+  float32_t b, c, d;                             /* polynomial coefficients in Q31 units */
+  float32_t mag, sum = 0.0f;                     /* sum of coefficient magnitudes, largest sum */
+  float32_t bound, scale;                        /* range and scale of the common format */
+  q63_t qb, qc, qd;                              /* polynomial coefficients in 1.31 - postShift format */
+  uint64_t rcp;                                  /* 2^63 / normalized segment length */
+  uint32_t hq;                                   /* segment length */
+  uint32_t i, n1 = nValues - 1u;                 /* loop counter, number of segments */
+  uint32_t step = (pX != NULL) ? 4u : 3u;        /* values per segment */
+  uint32_t shift;                                /* postShift */
+
+  if(nValues < 2u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  if(pX != NULL)
+  {
+    for (i = 0u; i < n1; i++)
+    {
+      if(pX[i + 1u] <= pX[i])
+      {
+        return (ARM_MATH_ARGUMENT_ERROR);
+      }
+    }
+  }
+  else if((log2Spacing > 31u) || (((q63_t) x1 + ((q63_t) n1 << log2Spacing)) > (q63_t) 0x7FFFFFFF))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* The system is set up in Q31 units of x and y, in which the slopes need no scaling */
+  h1 = arm_spline_len_q31(pX, log2Spacing, 0u);
+  s1 = (float32_t) ((q63_t) pY[1] - pY[0]) / h1;
+
+  /* First row: M[0] = 0, or 2 h[0] M[0] + h[0] M[1] = 6 (s[0] - y'[0]) */
+  if(pSlopes != NULL)
+  {
+    cp = 0.5f;
+    dp = 3.0f * (s1 - (float32_t) pSlopes[0] / 16777216.0f) / h1;
+  }
+  else
+  {
+    cp = 0.0f;
+    dp = 0.0f;
+  }
+  pTmp[1] = cp;
+  pTmp[2] = dp;
+
+  /* Inner rows: h[i-1] M[i-1] + 2 (h[i-1] + h[i]) M[i] + h[i] M[i+1] = 6 (s[i] - s[i-1]) */
+  for (i = 1u; i < n1; i++)
+  {
+    h0 = h1;
+    s0 = s1;
+    h1 = arm_spline_len_q31(pX, log2Spacing, i);
+    s1 = (float32_t) ((q63_t) pY[i + 1u] - pY[i]) / h1;
+
+    den = 2.0f * (h0 + h1) - h0 * cp;
+    cp = h1 / den;
+    dp = (6.0f * (s1 - s0) - h0 * dp) / den;
+    pTmp[(step * i) + 1u] = cp;
+    pTmp[(step * i) + 2u] = dp;
+  }
+
+  /* Last row: M[n-1] = 0, or h[n-2] M[n-2] + 2 h[n-2] M[n-1] = 6 (y'[n-1] - s[n-2]) */
+  if(pSlopes != NULL)
+  {
+    mN = (6.0f * ((float32_t) pSlopes[1] / 16777216.0f - s1) - h1 * dp) / (h1 * (2.0f - cp));
+  }
+  else
+  {
+    mN = 0.0f;
+  }
+
+  /* Back substitution, keeping M[i] in the first value of segment i and the */
+  /* largest coefficient sum, which sets the common format */
+  m1 = mN;
+  i = n1;
+  while(i > 0u)
+  {
+    i--;
+    m0 = pTmp[(step * i) + 2u] - pTmp[(step * i) + 1u] * m1;
+    pTmp[step * i] = m0;
+
+    h1 = arm_spline_len_q31(pX, log2Spacing, i);
+    c = 0.5f * h1 * h1 * m0;
+    d = h1 * h1 * (m1 - m0) / 6.0f;
+    b = (float32_t) ((q63_t) pY[i + 1u] - pY[i]) - c - d;
+
+    mag = fabsf(b) + fabsf(c) + fabsf(d);
+    if(mag > sum)
+    {
+      sum = mag;
+    }
+
+    m1 = m0;
+  }
+
+  shift = 0u;
+  bound = 0.99f * 2147483648.0f;
+  while((sum >= bound) && (shift < 31u))
+  {
+    bound *= 2.0f;
+    shift++;
+  }
+  scale = 1.0f / (float32_t) (1u << shift);
+
+  /* Polynomials in u: y = y[i] + u * (b + u * (c + u * d)) */
+  for (i = 0u; i < n1; i++)
+  {
+    m0 = pTmp[step * i];
+    m1 = ((i + 1u) < n1) ? pTmp[step * (i + 1u)] : mN;
+
+    h1 = arm_spline_len_q31(pX, log2Spacing, i);
+    c = 0.5f * h1 * h1 * m0 * scale;
+    d = h1 * h1 * (m1 - m0) / 6.0f * scale;
+    qc = (q63_t) (c + ((c < 0.0f) ? -0.5f : 0.5f));
+    qd = (q63_t) (d + ((d < 0.0f) ? -0.5f : 0.5f));
+    qb = ((((q63_t) pY[i + 1u] - pY[i]) + ((q63_t) (1u << shift) >> 1)) >> shift) - qc - qd;
+
+    pCoeffs[step * i] = clip_q63_to_q31(qb);
+    pCoeffs[(step * i) + 1u] = clip_q63_to_q31(qc);
+    pCoeffs[(step * i) + 2u] = clip_q63_to_q31(qd);
+
+    if(pX != NULL)
+    {
+      /* u = ((x - x[i]) << clz(h)) * rcp / 2^32 in 1.31 format */
+      hq = (uint32_t) pX[i + 1u] - (uint32_t) pX[i];
+      rcp = ((uint64_t) 1u << 63) / ((uint64_t) hq << __CLZ(hq));
+      pCoeffs[(step * i) + 3u] = (q31_t) (uint32_t) ((rcp > 0xFFFFFFFFu) ? 0xFFFFFFFFu : rcp);
+    }
+  }
+
+  S->nValues = nValues;
+  S->pX = pX;
+  S->pY = pY;
+  S->x1 = x1;
+  S->log2Spacing = log2Spacing;
+  S->postShift = (uint8_t) shift;
+  S->pCoeffs = pCoeffs;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of Spline group    
+ */
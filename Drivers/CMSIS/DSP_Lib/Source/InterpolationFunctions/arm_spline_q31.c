@@ -0,0 +1,209 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_spline_q31.c   
+*    
+* Description:	Q31 cubic spline interpolation    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupInterpolation    
+ */
+
+/**    
+ * @addtogroup Spline    
+ * @{    
+ */
+
+/**    
+ * @brief  Finds the segment i with pX[i] <= x < pX[i+1], given pX[lo] <= x < pX[hi].    
+ */
+
+static __INLINE uint32_t arm_spline_search_q31(
+  const q31_t * pX,
+  uint32_t lo,
+  uint32_t hi,
+  q31_t x)
+{
+  uint32_t mid;
+
+  while((hi - lo) > 1u)
+  {
+    mid = (lo + hi) >> 1u;
+    if(x < pX[mid])
+    {
+      hi = mid;
+    }
+    else
+    {
+      lo = mid;
+    }
+  }
+
+  return (lo);
+}
+
+/**    
+ * @brief  Evaluates the polynomial of a segment at u in [0, 1).    
+ */
+
+static __INLINE q31_t arm_spline_poly_q31(
+  q31_t y0,
+  const q31_t * pC,
+  q31_t u,
+  uint32_t postShift)
+{
+  q31_t acc;
+
+  /* Coefficients and partial sums are in 1.31 - postShift format */
+  acc = pC[1] + (q31_t) (((q63_t) u * pC[2]) >> 31);
+  acc = pC[0] + (q31_t) (((q63_t) u * acc) >> 31);
+
+  return (clip_q63_to_q31((q63_t) y0 + (((q63_t) u * acc) >> (31u - postShift))));
+}
+
+/**    
+ * @brief  Processing function for the Q31 cubic spline.    
+ * @param[in]  *S         points to an instance of the Q31 spline structure.    
+ * @param[in]  *pSrc      points to the block of input abscissas.    
+ * @param[out] *pDst      points to the block of output values.    
+ * @param[in]  blockSize  number of samples to process.    
+ * @return none.    
+ *    
+ * \par    
+ * Inputs below the first knot return the first table value and inputs above the last knot the last    
+ * table value.  Outputs that overshoot the Q31 range are saturated.    
+ */
+
+void arm_spline_q31(
+  const arm_spline_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  const q31_t *pX = S->pX;                       /* knots */
+  const q31_t *pY = S->pY;                       /* values at the knots */
+  const q31_t *pC;                               /* coefficients of the segment */
+  uint32_t n1 = S->nValues - 1u;                 /* number of segments */
+  uint32_t postShift = S->postShift;             /* format of the coefficients */
+  uint32_t log2Spacing = S->log2Spacing;         /* grid spacing */
+  q31_t x, xLo, xHi;                             /* input, first and last knot */
+  q31_t u;                                       /* abscissa within the segment */
+  uint32_t dx, lz;                               /* offset within the segment, leading zeros of its length */
+  uint32_t i = 0u;                               /* segment index */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  if(pX == NULL)
+  {
+    /* Uniform grid of power of two spacing: the upper bits of x - x1 are the segment, */
+    /* the lower bits the abscissa within it */
+    xLo = S->x1;
+
+    while(blkCnt > 0u)
+    {
+      x = *pSrc++;
+
+      if(x <= xLo)
+      {
+        *pDst++ = pY[0];
+      }
+      else
+      {
+        dx = (uint32_t) x - (uint32_t) xLo;
+        i = dx >> log2Spacing;
+
+        if(i >= n1)
+        {
+          *pDst++ = pY[n1];
+        }
+        else
+        {
+          u = (q31_t) ((dx << (31u - log2Spacing)) & 0x7FFFFFFFu);
+          *pDst++ = arm_spline_poly_q31(pY[i], S->pCoeffs + (3u * i), u, postShift);
+        }
+      }
+
+      blkCnt--;
+    }
+  }
+  else
+  {
+    /* Arbitrary knots: start at the segment of the previous input, which covers ascending */
+    /* inputs with one or two compares, and search the table otherwise */
+    xLo = pX[0];
+    xHi = pX[n1];
+
+    while(blkCnt > 0u)
+    {
+      x = *pSrc++;
+
+      if(x <= xLo)
+      {
+        *pDst++ = pY[0];
+      }
+      else if(x >= xHi)
+      {
+        *pDst++ = pY[n1];
+      }
+      else
+      {
+        if(x < pX[i])
+        {
+          i = arm_spline_search_q31(pX, 0u, i, x);
+        }
+        else if(x >= pX[i + 1u])
+        {
+          /* x < pX[n1], so pX[i + 2] exists */
+          i = (x < pX[i + 2u]) ? (i + 1u) : arm_spline_search_q31(pX, i + 2u, n1, x);
+        }
+
+        /* u = (x - x[i]) / h in 1.31 format from the normalized reciprocal of h */
+        pC = S->pCoeffs + (4u * i);
+        dx = (uint32_t) x - (uint32_t) pX[i];
+        lz = __CLZ((uint32_t) pX[i + 1u] - (uint32_t) pX[i]);
+        u = (q31_t) (((uint64_t) (dx << lz) * (uint32_t) pC[3]) >> 32);
+
+        *pDst++ = arm_spline_poly_q31(pY[i], pC, u, postShift);
+      }
+
+      blkCnt--;
+    }
+  }
+}
+
+/**    
+ * @} end of Spline group    
+ */
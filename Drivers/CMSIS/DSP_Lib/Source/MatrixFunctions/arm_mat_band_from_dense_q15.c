@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_band_from_dense_q15.c   
+*    
+* Description:	Q15 dense to banded matrix conversion.    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixBand    
+ * @{    
+ */
+
+/**    
+ * @brief Q15 dense to banded matrix conversion.    
+ * @param[in]       *pSrc points to the dense matrix    
+ * @param[out]      *pDst points to the banded matrix instance to initialize    
+ * @param[in]       numLower number of diagonals below the main diagonal    
+ * @param[in]       numUpper number of diagonals above the main diagonal    
+ * @param[in]       *pData points to the band storage of numRows * (numLower + numUpper + 1) values    
+ * @return     		The function returns <code>ARM_MATH_SUCCESS</code>, or <code>ARM_MATH_ARGUMENT_ERROR</code>    
+ * when a non-zero value of the matrix lies outside the band.    
+ *    
+ * \par    
+ * The band is copied row by row. Positions of the storage that fall outside the matrix, in the    
+ * first numLower and last numUpper rows, are set to zero.    
+ */
+
+arm_status arm_mat_band_from_dense_q15(
+  const arm_matrix_instance_q15 * pSrc,
+  arm_matrix_band_instance_q15 * pDst,
+  uint16_t numLower,
+  uint16_t numUpper,
+  q15_t * pData)
+{
+  const q15_t *pIn = pSrc->pData;                /* input data matrix pointer */
+  q15_t *pOut = pData;                           /* output band pointer */
+  uint32_t numCols = pSrc->numCols;              /* number of columns of the matrix */
+  uint32_t row, col;                             /* loop counters */
+  uint32_t first, last;                          /* first and last column + 1 of the band in the row */
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the conversion */
+
+  pDst->numRows = pSrc->numRows;
+  pDst->numCols = pSrc->numCols;
+  pDst->numLower = numLower;
+  pDst->numUpper = numUpper;
+  pDst->pData = pData;
+
+  for (row = 0u; row < pSrc->numRows; row++)
+  {
+    first = (row > numLower) ? (row - numLower) : 0u;
+    last = row + numUpper + 1u;
+
+    /* Positions before column 0 of the matrix, column j is stored at j - row + numLower */
+    for (col = row; col < (uint32_t) numLower + first; col++)
+    {
+      *pOut++ = 0;
+    }
+
+    for (col = 0u; col < numCols; col++)
+    {
+      if((col >= first) && (col < last))
+      {
+        *pOut++ = *pIn;
+      }
+      else if(*pIn != 0)
+      {
+        status = ARM_MATH_ARGUMENT_ERROR;
+      }
+
+      pIn++;
+    }
+
+    /* Positions after the last column of the matrix */
+    col = (last < numCols) ? last : numCols;
+    col = (col > first) ? col : first;
+
+    for (; col < last; col++)
+    {
+      *pOut++ = 0;
+    }
+  }
+
+  return (status);
+}
+
+/**    
+ * @} end of MatrixBand group    
+ */
@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_band_vec_mult_f32.c   
+*    
+* Description:	Floating-point banded matrix times vector.    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup MatrixBand Banded Matrix Vector Multiplication    
+ *    
+ * Multiplies a banded matrix by a vector.  The non-zero values of a banded matrix lie on the main    
+ * diagonal, <code>numLower</code> diagonals below it and <code>numUpper</code> diagonals above it, as in    
+ * finite difference, spline, smoothing and chain models.  The band is stored row by row, each row    
+ * holding <code>numLower+numUpper+1</code> values:    
+ * <pre>    
+ *     pSrcMat[i][j] = pData[i * (numLower + numUpper + 1) + j - i + numLower],   i - numLower <= j <= i + numUpper    
+ * </pre>    
+ * Band positions outside the matrix, at the beginning of the first rows and the end of the last rows,    
+ * are not read.  A product costs <code>numLower+numUpper+1</code> multiply-accumulates per row on    
+ * contiguous data, without the indices of the CSR form of \ref MatrixSparse.    
+ *    
+ * \par    
+ * The band is copied from a dense matrix by <code>arm_mat_band_from_dense_f32()</code>,    
+ * <code>arm_mat_band_from_dense_q31()</code> and <code>arm_mat_band_from_dense_q15()</code>, or the    
+ * instance is filled directly.    
+ */
+
+/**    
+ * @addtogroup MatrixBand    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point banded matrix times vector.    
+ * @param[in]       *pSrcMat points to the banded matrix    
+ * @param[in]       *pVec points to the input vector, numCols values    
+ * @param[out]      *pDst points to the output vector, numRows values    
+ * @return none.    
+ */
+
+void arm_mat_band_vec_mult_f32(
+  const arm_matrix_band_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns */
+  uint32_t numLower = pSrcMat->numLower;         /* number of diagonals below the main diagonal */
+  uint32_t numUpper = pSrcMat->numUpper;         /* number of diagonals above the main diagonal */
+  uint32_t width = numLower + numUpper + 1u;     /* values per row */
+  const float32_t *pRow = pSrcMat->pData;        /* band of the current row */
+  const float32_t *pM;                           /* matrix pointer */
+  const float32_t *pV;                           /* vector pointer */
+  float32_t sum;                                 /* accumulator */
+  uint32_t i, first, last;                       /* row, first and last column + 1 of the band */
+  uint32_t blkCnt;                               /* loop counter */
+#ifndef ARM_MATH_CM0_FAMILY
+  uint32_t cnt;                                  /* loop counter of the unrolled loop */
+#endif
+
+  for (i = 0u; i < pSrcMat->numRows; i++)
+  {
+    /* Columns i - numLower to i + numUpper, clipped to the matrix */
+    first = (i > numLower) ? (i - numLower) : 0u;
+    last = i + numUpper + 1u;
+    if(last > numCols)
+    {
+      last = numCols;
+    }
+
+    sum = 0.0f;
+    blkCnt = (last > first) ? (last - first) : 0u;
+    pM = pRow + ((first + numLower) - i);
+    pV = pVec + first;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Four columns at a time */
+    cnt = blkCnt >> 2u;
+
+    while(cnt > 0u)
+    {
+      sum += pM[0] * pV[0];
+      sum += pM[1] * pV[1];
+      sum += pM[2] * pV[2];
+      sum += pM[3] * pV[3];
+      pM += 4u;
+      pV += 4u;
+
+      /* Decrement the loop counter */
+      cnt--;
+    }
+
+    blkCnt = blkCnt % 0x4u;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(blkCnt > 0u)
+    {
+      sum += *pM++ * *pV++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    *pDst++ = sum;
+
+    pRow += width;
+  }
+}
+
+/**    
+ * @} end of MatrixBand group    
+ */
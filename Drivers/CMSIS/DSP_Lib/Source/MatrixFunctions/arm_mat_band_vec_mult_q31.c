@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_band_vec_mult_q31.c   
+*    
+* Description:	Q31 banded matrix times vector.    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixBand    
+ * @{    
+ */
+
+/**    
+ * @brief Q31 banded matrix times vector.    
+ * @param[in]       *pSrcMat points to the banded matrix    
+ * @param[in]       *pVec points to the input vector, numCols values    
+ * @param[out]      *pDst points to the output vector, numRows values    
+ * @return none.    
+ *    
+ * @details    
+ * <b>Scaling and Overflow Behavior:</b>    
+ *    
+ * \par    
+ * The function is implemented using an internal 64-bit accumulator in 2.62 format with a single    
+ * guard bit and no saturation on intermediate additions, as <code>arm_mat_vec_mult_q31()</code>.    
+ * The inputs should be scaled down by log2 of the largest number of values summed for an output.    
+ * The accumulator is right shifted by 31 bits and saturated to 1.31 format.    
+ */
+
+void arm_mat_band_vec_mult_q31(
+  const arm_matrix_band_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+  q31_t * pDst)
+{
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns */
+  uint32_t numLower = pSrcMat->numLower;         /* number of diagonals below the main diagonal */
+  uint32_t numUpper = pSrcMat->numUpper;         /* number of diagonals above the main diagonal */
+  uint32_t width = numLower + numUpper + 1u;     /* values per row */
+  const q31_t *pRow = pSrcMat->pData;            /* band of the current row */
+  const q31_t *pM;                               /* matrix pointer */
+  const q31_t *pV;                               /* vector pointer */
+  q63_t sum;                                     /* accumulator */
+  uint32_t i, first, last;                       /* row, first and last column + 1 of the band */
+  uint32_t blkCnt;                               /* loop counter */
+#ifndef ARM_MATH_CM0_FAMILY
+  uint32_t cnt;                                  /* loop counter of the unrolled loop */
+#endif
+
+  for (i = 0u; i < pSrcMat->numRows; i++)
+  {
+    /* Columns i - numLower to i + numUpper, clipped to the matrix */
+    first = (i > numLower) ? (i - numLower) : 0u;
+    last = i + numUpper + 1u;
+    if(last > numCols)
+    {
+      last = numCols;
+    }
+
+    sum = 0;
+    blkCnt = (last > first) ? (last - first) : 0u;
+    pM = pRow + ((first + numLower) - i);
+    pV = pVec + first;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Four columns at a time */
+    cnt = blkCnt >> 2u;
+
+    while(cnt > 0u)
+    {
+      sum += (q63_t) pM[0] * pV[0];
+      sum += (q63_t) pM[1] * pV[1];
+      sum += (q63_t) pM[2] * pV[2];
+      sum += (q63_t) pM[3] * pV[3];
+      pM += 4u;
+      pV += 4u;
+
+      /* Decrement the loop counter */
+      cnt--;
+    }
+
+    blkCnt = blkCnt % 0x4u;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(blkCnt > 0u)
+    {
+      sum += (q63_t) *pM++ * *pV++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    *pDst++ = clip_q63_to_q31(sum >> 31);
+
+    pRow += width;
+  }
+}
+
+/**    
+ * @} end of MatrixBand group    
+ */
@@ -0,0 +1,164 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_cholesky_f32.c   
+*    
+* Description:	Floating-point Cholesky decomposition    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup MatrixChol Cholesky Decomposition    
+ *    
+ * Decomposes a symmetric positive definite matrix as <code>A = L * L^T</code>, with <code>L</code> lower triangular,    
+ * and solves linear systems <code>A * X = B</code> with the decomposition.    
+ *    
+ * Solving with the decomposition is cheaper and more accurate than multiplying by the inverse: the decomposition    
+ * costs <code>n^3/6</code> multiply-accumulates, against about <code>n^3</code> for <code>arm_mat_inverse_f32()</code>,    
+ * and each right-hand side then costs <code>n^2</code>, so covariance updates and normal equations should be    
+ * solved this way rather than with an explicit inverse.    
+ *    
+ * \par Algorithm    
+ * The Cholesky-Crout method computes <code>L</code> row by row; each element is a dot product of two rows of    
+ * <code>L</code>, so the memory is always read with unit stride.  Only the lower triangle of <code>A</code> is read    
+ * and the decomposition may be done in place, with <code>pDst</code> pointing to the same data as <code>pSrc</code>.    
+ * If a pivot is not positive, the matrix is not positive definite (or is too badly conditioned for the precision)    
+ * and the functions return <code>ARM_MATH_SINGULAR</code>.    
+ */
+
+/**    
+ * @addtogroup MatrixChol    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point Cholesky decomposition.    
+ * @param[in]       *pSrc points to the symmetric positive definite input matrix structure    
+ * @param[out]      *pDst points to the lower triangular output matrix structure, may be the same as <code>pSrc</code>    
+ * @return     		The function returns    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices are not square or not of the same size,    
+ * <code>ARM_MATH_SINGULAR</code> if the input matrix is not positive definite and    
+ * <code>ARM_MATH_SUCCESS</code> otherwise.    
+ */
+
+arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pA = pSrc->pData;                   /* input data matrix pointer */
+  float32_t *pL = pDst->pData;                   /* output data matrix pointer */
+  float32_t *pLi, *pLj;                          /* rows i and j of the output */
+  float32_t sum;                                 /* accumulator */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols) ||
+     (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for(i = 0u; i < n; i++)
+  {
+    pLi = pL + (i * n);
+
+    for(j = 0u; j <= i; j++)
+    {
+      pLj = pL + (j * n);
+
+      /* sum = A(i,j) - L(i,0 ... j-1) . L(j,0 ... j-1), A(i,j) is read before L(i,j) overwrites it */
+      sum = pA[(i * n) + j];
+      k = 0u;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+      while((k + 4u) <= j)
+      {
+        sum -= (pLi[k] * pLj[k] + pLi[k + 1u] * pLj[k + 1u]) +
+          (pLi[k + 2u] * pLj[k + 2u] + pLi[k + 3u] * pLj[k + 3u]);
+        k += 4u;
+      }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+      while(k < j)
+      {
+        sum -= pLi[k] * pLj[k];
+        k++;
+      }
+
+      if(j < i)
+      {
+        /* L(i,j) = sum / L(j,j) */
+        pLi[j] = sum / pLj[j];
+      }
+      else
+      {
+        /* L(i,i) = sqrt(sum), which must be positive */
+        if(sum <= 0.0f)
+        {
+          return (ARM_MATH_SINGULAR);
+        }
+
+        arm_sqrt_f32(sum, &pLi[i]);
+      }
+    }
+
+    /* Clear the upper triangle of the row */
+    for(j = i + 1u; j < n; j++)
+    {
+      pLi[j] = 0.0f;
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of MatrixChol group    
+ */
@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_cholesky_solve_f64.c   
+*    
+* Description:	Double-precision floating-point solve with a Cholesky decomposition    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixChol    
+ * @{    
+ */
+
+/**    
+ * @brief Solves <code>A * X = B</code> with the Cholesky decomposition <code>A = L * L^T</code>.    
+ * @param[in]       *pSrcA points to the matrix structure of <code>L</code>, as returned by <code>arm_mat_cholesky_f64()</code>    
+ * @param[in]       *pSrcB points to the right-hand side matrix structure    
+ * @param[out]      *pDst points to the solution matrix structure, may be the same as <code>pSrcB</code>    
+ * @return     		The function returns    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the matrix sizes do not match,    
+ * <code>ARM_MATH_SINGULAR</code> if <code>L</code> has a zero on its diagonal and    
+ * <code>ARM_MATH_SUCCESS</code> otherwise.    
+ *    
+ * \par    
+ * <code>L * Y = B</code> is solved by forward substitution and <code>L^T * X = Y</code> by back substitution, both    
+ * row by row over all the columns of <code>B</code>, without forming <code>L^T</code>.    
+ */
+
+arm_status arm_mat_cholesky_solve_f64(
+  const arm_matrix_instance_f64 * pSrcA,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst)
+{
+  float64_t *pL = pSrcA->pData;                  /* lower triangular matrix pointer */
+  float64_t *pB = pSrcB->pData;                  /* right-hand side pointer */
+  float64_t *pX = pDst->pData;                   /* solution pointer */
+  float64_t *pXi, *pXk;                          /* rows i and k of the solution */
+  float64_t l;                                   /* element of L */
+  uint32_t n = pSrcA->numRows;                   /* size of the system */
+  uint32_t p = pSrcB->numCols;                   /* number of right-hand sides */
+  uint32_t i, k, c;                              /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numRows != pSrcA->numCols) || (pSrcB->numRows != pSrcA->numRows) ||
+     (pDst->numRows != pSrcB->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  /* Forward substitution: Y(i,:) = (B(i,:) - sum(k < i) L(i,k) * Y(k,:)) / L(i,i) */
+  for(i = 0u; i < n; i++)
+  {
+    pXi = pX + (i * p);
+
+    if(pX != pB)
+    {
+      for(c = 0u; c < p; c++)
+      {
+        pXi[c] = pB[(i * p) + c];
+      }
+    }
+
+    for(k = 0u; k < i; k++)
+    {
+      l = pL[(i * n) + k];
+      pXk = pX + (k * p);
+
+      for(c = 0u; c < p; c++)
+      {
+        pXi[c] -= l * pXk[c];
+      }
+    }
+
+    l = pL[(i * n) + i];
+
+    if(l == 0.0)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    for(c = 0u; c < p; c++)
+    {
+      pXi[c] /= l;
+    }
+  }
+
+  /* Back substitution: X(i,:) = (Y(i,:) - sum(k > i) L(k,i) * X(k,:)) / L(i,i) */
+  i = n;
+
+  while(i > 0u)
+  {
+    i--;
+    pXi = pX + (i * p);
+
+    for(k = i + 1u; k < n; k++)
+    {
+      l = pL[(k * n) + i];
+      pXk = pX + (k * p);
+
+      for(c = 0u; c < p; c++)
+      {
+        pXi[c] -= l * pXk[c];
+      }
+    }
+
+    l = pL[(i * n) + i];
+
+    for(c = 0u; c < p; c++)
+    {
+      pXi[c] /= l;
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of MatrixChol group    
+ */
@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_csr_from_dense_f32.c   
+*    
+* Description:	Floating-point dense to sparse matrix conversion.    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixSparse    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point dense to sparse matrix conversion.    
+ * @param[in]       *pSrc points to the dense matrix    
+ * @param[out]      *pDst points to the sparse matrix instance to initialize    
+ * @param[in]       *pRowPtr points to the row offset array of numRows + 1 values    
+ * @param[in]       *pColIdx points to the column index array of maxNonZero values    
+ * @param[in]       *pData points to the value array of maxNonZero values    
+ * @param[in]       maxNonZero length of the column index and value arrays    
+ * @return     		The function returns <code>ARM_MATH_SUCCESS</code>, or <code>ARM_MATH_LENGTH_ERROR</code>    
+ * when the matrix has more than maxNonZero non-zero values.    
+ *    
+ * \par    
+ * Only values that are exactly zero are dropped. The row offsets are always filled in, so after    
+ * <code>ARM_MATH_LENGTH_ERROR</code> <code>pRowPtr[numRows]</code> holds the number of non-zero    
+ * values of the matrix and the conversion can be repeated with arrays of that length.    
+ */
+
+arm_status arm_mat_csr_from_dense_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_csr_instance_f32 * pDst,
+  uint32_t * pRowPtr,
+  uint16_t * pColIdx,
+  float32_t * pData,
+  uint32_t maxNonZero)
+{
+  const float32_t *pIn = pSrc->pData;            /* input data matrix pointer */
+  float32_t in;                                  /* temporary input value */
+  uint32_t count = 0u;                           /* number of non-zero values found */
+  uint32_t row, col;                             /* loop counters */
+
+  pDst->numRows = pSrc->numRows;
+  pDst->numCols = pSrc->numCols;
+  pDst->pRowPtr = pRowPtr;
+  pDst->pColIdx = pColIdx;
+  pDst->pData = pData;
+
+  for (row = 0u; row < pSrc->numRows; row++)
+  {
+    pRowPtr[row] = count;
+
+    for (col = 0u; col < pSrc->numCols; col++)
+    {
+      in = *pIn++;
+
+      if(in != 0.0f)
+      {
+        /* Store the value while there is room, keep counting otherwise */
+        if(count < maxNonZero)
+        {
+          pColIdx[count] = (uint16_t) col;
+          pData[count] = in;
+        }
+
+        count++;
+      }
+    }
+  }
+
+  pRowPtr[pSrc->numRows] = count;
+
+  return ((count <= maxNonZero) ? ARM_MATH_SUCCESS : ARM_MATH_LENGTH_ERROR);
+}
+
+/**    
+ * @} end of MatrixSparse group    
+ */
@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_csr_mult_f32.c   
+*    
+* Description:	Floating-point sparse matrix times dense matrix.    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixSparse    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point sparse matrix times dense matrix.    
+ * @param[in]       *pSrcA points to the sparse matrix    
+ * @param[in]       *pSrcB points to the dense matrix    
+ * @param[out]      *pDst points to the dense output matrix    
+ * @return     		The function returns either    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.    
+ *    
+ * \par    
+ * Four output columns are computed together, so every non-zero value and index is loaded once    
+ * per four columns and the values of B are read four at a time from its rows.    
+ */
+
+arm_status arm_mat_csr_mult_f32(
+  const arm_matrix_csr_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of B and of the output */
+  const uint32_t *pRowPtr = pSrcA->pRowPtr;      /* row offsets */
+  const uint16_t *pIdx;                          /* column indices */
+  const float32_t *pVal;                         /* non-zero values */
+  float32_t *pOut = pDst->pData;                 /* output pointer */
+  float32_t sum0;                                /* accumulator */
+  uint32_t row, col;                             /* loop counters */
+  uint32_t k, kBeg, kEnd;                        /* non-zero values kBeg to kEnd - 1 form the row */
+  arm_status status;                             /* status of matrix multiplication */
+#ifndef ARM_MATH_CM0_FAMILY
+  const float32_t *pB;                           /* values of the current row of B */
+  float32_t sum1, sum2, sum3;                    /* accumulators */
+  float32_t a;                                   /* non-zero value */
+#endif
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    for (row = 0u; row < pSrcA->numRows; row++)
+    {
+      kBeg = pRowPtr[row];
+      kEnd = pRowPtr[row + 1u];
+      col = 0u;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Four columns at a time */
+      while((col + 4u) <= numColsB)
+      {
+        pVal = pSrcA->pData + kBeg;
+        pIdx = pSrcA->pColIdx + kBeg;
+        sum0 = 0.0f;
+        sum1 = 0.0f;
+        sum2 = 0.0f;
+        sum3 = 0.0f;
+
+        for (k = kBeg; k < kEnd; k++)
+        {
+          a = *pVal++;
+          pB = pSrcB->pData + ((uint32_t) *pIdx++ * numColsB) + col;
+          sum0 += a * pB[0];
+          sum1 += a * pB[1];
+          sum2 += a * pB[2];
+          sum3 += a * pB[3];
+        }
+
+        *pOut++ = sum0;
+        *pOut++ = sum1;
+        *pOut++ = sum2;
+        *pOut++ = sum3;
+
+        col += 4u;
+      }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+      /* Remaining columns */
+      while(col < numColsB)
+      {
+        pVal = pSrcA->pData + kBeg;
+        pIdx = pSrcA->pColIdx + kBeg;
+        sum0 = 0.0f;
+
+        for (k = kBeg; k < kEnd; k++)
+        {
+          sum0 += *pVal++ * pSrcB->pData[((uint32_t) *pIdx++ * numColsB) + col];
+        }
+
+        *pOut++ = sum0;
+
+        col++;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixSparse group    
+ */
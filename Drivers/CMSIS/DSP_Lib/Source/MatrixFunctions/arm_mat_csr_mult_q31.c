@@ -0,0 +1,175 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_csr_mult_q31.c   
+*    
+* Description:	Q31 sparse matrix times dense matrix.    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixSparse    
+ * @{    
+ */
+
+/**    
+ * @brief Q31 sparse matrix times dense matrix.    
+ * @param[in]       *pSrcA points to the sparse matrix    
+ * @param[in]       *pSrcB points to the dense matrix    
+ * @param[out]      *pDst points to the dense output matrix    
+ * @return     		The function returns either    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.    
+ *    
+ * \par    
+ * Four output columns are computed together, so every non-zero value and index is loaded once    
+ * per four columns and the values of B are read four at a time from its rows.    
+ *    
+ * @details    
+ * <b>Scaling and Overflow Behavior:</b>    
+ *    
+ * \par    
+ * The function is implemented using an internal 64-bit accumulator in 2.62 format with a single    
+ * guard bit and no saturation on intermediate additions, as <code>arm_mat_vec_mult_q31()</code>.    
+ * The inputs should be scaled down by log2 of the largest number of values summed for an output.    
+ * The accumulator is right shifted by 31 bits and saturated to 1.31 format.    
+ */
+
+arm_status arm_mat_csr_mult_q31(
+  const arm_matrix_csr_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst)
+{
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of B and of the output */
+  const uint32_t *pRowPtr = pSrcA->pRowPtr;      /* row offsets */
+  const uint16_t *pIdx;                          /* column indices */
+  const q31_t *pVal;                             /* non-zero values */
+  q31_t *pOut = pDst->pData;                     /* output pointer */
+  q63_t sum0;                                    /* accumulator */
+  uint32_t row, col;                             /* loop counters */
+  uint32_t k, kBeg, kEnd;                        /* non-zero values kBeg to kEnd - 1 form the row */
+  arm_status status;                             /* status of matrix multiplication */
+#ifndef ARM_MATH_CM0_FAMILY
+  const q31_t *pB;                               /* values of the current row of B */
+  q63_t sum1, sum2, sum3;                        /* accumulators */
+  q31_t a;                                       /* non-zero value */
+#endif
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    for (row = 0u; row < pSrcA->numRows; row++)
+    {
+      kBeg = pRowPtr[row];
+      kEnd = pRowPtr[row + 1u];
+      col = 0u;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Four columns at a time */
+      while((col + 4u) <= numColsB)
+      {
+        pVal = pSrcA->pData + kBeg;
+        pIdx = pSrcA->pColIdx + kBeg;
+        sum0 = 0;
+        sum1 = 0;
+        sum2 = 0;
+        sum3 = 0;
+
+        for (k = kBeg; k < kEnd; k++)
+        {
+          a = *pVal++;
+          pB = pSrcB->pData + ((uint32_t) *pIdx++ * numColsB) + col;
+          sum0 += (q63_t) a * pB[0];
+          sum1 += (q63_t) a * pB[1];
+          sum2 += (q63_t) a * pB[2];
+          sum3 += (q63_t) a * pB[3];
+        }
+
+        *pOut++ = clip_q63_to_q31(sum0 >> 31);
+        *pOut++ = clip_q63_to_q31(sum1 >> 31);
+        *pOut++ = clip_q63_to_q31(sum2 >> 31);
+        *pOut++ = clip_q63_to_q31(sum3 >> 31);
+
+        col += 4u;
+      }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+      /* Remaining columns */
+      while(col < numColsB)
+      {
+        pVal = pSrcA->pData + kBeg;
+        pIdx = pSrcA->pColIdx + kBeg;
+        sum0 = 0;
+
+        for (k = kBeg; k < kEnd; k++)
+        {
+          sum0 += (q63_t) *pVal++ * pSrcB->pData[((uint32_t) *pIdx++ * numColsB) + col];
+        }
+
+        *pOut++ = clip_q63_to_q31(sum0 >> 31);
+
+        col++;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**    
+ * @} end of MatrixSparse group    
+ */
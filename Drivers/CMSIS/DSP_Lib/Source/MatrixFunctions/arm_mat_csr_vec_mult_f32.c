@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_csr_vec_mult_f32.c   
+*    
+* Description:	Floating-point sparse matrix times vector.    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup MatrixSparse Sparse Matrix Multiplication    
+ *    
+ * Multiplies a sparse matrix by a vector or by a dense matrix.  The sparse matrix is stored in    
+ * compressed sparse row (CSR) form: the non-zero values row after row, the column of every value    
+ * and the offset of every row:    
+ * <pre>    
+ *     row i holds pData[k] in column pColIdx[k],   pRowPtr[i] <= k < pRowPtr[i+1]    
+ * </pre>    
+ * <code>pRowPtr</code> has <code>numRows+1</code> values, from 0 to the number of non-zero values.    
+ * A product costs one multiply-accumulate and one indexed load per non-zero value instead of    
+ * <code>numCols</code> per row, and the matrix takes 6 bytes per non-zero value for floating-point and    
+ * Q31 (4 bytes for Q15) instead of 4 (2) bytes per value, so the CSR form pays off below roughly 50%    
+ * non-zero values in memory and earlier in cycles.    
+ *    
+ * \par    
+ * The CSR form is built from a dense matrix by <code>arm_mat_csr_from_dense_f32()</code>,    
+ * <code>arm_mat_csr_from_dense_q31()</code> and <code>arm_mat_csr_from_dense_q15()</code>, or the    
+ * instance is filled directly, e.g. with arrays generated offline and placed in flash.  The values of a    
+ * row may be stored in any column order.    
+ */
+
+/**    
+ * @addtogroup MatrixSparse    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point sparse matrix times vector.    
+ * @param[in]       *pSrcMat points to the sparse matrix    
+ * @param[in]       *pVec points to the input vector, numCols values    
+ * @param[out]      *pDst points to the output vector, numRows values    
+ * @return none.    
+ */
+
+void arm_mat_csr_vec_mult_f32(
+  const arm_matrix_csr_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  const uint32_t *pRowPtr = pSrcMat->pRowPtr;    /* row offsets */
+  const uint16_t *pIdx = pSrcMat->pColIdx;       /* column indices */
+  const float32_t *pVal = pSrcMat->pData;        /* non-zero values */
+  float32_t sum;                                 /* accumulator */
+  uint32_t row = pSrcMat->numRows;               /* loop counter */
+  uint32_t blkCnt;                               /* loop counter */
+#ifndef ARM_MATH_CM0_FAMILY
+  uint32_t cnt;                                  /* loop counter of the unrolled loop */
+#endif
+
+  pIdx += pRowPtr[0];
+  pVal += pRowPtr[0];
+
+  while(row > 0u)
+  {
+    sum = 0.0f;
+    blkCnt = pRowPtr[1] - pRowPtr[0];
+    pRowPtr++;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Four non-zero values at a time */
+    cnt = blkCnt >> 2u;
+
+    while(cnt > 0u)
+    {
+      sum += pVal[0] * pVec[pIdx[0]];
+      sum += pVal[1] * pVec[pIdx[1]];
+      sum += pVal[2] * pVec[pIdx[2]];
+      sum += pVal[3] * pVec[pIdx[3]];
+      pVal += 4u;
+      pIdx += 4u;
+
+      /* Decrement the loop counter */
+      cnt--;
+    }
+
+    blkCnt = blkCnt % 0x4u;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(blkCnt > 0u)
+    {
+      sum += *pVal++ * pVec[*pIdx++];
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    *pDst++ = sum;
+
+    /* Decrement the loop counter */
+    row--;
+  }
+}
+
+/**    
+ * @} end of MatrixSparse group    
+ */
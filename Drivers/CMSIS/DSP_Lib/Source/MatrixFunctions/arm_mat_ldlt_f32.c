@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_ldlt_f32.c   
+*    
+* Description:	Floating-point LDL^T decomposition    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup MatrixLDLT LDL^T Decomposition    
+ *    
+ * Decomposes a symmetric matrix as <code>A = L * D * L^T</code>, with <code>L</code> unit lower triangular and    
+ * <code>D</code> diagonal, and solves linear systems <code>A * X = B</code> with the decomposition.    
+ *    
+ * Unlike the Cholesky decomposition it takes no square roots and <code>D</code> may have negative entries, so it    
+ * also applies to symmetric indefinite matrices whose leading minors are not zero, such as the saddle-point systems    
+ * of constrained least squares.  No pivoting is done: for a positive definite matrix it is as stable as    
+ * the Cholesky decomposition, for an indefinite one small pivots may lose accuracy.    
+ *    
+ * \par    
+ * The result is stored compactly: <code>L</code> below the diagonal of <code>pDst</code>, whose unit diagonal is not    
+ * stored, and <code>D</code> on the diagonal; the upper triangle is cleared.  Only the lower triangle of the    
+ * input is read and the decomposition may be done in place.  A zero pivot returns <code>ARM_MATH_SINGULAR</code>.    
+ */
+
+/**    
+ * @addtogroup MatrixLDLT    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point LDL^T decomposition.    
+ * @param[in]       *pSrc points to the symmetric input matrix structure    
+ * @param[out]      *pDst points to the output matrix structure, <code>L</code> and <code>D</code>, may be the same as <code>pSrc</code>    
+ * @return     		The function returns    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices are not square or not of the same size,    
+ * <code>ARM_MATH_SINGULAR</code> if a pivot is zero and    
+ * <code>ARM_MATH_SUCCESS</code> otherwise.    
+ *    
+ * \par    
+ * Row <code>i</code> is first computed as <code>W(i,j) = L(i,j) * D(j)</code>, a dot product of rows    
+ * <code>i</code> and <code>j</code>, then scaled to <code>L(i,j)</code> while <code>D(i)</code> is accumulated.    
+ */
+
+arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pA = pSrc->pData;                   /* input data matrix pointer */
+  float32_t *pL = pDst->pData;                   /* output data matrix pointer */
+  float32_t *pLi, *pLj;                          /* rows i and j of the output */
+  float32_t sum, w;                              /* accumulator and element of W */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols) ||
+     (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for(i = 0u; i < n; i++)
+  {
+    pLi = pL + (i * n);
+
+    /* W(i,j) = A(i,j) - W(i,0 ... j-1) . L(j,0 ... j-1) */
+    for(j = 0u; j < i; j++)
+    {
+      pLj = pL + (j * n);
+      sum = pA[(i * n) + j];
+      k = 0u;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+      while((k + 4u) <= j)
+      {
+        sum -= (pLi[k] * pLj[k] + pLi[k + 1u] * pLj[k + 1u]) +
+          (pLi[k + 2u] * pLj[k + 2u] + pLi[k + 3u] * pLj[k + 3u]);
+        k += 4u;
+      }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+      while(k < j)
+      {
+        sum -= pLi[k] * pLj[k];
+        k++;
+      }
+
+      pLi[j] = sum;
+    }
+
+    /* L(i,j) = W(i,j) / D(j) and D(i) = A(i,i) - sum(j < i) W(i,j) * L(i,j) */
+    sum = pA[(i * n) + i];
+
+    for(j = 0u; j < i; j++)
+    {
+      w = pLi[j];
+      pLi[j] = w / pL[(j * n) + j];
+      sum -= w * pLi[j];
+    }
+
+    if(sum == 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    pLi[i] = sum;
+
+    /* Clear the upper triangle of the row */
+    for(j = i + 1u; j < n; j++)
+    {
+      pLi[j] = 0.0f;
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of MatrixLDLT group    
+ */
@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_ldlt_solve_f32.c   
+*    
+* Description:	Floating-point solve with an LDL^T decomposition    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixLDLT    
+ * @{    
+ */
+
+/**    
+ * @brief Solves <code>A * X = B</code> with the decomposition <code>A = L * D * L^T</code>.    
+ * @param[in]       *pSrcA points to the matrix structure of <code>L</code> and <code>D</code>, as returned by <code>arm_mat_ldlt_f32()</code>    
+ * @param[in]       *pSrcB points to the right-hand side matrix structure    
+ * @param[out]      *pDst points to the solution matrix structure, may be the same as <code>pSrcB</code>    
+ * @return     		The function returns    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the matrix sizes do not match,    
+ * <code>ARM_MATH_SINGULAR</code> if <code>D</code> has a zero entry and    
+ * <code>ARM_MATH_SUCCESS</code> otherwise.    
+ */
+
+arm_status arm_mat_ldlt_solve_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pL = pSrcA->pData;                  /* decomposition pointer */
+  float32_t *pB = pSrcB->pData;                  /* right-hand side pointer */
+  float32_t *pX = pDst->pData;                   /* solution pointer */
+  float32_t *pXi, *pXk;                          /* rows i and k of the solution */
+  float32_t l;                                   /* element of L or D */
+  uint32_t n = pSrcA->numRows;                   /* size of the system */
+  uint32_t p = pSrcB->numCols;                   /* number of right-hand sides */
+  uint32_t i, k, c;                              /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numRows != pSrcA->numCols) || (pSrcB->numRows != pSrcA->numRows) ||
+     (pDst->numRows != pSrcB->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  /* Forward substitution with the unit diagonal: Y(i,:) = B(i,:) - sum(k < i) L(i,k) * Y(k,:) */
+  for(i = 0u; i < n; i++)
+  {
+    pXi = pX + (i * p);
+
+    if(pX != pB)
+    {
+      for(c = 0u; c < p; c++)
+      {
+        pXi[c] = pB[(i * p) + c];
+      }
+    }
+
+    for(k = 0u; k < i; k++)
+    {
+      l = pL[(i * n) + k];
+      pXk = pX + (k * p);
+
+      for(c = 0u; c < p; c++)
+      {
+        pXi[c] -= l * pXk[c];
+      }
+    }
+  }
+
+  /* Back substitution: X(i,:) = Y(i,:) / D(i) - sum(k > i) L(k,i) * X(k,:) */
+  i = n;
+
+  while(i > 0u)
+  {
+    i--;
+    pXi = pX + (i * p);
+    l = pL[(i * n) + i];
+
+    if(l == 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    for(c = 0u; c < p; c++)
+    {
+      pXi[c] /= l;
+    }
+
+    for(k = i + 1u; k < n; k++)
+    {
+      l = pL[(k * n) + i];
+      pXk = pX + (k * p);
+
+      for(c = 0u; c < p; c++)
+      {
+        pXi[c] -= l * pXk[c];
+      }
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of MatrixLDLT group    
+ */
@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_mult_f64.c   
+*    
+* Description:	Double-precision floating-point matrix multiplication    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixMult    
+ * @{    
+ */
+
+/* Side of the square blocks of B and of the output kept in the data cache, 16 x 16 doubles are 2 KB */
+#ifndef ARM_MAT_MULT_F64_BLOCK
+#define ARM_MAT_MULT_F64_BLOCK  16u
+#endif
+
+/**    
+ * @brief Double-precision floating-point matrix multiplication.    
+ * @param[in]       *pSrcA points to the first input matrix structure    
+ * @param[in]       *pSrcB points to the second input matrix structure    
+ * @param[out]      *pDst points to output matrix structure    
+ * @return     		The function returns either    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.    
+ *    
+ * \par    
+ * The product is computed in blocks of <code>ARM_MAT_MULT_F64_BLOCK</code> columns of <code>B</code> and of the    
+ * output and <code>ARM_MAT_MULT_F64_BLOCK</code> rows of <code>B</code>: for each such block every row of the output    
+ * block is updated by <code>A(i,k) * B(k,:)</code> for the rows <code>k</code> of the block, so that <code>B</code> and    
+ * the output are read with unit stride and the block of <code>B</code> stays in the data cache while the rows of    
+ * <code>A</code> stream through, instead of striding down a column of <code>B</code> for every output element.    
+ * The output must not overlap the inputs.    
+ */
+
+arm_status arm_mat_mult_f64(
+  const arm_matrix_instance_f64 * pSrcA,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst)
+{
+  float64_t *pA = pSrcA->pData;                  /* input data matrix pointer A */
+  float64_t *pB = pSrcB->pData;                  /* input data matrix pointer B */
+  float64_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float64_t *px, *py;                            /* output and B row pointers */
+  float64_t a;                                   /* element of A */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t kk, jj, kEnd, jLen;                   /* block bounds */
+  uint32_t i, k, colCnt;                         /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  /* Clear the output, the blocks accumulate into it */
+  for(i = 0u; i < (numRowsA * numColsB); i++)
+  {
+    pOut[i] = 0.0;
+  }
+
+  for(kk = 0u; kk < numColsA; kk += ARM_MAT_MULT_F64_BLOCK)
+  {
+    kEnd = (kk + ARM_MAT_MULT_F64_BLOCK < numColsA) ? (kk + ARM_MAT_MULT_F64_BLOCK) : numColsA;
+
+    for(jj = 0u; jj < numColsB; jj += ARM_MAT_MULT_F64_BLOCK)
+    {
+      jLen = (jj + ARM_MAT_MULT_F64_BLOCK < numColsB) ? ARM_MAT_MULT_F64_BLOCK : (numColsB - jj);
+
+      for(i = 0u; i < numRowsA; i++)
+      {
+        for(k = kk; k < kEnd; k++)
+        {
+          /* C(i,jj ...) += A(i,k) * B(k,jj ...) */
+          a = pA[(i * numColsA) + k];
+          px = pOut + (i * numColsB) + jj;
+          py = pB + (k * numColsB) + jj;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+          /* Run the below code for Cortex-M4 and Cortex-M3 */
+          colCnt = jLen >> 2u;
+
+          while(colCnt > 0u)
+          {
+            px[0] += a * py[0];
+            px[1] += a * py[1];
+            px[2] += a * py[2];
+            px[3] += a * py[3];
+            px += 4u;
+            py += 4u;
+
+            /* Decrement the loop counter */
+            colCnt--;
+          }
+
+          colCnt = jLen % 0x4u;
+
+#else
+
+          /* Run the below code for Cortex-M0 */
+          colCnt = jLen;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+          while(colCnt > 0u)
+          {
+            *px++ += a * *py++;
+
+            /* Decrement the loop counter */
+            colCnt--;
+          }
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of MatrixMult group    
+ */
@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_qr_f32.c   
+*    
+* Description:	Floating-point QR decomposition    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup MatrixQR QR Decomposition    
+ *    
+ * Decomposes an <code>m x n</code> matrix, <code>m >= n</code>, as <code>A = Q * R</code> with <code>Q</code> orthogonal    
+ * and <code>R</code> upper triangular, and solves linear least-squares problems <code>min |A * X - B|</code> with it.    
+ *    
+ * The QR decomposition does not square the condition number of <code>A</code> as the normal equations    
+ * <code>A^T * A * X = A^T * B</code> do, so it is the accurate way to fit an over-determined system, e.g. a    
+ * calibration or a polynomial fit, and it also solves square systems without pivoting concerns.    
+ *    
+ * \par Algorithm    
+ * <code>Q</code> is the product of <code>n</code> Householder reflections <code>H(j) = I - tau(j) * v(j) * v(j)^T</code>,    
+ * stored as in LAPACK: <code>R</code> in the upper triangle of <code>pDst</code>, the vectors <code>v(j)</code>    
+ * below the diagonal (their first element is 1 and is not stored) and the factors <code>tau(j)</code> in    
+ * <code>pTau</code>.  The decomposition may be done in place.    
+ */
+
+/**    
+ * @addtogroup MatrixQR    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point QR decomposition.    
+ * @param[in]       *pSrc points to the <code>m x n</code> input matrix structure, <code>m >= n</code>    
+ * @param[out]      *pDst points to the output matrix structure, <code>R</code> and the Householder vectors, may be the same as <code>pSrc</code>    
+ * @param[out]      *pTau points to the <code>n</code> Householder factors    
+ * @return     		The function returns    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices are not of the same size or have more columns than rows and    
+ * <code>ARM_MATH_SUCCESS</code> otherwise.    
+ */
+
+arm_status arm_mat_qr_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pTau)
+{
+  float32_t *pA = pDst->pData;                   /* output data matrix pointer */
+  float32_t alpha, beta, sigma, tau, w;          /* reflection parameters */
+  uint32_t m = pSrc->numRows;                    /* number of rows */
+  uint32_t n = pSrc->numCols;                    /* number of columns */
+  uint32_t i, j, c;                              /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pDst->numRows) || (pSrc->numCols != pDst->numCols) ||
+     (pSrc->numRows < pSrc->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  if(pDst->pData != pSrc->pData)
+  {
+    arm_copy_f32(pSrc->pData, pA, m * n);
+  }
+
+  for(j = 0u; j < n; j++)
+  {
+    /* Reflection of the column A(j ... m-1, j) onto beta * e(j) */
+    alpha = pA[(j * n) + j];
+    sigma = 0.0f;
+
+    for(i = j + 1u; i < m; i++)
+    {
+      sigma += pA[(i * n) + j] * pA[(i * n) + j];
+    }
+
+    if(sigma == 0.0f)
+    {
+      /* Nothing below the diagonal, H(j) = I */
+      pTau[j] = 0.0f;
+      continue;
+    }
+
+    arm_sqrt_f32((alpha * alpha) + sigma, &beta);
+
+    if(alpha >= 0.0f)
+    {
+      beta = -beta;
+    }
+
+    /* tau = (beta - alpha) / beta, v = x / (alpha - beta) with v(j) = 1 */
+    tau = (beta - alpha) / beta;
+    w = 1.0f / (alpha - beta);
+
+    for(i = j + 1u; i < m; i++)
+    {
+      pA[(i * n) + j] *= w;
+    }
+
+    pA[(j * n) + j] = beta;
+    pTau[j] = tau;
+
+    /* Apply H(j) to the remaining columns: A(:,c) -= tau * v * (v^T * A(:,c)) */
+    for(c = j + 1u; c < n; c++)
+    {
+      w = pA[(j * n) + c];
+
+      for(i = j + 1u; i < m; i++)
+      {
+        w += pA[(i * n) + j] * pA[(i * n) + c];
+      }
+
+      w *= tau;
+      pA[(j * n) + c] -= w;
+
+      for(i = j + 1u; i < m; i++)
+      {
+        pA[(i * n) + c] -= w * pA[(i * n) + j];
+      }
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of MatrixQR group    
+ */
@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_qr_f64.c   
+*    
+* Description:	Double-precision floating-point QR decomposition    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixQR    
+ * @{    
+ */
+
+/**    
+ * @brief Double-precision floating-point QR decomposition.    
+ * @param[in]       *pSrc points to the <code>m x n</code> input matrix structure, <code>m >= n</code>    
+ * @param[out]      *pDst points to the output matrix structure, <code>R</code> and the Householder vectors, may be the same as <code>pSrc</code>    
+ * @param[out]      *pTau points to the <code>n</code> Householder factors    
+ * @return     		The function returns    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the matrices are not of the same size or have more columns than rows and    
+ * <code>ARM_MATH_SUCCESS</code> otherwise.    
+ */
+
+arm_status arm_mat_qr_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst,
+  float64_t * pTau)
+{
+  float64_t *pA = pDst->pData;                   /* output data matrix pointer */
+  float64_t alpha, beta, sigma, tau, w;          /* reflection parameters */
+  uint32_t m = pSrc->numRows;                    /* number of rows */
+  uint32_t n = pSrc->numCols;                    /* number of columns */
+  uint32_t i, j, c;                              /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pDst->numRows) || (pSrc->numCols != pDst->numCols) ||
+     (pSrc->numRows < pSrc->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  if(pDst->pData != pSrc->pData)
+  {
+    for(i = 0u; i < (m * n); i++)
+    {
+      pA[i] = pSrc->pData[i];
+    }
+  }
+
+  for(j = 0u; j < n; j++)
+  {
+    /* Reflection of the column A(j ... m-1, j) onto beta * e(j) */
+    alpha = pA[(j * n) + j];
+    sigma = 0.0;
+
+    for(i = j + 1u; i < m; i++)
+    {
+      sigma += pA[(i * n) + j] * pA[(i * n) + j];
+    }
+
+    if(sigma == 0.0)
+    {
+      /* Nothing below the diagonal, H(j) = I */
+      pTau[j] = 0.0;
+      continue;
+    }
+
+    beta = sqrt((alpha * alpha) + sigma);
+
+    if(alpha >= 0.0)
+    {
+      beta = -beta;
+    }
+
+    /* tau = (beta - alpha) / beta, v = x / (alpha - beta) with v(j) = 1 */
+    tau = (beta - alpha) / beta;
+    w = 1.0 / (alpha - beta);
+
+    for(i = j + 1u; i < m; i++)
+    {
+      pA[(i * n) + j] *= w;
+    }
+
+    pA[(j * n) + j] = beta;
+    pTau[j] = tau;
+
+    /* Apply H(j) to the remaining columns: A(:,c) -= tau * v * (v^T * A(:,c)) */
+    for(c = j + 1u; c < n; c++)
+    {
+      w = pA[(j * n) + c];
+
+      for(i = j + 1u; i < m; i++)
+      {
+        w += pA[(i * n) + j] * pA[(i * n) + c];
+      }
+
+      w *= tau;
+      pA[(j * n) + c] -= w;
+
+      for(i = j + 1u; i < m; i++)
+      {
+        pA[(i * n) + c] -= w * pA[(i * n) + j];
+      }
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of MatrixQR group    
+ */
@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_qr_solve_f64.c   
+*    
+* Description:	Double-precision floating-point least-squares solve with a QR decomposition    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixQR    
+ * @{    
+ */
+
+/**    
+ * @brief Solves <code>min |A * X - B|</code> with the decomposition <code>A = Q * R</code>.    
+ * @param[in]       *pSrcA points to the <code>m x n</code> matrix structure of the decomposition, as returned by <code>arm_mat_qr_f64()</code>    
+ * @param[in]       *pTau points to the <code>n</code> Householder factors    
+ * @param[in]       *pSrcB points to the <code>m x p</code> right-hand side matrix structure    
+ * @param[out]      *pDst points to the <code>n x p</code> solution matrix structure    
+ * @param[in]       *pScratch points to a buffer of <code>m</code> values    
+ * @return     		The function returns    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the matrix sizes do not match,    
+ * <code>ARM_MATH_SINGULAR</code> if <code>R</code> has a zero on its diagonal, i.e. <code>A</code> is rank deficient, and    
+ * <code>ARM_MATH_SUCCESS</code> otherwise.    
+ *    
+ * \par    
+ * Each column of <code>B</code> is copied to the scratch buffer, multiplied by <code>Q^T</code> one reflection at a time    
+ * and its first <code>n</code> values are solved with <code>R</code> by back substitution.  For a square system the    
+ * result is the exact solution.    
+ */
+
+arm_status arm_mat_qr_solve_f64(
+  const arm_matrix_instance_f64 * pSrcA,
+  const float64_t * pTau,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst,
+  float64_t * pScratch)
+{
+  float64_t *pA = pSrcA->pData;                  /* decomposition pointer */
+  float64_t *pB = pSrcB->pData;                  /* right-hand side pointer */
+  float64_t *pX = pDst->pData;                   /* solution pointer */
+  float64_t *y = pScratch;                       /* column being solved */
+  float64_t w;                                   /* accumulator */
+  uint32_t m = pSrcA->numRows;                   /* number of rows */
+  uint32_t n = pSrcA->numCols;                   /* number of unknowns */
+  uint32_t p = pSrcB->numCols;                   /* number of right-hand sides */
+  uint32_t i, j, c;                              /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcB->numRows != m) || (pDst->numRows != n) || (pDst->numCols != p) || (m < n))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for(c = 0u; c < p; c++)
+  {
+    for(i = 0u; i < m; i++)
+    {
+      y[i] = pB[(i * p) + c];
+    }
+
+    /* y = H(n-1) * ... * H(0) * y = Q^T * y */
+    for(j = 0u; j < n; j++)
+    {
+      w = y[j];
+
+      for(i = j + 1u; i < m; i++)
+      {
+        w += pA[(i * n) + j] * y[i];
+      }
+
+      w *= pTau[j];
+      y[j] -= w;
+
+      for(i = j + 1u; i < m; i++)
+      {
+        y[i] -= w * pA[(i * n) + j];
+      }
+    }
+
+    /* R * x = y(0 ... n-1) */
+    i = n;
+
+    while(i > 0u)
+    {
+      i--;
+      w = y[i];
+
+      for(j = i + 1u; j < n; j++)
+      {
+        w -= pA[(i * n) + j] * y[j];
+      }
+
+      if(pA[(i * n) + i] == 0.0)
+      {
+        return (ARM_MATH_SINGULAR);
+      }
+
+      y[i] = w / pA[(i * n) + i];
+      pX[(i * p) + c] = y[i];
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of MatrixQR group    
+ */
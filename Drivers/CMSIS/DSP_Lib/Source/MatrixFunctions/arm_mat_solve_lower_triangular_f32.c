@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_solve_lower_triangular_f32.c   
+*    
+* Description:	Floating-point lower triangular solve    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup MatrixSolve Triangular Solve    
+ *    
+ * Solves <code>A * X = B</code> for a lower or upper triangular matrix <code>A</code> by forward or back    
+ * substitution, for all the columns of <code>B</code> at once.  Only the triangle of <code>A</code> that is named    
+ * is read, so the factors of the Cholesky, LDL^T and QR decompositions can be passed directly.    
+ *    
+ * \par    
+ * Each row of the solution is updated from the rows already solved with unit stride, and the solution may    
+ * overwrite the right-hand side (<code>pDst</code> the same as <code>pSrcB</code>).  A zero on the diagonal    
+ * returns <code>ARM_MATH_SINGULAR</code>.    
+ */
+
+/**    
+ * @addtogroup MatrixSolve    
+ * @{    
+ */
+
+/**    
+ * @brief Solves <code>A * X = B</code> for a lower triangular floating-point matrix <code>A</code>.    
+ * @param[in]       *pSrcA points to the lower triangular matrix structure    
+ * @param[in]       *pSrcB points to the right-hand side matrix structure    
+ * @param[out]      *pDst points to the solution matrix structure, may be the same as <code>pSrcB</code>    
+ * @return     		The function returns    
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the matrix sizes do not match,    
+ * <code>ARM_MATH_SINGULAR</code> if <code>A</code> has a zero on its diagonal and    
+ * <code>ARM_MATH_SUCCESS</code> otherwise.    
+ */
+
+arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pA = pSrcA->pData;                  /* triangular matrix pointer */
+  float32_t *pB = pSrcB->pData;                  /* right-hand side pointer */
+  float32_t *pX = pDst->pData;                   /* solution pointer */
+  float32_t *pXi, *pXk;                          /* rows i and k of the solution */
+  float32_t a;                                   /* element of A */
+  uint32_t n = pSrcA->numRows;                   /* size of the system */
+  uint32_t p = pSrcB->numCols;                   /* number of right-hand sides */
+  uint32_t i, k, c;                              /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numRows != pSrcA->numCols) || (pSrcB->numRows != pSrcA->numRows) ||
+     (pDst->numRows != pSrcB->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  /* X(i,:) = (B(i,:) - sum(k < i) A(i,k) * X(k,:)) / A(i,i) */
+  for(i = 0u; i < n; i++)
+  {
+    pXi = pX + (i * p);
+
+    if(pX != pB)
+    {
+      for(c = 0u; c < p; c++)
+      {
+        pXi[c] = pB[(i * p) + c];
+      }
+    }
+
+    for(k = 0u; k < i; k++)
+    {
+      a = pA[(i * n) + k];
+      pXk = pX + (k * p);
+
+      for(c = 0u; c < p; c++)
+      {
+        pXi[c] -= a * pXk[c];
+      }
+    }
+
+    a = pA[(i * n) + i];
+
+    if(a == 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    for(c = 0u; c < p; c++)
+    {
+      pXi[c] /= a;
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of MatrixSolve group    
+ */
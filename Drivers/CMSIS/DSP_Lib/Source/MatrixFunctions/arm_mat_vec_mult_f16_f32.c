@@ -0,0 +1,202 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_vec_mult_f16_f32.c   
+*    
+* Description:	Half-precision matrix times single-precision vector.    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixVectMult    
+ * @{    
+ */
+
+/**    
+ * @brief Half-precision matrix times single-precision vector.    
+ * @param[in]       *pSrcMat points to the half-precision matrix    
+ * @param[in]       *pVec points to the input vector    
+ * @param[out]      *pDst points to the output vector    
+ * @return none.    
+ *    
+ * \par    
+ * The matrix is stored in half precision (\ref f16_to_x), e.g. a coefficient    
+ * bank in SDRAM or QSPI flash, and the vector, the accumulation and the result    
+ * are single precision.    
+ *    
+ * \par    
+ * Four rows are processed together, so every vector value is loaded once per    
+ * four rows, and the matrix is read two values at a time.    
+ */
+
+void arm_mat_vec_mult_f16_f32(
+  const arm_matrix_instance_f16 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows */
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns */
+  const float16_t *pRow = pSrcMat->pData;        /* first row of the current group */
+  const float16_t *pM0;                          /* matrix row pointer */
+  const float32_t *pV;                           /* vector pointer */
+  float32_t sum0;                                /* accumulator */
+  float32_t m0, m1, v0, v1;                      /* converted matrix and vector values */
+  uint32_t row, colCnt;                          /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  const float16_t *pM1, *pM2, *pM3;              /* matrix row pointers */
+  float32_t sum1, sum2, sum3;                    /* accumulators */
+  float32_t n0, n1;                              /* converted matrix values */
+
+  /* Four rows at a time */
+  row = numRows >> 2u;
+
+  while(row > 0u)
+  {
+    pM0 = pRow;
+    pM1 = pM0 + numCols;
+    pM2 = pM1 + numCols;
+    pM3 = pM2 + numCols;
+    pV = pVec;
+
+    sum0 = 0.0f;
+    sum1 = 0.0f;
+    sum2 = 0.0f;
+    sum3 = 0.0f;
+
+    /* Two columns at a time */
+    colCnt = numCols >> 1u;
+
+    while(colCnt > 0u)
+    {
+      v0 = pV[0];
+      v1 = pV[1];
+      pV += 2u;
+
+      arm_f16x2_to_f32(*__SIMD32(pM0)++, &m0, &m1);
+      arm_f16x2_to_f32(*__SIMD32(pM1)++, &n0, &n1);
+      sum0 += m0 * v0;
+      sum1 += n0 * v0;
+      sum0 += m1 * v1;
+      sum1 += n1 * v1;
+
+      arm_f16x2_to_f32(*__SIMD32(pM2)++, &m0, &m1);
+      arm_f16x2_to_f32(*__SIMD32(pM3)++, &n0, &n1);
+      sum2 += m0 * v0;
+      sum3 += n0 * v0;
+      sum2 += m1 * v1;
+      sum3 += n1 * v1;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Odd number of columns */
+    if((numCols & 1u) != 0u)
+    {
+      v0 = *pV;
+      sum0 += arm_f16_to_f32_1(*pM0) * v0;
+      sum1 += arm_f16_to_f32_1(*pM1) * v0;
+      sum2 += arm_f16_to_f32_1(*pM2) * v0;
+      sum3 += arm_f16_to_f32_1(*pM3) * v0;
+    }
+
+    *pDst++ = sum0;
+    *pDst++ = sum1;
+    *pDst++ = sum2;
+    *pDst++ = sum3;
+
+    pRow += 4u * numCols;
+
+    /* Decrement the loop counter */
+    row--;
+  }
+
+  /* Remaining 1 to 3 rows */
+  row = numRows % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  row = numRows;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(row > 0u)
+  {
+    pM0 = pRow;
+    pV = pVec;
+    sum0 = 0.0f;
+
+    colCnt = numCols >> 1u;
+
+    while(colCnt > 0u)
+    {
+      arm_f16x2_to_f32(*__SIMD32(pM0)++, &m0, &m1);
+      v0 = pV[0];
+      v1 = pV[1];
+      pV += 2u;
+      sum0 += m0 * v0;
+      sum0 += m1 * v1;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    if((numCols & 1u) != 0u)
+    {
+      sum0 += arm_f16_to_f32_1(*pM0) * *pV;
+    }
+
+    *pDst++ = sum0;
+
+    pRow += numCols;
+
+    /* Decrement the loop counter */
+    row--;
+  }
+}
+
+/**    
+ * @} end of MatrixVectMult group    
+ */
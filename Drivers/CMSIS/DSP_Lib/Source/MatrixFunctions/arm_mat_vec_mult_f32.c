@@ -0,0 +1,207 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_vec_mult_f32.c   
+*    
+* Description:	Floating-point matrix times vector.    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @defgroup MatrixVectMult Matrix Vector Multiplication    
+ *    
+ * Multiplies a matrix by a vector:    
+ * <pre>    
+ *     pDst[i] = pSrcMat[i][0] * pVec[0] + ... + pSrcMat[i][numCols-1] * pVec[numCols-1],   0 <= i < numRows    
+ * </pre>    
+ * <code>pVec</code> has <code>numCols</code> values and <code>pDst</code> has <code>numRows</code> values.    
+ * There are functions for floating-point, Q31 and Q15 matrices and vectors, and for a half-precision    
+ * matrix with a single-precision vector.  Sparse and banded matrices are multiplied by the functions    
+ * of \ref MatrixSparse and \ref MatrixBand.    
+ */
+
+/**    
+ * @addtogroup MatrixVectMult    
+ * @{    
+ */
+
+/**    
+ * @brief Floating-point matrix times vector.    
+ * @param[in]       *pSrcMat points to the matrix    
+ * @param[in]       *pVec points to the input vector    
+ * @param[out]      *pDst points to the output vector    
+ * @return none.    
+ *    
+ * \par    
+ * Four rows are processed together, so every vector value is loaded once per    
+ * four rows.    
+ */
+
+void arm_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows */
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns */
+  const float32_t *pRow = pSrcMat->pData;        /* first row of the current group */
+  const float32_t *pM0;                          /* matrix row pointer */
+  const float32_t *pV;                           /* vector pointer */
+  float32_t sum0;                                /* accumulator */
+  float32_t v0, v1;                              /* vector values */
+  uint32_t row, colCnt;                          /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  const float32_t *pM1, *pM2, *pM3;              /* matrix row pointers */
+  float32_t sum1, sum2, sum3;                    /* accumulators */
+
+  /* Four rows at a time */
+  row = numRows >> 2u;
+
+  while(row > 0u)
+  {
+    pM0 = pRow;
+    pM1 = pM0 + numCols;
+    pM2 = pM1 + numCols;
+    pM3 = pM2 + numCols;
+    pV = pVec;
+
+    sum0 = 0.0f;
+    sum1 = 0.0f;
+    sum2 = 0.0f;
+    sum3 = 0.0f;
+
+    /* Two columns at a time */
+    colCnt = numCols >> 1u;
+
+    while(colCnt > 0u)
+    {
+      v0 = pV[0];
+      v1 = pV[1];
+      pV += 2u;
+
+      sum0 += pM0[0] * v0;
+      sum1 += pM1[0] * v0;
+      sum2 += pM2[0] * v0;
+      sum3 += pM3[0] * v0;
+      sum0 += pM0[1] * v1;
+      sum1 += pM1[1] * v1;
+      sum2 += pM2[1] * v1;
+      sum3 += pM3[1] * v1;
+      pM0 += 2u;
+      pM1 += 2u;
+      pM2 += 2u;
+      pM3 += 2u;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Odd number of columns */
+    if((numCols & 1u) != 0u)
+    {
+      v0 = *pV;
+      sum0 += *pM0 * v0;
+      sum1 += *pM1 * v0;
+      sum2 += *pM2 * v0;
+      sum3 += *pM3 * v0;
+    }
+
+    *pDst++ = sum0;
+    *pDst++ = sum1;
+    *pDst++ = sum2;
+    *pDst++ = sum3;
+
+    pRow += 4u * numCols;
+
+    /* Decrement the loop counter */
+    row--;
+  }
+
+  /* Remaining 1 to 3 rows */
+  row = numRows % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  row = numRows;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(row > 0u)
+  {
+    pM0 = pRow;
+    pV = pVec;
+    sum0 = 0.0f;
+
+    colCnt = numCols >> 1u;
+
+    while(colCnt > 0u)
+    {
+      v0 = pV[0];
+      v1 = pV[1];
+      pV += 2u;
+      sum0 += pM0[0] * v0;
+      sum0 += pM0[1] * v1;
+      pM0 += 2u;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    if((numCols & 1u) != 0u)
+    {
+      sum0 += *pM0 * *pV;
+    }
+
+    *pDst++ = sum0;
+
+    pRow += numCols;
+
+    /* Decrement the loop counter */
+    row--;
+  }
+}
+
+/**    
+ * @} end of MatrixVectMult group    
+ */
@@ -0,0 +1,217 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_vec_mult_q15.c   
+*    
+* Description:	Q15 matrix times vector.    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixVectMult    
+ * @{    
+ */
+
+/**    
+ * @brief Q15 matrix times vector.    
+ * @param[in]       *pSrcMat points to the matrix    
+ * @param[in]       *pVec points to the input vector    
+ * @param[out]      *pDst points to the output vector    
+ * @return none.    
+ *    
+ * \par    
+ * Four rows are processed together, so every vector value is loaded once per    
+ * four rows, and matrix and vector are read two values at a time with dual    
+ * multiply-accumulates.    
+ *    
+ * @details    
+ * <b>Scaling and Overflow Behavior:</b>    
+ *    
+ * \par    
+ * The function is implemented using a 64-bit internal accumulator. The inputs to the    
+ * multiplications are in 1.15 format and multiplications yield a 2.30 result.    
+ * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.    
+ * This approach provides 33 guard bits and there is no risk of overflow. The 34.30 result    
+ * is then truncated to 34.15 format by discarding the low 15 bits and then saturated to    
+ * 1.15 format.    
+ */
+
+void arm_mat_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+  q15_t * pDst)
+{
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows */
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns */
+  const q15_t *pRow = pSrcMat->pData;            /* first row of the current group */
+  const q15_t *pM0;                              /* matrix row pointer */
+  const q15_t *pV;                               /* vector pointer */
+  q63_t sum0;                                    /* accumulator */
+  uint32_t row, colCnt;                          /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  const q15_t *pM1, *pM2, *pM3;                  /* matrix row pointers */
+  q63_t sum1, sum2, sum3;                        /* accumulators */
+  q31_t v01;                                     /* two vector values */
+  q15_t v0;                                      /* vector value */
+
+  /* Four rows at a time */
+  row = numRows >> 2u;
+
+  while(row > 0u)
+  {
+    pM0 = pRow;
+    pM1 = pM0 + numCols;
+    pM2 = pM1 + numCols;
+    pM3 = pM2 + numCols;
+    pV = pVec;
+
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+    /* Two columns at a time */
+    colCnt = numCols >> 1u;
+
+    while(colCnt > 0u)
+    {
+      v01 = *__SIMD32(pV)++;
+
+      sum0 = __SMLALD(*__SIMD32(pM0)++, v01, sum0);
+      sum1 = __SMLALD(*__SIMD32(pM1)++, v01, sum1);
+      sum2 = __SMLALD(*__SIMD32(pM2)++, v01, sum2);
+      sum3 = __SMLALD(*__SIMD32(pM3)++, v01, sum3);
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Odd number of columns */
+    if((numCols & 1u) != 0u)
+    {
+      v0 = *pV;
+      sum0 += (q31_t) *pM0 * v0;
+      sum1 += (q31_t) *pM1 * v0;
+      sum2 += (q31_t) *pM2 * v0;
+      sum3 += (q31_t) *pM3 * v0;
+    }
+
+    *pDst++ = (q15_t) __SSAT((sum0 >> 15), 16);
+    *pDst++ = (q15_t) __SSAT((sum1 >> 15), 16);
+    *pDst++ = (q15_t) __SSAT((sum2 >> 15), 16);
+    *pDst++ = (q15_t) __SSAT((sum3 >> 15), 16);
+
+    pRow += 4u * numCols;
+
+    /* Decrement the loop counter */
+    row--;
+  }
+
+  /* Remaining 1 to 3 rows */
+  row = numRows % 0x4u;
+
+  while(row > 0u)
+  {
+    pM0 = pRow;
+    pV = pVec;
+    sum0 = 0;
+
+    colCnt = numCols >> 1u;
+
+    while(colCnt > 0u)
+    {
+      sum0 = __SMLALD(*__SIMD32(pM0)++, *__SIMD32(pV)++, sum0);
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    if((numCols & 1u) != 0u)
+    {
+      sum0 += (q31_t) *pM0 * *pV;
+    }
+
+    *pDst++ = (q15_t) __SSAT((sum0 >> 15), 16);
+
+    pRow += numCols;
+
+    /* Decrement the loop counter */
+    row--;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  row = numRows;
+
+  while(row > 0u)
+  {
+    pM0 = pRow;
+    pV = pVec;
+    sum0 = 0;
+
+    colCnt = numCols;
+
+    while(colCnt > 0u)
+    {
+      sum0 += (q31_t) *pM0++ * *pV++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    *pDst++ = (q15_t) __SSAT((sum0 >> 15), 16);
+
+    pRow += numCols;
+
+    /* Decrement the loop counter */
+    row--;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+}
+
+/**    
+ * @} end of MatrixVectMult group    
+ */
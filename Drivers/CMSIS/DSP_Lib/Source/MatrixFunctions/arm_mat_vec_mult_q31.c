@@ -0,0 +1,205 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_vec_mult_q31.c   
+*    
+* Description:	Q31 matrix times vector.    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupMatrix    
+ */
+
+/**    
+ * @addtogroup MatrixVectMult    
+ * @{    
+ */
+
+/**    
+ * @brief Q31 matrix times vector.    
+ * @param[in]       *pSrcMat points to the matrix    
+ * @param[in]       *pVec points to the input vector    
+ * @param[out]      *pDst points to the output vector    
+ * @return none.    
+ *    
+ * \par    
+ * Four rows are processed together, so every vector value is loaded once per    
+ * four rows.    
+ *    
+ * @details    
+ * <b>Scaling and Overflow Behavior:</b>    
+ *    
+ * \par    
+ * The function is implemented using an internal 64-bit accumulator.    
+ * The accumulator has a 2.62 format and maintains full precision of the intermediate    
+ * multiplication results but provides only a single guard bit. There is no saturation    
+ * on intermediate additions. The inputs should be scaled down by log2(numCols) bits    
+ * to avoid overflows, as a total of numCols additions are performed internally.    
+ * The 2.62 accumulator is right shifted by 31 bits and saturated to 1.31 format to yield the final result.    
+ */
+
+void arm_mat_vec_mult_q31(
+  const arm_matrix_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+  q31_t * pDst)
+{
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows */
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns */
+  const q31_t *pRow = pSrcMat->pData;            /* first row of the current group */
+  const q31_t *pM0;                              /* matrix row pointer */
+  const q31_t *pV;                               /* vector pointer */
+  q63_t sum0;                                    /* accumulator */
+  q31_t v0, v1;                                  /* vector values */
+  uint32_t row, colCnt;                          /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  const q31_t *pM1, *pM2, *pM3;                  /* matrix row pointers */
+  q63_t sum1, sum2, sum3;                        /* accumulators */
+
+  /* Four rows at a time */
+  row = numRows >> 2u;
+
+  while(row > 0u)
+  {
+    pM0 = pRow;
+    pM1 = pM0 + numCols;
+    pM2 = pM1 + numCols;
+    pM3 = pM2 + numCols;
+    pV = pVec;
+
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+    /* Two columns at a time */
+    colCnt = numCols >> 1u;
+
+    while(colCnt > 0u)
+    {
+      v0 = pV[0];
+      v1 = pV[1];
+      pV += 2u;
+
+      sum0 += (q63_t) pM0[0] * v0;
+      sum1 += (q63_t) pM1[0] * v0;
+      sum2 += (q63_t) pM2[0] * v0;
+      sum3 += (q63_t) pM3[0] * v0;
+      sum0 += (q63_t) pM0[1] * v1;
+      sum1 += (q63_t) pM1[1] * v1;
+      sum2 += (q63_t) pM2[1] * v1;
+      sum3 += (q63_t) pM3[1] * v1;
+      pM0 += 2u;
+      pM1 += 2u;
+      pM2 += 2u;
+      pM3 += 2u;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Odd number of columns */
+    if((numCols & 1u) != 0u)
+    {
+      v0 = *pV;
+      sum0 += (q63_t) *pM0 * v0;
+      sum1 += (q63_t) *pM1 * v0;
+      sum2 += (q63_t) *pM2 * v0;
+      sum3 += (q63_t) *pM3 * v0;
+    }
+
+    *pDst++ = clip_q63_to_q31(sum0 >> 31);
+    *pDst++ = clip_q63_to_q31(sum1 >> 31);
+    *pDst++ = clip_q63_to_q31(sum2 >> 31);
+    *pDst++ = clip_q63_to_q31(sum3 >> 31);
+
+    pRow += 4u * numCols;
+
+    /* Decrement the loop counter */
+    row--;
+  }
+
+  /* Remaining 1 to 3 rows */
+  row = numRows % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  row = numRows;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(row > 0u)
+  {
+    pM0 = pRow;
+    pV = pVec;
+    sum0 = 0;
+
+    colCnt = numCols >> 1u;
+
+    while(colCnt > 0u)
+    {
+      v0 = pV[0];
+      v1 = pV[1];
+      pV += 2u;
+      sum0 += (q63_t) pM0[0] * v0;
+      sum0 += (q63_t) pM0[1] * v1;
+      pM0 += 2u;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    if((numCols & 1u) != 0u)
+    {
+      sum0 += (q63_t) *pM0 * *pV;
+    }
+
+    *pDst++ = clip_q63_to_q31(sum0 >> 31);
+
+    pRow += numCols;
+
+    /* Decrement the loop counter */
+    row--;
+  }
+}
+
+/**    
+ * @} end of MatrixVectMult group    
+ */
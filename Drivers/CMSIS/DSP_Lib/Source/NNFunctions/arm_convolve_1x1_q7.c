@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_convolve_1x1_q7.c   
+*    
+* Description:	Q7 pointwise (1x1) convolution    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @addtogroup NNConv    
+ * @{    
+ */
+
+/**    
+ * @brief Q7 pointwise (1x1) convolution.    
+ * @param[in]       *S points to an instance of the convolution structure, with a 1x1 kernel and no padding    
+ * @param[in]       *pSrc points to the input tensor    
+ * @param[out]      *pDst points to the output tensor    
+ * @param[in,out]   *pBuffer points to a buffer of <code>2*in.channels</code> Q15 values    
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the kernel is not 1x1 or there is padding.    
+ */
+
+arm_status arm_convolve_1x1_q7(
+  const arm_nn_conv_instance_q7 * S,
+  const q7_t * pSrc,
+  q7_t * pDst,
+  q15_t * pBuffer)
+{
+  uint32_t inCh = S->in.channels;                /* input channels = column length      */
+  q15_t *pCol = pBuffer;                         /* next column in the buffer           */
+  int32_t ox, oy;                                /* output position                     */
+
+  if((S->kernelH != 1u) || (S->kernelW != 1u) || (S->padH != 0u) || (S->padW != 0u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for(oy = 0; oy < S->out.height; oy++)
+  {
+    for(ox = 0; ox < S->out.width; ox++)
+    {
+      /* The input pixel is the column */
+      arm_nn_q7_to_q15_with_offset(pSrc + ((uint32_t) (oy * S->strideH) * S->in.width + (uint32_t) (ox * S->strideW)) * inCh,
+                                   pCol, inCh, (q15_t) S->quant.inOffset);
+      pCol += inCh;
+
+      if(pCol == pBuffer + 2u * inCh)
+      {
+        pDst = arm_nn_mat_mult_kernel_q7_q15(S->pWeights, pBuffer, S->out.channels, inCh,
+                                             S->pBias, &S->quant, pDst);
+        pCol = pBuffer;
+      }
+    }
+  }
+
+  /* Odd number of output pixels */
+  if(pCol != pBuffer)
+  {
+    arm_nn_vec_mat_mult_q7_q15(pBuffer, S->pWeights, S->out.channels, inCh,
+                               S->pBias, &S->quant, pDst);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of NNConv group    
+ */
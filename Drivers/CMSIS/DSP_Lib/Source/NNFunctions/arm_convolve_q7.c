@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_convolve_q7.c   
+*    
+* Description:	Q7 convolution with im2col and SMLAD    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @defgroup NNConv Convolution Layers    
+ *    
+ * Quantized 2D convolutions on HWC tensors. The functions compute for every
+ * output pixel and output channel <code>oc</code>
+ * <pre>    
+ *     acc = bias[oc] + sum((in[y, x, ic] + inOffset) * w[oc, ky, kx, ic])    
+ *     out = clamp(requantize(acc, pMult[oc], pShift[oc]) + outOffset, actMin, actMax)    
+ * </pre>    
+ * with input positions outside the tensor (padding) contributing nothing, the
+ * same as the integer reference of TensorFlow Lite with per-channel weights.
+ *
+ * arm_convolve_q7() is the general case. It expands the patches of two output
+ * pixels into a Q15 buffer (im2col) and multiplies them with the weights in
+ * arm_nn_mat_mult_kernel_q7_q15(). arm_convolve_1x1_q7() skips the patch
+ * gathering, the input pixel already is the column. arm_depthwise_conv_q7()
+ * filters every channel on its own, the weights are
+ * <code>kernelH x kernelW x out.channels</code> and the channel multiplier is
+ * <code>out.channels / in.channels</code>.
+ *
+ * The output size is given in the instance, padding after the input follows
+ * from it.
+ */
+
+/**    
+ * @addtogroup NNConv    
+ * @{    
+ */
+
+/**    
+ * @brief Q7 convolution.    
+ * @param[in]       *S points to an instance of the convolution structure    
+ * @param[in]       *pSrc points to the input tensor    
+ * @param[out]      *pDst points to the output tensor    
+ * @param[in,out]   *pBuffer points to a buffer of <code>2*kernelH*kernelW*in.channels</code> Q15 values    
+ * @return ARM_MATH_SUCCESS.    
+ */
+
+arm_status arm_convolve_q7(
+  const arm_nn_conv_instance_q7 * S,
+  const q7_t * pSrc,
+  q7_t * pDst,
+  q15_t * pBuffer)
+{
+  uint32_t inCh = S->in.channels;                /* input channels                      */
+  uint32_t colLen;                               /* length of one patch                 */
+  q15_t *pCol = pBuffer;                         /* next patch in the buffer            */
+  int32_t ox, oy, kx, ky, ix, iy;                /* output and input positions          */
+
+  colLen = (uint32_t) S->kernelH * S->kernelW * inCh;
+
+  for(oy = 0; oy < S->out.height; oy++)
+  {
+    for(ox = 0; ox < S->out.width; ox++)
+    {
+      /* Gather the patch of this output pixel, padding as zeros */
+      for(ky = 0; ky < S->kernelH; ky++)
+      {
+        iy = oy * S->strideH - S->padH + ky;
+
+        for(kx = 0; kx < S->kernelW; kx++)
+        {
+          ix = ox * S->strideW - S->padW + kx;
+
+          if((iy < 0) || (iy >= S->in.height) || (ix < 0) || (ix >= S->in.width))
+          {
+            memset(pCol, 0, inCh * sizeof(q15_t));
+          }
+          else
+          {
+            arm_nn_q7_to_q15_with_offset(pSrc + ((uint32_t) iy * S->in.width + (uint32_t) ix) * inCh,
+                                         pCol, inCh, (q15_t) S->quant.inOffset);
+          }
+
+          pCol += inCh;
+        }
+      }
+
+      /* Two patches ready, compute both output pixels */
+      if(pCol == pBuffer + 2u * colLen)
+      {
+        pDst = arm_nn_mat_mult_kernel_q7_q15(S->pWeights, pBuffer, S->out.channels, colLen,
+                                             S->pBias, &S->quant, pDst);
+        pCol = pBuffer;
+      }
+    }
+  }
+
+  /* Odd number of output pixels */
+  if(pCol != pBuffer)
+  {
+    arm_nn_vec_mat_mult_q7_q15(pBuffer, S->pWeights, S->out.channels, colLen,
+                               S->pBias, &S->quant, pDst);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of NNConv group    
+ */
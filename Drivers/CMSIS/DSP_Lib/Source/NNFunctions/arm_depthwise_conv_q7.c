@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_depthwise_conv_q7.c   
+*    
+* Description:	Q7 depthwise convolution    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @addtogroup NNConv    
+ * @{    
+ */
+
+/**    
+ * @brief Q7 depthwise convolution.    
+ * @param[in]       *S points to an instance of the convolution structure    
+ * @param[in]       *pSrc points to the input tensor    
+ * @param[out]      *pDst points to the output tensor    
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if out.channels is not a multiple of in.channels.    
+ *    
+ * \par    
+ * Every product feeds a different output channel, so there is nothing to pair
+ * for <code>__SMLAD</code>. The loops instead clip the kernel window to the input
+ * once per output pixel and keep four channel accumulators in registers.
+ */
+
+arm_status arm_depthwise_conv_q7(
+  const arm_nn_conv_instance_q7 * S,
+  const q7_t * pSrc,
+  q7_t * pDst)
+{
+  uint32_t inCh = S->in.channels;                /* input channels                      */
+  uint32_t outCh = S->out.channels;              /* output channels                     */
+  uint32_t mult;                                 /* channel multiplier                  */
+  q31_t inOffset = S->quant.inOffset;            /* added to every input value          */
+  q31_t sum, sum2, sum3, sum4;                   /* channel accumulators                */
+  const q7_t *pIn, *pW;                          /* input pixel and weights             */
+  int32_t ox, oy, kx, ky, ix0, iy0;              /* output and window positions         */
+  int32_t kxStart, kxEnd, kyStart, kyEnd;        /* window clipped to the input         */
+  uint32_t oc, ic;                               /* channel indexes                     */
+
+  if((inCh == 0u) || ((outCh % inCh) != 0u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  mult = outCh / inCh;
+
+  for(oy = 0; oy < S->out.height; oy++)
+  {
+    iy0 = oy * S->strideH - S->padH;
+    kyStart = (iy0 < 0) ? -iy0 : 0;
+    kyEnd = ((iy0 + S->kernelH) > S->in.height) ? (S->in.height - iy0) : S->kernelH;
+
+    for(ox = 0; ox < S->out.width; ox++)
+    {
+      ix0 = ox * S->strideW - S->padW;
+      kxStart = (ix0 < 0) ? -ix0 : 0;
+      kxEnd = ((ix0 + S->kernelW) > S->in.width) ? (S->in.width - ix0) : S->kernelW;
+
+      if(mult == 1u)
+      {
+        /* Four channels at a time */
+        for(oc = 0u; (oc + 4u) <= outCh; oc += 4u)
+        {
+          sum = (S->pBias != NULL) ? S->pBias[oc] : 0;
+          sum2 = (S->pBias != NULL) ? S->pBias[oc + 1u] : 0;
+          sum3 = (S->pBias != NULL) ? S->pBias[oc + 2u] : 0;
+          sum4 = (S->pBias != NULL) ? S->pBias[oc + 3u] : 0;
+
+          for(ky = kyStart; ky < kyEnd; ky++)
+          {
+            pIn = pSrc + ((uint32_t) (iy0 + ky) * S->in.width + (uint32_t) (ix0 + kxStart)) * inCh + oc;
+            pW = S->pWeights + ((uint32_t) ky * S->kernelW + (uint32_t) kxStart) * outCh + oc;
+
+            for(kx = kxStart; kx < kxEnd; kx++)
+            {
+              sum += (pIn[0] + inOffset) * pW[0];
+              sum2 += (pIn[1] + inOffset) * pW[1];
+              sum3 += (pIn[2] + inOffset) * pW[2];
+              sum4 += (pIn[3] + inOffset) * pW[3];
+
+              pIn += inCh;
+              pW += outCh;
+            }
+          }
+
+          *pDst++ = arm_nn_requantize_q7(sum, &S->quant, oc);
+          *pDst++ = arm_nn_requantize_q7(sum2, &S->quant, oc + 1u);
+          *pDst++ = arm_nn_requantize_q7(sum3, &S->quant, oc + 2u);
+          *pDst++ = arm_nn_requantize_q7(sum4, &S->quant, oc + 3u);
+        }
+      }
+      else
+      {
+        oc = 0u;
+      }
+
+      /* Remaining channels, and every channel with a channel multiplier */
+      for(; oc < outCh; oc++)
+      {
+        ic = oc / mult;
+        sum = (S->pBias != NULL) ? S->pBias[oc] : 0;
+
+        for(ky = kyStart; ky < kyEnd; ky++)
+        {
+          pIn = pSrc + ((uint32_t) (iy0 + ky) * S->in.width + (uint32_t) (ix0 + kxStart)) * inCh + ic;
+          pW = S->pWeights + ((uint32_t) ky * S->kernelW + (uint32_t) kxStart) * outCh + oc;
+
+          for(kx = kxStart; kx < kxEnd; kx++)
+          {
+            sum += (*pIn + inOffset) * *pW;
+
+            pIn += inCh;
+            pW += outCh;
+          }
+        }
+
+        *pDst++ = arm_nn_requantize_q7(sum, &S->quant, oc);
+      }
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of NNConv group    
+ */
@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_fully_connected_q7.c   
+*    
+* Description:	Q7 fully connected layer    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @defgroup NNFC Fully Connected Layer    
+ *    
+ * Quantized fully connected layer, the weights are <code>outLen</code> rows of
+ * <code>inLen</code> values.
+ * <pre>    
+ *     acc = bias[o] + sum((in[i] + inOffset) * w[o, i])    
+ *     out[o] = clamp(requantize(acc, pMult[o], pShift[o]) + outOffset, actMin, actMax)    
+ * </pre>    
+ * The quantization is per output, a per-tensor model repeats the same
+ * multiplier and shift. The input is expanded to Q15 once and every pair of
+ * weight rows is multiplied with it through <code>__SMLAD</code>.
+ */
+
+/**    
+ * @addtogroup NNFC    
+ * @{    
+ */
+
+/**    
+ * @brief Q7 fully connected layer.    
+ * @param[in]       *S points to an instance of the fully connected structure    
+ * @param[in]       *pSrc points to the <code>inLen</code> inputs    
+ * @param[out]      *pDst points to the <code>outLen</code> outputs    
+ * @param[in,out]   *pBuffer points to a buffer of <code>inLen</code> Q15 values    
+ * @return none.    
+ */
+
+void arm_fully_connected_q7(
+  const arm_nn_fc_instance_q7 * S,
+  const q7_t * pSrc,
+  q7_t * pDst,
+  q15_t * pBuffer)
+{
+  arm_nn_q7_to_q15_with_offset(pSrc, pBuffer, S->inLen, (q15_t) S->quant.inOffset);
+
+  arm_nn_vec_mat_mult_q7_q15(pBuffer, S->pWeights, S->outLen, S->inLen, S->pBias, &S->quant, pDst);
+}
+
+/**    
+ * @} end of NNFC group    
+ */
@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_max_pool_q7.c   
+*    
+* Description:	Q7 max pooling    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @defgroup NNPool Pooling Layers    
+ *    
+ * Max and average pooling of HWC Q7 tensors, channel by channel. Window
+ * positions outside the input are left out, so the average divides by the
+ * number of input values actually covered and rounds half away from zero.
+ * Input and output share the quantization, the result is only clamped to
+ * <code>[actMin actMax]</code>.
+ */
+
+/**    
+ * @addtogroup NNPool    
+ * @{    
+ */
+
+/**    
+ * @brief Q7 max pooling.    
+ * @param[in]       *S points to an instance of the pooling structure    
+ * @param[in]       *pSrc points to the input tensor    
+ * @param[out]      *pDst points to the output tensor    
+ * @return none.    
+ */
+
+void arm_max_pool_q7(
+  const arm_nn_pool_instance_q7 * S,
+  const q7_t * pSrc,
+  q7_t * pDst)
+{
+  uint32_t ch = S->in.channels;                  /* channels                            */
+  const q7_t *pIn;                               /* input pixel                         */
+  int32_t ox, oy, kx, ky, ix0, iy0;              /* output and window positions         */
+  int32_t kxStart, kxEnd, kyStart, kyEnd;        /* window clipped to the input         */
+  int32_t max;                                   /* running maximum                     */
+  uint32_t c;                                    /* channel                             */
+
+  for(oy = 0; oy < S->out.height; oy++)
+  {
+    iy0 = oy * S->strideH - S->padH;
+    kyStart = (iy0 < 0) ? -iy0 : 0;
+    kyEnd = ((iy0 + S->kernelH) > S->in.height) ? (S->in.height - iy0) : S->kernelH;
+
+    for(ox = 0; ox < S->out.width; ox++)
+    {
+      ix0 = ox * S->strideW - S->padW;
+      kxStart = (ix0 < 0) ? -ix0 : 0;
+      kxEnd = ((ix0 + S->kernelW) > S->in.width) ? (S->in.width - ix0) : S->kernelW;
+
+      for(c = 0u; c < ch; c++)
+      {
+        max = -128;
+
+        for(ky = kyStart; ky < kyEnd; ky++)
+        {
+          pIn = pSrc + ((uint32_t) (iy0 + ky) * S->in.width + (uint32_t) (ix0 + kxStart)) * ch + c;
+
+          for(kx = kxStart; kx < kxEnd; kx++)
+          {
+            max = (*pIn > max) ? *pIn : max;
+            pIn += ch;
+          }
+        }
+
+        max = (max < S->actMin) ? S->actMin : max;
+        max = (max > S->actMax) ? S->actMax : max;
+        *pDst++ = (q7_t) max;
+      }
+    }
+  }
+}
+
+/**    
+ * @} end of NNPool group    
+ */
@@ -0,0 +1,208 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_nn_mat_mult_kernel_q7_q15.c   
+*    
+* Description:	Q7 x Q15 matrix kernel for two output pixels    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @addtogroup NNSupport    
+ * @{    
+ */
+
+/**    
+ * @brief Q7 weights times two expanded Q15 columns, requantized to two Q7 output pixels.    
+ * @param[in]       *pA points to the weights, <code>outCh</code> rows of <code>numCol</code> values    
+ * @param[in]       *pInBuffer points to two adjacent columns of <code>numCol</code> expanded values    
+ * @param[in]       outCh number of output channels (rows)    
+ * @param[in]       numCol length of a row and of a column    
+ * @param[in]       *pBias points to <code>outCh</code> biases, NULL for none    
+ * @param[in]       *pQuant points to the output quantization    
+ * @param[out]      *pOut points to the two output pixels, <code>2*outCh</code> values    
+ * @return points just past the second output pixel.    
+ *    
+ * \par    
+ * Two rows and two columns are processed together, so every weight and every
+ * column value loaded feeds two <code>__SMLAD</code> accumulations.
+ */
+
+q7_t * arm_nn_mat_mult_kernel_q7_q15(
+  const q7_t * pA,
+  const q15_t * pInBuffer,
+  uint16_t outCh,
+  uint32_t numCol,
+  const q31_t * pBias,
+  const arm_nn_quant_q7 * pQuant,
+  q7_t * pOut)
+{
+  q7_t *pOut2 = pOut + outCh;                    /* second output pixel                 */
+  const q7_t *pA2;                               /* second weight row                   */
+  const q15_t *pB, *pB2;                         /* first and second column             */
+  q31_t sum, sum2, sum3, sum4;                   /* row x column accumulators           */
+  uint32_t ch = 0u;                              /* output channel                      */
+  uint32_t colCnt;                               /* loop counter                        */
+  uint16_t rowCnt;                               /* loop counter                        */
+
+#ifndef ARM_MATH_CM0_FAMILY
+  q31_t inA, inA2, a1, a2, a21, a22;             /* packed weights                      */
+  q31_t b1, b2, b3, b4;                          /* packed column values                */
+#endif
+
+  /* Two rows at a time */
+  rowCnt = outCh >> 1u;
+
+  while(rowCnt > 0u)
+  {
+    pB = pInBuffer;
+    pB2 = pB + numCol;
+    pA2 = pA + numCol;
+
+    sum = (pBias != NULL) ? pBias[ch] : 0;
+    sum2 = sum;
+    sum3 = (pBias != NULL) ? pBias[ch + 1u] : 0;
+    sum4 = sum3;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    colCnt = numCol >> 2u;
+
+    while(colCnt > 0u)
+    {
+      /* Expand four weights of each row to two Q15 pairs in memory order */
+      inA = *__SIMD32(pA)++;
+      inA2 = *__SIMD32(pA2)++;
+      a1 = __SXTB16(inA);
+      a2 = __SXTB16(__ROR(inA, 8));
+      a21 = __SXTB16(inA2);
+      a22 = __SXTB16(__ROR(inA2, 8));
+#ifndef ARM_MATH_BIG_ENDIAN
+      inA = __PKHBT(a1, a2, 16);
+      a2 = __PKHTB(a2, a1, 16);
+      a1 = inA;
+      inA2 = __PKHBT(a21, a22, 16);
+      a22 = __PKHTB(a22, a21, 16);
+      a21 = inA2;
+#else
+      inA = __PKHTB(a2, a1, 16);
+      a2 = __PKHBT(a1, a2, 16);
+      a1 = inA;
+      inA2 = __PKHTB(a22, a21, 16);
+      a22 = __PKHBT(a21, a22, 16);
+      a21 = inA2;
+#endif
+
+      b1 = *__SIMD32(pB)++;
+      b2 = *__SIMD32(pB)++;
+      b3 = *__SIMD32(pB2)++;
+      b4 = *__SIMD32(pB2)++;
+
+      sum = __SMLAD(a1, b1, sum);
+      sum = __SMLAD(a2, b2, sum);
+      sum2 = __SMLAD(a1, b3, sum2);
+      sum2 = __SMLAD(a2, b4, sum2);
+      sum3 = __SMLAD(a21, b1, sum3);
+      sum3 = __SMLAD(a22, b2, sum3);
+      sum4 = __SMLAD(a21, b3, sum4);
+      sum4 = __SMLAD(a22, b4, sum4);
+
+      colCnt--;
+    }
+
+    colCnt = numCol & 0x3u;
+
+#else
+
+    colCnt = numCol;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(colCnt > 0u)
+    {
+      sum += (q31_t) *pA * *pB;
+      sum2 += (q31_t) *pA++ * *pB2;
+      sum3 += (q31_t) *pA2 * *pB++;
+      sum4 += (q31_t) *pA2++ * *pB2++;
+
+      colCnt--;
+    }
+
+    *pOut++ = arm_nn_requantize_q7(sum, pQuant, ch);
+    *pOut2++ = arm_nn_requantize_q7(sum2, pQuant, ch);
+    *pOut++ = arm_nn_requantize_q7(sum3, pQuant, ch + 1u);
+    *pOut2++ = arm_nn_requantize_q7(sum4, pQuant, ch + 1u);
+
+    /* Skip the second row, already consumed through pA2 */
+    pA = pA2;
+    ch += 2u;
+
+    rowCnt--;
+  }
+
+  /* Last row when outCh is odd */
+  if((outCh & 1u) != 0u)
+  {
+    pB = pInBuffer;
+    pB2 = pB + numCol;
+
+    sum = (pBias != NULL) ? pBias[ch] : 0;
+    sum2 = sum;
+
+    colCnt = numCol;
+
+    while(colCnt > 0u)
+    {
+      sum += (q31_t) *pA * *pB++;
+      sum2 += (q31_t) *pA++ * *pB2++;
+
+      colCnt--;
+    }
+
+    *pOut++ = arm_nn_requantize_q7(sum, pQuant, ch);
+    *pOut2++ = arm_nn_requantize_q7(sum2, pQuant, ch);
+  }
+
+  return pOut2;
+}
+
+/**    
+ * @} end of NNSupport group    
+ */
@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_relu_q7.c   
+*    
+* Description:	Q7 in-place ReLU    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @defgroup NNAct Activation Layers    
+ *    
+ * arm_relu_q7() clamps negative values to zero in place, for tensors with a
+ * zero point of 0; with another zero point use the <code>actMin</code> clamp of
+ * the layer before instead. arm_softmax_q7() normalizes a vector of logits
+ * to probabilities in the TensorFlow Lite int8 convention, scale 1/256 and
+ * zero point -128. Its exponentials come from a 256 entry table built once by
+ * arm_softmax_init_q7() for the input scale, so the function itself is
+ * integer only: <code>out = round(256 * e[i] / sum(e)) - 128</code> with
+ * <code>e[i] = table[max - in[i]]</code>.
+ */
+
+/**    
+ * @addtogroup NNAct    
+ * @{    
+ */
+
+/**    
+ * @brief Q7 ReLU, in place.    
+ * @param[in,out]   *pData points to the values    
+ * @param[in]       blockSize number of values    
+ * @return none.    
+ */
+
+void arm_relu_q7(
+  q7_t * pData,
+  uint32_t blockSize)
+{
+  q7_t *pIn = pData;                             /* input pointer                       */
+  q7_t *pOut = pData;                            /* output pointer                      */
+  uint32_t blkCnt;                               /* loop counter                        */
+  q31_t in;                                      /* input value(s)                      */
+
+#ifndef ARM_MATH_CM0_FAMILY
+  q31_t mask;                                    /* sign mask of four values            */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    in = *__SIMD32(pIn)++;
+
+    /* Move the sign bits to bit 0 of each byte, then 0 - 1 gives 0xFF for the negative bytes */
+    mask = (q31_t) __ROR((uint32_t) in & 0x80808080u, 7u);
+    mask = (q31_t) __QSUB8(0, (uint32_t) mask);
+
+    *__SIMD32(pOut)++ = in & ~mask;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    in = *pIn++;
+    *pOut++ = (in < 0) ? 0 : (q7_t) in;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of NNAct group    
+ */
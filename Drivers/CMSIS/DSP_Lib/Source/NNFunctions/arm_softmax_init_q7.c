@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_softmax_init_q7.c   
+*    
+* Description:	Q7 softmax table initialization    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @addtogroup NNAct    
+ * @{    
+ */
+
+/**    
+ * @brief Builds the exponential table of the Q7 softmax.    
+ * @param[out]      *pTable points to 256 Q15 values    
+ * @param[in]       scale input scale, the real value of one logit step    
+ * @return none.    
+ *    
+ * <pre>    
+ *     pTable[d] = round(32768 * exp(-d * scale)),   0 <= d < 256, at most 0x7FFF.    
+ * </pre>    
+ */
+
+void arm_softmax_init_q7(
+  q15_t * pTable,
+  float32_t scale)
+{
+  float32_t x[16];                               /* one chunk of arguments              */
+  float32_t y;                                   /* scaled exponential                  */
+  uint32_t d, i;                                 /* table index                         */
+
+  for(d = 0u; d < 256u; d += 16u)
+  {
+    for(i = 0u; i < 16u; i++)
+    {
+      x[i] = -(float32_t) (d + i) * scale;
+    }
+
+    arm_vexp_f32(x, x, 16u);
+
+    for(i = 0u; i < 16u; i++)
+    {
+      y = x[i] * 32768.0f + 0.5f;
+      pTable[d + i] = (y >= 32767.0f) ? 0x7FFF : (q15_t) y;
+    }
+  }
+}
+
+/**    
+ * @} end of NNAct group    
+ */
@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_softmax_q7.c   
+*    
+* Description:	Q7 softmax    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupNN    
+ */
+
+/**    
+ * @addtogroup NNAct    
+ * @{    
+ */
+
+/**    
+ * @brief Q7 softmax.    
+ * @param[in]       *pSrc points to the logits    
+ * @param[out]      *pDst points to the probabilities, scale 1/256 and zero point -128    
+ * @param[in]       blockSize number of values    
+ * @param[in]       *pTable points to the table built by arm_softmax_init_q7()    
+ * @return none.    
+ */
+
+void arm_softmax_q7(
+  const q7_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize,
+  const q15_t * pTable)
+{
+  int32_t max = -128;                            /* largest logit                       */
+  uint32_t sum = 0u;                             /* sum of the exponentials             */
+  uint32_t e;                                    /* one exponential                     */
+  int32_t out;                                   /* one probability                     */
+  uint32_t i;                                    /* loop counter                        */
+
+  for(i = 0u; i < blockSize; i++)
+  {
+    max = (pSrc[i] > max) ? pSrc[i] : max;
+  }
+
+  for(i = 0u; i < blockSize; i++)
+  {
+    sum += (uint32_t) pTable[max - pSrc[i]];
+  }
+
+  for(i = 0u; i < blockSize; i++)
+  {
+    e = (uint32_t) pTable[max - pSrc[i]];
+    out = (int32_t) (((e << 8) + (sum >> 1)) / sum) - 128;
+    pDst[i] = (q7_t) ((out > 127) ? 127 : out);
+  }
+}
+
+/**    
+ * @} end of NNAct group    
+ */
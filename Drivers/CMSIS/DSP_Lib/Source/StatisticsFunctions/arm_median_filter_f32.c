@@ -0,0 +1,376 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_median_filter_f32.c   
+*    
+* Description:	Floating-point median and percentile filter    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @defgroup MedianFilter Median and Percentile Filters    
+ *    
+ * The median filter replaces every sample by the median of the last <code>windowLen</code> (W) input samples,    
+ * which removes impulse noise (spikes, dropouts) while keeping steps and edges sharp, unlike a linear low-pass    
+ * filter.  More generally the output can be any order statistic of the window: with <code>rank</code> r the    
+ * output is the (r+1)-th smallest sample of the window, so <code>r = (W-1)/2</code> is the median, <code>r = 0</code>    
+ * a running minimum (erosion) and <code>r = W-1</code> a running maximum (dilation).    
+ * There are separate functions for floating-point, Q31 and Q15 data types.    
+ *    
+ * \par Algorithm    
+ * The window is kept in an indexed double heap: the samples below the output form a max-heap, those above it    
+ * a min-heap, and the output sits at their common root.  Each new sample replaces the oldest one in place and is    
+ * moved up or down its heap, crossing the root when it changes sides, so every sample costs <code>O(log W)</code>    
+ * comparisons whatever the window length and no sort is ever done.    
+ * \par    
+ * Windows of 3 and 5 samples take a fast path instead: the whole window is sorted in core registers by a fixed    
+ * comparator network of 3 or 9 compare-exchanges, without branches on the data and without the heap indexes.    
+ * Larger networks cost <code>O(W log^2 W)</code> per sample and are already slower than the heap for 7 samples.    
+ * \par    
+ * The window is cleared by the initialization function, so the first <code>W-1</code> outputs see zeros in place of    
+ * the samples before the first one, as the FIR filters do.    
+ *    
+ * \par Instance Structure    
+ * The window and heap indexes are stored in an instance data structure.  A separate instance structure must be defined    
+ * for each filter, and must be set up by the initialization function; the window buffer <code>pData</code> holds    
+ * <code>windowLen</code> samples and the index buffer <code>pIndex</code> holds <code>2*windowLen</code> values, it is not    
+ * used and may be NULL for windows of 3 and 5 samples.    
+ * \par    
+ * The percentile of a whole block, rather than of a sliding window, is computed by <code>arm_percentile_f32()</code>.    
+ */
+
+/**    
+ * @addtogroup MedianFilter    
+ * @{    
+ */
+
+/* Compare-exchange of two samples held in registers, leaves the smaller one in a */
+#define ARM_MEDIAN_SORT2(a, b)  t = ((a) < (b)) ? (a) : (b); (b) = ((a) < (b)) ? (b) : (a); (a) = t
+
+/**    
+ * @brief Median filter of a window of 3 samples, sorted in registers by a 3 comparator network.    
+ */
+
+static void arm_median_filter_net3_f32(
+  arm_median_filter_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pData = S->pData;                   /*  window samples                        */
+  float32_t w0, w1, w2;                          /*  window, sorted by the network         */
+  float32_t t;                                   /*  temporary                             */
+  float32_t sorted[3];                           /*  sorted window, indexed by the rank    */
+  uint32_t pos = S->pos;                         /*  ring position of the oldest sample    */
+
+  while(blockSize > 0u)
+  {
+    /* Replace the oldest sample, the network does not depend on the order of the window */
+    pData[pos] = *pSrc++;
+    pos = (pos == 2u) ? 0u : (pos + 1u);
+
+    w0 = pData[0];
+    w1 = pData[1];
+    w2 = pData[2];
+
+    ARM_MEDIAN_SORT2(w0, w2);
+    ARM_MEDIAN_SORT2(w0, w1);
+    ARM_MEDIAN_SORT2(w1, w2);
+
+    sorted[0] = w0;
+    sorted[1] = w1;
+    sorted[2] = w2;
+
+    *pDst++ = sorted[S->rank];
+
+    /* Decrement the loop counter */
+    blockSize--;
+  }
+
+  S->pos = (uint16_t) pos;
+}
+
+/**    
+ * @brief Median filter of a window of 5 samples, sorted in registers by a 9 comparator network.    
+ */
+
+static void arm_median_filter_net5_f32(
+  arm_median_filter_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pData = S->pData;                   /*  window samples                        */
+  float32_t w0, w1, w2, w3, w4;                  /*  window, sorted by the network         */
+  float32_t t;                                   /*  temporary                             */
+  float32_t sorted[5];                           /*  sorted window, indexed by the rank    */
+  uint32_t pos = S->pos;                         /*  ring position of the oldest sample    */
+
+  while(blockSize > 0u)
+  {
+    /* Replace the oldest sample, the network does not depend on the order of the window */
+    pData[pos] = *pSrc++;
+    pos = (pos == 4u) ? 0u : (pos + 1u);
+
+    w0 = pData[0];
+    w1 = pData[1];
+    w2 = pData[2];
+    w3 = pData[3];
+    w4 = pData[4];
+
+    ARM_MEDIAN_SORT2(w0, w4);
+    ARM_MEDIAN_SORT2(w0, w2);
+    ARM_MEDIAN_SORT2(w1, w3);
+    ARM_MEDIAN_SORT2(w2, w4);
+    ARM_MEDIAN_SORT2(w0, w1);
+    ARM_MEDIAN_SORT2(w2, w3);
+    ARM_MEDIAN_SORT2(w1, w4);
+    ARM_MEDIAN_SORT2(w1, w2);
+    ARM_MEDIAN_SORT2(w3, w4);
+
+    sorted[0] = w0;
+    sorted[1] = w1;
+    sorted[2] = w2;
+    sorted[3] = w3;
+    sorted[4] = w4;
+
+    *pDst++ = sorted[S->rank];
+
+    /* Decrement the loop counter */
+    blockSize--;
+  }
+
+  S->pos = (uint16_t) pos;
+}
+
+/**    
+ * @brief Exchanges the heap slots i and j when the sample in slot i is smaller than the one in slot j.    
+ * @return 1 if the samples were exchanged.    
+ */
+
+static __INLINE uint32_t arm_median_filter_exch_f32(
+  const float32_t * pData,
+  int16_t * pHeap,
+  int16_t * pPos,
+  int32_t i,
+  int32_t j)
+{
+  int16_t k;
+
+  if(pData[pHeap[i]] < pData[pHeap[j]])
+  {
+    k = pHeap[i];
+    pHeap[i] = pHeap[j];
+    pHeap[j] = k;
+    pPos[pHeap[i]] = (int16_t) i;
+    pPos[pHeap[j]] = (int16_t) j;
+    return (1u);
+  }
+
+  return (0u);
+}
+
+/**    
+ * @brief Moves the sample in slot i/2 of the min-heap (slots 1 ... numHi) down to its place.    
+ */
+
+static void arm_median_filter_down_hi_f32(
+  const float32_t * pData,
+  int16_t * pHeap,
+  int16_t * pPos,
+  int32_t i,
+  int32_t numHi)
+{
+  for(; i <= numHi; i *= 2)
+  {
+    /* Pick the smaller child, slot 1 is the only child of the root */
+    if((i > 1) && (i < numHi) && (pData[pHeap[i + 1]] < pData[pHeap[i]]))
+    {
+      i++;
+    }
+
+    if(arm_median_filter_exch_f32(pData, pHeap, pPos, i, i / 2) == 0u)
+    {
+      break;
+    }
+  }
+}
+
+/**    
+ * @brief Moves the sample in slot i/2 of the max-heap (slots -1 ... -numLo) down to its place.    
+ */
+
+static void arm_median_filter_down_lo_f32(
+  const float32_t * pData,
+  int16_t * pHeap,
+  int16_t * pPos,
+  int32_t i,
+  int32_t numLo)
+{
+  for(; i >= -numLo; i *= 2)
+  {
+    /* Pick the larger child, slot -1 is the only child of the root */
+    if((i < -1) && (i > -numLo) && (pData[pHeap[i]] < pData[pHeap[i - 1]]))
+    {
+      i--;
+    }
+
+    if(arm_median_filter_exch_f32(pData, pHeap, pPos, i / 2, i) == 0u)
+    {
+      break;
+    }
+  }
+}
+
+/**    
+ * @brief Processing function for the floating-point median filter.    
+ * @param[in,out] *S         points to an instance of the floating-point median filter structure.    
+ * @param[in]     *pSrc      points to the block of input data.    
+ * @param[out]    *pDst      points to the block of output data, may be the same as <code>pSrc</code>.    
+ * @param[in]     blockSize  number of samples to process.    
+ * @return none.    
+ */
+
+void arm_median_filter_f32(
+  arm_median_filter_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pData = S->pData;                   /*  window samples                        */
+  int16_t *pHeap = S->pHeap;                     /*  heap slots, the root is slot 0        */
+  int16_t *pPos = S->pPos;                       /*  heap slot of every window sample      */
+  int32_t numLo = (int32_t) S->rank;             /*  size of the max-heap below the root   */
+  int32_t numHi;                                 /*  size of the min-heap above the root   */
+  int32_t i;                                     /*  heap slot of the replaced sample      */
+  uint32_t pos = S->pos;                         /*  ring position of the oldest sample    */
+  float32_t in, old;                             /*  new and replaced samples              */
+
+  if(pPos == NULL)
+  {
+    /* Windows sorted by a network */
+    if(S->windowLen == 3u)
+    {
+      arm_median_filter_net3_f32(S, pSrc, pDst, blockSize);
+    }
+    else
+    {
+      arm_median_filter_net5_f32(S, pSrc, pDst, blockSize);
+    }
+
+    return;
+  }
+
+  numHi = (int32_t) S->windowLen - 1 - numLo;
+
+  while(blockSize > 0u)
+  {
+    /* Replace the oldest sample of the window */
+    in = *pSrc++;
+    old = pData[pos];
+    pData[pos] = in;
+    i = pPos[pos];
+
+    pos++;
+    if(pos == S->windowLen)
+    {
+      pos = 0u;
+    }
+
+    if(i > 0)
+    {
+      /* Above the root: a larger sample sinks in the min-heap, a smaller one rises and may cross the root */
+      if(old < in)
+      {
+        arm_median_filter_down_hi_f32(pData, pHeap, pPos, 2 * i, numHi);
+      }
+      else
+      {
+        while((i > 0) && (arm_median_filter_exch_f32(pData, pHeap, pPos, i, i / 2) != 0u))
+        {
+          i /= 2;
+        }
+
+        if(i == 0)
+        {
+          arm_median_filter_down_lo_f32(pData, pHeap, pPos, -1, numLo);
+        }
+      }
+    }
+    else if(i < 0)
+    {
+      /* Below the root: the same with the max-heap */
+      if(in < old)
+      {
+        arm_median_filter_down_lo_f32(pData, pHeap, pPos, 2 * i, numLo);
+      }
+      else
+      {
+        while((i < 0) && (arm_median_filter_exch_f32(pData, pHeap, pPos, i / 2, i) != 0u))
+        {
+          i /= 2;
+        }
+
+        if(i == 0)
+        {
+          arm_median_filter_down_hi_f32(pData, pHeap, pPos, 1, numHi);
+        }
+      }
+    }
+    else
+    {
+      /* The root itself was replaced: it may move to either side */
+      arm_median_filter_down_lo_f32(pData, pHeap, pPos, -1, numLo);
+      arm_median_filter_down_hi_f32(pData, pHeap, pPos, 1, numHi);
+    }
+
+    /* The root is the output */
+    *pDst++ = pData[pHeap[0]];
+
+    /* Decrement the loop counter */
+    blockSize--;
+  }
+
+  S->pos = (uint16_t) pos;
+}
+
+/**    
+ * @} end of MedianFilter group    
+ */
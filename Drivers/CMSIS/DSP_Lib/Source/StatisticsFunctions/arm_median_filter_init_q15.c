@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_median_filter_init_q15.c   
+*    
+* Description:	Q15 median filter initialization function    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @addtogroup MedianFilter    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the Q15 median filter.    
+ * @param[in,out] *S         points to an instance of the Q15 median filter structure.    
+ * @param[in]     windowLen  number of samples in the window, from 1 to 32767.    
+ * @param[in]     rank       rank of the output in the window, 0 for the minimum, <code>(windowLen-1)/2</code> for the median and <code>windowLen-1</code> for the maximum.    
+ * @param[in]     *pData     points to the window buffer of <code>windowLen</code> samples.    
+ * @param[in]     *pIndex    points to the index buffer of <code>2*windowLen</code> values, may be NULL for windows of 3 and 5 samples.    
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or    
+ * ARM_MATH_ARGUMENT_ERROR if <code>windowLen</code> is out of range, <code>rank</code> is not less than <code>windowLen</code> or    
+ * <code>pIndex</code> is NULL for a window that needs it.    
+ *    
+ * \par    
+ * The window is cleared and the heaps are set up over it, the sample in ring position <code>n</code> in heap slot    
+ * <code>n - rank</code>.    
+ */
+
+arm_status arm_median_filter_init_q15(
+  arm_median_filter_instance_q15 * S,
+  uint16_t windowLen,
+  uint16_t rank,
+  q15_t * pData,
+  int16_t * pIndex)
+{
+  uint32_t i;
+
+  if((windowLen == 0u) || (windowLen > 32767u) || (rank >= windowLen))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->windowLen = windowLen;
+  S->rank = rank;
+  S->pos = 0u;
+  S->pData = pData;
+
+  /* Clear the window */
+  memset(pData, 0, windowLen * sizeof(q15_t));
+
+  if((windowLen == 3u) || (windowLen == 5u))
+  {
+    /* Sorting network, no heap */
+    S->pPos = NULL;
+    S->pHeap = NULL;
+  }
+  else
+  {
+    if(pIndex == NULL)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* Heap slots -rank ... windowLen-1-rank, the window is all zeros so any order is a valid heap */
+    S->pPos = pIndex;
+    S->pHeap = pIndex + windowLen + rank;
+
+    for(i = 0u; i < windowLen; i++)
+    {
+      S->pPos[i] = (int16_t) ((int32_t) i - (int32_t) rank);
+      S->pHeap[(int32_t) i - (int32_t) rank] = (int16_t) i;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of MedianFilter group    
+ */
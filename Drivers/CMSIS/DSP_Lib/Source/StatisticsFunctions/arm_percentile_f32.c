@@ -0,0 +1,190 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_percentile_f32.c   
+*    
+* Description:	Percentile of a floating-point vector    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @defgroup Percentile Percentile    
+ *    
+ * Computes an order statistic of an array of data: the (rank+1)-th smallest value, so <code>rank = (blockSize-1)/2</code>    
+ * gives the median, and the p-th percentile is <code>rank = p*(blockSize-1)/100</code> rounded.    
+ * There are separate functions for floating-point, Q31 and Q15 data types.    
+ *    
+ * \par Algorithm    
+ * The data is copied to a scratch buffer and partially ordered by quickselect: a median-of-three pivot splits the    
+ * range, only the part holding the wanted rank is kept, and the last few values are placed by insertion sort.    
+ * This takes <code>O(blockSize)</code> operations on average instead of the <code>O(blockSize log blockSize)</code> of a sort.    
+ * The scratch buffer may be the input buffer itself, which is then reordered in place.    
+ */
+
+/**    
+ * @addtogroup Percentile    
+ * @{    
+ */
+
+/* Ranges up to this length are finished by insertion sort */
+#define ARM_PERCENTILE_SMALL  16
+
+/**    
+ * @brief Percentile of a floating-point vector.    
+ * @param[in]       *pSrc      points to the input vector.    
+ * @param[in]       blockSize  length of the input vector.    
+ * @param[in]       rank       rank of the result, from 0 (minimum) to <code>blockSize-1</code> (maximum), larger ranks give the maximum.    
+ * @param[in,out]   *pScratch  points to a buffer of <code>blockSize</code> values, reordered by the function, may be <code>pSrc</code>.    
+ * @param[out]      *pResult   percentile value returned here.    
+ * @return none.    
+ *    
+ * \par    
+ * An empty vector, <code>blockSize = 0</code>, has no percentile: the result is 0 and no data is read.    
+ */
+
+void arm_percentile_f32(
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t rank,
+  float32_t * pScratch,
+  float32_t * pResult)
+{
+  float32_t *p = pScratch;                       /*  values being ordered                  */
+  float32_t pivot, t;                            /*  pivot and temporary                   */
+  int32_t lo, hi, mid, i, j;                     /*  range and partition indexes           */
+  int32_t k = (int32_t) rank;                    /*  wanted index                          */
+
+  if(blockSize == 0u)
+  {
+    *pResult = 0.0f;
+    return;
+  }
+
+  if(rank >= blockSize)
+  {
+    k = (int32_t) blockSize - 1;
+  }
+
+  if(pScratch != pSrc)
+  {
+    arm_copy_f32((float32_t *) pSrc, pScratch, blockSize);
+  }
+
+  lo = 0;
+  hi = (int32_t) blockSize - 1;
+
+  while((hi - lo) > ARM_PERCENTILE_SMALL)
+  {
+    /* Order the first, middle and last values, the middle one is the pivot */
+    mid = lo + ((hi - lo) >> 1);
+
+    if(p[mid] < p[lo])
+    {
+      t = p[mid]; p[mid] = p[lo]; p[lo] = t;
+    }
+    if(p[hi] < p[lo])
+    {
+      t = p[hi]; p[hi] = p[lo]; p[lo] = t;
+    }
+    if(p[hi] < p[mid])
+    {
+      t = p[hi]; p[hi] = p[mid]; p[mid] = t;
+    }
+
+    pivot = p[mid];
+
+    /* Partition: p[lo ... j] <= pivot, p[i ... hi] >= pivot, values in between equal the pivot */
+    i = lo;
+    j = hi;
+
+    while(i <= j)
+    {
+      while(p[i] < pivot)
+      {
+        i++;
+      }
+      while(pivot < p[j])
+      {
+        j--;
+      }
+
+      if(i <= j)
+      {
+        t = p[i]; p[i] = p[j]; p[j] = t;
+        i++;
+        j--;
+      }
+    }
+
+    /* Keep the part holding the wanted index */
+    if(k <= j)
+    {
+      hi = j;
+    }
+    else if(k >= i)
+    {
+      lo = i;
+    }
+    else
+    {
+      *pResult = pivot;
+      return;
+    }
+  }
+
+  /* Insertion sort of what is left */
+  for(i = lo + 1; i <= hi; i++)
+  {
+    t = p[i];
+
+    for(j = i - 1; (j >= lo) && (t < p[j]); j--)
+    {
+      p[j + 1] = p[j];
+    }
+
+    p[j + 1] = t;
+  }
+
+  *pResult = p[k];
+}
+
+/**    
+ * @} end of Percentile group    
+ */
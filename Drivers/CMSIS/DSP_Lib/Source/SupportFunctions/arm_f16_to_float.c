@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_f16_to_float.c   
+*    
+* Description:	Converts the elements of a half-precision vector to single precision.    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupSupport    
+ */
+
+/**    
+ * @defgroup f16_to_x  Convert 16-bit floating point value    
+ *    
+ * <code>float16_t</code> holds an IEEE 754 binary16 value: 1 sign bit, 5 exponent
+ * bits and 10 fraction bits, an 11-bit significand against the 24 bits of
+ * <code>float32_t</code>. It is a storage format. Coefficient banks, window tables
+ * and buffers kept as <code>float16_t</code> take half the memory and half the
+ * SDRAM or QSPI bandwidth, and the kernels convert them to <code>float32_t</code>
+ * as they are loaded and accumulate in single precision.
+ *
+ * \par Range and accuracy
+ * Normal values cover 6.1e-5 to 65504 with a relative rounding error of at most
+ * 2^-11 (4.9e-4). Smaller values are subnormal with an absolute step of 2^-24
+ * (6.0e-8). arm_float_to_f16() rounds to nearest even, overflows to infinity
+ * and keeps infinities and NaNs. Widening to <code>float32_t</code> is exact.
+ *
+ * \par Hardware conversion
+ * The Cortex-M7 and Cortex-M4 FPUs convert with VCVTB and VCVTT, one instruction
+ * per value. The conversions use them when the compiler supports IEEE
+ * <code>__fp16</code> (<code>__ARM_FP16_FORMAT_IEEE</code>, e.g. gcc and armclang
+ * with <code>-mfp16-format=ieee</code> or ARMCC with <code>--fp16_format=ieee</code>)
+ * and through inline assembly on gcc and armclang otherwise. The other builds,
+ * and the host build, use an integer implementation with identical results.
+ * The hardware paths assume the reset FPSCR settings: round to nearest,
+ * flush-to-zero and alternative half-precision off.
+ */
+
+/**    
+ * @addtogroup f16_to_x    
+ * @{    
+ */
+
+/**    
+ * @brief  Converts the elements of the half-precision vector to single-precision vector.     
+ * @param[in]       *pSrc points to the half-precision input vector    
+ * @param[out]      *pDst points to the single-precision output vector   
+ * @param[in]       blockSize length of the input vector    
+ * @return none.    
+ *    
+ * \par Description:    
+ *    
+ * The conversion is exact:    
+ *   
+ * <pre>    
+ * 	pDst[n] = (float32_t) pSrc[n];   0 <= n < blockSize.    
+ * </pre>    
+ *   
+ */
+
+
+void arm_f16_to_float(
+  const float16_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  const float16_t *pIn = pSrc;                   /* Src pointer */
+  uint32_t blkCnt;                               /* loop counter */
+
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t out1, out2, out3, out4;              /* temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = (float32_t) A */
+    /* read two values at a time, VCVTB and VCVTT convert the two halves of the word */
+    arm_f16x2_to_f32(*__SIMD32(pIn)++, &out1, &out2);
+    arm_f16x2_to_f32(*__SIMD32(pIn)++, &out3, &out4);
+
+    *pDst++ = out1;
+    *pDst++ = out2;
+    *pDst++ = out3;
+    *pDst++ = out4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    /* C = (float32_t) A */
+    *pDst++ = arm_f16_to_f32_1(*pIn++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**    
+ * @} end of f16_to_x group    
+ */
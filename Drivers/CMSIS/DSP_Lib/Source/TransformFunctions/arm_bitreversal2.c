@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_bitreversal2.c   
+*    
+* Description:	Table driven in-place bit reversal used by arm_cfft_f32, arm_cfft_q31 and arm_cfft_q15    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/*    
+* C version of the arm_bitreversal2.S routines, so the library does not depend    
+* on an assembler file and also builds for ARM_MATH_HOST.    
+*    
+* The tables (armBitRevIndexTable*) hold pairs of byte offsets of complex    
+* elements of an 8 byte complex type; every pair is swapped once.    
+*/
+
+/*    
+* @brief  In-place 32 bit reversal function.   
+* @param[in, out] *pSrc        points to the in-place buffer of 32 bit data type.   
+* @param[in]      bitRevLen    bit reversal table length   
+* @param[in]      *pBitRevTab  points to bit reversal table.   
+* @return none.   
+*/
+
+void arm_bitreversal_32(
+uint32_t * pSrc,
+const uint16_t bitRevLen,
+const uint16_t * pBitRevTab)
+{
+  uint32_t a, b, i, tmp;
+
+  for (i = 0u; i < bitRevLen; i += 2u)
+  {
+    a = pBitRevTab[i] >> 2u;
+    b = pBitRevTab[i + 1u] >> 2u;
+
+    /* real part */
+    tmp = pSrc[a];
+    pSrc[a] = pSrc[b];
+    pSrc[b] = tmp;
+
+    /* imaginary part */
+    tmp = pSrc[a + 1u];
+    pSrc[a + 1u] = pSrc[b + 1u];
+    pSrc[b + 1u] = tmp;
+  }
+}
+
+
+/*    
+* @brief  In-place 16 bit reversal function.   
+* @param[in, out] *pSrc        points to the in-place buffer of 16 bit data type.   
+* @param[in]      bitRevLen    bit reversal table length   
+* @param[in]      *pBitRevTab  points to bit reversal table.   
+* @return none.   
+*/
+
+void arm_bitreversal_16(
+uint16_t * pSrc,
+const uint16_t bitRevLen,
+const uint16_t * pBitRevTab)
+{
+  uint32_t a, b, i;
+  uint16_t tmp;
+
+  for (i = 0u; i < bitRevLen; i += 2u)
+  {
+    /* the table is shared with the 32 bit version, q15 complex elements are half as wide */
+    a = pBitRevTab[i] >> 2u;
+    b = pBitRevTab[i + 1u] >> 2u;
+
+    /* real part */
+    tmp = pSrc[a];
+    pSrc[a] = pSrc[b];
+    pSrc[b] = tmp;
+
+    /* imaginary part */
+    tmp = pSrc[a + 1u];
+    pSrc[a + 1u] = pSrc[b + 1u];
+    pSrc[b + 1u] = tmp;
+  }
+}
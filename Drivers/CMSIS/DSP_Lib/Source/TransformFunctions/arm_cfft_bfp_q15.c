@@ -0,0 +1,626 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_cfft_bfp_q15.c   
+*    
+* Description:	Block floating-point Q15 complex FFT processing function    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+extern void arm_bitreversal_16(
+    uint16_t * pSrc,
+    const uint16_t bitRevLen,
+    const uint16_t * pBitRevTable);
+
+arm_status arm_cfft_bfp_guard_q15(
+    const arm_cfft_instance_q15 * S,
+    q15_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    uint32_t guard,
+    int32_t * pExp);
+
+/* Guard bits a stage needs in front of its inputs: a radix-4 butterfly with  
+   twiddles grows a component by up to 4*sqrt(2), a radix-2 butterfly by up  
+   to 2*sqrt(2) and the last radix-4 stage, which has no twiddles, by 4. */
+#define BFP_GUARD_RADIX4    3
+#define BFP_GUARD_RADIX2    2
+#define BFP_GUARD_LAST      2
+
+/**   
+* @ingroup groupTransforms   
+*/
+
+/**
+* @addtogroup ComplexFFT   
+* @{   
+*/
+
+/**   
+* @brief       Processing function for the Q15 block floating-point complex FFT.
+* @param[in]      *S    points to an instance of the Q15 CFFT structure.  
+* @param[in, out] *p1   points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.  
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.  
+* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.  
+* @param[out]    *pExp          points to the block exponent of the result.  
+* @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported length.  
+*  
+* \par Block floating point:  
+* arm_cfft_q15() halves the data at every radix-2 step whether or not it is  
+* needed, so a transform of length N loses log2(N) bits and a quiet input  
+* comes out as little more than rounding noise. This function instead keeps  
+* one exponent for the whole block. Before every stage it looks at the largest  
+* component written by the previous stage (the input for the first stage)  
+* and shifts the stage inputs just enough to keep the stage from overflowing:  
+* to the right, with rounding, when there are fewer guard bits than the stage  
+* can grow by, and to the left when there are more. A full scale input thus  
+* costs the same bits as arm_cfft_q15(), while a block with headroom keeps it  
+* and the twiddle products are rounded instead of truncated.  
+* \par  
+* On return <code>p1</code> holds the transform scaled by <code>2^-*pExp</code>,  
+* the true forward (inverse) DFT <code>X[k] = p1[k] * 2^*pExp</code> in the  
+* units of the input. The inverse is not normalized by 1/fftLen, subtract  
+* log2(fftLen) from the exponent for that. The exponent may be negative  
+* when the input was small.  
+* \par  
+* The instances, twiddle tables and bit reversal tables are the ones of  
+* arm_cfft_q15() (<code>arm_cfft_sR_q15_len16</code> ... <code>arm_cfft_sR_q15_len4096</code>).  
+* The stage maxima come from the OR of <code>x ^ (x << 1)</code> over the  
+* block, whose leading one is found with __CLZ, so they cost two instructions  
+* per word written.  
+*/
+
+arm_status arm_cfft_bfp_q15(
+    const arm_cfft_instance_q15 * S,
+    q15_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    int32_t * pExp)
+{
+  return arm_cfft_bfp_guard_q15(S, p1, ifftFlag, bitReverseFlag, 0u, pExp);
+}
+
+/**    
+* @} end of ComplexFFT group    
+*/
+
+/* sign bit pattern of x, the OR of it over a block has its leading one at 
+   the first bit below the redundant sign bits of the largest component */
+static __INLINE uint32_t arm_cfft_bfp_bits(
+  q31_t x)
+{
+  return ((uint32_t) x ^ ((uint32_t) x << 1));
+}
+
+/* shift that leaves guard redundant sign bits in a block whose sign bit  
+   pattern (of both half words) is bits, negative for a left shift */
+static int32_t arm_cfft_bfp_shift_q15(
+  uint32_t bits,
+  uint32_t guard)
+{
+  bits = (bits | (bits >> 16)) & 0xFFFFu;
+
+  if(bits == 0u)
+    return 0;
+
+  return ((int32_t) guard - (int32_t) (__CLZ(bits) - 16u));
+}
+
+#if !defined(ARM_MATH_CM0_FAMILY) && !defined(ARM_MATH_BIG_ENDIAN)
+
+/* Run the below code for Cortex-M7, Cortex-M4 and Cortex-M3 */
+
+/* rounding shift of both half words of x, to the left if shift is negative */
+static __INLINE q31_t arm_cfft_bfp_scale_q15x2(
+  q31_t x,
+  int32_t shift)
+{
+  q31_t rnd;
+
+  if(shift > 0)
+  {
+    rnd = 1 << (shift - 1);
+    return (__PKHBT(((q31_t) (q15_t) x + rnd) >> shift, ((x >> 16) + rnd) >> shift, 16));
+  }
+
+  /* multiplied up, a left shift of a negative sample is undefined */
+  return (__PKHBT((q31_t) (q15_t) x * (1 << -shift), (x >> 16) * (1 << -shift), 16));
+}
+
+/* x * (cos - j sin), coeff holds (cos, sin), rounded */
+static __INLINE q31_t arm_cfft_bfp_cmplx_mult_q15(
+  q31_t x,
+  q31_t coeff)
+{
+  return (__PKHBT((__SMUAD(coeff, x) + 0x4000) >> 15,
+                  (__SMUSDX(coeff, x) + 0x4000) >> 15, 16));
+}
+
+static uint32_t arm_cfft_bfp_scan_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  uint8_t swap)
+{
+  uint32_t bits = 0u;
+  q31_t in;
+
+  if(swap)
+  {
+    /* the inverse transform is the forward one of the input with real and 
+       imaginary parts exchanged, exchanged back at the end */
+    do
+    {
+      in = _SIMD32_OFFSET(pSrc);
+      in = (q31_t) (((uint32_t) in << 16) | ((uint32_t) in >> 16));
+      *__SIMD32(pSrc)++ = in;
+      bits |= arm_cfft_bfp_bits(in);
+    } while(--fftLen);
+  }
+  else
+  {
+    do
+    {
+      bits |= arm_cfft_bfp_bits(*__SIMD32(pSrc)++);
+    } while(--fftLen);
+  }
+
+  return (bits);
+}
+
+static uint32_t arm_cfft_bfp_radix2_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  const q15_t * pCoef,
+  int32_t shift)
+{
+  q15_t *pSi = pSrc;                             /* top half */
+  q15_t *pSl = pSrc + fftLen;                    /* bottom half */
+  q31_t T, S, R, out;
+  uint32_t bits = 0u, i;
+
+  for (i = fftLen >> 1; i > 0u; i--)
+  {
+    T = _SIMD32_OFFSET(pSi);
+    S = _SIMD32_OFFSET(pSl);
+    if(shift)
+    {
+      T = arm_cfft_bfp_scale_q15x2(T, shift);
+      S = arm_cfft_bfp_scale_q15x2(S, shift);
+    }
+
+    out = __QADD16(T, S);
+    *__SIMD32(pSi)++ = out;
+    bits |= arm_cfft_bfp_bits(out);
+
+    R = __QSUB16(T, S);
+    out = arm_cfft_bfp_cmplx_mult_q15(R, *__SIMD32_CONST(pCoef));
+    pCoef += 2;
+    *__SIMD32(pSl)++ = out;
+    bits |= arm_cfft_bfp_bits(out);
+  }
+
+  return (bits);
+}
+
+static uint32_t arm_cfft_bfp_radix4_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  uint32_t n2,
+  const q15_t * pCoef,
+  uint32_t twidStep,
+  int32_t shift)
+{
+  q15_t *pSi;
+  q31_t xaya, xbyb, xcyc, xdyd, R, S, T, U, out;
+  q31_t C1, C2, C3;
+  uint32_t bits = 0u, ic, j, i0;
+
+  /* the butterflies of a stage are n2 apart, the groups sharing a twiddle   
+     are 4 * n2 long; the last group ends at fftLen, so the two halves of a  
+     radix4by2 transform are done in the same pass */
+  for (j = 0u, ic = 0u; j < n2; j++, ic += twidStep)
+  {
+    C1 = *__SIMD32_CONST(pCoef + (2u * ic));
+    C2 = *__SIMD32_CONST(pCoef + (4u * ic));
+    C3 = *__SIMD32_CONST(pCoef + (6u * ic));
+
+    for (i0 = j; i0 < fftLen; i0 += 4u * n2)
+    {
+      pSi = pSrc + (2u * i0);
+      xaya = _SIMD32_OFFSET(pSi);
+      xbyb = _SIMD32_OFFSET(pSi + (2u * n2));
+      xcyc = _SIMD32_OFFSET(pSi + (4u * n2));
+      xdyd = _SIMD32_OFFSET(pSi + (6u * n2));
+      if(shift)
+      {
+        xaya = arm_cfft_bfp_scale_q15x2(xaya, shift);
+        xbyb = arm_cfft_bfp_scale_q15x2(xbyb, shift);
+        xcyc = arm_cfft_bfp_scale_q15x2(xcyc, shift);
+        xdyd = arm_cfft_bfp_scale_q15x2(xdyd, shift);
+      }
+
+      R = __QADD16(xaya, xcyc);
+      S = __QSUB16(xaya, xcyc);
+      T = __QADD16(xbyb, xdyd);
+      U = __QSUB16(xbyb, xdyd);
+
+      /* xa' = R + T */
+      out = __QADD16(R, T);
+      _SIMD32_OFFSET(pSi) = out;
+      bits |= arm_cfft_bfp_bits(out);
+
+      /* xb' = (R - T) * W2, in the place of arm_radix4_butterfly_q15 */
+      out = arm_cfft_bfp_cmplx_mult_q15(__QSUB16(R, T), C2);
+      _SIMD32_OFFSET(pSi + (2u * n2)) = out;
+      bits |= arm_cfft_bfp_bits(out);
+
+      /* xc' = (S - jU) * W1 */
+      out = arm_cfft_bfp_cmplx_mult_q15(__QSAX(S, U), C1);
+      _SIMD32_OFFSET(pSi + (4u * n2)) = out;
+      bits |= arm_cfft_bfp_bits(out);
+
+      /* xd' = (S + jU) * W3 */
+      out = arm_cfft_bfp_cmplx_mult_q15(__QASX(S, U), C3);
+      _SIMD32_OFFSET(pSi + (6u * n2)) = out;
+      bits |= arm_cfft_bfp_bits(out);
+    }
+  }
+
+  return (bits);
+}
+
+static void arm_cfft_bfp_last_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  int32_t shift,
+  uint8_t swap)
+{
+  q31_t xaya, xbyb, xcyc, xdyd, R, S, T, U;
+  q31_t out0, out1, out2, out3;
+  uint32_t j;
+
+  for (j = fftLen >> 2u; j > 0u; j--)
+  {
+    xaya = _SIMD32_OFFSET(pSrc);
+    xbyb = _SIMD32_OFFSET(pSrc + 2);
+    xcyc = _SIMD32_OFFSET(pSrc + 4);
+    xdyd = _SIMD32_OFFSET(pSrc + 6);
+    if(shift)
+    {
+      xaya = arm_cfft_bfp_scale_q15x2(xaya, shift);
+      xbyb = arm_cfft_bfp_scale_q15x2(xbyb, shift);
+      xcyc = arm_cfft_bfp_scale_q15x2(xcyc, shift);
+      xdyd = arm_cfft_bfp_scale_q15x2(xdyd, shift);
+    }
+
+    R = __QADD16(xaya, xcyc);
+    S = __QSUB16(xaya, xcyc);
+    T = __QADD16(xbyb, xdyd);
+    U = __QSUB16(xbyb, xdyd);
+
+    out0 = __QADD16(R, T);
+    out1 = __QSUB16(R, T);
+    out2 = __QSAX(S, U);
+    out3 = __QASX(S, U);
+    if(swap)
+    {
+      out0 = (q31_t) (((uint32_t) out0 << 16) | ((uint32_t) out0 >> 16));
+      out1 = (q31_t) (((uint32_t) out1 << 16) | ((uint32_t) out1 >> 16));
+      out2 = (q31_t) (((uint32_t) out2 << 16) | ((uint32_t) out2 >> 16));
+      out3 = (q31_t) (((uint32_t) out3 << 16) | ((uint32_t) out3 >> 16));
+    }
+
+    *__SIMD32(pSrc)++ = out0;
+    *__SIMD32(pSrc)++ = out1;
+    *__SIMD32(pSrc)++ = out2;
+    *__SIMD32(pSrc)++ = out3;
+  }
+}
+
+#else
+
+/* Run the below code for Cortex-M0 */
+
+/* rounding shift of x, to the left if shift is negative */
+static __INLINE q31_t arm_cfft_bfp_scale_q15(
+  q31_t x,
+  int32_t shift)
+{
+  if(shift > 0)
+    return ((x + (1 << (shift - 1))) >> shift);
+
+  return (x * (1 << -shift));
+}
+
+static uint32_t arm_cfft_bfp_scan_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  uint8_t swap)
+{
+  uint32_t bits = 0u;
+  q15_t in;
+
+  do
+  {
+    if(swap)
+    {
+      /* the inverse transform is the forward one of the input with real and 
+         imaginary parts exchanged, exchanged back at the end */
+      in = pSrc[0];
+      pSrc[0] = pSrc[1];
+      pSrc[1] = in;
+    }
+    bits |= arm_cfft_bfp_bits(pSrc[0]) | arm_cfft_bfp_bits(pSrc[1]);
+    pSrc += 2u;
+  } while(--fftLen);
+
+  return (bits);
+}
+
+static uint32_t arm_cfft_bfp_radix2_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  const q15_t * pCoef,
+  int32_t shift)
+{
+  q31_t xa, ya, xb, yb, xt, yt, cosVal, sinVal;
+  uint32_t bits = 0u, i, l, n2;
+
+  n2 = fftLen >> 1u;
+  for (i = 0u; i < n2; i++)
+  {
+    cosVal = pCoef[2u * i];
+    sinVal = pCoef[(2u * i) + 1u];
+    l = i + n2;
+
+    xa = arm_cfft_bfp_scale_q15(pSrc[2u * i], shift);
+    ya = arm_cfft_bfp_scale_q15(pSrc[(2u * i) + 1u], shift);
+    xb = arm_cfft_bfp_scale_q15(pSrc[2u * l], shift);
+    yb = arm_cfft_bfp_scale_q15(pSrc[(2u * l) + 1u], shift);
+
+    pSrc[2u * i] = (q15_t) (xa + xb);
+    pSrc[(2u * i) + 1u] = (q15_t) (ya + yb);
+
+    xt = xa - xb;
+    yt = ya - yb;
+    pSrc[2u * l] = (q15_t) ((xt * cosVal + yt * sinVal + 0x4000) >> 15);
+    pSrc[(2u * l) + 1u] = (q15_t) ((yt * cosVal - xt * sinVal + 0x4000) >> 15);
+
+    bits |= arm_cfft_bfp_bits(pSrc[2u * i]) | arm_cfft_bfp_bits(pSrc[(2u * i) + 1u]) |
+            arm_cfft_bfp_bits(pSrc[2u * l]) | arm_cfft_bfp_bits(pSrc[(2u * l) + 1u]);
+  }
+
+  return (bits);
+}
+
+static uint32_t arm_cfft_bfp_radix4_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  uint32_t n2,
+  const q15_t * pCoef,
+  uint32_t twidStep,
+  int32_t shift)
+{
+  q31_t R0, R1, S0, S1, T0, T1, U0, U1, V0, V1;
+  q31_t Co1, Si1, Co2, Si2, Co3, Si3;
+  uint32_t bits = 0u, ic, j, i0, i1, i2, i3, k;
+
+  for (j = 0u, ic = 0u; j < n2; j++, ic += twidStep)
+  {
+    Co1 = pCoef[2u * ic];
+    Si1 = pCoef[(2u * ic) + 1u];
+    Co2 = pCoef[4u * ic];
+    Si2 = pCoef[(4u * ic) + 1u];
+    Co3 = pCoef[6u * ic];
+    Si3 = pCoef[(6u * ic) + 1u];
+
+    for (i0 = j; i0 < fftLen; i0 += 4u * n2)
+    {
+      i1 = i0 + n2;
+      i2 = i1 + n2;
+      i3 = i2 + n2;
+
+      R0 = arm_cfft_bfp_scale_q15(pSrc[2u * i0], shift);
+      R1 = arm_cfft_bfp_scale_q15(pSrc[(2u * i0) + 1u], shift);
+      S0 = arm_cfft_bfp_scale_q15(pSrc[2u * i2], shift);
+      S1 = arm_cfft_bfp_scale_q15(pSrc[(2u * i2) + 1u], shift);
+      T0 = arm_cfft_bfp_scale_q15(pSrc[2u * i1], shift);
+      T1 = arm_cfft_bfp_scale_q15(pSrc[(2u * i1) + 1u], shift);
+      U0 = arm_cfft_bfp_scale_q15(pSrc[2u * i3], shift);
+      U1 = arm_cfft_bfp_scale_q15(pSrc[(2u * i3) + 1u], shift);
+
+      /* R = xa + xc, S = xa - xc, T = xb + xd, U = xb - xd */
+      V0 = R0 - S0;
+      V1 = R1 - S1;
+      R0 = R0 + S0;
+      R1 = R1 + S1;
+      S0 = V0;
+      S1 = V1;
+      V0 = T0 - U0;
+      V1 = T1 - U1;
+      T0 = T0 + U0;
+      T1 = T1 + U1;
+      U0 = V0;
+      U1 = V1;
+
+      /* xa' = R + T */
+      pSrc[2u * i0] = (q15_t) (R0 + T0);
+      pSrc[(2u * i0) + 1u] = (q15_t) (R1 + T1);
+
+      /* xb' = (R - T) * W2, xc' = (S - jU) * W1, xd' = (S + jU) * W3 */
+      V0 = R0 - T0;
+      V1 = R1 - T1;
+      pSrc[2u * i1] = (q15_t) ((V0 * Co2 + V1 * Si2 + 0x4000) >> 15);
+      pSrc[(2u * i1) + 1u] = (q15_t) ((V1 * Co2 - V0 * Si2 + 0x4000) >> 15);
+      V0 = S0 + U1;
+      V1 = S1 - U0;
+      pSrc[2u * i2] = (q15_t) ((V0 * Co1 + V1 * Si1 + 0x4000) >> 15);
+      pSrc[(2u * i2) + 1u] = (q15_t) ((V1 * Co1 - V0 * Si1 + 0x4000) >> 15);
+      V0 = S0 - U1;
+      V1 = S1 + U0;
+      pSrc[2u * i3] = (q15_t) ((V0 * Co3 + V1 * Si3 + 0x4000) >> 15);
+      pSrc[(2u * i3) + 1u] = (q15_t) ((V1 * Co3 - V0 * Si3 + 0x4000) >> 15);
+
+      for (k = 0u; k < 2u; k++)
+      {
+        bits |= arm_cfft_bfp_bits(pSrc[(2u * i0) + k]) | arm_cfft_bfp_bits(pSrc[(2u * i1) + k]) |
+                arm_cfft_bfp_bits(pSrc[(2u * i2) + k]) | arm_cfft_bfp_bits(pSrc[(2u * i3) + k]);
+      }
+    }
+  }
+
+  return (bits);
+}
+
+static void arm_cfft_bfp_last_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  int32_t shift,
+  uint8_t swap)
+{
+  q31_t xa, ya, xb, yb, xc, yc, xd, yd;
+  q31_t R0, R1, S0, S1, T0, T1, U0, U1;
+  uint32_t j, re, im;
+
+  /* real and imaginary parts exchanged back for the inverse */
+  re = swap ? 1u : 0u;
+  im = 1u - re;
+
+  for (j = fftLen >> 2u; j > 0u; j--)
+  {
+    xa = arm_cfft_bfp_scale_q15(pSrc[0], shift);
+    ya = arm_cfft_bfp_scale_q15(pSrc[1], shift);
+    xb = arm_cfft_bfp_scale_q15(pSrc[2], shift);
+    yb = arm_cfft_bfp_scale_q15(pSrc[3], shift);
+    xc = arm_cfft_bfp_scale_q15(pSrc[4], shift);
+    yc = arm_cfft_bfp_scale_q15(pSrc[5], shift);
+    xd = arm_cfft_bfp_scale_q15(pSrc[6], shift);
+    yd = arm_cfft_bfp_scale_q15(pSrc[7], shift);
+
+    R0 = xa + xc;
+    R1 = ya + yc;
+    S0 = xa - xc;
+    S1 = ya - yc;
+    T0 = xb + xd;
+    T1 = yb + yd;
+    U0 = xb - xd;
+    U1 = yb - yd;
+
+    pSrc[re] = (q15_t) (R0 + T0);
+    pSrc[im] = (q15_t) (R1 + T1);
+    pSrc[2u + re] = (q15_t) (R0 - T0);
+    pSrc[2u + im] = (q15_t) (R1 - T1);
+    pSrc[4u + re] = (q15_t) (S0 + U1);
+    pSrc[4u + im] = (q15_t) (S1 - U0);
+    pSrc[6u + re] = (q15_t) (S0 - U1);
+    pSrc[6u + im] = (q15_t) (S1 + U0);
+    pSrc += 8u;
+  }
+}
+
+#endif /* #if !defined(ARM_MATH_CM0_FAMILY) && !defined(ARM_MATH_BIG_ENDIAN) */
+
+/**    
+* @brief  Block floating-point Q15 CFFT with extra guard bits on the output.    
+* @param[in]      *S             points to an instance of the Q15 CFFT structure.    
+* @param[in, out] *p1            points to the complex data buffer, processed in-place.    
+* @param[in]      ifftFlag       selects forward (0) or inverse (1) transform.    
+* @param[in]      bitReverseFlag enables (1) or disables (0) bit reversal of output.    
+* @param[in]      guard          redundant sign bits to leave on the output, for a following stage.    
+* @param[out]     *pExp          points to the block exponent of the result.    
+* @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.    
+*/
+
+arm_status arm_cfft_bfp_guard_q15(
+    const arm_cfft_instance_q15 * S,
+    q15_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    uint32_t guard,
+    int32_t * pExp)
+{
+  uint32_t L = S->fftLen;
+  uint32_t n2 = L;                               /* length of the radix-4 transforms */
+  uint32_t twidStep = 1u;                        /* twiddle step of the current stage */
+  uint32_t bits;                                 /* sign bit pattern of the stage input */
+  int32_t shift, exp = 0;
+
+  switch (L)
+  {
+  case 16u:
+  case 64u:
+  case 256u:
+  case 1024u:
+  case 4096u:
+    bits = arm_cfft_bfp_scan_q15(p1, L, ifftFlag);
+    break;
+
+  case 32u:
+  case 128u:
+  case 512u:
+  case 2048u:
+    /* one radix-2 stage, then radix-4 on both halves as arm_cfft_radix4by2_q15 */
+    bits = arm_cfft_bfp_scan_q15(p1, L, ifftFlag);
+    shift = arm_cfft_bfp_shift_q15(bits, BFP_GUARD_RADIX2);
+    bits = arm_cfft_bfp_radix2_q15(p1, L, S->pTwiddle, shift);
+    exp += shift;
+    n2 = L >> 1u;
+    twidStep = 2u;
+    break;
+
+  default:
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (n2 >>= 2u; n2 > 1u; n2 >>= 2u)
+  {
+    shift = arm_cfft_bfp_shift_q15(bits, BFP_GUARD_RADIX4);
+    bits = arm_cfft_bfp_radix4_q15(p1, L, n2, S->pTwiddle, twidStep, shift);
+    exp += shift;
+    twidStep <<= 2u;
+  }
+
+  shift = arm_cfft_bfp_shift_q15(bits, BFP_GUARD_LAST + guard);
+  arm_cfft_bfp_last_q15(p1, L, shift, ifftFlag);
+  exp += shift;
+
+  if(bitReverseFlag)
+    arm_bitreversal_16((uint16_t *) p1, S->bitRevLength, S->pBitRevTable);
+
+  *pExp = exp;
+
+  return (ARM_MATH_SUCCESS);
+}
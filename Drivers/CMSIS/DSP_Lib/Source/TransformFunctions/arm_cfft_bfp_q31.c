@@ -0,0 +1,391 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_cfft_bfp_q31.c   
+*    
+* Description:	Block floating-point Q31 complex FFT processing function    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+extern void arm_bitreversal_32(
+    uint32_t * pSrc,
+    const uint16_t bitRevLen,
+    const uint16_t * pBitRevTable);
+
+arm_status arm_cfft_bfp_guard_q31(
+    const arm_cfft_instance_q31 * S,
+    q31_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    uint32_t guard,
+    int32_t * pExp);
+
+/* Guard bits a stage needs in front of its inputs, as in arm_cfft_bfp_q15.c */
+#define BFP_GUARD_RADIX4    3
+#define BFP_GUARD_RADIX2    2
+#define BFP_GUARD_LAST      2
+
+/**   
+* @ingroup groupTransforms   
+*/
+
+/**
+* @addtogroup ComplexFFT   
+* @{   
+*/
+
+/**   
+* @brief       Processing function for the Q31 block floating-point complex FFT.
+* @param[in]      *S    points to an instance of the Q31 CFFT structure.  
+* @param[in, out] *p1   points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.  
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.  
+* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.  
+* @param[out]    *pExp          points to the block exponent of the result.  
+* @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported length.  
+*  
+* \par  
+* The Q31 counterpart of arm_cfft_bfp_q15(), with the same scaling rules and  
+* the same meaning of the exponent: <code>X[k] = p1[k] * 2^*pExp</code>. It  
+* uses the instances and tables of arm_cfft_q31(). The twiddle products are  
+* formed in 64 bits and rounded to 32.  
+*/
+
+arm_status arm_cfft_bfp_q31(
+    const arm_cfft_instance_q31 * S,
+    q31_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    int32_t * pExp)
+{
+  return arm_cfft_bfp_guard_q31(S, p1, ifftFlag, bitReverseFlag, 0u, pExp);
+}
+
+/**    
+* @} end of ComplexFFT group    
+*/
+
+/* sign bit pattern of x, the OR of it over a block has its leading one at 
+   the first bit below the redundant sign bits of the largest component */
+static __INLINE uint32_t arm_cfft_bfp_bits(
+  q31_t x)
+{
+  return ((uint32_t) x ^ ((uint32_t) x << 1));
+}
+
+/* shift that leaves guard redundant sign bits in a block whose sign bit  
+   pattern is bits, negative for a left shift */
+static int32_t arm_cfft_bfp_shift_q31(
+  uint32_t bits,
+  uint32_t guard)
+{
+  if(bits == 0u)
+    return 0;
+
+  return ((int32_t) guard - (int32_t) __CLZ(bits));
+}
+
+/* rounding shift of x, to the left if shift is negative */
+static __INLINE q31_t arm_cfft_bfp_scale_q31(
+  q31_t x,
+  int32_t shift)
+{
+  if(shift > 0)
+    return (((x >> (shift - 1)) + 1) >> 1);
+
+  return (x << -shift);
+}
+
+/* (x + jy) * (cos - j sin), rounded */
+#define BFP_CMPLX_MULT_Q31(re, im, x, y, cosVal, sinVal)                         \
+  re = (q31_t) (((q63_t) (x) * (cosVal) + (q63_t) (y) * (sinVal) + 0x40000000) >> 31); \
+  im = (q31_t) (((q63_t) (y) * (cosVal) - (q63_t) (x) * (sinVal) + 0x40000000) >> 31)
+
+static uint32_t arm_cfft_bfp_scan_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  uint8_t swap)
+{
+  uint32_t bits = 0u;
+  q31_t in;
+
+  do
+  {
+    if(swap)
+    {
+      /* the inverse transform is the forward one of the input with real and 
+         imaginary parts exchanged, exchanged back at the end */
+      in = pSrc[0];
+      pSrc[0] = pSrc[1];
+      pSrc[1] = in;
+    }
+    bits |= arm_cfft_bfp_bits(pSrc[0]) | arm_cfft_bfp_bits(pSrc[1]);
+    pSrc += 2u;
+  } while(--fftLen);
+
+  return (bits);
+}
+
+static uint32_t arm_cfft_bfp_radix2_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  const q31_t * pCoef,
+  int32_t shift)
+{
+  q31_t *pSi = pSrc;                             /* top half */
+  q31_t *pSl = pSrc + fftLen;                    /* bottom half */
+  q31_t xa, ya, xb, yb, xt, yt, cosVal, sinVal;
+  uint32_t bits = 0u, i;
+
+  for (i = fftLen >> 1u; i > 0u; i--)
+  {
+    cosVal = *pCoef++;
+    sinVal = *pCoef++;
+
+    xa = arm_cfft_bfp_scale_q31(pSi[0], shift);
+    ya = arm_cfft_bfp_scale_q31(pSi[1], shift);
+    xb = arm_cfft_bfp_scale_q31(pSl[0], shift);
+    yb = arm_cfft_bfp_scale_q31(pSl[1], shift);
+
+    pSi[0] = xa + xb;
+    pSi[1] = ya + yb;
+    xt = xa - xb;
+    yt = ya - yb;
+    BFP_CMPLX_MULT_Q31(pSl[0], pSl[1], xt, yt, cosVal, sinVal);
+
+    bits |= arm_cfft_bfp_bits(pSi[0]) | arm_cfft_bfp_bits(pSi[1]) |
+            arm_cfft_bfp_bits(pSl[0]) | arm_cfft_bfp_bits(pSl[1]);
+    pSi += 2u;
+    pSl += 2u;
+  }
+
+  return (bits);
+}
+
+static uint32_t arm_cfft_bfp_radix4_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  uint32_t n2,
+  const q31_t * pCoef,
+  uint32_t twidStep,
+  int32_t shift)
+{
+  q31_t *pSi;
+  q31_t R0, R1, S0, S1, T0, T1, U0, U1, V0, V1;
+  q31_t Co1, Si1, Co2, Si2, Co3, Si3;
+  uint32_t bits = 0u, ic, j, i0, k;
+
+  /* the butterflies of a stage are n2 apart, the groups sharing a twiddle  
+     are 4 * n2 long; the last group ends at fftLen, so the two halves of a  
+     radix4by2 transform are done in the same pass */
+  for (j = 0u, ic = 0u; j < n2; j++, ic += twidStep)
+  {
+    Co1 = pCoef[2u * ic];
+    Si1 = pCoef[(2u * ic) + 1u];
+    Co2 = pCoef[4u * ic];
+    Si2 = pCoef[(4u * ic) + 1u];
+    Co3 = pCoef[6u * ic];
+    Si3 = pCoef[(6u * ic) + 1u];
+
+    for (i0 = j; i0 < fftLen; i0 += 4u * n2)
+    {
+      pSi = pSrc + (2u * i0);
+
+      /* R = xa + xc, S = xa - xc */
+      R0 = arm_cfft_bfp_scale_q31(pSi[0], shift);
+      R1 = arm_cfft_bfp_scale_q31(pSi[1], shift);
+      V0 = arm_cfft_bfp_scale_q31(pSi[4u * n2], shift);
+      V1 = arm_cfft_bfp_scale_q31(pSi[(4u * n2) + 1u], shift);
+      S0 = R0 - V0;
+      S1 = R1 - V1;
+      R0 = R0 + V0;
+      R1 = R1 + V1;
+
+      /* T = xb + xd, U = xb - xd */
+      T0 = arm_cfft_bfp_scale_q31(pSi[2u * n2], shift);
+      T1 = arm_cfft_bfp_scale_q31(pSi[(2u * n2) + 1u], shift);
+      V0 = arm_cfft_bfp_scale_q31(pSi[6u * n2], shift);
+      V1 = arm_cfft_bfp_scale_q31(pSi[(6u * n2) + 1u], shift);
+      U0 = T0 - V0;
+      U1 = T1 - V1;
+      T0 = T0 + V0;
+      T1 = T1 + V1;
+
+      /* xa' = R + T */
+      pSi[0] = R0 + T0;
+      pSi[1] = R1 + T1;
+
+      /* xb' = (R - T) * W2, in the place of arm_radix4_butterfly_q31 */
+      V0 = R0 - T0;
+      V1 = R1 - T1;
+      BFP_CMPLX_MULT_Q31(pSi[2u * n2], pSi[(2u * n2) + 1u], V0, V1, Co2, Si2);
+
+      /* xc' = (S - jU) * W1 */
+      V0 = S0 + U1;
+      V1 = S1 - U0;
+      BFP_CMPLX_MULT_Q31(pSi[4u * n2], pSi[(4u * n2) + 1u], V0, V1, Co1, Si1);
+
+      /* xd' = (S + jU) * W3 */
+      V0 = S0 - U1;
+      V1 = S1 + U0;
+      BFP_CMPLX_MULT_Q31(pSi[6u * n2], pSi[(6u * n2) + 1u], V0, V1, Co3, Si3);
+
+      for (k = 0u; k < 8u * n2; k += 2u * n2)
+      {
+        bits |= arm_cfft_bfp_bits(pSi[k]) | arm_cfft_bfp_bits(pSi[k + 1u]);
+      }
+    }
+  }
+
+  return (bits);
+}
+
+static void arm_cfft_bfp_last_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  int32_t shift,
+  uint8_t swap)
+{
+  q31_t xa, ya, xb, yb, xc, yc, xd, yd;
+  q31_t R0, R1, S0, S1, T0, T1, U0, U1;
+  uint32_t j, re, im;
+
+  /* real and imaginary parts exchanged back for the inverse */
+  re = swap ? 1u : 0u;
+  im = 1u - re;
+
+  for (j = fftLen >> 2u; j > 0u; j--)
+  {
+    xa = arm_cfft_bfp_scale_q31(pSrc[0], shift);
+    ya = arm_cfft_bfp_scale_q31(pSrc[1], shift);
+    xb = arm_cfft_bfp_scale_q31(pSrc[2], shift);
+    yb = arm_cfft_bfp_scale_q31(pSrc[3], shift);
+    xc = arm_cfft_bfp_scale_q31(pSrc[4], shift);
+    yc = arm_cfft_bfp_scale_q31(pSrc[5], shift);
+    xd = arm_cfft_bfp_scale_q31(pSrc[6], shift);
+    yd = arm_cfft_bfp_scale_q31(pSrc[7], shift);
+
+    R0 = xa + xc;
+    R1 = ya + yc;
+    S0 = xa - xc;
+    S1 = ya - yc;
+    T0 = xb + xd;
+    T1 = yb + yd;
+    U0 = xb - xd;
+    U1 = yb - yd;
+
+    pSrc[re] = R0 + T0;
+    pSrc[im] = R1 + T1;
+    pSrc[2u + re] = R0 - T0;
+    pSrc[2u + im] = R1 - T1;
+    pSrc[4u + re] = S0 + U1;
+    pSrc[4u + im] = S1 - U0;
+    pSrc[6u + re] = S0 - U1;
+    pSrc[6u + im] = S1 + U0;
+    pSrc += 8u;
+  }
+}
+
+/**    
+* @brief  Block floating-point Q31 CFFT with extra guard bits on the output.    
+* @param[in]      *S             points to an instance of the Q31 CFFT structure.    
+* @param[in, out] *p1            points to the complex data buffer, processed in-place.    
+* @param[in]      ifftFlag       selects forward (0) or inverse (1) transform.    
+* @param[in]      bitReverseFlag enables (1) or disables (0) bit reversal of output.    
+* @param[in]      guard          redundant sign bits to leave on the output, for a following stage.    
+* @param[out]     *pExp          points to the block exponent of the result.    
+* @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.    
+*/
+
+arm_status arm_cfft_bfp_guard_q31(
+    const arm_cfft_instance_q31 * S,
+    q31_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    uint32_t guard,
+    int32_t * pExp)
+{
+  uint32_t L = S->fftLen;
+  uint32_t n2 = L;                               /* length of the radix-4 transforms */
+  uint32_t twidStep = 1u;                        /* twiddle step of the current stage */
+  uint32_t bits;                                 /* sign bit pattern of the stage input */
+  int32_t shift, exp = 0;
+
+  switch (L)
+  {
+  case 16u:
+  case 64u:
+  case 256u:
+  case 1024u:
+  case 4096u:
+    bits = arm_cfft_bfp_scan_q31(p1, L, ifftFlag);
+    break;
+
+  case 32u:
+  case 128u:
+  case 512u:
+  case 2048u:
+    /* one radix-2 stage, then radix-4 on both halves as arm_cfft_radix4by2_q31 */
+    bits = arm_cfft_bfp_scan_q31(p1, L, ifftFlag);
+    shift = arm_cfft_bfp_shift_q31(bits, BFP_GUARD_RADIX2);
+    bits = arm_cfft_bfp_radix2_q31(p1, L, S->pTwiddle, shift);
+    exp += shift;
+    n2 = L >> 1u;
+    twidStep = 2u;
+    break;
+
+  default:
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (n2 >>= 2u; n2 > 1u; n2 >>= 2u)
+  {
+    shift = arm_cfft_bfp_shift_q31(bits, BFP_GUARD_RADIX4);
+    bits = arm_cfft_bfp_radix4_q31(p1, L, n2, S->pTwiddle, twidStep, shift);
+    exp += shift;
+    twidStep <<= 2u;
+  }
+
+  shift = arm_cfft_bfp_shift_q31(bits, BFP_GUARD_LAST + guard);
+  arm_cfft_bfp_last_q31(p1, L, shift, ifftFlag);
+  exp += shift;
+
+  if(bitReverseFlag)
+    arm_bitreversal_32((uint32_t *) p1, S->bitRevLength, S->pBitRevTable);
+
+  *pExp = exp;
+
+  return (ARM_MATH_SUCCESS);
+}
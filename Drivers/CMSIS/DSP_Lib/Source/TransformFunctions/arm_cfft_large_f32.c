@@ -0,0 +1,174 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_cfft_large_f32.c   
+*    
+* Description:	Four-step floating-point complex FFT for large lengths    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**   
+* @addtogroup ComplexFFT   
+* @{   
+*/
+
+/**   
+* @brief       Processing function for the floating-point four-step large complex FFT.
+* @param[in]      *S        points to an instance of the floating-point large CFFT structure.  
+* @param[in, out] *pSrc     points to the complex input buffer of size <code>2*fftLen</code>, used as work space and destroyed.  
+* @param[out]     *pDst     points to the complex output buffer of size <code>2*fftLen</code>, must not overlap <code>pSrc</code>.  
+* @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.  
+* @return none.  
+*
+* \par
+* The input is viewed as an <code>N1 x N2</code> matrix, <code>x[n1*N2 + n2]</code>, and transformed in four steps:
+* - <code>N2</code> FFTs of length <code>N1</code> over the columns,
+* - multiplication by the twiddle factors <code>W_N^(n2*k1)</code>, written back in place,
+* - <code>N1</code> FFTs of length <code>N2</code> over the rows,
+* - a transpose into <code>pDst</code>, <code>X[k1 + N1*k2]</code>.
+* \par
+* The sub-FFTs run in the work buffer given to <code>arm_cfft_large_init_f32()</code>, so with the work buffer
+* in DTCM and <code>pSrc</code>/<code>pDst</code> in SDRAM every sample crosses the SDRAM bus four times.
+* Columns and rows are moved <code>blockSize</code> at a time so that each SDRAM access is a run of
+* <code>blockSize</code> consecutive samples rather than a single strided one.
+* The output is in natural order; the inverse transform is scaled by <code>1/fftLen</code>.
+*/
+
+void arm_cfft_large_f32(
+    const arm_cfft_large_instance_f32 * S,
+    float32_t * pSrc,
+    float32_t * pDst,
+    uint8_t ifftFlag)
+{
+    uint32_t N1 = S->N1, N2 = S->N2, B = S->blockSize;
+    uint32_t n1, n2, k1, k2, b, hi, lo;
+    const float32_t *pTw1 = S->colFFT.pTwiddle;   /* W_N1^i, i < N1 */
+    const float32_t *pTw2 = S->pTwiddle;          /* W_N^i,  i < N2 */
+    float32_t *pWork = S->pWork, *pIn, *pOut;
+    float32_t conj, scale, xr, xi, wr, wi, tr, ti;
+
+    /* The inverse transform is conj(FFT(conj(x))) / N */
+    conj  = (ifftFlag == 1u) ? -1.0f : 1.0f;
+    scale = (ifftFlag == 1u) ? (1.0f / (float32_t) S->fftLen) : 1.0f;
+
+    /* Steps 1 and 2: column FFTs and twiddles, B columns at a time */
+    for(n2 = 0u; n2 < N2; n2 += B)
+    {
+        /* Gather: row n1 of the B columns is a run of B samples */
+        for(n1 = 0u; n1 < N1; n1++)
+        {
+            pIn = pSrc + 2u * (n1 * N2 + n2);
+
+            for(b = 0u; b < B; b++)
+            {
+                pWork[2u * (b * N1 + n1)]      = pIn[2u * b];
+                pWork[2u * (b * N1 + n1) + 1u] = conj * pIn[2u * b + 1u];
+            }
+        }
+
+        for(b = 0u; b < B; b++)
+        {
+            pOut = pWork + 2u * b * N1;
+
+            arm_cfft_mixed_f32(&S->colFFT, pOut, 0u);
+
+            /* W_N^((n2+b)*k1) = W_N1^hi * W_N^lo with (n2+b)*k1 = hi*N2 + lo */
+            hi = 0u;
+            lo = 0u;
+
+            for(k1 = 1u; k1 < N1; k1++)
+            {
+                lo += n2 + b;
+
+                if(lo >= N2)
+                {
+                    lo -= N2;
+                    hi++;
+                }
+
+                wr = pTw1[2u * hi] * pTw2[2u * lo]      - pTw1[2u * hi + 1u] * pTw2[2u * lo + 1u];
+                wi = pTw1[2u * hi] * pTw2[2u * lo + 1u] + pTw1[2u * hi + 1u] * pTw2[2u * lo];
+
+                xr = pOut[2u * k1];
+                xi = pOut[2u * k1 + 1u];
+                pOut[2u * k1]      = xr * wr - xi * wi;
+                pOut[2u * k1 + 1u] = xr * wi + xi * wr;
+            }
+        }
+
+        /* Scatter back to the same places */
+        for(k1 = 0u; k1 < N1; k1++)
+        {
+            pOut = pSrc + 2u * (k1 * N2 + n2);
+
+            for(b = 0u; b < B; b++)
+            {
+                pOut[2u * b]      = pWork[2u * (b * N1 + k1)];
+                pOut[2u * b + 1u] = pWork[2u * (b * N1 + k1) + 1u];
+            }
+        }
+    }
+
+    /* Steps 3 and 4: row FFTs and transpose, B rows at a time */
+    for(k1 = 0u; k1 < N1; k1 += B)
+    {
+        /* The B rows are contiguous */
+        memcpy(pWork, pSrc + 2u * k1 * N2, 2u * B * N2 * sizeof(float32_t));
+
+        for(b = 0u; b < B; b++)
+        {
+            arm_cfft_mixed_f32(&S->rowFFT, pWork + 2u * b * N2, 0u);
+        }
+
+        /* Transpose: output k2 of the B rows is a run of B samples */
+        for(k2 = 0u; k2 < N2; k2++)
+        {
+            pOut = pDst + 2u * (k1 + N1 * k2);
+
+            for(b = 0u; b < B; b++)
+            {
+                tr = pWork[2u * (b * N2 + k2)];
+                ti = pWork[2u * (b * N2 + k2) + 1u];
+                pOut[2u * b]      = scale * tr;
+                pOut[2u * b + 1u] = scale * conj * ti;
+            }
+        }
+    }
+}
+
+/**    
+* @} end of ComplexFFT group    
+*/
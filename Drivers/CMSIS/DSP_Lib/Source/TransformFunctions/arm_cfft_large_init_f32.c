@@ -0,0 +1,141 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_cfft_large_init_f32.c   
+*    
+* Description:	Initialization function for the four-step floating-point complex FFT    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**   
+* @addtogroup ComplexFFT   
+* @{   
+*/
+
+/**   
+* @brief  Initialization function for the floating-point four-step large complex FFT.
+* @param[in,out] *S         points to an instance of the floating-point large CFFT structure.
+* @param[in]     N1         number of rows, length of the column FFTs, a product of 2, 3 and 5.
+* @param[in]     N2         number of columns, length of the row FFTs, a product of 2, 3 and 5.
+* @param[out]    *pTwiddle  points to a buffer of <code>2*(N1 + 2*N2)</code> values that receives the twiddle factors.
+* @param[in]     *pWork     points to the work buffer the sub-FFTs run in, normally in DTCM.
+* @param[in]     workLen    length of the work buffer in values, at least <code>4*max(N1, N2)</code>.
+* @return        The function returns ARM_MATH_SUCCESS if initialization was successful,
+* ARM_MATH_ARGUMENT_ERROR if <code>N1</code> or <code>N2</code> is not a supported length or
+* ARM_MATH_LENGTH_ERROR if the work buffer is too small.
+*
+* \par Description:
+* The FFT length is <code>fftLen = N1*N2</code>; <code>N1</code> and <code>N2</code> close to <code>sqrt(fftLen)</code>
+* keep the work buffer small, e.g. 128 x 256 for 32768 points or 96 x 128 for 12288 points.
+* \par
+* The work buffer holds <code>blockSize</code> columns or rows plus the scratch of the sub-FFTs,
+* <code>2*(blockSize + 1)*max(N1, N2)</code> values.  <code>blockSize</code> is chosen as the largest common divisor
+* of <code>N1</code> and <code>N2</code> that fits, so a larger work buffer gives longer SDRAM bursts.
+* \par
+* <code>pTwiddle</code> holds the tables of the column and row FFTs and <code>W_N^i</code>, <code>i < N2</code>.
+*/
+
+arm_status arm_cfft_large_init_f32(
+    arm_cfft_large_instance_f32 * S,
+    uint32_t N1,
+    uint32_t N2,
+    float32_t * pTwiddle,
+    float32_t * pWork,
+    uint32_t workLen)
+{
+    uint32_t lenMax = (N1 > N2) ? N1 : N2;
+    uint32_t i, b;
+    float64_t a;
+    float32_t *pScratch;
+    arm_status status;
+
+    if((N1 == 0u) || (N2 == 0u))
+    {
+        return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    if(workLen < 4u * lenMax)
+    {
+        return (ARM_MATH_LENGTH_ERROR);
+    }
+
+    /* Largest common divisor of N1 and N2 whose blocks and scratch fit the work buffer */
+    S->blockSize = 1u;
+
+    for(b = 2u; (2u * (b + 1u) * lenMax) <= workLen; b++)
+    {
+        if(((N1 % b) == 0u) && ((N2 % b) == 0u))
+        {
+            S->blockSize = b;
+        }
+    }
+
+    /* The scratch of the sub-FFTs follows the blocks */
+    pScratch = pWork + 2u * S->blockSize * lenMax;
+
+    status = arm_cfft_mixed_init_f32(&S->colFFT, N1, pTwiddle, pScratch);
+
+    if(status == ARM_MATH_SUCCESS)
+    {
+        status = arm_cfft_mixed_init_f32(&S->rowFFT, N2, pTwiddle + 2u * N1, pScratch);
+    }
+
+    if(status != ARM_MATH_SUCCESS)
+    {
+        return (status);
+    }
+
+    /* W_N^i = exp(-j*2*pi*i/N), i < N2 */
+    S->pTwiddle = pTwiddle + 2u * (N1 + N2);
+
+    for(i = 0u; i < N2; i++)
+    {
+        a = (6.28318530717958647692 * (float64_t) i) / ((float64_t) N1 * (float64_t) N2);
+        S->pTwiddle[2u * i]      = (float32_t) cos(a);
+        S->pTwiddle[2u * i + 1u] = (float32_t) -sin(a);
+    }
+
+    S->fftLen = N1 * N2;
+    S->N1 = N1;
+    S->N2 = N2;
+    S->pWork = pWork;
+
+    return (ARM_MATH_SUCCESS);
+}
+
+/**    
+* @} end of ComplexFFT group    
+*/
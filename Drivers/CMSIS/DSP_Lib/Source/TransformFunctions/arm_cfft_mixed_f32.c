@@ -0,0 +1,414 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_cfft_mixed_f32.c   
+*    
+* Description:	Mixed-radix (2, 3, 4, 5, 8) floating-point complex FFT    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/*    
+* Self-sorting (Stockham) mixed-radix stages.  A stage of radix r on a sub-transform
+* of length n = r*m with stride s reads x[q + s*(p + k*m)], k = 0..r-1, and writes
+* the r outputs, times W_n^(j*p), to y[q + s*(r*p + j)].  The next stage works on
+* length m with stride s*r.  There is no bit reversal; the data alternate between
+* the buffer and the scratch buffer.  W_n^(j*p) is pTwiddle[j*p*s] since N = n*s.
+*/
+
+#define ARM_CFFT_MIXED_C3   0.866025403784438647f    /* sin(2*pi/3) */
+#define ARM_CFFT_MIXED_C5A  0.309016994374947424f    /* cos(2*pi/5) */
+#define ARM_CFFT_MIXED_C5B  0.809016994374947424f    /* -cos(4*pi/5) */
+#define ARM_CFFT_MIXED_S5A  0.951056516295153572f    /* sin(2*pi/5) */
+#define ARM_CFFT_MIXED_S5B  0.587785252292473129f    /* sin(4*pi/5) */
+#define ARM_CFFT_MIXED_R2   0.707106781186547524f    /* 1/sqrt(2) */
+
+/* y = a * w, complex, interleaved real/imaginary */
+#define CMPLX_MUL_STORE(y, ar, ai, w)                     \
+    (y)[0] = (ar) * (w)[0] - (ai) * (w)[1];               \
+    (y)[1] = (ar) * (w)[1] + (ai) * (w)[0]
+
+static void arm_cfft_mixed_radix2_f32(
+    const float32_t * pTwiddle, uint32_t n, uint32_t s,
+    const float32_t * x, float32_t * y)
+{
+    uint32_t m = n >> 1u, p, q;
+    const float32_t *w1, *px;
+    float32_t *py;
+    float32_t t0r, t0i, t1r, t1i;
+
+    for(p = 0u; p < m; p++)
+    {
+        w1 = pTwiddle + 2u * (p * s);
+
+        px = x + 2u * (s * p);
+        py = y + 2u * (s * 2u * p);
+
+        for(q = 0u; q < s; q++)
+        {
+            t0r = px[0];
+            t0i = px[1];
+            t1r = px[2u * s * m];
+            t1i = px[2u * s * m + 1u];
+
+            py[0] = t0r + t1r;
+            py[1] = t0i + t1i;
+            CMPLX_MUL_STORE(py + 2u * s, t0r - t1r, t0i - t1i, w1);
+
+            px += 2u;
+            py += 2u;
+        }
+    }
+}
+
+static void arm_cfft_mixed_radix3_f32(
+    const float32_t * pTwiddle, uint32_t n, uint32_t s,
+    const float32_t * x, float32_t * y)
+{
+    uint32_t m = n / 3u, p, q, sm = 2u * s * m;
+    const float32_t *w1, *w2, *px;
+    float32_t *py;
+    float32_t a0r, a0i, t1r, t1i, t2r, t2i, t3r, t3i;
+
+    for(p = 0u; p < m; p++)
+    {
+        w1 = pTwiddle + 2u * (p * s);
+        w2 = pTwiddle + 2u * (2u * p * s);
+
+        px = x + 2u * (s * p);
+        py = y + 2u * (s * 3u * p);
+
+        for(q = 0u; q < s; q++)
+        {
+            a0r = px[0];
+            a0i = px[1];
+
+            /* t1 = a1 + a2, t3 = sin(2*pi/3) * (a1 - a2) */
+            t1r = px[sm] + px[2u * sm];
+            t1i = px[sm + 1u] + px[2u * sm + 1u];
+            t3r = ARM_CFFT_MIXED_C3 * (px[sm] - px[2u * sm]);
+            t3i = ARM_CFFT_MIXED_C3 * (px[sm + 1u] - px[2u * sm + 1u]);
+
+            /* t2 = a0 - t1 / 2 */
+            t2r = a0r - 0.5f * t1r;
+            t2i = a0i - 0.5f * t1i;
+
+            py[0] = a0r + t1r;
+            py[1] = a0i + t1i;
+
+            /* y1 = t2 - j*t3, y2 = t2 + j*t3 */
+            CMPLX_MUL_STORE(py + 2u * s, t2r + t3i, t2i - t3r, w1);
+            CMPLX_MUL_STORE(py + 4u * s, t2r - t3i, t2i + t3r, w2);
+
+            px += 2u;
+            py += 2u;
+        }
+    }
+}
+
+static void arm_cfft_mixed_radix4_f32(
+    const float32_t * pTwiddle, uint32_t n, uint32_t s,
+    const float32_t * x, float32_t * y)
+{
+    uint32_t m = n >> 2u, p, q, sm = 2u * s * m;
+    const float32_t *w1, *w2, *w3, *px;
+    float32_t *py;
+    float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+
+    for(p = 0u; p < m; p++)
+    {
+        w1 = pTwiddle + 2u * (p * s);
+        w2 = pTwiddle + 2u * (2u * p * s);
+        w3 = pTwiddle + 2u * (3u * p * s);
+
+        px = x + 2u * (s * p);
+        py = y + 2u * (s * 4u * p);
+
+        for(q = 0u; q < s; q++)
+        {
+            t0r = px[0]       + px[2u * sm];
+            t0i = px[1]       + px[2u * sm + 1u];
+            t1r = px[0]       - px[2u * sm];
+            t1i = px[1]       - px[2u * sm + 1u];
+            t2r = px[sm]      + px[3u * sm];
+            t2i = px[sm + 1u] + px[3u * sm + 1u];
+            t3r = px[sm]      - px[3u * sm];
+            t3i = px[sm + 1u] - px[3u * sm + 1u];
+
+            py[0] = t0r + t2r;
+            py[1] = t0i + t2i;
+
+            /* y1 = t1 - j*t3, y2 = t0 - t2, y3 = t1 + j*t3 */
+            CMPLX_MUL_STORE(py + 2u * s, t1r + t3i, t1i - t3r, w1);
+            CMPLX_MUL_STORE(py + 4u * s, t0r - t2r, t0i - t2i, w2);
+            CMPLX_MUL_STORE(py + 6u * s, t1r - t3i, t1i + t3r, w3);
+
+            px += 2u;
+            py += 2u;
+        }
+    }
+}
+
+static void arm_cfft_mixed_radix5_f32(
+    const float32_t * pTwiddle, uint32_t n, uint32_t s,
+    const float32_t * x, float32_t * y)
+{
+    uint32_t m = n / 5u, p, q, sm = 2u * s * m;
+    const float32_t *w1, *w2, *w3, *w4, *px;
+    float32_t *py;
+    float32_t a0r, a0i, t1r, t1i, t2r, t2i, t3r, t3i, t4r, t4i;
+    float32_t u1r, u1i, u2r, u2i, v1r, v1i, v2r, v2i;
+
+    for(p = 0u; p < m; p++)
+    {
+        w1 = pTwiddle + 2u * (p * s);
+        w2 = pTwiddle + 2u * (2u * p * s);
+        w3 = pTwiddle + 2u * (3u * p * s);
+        w4 = pTwiddle + 2u * (4u * p * s);
+
+        px = x + 2u * (s * p);
+        py = y + 2u * (s * 5u * p);
+
+        for(q = 0u; q < s; q++)
+        {
+            a0r = px[0];
+            a0i = px[1];
+
+            t1r = px[sm] + px[4u * sm];
+            t1i = px[sm + 1u] + px[4u * sm + 1u];
+            t2r = px[2u * sm] + px[3u * sm];
+            t2i = px[2u * sm + 1u] + px[3u * sm + 1u];
+            t3r = px[sm] - px[4u * sm];
+            t3i = px[sm + 1u] - px[4u * sm + 1u];
+            t4r = px[2u * sm] - px[3u * sm];
+            t4i = px[2u * sm + 1u] - px[3u * sm + 1u];
+
+            u1r = a0r + ARM_CFFT_MIXED_C5A * t1r - ARM_CFFT_MIXED_C5B * t2r;
+            u1i = a0i + ARM_CFFT_MIXED_C5A * t1i - ARM_CFFT_MIXED_C5B * t2i;
+            u2r = a0r - ARM_CFFT_MIXED_C5B * t1r + ARM_CFFT_MIXED_C5A * t2r;
+            u2i = a0i - ARM_CFFT_MIXED_C5B * t1i + ARM_CFFT_MIXED_C5A * t2i;
+
+            v1r = ARM_CFFT_MIXED_S5A * t3r + ARM_CFFT_MIXED_S5B * t4r;
+            v1i = ARM_CFFT_MIXED_S5A * t3i + ARM_CFFT_MIXED_S5B * t4i;
+            v2r = ARM_CFFT_MIXED_S5B * t3r - ARM_CFFT_MIXED_S5A * t4r;
+            v2i = ARM_CFFT_MIXED_S5B * t3i - ARM_CFFT_MIXED_S5A * t4i;
+
+            py[0] = a0r + t1r + t2r;
+            py[1] = a0i + t1i + t2i;
+
+            /* y1 = u1 - j*v1, y2 = u2 - j*v2, y3 = u2 + j*v2, y4 = u1 + j*v1 */
+            CMPLX_MUL_STORE(py + 2u * s, u1r + v1i, u1i - v1r, w1);
+            CMPLX_MUL_STORE(py + 4u * s, u2r + v2i, u2i - v2r, w2);
+            CMPLX_MUL_STORE(py + 6u * s, u2r - v2i, u2i + v2r, w3);
+            CMPLX_MUL_STORE(py + 8u * s, u1r - v1i, u1i + v1r, w4);
+
+            px += 2u;
+            py += 2u;
+        }
+    }
+}
+
+static void arm_cfft_mixed_radix8_f32(
+    const float32_t * pTwiddle, uint32_t n, uint32_t s,
+    const float32_t * x, float32_t * y)
+{
+    uint32_t m = n >> 3u, p, q, j, sm = 2u * s * m;
+    const float32_t *w[8], *px;
+    float32_t *py;
+    float32_t e0r, e0i, e1r, e1i, e2r, e2i, e3r, e3i;
+    float32_t o0r, o0i, o1r, o1i, o2r, o2i, o3r, o3i;
+    float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+    float32_t r;
+
+    for(p = 0u; p < m; p++)
+    {
+        for(j = 1u; j < 8u; j++)
+        {
+            w[j] = pTwiddle + 2u * (j * p * s);
+        }
+
+        px = x + 2u * (s * p);
+        py = y + 2u * (s * 8u * p);
+
+        for(q = 0u; q < s; q++)
+        {
+            /* e = DFT4(a0, a2, a4, a6) */
+            t0r = px[0]            + px[4u * sm];
+            t0i = px[1]            + px[4u * sm + 1u];
+            t1r = px[0]            - px[4u * sm];
+            t1i = px[1]            - px[4u * sm + 1u];
+            t2r = px[2u * sm]      + px[6u * sm];
+            t2i = px[2u * sm + 1u] + px[6u * sm + 1u];
+            t3r = px[2u * sm]      - px[6u * sm];
+            t3i = px[2u * sm + 1u] - px[6u * sm + 1u];
+            e0r = t0r + t2r;  e0i = t0i + t2i;
+            e1r = t1r + t3i;  e1i = t1i - t3r;
+            e2r = t0r - t2r;  e2i = t0i - t2i;
+            e3r = t1r - t3i;  e3i = t1i + t3r;
+
+            /* o = DFT4(a1, a3, a5, a7) */
+            t0r = px[sm]           + px[5u * sm];
+            t0i = px[sm + 1u]      + px[5u * sm + 1u];
+            t1r = px[sm]           - px[5u * sm];
+            t1i = px[sm + 1u]      - px[5u * sm + 1u];
+            t2r = px[3u * sm]      + px[7u * sm];
+            t2i = px[3u * sm + 1u] + px[7u * sm + 1u];
+            t3r = px[3u * sm]      - px[7u * sm];
+            t3i = px[3u * sm + 1u] - px[7u * sm + 1u];
+            o0r = t0r + t2r;  o0i = t0i + t2i;
+            o1r = t1r + t3i;  o1i = t1i - t3r;
+            o2r = t0r - t2r;  o2i = t0i - t2i;
+            o3r = t1r - t3i;  o3i = t1i + t3r;
+
+            /* o[k] *= W8^k */
+            r   = ARM_CFFT_MIXED_R2 * (o1r + o1i);
+            o1i = ARM_CFFT_MIXED_R2 * (o1i - o1r);
+            o1r = r;
+            r   = o2i;
+            o2i = -o2r;
+            o2r = r;
+            r   = ARM_CFFT_MIXED_R2 * (o3i - o3r);
+            o3i = -ARM_CFFT_MIXED_R2 * (o3r + o3i);
+            o3r = r;
+
+            py[0] = e0r + o0r;
+            py[1] = e0i + o0i;
+            CMPLX_MUL_STORE(py +  2u * s, e1r + o1r, e1i + o1i, w[1]);
+            CMPLX_MUL_STORE(py +  4u * s, e2r + o2r, e2i + o2i, w[2]);
+            CMPLX_MUL_STORE(py +  6u * s, e3r + o3r, e3i + o3i, w[3]);
+            CMPLX_MUL_STORE(py +  8u * s, e0r - o0r, e0i - o0i, w[4]);
+            CMPLX_MUL_STORE(py + 10u * s, e1r - o1r, e1i - o1i, w[5]);
+            CMPLX_MUL_STORE(py + 12u * s, e2r - o2r, e2i - o2i, w[6]);
+            CMPLX_MUL_STORE(py + 14u * s, e3r - o3r, e3i - o3i, w[7]);
+
+            px += 2u;
+            py += 2u;
+        }
+    }
+}
+
+/**   
+* @addtogroup ComplexFFT   
+* @{   
+*/
+
+/**   
+* @brief       Processing function for the floating-point mixed-radix complex FFT.
+* @param[in]      *S        points to an instance of the floating-point mixed-radix CFFT structure.  
+* @param[in, out] *p1       points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.  
+* @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.  
+* @return none.  
+*
+* \par
+* Lengths are any product of 2, 3 and 5, see <code>arm_cfft_mixed_init_f32()</code>.
+* The output is in natural order.  As for <code>arm_cfft_f32()</code> the inverse transform is scaled by <code>1/fftLen</code>.
+*/
+
+void arm_cfft_mixed_f32(
+    const arm_cfft_mixed_instance_f32 * S,
+    float32_t * p1,
+    uint8_t ifftFlag)
+{
+    uint32_t  L = S->fftLen, l, n, s, i;
+    float32_t invL, * pSrc, * x, * y, * t;
+
+    if(ifftFlag == 1u)
+    {
+        /*  Conjugate input data  */
+        pSrc = p1 + 1;
+        for(l=0; l<L; l++)
+        {
+            *pSrc = -*pSrc;
+            pSrc += 2;
+        }
+    }
+
+    x = p1;
+    y = S->pScratch;
+    n = L;
+    s = 1u;
+
+    for(i = 0u; i < S->numStages; i++)
+    {
+        switch (S->radix[i])
+        {
+        case 2:
+            arm_cfft_mixed_radix2_f32(S->pTwiddle, n, s, x, y);
+            break;
+        case 3:
+            arm_cfft_mixed_radix3_f32(S->pTwiddle, n, s, x, y);
+            break;
+        case 4:
+            arm_cfft_mixed_radix4_f32(S->pTwiddle, n, s, x, y);
+            break;
+        case 5:
+            arm_cfft_mixed_radix5_f32(S->pTwiddle, n, s, x, y);
+            break;
+        default:
+            arm_cfft_mixed_radix8_f32(S->pTwiddle, n, s, x, y);
+            break;
+        }
+
+        n /= S->radix[i];
+        s *= S->radix[i];
+
+        t = x;
+        x = y;
+        y = t;
+    }
+
+    /* After an odd number of stages the result is in the scratch buffer */
+    if(x != p1)
+    {
+        memcpy(p1, x, 2u * L * sizeof(float32_t));
+    }
+
+    if(ifftFlag == 1u)
+    {
+        invL = 1.0f/(float32_t)L;
+        /*  Conjugate and scale output data */
+        pSrc = p1;
+        for(l=0; l<L; l++)
+        {
+            *pSrc++ *=   invL ;
+            *pSrc  = -(*pSrc) * invL;
+            pSrc++;
+        }
+    }
+}
+
+/**    
+* @} end of ComplexFFT group    
+*/
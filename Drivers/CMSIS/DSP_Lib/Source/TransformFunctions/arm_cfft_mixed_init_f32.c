@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_cfft_mixed_init_f32.c   
+*    
+* Description:	Initialization function for the mixed-radix floating-point complex FFT    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**   
+* @addtogroup ComplexFFT   
+* @{   
+*/
+
+/**   
+* @brief  Initialization function for the floating-point mixed-radix complex FFT.
+* @param[in,out] *S         points to an instance of the floating-point mixed-radix CFFT structure.
+* @param[in]     fftLen     length of the FFT, a product of 2, 3 and 5.
+* @param[out]    *pTwiddle  points to a buffer of <code>2*fftLen</code> values that receives the twiddle factors.
+* @param[in]     *pScratch  points to a scratch buffer of <code>2*fftLen</code> values.
+* @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR
+* if <code>fftLen</code> is zero or has a prime factor other than 2, 3 and 5.
+*
+* \par Description:
+* The transform is split into radix-8, 4, 2, 5 and 3 stages, largest first.  Unlike
+* <code>arm_cfft_f32()</code> the twiddle factors are not taken from a constant table but
+* computed here, so any supported length costs only the <code>2*fftLen</code> words of
+* <code>pTwiddle</code>, which can be placed in whichever memory suits the application.
+* The table may be shared by several instances of the same length, the scratch buffer
+* may be shared by instances that do not run concurrently.
+*/
+
+arm_status arm_cfft_mixed_init_f32(
+    arm_cfft_mixed_instance_f32 * S,
+    uint32_t fftLen,
+    float32_t * pTwiddle,
+    float32_t * pScratch)
+{
+    static const uint8_t radix[5] = {8u, 4u, 2u, 5u, 3u};
+    uint32_t n = fftLen, i, k;
+    float64_t a;
+
+    if(fftLen == 0u)
+    {
+        return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    S->numStages = 0u;
+
+    /* Factorize, taking each radix as often as it divides what is left */
+    for(i = 0u; i < 5u; i++)
+    {
+        while((n % radix[i]) == 0u)
+        {
+            S->radix[S->numStages++] = radix[i];
+            n /= radix[i];
+        }
+    }
+
+    if(n != 1u)
+    {
+        return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* W_N^k = exp(-j*2*pi*k/N), computed in double precision */
+    for(k = 0u; k < fftLen; k++)
+    {
+        a = (6.28318530717958647692 * (float64_t) k) / (float64_t) fftLen;
+        pTwiddle[2u * k]      = (float32_t) cos(a);
+        pTwiddle[2u * k + 1u] = (float32_t) -sin(a);
+    }
+
+    S->fftLen = fftLen;
+    S->pTwiddle = pTwiddle;
+    S->pScratch = pScratch;
+
+    return (ARM_MATH_SUCCESS);
+}
+
+/**    
+* @} end of ComplexFFT group    
+*/
@@ -0,0 +1,277 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_goertzel_f32.c   
+*    
+* Description:	Floating-point Goertzel bank    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @defgroup Goertzel Goertzel and Sliding DFT Tone Detectors    
+ *    
+ * These functions compute a few bins of the DFT of a signal directly, without computing the whole spectrum.    
+ * They are meant for tone and frequency detection (DTMF, pilot tones, signal presence) where an FFT would    
+ * compute hundreds of bins only to look at a handful of them.    
+ *    
+ * \par Goertzel bank    
+ * The Goertzel functions collect blocks of <code>blockLen</code> (N) input samples and, once per block, output    
+ * for every bin <code>k</code> of the bank    
+ * <pre>    
+ *    X[k] = sum(n = 0 ... N-1) x[n] * exp(-j*2*pi*k*n/N)    
+ * </pre>    
+ * which is bin <code>k</code> of <code>arm_rfft_fast_f32()</code> of the same block.  <code>k</code> need not be an integer,    
+ * so a bin can be placed exactly on the tone to detect.  Each bin costs three multiply-accumulates per input sample in    
+ * floating point, two 32 x 32-bit multiplies in Q31, and a few operations per block, so a small bank costs less    
+ * than a real FFT of the block.    
+ * The bins are evaluated four at a time so that each input sample is loaded once per four bins.    
+ * The input may be passed in pieces of any length; a result is written whenever a block is complete.    
+ *    
+ * \par Sliding DFT    
+ * The sliding DFT functions update the bins at every input sample, so that after each sample they hold the DFT    
+ * of the last N samples:    
+ * <pre>    
+ *    S[k](n) = sum(m = 0 ... N-1) r^(N-m) * x[n-N+1+m] * exp(-j*2*pi*k*m/N)    
+ *    S[k](n) = r * exp(j*2*pi*k/N) * (S[k](n-1) + x[n] - r^N * x[n-N])    
+ * </pre>    
+ * The damping factor <code>r</code> slightly below 1, e.g. 0.9999, makes rounding errors die out instead of    
+ * accumulating forever in the undamped recursion; <code>r = 1</code> gives the exact DFT of the last N samples.    
+ * The bins must be integers.  The cost is one complex multiply per bin and sample, independent of N.    
+ *    
+ * \par    
+ * Results are written as interleaved complex values <code>{re[0], im[0], re[1], im[1], ...}</code>, one per bin in the    
+ * order the bins were given, so <code>arm_cmplx_mag_f32()</code> or <code>arm_cmplx_mag_squared_f32()</code> can be    
+ * applied to them directly.    
+ *    
+ * \par Instance Structure    
+ * The coefficients and state of a bank are stored in an instance data structure and set up by the initialization    
+ * function, which computes the coefficients of the bins into a coefficient array supplied by the caller.    
+ */
+
+/**    
+ * @addtogroup Goertzel    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the floating-point Goertzel bank.    
+ * @param[in,out] *S         points to an instance of the floating-point Goertzel structure.    
+ * @param[in]     *pSrc      points to the input samples.    
+ * @param[out]    *pDst      points to the output buffer, <code>2*numBins</code> values per completed block.    
+ * @param[in]     blockSize  number of input samples.    
+ * @return        number of blocks completed, and results written to <code>pDst</code>, by this call.    
+ *    
+ * \par    
+ * Each bin runs the Goertzel recursion <code>s[n] = x[n] + 2*cos(w)*s[n-1] - s[n-2]</code> in the form of Reinsch,    
+ * with <code>2*cos(w) = 2*sign + 2*d</code>, <code>sign = +/-1</code>, and the difference <code>t[n] = s[n] - sign*s[n-1]</code>    
+ * kept instead of <code>s[n-2]</code>:    
+ * <pre>    
+ *     t[n] = x[n] + 2*d*s[n-1] + sign*t[n-1]    
+ *     s[n] = t[n] + sign*s[n-1]    
+ * </pre>    
+ * and at the end of the block <code>X = A*s[N-1] + B*t[N-1]</code>.  The plain recursion loses the small difference    
+ * between <code>2*cos(w)</code> and +/-2 to rounding, and with it the bins close to DC and N/2 of long blocks: a few percent    
+ * error at bin 1 of 4096 samples.  Here that difference is the coefficient itself, and <code>2*d</code> is stored as the sum of two    
+ * floats so that the bins in the middle, where it is close to +/-2, keep their frequency as well.    
+ * \par    
+ * The error is then that of summing the block directly in single precision, up to about <code>sqrt(N)</code> roundings    
+ * of <code>|X|</code> plus the norm of the block, a few times that for the bins next to DC of long blocks with a large DC    
+ * offset.  An FFT of the same block is more accurate; <code>arm_goertzel_q31()</code> is exact to a few LSB at any length.    
+ */
+
+uint32_t arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  const float32_t *pIn;                          /*  input pointer                         */
+  float32_t *pState, *pCoeffs;                   /*  state and coefficient pointers        */
+  float32_t d0, e0, g0, sa, ta;                  /*  coefficients and state of bin a       */
+  uint32_t numBins = S->numBins;                 /*  number of bins                        */
+  uint32_t blkCnt, len, bin;                     /*  loop counters                         */
+  uint32_t numFrames = 0u;                       /*  number of completed blocks            */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  float32_t d1, d2, d3, e1, e2, e3, g1, g2, g3;  /*  coefficients of bins b..d             */
+  float32_t sb, tb, sc, tc, sd, td;              /*  states of bins b..d                   */
+  float32_t x;                                   /*  input sample                          */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blockSize > 0u)
+  {
+    /* Samples up to the end of the current block */
+    len = S->blockLen - S->count;
+    len = (len > blockSize) ? blockSize : len;
+
+    pState = S->pState;
+    pCoeffs = S->pCoeffs;
+    bin = 0u;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Four bins at a time, each input sample is loaded once for all four */
+    for(; (bin + 4u) <= numBins; bin += 4u)
+    {
+      d0 = pCoeffs[0];
+      e0 = pCoeffs[1];
+      g0 = pCoeffs[2];
+      d1 = pCoeffs[7];
+      e1 = pCoeffs[8];
+      g1 = pCoeffs[9];
+      d2 = pCoeffs[14];
+      e2 = pCoeffs[15];
+      g2 = pCoeffs[16];
+      d3 = pCoeffs[21];
+      e3 = pCoeffs[22];
+      g3 = pCoeffs[23];
+
+      sa = pState[0];
+      ta = pState[1];
+      sb = pState[2];
+      tb = pState[3];
+      sc = pState[4];
+      tc = pState[5];
+      sd = pState[6];
+      td = pState[7];
+
+      pIn = pSrc;
+      blkCnt = len;
+
+      while(blkCnt > 0u)
+      {
+        /* t[n] = x[n] + 2*d*s[n-1] + sign*t[n-1], s[n] = t[n] + sign*s[n-1] */
+        x = *pIn++;
+        ta = ((x + e0 * sa) + d0 * sa) + g0 * ta;
+        tb = ((x + e1 * sb) + d1 * sb) + g1 * tb;
+        tc = ((x + e2 * sc) + d2 * sc) + g2 * tc;
+        td = ((x + e3 * sd) + d3 * sd) + g3 * td;
+
+        sa = ta + g0 * sa;
+        sb = tb + g1 * sb;
+        sc = tc + g2 * sc;
+        sd = td + g3 * sd;
+
+        /* decrement the loop counter */
+        blkCnt--;
+      }
+
+      pState[0] = sa;
+      pState[1] = ta;
+      pState[2] = sb;
+      pState[3] = tb;
+      pState[4] = sc;
+      pState[5] = tc;
+      pState[6] = sd;
+      pState[7] = td;
+
+      pState += 8u;
+      pCoeffs += 28u;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    /* The remaining bins one at a time */
+    for(; bin < numBins; bin++)
+    {
+      d0 = pCoeffs[0];
+      e0 = pCoeffs[1];
+      g0 = pCoeffs[2];
+      sa = pState[0];
+      ta = pState[1];
+
+      pIn = pSrc;
+      blkCnt = len;
+
+      while(blkCnt > 0u)
+      {
+        ta = ((*pIn++ + e0 * sa) + d0 * sa) + g0 * ta;
+        sa = ta + g0 * sa;
+
+        blkCnt--;
+      }
+
+      pState[0] = sa;
+      pState[1] = ta;
+
+      pState += 2u;
+      pCoeffs += 7u;
+    }
+
+    pSrc += len;
+    blockSize -= len;
+    S->count += len;
+
+    if(S->count == S->blockLen)
+    {
+      /* X = A*s[N-1] + B*t[N-1] */
+      pState = S->pState;
+      pCoeffs = S->pCoeffs;
+
+      for(bin = 0u; bin < numBins; bin++)
+      {
+        sa = pState[0];
+        ta = pState[1];
+
+        *pDst++ = sa * pCoeffs[3] + ta * pCoeffs[5];
+        *pDst++ = sa * pCoeffs[4] + ta * pCoeffs[6];
+
+        pState[0] = 0.0f;
+        pState[1] = 0.0f;
+
+        pState += 2u;
+        pCoeffs += 7u;
+      }
+
+      S->count = 0u;
+      numFrames++;
+    }
+  }
+
+  return (numFrames);
+}
+
+/**    
+ * @} end of Goertzel group    
+ */
@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_goertzel_init_f32.c   
+*    
+* Description:	Initialization function for the floating-point Goertzel bank    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup Goertzel    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point Goertzel bank.    
+ * @param[in,out] *S         points to an instance of the floating-point Goertzel structure.    
+ * @param[in]     numBins    number of bins.    
+ * @param[in]     blockLen   number of samples per block, the DFT length N.    
+ * @param[in]     *pBins     points to the <code>numBins</code> bin numbers <code>k</code>, from 0 to N/2, not necessarily integers.    
+ * @param[out]    *pCoeffs   points to the coefficient buffer of <code>7*numBins</code> values.    
+ * @param[in]     *pState    points to the state buffer of <code>2*numBins</code> values.    
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or    
+ * ARM_MATH_ARGUMENT_ERROR if <code>numBins</code> or <code>blockLen</code> is 0.    
+ *    
+ * \par    
+ * The coefficients of each bin, with <code>w = 2*pi*k/N</code>, are stored as    
+ * <pre>    
+ *     {hi(2*d), lo(2*d), sign, re(A), im(A), re(B), im(B)}    
+ * </pre>    
+ * with <code>sign = 1</code> and <code>d = cos(w) - 1</code> if <code>cos(w) >= 0</code>, <code>sign = -1</code> and    
+ * <code>d = cos(w) + 1</code> otherwise, <code>A = exp(-j*w*N)*(exp(j*w) - sign)</code> and <code>B = sign*exp(-j*w*N)</code>,    
+ * computed in double precision.  <code>hi(2*d)</code> is <code>2*d</code> rounded to float and <code>lo(2*d)</code> the    
+ * rest.  The state buffer is cleared.    
+ */
+
+arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  uint32_t blockLen,
+  const float32_t * pBins,
+  float32_t * pCoeffs,
+  float32_t * pState)
+{
+  float64_t w, d, sign, c, s;
+  uint32_t i;
+
+  if((numBins == 0u) || (blockLen == 0u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for(i = 0u; i < numBins; i++)
+  {
+    w = (6.28318530717958647692 * (float64_t) pBins[i]) / (float64_t) blockLen;
+
+    /* cos(w) -/+ 1 from the half angle, without the cancellation of the subtraction */
+    sign = (cos(w) >= 0.0) ? 1.0 : -1.0;
+    d = (sign > 0.0) ? (-2.0 * sin(0.5 * w) * sin(0.5 * w)) : (2.0 * cos(0.5 * w) * cos(0.5 * w));
+    c = cos(w * (float64_t) blockLen);
+    s = sin(w * (float64_t) blockLen);
+
+    pCoeffs[7u * i]      = (float32_t) (2.0 * d);
+    pCoeffs[7u * i + 1u] = (float32_t) (2.0 * d - (float64_t) pCoeffs[7u * i]);
+    pCoeffs[7u * i + 2u] = (float32_t) sign;
+    pCoeffs[7u * i + 3u] = (float32_t) (c * d + s * sin(w));
+    pCoeffs[7u * i + 4u] = (float32_t) (c * sin(w) - s * d);
+    pCoeffs[7u * i + 5u] = (float32_t) (sign * c);
+    pCoeffs[7u * i + 6u] = (float32_t) (-sign * s);
+  }
+
+  memset(pState, 0, 2u * numBins * sizeof(float32_t));
+
+  S->numBins = numBins;
+  S->blockLen = blockLen;
+  S->count = 0u;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of Goertzel group    
+ */
@@ -0,0 +1,136 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_goertzel_init_q31.c   
+*    
+* Description:	Initialization function for the Q31 Goertzel bank    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup Goertzel    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the Q31 Goertzel bank.    
+ * @param[in,out] *S         points to an instance of the Q31 Goertzel structure.    
+ * @param[in]     numBins    number of bins.    
+ * @param[in]     blockLen   number of samples per block, the DFT length N, at most 32768.    
+ * @param[in]     *pBins     points to the <code>numBins</code> bin numbers <code>k</code>, from 0 to N/2, not necessarily integers.    
+ * @param[out]    *pCoeffs   points to the coefficient buffer of <code>6*numBins</code> values.    
+ * @param[in]     *pState    points to the 64-bit state buffer of <code>2*numBins</code> values.    
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or    
+ * ARM_MATH_ARGUMENT_ERROR if <code>numBins</code> or <code>blockLen</code> is 0 or <code>blockLen</code> is too large.    
+ *    
+ * \par    
+ * The coefficients of each bin, with <code>w = 2*pi*k/N</code>, are stored as    
+ * <pre>    
+ *     {d*2^shiftD, sin(w)*2^shiftS, cos(w*N), sin(w*N), sign, shiftD + 256*shiftS}    
+ * </pre>    
+ * with <code>sign</code> the nearest of -1, 0 and 1 to <code>cos(w)</code> and <code>d = cos(w) - sign</code>.  The first four    
+ * are in 1.31 format, the first two normalized to the full 1.31 range by the shifts, from 0 to 32, and the last two are    
+ * integers.  The state buffer is cleared.    
+ */
+
+arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  uint32_t blockLen,
+  const float32_t * pBins,
+  q31_t * pCoeffs,
+  q63_t * pState)
+{
+  float64_t w, d, s;
+  uint32_t i, shift, shiftS;
+  int32_t sign;
+
+  if((numBins == 0u) || (blockLen == 0u) || (blockLen > 32768u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for(i = 0u; i < numBins; i++)
+  {
+    w = (6.28318530717958647692 * (float64_t) pBins[i]) / (float64_t) blockLen;
+
+    /* cos(w) - sign, from the half angle next to DC and N/2 to avoid the cancellation of the subtraction */
+    sign = (cos(w) > 0.5) ? 1 : ((cos(w) < -0.5) ? -1 : 0);
+    d = (sign > 0) ? (-2.0 * sin(0.5 * w) * sin(0.5 * w)) :
+        ((sign < 0) ? (2.0 * cos(0.5 * w) * cos(0.5 * w)) : cos(w));
+    s = sin(w);
+
+    /* Exponents that bring |d| and sin(w) to [0.5, 1) */
+    for(shift = 0u; (fabs(d) * (float64_t) (1ull << shift) < 0.5) && (shift < 32u); shift++)
+    {
+    }
+
+    for(shiftS = 0u; (fabs(s) * (float64_t) (1ull << shiftS) < 0.5) && (shiftS < 32u); shiftS++)
+    {
+    }
+
+    pCoeffs[6u * i]      = clip_q63_to_q31((q63_t) floor(d * (float64_t) (1ull << shift) * 2147483648.0 + 0.5));
+    pCoeffs[6u * i + 1u] = clip_q63_to_q31((q63_t) floor(s * (float64_t) (1ull << shiftS) * 2147483648.0 + 0.5));
+    pCoeffs[6u * i + 2u] = clip_q63_to_q31((q63_t) floor(cos(w * (float64_t) blockLen) * 2147483648.0 + 0.5));
+    pCoeffs[6u * i + 3u] = clip_q63_to_q31((q63_t) floor(sin(w * (float64_t) blockLen) * 2147483648.0 + 0.5));
+    pCoeffs[6u * i + 4u] = (q31_t) sign;
+    pCoeffs[6u * i + 5u] = (q31_t) (shift + (shiftS << 8));
+  }
+
+  /* Output scaling of a fixed-point FFT of the same length */
+  for(shift = 0u; (1u << shift) < blockLen; shift++)
+  {
+  }
+
+  memset(pState, 0, 2u * numBins * sizeof(q63_t));
+
+  S->numBins = numBins;
+  S->outShift = (uint8_t) shift;
+  S->blockLen = blockLen;
+  S->count = 0u;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of Goertzel group    
+ */
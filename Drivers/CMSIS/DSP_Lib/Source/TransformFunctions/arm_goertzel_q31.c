@@ -0,0 +1,235 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_goertzel_q31.c   
+*    
+* Description:	Q31 Goertzel bank    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup Goertzel    
+ * @{    
+ */
+
+/**    
+ * @brief (s * c) >> (31 + shift) of a 64-bit state and a 1.31 coefficient, from two 32 x 32-bit products.    
+ */
+
+static __INLINE q63_t arm_goertzel_mult_q31(
+  q63_t s,
+  q31_t c,
+  uint32_t shift)
+{
+  q31_t hi = (q31_t) (s >> 31);                  /* upper half, |s| < 2^62     */
+  q31_t lo = (q31_t) (s & 0x7FFFFFFF);           /* lower 31 bits, nonnegative */
+
+  return ((((q63_t) c * hi) >> shift) + (((q63_t) c * lo) >> (31u + shift)));
+}
+
+/**    
+ * @brief Processing function for the Q31 Goertzel bank.    
+ * @param[in,out] *S         points to an instance of the Q31 Goertzel structure.    
+ * @param[in]     *pSrc      points to the input samples.    
+ * @param[out]    *pDst      points to the output buffer, <code>2*numBins</code> values per completed block.    
+ * @param[in]     blockSize  number of input samples.    
+ * @return        number of blocks completed, and results written to <code>pDst</code>, by this call.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The output is <code>X[k] / 2^outShift</code> in 1.31 format, where <code>outShift = ceil(log2(N))</code>, the same    
+ * down-scaling as a fixed-point FFT of length N, so it cannot overflow.    
+ * \par    
+ * The state of each bin can grow to about <code>N*min((N+1)/2, 1/sin(w))</code> times the input, 2^29 for N = 32768,    
+ * so it is kept in 64 bits, in the units of the input, and the input enters the recursion unshifted.    
+ * \par    
+ * <code>2*cos(w)</code> is split into <code>2*sign</code>, with <code>sign</code> the nearest of -1, 0 and 1, applied as an    
+ * addition, and the remainder <code>2*d</code>, <code>|d| <= 1/2</code>, which is stored normalized with its own exponent so    
+ * that it keeps 31 significant bits however small it is.  DC and N/2 are exact.  At the end of the block    
+ * <pre>    
+ *     X = exp(-j*w*N)*((sign + d)*s[N-1] - s[N-2] + j*sin(w)*s[N-1])    
+ * </pre>    
+ * where the difference of the states is exact, so the bins close to DC and N/2, whose states grow far above X,    
+ * do not lose X to the rounding of the coefficients.    
+ * \par    
+ * The bins are evaluated one at a time over each piece of input; the states and products of a second bin would not    
+ * fit in the core registers next to those of the first.    
+ */
+
+uint32_t arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  const q31_t *pIn;                              /*  input pointer                         */
+  q31_t *pCoeffs;                                /*  coefficient pointer                   */
+  q63_t *pState;                                 /*  state pointer                         */
+  q63_t s1, s2;                                  /*  state of the bin                      */
+  q63_t neg, keep;                               /*  masks for sign*s[n-1]                 */
+  q63_t acc, re, im;                             /*  accumulators                          */
+  q31_t c0;                                      /*  coefficient d                         */
+  uint32_t shift;                                /*  exponent of d                         */
+  uint32_t numBins = S->numBins;                 /*  number of bins                        */
+  uint32_t blkCnt, len, bin;                     /*  loop counters                         */
+  uint32_t numFrames = 0u;                       /*  number of completed blocks            */
+
+  while(blockSize > 0u)
+  {
+    /* Samples up to the end of the current block */
+    len = S->blockLen - S->count;
+    len = (len > blockSize) ? blockSize : len;
+
+    pState = S->pState;
+    pCoeffs = S->pCoeffs;
+
+    for(bin = 0u; bin < numBins; bin++)
+    {
+      /* sign*s = ((s ^ neg) - neg) & keep */
+      c0 = pCoeffs[0];
+      shift = (uint32_t) pCoeffs[5] & 0xFFu;
+      neg = (q63_t) (pCoeffs[4] >> 31);
+      keep = -(q63_t) (pCoeffs[4] & 1);
+      s1 = pState[0];
+      s2 = pState[1];
+
+      pIn = pSrc;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Two samples per iteration, the new state alternates between s2 and s1 */
+      blkCnt = len >> 1u;
+
+      while(blkCnt > 0u)
+      {
+        /* s[n] = x[n] + (2*sign + 2*d)*s[n-1] - s[n-2] */
+        acc = arm_goertzel_mult_q31(2 * s1, c0, shift);
+        s2 = acc + 2 * (((s1 ^ neg) - neg) & keep) + *pIn++ - s2;
+
+        acc = arm_goertzel_mult_q31(2 * s2, c0, shift);
+        s1 = acc + 2 * (((s2 ^ neg) - neg) & keep) + *pIn++ - s1;
+
+        /* decrement the loop counter */
+        blkCnt--;
+      }
+
+      /* Odd length: one more sample, then swap so that s1 is the newest state again */
+      if((len & 1u) != 0u)
+      {
+        acc = arm_goertzel_mult_q31(2 * s1, c0, shift);
+        s2 = acc + 2 * (((s1 ^ neg) - neg) & keep) + *pIn - s2;
+
+        acc = s1;
+        s1 = s2;
+        s2 = acc;
+      }
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      blkCnt = len;
+
+      while(blkCnt > 0u)
+      {
+        acc = arm_goertzel_mult_q31(2 * s1, c0, shift);
+        acc = acc + 2 * (((s1 ^ neg) - neg) & keep) + *pIn++ - s2;
+        s2 = s1;
+        s1 = acc;
+
+        /* decrement the loop counter */
+        blkCnt--;
+      }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+      pState[0] = s1;
+      pState[1] = s2;
+
+      pState += 2u;
+      pCoeffs += 6u;
+    }
+
+    pSrc += len;
+    blockSize -= len;
+    S->count += len;
+
+    if(S->count == S->blockLen)
+    {
+      /* X = exp(-j*w*N)*(re + j*im), re and im doubled so that no bit of d*s[N-1] is lost, scaled to 2^-outShift */
+      pState = S->pState;
+      pCoeffs = S->pCoeffs;
+
+      for(bin = 0u; bin < numBins; bin++)
+      {
+        s1 = pState[0];
+        s2 = pState[1];
+        shift = (uint32_t) pCoeffs[5];
+        neg = (q63_t) (pCoeffs[4] >> 31);
+        keep = -(q63_t) (pCoeffs[4] & 1);
+
+        re = arm_goertzel_mult_q31(2 * s1, pCoeffs[0], shift & 0xFFu) + 2 * ((((s1 ^ neg) - neg) & keep) - s2);
+        im = arm_goertzel_mult_q31(2 * s1, pCoeffs[1], shift >> 8);
+
+        acc = arm_goertzel_mult_q31(re, pCoeffs[2], 1u) + arm_goertzel_mult_q31(im, pCoeffs[3], 1u);
+        *pDst++ = clip_q63_to_q31(acc >> S->outShift);
+
+        acc = arm_goertzel_mult_q31(im, pCoeffs[2], 1u) - arm_goertzel_mult_q31(re, pCoeffs[3], 1u);
+        *pDst++ = clip_q63_to_q31(acc >> S->outShift);
+
+        pState[0] = 0;
+        pState[1] = 0;
+
+        pState += 2u;
+        pCoeffs += 6u;
+      }
+
+      S->count = 0u;
+      numFrames++;
+    }
+  }
+
+  return (numFrames);
+}
+
+/**    
+ * @} end of Goertzel group    
+ */
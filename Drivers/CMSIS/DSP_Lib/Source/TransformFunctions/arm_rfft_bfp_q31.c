@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_rfft_bfp_q31.c   
+*    
+* Description:	Block floating-point Q31 real FFT processing function    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+void arm_split_rfft_q31(
+    q31_t * pSrc,
+    uint32_t fftLen,
+    q31_t * pATable,
+    q31_t * pBTable,
+    q31_t * pDst,
+    uint32_t modifier);
+
+void arm_split_rifft_q31(
+    q31_t * pSrc,
+    uint32_t fftLen,
+    q31_t * pATable,
+    q31_t * pBTable,
+    q31_t * pDst,
+    uint32_t modifier);
+
+arm_status arm_cfft_bfp_guard_q31(
+    const arm_cfft_instance_q31 * S,
+    q31_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    uint32_t guard,
+    int32_t * pExp);
+
+/* scales the block to exactly one redundant sign bit, returns the shift */
+static int32_t arm_rfft_bfp_norm_q31(
+  q31_t * pSrc,
+  uint32_t blockSize)
+{
+  uint32_t bits = 0u, i;
+  int32_t shift;
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    bits |= ((uint32_t) pSrc[i] ^ ((uint32_t) pSrc[i] << 1));
+  }
+  if(bits == 0u)
+    return 0;
+
+  shift = 1 - (int32_t) __CLZ(bits);
+  if(shift > 0)
+  {
+    for (i = 0u; i < blockSize; i++)
+    {
+      pSrc[i] = (pSrc[i] >> 1) + (pSrc[i] & 1);
+    }
+  }
+  else if(shift < 0)
+  {
+    for (i = 0u; i < blockSize; i++)
+    {
+      pSrc[i] = pSrc[i] << -shift;
+    }
+  }
+
+  return (shift);
+}
+
+/**    
+* @addtogroup RealFFT    
+* @{    
+*/
+
+/**    
+* @brief Processing function for the Q31 block floating-point RFFT/RIFFT.   
+* @param[in]  *S    points to an instance of the Q31 RFFT/RIFFT structure.   
+* @param[in]  *pSrc points to the input buffer, which is modified.   
+* @param[out] *pDst points to the output buffer.   
+* @param[out] *pExp points to the block exponent of the result.   
+* @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the complex FFT length is not supported.   
+*    
+* \par   
+* Same buffers and instance as arm_rfft_q31(), with the complex FFT done by  
+* arm_cfft_bfp_q31(): <code>pDst[k] * 2^*pExp</code> is the true transform in  
+* the units of the input, whatever the length. The forward transform leaves  
+* one guard bit on the complex FFT output for the split into the real  
+* spectrum. The inverse first normalizes the <code>fftLenReal+2</code> input  
+* values to one guard bit, in place, and is not scaled by 1/fftLenReal.  
+*/
+
+arm_status arm_rfft_bfp_q31(
+    const arm_rfft_instance_q31 * S,
+    q31_t * pSrc,
+    q31_t * pDst,
+    int32_t * pExp)
+{
+  uint32_t L2 = S->fftLenReal >> 1;
+  int32_t shift, exp;
+  arm_status status;
+
+  if(S->ifftFlagR == 1u)
+  {
+    /* the split needs one guard bit on its input */
+    shift = arm_rfft_bfp_norm_q31(pSrc, S->fftLenReal + 2u);
+
+    /*  Real IFFT core process */
+    arm_split_rifft_q31(pSrc, L2, S->pTwiddleAReal,
+                        S->pTwiddleBReal, pDst, S->twidCoefRModifier);
+
+    /* Complex IFFT process */
+    status = arm_cfft_bfp_guard_q31(S->pCfft, pDst, 1u, S->bitReverseFlagR, 0u, &exp);
+
+    /* the split leaves a quarter of the spectrum, the input was scaled by 2^-shift */
+    *pExp = exp + shift + 2;
+  }
+  else
+  {
+    /* Complex FFT process, one guard bit left for the split */
+    status = arm_cfft_bfp_guard_q31(S->pCfft, pSrc, 0u, S->bitReverseFlagR, 1u, &exp);
+
+    /*  Real FFT core process, which halves */
+    if(status == ARM_MATH_SUCCESS)
+      arm_split_rfft_q31(pSrc, L2, S->pTwiddleAReal,
+                         S->pTwiddleBReal, pDst, S->twidCoefRModifier);
+
+    *pExp = exp + 1;
+  }
+
+  return (status);
+}
+
+/**    
+* @} end of RealFFT group    
+*/
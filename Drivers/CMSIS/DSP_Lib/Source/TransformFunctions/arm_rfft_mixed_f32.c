@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_rfft_mixed_f32.c   
+*    
+* Description:	Mixed-radix floating-point real FFT    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**   
+* @addtogroup RealFFT   
+* @{   
+*/
+
+/**   
+* @brief  Processing function for the floating-point mixed-radix real FFT.
+* @param[in]  *S        points to an instance of the floating-point mixed-radix RFFT structure.
+* @param[in]  *p        points to the input buffer of <code>fftLen</code> values, modified by the forward transform.
+* @param[out] *pOut     points to the output buffer of <code>fftLen</code> values.
+* @param[in]  ifftFlag  RFFT if flag is 0, RIFFT if flag is 1
+* @return none.
+*
+* \par
+* The real sequence of length <code>N = fftLen</code> is transformed as a complex sequence of length <code>N/2</code>
+* with <code>arm_cfft_mixed_f32()</code> followed by a split stage.  The spectrum is packed as for
+* <code>arm_rfft_fast_f32()</code>:
+* <pre>
+*    {X[0].re, X[N/2].re, X[1].re, X[1].im, ..., X[N/2-1].re, X[N/2-1].im}
+* </pre>
+* The inverse transform takes the spectrum in the same format in <code>p</code> and writes the real sequence to <code>pOut</code>.
+*/
+
+void arm_rfft_mixed_f32(
+    const arm_rfft_mixed_instance_f32 * S,
+    float32_t * p,
+    float32_t * pOut,
+    uint8_t ifftFlag)
+{
+    uint32_t  L = S->Sint.fftLen, k;
+    const float32_t *pTw = S->pTwiddleRFFT;
+    float32_t zr, zi, cr, ci, er, ei, odr, odi, wr, wi;
+
+    if(ifftFlag == 0u)
+    {
+        /* Z = CFFT(x[2n] + j*x[2n+1]) */
+        arm_cfft_mixed_f32(&S->Sint, p, 0u);
+
+        /* X[0] and X[N/2] are real */
+        pOut[0] = p[0] + p[1];
+        pOut[1] = p[0] - p[1];
+
+        for(k = 1u; k < L; k++)
+        {
+            /* Z[k] and conj(Z[N/2-k]) */
+            zr = p[2u * k];
+            zi = p[2u * k + 1u];
+            cr = p[2u * (L - k)];
+            ci = -p[2u * (L - k) + 1u];
+
+            /* E = (Z[k] + conj(Z[N/2-k])) / 2, O = -j * (Z[k] - conj(Z[N/2-k])) / 2 */
+            er = 0.5f * (zr + cr);
+            ei = 0.5f * (zi + ci);
+            odr = 0.5f * (zi - ci);
+            odi = 0.5f * (cr - zr);
+
+            /* X[k] = E + W_N^k * O */
+            wr = pTw[2u * k];
+            wi = pTw[2u * k + 1u];
+            pOut[2u * k]      = er + (odr * wr - odi * wi);
+            pOut[2u * k + 1u] = ei + (odr * wi + odi * wr);
+        }
+    }
+    else
+    {
+        /* E[0] = (X[0] + X[N/2]) / 2, O[0] = (X[0] - X[N/2]) / 2 */
+        pOut[0] = 0.5f * (p[0] + p[1]);
+        pOut[1] = 0.5f * (p[0] - p[1]);
+
+        for(k = 1u; k < L; k++)
+        {
+            /* X[k] and conj(X[N/2-k]) */
+            zr = p[2u * k];
+            zi = p[2u * k + 1u];
+            cr = p[2u * (L - k)];
+            ci = -p[2u * (L - k) + 1u];
+
+            /* E = (X[k] + conj(X[N/2-k])) / 2, O = conj(W_N^k) * (X[k] - conj(X[N/2-k])) / 2 */
+            er = 0.5f * (zr + cr);
+            ei = 0.5f * (zi + ci);
+            wr = pTw[2u * k];
+            wi = pTw[2u * k + 1u];
+            odr = 0.5f * ((zr - cr) * wr + (zi - ci) * wi);
+            odi = 0.5f * ((zi - ci) * wr - (zr - cr) * wi);
+
+            /* Z[k] = E + j*O */
+            pOut[2u * k]      = er - odi;
+            pOut[2u * k + 1u] = ei + odr;
+        }
+
+        /* x[2n] + j*x[2n+1] = CIFFT(Z) */
+        arm_cfft_mixed_f32(&S->Sint, pOut, 1u);
+    }
+}
+
+/**    
+* @} end of RealFFT group    
+*/
@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_rfft_mixed_init_f32.c   
+*    
+* Description:	Initialization function for the mixed-radix floating-point real FFT    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**   
+* @addtogroup RealFFT   
+* @{   
+*/
+
+/**   
+* @brief  Initialization function for the floating-point mixed-radix real FFT.
+* @param[in,out] *S         points to an instance of the floating-point mixed-radix RFFT structure.
+* @param[in]     fftLen     length of the real sequence, twice a product of 2, 3 and 5.
+* @param[out]    *pTwiddle  points to a buffer of <code>2*fftLen</code> values that receives the twiddle factors.
+* @param[in]     *pScratch  points to a scratch buffer of <code>fftLen</code> values.
+* @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR
+* if <code>fftLen</code> is odd or <code>fftLen/2</code> has a prime factor other than 2, 3 and 5.
+*/
+
+arm_status arm_rfft_mixed_init_f32(
+    arm_rfft_mixed_instance_f32 * S,
+    uint32_t fftLen,
+    float32_t * pTwiddle,
+    float32_t * pScratch)
+{
+    uint32_t k;
+    float64_t a;
+    arm_status status;
+
+    if((fftLen & 1u) != 0u)
+    {
+        return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* The first fftLen values hold the twiddles of the fftLen/2 point complex FFT */
+    status = arm_cfft_mixed_init_f32(&S->Sint, fftLen >> 1u, pTwiddle, pScratch);
+
+    if(status != ARM_MATH_SUCCESS)
+    {
+        return (status);
+    }
+
+    /* and the next fftLen values W_N^k = exp(-j*2*pi*k/N), k < N/2, of the split stage */
+    S->pTwiddleRFFT = pTwiddle + fftLen;
+
+    for(k = 0u; k < (fftLen >> 1u); k++)
+    {
+        a = (6.28318530717958647692 * (float64_t) k) / (float64_t) fftLen;
+        S->pTwiddleRFFT[2u * k]      = (float32_t) cos(a);
+        S->pTwiddleRFFT[2u * k + 1u] = (float32_t) -sin(a);
+    }
+
+    S->fftLenRFFT = fftLen;
+
+    return (ARM_MATH_SUCCESS);
+}
+
+/**    
+* @} end of RealFFT group    
+*/
@@ -0,0 +1,232 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_sdft_f32.c   
+*    
+* Description:	Floating-point sliding DFT    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup Goertzel    
+ * @{    
+ */
+
+/* Number of combed input samples computed at a time, kept on the stack */
+#define ARM_SDFT_CHUNK  32u
+
+/**    
+ * @brief Processing function for the floating-point sliding DFT.    
+ * @param[in,out] *S         points to an instance of the floating-point sliding DFT structure.    
+ * @param[in]     *pSrc      points to the input samples.    
+ * @param[out]    *pDst      points to the output buffer of <code>2*numBins</code> values, or NULL.    
+ * @param[in]     blockSize  number of input samples.    
+ * @return none.    
+ *    
+ * \par    
+ * The bins are updated at every input sample; after the call <code>pDst</code>, if not NULL, holds them as they are    
+ * after the last sample, the DFT of the last N samples.  Call the function with <code>blockSize = 1</code> to look at    
+ * every sample.    
+ * \par    
+ * The comb <code>x[n] - r^N*x[n-N]</code> is computed once for a piece of input and shared by all bins, which are then    
+ * updated four at a time over that piece.    
+ */
+
+void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t comb[ARM_SDFT_CHUNK];                /*  combed input                          */
+  float32_t *pState, *pCoeffs, *pC;              /*  state, coefficient and comb pointers  */
+  float32_t *pDelay = S->pDelay;                 /*  delay line                            */
+  float32_t rN = S->rN;                          /*  damping over the window, r^N          */
+  float32_t cra, cia, xra, xia, t;               /*  coefficient and state of bin a        */
+  uint32_t numBins = S->numBins;                 /*  number of bins                        */
+  uint32_t pos = S->pos;                         /*  position of x[n-N] in the delay line  */
+  uint32_t blkCnt, len, bin, i;                  /*  loop counters                         */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  float32_t crb, cib, xrb, xib;                  /*  coefficient and state of bin b        */
+  float32_t crc, cic, xrc, xic;                  /*  coefficient and state of bin c        */
+  float32_t crd, cid, xrd, xid;                  /*  coefficient and state of bin d        */
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blockSize > 0u)
+  {
+    len = (blockSize > ARM_SDFT_CHUNK) ? ARM_SDFT_CHUNK : blockSize;
+
+    /* comb[n] = x[n] - r^N * x[n-N], the delay line is a ring of N samples */
+    for(i = 0u; i < len; i++)
+    {
+      t = pSrc[i];
+      comb[i] = t - rN * pDelay[pos];
+      pDelay[pos] = t;
+
+      pos++;
+
+      if(pos == S->blockLen)
+      {
+        pos = 0u;
+      }
+    }
+
+    pState = S->pState;
+    pCoeffs = S->pCoeffs;
+    bin = 0u;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Four bins at a time */
+    for(; (bin + 4u) <= numBins; bin += 4u)
+    {
+      cra = pCoeffs[0];
+      cia = pCoeffs[1];
+      crb = pCoeffs[2];
+      cib = pCoeffs[3];
+      crc = pCoeffs[4];
+      cic = pCoeffs[5];
+      crd = pCoeffs[6];
+      cid = pCoeffs[7];
+
+      xra = pState[0];
+      xia = pState[1];
+      xrb = pState[2];
+      xib = pState[3];
+      xrc = pState[4];
+      xic = pState[5];
+      xrd = pState[6];
+      xid = pState[7];
+
+      pC = comb;
+      blkCnt = len;
+
+      while(blkCnt > 0u)
+      {
+        /* S = r*exp(j*w) * (S + comb) */
+        t = *pC++;
+
+        xra += t;
+        xrb += t;
+        xrc += t;
+        xrd += t;
+
+        t = xra;
+        xra = cra * t - cia * xia;
+        xia = cia * t + cra * xia;
+
+        t = xrb;
+        xrb = crb * t - cib * xib;
+        xib = cib * t + crb * xib;
+
+        t = xrc;
+        xrc = crc * t - cic * xic;
+        xic = cic * t + crc * xic;
+
+        t = xrd;
+        xrd = crd * t - cid * xid;
+        xid = cid * t + crd * xid;
+
+        /* decrement the loop counter */
+        blkCnt--;
+      }
+
+      pState[0] = xra;
+      pState[1] = xia;
+      pState[2] = xrb;
+      pState[3] = xib;
+      pState[4] = xrc;
+      pState[5] = xic;
+      pState[6] = xrd;
+      pState[7] = xid;
+
+      pState += 8u;
+      pCoeffs += 8u;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    /* The remaining bins one at a time */
+    for(; bin < numBins; bin++)
+    {
+      cra = pCoeffs[0];
+      cia = pCoeffs[1];
+      xra = pState[0];
+      xia = pState[1];
+
+      pC = comb;
+      blkCnt = len;
+
+      while(blkCnt > 0u)
+      {
+        t = xra + *pC++;
+        xra = cra * t - cia * xia;
+        xia = cia * t + cra * xia;
+
+        blkCnt--;
+      }
+
+      pState[0] = xra;
+      pState[1] = xia;
+
+      pState += 2u;
+      pCoeffs += 2u;
+    }
+
+    pSrc += len;
+    blockSize -= len;
+  }
+
+  S->pos = pos;
+
+  if(pDst != NULL)
+  {
+    memcpy(pDst, S->pState, 2u * numBins * sizeof(float32_t));
+  }
+}
+
+/**    
+ * @} end of Goertzel group    
+ */
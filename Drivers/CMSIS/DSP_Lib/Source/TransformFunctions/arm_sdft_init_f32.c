@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_sdft_init_f32.c   
+*    
+* Description:	Initialization function for the floating-point sliding DFT    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup Goertzel    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point sliding DFT.    
+ * @param[in,out] *S         points to an instance of the floating-point sliding DFT structure.    
+ * @param[in]     numBins    number of bins.    
+ * @param[in]     blockLen   window length, the DFT length N.    
+ * @param[in]     *pBins     points to the <code>numBins</code> integer bin numbers <code>k</code>, from 0 to N/2.    
+ * @param[in]     r          damping factor, 0 < r <= 1.    
+ * @param[out]    *pCoeffs   points to the coefficient buffer of <code>2*numBins</code> values.    
+ * @param[in]     *pState    points to the state buffer of <code>2*numBins</code> values.    
+ * @param[in]     *pDelay    points to the delay line of <code>blockLen</code> values.    
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or    
+ * ARM_MATH_ARGUMENT_ERROR if <code>numBins</code> or <code>blockLen</code> is 0 or <code>r</code> is out of range.    
+ *    
+ * \par    
+ * The coefficients of each bin are <code>{r*cos(w), r*sin(w)}</code> with <code>w = 2*pi*k/N</code>.    
+ * The state and the delay line are cleared, as if the input had been 0 for the last N samples.    
+ */
+
+arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t numBins,
+  uint32_t blockLen,
+  const uint16_t * pBins,
+  float32_t r,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pDelay)
+{
+  float64_t w;
+  uint32_t i;
+
+  if((numBins == 0u) || (blockLen == 0u) || (r <= 0.0f) || (r > 1.0f))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for(i = 0u; i < numBins; i++)
+  {
+    w = (6.28318530717958647692 * (float64_t) pBins[i]) / (float64_t) blockLen;
+
+    pCoeffs[2u * i]      = (float32_t) ((float64_t) r * cos(w));
+    pCoeffs[2u * i + 1u] = (float32_t) ((float64_t) r * sin(w));
+  }
+
+  memset(pState, 0, 2u * numBins * sizeof(float32_t));
+  memset(pDelay, 0, blockLen * sizeof(float32_t));
+
+  S->numBins = numBins;
+  S->blockLen = blockLen;
+  S->pos = 0u;
+  S->rN = (float32_t) pow((float64_t) r, (float64_t) blockLen);
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->pDelay = pDelay;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of Goertzel group    
+ */
@@ -0,0 +1,276 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_stft_f32.c   
+*    
+* Description:	Floating-point STFT and Welch power spectrum    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @defgroup STFT Short-Time Fourier Transform and Welch Power Spectrum    
+ *    
+ * These functions turn a stream of real samples into rows of a power spectrogram, or of a Welch power    
+ * spectrum estimate when several frames are averaged into one row.  Frame <code>i</code> starts at input    
+ * sample <code>i*hopLen</code> and holds <code>fftLen</code> (N) samples; the row written for frames    
+ * <code>i ... i+numAvg-1</code> is    
+ * <pre>    
+ *    P[k] = scale / numAvg * sum(frames) |X[k]|^2,   k = 0 ... N/2    
+ *    X[k] = sum(n = 0 ... N-1) w[n] * x[i*hopLen + n] * exp(-j*2*pi*k*n/N)    
+ * </pre>    
+ * the same as <code>mean(abs(rfft(frames * w))**2) * scale</code> over the frames of the row in numpy.    
+ * <code>numAvg = 1</code> gives a spectrogram, one row per frame.    
+ *    
+ * \par    
+ * The input may be passed in pieces of any length; it is copied into a ring of the last N samples and a    
+ * frame is processed whenever <code>hopLen</code> new samples have arrived (N for the first frame).  A frame    
+ * then costs three passes over memory:    
+ * - the window is applied while the frame is read out of the ring (arm_mult_f32() on the two pieces of the ring),    
+ * - arm_rfft_fast_f32() of the windowed frame,    
+ * - the squared magnitudes are formed straight from the packed FFT output, added to the accumulator, and on the    
+ *   last frame of a row scaled and written to the output row instead of the accumulator.    
+ * The hand written chain of copy, arm_mult_f32(), arm_rfft_fast_f32(), arm_cmplx_mag_squared_f32(), arm_add_f32() and    
+ * arm_scale_f32() takes six, and also gets the packed DC and Nyquist bins of the real FFT wrong.    
+ *    
+ * \par    
+ * Rows are only written, one after the other, so the output may be placed in slow memory such as the SDRAM    
+ * while the ring, work buffer and accumulator stay in the DTCM.    
+ *    
+ * \par Scaling    
+ * With <code>scale = 1</code> the rows are the averaged |X[k]|^2.  For a power spectral density in units^2/Hz use    
+ * <code>scale = 1 / (fs * sum(w[n]^2))</code> and double the bins 1 ... N/2-1 for a one-sided density; for a    
+ * power spectrum, where a sine of amplitude A reads A^2/4 in its bin, use <code>scale = 1 / sum(w[n])^2</code>.    
+ */
+
+/**    
+ * @addtogroup STFT    
+ * @{    
+ */
+
+/* row[k] = (acc[k] + |X[k]|^2) * scale, acc NULL for the first frame of a row */
+static void arm_stft_power_f32(
+  const float32_t * pSpec,
+  const float32_t * pAcc,
+  float32_t * pOut,
+  float32_t scale,
+  uint32_t fftLen)
+{
+  float32_t re, im;                              /*  spectrum values                       */
+  float32_t dc = pSpec[0] * pSpec[0];            /*  DC bin, packed at index 0             */
+  float32_t nyq = pSpec[1] * pSpec[1];           /*  real Nyquist bin, packed at index 1   */
+  float32_t out;                                 /*  power of one bin                      */
+  uint32_t blkCnt;                               /*  loop counter                          */
+#ifndef ARM_MATH_CM0_FAMILY
+  float32_t in1, in2, in3, in4;                  /*  spectrum values of two bins           */
+#endif
+
+  /* pAcc may equal pOut, every bin is read before it is written */
+  if(pAcc != NULL)
+  {
+    dc += pAcc[0];
+    nyq += pAcc[fftLen >> 1];
+    pAcc++;
+  }
+
+  pOut[0] = dc * scale;
+  pOut[fftLen >> 1] = nyq * scale;
+
+  pSpec += 2u;
+  pOut++;
+  blkCnt = (fftLen >> 1) - 1u;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  if(pAcc != NULL)
+  {
+    while(blkCnt >= 2u)
+    {
+      in1 = pSpec[0];
+      in2 = pSpec[1];
+      in3 = pSpec[2];
+      in4 = pSpec[3];
+
+      pOut[0] = (pAcc[0] + (in1 * in1 + in2 * in2)) * scale;
+      pOut[1] = (pAcc[1] + (in3 * in3 + in4 * in4)) * scale;
+
+      pSpec += 4u;
+      pAcc += 2u;
+      pOut += 2u;
+      blkCnt -= 2u;
+    }
+  }
+  else
+  {
+    while(blkCnt >= 2u)
+    {
+      in1 = pSpec[0];
+      in2 = pSpec[1];
+      in3 = pSpec[2];
+      in4 = pSpec[3];
+
+      pOut[0] = (in1 * in1 + in2 * in2) * scale;
+      pOut[1] = (in3 * in3 + in4 * in4) * scale;
+
+      pSpec += 4u;
+      pOut += 2u;
+      blkCnt -= 2u;
+    }
+  }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    re = pSpec[0];
+    im = pSpec[1];
+
+    out = re * re + im * im;
+    if(pAcc != NULL)
+    {
+      out += *pAcc++;
+    }
+    *pOut++ = out * scale;
+
+    pSpec += 2u;
+    blkCnt--;
+  }
+}
+
+/* processes the frame that ends at the newest sample of the ring */
+static uint32_t arm_stft_frame_f32(
+  arm_stft_instance_f32 * S,
+  float32_t * pDst)
+{
+  uint32_t N = S->fftLen;
+  uint32_t pos = S->pos;                         /*  oldest sample of the ring             */
+  float32_t *pFrame = S->pFrame;                 /*  windowed frame                        */
+  float32_t *pSpec = S->pFrame + N;              /*  packed real FFT of the frame          */
+  const float32_t *pAcc;
+
+  /* window the frame while it is read out of the ring, oldest sample first */
+  arm_mult_f32(S->pRing + pos, (float32_t *) S->pWindow, pFrame, N - pos);
+  if(pos > 0u)
+  {
+    arm_mult_f32(S->pRing, (float32_t *) S->pWindow + (N - pos), pFrame + (N - pos), pos);
+  }
+
+  arm_rfft_fast_f32(&S->rfft, pFrame, pSpec, 0u);
+
+  pAcc = (S->avgCount == 0u) ? NULL : S->pAcc;
+  S->avgCount++;
+
+  if(S->avgCount < S->numAvg)
+  {
+    arm_stft_power_f32(pSpec, pAcc, S->pAcc, 1.0f, N);
+    return (0u);
+  }
+
+  arm_stft_power_f32(pSpec, pAcc, pDst, S->scale, N);
+  S->avgCount = 0u;
+  return (1u);
+}
+
+/**    
+ * @brief Processing function for the floating-point STFT and Welch power spectrum.    
+ * @param[in,out] *S         points to an instance of the floating-point STFT structure.    
+ * @param[in]     *pSrc      points to the input samples.    
+ * @param[out]    *pDst      points to the output rows, <code>fftLen/2+1</code> values each.    
+ * @param[in]     blockSize  number of input samples.    
+ * @return        number of rows written by this call.    
+ *    
+ * \par    
+ * A call writes at most <code>(blockSize + fftLen) / (hopLen * numAvg)</code> rows, one after the other from    
+ * <code>pDst</code> on.    
+ */
+
+uint32_t arm_stft_f32(
+  arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t N = S->fftLen;
+  uint32_t rows = 0u;                            /*  rows written                          */
+  uint32_t len, part;
+
+  while(blockSize > 0u)
+  {
+    /* copy up to the start of the next frame into the ring */
+    len = (blockSize < S->need) ? blockSize : S->need;
+    blockSize -= len;
+    S->need -= len;
+
+    while(len > 0u)
+    {
+      part = N - S->pos;
+      if(part > len)
+      {
+        part = len;
+      }
+
+      memcpy(S->pRing + S->pos, pSrc, part * sizeof(float32_t));
+      pSrc += part;
+      len -= part;
+
+      S->pos += part;
+      if(S->pos == N)
+      {
+        S->pos = 0u;
+      }
+    }
+
+    if(S->need == 0u)
+    {
+      if(arm_stft_frame_f32(S, pDst + rows * ((N >> 1) + 1u)))
+      {
+        rows++;
+      }
+      S->need = S->hopLen;
+    }
+  }
+
+  return (rows);
+}
+
+/**    
+ * @} end of STFT group    
+ */
@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_stft_init_f32.c   
+*    
+* Description:	Floating-point STFT and Welch power spectrum initialization function    
+*    
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.  
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup STFT    
+ * @{    
+ */
+
+/**    
+ * @brief  Initialization function for the floating-point STFT and Welch power spectrum.    
+ * @param[in,out] *S         points to an instance of the floating-point STFT structure.    
+ * @param[in]     fftLen     frame length N, a length supported by arm_rfft_fast_f32().    
+ * @param[in]     hopLen     samples from the start of one frame to the start of the next.    
+ * @param[in]     numAvg     frames averaged into one output row, 1 for a spectrogram.    
+ * @param[in]     scale      scale of the output rows, see \ref STFT.    
+ * @param[in]     *pWindow   points to the window table of <code>fftLen</code> values.    
+ * @param[in]     *pRing     points to the input ring of <code>fftLen</code> values.    
+ * @param[in]     *pFrame    points to the work buffer of <code>2*fftLen</code> values.    
+ * @param[in]     *pAcc      points to the accumulator of <code>fftLen/2+1</code> values, may be NULL if <code>numAvg</code> is 1.    
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or    
+ * ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported, <code>hopLen</code> or <code>numAvg</code> is 0    
+ * or the accumulator is missing.    
+ *    
+ * \par    
+ * The window is any precomputed table, e.g. a periodic Hann window <code>w[n] = 0.5 - 0.5*cos(2*pi*n/N)</code>.    
+ * A <code>hopLen</code> larger than <code>fftLen</code> skips the samples between frames.  The ring is cleared and    
+ * the first frame is processed once <code>fftLen</code> samples have been passed in.    
+ */
+
+arm_status arm_stft_init_f32(
+  arm_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopLen,
+  uint16_t numAvg,
+  float32_t scale,
+  const float32_t * pWindow,
+  float32_t * pRing,
+  float32_t * pFrame,
+  float32_t * pAcc)
+{
+  if((hopLen == 0u) || (numAvg == 0u) || ((numAvg > 1u) && (pAcc == NULL)))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  if(arm_rfft_fast_init_f32(&S->rfft, fftLen) != ARM_MATH_SUCCESS)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  memset(pRing, 0, fftLen * sizeof(float32_t));
+
+  S->fftLen = fftLen;
+  S->hopLen = hopLen;
+  S->numAvg = numAvg;
+  S->avgCount = 0u;
+  S->pos = 0u;
+  S->need = fftLen;
+  S->scale = scale / (float32_t) numAvg;
+  S->pWindow = pWindow;
+  S->pRing = pRing;
+  S->pFrame = pFrame;
+  S->pAcc = pAcc;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**    
+ * @} end of STFT group    
+ */
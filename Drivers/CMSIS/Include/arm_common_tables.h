@@ -46,6 +46,9 @@
 extern const uint16_t armBitRevTable[1024];
 extern const q15_t armRecipTableQ15[64];
 extern const q31_t armRecipTableQ31[64];
+extern const uint32_t armExp2TableQ32[32];
+extern const q31_t armLogInvTableQ31[32];
+extern const q31_t armLogTableQ31[32];
 /* extern const q31_t realCoefAQ31[1024]; */
 /* extern const q31_t realCoefBQ31[1024]; */
 extern const float32_t twiddleCoef_16[32];
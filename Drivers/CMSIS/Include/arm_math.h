@@ -138,6 +138,13 @@
    *
    * Initialize macro __FPU_PRESENT = 1 when building on FPU supported Targets. Enable this macro for M4bf and M4lf libraries
    *
+   * - ARM_MATH_HOST:
+   *
+   * Define macro ARM_MATH_HOST to build the library with a host compiler (e.g. gcc on Linux). The Cortex-M
+   * instructions are replaced by the portable C versions in <code>core_cmSimd.h</code>, which give bit-exact results.
+   * The Cortex-M7 code paths are built unless one of the ARM_MATH_CMx macros selects another core. The library
+   * reinterprets q7/q15 pointers as packed words, so build it with <code>-fno-strict-aliasing</code>.
+   *
    * <hr>
    * CMSIS-DSP in ARM::CMSIS Pack
    * -----------------------------
@@ -171,6 +178,8 @@
  * This set of functions provides a fast approximation to sine, cosine, and square root.
  * As compared to most of the other functions in the CMSIS math library, the fast math functions
  * operate on individual values and not arrays.
+ * The exceptions are the arm_v... functions (exponential, logarithm, arctangent,
+ * hyperbolic tangent, logistic and square root), which process whole vectors.
  * There are separate functions for Q15, Q31, and floating-point data.
  *
  */
@@ -278,10 +287,19 @@
 /**
  * @defgroup groupInterpolation Interpolation Functions
  * These functions perform 1- and 2-dimensional interpolation of data.
- * Linear interpolation is used for 1-dimensional data and
+ * Linear interpolation and cubic splines are used for 1-dimensional data and
  * bilinear interpolation is used for 2-dimensional data.
  */
 
+/**
+ * @defgroup groupNN Neural Network Functions
+ * Quantized inference layers for Q7 (int8) models: convolutions, fully connected,
+ * pooling and activations. Tensors are HWC with the channels of a pixel adjacent in
+ * memory. Weights are symmetric Q7, biases are Q31 in the accumulator scale and every
+ * layer requantizes its outputs per channel with a Q31 multiplier and a shift, so
+ * results match the integer reference of TensorFlow Lite bit for bit.
+ */
+
 /**
  * @defgroup groupExamples Examples
  */
@@ -298,7 +316,18 @@
 
 #define __CMSIS_GENERIC         /* disable NVIC and Systick functions */
 
-#if defined(ARM_MATH_CM7)
+#if defined (ARM_MATH_HOST)
+  #if !defined (ARM_MATH_CM4) && !defined (ARM_MATH_CM3) && !defined (ARM_MATH_CM0) && !defined (ARM_MATH_CM0PLUS) && !defined (ARM_MATH_CM7)
+    #define ARM_MATH_CM7
+  #endif
+  #if defined (ARM_MATH_CM0) || defined (ARM_MATH_CM0PLUS)
+    #define ARM_MATH_CM0_FAMILY
+  #endif
+  #ifndef __FPU_USED
+    #define __FPU_USED       0U
+  #endif
+  #include "core_cmSimd.h"
+#elif defined(ARM_MATH_CM7)
   #include "core_cm7.h"
 #elif defined (ARM_MATH_CM4)
   #include "core_cm4.h"
@@ -411,10 +440,23 @@ extern "C"
    */
   typedef double float64_t;
 
+  /**
+   * @brief 16-bit floating-point storage type, the bits of an IEEE 754 binary16 value.
+   * The functions widen it to float32_t for arithmetic, see \ref f16_to_x.
+   */
+  typedef uint16_t float16_t;
+
   /**
    * @brief definition to read/write two 16 bit values.
    */
-#if defined __CC_ARM
+#if defined ARM_MATH_HOST
+  typedef int32_t __attribute__((aligned(1), may_alias)) arm_host_simd32_t;
+  typedef int64_t __attribute__((aligned(1), may_alias)) arm_host_simd64_t;
+  #define __SIMD32_TYPE arm_host_simd32_t
+  #define __SIMD64_TYPE arm_host_simd64_t
+  #define CMSIS_UNUSED __attribute__((unused))
+
+#elif defined __CC_ARM
   #define __SIMD32_TYPE int32_t __packed
   #define CMSIS_UNUSED __attribute__((unused))
 
@@ -445,7 +487,10 @@ extern "C"
 #define __SIMD32(addr)        (*(__SIMD32_TYPE **) & (addr))
 #define __SIMD32_CONST(addr)  ((__SIMD32_TYPE *)(addr))
 #define _SIMD32_OFFSET(addr)  (*(__SIMD32_TYPE *)  (addr))
-#define __SIMD64(addr)        (*(int64_t **) & (addr))
+#ifndef __SIMD64_TYPE
+  #define __SIMD64_TYPE int64_t
+#endif
+#define __SIMD64(addr)        (*(__SIMD64_TYPE **) & (addr))
 
 #if defined (ARM_MATH_CM3) || defined (ARM_MATH_CM0_FAMILY)
   /**
@@ -478,6 +523,184 @@ extern "C"
 #endif
 
 
+  /**
+   * @brief Converts one half-precision value to single precision, exact.
+   */
+  static __INLINE float32_t arm_f16_to_f32_1(
+  float16_t in)
+  {
+#if   (__FPU_USED == 1) && defined(__ARM_FP16_FORMAT_IEEE)
+    union
+    {
+      float16_t u;
+      __fp16 h;
+    } v;
+
+    v.u = in;
+    return (float32_t) v.h;
+#elif (__FPU_USED == 1) && defined(__GNUC__) && !defined(__CC_ARM)
+    float32_t out;
+
+    __ASM volatile ("vmov %0, %1\n\tvcvtb.f32.f16 %0, %0" : "=t"(out) : "r"((uint32_t) in));
+    return out;
+#else
+    union
+    {
+      float32_t f;
+      uint32_t u;
+    } v;
+    uint32_t sign = ((uint32_t) in & 0x8000u) << 16;
+    uint32_t bits = (uint32_t) in & 0x7FFFu;
+
+    if(bits >= 0x7C00u)
+    {
+      /* infinity and NaN */
+      v.u = sign | 0x7F800000u | ((bits & 0x3FFu) << 13);
+    }
+    else if(bits >= 0x0400u)
+    {
+      /* normal, rebias the exponent from 15 to 127 */
+      v.u = sign | ((bits << 13) + 0x38000000u);
+    }
+    else
+    {
+      /* zero and subnormal, m * 2^-24 is exact in single precision */
+      v.f = (float32_t) bits * 5.9604644775390625e-8f;
+      v.u |= sign;
+    }
+
+    return v.f;
+#endif
+  }
+
+  /**
+   * @brief Converts one single-precision value to half precision, rounded to nearest even.
+   */
+  static __INLINE float16_t arm_f32_to_f16_1(
+  float32_t in)
+  {
+#if   (__FPU_USED == 1) && defined(__ARM_FP16_FORMAT_IEEE)
+    union
+    {
+      float16_t u;
+      __fp16 h;
+    } v;
+
+    v.h = (__fp16) in;
+    return v.u;
+#elif (__FPU_USED == 1) && defined(__GNUC__) && !defined(__CC_ARM)
+    float32_t t;
+    uint32_t out;
+
+    __ASM volatile ("vcvtb.f16.f32 %1, %2\n\tvmov %0, %1" : "=r"(out), "=&t"(t) : "t"(in));
+    return (float16_t) out;
+#else
+    union
+    {
+      float32_t f;
+      uint32_t u;
+    } v;
+    uint32_t sign, bits, shift, rem, half;
+
+    v.f = in;
+    sign = (v.u >> 16) & 0x8000u;
+    bits = v.u & 0x7FFFFFFFu;
+
+    if(bits > 0x7F800000u)
+    {
+      /* NaN, quieted, keeps the top of the payload */
+      return (float16_t) (sign | 0x7E00u | ((bits >> 13) & 0x1FFu));
+    }
+    if(bits >= 0x477FF000u)
+    {
+      /* 65520 and above round to infinity */
+      return (float16_t) (sign | 0x7C00u);
+    }
+    if(bits >= 0x38800000u)
+    {
+      /* normal, rebias the exponent and round the 13 dropped bits */
+      bits -= 0x38000000u;
+      return (float16_t) (sign | ((bits + 0x0FFFu + ((bits >> 13) & 1u)) >> 13));
+    }
+    if(bits <= 0x33000000u)
+    {
+      /* 2^-25 and below round to zero */
+      return (float16_t) sign;
+    }
+
+    /* subnormal, the significand shifted to units of 2^-24 */
+    shift = 126u - (bits >> 23);
+    bits = (bits & 0x007FFFFFu) | 0x00800000u;
+    rem = bits & ((1u << shift) - 1u);
+    half = 1u << (shift - 1u);
+    bits >>= shift;
+    bits += ((rem > half) || ((rem == half) && ((bits & 1u) != 0u))) ? 1u : 0u;
+
+    return (float16_t) (sign | bits);
+#endif
+  }
+
+  /**
+   * @brief Converts two half-precision values read as one word, VCVTB and VCVTT on the FPU.
+   * @param[in]  in    two values, as read from memory with <code>*__SIMD32(p)</code>.
+   * @param[out] pA    value at the lower address.
+   * @param[out] pB    value at the higher address.
+   */
+  static __INLINE void arm_f16x2_to_f32(
+  q31_t in,
+  float32_t * pA,
+  float32_t * pB)
+  {
+#if   (__FPU_USED == 1) && defined(__GNUC__) && !defined(__CC_ARM) && !defined(__ARM_FP16_FORMAT_IEEE)
+    float32_t t, lo, hi;
+
+    __ASM volatile ("vmov %0, %1" : "=t"(t) : "r"(in));
+    __ASM volatile ("vcvtb.f32.f16 %0, %1" : "=t"(lo) : "t"(t));
+    __ASM volatile ("vcvtt.f32.f16 %0, %1" : "=t"(hi) : "t"(t));
+#else
+    float32_t lo = arm_f16_to_f32_1((float16_t) in);
+    float32_t hi = arm_f16_to_f32_1((float16_t) ((uint32_t) in >> 16));
+#endif
+
+#ifndef ARM_MATH_BIG_ENDIAN
+    *pA = lo;
+    *pB = hi;
+#else
+    *pA = hi;
+    *pB = lo;
+#endif
+  }
+
+  /**
+   * @brief Converts two single-precision values to half precision, packed for one word store.
+   * @param[in]  a     value for the lower address.
+   * @param[in]  b     value for the higher address.
+   * @return two values, to be written with <code>*__SIMD32(p)</code>.
+   */
+  static __INLINE uint32_t arm_f32x2_to_f16(
+  float32_t a,
+  float32_t b)
+  {
+#ifdef ARM_MATH_BIG_ENDIAN
+    float32_t t = a;
+
+    a = b;
+    b = t;
+#endif
+
+#if   (__FPU_USED == 1) && defined(__GNUC__) && !defined(__CC_ARM) && !defined(__ARM_FP16_FORMAT_IEEE)
+    float32_t s;
+    uint32_t out;
+
+    __ASM volatile ("vcvtb.f16.f32 %1, %2\n\tvcvtt.f16.f32 %1, %3\n\tvmov %0, %1"
+                    : "=r"(out), "=&t"(s) : "t"(a), "t"(b));
+    return out;
+#else
+    return (uint32_t) arm_f32_to_f16_1(a) | ((uint32_t) arm_f32_to_f16_1(b) << 16);
+#endif
+  }
+
+
   /**
    * @brief Clips Q63 to Q31 values.
    */
@@ -1063,6 +1286,16 @@ extern "C"
     float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
   } arm_fir_instance_f32;
 
+  /**
+   * @brief Instance structure for the FIR filter with half-precision coefficients.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;          /**< number of filter coefficients in the filter. */
+    float32_t *pState;         /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    const float16_t *pCoeffs;  /**< points to the half-precision coefficient array. The array is of length numTaps. */
+  } arm_fir_instance_f16_f32;
+
 
   /**
    * @brief Processing function for the Q7 FIR filter.
@@ -1214,6 +1447,36 @@ extern "C"
   uint32_t blockSize);
 
 
+  /**
+   * @brief Processing function for the FIR filter with half-precision coefficients.
+   * @param[in]  S          points to an instance of the FIR structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_fir_f16_f32(
+  const arm_fir_instance_f16_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the FIR filter with half-precision coefficients.
+   * @param[in,out] S          points to an instance of the FIR filter structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the half-precision filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of samples that are processed at a time.
+   */
+  void arm_fir_init_f16_f32(
+  arm_fir_instance_f16_f32 * S,
+  uint16_t numTaps,
+  const float16_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the Q15 Biquad cascade filter.
    */
@@ -1384,6 +1647,16 @@ extern "C"
     float64_t *pData;     /**< points to the data of the matrix. */
   } arm_matrix_instance_f64;
 
+  /**
+   * @brief Instance structure for the half-precision floating-point matrix structure.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    float16_t *pData;     /**< points to the data of the matrix. */
+  } arm_matrix_instance_f16;
+
   /**
    * @brief Instance structure for the Q15 matrix structure.
    */
@@ -1404,6 +1677,78 @@ extern "C"
     q31_t *pData;         /**< points to the data of the matrix. */
   } arm_matrix_instance_q31;
 
+  /**
+   * @brief Instance structure for the floating-point sparse matrix in compressed sparse row format.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.                        */
+    uint16_t numCols;     /**< number of columns of the matrix.                     */
+    uint32_t *pRowPtr;    /**< points to the numRows + 1 row offsets.               */
+    uint16_t *pColIdx;    /**< points to the column indices of the values.          */
+    float32_t *pData;     /**< points to the non-zero values.                       */
+  } arm_matrix_csr_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sparse matrix in compressed sparse row format.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.                        */
+    uint16_t numCols;     /**< number of columns of the matrix.                     */
+    uint32_t *pRowPtr;    /**< points to the numRows + 1 row offsets.               */
+    uint16_t *pColIdx;    /**< points to the column indices of the values.          */
+    q31_t *pData;         /**< points to the non-zero values.                       */
+  } arm_matrix_csr_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sparse matrix in compressed sparse row format.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.                        */
+    uint16_t numCols;     /**< number of columns of the matrix.                     */
+    uint32_t *pRowPtr;    /**< points to the numRows + 1 row offsets.               */
+    uint16_t *pColIdx;    /**< points to the column indices of the values.          */
+    q15_t *pData;         /**< points to the non-zero values.                       */
+  } arm_matrix_csr_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point banded matrix.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.                        */
+    uint16_t numCols;     /**< number of columns of the matrix.                     */
+    uint16_t numLower;    /**< number of diagonals below the main diagonal.         */
+    uint16_t numUpper;    /**< number of diagonals above the main diagonal.         */
+    float32_t *pData;     /**< points to numRows * (numLower + numUpper + 1) values. */
+  } arm_matrix_band_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 banded matrix.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.                        */
+    uint16_t numCols;     /**< number of columns of the matrix.                     */
+    uint16_t numLower;    /**< number of diagonals below the main diagonal.         */
+    uint16_t numUpper;    /**< number of diagonals above the main diagonal.         */
+    q31_t *pData;         /**< points to numRows * (numLower + numUpper + 1) values. */
+  } arm_matrix_band_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 banded matrix.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.                        */
+    uint16_t numCols;     /**< number of columns of the matrix.                     */
+    uint16_t numLower;    /**< number of diagonals below the main diagonal.         */
+    uint16_t numUpper;    /**< number of diagonals above the main diagonal.         */
+    q15_t *pData;         /**< points to numRows * (numLower + numUpper + 1) values. */
+  } arm_matrix_band_instance_q15;
+
 
   /**
    * @brief Floating-point matrix addition.
@@ -1834,6 +2179,151 @@ extern "C"
   arm_pid_instance_q15 * S);
 
 
+  /**
+   * @brief Instance structure for a batch of Q15 PID Controls.
+   */
+  typedef struct
+  {
+    uint16_t numLoops;           /**< number of loops N. */
+    uint8_t antiWindup;          /**< 1 to feed the limited output back to the integrator. */
+    q15_t *pCoeffs;              /**< points to the derived gains, 3*N values. */
+    q15_t *pState;               /**< points to the state, 3*N values. */
+    const q15_t *pLimits;        /**< points to the N lower followed by the N upper output limits, NULL without limits. */
+  } arm_pid_batch_instance_q15;
+
+  /**
+   * @brief Instance structure for a batch of Q31 PID Controls.
+   */
+  typedef struct
+  {
+    uint16_t numLoops;           /**< number of loops N. */
+    uint8_t antiWindup;          /**< 1 to feed the limited output back to the integrator. */
+    q31_t *pCoeffs;              /**< points to the derived gains, 3*N values. */
+    q31_t *pState;               /**< points to the state, 3*N values. */
+    const q31_t *pLimits;        /**< points to the N lower followed by the N upper output limits, NULL without limits. */
+  } arm_pid_batch_instance_q31;
+
+  /**
+   * @brief Instance structure for a batch of floating-point PID Controls.
+   */
+  typedef struct
+  {
+    uint16_t numLoops;           /**< number of loops N. */
+    uint8_t antiWindup;          /**< 1 to feed the limited output back to the integrator. */
+    float32_t *pCoeffs;          /**< points to the derived gains, 3*N values. */
+    float32_t *pState;           /**< points to the state, 3*N values. */
+    const float32_t *pLimits;    /**< points to the N lower followed by the N upper output limits, NULL without limits. */
+  } arm_pid_batch_instance_f32;
+
+  /**
+   * @brief  Initialization function for a batch of floating-point PID Controls.
+   * @param[in,out] S           points to an instance of the floating-point batched PID structure.
+   * @param[in]     numLoops    number of loops N.
+   * @param[in]     pKp         points to the proportional gains, N values.
+   * @param[in]     pKi         points to the integral gains, N values.
+   * @param[in]     pKd         points to the derivative gains, N values.
+   * @param[out]    pCoeffs     points to the derived gains, 3*N values.
+   * @param[out]    pState      points to the state, 3*N values.
+   * @param[in]     pLimits     points to the N lower followed by the N upper output limits, or NULL.
+   * @param[in]     antiWindup  1 to hold the integrator at the limits, 0 to let it run on.
+   */
+  void arm_pid_batch_init_f32(
+  arm_pid_batch_instance_f32 * S,
+  uint16_t numLoops,
+  const float32_t * pKp,
+  const float32_t * pKi,
+  const float32_t * pKd,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  const float32_t * pLimits,
+  uint8_t antiWindup);
+
+
+  /**
+   * @brief  Process function for a batch of floating-point PID Controls.
+   * @param[in,out] S     points to an instance of the floating-point batched PID structure.
+   * @param[in]     pSrc  points to the input samples, one per loop.
+   * @param[out]    pDst  points to the output samples, one per loop.
+   */
+  void arm_pid_batch_f32(
+  const arm_pid_batch_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst);
+
+
+  /**
+   * @brief  Initialization function for a batch of Q31 PID Controls.
+   * @param[in,out] S           points to an instance of the Q31 batched PID structure.
+   * @param[in]     numLoops    number of loops N.
+   * @param[in]     pKp         points to the proportional gains, N values.
+   * @param[in]     pKi         points to the integral gains, N values.
+   * @param[in]     pKd         points to the derivative gains, N values.
+   * @param[out]    pCoeffs     points to the derived gains, 3*N values.
+   * @param[out]    pState      points to the state, 3*N values.
+   * @param[in]     pLimits     points to the N lower followed by the N upper output limits, or NULL.
+   * @param[in]     antiWindup  1 to hold the integrator at the limits, 0 to let it run on.
+   */
+  void arm_pid_batch_init_q31(
+  arm_pid_batch_instance_q31 * S,
+  uint16_t numLoops,
+  const q31_t * pKp,
+  const q31_t * pKi,
+  const q31_t * pKd,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  const q31_t * pLimits,
+  uint8_t antiWindup);
+
+
+  /**
+   * @brief  Process function for a batch of Q31 PID Controls.
+   * @param[in,out] S     points to an instance of the Q31 batched PID structure.
+   * @param[in]     pSrc  points to the input samples, one per loop.
+   * @param[out]    pDst  points to the output samples, one per loop.
+   */
+  void arm_pid_batch_q31(
+  const arm_pid_batch_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst);
+
+
+  /**
+   * @brief  Initialization function for a batch of Q15 PID Controls.
+   * @param[in,out] S           points to an instance of the Q15 batched PID structure.
+   * @param[in]     numLoops    number of loops N.
+   * @param[in]     pKp         points to the proportional gains, N values.
+   * @param[in]     pKi         points to the integral gains, N values.
+   * @param[in]     pKd         points to the derivative gains, N values.
+   * @param[out]    pCoeffs     points to the derived gains, 3*N values.
+   * @param[out]    pState      points to the state, 3*N values.
+   * @param[in]     pLimits     points to the N lower followed by the N upper output limits, or NULL.
+   * @param[in]     antiWindup  1 to hold the integrator at the limits, 0 to let it run on.
+   */
+  void arm_pid_batch_init_q15(
+  arm_pid_batch_instance_q15 * S,
+  uint16_t numLoops,
+  const q15_t * pKp,
+  const q15_t * pKi,
+  const q15_t * pKd,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  const q15_t * pLimits,
+  uint8_t antiWindup);
+
+
+  /**
+   * @brief  Process function for a batch of Q15 PID Controls.
+   * @param[in,out] S     points to an instance of the Q15 batched PID structure.
+   * @param[in]     pSrc  points to the input samples, one per loop.
+   * @param[out]    pDst  points to the output samples, one per loop.
+   */
+  void arm_pid_batch_q15(
+  const arm_pid_batch_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst);
+
+
+
   /**
    * @brief Instance structure for the floating-point Linear Interpolate function.
    */
@@ -1942,6 +2432,20 @@ extern "C"
   uint32_t blockSize);
 
 
+  /**
+   * @brief Multiplies a single-precision vector by a half-precision vector.
+   * @param[in]  pSrcA      points to the half-precision input vector
+   * @param[in]  pSrcB      points to the single-precision input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_mult_f16_f32(
+  const float16_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the Q15 CFFT/CIFFT function.
    */
@@ -2118,6 +2622,22 @@ void arm_cfft_q15(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag);
 
+  /**
+   * @brief Q15 block floating-point CFFT/CIFFT, scales only where a stage could overflow.
+   * @param[in]      *S             points to an instance of the Q15 CFFT structure.
+   * @param[in, out] *p1            points to the complex data buffer, processed in-place.
+   * @param[in]      ifftFlag       selects forward (0) or inverse (1) transform.
+   * @param[in]      bitReverseFlag enables (1) or disables (0) bit reversal of output.
+   * @param[out]     *pExp          points to the block exponent, the transform is p1 * 2^*pExp.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR for an unsupported length.
+   */
+arm_status arm_cfft_bfp_q15(
+    const arm_cfft_instance_q15 * S,
+    q15_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    int32_t * pExp);
+
   /**
    * @brief Instance structure for the fixed-point CFFT/CIFFT function.
    */
@@ -2135,6 +2655,22 @@ void arm_cfft_q31(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag);
 
+  /**
+   * @brief Q31 block floating-point CFFT/CIFFT, scales only where a stage could overflow.
+   * @param[in]      *S             points to an instance of the Q31 CFFT structure.
+   * @param[in, out] *p1            points to the complex data buffer, processed in-place.
+   * @param[in]      ifftFlag       selects forward (0) or inverse (1) transform.
+   * @param[in]      bitReverseFlag enables (1) or disables (0) bit reversal of output.
+   * @param[out]     *pExp          points to the block exponent, the transform is p1 * 2^*pExp.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR for an unsupported length.
+   */
+arm_status arm_cfft_bfp_q31(
+    const arm_cfft_instance_q31 * S,
+    q31_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    int32_t * pExp);
+
   /**
    * @brief Instance structure for the floating-point CFFT/CIFFT function.
    */
@@ -2177,6 +2713,20 @@ void arm_cfft_q31(
   q15_t * pSrc,
   q15_t * pDst);
 
+  /**
+   * @brief Q15 block floating-point RFFT/RIFFT on the complex FFT of arm_cfft_bfp_q15().
+   * @param[in]  *S    points to an instance of the Q15 RFFT/RIFFT structure.
+   * @param[in]  *pSrc points to the input buffer, which is modified.
+   * @param[out] *pDst points to the output buffer.
+   * @param[out] *pExp points to the block exponent, the transform is pDst * 2^*pExp.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR for an unsupported length.
+   */
+  arm_status arm_rfft_bfp_q15(
+  const arm_rfft_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  int32_t * pExp);
+
   /**
    * @brief Instance structure for the Q31 RFFT/RIFFT function.
    */
@@ -2202,6 +2752,20 @@ void arm_cfft_q31(
   q31_t * pSrc,
   q31_t * pDst);
 
+  /**
+   * @brief Q31 block floating-point RFFT/RIFFT on the complex FFT of arm_cfft_bfp_q31().
+   * @param[in]  *S    points to an instance of the Q31 RFFT/RIFFT structure.
+   * @param[in]  *pSrc points to the input buffer, which is modified.
+   * @param[out] *pDst points to the output buffer.
+   * @param[out] *pExp points to the block exponent, the transform is pDst * 2^*pExp.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR for an unsupported length.
+   */
+  arm_status arm_rfft_bfp_q31(
+  const arm_rfft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  int32_t * pExp);
+
   /**
    * @brief Instance structure for the floating-point RFFT/RIFFT function.
    */
@@ -2248,6 +2812,82 @@ void arm_rfft_fast_f32(
   float32_t * p, float32_t * pOut,
   uint8_t ifftFlag);
 
+#define ARM_CFFT_MIXED_MAX_STAGES 32u
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+    uint32_t fftLen;                                 /**< length of the FFT. */
+    uint8_t numStages;                               /**< number of radix stages. */
+    uint8_t radix[ARM_CFFT_MIXED_MAX_STAGES];        /**< radix (2, 3, 4, 5 or 8) of each stage. */
+    float32_t *pTwiddle;                             /**< points to the twiddle factor table, 2*fftLen values. */
+    float32_t *pScratch;                             /**< points to the scratch buffer, 2*fftLen values. */
+  } arm_cfft_mixed_instance_f32;
+
+  arm_status arm_cfft_mixed_init_f32(
+  arm_cfft_mixed_instance_f32 * S,
+  uint32_t fftLen,
+  float32_t * pTwiddle,
+  float32_t * pScratch);
+
+  void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  float32_t * p1,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+    arm_cfft_mixed_instance_f32 Sint;      /**< Internal CFFT structure. */
+    uint32_t fftLenRFFT;                   /**< length of the real sequence */
+    float32_t * pTwiddleRFFT;              /**< Twiddle factors real stage  */
+  } arm_rfft_mixed_instance_f32;
+
+  arm_status arm_rfft_mixed_init_f32(
+  arm_rfft_mixed_instance_f32 * S,
+  uint32_t fftLen,
+  float32_t * pTwiddle,
+  float32_t * pScratch);
+
+  void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point four-step large CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+    uint32_t fftLen;                       /**< length of the FFT, N1*N2. */
+    uint32_t N1;                           /**< number of rows, length of the column FFTs. */
+    uint32_t N2;                           /**< number of columns, length of the row FFTs. */
+    uint32_t blockSize;                    /**< number of columns or rows moved per pass. */
+    arm_cfft_mixed_instance_f32 colFFT;    /**< column FFT of length N1. */
+    arm_cfft_mixed_instance_f32 rowFFT;    /**< row FFT of length N2. */
+    float32_t *pTwiddle;                   /**< points to W_N^i, i < N2. */
+    float32_t *pWork;                      /**< points to the work buffer of the sub-FFTs. */
+  } arm_cfft_large_instance_f32;
+
+  arm_status arm_cfft_large_init_f32(
+  arm_cfft_large_instance_f32 * S,
+  uint32_t N1,
+  uint32_t N2,
+  float32_t * pTwiddle,
+  float32_t * pWork,
+  uint32_t workLen);
+
+  void arm_cfft_large_f32(
+  const arm_cfft_large_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint8_t ifftFlag);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -2387,21 +3027,217 @@ void arm_rfft_fast_f32(
 
 
   /**
-   * @brief Floating-point vector addition.
-   * @param[in]  pSrcA      points to the first input vector
-   * @param[in]  pSrcB      points to the second input vector
-   * @param[out] pDst       points to the output vector
-   * @param[in]  blockSize  number of samples in each vector
+   * @brief Instance structure for the floating-point Goertzel bank.
    */
-  void arm_add_f32(
-  float32_t * pSrcA,
-  float32_t * pSrcB,
-  float32_t * pDst,
-  uint32_t blockSize);
-
+  typedef struct
+  {
+    uint16_t numBins;             /**< number of bins. */
+    uint32_t blockLen;            /**< number of samples per block, the DFT length N. */
+    uint32_t count;               /**< number of samples of the current block processed. */
+    float32_t *pCoeffs;           /**< points to the coefficients, 7*numBins values. */
+    float32_t *pState;            /**< points to the state, 2*numBins values. */
+  } arm_goertzel_instance_f32;
 
   /**
-   * @brief Q7 vector addition.
+   * @brief Instance structure for the Q31 Goertzel bank.
+   */
+  typedef struct
+  {
+    uint16_t numBins;             /**< number of bins. */
+    uint8_t outShift;             /**< output scaling, ceil(log2(blockLen)). */
+    uint32_t blockLen;            /**< number of samples per block, the DFT length N. */
+    uint32_t count;               /**< number of samples of the current block processed. */
+    q31_t *pCoeffs;               /**< points to the coefficients, 6*numBins values. */
+    q63_t *pState;                /**< points to the 64-bit state, 2*numBins values. */
+  } arm_goertzel_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+  typedef struct
+  {
+    uint16_t numBins;             /**< number of bins. */
+    uint32_t blockLen;            /**< window length, the DFT length N. */
+    uint32_t pos;                 /**< position of the oldest sample in the delay line. */
+    float32_t rN;                 /**< damping over the window, r^N. */
+    float32_t *pCoeffs;           /**< points to the coefficients, 2*numBins values. */
+    float32_t *pState;            /**< points to the bins, 2*numBins values. */
+    float32_t *pDelay;            /**< points to the delay line, blockLen values. */
+  } arm_sdft_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point Goertzel bank.
+   * @param[in,out] S         points to an instance of the floating-point Goertzel structure.
+   * @param[in]     numBins   number of bins.
+   * @param[in]     blockLen  number of samples per block, the DFT length N.
+   * @param[in]     pBins     points to the bin numbers, not necessarily integers.
+   * @param[out]    pCoeffs   points to the coefficient buffer of 7*numBins values.
+   * @param[in]     pState    points to the state buffer of 2*numBins values.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  uint32_t blockLen,
+  const float32_t * pBins,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+  /**
+   * @brief Processing function for the floating-point Goertzel bank.
+   * @param[in,out] S          points to an instance of the floating-point Goertzel structure.
+   * @param[in]     pSrc       points to the input samples.
+   * @param[out]    pDst       points to the output buffer, 2*numBins values per completed block.
+   * @param[in]     blockSize  number of input samples.
+   * @return        number of blocks completed by this call.
+   */
+  uint32_t arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 Goertzel bank.
+   * @param[in,out] S         points to an instance of the Q31 Goertzel structure.
+   * @param[in]     numBins   number of bins.
+   * @param[in]     blockLen  number of samples per block, the DFT length N, at most 32768.
+   * @param[in]     pBins     points to the bin numbers, not necessarily integers.
+   * @param[out]    pCoeffs   points to the coefficient buffer of 6*numBins values.
+   * @param[in]     pState    points to the 64-bit state buffer of 2*numBins values.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  uint32_t blockLen,
+  const float32_t * pBins,
+  q31_t * pCoeffs,
+  q63_t * pState);
+
+  /**
+   * @brief Processing function for the Q31 Goertzel bank.
+   * @param[in,out] S          points to an instance of the Q31 Goertzel structure.
+   * @param[in]     pSrc       points to the input samples.
+   * @param[out]    pDst       points to the output buffer, 2*numBins values per completed block.
+   * @param[in]     blockSize  number of input samples.
+   * @return        number of blocks completed by this call.
+   */
+  uint32_t arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point sliding DFT.
+   * @param[in,out] S         points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     numBins   number of bins.
+   * @param[in]     blockLen  window length, the DFT length N.
+   * @param[in]     pBins     points to the integer bin numbers.
+   * @param[in]     r         damping factor, 0 < r <= 1.
+   * @param[out]    pCoeffs   points to the coefficient buffer of 2*numBins values.
+   * @param[in]     pState    points to the state buffer of 2*numBins values.
+   * @param[in]     pDelay    points to the delay line of blockLen values.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t numBins,
+  uint32_t blockLen,
+  const uint16_t * pBins,
+  float32_t r,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pDelay);
+
+  /**
+   * @brief Processing function for the floating-point sliding DFT.
+   * @param[in,out] S          points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     pSrc       points to the input samples.
+   * @param[out]    pDst       points to the output buffer of 2*numBins values, or NULL.
+   * @param[in]     blockSize  number of input samples.
+   */
+  void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point STFT and Welch power spectrum.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                   /**< frame length N. */
+    uint16_t hopLen;                   /**< samples from the start of one frame to the start of the next. */
+    uint16_t numAvg;                   /**< frames averaged into one output row. */
+    uint16_t avgCount;                 /**< frames of the current row accumulated so far. */
+    uint32_t pos;                      /**< position of the oldest sample in the ring. */
+    uint32_t need;                     /**< input samples still needed for the next frame. */
+    float32_t scale;                   /**< output scale divided by numAvg. */
+    const float32_t *pWindow;          /**< points to the window table, fftLen values. */
+    float32_t *pRing;                  /**< points to the input ring, fftLen values. */
+    float32_t *pFrame;                 /**< points to the work buffer, 2*fftLen values. */
+    float32_t *pAcc;                   /**< points to the accumulator, fftLen/2+1 values. */
+    arm_rfft_fast_instance_f32 rfft;   /**< real FFT of the frames. */
+  } arm_stft_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point STFT and Welch power spectrum.
+   * @param[in,out] S         points to an instance of the floating-point STFT structure.
+   * @param[in]     fftLen    frame length N, a length supported by arm_rfft_fast_f32().
+   * @param[in]     hopLen    samples from the start of one frame to the start of the next.
+   * @param[in]     numAvg    frames averaged into one output row, 1 for a spectrogram.
+   * @param[in]     scale     scale of the output rows.
+   * @param[in]     pWindow   points to the window table of fftLen values.
+   * @param[in]     pRing     points to the input ring of fftLen values.
+   * @param[in]     pFrame    points to the work buffer of 2*fftLen values.
+   * @param[in]     pAcc      points to the accumulator of fftLen/2+1 values, may be NULL if numAvg is 1.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_stft_init_f32(
+  arm_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopLen,
+  uint16_t numAvg,
+  float32_t scale,
+  const float32_t * pWindow,
+  float32_t * pRing,
+  float32_t * pFrame,
+  float32_t * pAcc);
+
+  /**
+   * @brief Processing function for the floating-point STFT and Welch power spectrum.
+   * @param[in,out] S          points to an instance of the floating-point STFT structure.
+   * @param[in]     pSrc       points to the input samples.
+   * @param[out]    pDst       points to the output rows, fftLen/2+1 values each.
+   * @param[in]     blockSize  number of input samples.
+   * @return        number of rows written by this call.
+   */
+  uint32_t arm_stft_f32(
+  arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Floating-point vector addition.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_add_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Q7 vector addition.
    * @param[in]  pSrcA      points to the first input vector
    * @param[in]  pSrcB      points to the second input vector
    * @param[out] pDst       points to the output vector
@@ -2622,6 +3458,34 @@ void arm_rfft_fast_f32(
   float32_t * result);
 
 
+  /**
+   * @brief Dot product of half-precision vectors, accumulated in single precision.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @param[out] result     output result returned here
+   */
+  void arm_dot_prod_f16(
+  const float16_t * pSrcA,
+  const float16_t * pSrcB,
+  uint32_t blockSize,
+  float32_t * result);
+
+
+  /**
+   * @brief Dot product of a half-precision and a single-precision vector.
+   * @param[in]  pSrcA      points to the half-precision input vector
+   * @param[in]  pSrcB      points to the single-precision input vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @param[out] result     output result returned here
+   */
+  void arm_dot_prod_f16_f32(
+  const float16_t * pSrcA,
+  const float32_t * pSrcB,
+  uint32_t blockSize,
+  float32_t * result);
+
+
   /**
    * @brief Dot product of Q7 vectors.
    * @param[in]  pSrcA      points to the first input vector
@@ -3433,7 +4297,7 @@ void arm_rfft_fast_f32(
   {
     uint8_t L;                      /**< upsample factor. */
     uint16_t phaseLength;           /**< length of each polyphase filter component. */
-    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
     q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
   } arm_fir_interpolate_instance_q15;
 
@@ -3444,7 +4308,7 @@ void arm_rfft_fast_f32(
   {
     uint8_t L;                      /**< upsample factor. */
     uint16_t phaseLength;           /**< length of each polyphase filter component. */
-    q31_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
     q31_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
   } arm_fir_interpolate_instance_q31;
 
@@ -3562,6 +4426,476 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the Q15 FIR rational resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                    /**< upsample factor. */
+    uint16_t M;                    /**< downsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    uint32_t pos;                  /**< position of the next output at the upsampled rate, relative to the next input block. */
+    q15_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                 /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+  } arm_fir_resample_instance_q15;
+
+
+  /**
+   * @brief Instance structure for the Q31 FIR rational resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                    /**< upsample factor. */
+    uint16_t M;                    /**< downsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    uint32_t pos;                  /**< position of the next output at the upsampled rate, relative to the next input block. */
+    q31_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                 /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+  } arm_fir_resample_instance_q31;
+
+
+  /**
+   * @brief Instance structure for the floating-point FIR rational resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                    /**< upsample factor. */
+    uint16_t M;                    /**< downsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    uint32_t pos;                  /**< position of the next output at the upsampled rate, relative to the next input block. */
+    float32_t *pCoeffs;            /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;             /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+  } arm_fir_resample_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q15 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q15 FIR resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process, at most the blockSize given to the init function.
+   * @return number of output samples written to pDst.
+   */
+  uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q15 FIR resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  largest number of input samples processed per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful,
+   * ARM_MATH_ARGUMENT_ERROR if L or M is zero or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_q15(
+  arm_fir_resample_instance_q15 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q31 FIR resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process, at most the blockSize given to the init function.
+   * @return number of output samples written to pDst.
+   */
+  uint32_t arm_fir_resample_q31(
+  arm_fir_resample_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q31 FIR resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  largest number of input samples processed per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful,
+   * ARM_MATH_ARGUMENT_ERROR if L or M is zero or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_q31(
+  arm_fir_resample_instance_q31 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point FIR rational resampler.
+   * @param[in,out] S          points to an instance of the floating-point FIR resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process, at most the blockSize given to the init function.
+   * @return number of output samples written to pDst.
+   */
+  uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point FIR rational resampler.
+   * @param[in,out] S          points to an instance of the floating-point FIR resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  largest number of input samples processed per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful,
+   * ARM_MATH_ARGUMENT_ERROR if L or M is zero or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_f32(
+  arm_fir_resample_instance_f32 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q31 CIC decimator.
+   */
+  typedef struct
+  {
+    uint16_t M;                    /**< decimation factor. */
+    uint8_t numStages;             /**< number of integrator and comb stages. */
+    uint8_t diffDelay;             /**< differential delay of the combs. */
+    uint8_t postShift;             /**< right shift of the comb output, ceil(log2((M*diffDelay)^numStages)). */
+    uint16_t phase;                /**< number of inputs integrated since the last output. */
+    q63_t *pState;                 /**< points to the state variable array. The array is of length numStages*(diffDelay+1). */
+  } arm_cic_decimate_instance_q31;
+
+
+  /**
+   * @brief Processing function for the Q31 CIC decimator.
+   * @param[in,out] S          points to an instance of the Q31 CIC decimator structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return number of output samples written to pDst.
+   */
+  uint32_t arm_cic_decimate_q31(
+  arm_cic_decimate_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 CIC decimator with 32-bit registers.
+   * @param[in,out] S          points to an instance of the Q31 CIC decimator structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return number of output samples written to pDst.
+   */
+  uint32_t arm_cic_decimate_fast_q31(
+  arm_cic_decimate_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 CIC decimator.
+   * @param[in,out] S          points to an instance of the Q31 CIC decimator structure.
+   * @param[in]     numStages  number of integrator and comb stages.
+   * @param[in]     M          decimation factor.
+   * @param[in]     diffDelay  differential delay of the combs, normally 1 or 2.
+   * @param[in]     pState     points to the state buffer of numStages*(diffDelay+1) values.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or
+   * ARM_MATH_ARGUMENT_ERROR if a parameter is zero or the gain does not fit into 31 bits.
+   */
+  arm_status arm_cic_decimate_init_q31(
+  arm_cic_decimate_instance_q31 * S,
+  uint8_t numStages,
+  uint16_t M,
+  uint8_t diffDelay,
+  q63_t * pState);
+
+
+  /**
+   * @brief Instance structure for the Q31 half-band FIR decimator.
+   */
+  typedef struct
+  {
+    uint16_t numCoeffs;            /**< number of non-zero coefficients on one side of the centre tap. */
+    q31_t *pCoeffs;                /**< points to the coefficient array. The array is of length numCoeffs. */
+    q31_t *pState;                 /**< points to the state variable array. The array is of length 4*numCoeffs-2+blockSize. */
+  } arm_fir_halfband_decimate_instance_q31;
+
+
+  /**
+   * @brief Processing function for the Q31 half-band FIR decimator.
+   * @param[in]  S          points to an instance of the Q31 half-band decimator structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data, may be pSrc.
+   * @param[in]  blockSize  number of input samples to process, a multiple of 2.
+   * @return none.
+   */
+  void arm_fir_halfband_decimate_q31(
+  const arm_fir_halfband_decimate_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 half-band FIR decimator.
+   * @param[in,out] S          points to an instance of the Q31 half-band decimator structure.
+   * @param[in]     numCoeffs  number of non-zero coefficients on one side of the centre tap.
+   * @param[in]     pCoeffs    points to the filter coefficients, nearest to the centre tap first.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  largest number of input samples processed per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful,
+   * ARM_MATH_ARGUMENT_ERROR if <code>numCoeffs</code> is zero or ARM_MATH_LENGTH_ERROR if
+   * <code>blockSize</code> is not a multiple of 2.
+   */
+  arm_status arm_fir_halfband_decimate_init_q31(
+  arm_fir_halfband_decimate_instance_q31 * S,
+  uint16_t numCoeffs,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Kaiser window design of a half-band lowpass filter.
+   * @param[in]  numCoeffs    number of non-zero coefficients on one side of the centre tap.
+   * @param[in]  attenuation  stopband attenuation in dB.
+   * @param[out] pCoeffs      points to the numCoeffs coefficients, nearest to the centre tap first.
+   * @return     The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if <code>numCoeffs</code> is zero.
+   */
+  arm_status arm_fir_halfband_design_f32(
+  uint16_t numCoeffs,
+  float32_t attenuation,
+  float32_t * pCoeffs);
+
+
+  /**
+   * @brief  Kaiser window design of a lowpass filter that compensates the droop of a CIC decimator.
+   * @param[in]  numStages    number of stages of the CIC decimator.
+   * @param[in]  M            decimation factor of the CIC decimator.
+   * @param[in]  diffDelay    differential delay of the CIC decimator.
+   * @param[in]  ratio        ratio of the CIC output rate to the input rate of the filter.
+   * @param[in]  cutoff       cutoff frequency as a fraction of the input rate of the filter, between 0 and 0.5.
+   * @param[in]  attenuation  stopband attenuation in dB.
+   * @param[in]  numTaps      number of filter coefficients.
+   * @param[out] pCoeffs      points to the numTaps filter coefficients.
+   * @return     The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if a parameter is out of range.
+   */
+  arm_status arm_cic_comp_design_f32(
+  uint8_t numStages,
+  uint16_t M,
+  uint8_t diffDelay,
+  uint16_t ratio,
+  float32_t cutoff,
+  float32_t attenuation,
+  uint16_t numTaps,
+  float32_t * pCoeffs);
+
+/**
+ * @brief Maximum number of half-band stages of a decimation chain.
+ */
+#define ARM_DECIMATE_CHAIN_MAX_HALFBANDS   4u
+
+  /**
+   * @brief Stages and buffer sizes of a Q31 decimation chain.
+   */
+  typedef struct
+  {
+    uint16_t cicM;                 /**< decimation factor of the CIC decimator. */
+    uint8_t cicStages;             /**< number of stages of the CIC decimator. */
+    uint8_t numHalfbands;          /**< number of half-band decimators. */
+    uint16_t halfbandCoeffs[ARM_DECIMATE_CHAIN_MAX_HALFBANDS]; /**< numCoeffs of every half-band decimator. */
+    uint8_t firM;                  /**< decimation factor of the final FIR decimator. */
+    uint16_t firTaps;              /**< number of taps of the final FIR decimator. */
+    float32_t passband;            /**< passband edge as a fraction of the output rate. */
+    float32_t attenuation;         /**< attenuation in dB of the signals that alias into the passband. */
+    float32_t cost;                /**< estimated number of operations per input sample. */
+    uint32_t blockSize;            /**< largest number of input samples processed per call. */
+    uint32_t numCoeffs;            /**< length of the coefficient array. */
+    uint32_t stateLength;          /**< length of the state array, not counting the CIC state. */
+  } arm_decimate_chain_plan_q31;
+
+
+  /**
+   * @brief Instance structure for the Q31 decimation chain.
+   */
+  typedef struct
+  {
+    arm_cic_decimate_instance_q31 cic;     /**< CIC decimator. */
+    arm_fir_halfband_decimate_instance_q31 hb[ARM_DECIMATE_CHAIN_MAX_HALFBANDS]; /**< half-band decimators. */
+    arm_fir_decimate_instance_q31 fir;     /**< final FIR decimator. */
+    uint8_t numHalfbands;                  /**< number of half-band decimators in use. */
+    q31_t *pScratch;                       /**< points to the buffer for the CIC output, of length blockSize/cicM. */
+  } arm_decimate_chain_instance_q31;
+
+
+  /**
+   * @brief  Chooses the stages of a Q31 decimation chain.
+   * @param[out] P            points to the plan to fill in.
+   * @param[in]  M            total decimation factor.
+   * @param[in]  cicStages    number of stages of the CIC decimator.
+   * @param[in]  passband     passband edge as a fraction of the output rate, between 0 and 0.5.
+   * @param[in]  attenuation  attenuation in dB of the signals that alias into the passband.
+   * @param[in]  blockSize    largest number of input samples processed per call, a multiple of M.
+   * @return     The function returns ARM_MATH_SUCCESS, ARM_MATH_LENGTH_ERROR if <code>blockSize</code> is not a
+   * multiple of <code>M</code> or ARM_MATH_ARGUMENT_ERROR if a parameter is out of range or no chain meets the
+   * specification.
+   */
+  arm_status arm_decimate_chain_design_q31(
+  arm_decimate_chain_plan_q31 * P,
+  uint32_t M,
+  uint8_t cicStages,
+  float32_t passband,
+  float32_t attenuation,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 decimation chain.
+   * @param[in,out] S          points to an instance of the Q31 decimation chain structure.
+   * @param[in]     P          points to a plan filled in by arm_decimate_chain_design_q31().
+   * @param[out]    pCoeffs    points to the coefficient buffer of P->numCoeffs values.
+   * @param[in]     pCicState  points to the CIC state buffer of 2*P->cicStages values.
+   * @param[in]     pState     points to the state buffer of P->stateLength values.
+   * @return        The function returns ARM_MATH_SUCCESS or the error status of the stage that failed to initialize.
+   */
+  arm_status arm_decimate_chain_init_q31(
+  arm_decimate_chain_instance_q31 * S,
+  const arm_decimate_chain_plan_q31 * P,
+  q31_t * pCoeffs,
+  q63_t * pCicState,
+  q31_t * pState);
+
+
+  /**
+   * @brief Processing function for the Q31 decimation chain.
+   * @param[in,out] S          points to an instance of the Q31 decimation chain structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process, a multiple of M.
+   * @return none.
+   */
+  void arm_decimate_chain_q31(
+  arm_decimate_chain_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+/**
+ * @brief Filters shorter than this run in direct form in arm_fir_fft_f32().
+ */
+#ifndef ARM_FIR_FFT_DIRECT_TAPS
+#define ARM_FIR_FFT_DIRECT_TAPS   128u
+#endif
+
+/**
+ * @brief Maximum number of partition sizes of arm_fir_fft_f32().
+ */
+#define ARM_FIR_FFT_MAX_LEVELS    4u
+
+  /**
+   * @brief Partitions of one size of the floating-point partitioned FFT FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t partSize;                 /**< partition length P, the FFT length is 2*P. */
+    uint16_t numParts;                 /**< number of partitions. */
+    uint16_t ageOfs;                   /**< age in blocks of the input spectrum used by the first partition. */
+    uint16_t fdlLen;                   /**< number of input spectra in the delay line, ageOfs + numParts. */
+    uint16_t fdlPos;                   /**< index of the newest input spectrum. */
+    arm_rfft_fast_instance_f32 rfft;   /**< real FFT of length 2*P. */
+    float32_t *pCoeffs;                /**< points to the partition spectra, numParts*2*P words. */
+    float32_t *pFdl;                   /**< points to the delay line of input spectra, fdlLen*2*P words. */
+    float32_t *pOut;                   /**< points to the P outputs computed in advance, NULL for the first level. */
+  } arm_fir_fft_level_f32;
+
+  /**
+   * @brief Instance structure for the floating-point partitioned FFT FIR filter.
+   */
+  typedef struct
+  {
+    uint32_t numTaps;                  /**< number of filter coefficients in the filter. */
+    uint16_t blockSize;                /**< number of samples processed at a time. */
+    uint16_t numLevels;                /**< number of partition sizes, 0 in direct form. */
+    uint32_t count;                    /**< samples processed modulo the largest partition size. */
+    uint32_t stateLen;                 /**< length of the state buffer in words. */
+    uint32_t histLen;                  /**< length of the input history in words. */
+    uint32_t histPos;                  /**< index just past the newest input sample in the history. */
+    float32_t *pHist;                  /**< points to the input history. */
+    float32_t *pWork;                  /**< points to the FFT work buffer. */
+    float32_t *pAcc;                   /**< points to the spectrum accumulator. */
+    arm_fir_fft_level_f32 level[ARM_FIR_FFT_MAX_LEVELS];   /**< partition levels. */
+    arm_fir_instance_f32 direct;       /**< direct form filter for short filters. */
+  } arm_fir_fft_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point partitioned FFT FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point FIR FFT filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process, a multiple of the blockSize given to the initialization function.
+   */
+  void arm_fir_fft_f32(
+  arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point partitioned FFT FIR filter.
+   * @param[in,out] S            points to an instance of the floating-point FIR FFT filter structure.
+   * @param[in]     numTaps      number of filter coefficients in the filter.
+   * @param[in]     pCoeffs      points to the filter coefficient buffer.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     stateLen     length of the state buffer in words.
+   * @param[in]     blockSize    number of samples processed at a time, a power of 2 from 16 to 2048.
+   * @param[in]     maxPartSize  length of the longest partitions, a power of 2 from blockSize to 2048.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful,
+   * ARM_MATH_ARGUMENT_ERROR if a size is not supported or ARM_MATH_LENGTH_ERROR if the state
+   * buffer is too small; the length needed is in <code>S->stateLen</code>.
+   */
+  arm_status arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint32_t numTaps,
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t stateLen,
+  uint16_t blockSize,
+  uint16_t maxPartSize);
+
+
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
    */
@@ -3704,8 +5038,117 @@ void arm_rfft_fast_f32(
 
 
   /**
-   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in,out] S          points to an instance of the filter data structure.
+   * @brief Instance structure for the floating-point multichannel transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t   numStages;     /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t  numChannels;   /**< number of channels. */
+    float32_t *pState;       /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    float32_t *pCoeffs;      /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_mc_df2T_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point multichannel interleaved transposed direct form II Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_biquad_cascade_mc_df2T_f32(
+  const arm_biquad_cascade_mc_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point multichannel planar transposed direct form II Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of planar input data.
+   * @param[out] pDst       points to the block of planar output data
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_biquad_cascade_mc_planar_df2T_f32(
+  const arm_biquad_cascade_mc_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point multichannel transposed direct form II Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   */
+  void arm_biquad_cascade_mc_df2T_init_f32(
+  arm_biquad_cascade_mc_df2T_instance_f32 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+
+  /**
+   * @brief Instance structure for the Q31 multichannel Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t  numStages;      /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;    /**< number of channels. */
+    q31_t *pState;           /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    q31_t *pCoeffs;          /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< Additional shift, in bits, applied to each output sample. */
+  } arm_biquad_casd_mc_df1_inst_q31;
+
+  /**
+   * @brief Processing function for the Q31 multichannel interleaved Biquad cascade filter.
+   * @param[in]  S          points to an instance of the Q31 multichannel Biquad cascade structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_biquad_cascade_mc_df1_q31(
+  const arm_biquad_casd_mc_df1_inst_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 multichannel planar Biquad cascade filter.
+   * @param[in]  S          points to an instance of the Q31 multichannel Biquad cascade structure.
+   * @param[in]  pSrc       points to the block of planar input data.
+   * @param[out] pDst       points to the block of planar output data.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_biquad_cascade_mc_planar_df1_q31(
+  const arm_biquad_casd_mc_df1_inst_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 multichannel Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the Q31 multichannel Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   */
+  void arm_biquad_cascade_mc_df1_init_q31(
+  arm_biquad_casd_mc_df1_inst_q31 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  int8_t postShift);
+
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] S          points to an instance of the filter data structure.
    * @param[in]     numStages  number of 2nd order stages in the filter.
    * @param[in]     pCoeffs    points to the filter coefficients.
    * @param[in]     pState     points to the state buffer.
@@ -4161,6 +5604,85 @@ void arm_rfft_fast_f32(
   float32_t mu,
   uint32_t blockSize);
 
+/**
+ * @brief Smoothing factor of the bin powers of arm_lms_fd_f32(), per block.
+ */
+#ifndef ARM_LMS_FD_POW_BETA
+#define ARM_LMS_FD_POW_BETA       0.9f
+#endif
+
+/**
+ * @brief Regularization of the bin powers of arm_lms_fd_f32(), relative to the mean bin power.
+ */
+#ifndef ARM_LMS_FD_REG
+#define ARM_LMS_FD_REG            0.01f
+#endif
+
+  /**
+   * @brief Instance structure for the floating-point partitioned frequency-domain block LMS filter.
+   */
+  typedef struct
+  {
+    uint32_t numTaps;                  /**< number of filter coefficients in the filter. */
+    uint16_t blockSize;                /**< number of samples processed at a time and partition length P. */
+    uint16_t numParts;                 /**< number of partitions K. */
+    uint16_t numConstrain;             /**< number of partitions whose gradient is constrained per block. */
+    uint16_t fdlPos;                   /**< index of the newest input spectrum. */
+    uint16_t conPos;                   /**< first partition to constrain in the next block. */
+    uint32_t stateLen;                 /**< length of the state buffer in words. */
+    float32_t mu;                      /**< step size that controls filter coefficient updates. */
+    float32_t powMean;                 /**< mean bin power of the last block, 0 before the first block. */
+    float32_t *pHist;                  /**< points to the last 2*P input samples. */
+    float32_t *pWork;                  /**< points to the normalized error spectrum, 2*P words. */
+    float32_t *pAcc;                   /**< points to the spectrum accumulator, 2*P words. */
+    float32_t *pTmp;                   /**< points to the FFT work buffer, 2*P words. */
+    float32_t *pCoeffs;                /**< points to the partition spectra, K*2*P words. */
+    float32_t *pFdl;                   /**< points to the delay line of input spectra, K*2*P words. */
+    float32_t *pPow;                   /**< points to the smoothed bin powers, P+1 words. */
+    arm_rfft_fast_instance_f32 rfft;   /**< real FFT of length 2*P. */
+  } arm_lms_fd_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point partitioned frequency-domain block LMS filter.
+   * @param[in,out] S          points to an instance of the floating-point frequency-domain LMS filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     pRef       points to the block of reference data.
+   * @param[out]    pOut       points to the block of output data.
+   * @param[out]    pErr       points to the block of error data.
+   * @param[in]     blockSize  number of samples to process, a multiple of the blockSize given to the initialization function.
+   */
+  void arm_lms_fd_f32(
+  arm_lms_fd_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point partitioned frequency-domain block LMS filter.
+   * @param[in,out] S             points to an instance of the floating-point frequency-domain LMS filter structure.
+   * @param[in]     numTaps       number of filter coefficients in the filter.
+   * @param[in]     pCoeffs       points to the initial filter coefficients, NULL to start from zero.
+   * @param[in]     pState        points to the state buffer.
+   * @param[in]     stateLen      length of the state buffer in words.
+   * @param[in]     blockSize     number of samples processed at a time, a power of 2 from 16 to 2048.
+   * @param[in]     mu            step size that controls filter coefficient updates.
+   * @param[in]     numConstrain  number of partitions whose gradient is constrained per block.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful,
+   * ARM_MATH_ARGUMENT_ERROR if a size is not supported or ARM_MATH_LENGTH_ERROR if the state
+   * buffer is too small; the length needed is in <code>S->stateLen</code>.
+   */
+  arm_status arm_lms_fd_init_f32(
+  arm_lms_fd_instance_f32 * S,
+  uint32_t numTaps,
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t stateLen,
+  uint16_t blockSize,
+  float32_t mu,
+  uint16_t numConstrain);
+
 
   /**
    * @brief Instance structure for the Q31 normalized LMS filter.
@@ -4737,6 +6259,13 @@ void arm_rfft_fast_f32(
    * <code>S</code> points to an instance of the PID control data structure.  <code>in</code>
    * is the input sample value. The functions return the output value.
    *
+   * \par Batched Functions
+   * <code>arm_pid_batch_f32()</code>, <code>arm_pid_batch_q31()</code> and <code>arm_pid_batch_q15()</code> update
+   * N independent loops per call, one input and one output sample per loop.  Gains and state of all loops are
+   * held as arrays (structure of arrays), so the call overhead is paid once per control tick and the loops are
+   * interleaved in the pipeline.  Each loop may have output limits, with or without anti-windup of the integrator.
+   * Without limits the outputs equal those of the single loop functions.
+   *
    * \par Algorithm:
    * <pre>
    *    y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]
@@ -4901,7 +6430,7 @@ void arm_rfft_fast_f32(
 #endif
 
     /* acc += y[n-1] */
-    acc += (q31_t) S->state[2] << 15;
+    acc += (q31_t) S->state[2] * 32768;
 
     /* saturate the output */
     out = (q15_t) (__SSAT((acc >> 15), 16));
@@ -4944,190 +6473,761 @@ void arm_rfft_fast_f32(
   arm_matrix_instance_f64 * dst);
 
 
-
   /**
-   * @ingroup groupController
+   * @brief  Double-precision floating-point matrix initialization.
+   * @param[in,out] S         points to an instance of the double-precision floating-point matrix structure.
+   * @param[in]     nRows     number of rows in the matrix.
+   * @param[in]     nColumns  number of columns in the matrix.
+   * @param[in]     pData     points to the matrix data array.
    */
+  void arm_mat_init_f64(
+  arm_matrix_instance_f64 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  float64_t * pData);
+
 
   /**
-   * @defgroup clarke Vector Clarke Transform
-   * Forward Clarke transform converts the instantaneous stator phases into a two-coordinate time invariant vector.
-   * Generally the Clarke transform uses three-phase currents <code>Ia, Ib and Ic</code> to calculate currents
-   * in the two-phase orthogonal stator axis <code>Ialpha</code> and <code>Ibeta</code>.
-   * When <code>Ialpha</code> is superposed with <code>Ia</code> as shown in the figure below
-   * \image html clarke.gif Stator current space vector and its components in (a,b).
-   * and <code>Ia + Ib + Ic = 0</code>, in this condition <code>Ialpha</code> and <code>Ibeta</code>
-   * can be calculated using only <code>Ia</code> and <code>Ib</code>.
-   *
-   * The function operates on a single sample of data and each call to the function returns the processed output.
-   * The library provides separate functions for Q31 and floating-point data types.
-   * \par Algorithm
-   * \image html clarkeFormula.gif
-   * where <code>Ia</code> and <code>Ib</code> are the instantaneous stator phases and
-   * <code>pIalpha</code> and <code>pIbeta</code> are the two coordinates of time invariant vector.
-   * \par Fixed-Point Behavior
-   * Care must be taken when using the Q31 version of the Clarke transform.
-   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
-   * Refer to the function specific documentation below for usage guidelines.
+   * @brief  Half-precision floating-point matrix initialization.
+   * @param[in,out] S         points to an instance of the half-precision floating-point matrix structure.
+   * @param[in]     nRows     number of rows in the matrix.
+   * @param[in]     nColumns  number of columns in the matrix.
+   * @param[in]     pData     points to the matrix data array.
    */
+  void arm_mat_init_f16(
+  arm_matrix_instance_f16 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  float16_t * pData);
+
 
   /**
-   * @addtogroup clarke
-   * @{
+   * @brief Half-precision matrix times single-precision vector.
+   * @param[in]  pSrcMat  points to the matrix.
+   * @param[in]  pVec     points to the numCols input values.
+   * @param[out] pDst     points to the numRows output values.
    */
+  void arm_mat_vec_mult_f16_f32(
+  const arm_matrix_instance_f16 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst);
+
 
   /**
-   *
-   * @brief  Floating-point Clarke transform
-   * @param[in]  Ia       input three-phase coordinate <code>a</code>
-   * @param[in]  Ib       input three-phase coordinate <code>b</code>
-   * @param[out] pIalpha  points to output two-phase orthogonal vector axis alpha
-   * @param[out] pIbeta   points to output two-phase orthogonal vector axis beta
+   * @brief Floating-point matrix times vector.
+   * @param[in]  pSrcMat  points to the matrix.
+   * @param[in]  pVec     points to the numCols input values.
+   * @param[out] pDst     points to the numRows output values.
    */
-  static __INLINE void arm_clarke_f32(
-  float32_t Ia,
-  float32_t Ib,
-  float32_t * pIalpha,
-  float32_t * pIbeta)
-  {
-    /* Calculate pIalpha using the equation, pIalpha = Ia */
-    *pIalpha = Ia;
-
-    /* Calculate pIbeta using the equation, pIbeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
-    *pIbeta = ((float32_t) 0.57735026919 * Ia + (float32_t) 1.15470053838 * Ib);
-  }
+  void arm_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst);
 
 
   /**
-   * @brief  Clarke transform for Q31 version
-   * @param[in]  Ia       input three-phase coordinate <code>a</code>
-   * @param[in]  Ib       input three-phase coordinate <code>b</code>
-   * @param[out] pIalpha  points to output two-phase orthogonal vector axis alpha
-   * @param[out] pIbeta   points to output two-phase orthogonal vector axis beta
-   *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using an internal 32-bit accumulator.
-   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
-   * There is saturation on the addition, hence there is no risk of overflow.
+   * @brief Q31 matrix times vector.
+   * @param[in]  pSrcMat  points to the matrix.
+   * @param[in]  pVec     points to the numCols input values.
+   * @param[out] pDst     points to the numRows output values.
    */
-  static __INLINE void arm_clarke_q31(
-  q31_t Ia,
-  q31_t Ib,
-  q31_t * pIalpha,
-  q31_t * pIbeta)
-  {
-    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
-
-    /* Calculating pIalpha from Ia by equation pIalpha = Ia */
-    *pIalpha = Ia;
+  void arm_mat_vec_mult_q31(
+  const arm_matrix_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+  q31_t * pDst);
 
-    /* Intermediate product is calculated by (1/(sqrt(3)) * Ia) */
-    product1 = (q31_t) (((q63_t) Ia * 0x24F34E8B) >> 30);
 
-    /* Intermediate product is calculated by (2/sqrt(3) * Ib) */
-    product2 = (q31_t) (((q63_t) Ib * 0x49E69D16) >> 30);
+  /**
+   * @brief Q15 matrix times vector.
+   * @param[in]  pSrcMat  points to the matrix.
+   * @param[in]  pVec     points to the numCols input values.
+   * @param[out] pDst     points to the numRows output values.
+   */
+  void arm_mat_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+  q15_t * pDst);
 
-    /* pIbeta is calculated by adding the intermediate products */
-    *pIbeta = __QADD(product1, product2);
-  }
 
   /**
-   * @} end of clarke group
+   * @brief Floating-point sparse matrix times vector.
+   * @param[in]  pSrcMat  points to the sparse matrix.
+   * @param[in]  pVec     points to the numCols input values.
+   * @param[out] pDst     points to the numRows output values.
    */
+  void arm_mat_csr_vec_mult_f32(
+  const arm_matrix_csr_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst);
+
 
   /**
-   * @brief  Converts the elements of the Q7 vector to Q31 vector.
-   * @param[in]  pSrc       input pointer
-   * @param[out] pDst       output pointer
-   * @param[in]  blockSize  number of samples to process
+   * @brief Q31 sparse matrix times vector.
+   * @param[in]  pSrcMat  points to the sparse matrix.
+   * @param[in]  pVec     points to the numCols input values.
+   * @param[out] pDst     points to the numRows output values.
    */
-  void arm_q7_to_q31(
-  q7_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
-
+  void arm_mat_csr_vec_mult_q31(
+  const arm_matrix_csr_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+  q31_t * pDst);
 
 
   /**
-   * @ingroup groupController
+   * @brief Q15 sparse matrix times vector.
+   * @param[in]  pSrcMat  points to the sparse matrix.
+   * @param[in]  pVec     points to the numCols input values.
+   * @param[out] pDst     points to the numRows output values.
    */
+  void arm_mat_csr_vec_mult_q15(
+  const arm_matrix_csr_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+  q15_t * pDst);
+
 
   /**
-   * @defgroup inv_clarke Vector Inverse Clarke Transform
-   * Inverse Clarke transform converts the two-coordinate time invariant vector into instantaneous stator phases.
-   *
-   * The function operates on a single sample of data and each call to the function returns the processed output.
-   * The library provides separate functions for Q31 and floating-point data types.
-   * \par Algorithm
-   * \image html clarkeInvFormula.gif
-   * where <code>pIa</code> and <code>pIb</code> are the instantaneous stator phases and
-   * <code>Ialpha</code> and <code>Ibeta</code> are the two coordinates of time invariant vector.
-   * \par Fixed-Point Behavior
-   * Care must be taken when using the Q31 version of the Clarke transform.
-   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
-   * Refer to the function specific documentation below for usage guidelines.
+   * @brief Floating-point sparse matrix times dense matrix.
+   * @param[in]  pSrcA  points to the sparse matrix.
+   * @param[in]  pSrcB  points to the dense matrix.
+   * @param[out] pDst   points to the dense output matrix structure.
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
    */
+  arm_status arm_mat_csr_mult_f32(
+  const arm_matrix_csr_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
 
   /**
-   * @addtogroup inv_clarke
-   * @{
+   * @brief Q31 sparse matrix times dense matrix.
+   * @param[in]  pSrcA  points to the sparse matrix.
+   * @param[in]  pSrcB  points to the dense matrix.
+   * @param[out] pDst   points to the dense output matrix structure.
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
    */
+  arm_status arm_mat_csr_mult_q31(
+  const arm_matrix_csr_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst);
 
-   /**
-   * @brief  Floating-point Inverse Clarke transform
-   * @param[in]  Ialpha  input two-phase orthogonal vector axis alpha
-   * @param[in]  Ibeta   input two-phase orthogonal vector axis beta
-   * @param[out] pIa     points to output three-phase coordinate <code>a</code>
-   * @param[out] pIb     points to output three-phase coordinate <code>b</code>
-   */
-  static __INLINE void arm_inv_clarke_f32(
-  float32_t Ialpha,
-  float32_t Ibeta,
-  float32_t * pIa,
-  float32_t * pIb)
-  {
-    /* Calculating pIa from Ialpha by equation pIa = Ialpha */
-    *pIa = Ialpha;
 
-    /* Calculating pIb from Ialpha and Ibeta by equation pIb = -(1/2) * Ialpha + (sqrt(3)/2) * Ibeta */
-    *pIb = -0.5f * Ialpha + 0.8660254039f * Ibeta;
-  }
+  /**
+   * @brief Q15 sparse matrix times dense matrix.
+   * @param[in]  pSrcA  points to the sparse matrix.
+   * @param[in]  pSrcB  points to the dense matrix.
+   * @param[out] pDst   points to the dense output matrix structure.
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_csr_mult_q15(
+  const arm_matrix_csr_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+  arm_matrix_instance_q15 * pDst);
 
 
   /**
-   * @brief  Inverse Clarke transform for Q31 version
-   * @param[in]  Ialpha  input two-phase orthogonal vector axis alpha
-   * @param[in]  Ibeta   input two-phase orthogonal vector axis beta
-   * @param[out] pIa     points to output three-phase coordinate <code>a</code>
-   * @param[out] pIb     points to output three-phase coordinate <code>b</code>
-   *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using an internal 32-bit accumulator.
-   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
-   * There is saturation on the subtraction, hence there is no risk of overflow.
+   * @brief Floating-point dense to sparse matrix conversion.
+   * @param[in]  pSrc        points to the dense matrix.
+   * @param[out] pDst        points to the sparse matrix instance to initialize.
+   * @param[in]  pRowPtr     points to the numRows + 1 row offsets.
+   * @param[in]  pColIdx     points to maxNonZero column indices.
+   * @param[in]  pData       points to maxNonZero values.
+   * @param[in]  maxNonZero  length of pColIdx and pData.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR if the matrix has more than maxNonZero
+   * non-zero values, pRowPtr[numRows] then holds their number.
    */
-  static __INLINE void arm_inv_clarke_q31(
-  q31_t Ialpha,
-  q31_t Ibeta,
-  q31_t * pIa,
-  q31_t * pIb)
-  {
-    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
-
-    /* Calculating pIa from Ialpha by equation pIa = Ialpha */
-    *pIa = Ialpha;
+  arm_status arm_mat_csr_from_dense_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_csr_instance_f32 * pDst,
+  uint32_t * pRowPtr,
+  uint16_t * pColIdx,
+  float32_t * pData,
+  uint32_t maxNonZero);
 
-    /* Intermediate product is calculated by (1/(2*sqrt(3)) * Ia) */
-    product1 = (q31_t) (((q63_t) (Ialpha) * (0x40000000)) >> 31);
 
-    /* Intermediate product is calculated by (1/sqrt(3) * pIb) */
-    product2 = (q31_t) (((q63_t) (Ibeta) * (0x6ED9EBA1)) >> 31);
+  /**
+   * @brief Q31 dense to sparse matrix conversion.
+   * @param[in]  pSrc        points to the dense matrix.
+   * @param[out] pDst        points to the sparse matrix instance to initialize.
+   * @param[in]  pRowPtr     points to the numRows + 1 row offsets.
+   * @param[in]  pColIdx     points to maxNonZero column indices.
+   * @param[in]  pData       points to maxNonZero values.
+   * @param[in]  maxNonZero  length of pColIdx and pData.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR if the matrix has more than maxNonZero
+   * non-zero values, pRowPtr[numRows] then holds their number.
+   */
+  arm_status arm_mat_csr_from_dense_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_csr_instance_q31 * pDst,
+  uint32_t * pRowPtr,
+  uint16_t * pColIdx,
+  q31_t * pData,
+  uint32_t maxNonZero);
 
-    /* pIb is calculated by subtracting the products */
-    *pIb = __QSUB(product2, product1);
-  }
+
+  /**
+   * @brief Q15 dense to sparse matrix conversion.
+   * @param[in]  pSrc        points to the dense matrix.
+   * @param[out] pDst        points to the sparse matrix instance to initialize.
+   * @param[in]  pRowPtr     points to the numRows + 1 row offsets.
+   * @param[in]  pColIdx     points to maxNonZero column indices.
+   * @param[in]  pData       points to maxNonZero values.
+   * @param[in]  maxNonZero  length of pColIdx and pData.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR if the matrix has more than maxNonZero
+   * non-zero values, pRowPtr[numRows] then holds their number.
+   */
+  arm_status arm_mat_csr_from_dense_q15(
+  const arm_matrix_instance_q15 * pSrc,
+  arm_matrix_csr_instance_q15 * pDst,
+  uint32_t * pRowPtr,
+  uint16_t * pColIdx,
+  q15_t * pData,
+  uint32_t maxNonZero);
+
+
+  /**
+   * @brief Floating-point banded matrix times vector.
+   * @param[in]  pSrcMat  points to the banded matrix.
+   * @param[in]  pVec     points to the numCols input values.
+   * @param[out] pDst     points to the numRows output values.
+   */
+  void arm_mat_band_vec_mult_f32(
+  const arm_matrix_band_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst);
+
+
+  /**
+   * @brief Q31 banded matrix times vector.
+   * @param[in]  pSrcMat  points to the banded matrix.
+   * @param[in]  pVec     points to the numCols input values.
+   * @param[out] pDst     points to the numRows output values.
+   */
+  void arm_mat_band_vec_mult_q31(
+  const arm_matrix_band_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+  q31_t * pDst);
+
+
+  /**
+   * @brief Q15 banded matrix times vector.
+   * @param[in]  pSrcMat  points to the banded matrix.
+   * @param[in]  pVec     points to the numCols input values.
+   * @param[out] pDst     points to the numRows output values.
+   */
+  void arm_mat_band_vec_mult_q15(
+  const arm_matrix_band_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+  q15_t * pDst);
+
+
+  /**
+   * @brief Floating-point dense to banded matrix conversion.
+   * @param[in]  pSrc      points to the dense matrix.
+   * @param[out] pDst      points to the banded matrix instance to initialize.
+   * @param[in]  numLower  number of diagonals below the main diagonal.
+   * @param[in]  numUpper  number of diagonals above the main diagonal.
+   * @param[in]  pData     points to numRows * (numLower + numUpper + 1) values.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if a non-zero value lies outside the band.
+   */
+  arm_status arm_mat_band_from_dense_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_band_instance_f32 * pDst,
+  uint16_t numLower,
+  uint16_t numUpper,
+  float32_t * pData);
+
+
+  /**
+   * @brief Q31 dense to banded matrix conversion.
+   * @param[in]  pSrc      points to the dense matrix.
+   * @param[out] pDst      points to the banded matrix instance to initialize.
+   * @param[in]  numLower  number of diagonals below the main diagonal.
+   * @param[in]  numUpper  number of diagonals above the main diagonal.
+   * @param[in]  pData     points to numRows * (numLower + numUpper + 1) values.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if a non-zero value lies outside the band.
+   */
+  arm_status arm_mat_band_from_dense_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_band_instance_q31 * pDst,
+  uint16_t numLower,
+  uint16_t numUpper,
+  q31_t * pData);
+
+
+  /**
+   * @brief Q15 dense to banded matrix conversion.
+   * @param[in]  pSrc      points to the dense matrix.
+   * @param[out] pDst      points to the banded matrix instance to initialize.
+   * @param[in]  numLower  number of diagonals below the main diagonal.
+   * @param[in]  numUpper  number of diagonals above the main diagonal.
+   * @param[in]  pData     points to numRows * (numLower + numUpper + 1) values.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if a non-zero value lies outside the band.
+   */
+  arm_status arm_mat_band_from_dense_q15(
+  const arm_matrix_instance_q15 * pSrc,
+  arm_matrix_band_instance_q15 * pDst,
+  uint16_t numLower,
+  uint16_t numUpper,
+  q15_t * pData);
+
+
+  /**
+   * @brief Double-precision floating-point matrix multiplication, blocked for the data cache.
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_mult_f64(
+  const arm_matrix_instance_f64 * pSrcA,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
+
+  /**
+   * @brief Floating-point Cholesky decomposition A = L * L^T.
+   * @param[in]  pSrc  points to the symmetric positive definite input matrix structure.
+   * @param[out] pDst  points to the lower triangular output matrix structure, may be pSrc.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_SIZE_MISMATCH or ARM_MATH_SINGULAR if the matrix is not positive definite.
+   */
+  arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point solve of A * X = B with the Cholesky decomposition of A.
+   * @param[in]  pSrcA  points to the matrix structure of L.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, may be pSrcB.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_SIZE_MISMATCH or ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_cholesky_solve_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point LDL^T decomposition, L below the diagonal and D on the diagonal of the output.
+   * @param[in]  pSrc  points to the symmetric input matrix structure.
+   * @param[out] pDst  points to the output matrix structure, may be pSrc.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_SIZE_MISMATCH or ARM_MATH_SINGULAR if a pivot is zero.
+   */
+  arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point solve of A * X = B with the LDL^T decomposition of A.
+   * @param[in]  pSrcA  points to the matrix structure of L and D.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, may be pSrcB.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_SIZE_MISMATCH or ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_ldlt_solve_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point Householder QR decomposition of an m x n matrix, m >= n.
+   * @param[in]  pSrc  points to the input matrix structure.
+   * @param[out] pDst  points to the output matrix structure, R and the Householder vectors, may be pSrc.
+   * @param[out] pTau  points to the n Householder factors.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_SIZE_MISMATCH.
+   */
+  arm_status arm_mat_qr_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pTau);
+
+  /**
+   * @brief Floating-point least-squares solve of min |A * X - B| with the QR decomposition of A.
+   * @param[in]  pSrcA     points to the m x n matrix structure of the decomposition.
+   * @param[in]  pTau      points to the n Householder factors.
+   * @param[in]  pSrcB     points to the m x p right-hand side matrix structure.
+   * @param[out] pDst      points to the n x p solution matrix structure.
+   * @param[in]  pScratch  points to a buffer of m values.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_SIZE_MISMATCH or ARM_MATH_SINGULAR if A is rank deficient.
+   */
+  arm_status arm_mat_qr_solve_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const float32_t * pTau,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pScratch);
+
+  /**
+   * @brief Floating-point solve of A * X = B for a lower triangular A.
+   * @param[in]  pSrcA  points to the lower triangular matrix structure.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, may be pSrcB.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_SIZE_MISMATCH or ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point solve of A * X = B for an upper triangular A.
+   * @param[in]  pSrcA  points to the upper triangular matrix structure.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, may be pSrcB.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_SIZE_MISMATCH or ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Double-precision floating-point Cholesky decomposition A = L * L^T.
+   * @param[in]  pSrc  points to the symmetric positive definite input matrix structure.
+   * @param[out] pDst  points to the lower triangular output matrix structure, may be pSrc.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_SIZE_MISMATCH or ARM_MATH_SINGULAR if the matrix is not positive definite.
+   */
+  arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Double-precision floating-point solve of A * X = B with the Cholesky decomposition of A.
+   * @param[in]  pSrcA  points to the matrix structure of L.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, may be pSrcB.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_SIZE_MISMATCH or ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_cholesky_solve_f64(
+  const arm_matrix_instance_f64 * pSrcA,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Double-precision floating-point LDL^T decomposition, L below the diagonal and D on the diagonal of the output.
+   * @param[in]  pSrc  points to the symmetric input matrix structure.
+   * @param[out] pDst  points to the output matrix structure, may be pSrc.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_SIZE_MISMATCH or ARM_MATH_SINGULAR if a pivot is zero.
+   */
+  arm_status arm_mat_ldlt_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Double-precision floating-point solve of A * X = B with the LDL^T decomposition of A.
+   * @param[in]  pSrcA  points to the matrix structure of L and D.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, may be pSrcB.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_SIZE_MISMATCH or ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_ldlt_solve_f64(
+  const arm_matrix_instance_f64 * pSrcA,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Double-precision floating-point Householder QR decomposition of an m x n matrix, m >= n.
+   * @param[in]  pSrc  points to the input matrix structure.
+   * @param[out] pDst  points to the output matrix structure, R and the Householder vectors, may be pSrc.
+   * @param[out] pTau  points to the n Householder factors.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_SIZE_MISMATCH.
+   */
+  arm_status arm_mat_qr_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst,
+  float64_t * pTau);
+
+  /**
+   * @brief Double-precision floating-point least-squares solve of min |A * X - B| with the QR decomposition of A.
+   * @param[in]  pSrcA     points to the m x n matrix structure of the decomposition.
+   * @param[in]  pTau      points to the n Householder factors.
+   * @param[in]  pSrcB     points to the m x p right-hand side matrix structure.
+   * @param[out] pDst      points to the n x p solution matrix structure.
+   * @param[in]  pScratch  points to a buffer of m values.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_SIZE_MISMATCH or ARM_MATH_SINGULAR if A is rank deficient.
+   */
+  arm_status arm_mat_qr_solve_f64(
+  const arm_matrix_instance_f64 * pSrcA,
+  const float64_t * pTau,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst,
+  float64_t * pScratch);
+
+  /**
+   * @brief Double-precision floating-point solve of A * X = B for a lower triangular A.
+   * @param[in]  pSrcA  points to the lower triangular matrix structure.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, may be pSrcB.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_SIZE_MISMATCH or ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_lower_triangular_f64(
+  const arm_matrix_instance_f64 * pSrcA,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Double-precision floating-point solve of A * X = B for an upper triangular A.
+   * @param[in]  pSrcA  points to the upper triangular matrix structure.
+   * @param[in]  pSrcB  points to the right-hand side matrix structure.
+   * @param[out] pDst   points to the solution matrix structure, may be pSrcB.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_SIZE_MISMATCH or ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_upper_triangular_f64(
+  const arm_matrix_instance_f64 * pSrcA,
+  const arm_matrix_instance_f64 * pSrcB,
+  arm_matrix_instance_f64 * pDst);
+
+
+
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup clarke Vector Clarke Transform
+   * Forward Clarke transform converts the instantaneous stator phases into a two-coordinate time invariant vector.
+   * Generally the Clarke transform uses three-phase currents <code>Ia, Ib and Ic</code> to calculate currents
+   * in the two-phase orthogonal stator axis <code>Ialpha</code> and <code>Ibeta</code>.
+   * When <code>Ialpha</code> is superposed with <code>Ia</code> as shown in the figure below
+   * \image html clarke.gif Stator current space vector and its components in (a,b).
+   * and <code>Ia + Ib + Ic = 0</code>, in this condition <code>Ialpha</code> and <code>Ibeta</code>
+   * can be calculated using only <code>Ia</code> and <code>Ib</code>.
+   *
+   * The function operates on a single sample of data and each call to the function returns the processed output.
+   * The library provides separate functions for Q31 and floating-point data types.
+   * The batch functions transform a block of samples per call, with the same results.
+   * \par Algorithm
+   * \image html clarkeFormula.gif
+   * where <code>Ia</code> and <code>Ib</code> are the instantaneous stator phases and
+   * <code>pIalpha</code> and <code>pIbeta</code> are the two coordinates of time invariant vector.
+   * \par Fixed-Point Behavior
+   * Care must be taken when using the Q31 version of the Clarke transform.
+   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
+   * Refer to the function specific documentation below for usage guidelines.
+   */
+
+  /**
+   * @addtogroup clarke
+   * @{
+   */
+
+  /**
+   *
+   * @brief  Floating-point Clarke transform
+   * @param[in]  Ia       input three-phase coordinate <code>a</code>
+   * @param[in]  Ib       input three-phase coordinate <code>b</code>
+   * @param[out] pIalpha  points to output two-phase orthogonal vector axis alpha
+   * @param[out] pIbeta   points to output two-phase orthogonal vector axis beta
+   */
+  static __INLINE void arm_clarke_f32(
+  float32_t Ia,
+  float32_t Ib,
+  float32_t * pIalpha,
+  float32_t * pIbeta)
+  {
+    /* Calculate pIalpha using the equation, pIalpha = Ia */
+    *pIalpha = Ia;
+
+    /* Calculate pIbeta using the equation, pIbeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
+    *pIbeta = ((float32_t) 0.57735026919 * Ia + (float32_t) 1.15470053838 * Ib);
+  }
+
+
+  /**
+   * @brief  Clarke transform for Q31 version
+   * @param[in]  Ia       input three-phase coordinate <code>a</code>
+   * @param[in]  Ib       input three-phase coordinate <code>b</code>
+   * @param[out] pIalpha  points to output two-phase orthogonal vector axis alpha
+   * @param[out] pIbeta   points to output two-phase orthogonal vector axis beta
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using an internal 32-bit accumulator.
+   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
+   * There is saturation on the addition, hence there is no risk of overflow.
+   */
+  static __INLINE void arm_clarke_q31(
+  q31_t Ia,
+  q31_t Ib,
+  q31_t * pIalpha,
+  q31_t * pIbeta)
+  {
+    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
+
+    /* Calculating pIalpha from Ia by equation pIalpha = Ia */
+    *pIalpha = Ia;
+
+    /* Intermediate product is calculated by (1/(sqrt(3)) * Ia) */
+    product1 = (q31_t) (((q63_t) Ia * 0x24F34E8B) >> 30);
+
+    /* Intermediate product is calculated by (2/sqrt(3) * Ib) */
+    product2 = (q31_t) (((q63_t) Ib * 0x49E69D16) >> 30);
+
+    /* pIbeta is calculated by adding the intermediate products */
+    *pIbeta = __QADD(product1, product2);
+  }
+
+  /**
+   * @brief  Floating-point Clarke transform of a block of samples.
+   * @param[in]  pIa        points to the input three-phase coordinates <code>a</code>.
+   * @param[in]  pIb        points to the input three-phase coordinates <code>b</code>.
+   * @param[out] pIalpha    points to the output two-phase orthogonal vector axis alpha.
+   * @param[out] pIbeta     points to the output two-phase orthogonal vector axis beta.
+   * @param[in]  blockSize  number of samples to transform.
+   */
+  void arm_clarke_batch_f32(
+  const float32_t * pIa,
+  const float32_t * pIb,
+  float32_t * pIalpha,
+  float32_t * pIbeta,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q31 Clarke transform of a block of samples.
+   * @param[in]  pIa        points to the input three-phase coordinates <code>a</code>.
+   * @param[in]  pIb        points to the input three-phase coordinates <code>b</code>.
+   * @param[out] pIalpha    points to the output two-phase orthogonal vector axis alpha.
+   * @param[out] pIbeta     points to the output two-phase orthogonal vector axis beta.
+   * @param[in]  blockSize  number of samples to transform.
+   */
+  void arm_clarke_batch_q31(
+  const q31_t * pIa,
+  const q31_t * pIb,
+  q31_t * pIalpha,
+  q31_t * pIbeta,
+  uint32_t blockSize);
+
+  /**
+   * @} end of clarke group
+   */
+
+  /**
+   * @brief  Converts the elements of the Q7 vector to Q31 vector.
+   * @param[in]  pSrc       input pointer
+   * @param[out] pDst       output pointer
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_q7_to_q31(
+  q7_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup inv_clarke Vector Inverse Clarke Transform
+   * Inverse Clarke transform converts the two-coordinate time invariant vector into instantaneous stator phases.
+   *
+   * The function operates on a single sample of data and each call to the function returns the processed output.
+   * The library provides separate functions for Q31 and floating-point data types.
+   * The batch functions transform a block of samples per call, with the same results.
+   * \par Algorithm
+   * \image html clarkeInvFormula.gif
+   * where <code>pIa</code> and <code>pIb</code> are the instantaneous stator phases and
+   * <code>Ialpha</code> and <code>Ibeta</code> are the two coordinates of time invariant vector.
+   * \par Fixed-Point Behavior
+   * Care must be taken when using the Q31 version of the Clarke transform.
+   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
+   * Refer to the function specific documentation below for usage guidelines.
+   */
+
+  /**
+   * @addtogroup inv_clarke
+   * @{
+   */
+
+   /**
+   * @brief  Floating-point Inverse Clarke transform
+   * @param[in]  Ialpha  input two-phase orthogonal vector axis alpha
+   * @param[in]  Ibeta   input two-phase orthogonal vector axis beta
+   * @param[out] pIa     points to output three-phase coordinate <code>a</code>
+   * @param[out] pIb     points to output three-phase coordinate <code>b</code>
+   */
+  static __INLINE void arm_inv_clarke_f32(
+  float32_t Ialpha,
+  float32_t Ibeta,
+  float32_t * pIa,
+  float32_t * pIb)
+  {
+    /* Calculating pIa from Ialpha by equation pIa = Ialpha */
+    *pIa = Ialpha;
+
+    /* Calculating pIb from Ialpha and Ibeta by equation pIb = -(1/2) * Ialpha + (sqrt(3)/2) * Ibeta */
+    *pIb = -0.5f * Ialpha + 0.8660254039f * Ibeta;
+  }
+
+
+  /**
+   * @brief  Inverse Clarke transform for Q31 version
+   * @param[in]  Ialpha  input two-phase orthogonal vector axis alpha
+   * @param[in]  Ibeta   input two-phase orthogonal vector axis beta
+   * @param[out] pIa     points to output three-phase coordinate <code>a</code>
+   * @param[out] pIb     points to output three-phase coordinate <code>b</code>
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using an internal 32-bit accumulator.
+   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
+   * There is saturation on the subtraction, hence there is no risk of overflow.
+   */
+  static __INLINE void arm_inv_clarke_q31(
+  q31_t Ialpha,
+  q31_t Ibeta,
+  q31_t * pIa,
+  q31_t * pIb)
+  {
+    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
+
+    /* Calculating pIa from Ialpha by equation pIa = Ialpha */
+    *pIa = Ialpha;
+
+    /* Intermediate product is calculated by (1/(2*sqrt(3)) * Ia) */
+    product1 = (q31_t) (((q63_t) (Ialpha) * (0x40000000)) >> 31);
+
+    /* Intermediate product is calculated by (1/sqrt(3) * pIb) */
+    product2 = (q31_t) (((q63_t) (Ibeta) * (0x6ED9EBA1)) >> 31);
+
+    /* pIb is calculated by subtracting the products */
+    *pIb = __QSUB(product2, product1);
+  }
+
+  /**
+   * @brief  Floating-point inverse Clarke transform of a block of samples.
+   * @param[in]  pIalpha    points to the input two-phase orthogonal vector axis alpha.
+   * @param[in]  pIbeta     points to the input two-phase orthogonal vector axis beta.
+   * @param[out] pIa        points to the output three-phase coordinates <code>a</code>.
+   * @param[out] pIb        points to the output three-phase coordinates <code>b</code>.
+   * @param[in]  blockSize  number of samples to transform.
+   */
+  void arm_inv_clarke_batch_f32(
+  const float32_t * pIalpha,
+  const float32_t * pIbeta,
+  float32_t * pIa,
+  float32_t * pIb,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q31 inverse Clarke transform of a block of samples.
+   * @param[in]  pIalpha    points to the input two-phase orthogonal vector axis alpha.
+   * @param[in]  pIbeta     points to the input two-phase orthogonal vector axis beta.
+   * @param[out] pIa        points to the output three-phase coordinates <code>a</code>.
+   * @param[out] pIb        points to the output three-phase coordinates <code>b</code>.
+   * @param[in]  blockSize  number of samples to transform.
+   */
+  void arm_inv_clarke_batch_q31(
+  const q31_t * pIalpha,
+  const q31_t * pIbeta,
+  q31_t * pIa,
+  q31_t * pIb,
+  uint32_t blockSize);
 
   /**
    * @} end of inv_clarke group
@@ -5163,6 +7263,7 @@ void arm_rfft_fast_f32(
    *
    * The function operates on a single sample of data and each call to the function returns the processed output.
    * The library provides separate functions for Q31 and floating-point data types.
+   * The batch functions transform a block of samples per call, with the same results.
    * \par Algorithm
    * \image html parkFormula.gif
    * where <code>Ialpha</code> and <code>Ibeta</code> are the stator vector components,
@@ -5253,6 +7354,44 @@ void arm_rfft_fast_f32(
     *pIq = __QSUB(product4, product3);
   }
 
+  /**
+   * @brief  Floating-point Park transform of a block of samples.
+   * @param[in]  pIalpha    points to the input two-phase vector coordinates alpha.
+   * @param[in]  pIbeta     points to the input two-phase vector coordinates beta.
+   * @param[out] pId        points to the output rotor reference frame d.
+   * @param[out] pIq        points to the output rotor reference frame q.
+   * @param[in]  pSinVal    points to the sine values of the rotation angles theta.
+   * @param[in]  pCosVal    points to the cosine values of the rotation angles theta.
+   * @param[in]  blockSize  number of samples to transform.
+   */
+  void arm_park_batch_f32(
+  const float32_t * pIalpha,
+  const float32_t * pIbeta,
+  float32_t * pId,
+  float32_t * pIq,
+  const float32_t * pSinVal,
+  const float32_t * pCosVal,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q31 Park transform of a block of samples.
+   * @param[in]  pIalpha    points to the input two-phase vector coordinates alpha.
+   * @param[in]  pIbeta     points to the input two-phase vector coordinates beta.
+   * @param[out] pId        points to the output rotor reference frame d.
+   * @param[out] pIq        points to the output rotor reference frame q.
+   * @param[in]  pSinVal    points to the sine values of the rotation angles theta.
+   * @param[in]  pCosVal    points to the cosine values of the rotation angles theta.
+   * @param[in]  blockSize  number of samples to transform.
+   */
+  void arm_park_batch_q31(
+  const q31_t * pIalpha,
+  const q31_t * pIbeta,
+  q31_t * pId,
+  q31_t * pIq,
+  const q31_t * pSinVal,
+  const q31_t * pCosVal,
+  uint32_t blockSize);
+
   /**
    * @} end of park group
    */
@@ -5263,8 +7402,20 @@ void arm_rfft_fast_f32(
    * @param[out] pDst       is output pointer
    * @param[in]  blockSize  is the number of samples to process
    */
-  void arm_q7_to_float(
-  q7_t * pSrc,
+  void arm_q7_to_float(
+  q7_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Converts the elements of the half-precision vector to single-precision vector.
+   * @param[in]  pSrc       points to the half-precision input vector
+   * @param[out] pDst       points to the single-precision output vector
+   * @param[in]  blockSize  length of the input vector
+   */
+  void arm_f16_to_float(
+  const float16_t * pSrc,
   float32_t * pDst,
   uint32_t blockSize);
 
@@ -5279,6 +7430,7 @@ void arm_rfft_fast_f32(
    *
    * The function operates on a single sample of data and each call to the function returns the processed output.
    * The library provides separate functions for Q31 and floating-point data types.
+   * The batch functions transform a block of samples per call, with the same results.
    * \par Algorithm
    * \image html parkInvFormula.gif
    * where <code>pIalpha</code> and <code>pIbeta</code> are the stator vector components,
@@ -5366,6 +7518,44 @@ void arm_rfft_fast_f32(
     *pIbeta = __QADD(product4, product3);
   }
 
+  /**
+   * @brief  Floating-point inverse Park transform of a block of samples.
+   * @param[in]  pId        points to the input coordinates of rotor reference frame d.
+   * @param[in]  pIq        points to the input coordinates of rotor reference frame q.
+   * @param[out] pIalpha    points to the output two-phase orthogonal vector axis alpha.
+   * @param[out] pIbeta     points to the output two-phase orthogonal vector axis beta.
+   * @param[in]  pSinVal    points to the sine values of the rotation angles theta.
+   * @param[in]  pCosVal    points to the cosine values of the rotation angles theta.
+   * @param[in]  blockSize  number of samples to transform.
+   */
+  void arm_inv_park_batch_f32(
+  const float32_t * pId,
+  const float32_t * pIq,
+  float32_t * pIalpha,
+  float32_t * pIbeta,
+  const float32_t * pSinVal,
+  const float32_t * pCosVal,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q31 inverse Park transform of a block of samples.
+   * @param[in]  pId        points to the input coordinates of rotor reference frame d.
+   * @param[in]  pIq        points to the input coordinates of rotor reference frame q.
+   * @param[out] pIalpha    points to the output two-phase orthogonal vector axis alpha.
+   * @param[out] pIbeta     points to the output two-phase orthogonal vector axis beta.
+   * @param[in]  pSinVal    points to the sine values of the rotation angles theta.
+   * @param[in]  pCosVal    points to the cosine values of the rotation angles theta.
+   * @param[in]  blockSize  number of samples to transform.
+   */
+  void arm_inv_park_batch_q31(
+  const q31_t * pId,
+  const q31_t * pIq,
+  q31_t * pIalpha,
+  q31_t * pIbeta,
+  const q31_t * pSinVal,
+  const q31_t * pCosVal,
+  uint32_t blockSize);
+
   /**
    * @} end of Inverse park group
    */
@@ -5650,6 +7840,143 @@ void arm_rfft_fast_f32(
    * @} end of LinearInterpolate group
    */
 
+  /**
+   * @ingroup groupInterpolation
+   */
+
+  /**
+   * @defgroup Spline Cubic Spline Interpolation
+   *
+   * A cubic spline passes a third order polynomial through every pair of neighboring table values, with
+   * the first and second derivatives continuous at the knots.  The error falls with the fourth power of
+   * the knot spacing instead of the second for linear interpolation, so a smooth curve such as a sensor
+   * characteristic needs several times fewer table values for the same accuracy.
+   *
+   * \par
+   * The spline is built once by <code>arm_spline_init_f32()</code> or <code>arm_spline_init_q31()</code>,
+   * which solve the spline system and store three coefficients per segment.  A natural spline has zero
+   * second derivative at both ends; a clamped spline takes the first derivatives at the ends.
+   * <code>arm_spline_f32()</code> and <code>arm_spline_q31()</code> then evaluate a block of inputs.
+   *
+   * \par
+   * The knots are either a uniform grid, given by the first knot and the spacing, or an array of
+   * strictly ascending values.  On a uniform grid the segment of an input is computed directly (for Q31
+   * the spacing is a power of two and the segment is a bit field of the input).  With an array of knots
+   * every input starts at the segment of the previous one: ascending inputs cost one or two compares,
+   * any other input a binary search of the knots.  Inputs outside the table return the first or the
+   * last table value, as with linear interpolation.
+   *
+   * \par
+   * The knot and value arrays are referenced by the instance and may stay in flash; only the coefficients,
+   * 3*(nValues-1) values (4*(nValues-1) for Q31 with an array of knots), need to be writable.
+   */
+
+  /**
+   * @addtogroup Spline
+   * @{
+   */
+
+  /**
+   * @brief Instance structure for the floating-point cubic spline.
+   */
+  typedef struct
+  {
+    uint32_t nValues;                  /**< number of knots. */
+    const float32_t *pX;               /**< points to the knots, NULL for a uniform grid. */
+    const float32_t *pY;               /**< points to the values at the knots. */
+    float32_t x1;                      /**< first knot of a uniform grid. */
+    float32_t xSpacing;                /**< knot spacing of a uniform grid. */
+    float32_t *pCoeffs;                /**< points to the coefficients, 3*(nValues-1) values. */
+  } arm_spline_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 cubic spline.
+   */
+  typedef struct
+  {
+    uint32_t nValues;                  /**< number of knots. */
+    const q31_t *pX;                   /**< points to the knots, NULL for a uniform grid. */
+    const q31_t *pY;                   /**< points to the values at the knots. */
+    q31_t x1;                          /**< first knot of a uniform grid. */
+    uint8_t log2Spacing;               /**< knot spacing of a uniform grid is 2^log2Spacing. */
+    uint8_t postShift;                 /**< bit shift applied to the coefficients. */
+    q31_t *pCoeffs;                    /**< points to the coefficients, 3*(nValues-1) or 4*(nValues-1) values. */
+  } arm_spline_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point cubic spline.
+   * @param[out] S         points to an instance of the floating-point spline structure.
+   * @param[in]  pX        points to the knots, nValues strictly ascending values, or NULL for a uniform grid.
+   * @param[in]  x1        first knot of a uniform grid, ignored with pX.
+   * @param[in]  xSpacing  knot spacing of a uniform grid, ignored with pX.
+   * @param[in]  pY        points to the values at the knots, nValues values.
+   * @param[in]  nValues   number of knots, at least 2.
+   * @param[in]  pSlopes   points to the first derivatives at the first and the last knot, or NULL for a natural spline.
+   * @param[out] pCoeffs   points to the coefficient buffer, 3*(nValues-1) values.
+   * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the table is not valid.
+   */
+  arm_status arm_spline_init_f32(
+  arm_spline_instance_f32 * S,
+  const float32_t * pX,
+  float32_t x1,
+  float32_t xSpacing,
+  const float32_t * pY,
+  uint32_t nValues,
+  const float32_t * pSlopes,
+  float32_t * pCoeffs);
+
+  /**
+   * @brief  Processing function for the floating-point cubic spline.
+   * @param[in]  S          points to an instance of the floating-point spline structure.
+   * @param[in]  pSrc       points to the block of input abscissas.
+   * @param[out] pDst       points to the block of output values.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_spline_f32(
+  const arm_spline_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 cubic spline.
+   * @param[out] S            points to an instance of the Q31 spline structure.
+   * @param[in]  pX           points to the knots, nValues strictly ascending values, or NULL for a uniform grid.
+   * @param[in]  x1           first knot of a uniform grid, ignored with pX.
+   * @param[in]  log2Spacing  knot spacing of a uniform grid is 2^log2Spacing, 0 to 31, ignored with pX.
+   * @param[in]  pY           points to the values at the knots, nValues values.
+   * @param[in]  nValues      number of knots, at least 2.
+   * @param[in]  pSlopes      points to the first derivatives in 8.24 format at the first and the last knot, or NULL for a natural spline.
+   * @param[out] pCoeffs      points to the coefficient buffer, 3*(nValues-1) values on a uniform grid, 4*(nValues-1) with pX.
+   * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the table is not valid.
+   */
+  arm_status arm_spline_init_q31(
+  arm_spline_instance_q31 * S,
+  const q31_t * pX,
+  q31_t x1,
+  uint8_t log2Spacing,
+  const q31_t * pY,
+  uint32_t nValues,
+  const q31_t * pSlopes,
+  q31_t * pCoeffs);
+
+  /**
+   * @brief  Processing function for the Q31 cubic spline.
+   * @param[in]  S          points to an instance of the Q31 spline structure.
+   * @param[in]  pSrc       points to the block of input abscissas.
+   * @param[out] pDst       points to the block of output values.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_spline_q31(
+  const arm_spline_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @} end of Spline group
+   */
+
   /**
    * @brief  Fast approximation to the trigonometric sine function for floating-point data.
    * @param[in] x  input value in radians.
@@ -5678,125 +8005,422 @@ void arm_rfft_fast_f32(
 
 
   /**
-   * @brief  Fast approximation to the trigonometric cosine function for floating-point data.
-   * @param[in] x  input value in radians.
-   * @return  cos(x).
+   * @brief  Fast approximation to the trigonometric cosine function for floating-point data.
+   * @param[in] x  input value in radians.
+   * @return  cos(x).
+   */
+  float32_t arm_cos_f32(
+  float32_t x);
+
+
+  /**
+   * @brief Fast approximation to the trigonometric cosine function for Q31 data.
+   * @param[in] x  Scaled input value in radians.
+   * @return  cos(x).
+   */
+  q31_t arm_cos_q31(
+  q31_t x);
+
+
+  /**
+   * @brief  Fast approximation to the trigonometric cosine function for Q15 data.
+   * @param[in] x  Scaled input value in radians.
+   * @return  cos(x).
+   */
+  q15_t arm_cos_q15(
+  q15_t x);
+
+
+  /**
+   * @ingroup groupFastMath
+   */
+
+
+  /**
+   * @defgroup SQRT Square Root
+   *
+   * Computes the square root of a number.
+   * There are separate functions for Q15, Q31, and floating-point data types.
+   * The square root function is computed using the Newton-Raphson algorithm.
+   * This is an iterative algorithm of the form:
+   * <pre>
+   *      x1 = x0 - f(x0)/f'(x0)
+   * </pre>
+   * where <code>x1</code> is the current estimate,
+   * <code>x0</code> is the previous estimate, and
+   * <code>f'(x0)</code> is the derivative of <code>f()</code> evaluated at <code>x0</code>.
+   * For the square root function, the algorithm reduces to:
+   * <pre>
+   *     x0 = in/2                         [initial guess]
+   *     x1 = 1/2 * ( x0 + in / x0)        [each iteration]
+   * </pre>
+   */
+
+
+  /**
+   * @addtogroup SQRT
+   * @{
+   */
+
+  /**
+   * @brief  Floating-point square root function.
+   * @param[in]  in    input value.
+   * @param[out] pOut  square root of input value.
+   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
+   * <code>in</code> is negative value and returns zero output for negative values.
+   */
+  static __INLINE arm_status arm_sqrt_f32(
+  float32_t in,
+  float32_t * pOut)
+  {
+    if(in >= 0.0f)
+    {
+
+#if   (__FPU_USED == 1) && defined ( __CC_ARM   )
+      *pOut = __sqrtf(in);
+#elif (__FPU_USED == 1) && (defined(__ARMCC_VERSION) && (__ARMCC_VERSION >= 6010050))
+      *pOut = __builtin_sqrtf(in);
+#elif (__FPU_USED == 1) && defined(__GNUC__)
+      *pOut = __builtin_sqrtf(in);
+#elif (__FPU_USED == 1) && defined ( __ICCARM__ ) && (__VER__ >= 6040000)
+      __ASM("VSQRT.F32 %0,%1" : "=t"(*pOut) : "t"(in));
+#else
+      *pOut = sqrtf(in);
+#endif
+
+      return (ARM_MATH_SUCCESS);
+    }
+    else
+    {
+      *pOut = 0.0f;
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+
+  /**
+   * @brief Q31 square root function.
+   * @param[in]  in    input value.  The range of the input value is [0 +1) or 0x00000000 to 0x7FFFFFFF.
+   * @param[out] pOut  square root of input value.
+   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
+   * <code>in</code> is negative value and returns zero output for negative values.
+   */
+  arm_status arm_sqrt_q31(
+  q31_t in,
+  q31_t * pOut);
+
+
+  /**
+   * @brief  Q15 square root function.
+   * @param[in]  in    input value.  The range of the input value is [0 +1) or 0x0000 to 0x7FFF.
+   * @param[out] pOut  square root of input value.
+   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
+   * <code>in</code> is negative value and returns zero output for negative values.
+   */
+  arm_status arm_sqrt_q15(
+  q15_t in,
+  q15_t * pOut);
+
+  /**
+   * @} end of SQRT group
+   */
+
+  /**
+   * @brief Floating-point vector exponential.
+   * @param[in]  pSrc       points to the input buffer.
+   * @param[out] pDst       points to the output buffer.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vexp_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Q31 vector exponential.
+   * @param[in]  pSrc       points to the input buffer, in Q5.26.
+   * @param[out] pDst       points to the output buffer.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vexp_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Q15 vector exponential.
+   * @param[in]  pSrc       points to the input buffer, in Q4.11.
+   * @param[out] pDst       points to the output buffer.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vexp_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Floating-point vector natural logarithm.
+   * @param[in]  pSrc       points to the input buffer.
+   * @param[out] pDst       points to the output buffer.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vlog_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Floating-point vector base 10 logarithm.
+   * @param[in]  pSrc       points to the input buffer.
+   * @param[out] pDst       points to the output buffer.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vlog10_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Q31 vector natural logarithm.
+   * @param[in]  pSrc       points to the input buffer.
+   * @param[out] pDst       points to the output buffer, in Q5.26.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vlog_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Q15 vector natural logarithm.
+   * @param[in]  pSrc       points to the input buffer.
+   * @param[out] pDst       points to the output buffer, in Q4.11.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vlog_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Q31 vector base 10 logarithm.
+   * @param[in]  pSrc       points to the input buffer.
+   * @param[out] pDst       points to the output buffer, in Q4.27.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vlog10_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Q15 vector base 10 logarithm.
+   * @param[in]  pSrc       points to the input buffer.
+   * @param[out] pDst       points to the output buffer, in Q3.12.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vlog10_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Floating-point vector four quadrant arctangent.
+   * @param[in]  pSrcY      points to the y (imaginary) input buffer.
+   * @param[in]  pSrcX      points to the x (real) input buffer.
+   * @param[out] pDst       points to the output buffer, angles in radians.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vatan2_f32(
+  const float32_t * pSrcY,
+  const float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Q31 vector four quadrant arctangent.
+   * @param[in]  pSrcY      points to the y (imaginary) input buffer.
+   * @param[in]  pSrcX      points to the x (real) input buffer.
+   * @param[out] pDst       points to the output buffer, angles in Q2.29.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vatan2_q31(
+  const q31_t * pSrcY,
+  const q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Q15 vector four quadrant arctangent.
+   * @param[in]  pSrcY      points to the y (imaginary) input buffer.
+   * @param[in]  pSrcX      points to the x (real) input buffer.
+   * @param[out] pDst       points to the output buffer, angles in Q2.13.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vatan2_q15(
+  const q15_t * pSrcY,
+  const q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Floating-point vector hyperbolic tangent.
+   * @param[in]  pSrc       points to the input buffer.
+   * @param[out] pDst       points to the output buffer.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vtanh_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Q31 vector hyperbolic tangent.
+   * @param[in]  pSrc       points to the input buffer, in Q3.28.
+   * @param[out] pDst       points to the output buffer.
+   * @param[in]  blockSize  number of samples in each vector.
    */
-  float32_t arm_cos_f32(
-  float32_t x);
+  void arm_vtanh_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Fast approximation to the trigonometric cosine function for Q31 data.
-   * @param[in] x  Scaled input value in radians.
-   * @return  cos(x).
+   * @brief Q15 vector hyperbolic tangent.
+   * @param[in]  pSrc       points to the input buffer, in Q3.12.
+   * @param[out] pDst       points to the output buffer.
+   * @param[in]  blockSize  number of samples in each vector.
    */
-  q31_t arm_cos_q31(
-  q31_t x);
+  void arm_vtanh_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief  Fast approximation to the trigonometric cosine function for Q15 data.
-   * @param[in] x  Scaled input value in radians.
-   * @return  cos(x).
+   * @brief Floating-point vector logistic function.
+   * @param[in]  pSrc       points to the input buffer.
+   * @param[out] pDst       points to the output buffer.
+   * @param[in]  blockSize  number of samples in each vector.
    */
-  q15_t arm_cos_q15(
-  q15_t x);
+  void arm_vsigmoid_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @ingroup groupFastMath
+   * @brief Q31 vector logistic function.
+   * @param[in]  pSrc       points to the input buffer, in Q3.28.
+   * @param[out] pDst       points to the output buffer.
+   * @param[in]  blockSize  number of samples in each vector.
    */
+  void arm_vsigmoid_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @defgroup SQRT Square Root
-   *
-   * Computes the square root of a number.
-   * There are separate functions for Q15, Q31, and floating-point data types.
-   * The square root function is computed using the Newton-Raphson algorithm.
-   * This is an iterative algorithm of the form:
-   * <pre>
-   *      x1 = x0 - f(x0)/f'(x0)
-   * </pre>
-   * where <code>x1</code> is the current estimate,
-   * <code>x0</code> is the previous estimate, and
-   * <code>f'(x0)</code> is the derivative of <code>f()</code> evaluated at <code>x0</code>.
-   * For the square root function, the algorithm reduces to:
-   * <pre>
-   *     x0 = in/2                         [initial guess]
-   *     x1 = 1/2 * ( x0 + in / x0)        [each iteration]
-   * </pre>
+   * @brief Q15 vector logistic function.
+   * @param[in]  pSrc       points to the input buffer, in Q3.12.
+   * @param[out] pDst       points to the output buffer.
+   * @param[in]  blockSize  number of samples in each vector.
    */
+  void arm_vsigmoid_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @addtogroup SQRT
-   * @{
+   * @brief Floating-point vector square root.
+   * @param[in]  pSrc       points to the input buffer.
+   * @param[out] pDst       points to the output buffer.
+   * @param[in]  blockSize  number of samples in each vector.
    */
+  void arm_vsqrt_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
 
   /**
-   * @brief  Floating-point square root function.
-   * @param[in]  in    input value.
-   * @param[out] pOut  square root of input value.
-   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
-   * <code>in</code> is negative value and returns zero output for negative values.
+   * @brief Floating-point vector reciprocal square root.
+   * @param[in]  pSrc       points to the input buffer.
+   * @param[out] pDst       points to the output buffer.
+   * @param[in]  blockSize  number of samples in each vector.
    */
-  static __INLINE arm_status arm_sqrt_f32(
-  float32_t in,
-  float32_t * pOut)
-  {
-    if(in >= 0.0f)
-    {
+  void arm_vrsqrt_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
-#if   (__FPU_USED == 1) && defined ( __CC_ARM   )
-      *pOut = __sqrtf(in);
-#elif (__FPU_USED == 1) && (defined(__ARMCC_VERSION) && (__ARMCC_VERSION >= 6010050))
-      *pOut = __builtin_sqrtf(in);
-#elif (__FPU_USED == 1) && defined(__GNUC__)
-      *pOut = __builtin_sqrtf(in);
-#elif (__FPU_USED == 1) && defined ( __ICCARM__ ) && (__VER__ >= 6040000)
-      __ASM("VSQRT.F32 %0,%1" : "=t"(*pOut) : "t"(in));
-#else
-      *pOut = sqrtf(in);
-#endif
 
-      return (ARM_MATH_SUCCESS);
-    }
-    else
-    {
-      *pOut = 0.0f;
-      return (ARM_MATH_ARGUMENT_ERROR);
-    }
-  }
+  /**
+   * @brief Q31 vector square root.
+   * @param[in]  pSrc       points to the input buffer.
+   * @param[out] pDst       points to the output buffer.
+   * @param[in]  blockSize  number of samples in each vector.
+   */
+  void arm_vsqrt_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief Q31 square root function.
-   * @param[in]  in    input value.  The range of the input value is [0 +1) or 0x00000000 to 0x7FFFFFFF.
-   * @param[out] pOut  square root of input value.
-   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
-   * <code>in</code> is negative value and returns zero output for negative values.
+   * @brief Q15 vector square root.
+   * @param[in]  pSrc       points to the input buffer.
+   * @param[out] pDst       points to the output buffer.
+   * @param[in]  blockSize  number of samples in each vector.
    */
-  arm_status arm_sqrt_q31(
-  q31_t in,
-  q31_t * pOut);
+  void arm_vsqrt_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief  Q15 square root function.
-   * @param[in]  in    input value.  The range of the input value is [0 +1) or 0x0000 to 0x7FFF.
-   * @param[out] pOut  square root of input value.
-   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
-   * <code>in</code> is negative value and returns zero output for negative values.
+   * @brief Q31 vector reciprocal square root.
+   * @param[in]  pSrc       points to the input buffer.
+   * @param[out] pDst       points to the output mantissas, in [0.5 1).
+   * @param[out] pShift     points to the output exponents, the result is pDst[n] * 2^pShift[n].
+   * @param[in]  blockSize  number of samples in each vector.
    */
-  arm_status arm_sqrt_q15(
-  q15_t in,
-  q15_t * pOut);
+  void arm_vrsqrt_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  int16_t * pShift,
+  uint32_t blockSize);
+
 
   /**
-   * @} end of SQRT group
+   * @brief Q15 vector reciprocal square root.
+   * @param[in]  pSrc       points to the input buffer.
+   * @param[out] pDst       points to the output mantissas, in [0.5 1).
+   * @param[out] pShift     points to the output exponents, the result is pDst[n] * 2^pShift[n].
+   * @param[in]  blockSize  number of samples in each vector.
    */
+  void arm_vrsqrt_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  int16_t * pShift,
+  uint32_t blockSize);
 
 
   /**
@@ -5859,12 +8483,13 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0u;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    int32_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5877,7 +8502,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (int32_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
@@ -5958,13 +8583,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q15_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5977,7 +8603,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (q15_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6058,13 +8684,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q7_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6077,7 +8704,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (q7_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6540,6 +9167,177 @@ void arm_rfft_fast_f32(
   float32_t * pResult,
   uint32_t * pIndex);
 
+  /**
+   * @brief Instance structure for the floating-point median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;           /**< number of samples in the window. */
+    uint16_t rank;                /**< rank of the output in the window. */
+    uint16_t pos;                 /**< ring position of the oldest sample. */
+    float32_t *pData;             /**< points to the window, windowLen samples. */
+    int16_t *pPos;                /**< points to the heap slot of every window sample, NULL for the sorting networks. */
+    int16_t *pHeap;               /**< points to the root of the heaps. */
+  } arm_median_filter_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;           /**< number of samples in the window. */
+    uint16_t rank;                /**< rank of the output in the window. */
+    uint16_t pos;                 /**< ring position of the oldest sample. */
+    q31_t *pData;                 /**< points to the window, windowLen samples. */
+    int16_t *pPos;                /**< points to the heap slot of every window sample, NULL for the sorting networks. */
+    int16_t *pHeap;               /**< points to the root of the heaps. */
+  } arm_median_filter_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;           /**< number of samples in the window. */
+    uint16_t rank;                /**< rank of the output in the window. */
+    uint16_t pos;                 /**< ring position of the oldest sample. */
+    q15_t *pData;                 /**< points to the window, windowLen samples. */
+    int16_t *pPos;                /**< points to the heap slot of every window sample, NULL for the sorting networks. */
+    int16_t *pHeap;               /**< points to the root of the heaps. */
+  } arm_median_filter_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point median filter.
+   * @param[in,out] S          points to an instance of the floating-point median filter structure.
+   * @param[in]     windowLen  number of samples in the window, from 1 to 32767.
+   * @param[in]     rank       rank of the output, 0 for the minimum and (windowLen-1)/2 for the median.
+   * @param[in]     pData      points to the window buffer of windowLen samples.
+   * @param[in]     pIndex     points to the index buffer of 2*windowLen values, may be NULL for windows of 3 and 5.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_median_filter_init_f32(
+  arm_median_filter_instance_f32 * S,
+  uint16_t windowLen,
+  uint16_t rank,
+  float32_t * pData,
+  int16_t * pIndex);
+
+  /**
+   * @brief Processing function for the floating-point median filter.
+   * @param[in,out] S          points to an instance of the floating-point median filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_median_filter_f32(
+  arm_median_filter_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 median filter.
+   * @param[in,out] S          points to an instance of the Q31 median filter structure.
+   * @param[in]     windowLen  number of samples in the window, from 1 to 32767.
+   * @param[in]     rank       rank of the output, 0 for the minimum and (windowLen-1)/2 for the median.
+   * @param[in]     pData      points to the window buffer of windowLen samples.
+   * @param[in]     pIndex     points to the index buffer of 2*windowLen values, may be NULL for windows of 3 and 5.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_median_filter_init_q31(
+  arm_median_filter_instance_q31 * S,
+  uint16_t windowLen,
+  uint16_t rank,
+  q31_t * pData,
+  int16_t * pIndex);
+
+  /**
+   * @brief Processing function for the Q31 median filter.
+   * @param[in,out] S          points to an instance of the Q31 median filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_median_filter_q31(
+  arm_median_filter_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 median filter.
+   * @param[in,out] S          points to an instance of the Q15 median filter structure.
+   * @param[in]     windowLen  number of samples in the window, from 1 to 32767.
+   * @param[in]     rank       rank of the output, 0 for the minimum and (windowLen-1)/2 for the median.
+   * @param[in]     pData      points to the window buffer of windowLen samples.
+   * @param[in]     pIndex     points to the index buffer of 2*windowLen values, may be NULL for windows of 3 and 5.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_median_filter_init_q15(
+  arm_median_filter_instance_q15 * S,
+  uint16_t windowLen,
+  uint16_t rank,
+  q15_t * pData,
+  int16_t * pIndex);
+
+  /**
+   * @brief Processing function for the Q15 median filter.
+   * @param[in,out] S          points to an instance of the Q15 median filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_median_filter_q15(
+  arm_median_filter_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Percentile of a floating-point vector.
+   * @param[in]     pSrc       points to the input vector.
+   * @param[in]     blockSize  length of the input vector, 0 gives a result of 0.
+   * @param[in]     rank       rank of the result, 0 for the minimum and blockSize-1 for the maximum.
+   * @param[in,out] pScratch   points to a buffer of blockSize values, reordered, may be pSrc.
+   * @param[out]    pResult    percentile value returned here.
+   */
+  void arm_percentile_f32(
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t rank,
+  float32_t * pScratch,
+  float32_t * pResult);
+
+  /**
+   * @brief Percentile of a Q31 vector.
+   * @param[in]     pSrc       points to the input vector.
+   * @param[in]     blockSize  length of the input vector, 0 gives a result of 0.
+   * @param[in]     rank       rank of the result, 0 for the minimum and blockSize-1 for the maximum.
+   * @param[in,out] pScratch   points to a buffer of blockSize values, reordered, may be pSrc.
+   * @param[out]    pResult    percentile value returned here.
+   */
+  void arm_percentile_q31(
+  const q31_t * pSrc,
+  uint32_t blockSize,
+  uint32_t rank,
+  q31_t * pScratch,
+  q31_t * pResult);
+
+  /**
+   * @brief Percentile of a Q15 vector.
+   * @param[in]     pSrc       points to the input vector.
+   * @param[in]     blockSize  length of the input vector, 0 gives a result of 0.
+   * @param[in]     rank       rank of the result, 0 for the minimum and blockSize-1 for the maximum.
+   * @param[in,out] pScratch   points to a buffer of blockSize values, reordered, may be pSrc.
+   * @param[out]    pResult    percentile value returned here.
+   */
+  void arm_percentile_q15(
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t rank,
+  q15_t * pScratch,
+  q15_t * pResult);
+
 
   /**
    * @brief  Q15 complex-by-complex multiplication
@@ -6619,6 +9417,18 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief  Converts the elements of the single-precision vector to half-precision vector.
+   * @param[in]  pSrc       points to the single-precision input vector
+   * @param[out] pDst       points to the half-precision output vector
+   * @param[in]  blockSize  length of the input vector
+   */
+  void arm_float_to_f16(
+  const float32_t * pSrc,
+  float16_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @brief  Converts the elements of the Q31 vector to Q15 vector.
    * @param[in]  pSrc       is input pointer
@@ -7038,13 +9848,320 @@ void arm_rfft_fast_f32(
    */
 
 
+  /**
+   * @ingroup groupNN
+   */
+
+  /**
+   * @brief Shape of an HWC tensor, the channels of a pixel are adjacent in memory.
+   */
+  typedef struct
+  {
+    uint16_t height;         /**< number of rows. */
+    uint16_t width;          /**< number of columns. */
+    uint16_t channels;       /**< number of channels. */
+  } arm_nn_dims;
+
+  /**
+   * @brief Quantization of a Q7 layer, per output channel.
+   */
+  typedef struct
+  {
+    const q31_t *pMult;      /**< points to the output multipliers, Q31 in [0.5 1). */
+    const int32_t *pShift;   /**< points to the output shifts, positive to the left. */
+    int32_t inOffset;        /**< added to every input value, minus the input zero point. */
+    int32_t outOffset;       /**< added to every output value, the output zero point. */
+    int32_t actMin;          /**< lowest output value, -128 or the ReLU bound. */
+    int32_t actMax;          /**< highest output value, usually 127. */
+  } arm_nn_quant_q7;
+
+  /**
+   * @brief Instance structure for the Q7 convolutions.
+   */
+  typedef struct
+  {
+    arm_nn_dims in;          /**< input shape. */
+    arm_nn_dims out;         /**< output shape. */
+    uint16_t kernelH;        /**< kernel rows. */
+    uint16_t kernelW;        /**< kernel columns. */
+    uint16_t strideH;        /**< vertical stride. */
+    uint16_t strideW;        /**< horizontal stride. */
+    uint16_t padH;           /**< zero rows above the input. */
+    uint16_t padW;           /**< zero columns left of the input. */
+    const q7_t *pWeights;    /**< points to out.channels x kernelH x kernelW x in.channels weights, kernelH x kernelW x out.channels for the depthwise convolution. */
+    const q31_t *pBias;      /**< points to out.channels biases, NULL for none. */
+    arm_nn_quant_q7 quant;   /**< quantization. */
+  } arm_nn_conv_instance_q7;
+
+  /**
+   * @brief Instance structure for the Q7 fully connected layer.
+   */
+  typedef struct
+  {
+    uint16_t inLen;          /**< number of inputs. */
+    uint16_t outLen;         /**< number of outputs. */
+    const q7_t *pWeights;    /**< points to outLen x inLen weights. */
+    const q31_t *pBias;      /**< points to outLen biases, NULL for none. */
+    arm_nn_quant_q7 quant;   /**< quantization. */
+  } arm_nn_fc_instance_q7;
+
+  /**
+   * @brief Instance structure for the Q7 pooling layers.
+   */
+  typedef struct
+  {
+    arm_nn_dims in;          /**< input shape. */
+    arm_nn_dims out;         /**< output shape, out.channels equals in.channels. */
+    uint16_t kernelH;        /**< window rows. */
+    uint16_t kernelW;        /**< window columns. */
+    uint16_t strideH;        /**< vertical stride. */
+    uint16_t strideW;        /**< horizontal stride. */
+    uint16_t padH;           /**< rows above the input covered by the first window. */
+    uint16_t padW;           /**< columns left of the input covered by the first window. */
+    int32_t actMin;          /**< lowest output value. */
+    int32_t actMax;          /**< highest output value. */
+  } arm_nn_pool_instance_q7;
+
+
+  /**
+   * @brief Multiplies an accumulator by a Q31 multiplier and a power of two, as TensorFlow Lite does.
+   * @param[in] val    accumulator.
+   * @param[in] mult   multiplier, Q31 in [0.5 1).
+   * @param[in] shift  power of two, positive to the left.
+   * @return round(val * mult * 2^(shift - 31)), rounded twice like the reference.
+   */
+  static __INLINE q31_t arm_nn_requantize(
+  q31_t val,
+  q31_t mult,
+  int32_t shift)
+  {
+    q63_t prod;
+    q31_t res, mask, rem, threshold;
+    int32_t right = (shift > 0) ? 0 : -shift;
+
+    if(shift > 0)
+    {
+      val = (q31_t) ((uint32_t) val << shift);
+    }
+
+    /* Rounding doubling high multiply, the only overflow is -1 * -1 */
+    if((val == mult) && (val == (q31_t) 0x80000000))
+    {
+      res = 0x7FFFFFFF;
+    }
+    else
+    {
+      prod = (q63_t) val * mult;
+      prod += (prod >= 0) ? (1LL << 30) : (1 - (1LL << 30));
+      res = (q31_t) (prod / (1LL << 31));
+    }
+
+    /* Rounding right shift, ties away from zero */
+    mask = (q31_t) ((1u << right) - 1u);
+    rem = res & mask;
+    threshold = (mask >> 1) + ((res < 0) ? 1 : 0);
+
+    return (res >> right) + ((rem > threshold) ? 1 : 0);
+  }
+
+
+  /**
+   * @brief Requantizes the accumulator of output channel ch to a Q7 output.
+   * @param[in] sum     accumulator.
+   * @param[in] pQuant  points to the quantization of the layer.
+   * @param[in] ch      output channel.
+   * @return the output value, offset and clamped.
+   */
+  static __INLINE q7_t arm_nn_requantize_q7(
+  q31_t sum,
+  const arm_nn_quant_q7 * pQuant,
+  uint32_t ch)
+  {
+    sum = arm_nn_requantize(sum, pQuant->pMult[ch], pQuant->pShift[ch]) + pQuant->outOffset;
+    sum = (sum < pQuant->actMin) ? pQuant->actMin : sum;
+    sum = (sum > pQuant->actMax) ? pQuant->actMax : sum;
+
+    return (q7_t) sum;
+  }
+
+
+  /**
+   * @brief Converts a Q7 vector to Q15 and adds an offset to every value.
+   * @param[in]  pSrc       points to the Q7 input vector.
+   * @param[out] pDst       points to the Q15 output vector.
+   * @param[in]  blockSize  length of the input vector.
+   * @param[in]  offset     added to every value.
+   */
+  void arm_nn_q7_to_q15_with_offset(
+  const q7_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize,
+  q15_t offset);
+
+
+  /**
+   * @brief Q7 weights times two expanded Q15 columns, requantized to two Q7 output pixels.
+   * @param[in]  pA         points to outCh rows of numCol weights.
+   * @param[in]  pInBuffer  points to two adjacent columns of numCol values.
+   * @param[in]  outCh      number of rows.
+   * @param[in]  numCol     length of a row and of a column.
+   * @param[in]  pBias      points to outCh biases, NULL for none.
+   * @param[in]  pQuant     points to the output quantization.
+   * @param[out] pOut       points to the 2*outCh outputs.
+   * @return points just past the outputs.
+   */
+  q7_t * arm_nn_mat_mult_kernel_q7_q15(
+  const q7_t * pA,
+  const q15_t * pInBuffer,
+  uint16_t outCh,
+  uint32_t numCol,
+  const q31_t * pBias,
+  const arm_nn_quant_q7 * pQuant,
+  q7_t * pOut);
+
+
+  /**
+   * @brief Q7 weights times one expanded Q15 column, requantized to Q7 outputs.
+   * @param[in]  pVec       points to the column of numCol values.
+   * @param[in]  pA         points to numRows rows of numCol weights.
+   * @param[in]  numRows    number of rows.
+   * @param[in]  numCol     length of a row and of the column.
+   * @param[in]  pBias      points to numRows biases, NULL for none.
+   * @param[in]  pQuant     points to the output quantization.
+   * @param[out] pOut       points to the numRows outputs.
+   */
+  void arm_nn_vec_mat_mult_q7_q15(
+  const q15_t * pVec,
+  const q7_t * pA,
+  uint16_t numRows,
+  uint32_t numCol,
+  const q31_t * pBias,
+  const arm_nn_quant_q7 * pQuant,
+  q7_t * pOut);
+
+
+  /**
+   * @brief Q7 convolution.
+   * @param[in]     S        points to an instance of the convolution structure.
+   * @param[in]     pSrc     points to the input tensor.
+   * @param[out]    pDst     points to the output tensor.
+   * @param[in,out] pBuffer  points to 2*kernelH*kernelW*in.channels Q15 values.
+   * @return ARM_MATH_SUCCESS.
+   */
+  arm_status arm_convolve_q7(
+  const arm_nn_conv_instance_q7 * S,
+  const q7_t * pSrc,
+  q7_t * pDst,
+  q15_t * pBuffer);
+
+
+  /**
+   * @brief Q7 pointwise (1x1) convolution.
+   * @param[in]     S        points to an instance of the convolution structure.
+   * @param[in]     pSrc     points to the input tensor.
+   * @param[out]    pDst     points to the output tensor.
+   * @param[in,out] pBuffer  points to 2*in.channels Q15 values.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for a kernel other than 1x1 or with padding.
+   */
+  arm_status arm_convolve_1x1_q7(
+  const arm_nn_conv_instance_q7 * S,
+  const q7_t * pSrc,
+  q7_t * pDst,
+  q15_t * pBuffer);
+
+
+  /**
+   * @brief Q7 depthwise convolution.
+   * @param[in]  S     points to an instance of the convolution structure.
+   * @param[in]  pSrc  points to the input tensor.
+   * @param[out] pDst  points to the output tensor.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if out.channels is not a multiple of in.channels.
+   */
+  arm_status arm_depthwise_conv_q7(
+  const arm_nn_conv_instance_q7 * S,
+  const q7_t * pSrc,
+  q7_t * pDst);
+
+
+  /**
+   * @brief Q7 fully connected layer.
+   * @param[in]     S        points to an instance of the fully connected structure.
+   * @param[in]     pSrc     points to the inLen inputs.
+   * @param[out]    pDst     points to the outLen outputs.
+   * @param[in,out] pBuffer  points to inLen Q15 values.
+   */
+  void arm_fully_connected_q7(
+  const arm_nn_fc_instance_q7 * S,
+  const q7_t * pSrc,
+  q7_t * pDst,
+  q15_t * pBuffer);
+
+
+  /**
+   * @brief Q7 max pooling.
+   * @param[in]  S     points to an instance of the pooling structure.
+   * @param[in]  pSrc  points to the input tensor.
+   * @param[out] pDst  points to the output tensor.
+   */
+  void arm_max_pool_q7(
+  const arm_nn_pool_instance_q7 * S,
+  const q7_t * pSrc,
+  q7_t * pDst);
+
+
+  /**
+   * @brief Q7 average pooling.
+   * @param[in]  S     points to an instance of the pooling structure.
+   * @param[in]  pSrc  points to the input tensor.
+   * @param[out] pDst  points to the output tensor.
+   */
+  void arm_avg_pool_q7(
+  const arm_nn_pool_instance_q7 * S,
+  const q7_t * pSrc,
+  q7_t * pDst);
+
+
+  /**
+   * @brief Q7 ReLU, in place.
+   * @param[in,out] pData      points to the values.
+   * @param[in]     blockSize  number of values.
+   */
+  void arm_relu_q7(
+  q7_t * pData,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Builds the exponential table of the Q7 softmax.
+   * @param[out] pTable  points to 256 Q15 values.
+   * @param[in]  scale   input scale, the real value of one logit step.
+   */
+  void arm_softmax_init_q7(
+  q15_t * pTable,
+  float32_t scale);
+
+
+  /**
+   * @brief Q7 softmax, output scale 1/256 and zero point -128.
+   * @param[in]  pSrc       points to the logits.
+   * @param[out] pDst       points to the probabilities.
+   * @param[in]  blockSize  number of values.
+   * @param[in]  pTable     points to the table built by arm_softmax_init_q7().
+   */
+  void arm_softmax_q7(
+  const q7_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize,
+  const q15_t * pTable);
+
+
 /* SMMLAR */
 #define multAcc_32x32_keep32_R(a, x, y) \
-    a = (q31_t) (((((q63_t) a) << 32) + ((q63_t) x * y) + 0x80000000LL ) >> 32)
+    a = (q31_t) (((((q63_t) a) * 0x100000000LL) + ((q63_t) x * y) + 0x80000000LL ) >> 32)
 
 /* SMMLSR */
 #define multSub_32x32_keep32_R(a, x, y) \
-    a = (q31_t) (((((q63_t) a) << 32) - ((q63_t) x * y) + 0x80000000LL ) >> 32)
+    a = (q31_t) (((((q63_t) a) * 0x100000000LL) - ((q63_t) x * y) + 0x80000000LL ) >> 32)
 
 /* SMMULR */
 #define mult_32x32_keep32_R(a, x, y) \
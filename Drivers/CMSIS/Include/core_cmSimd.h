@@ -52,8 +52,244 @@
   @{
 */
 
+/*------------------ Host build (ARM_MATH_HOST) --------*/
+#if   defined ( ARM_MATH_HOST )
+/*
+ * Portable C versions of the instructions used by CMSIS-DSP, so that the
+ * library builds with gcc or clang on the host. Results are bit-exact with the
+ * Cortex-M instructions, the Q flag is not modelled.
+ */
+#include <stdint.h>
+
+#ifndef   __ASM
+  #define __ASM                   __asm
+#endif
+#ifndef   __INLINE
+  #define __INLINE                inline
+#endif
+#ifndef   __STATIC_INLINE
+  #define __STATIC_INLINE         static inline
+#endif
+
+#define __HOST_LO16(x)            ((int32_t)(int16_t)(uint16_t)(x))
+#define __HOST_HI16(x)            ((int32_t)(int16_t)(uint16_t)((uint32_t)(x) >> 16))
+#define __HOST_BYTE(x, n)         ((int32_t)(int8_t)(uint8_t)((uint32_t)(x) >> (8 * (n))))
+#define __HOST_PACK16(hi, lo)     ((uint32_t)(((uint32_t)(hi) << 16) | ((uint32_t)(lo) & 0xFFFFU)))
+
+__STATIC_INLINE int32_t __host_sat(int64_t val, uint32_t sat)
+{
+  const int64_t max = ((int64_t)1 << (sat - 1U)) - 1;
+
+  if (val > max)
+  {
+    return (int32_t)max;
+  }
+  if (val < -max - 1)
+  {
+    return (int32_t)(-max - 1);
+  }
+  return (int32_t)val;
+}
+
+__STATIC_INLINE uint8_t __CLZ(uint32_t value)
+{
+  uint8_t n = 0U;
+
+  if (value == 0U)
+  {
+    return 32U;
+  }
+#if defined ( __GNUC__ )
+  n = (uint8_t)__builtin_clz(value);
+#else
+  while ((value & 0x80000000U) == 0U)
+  {
+    value <<= 1;
+    n++;
+  }
+#endif
+  return n;
+}
+
+__STATIC_INLINE uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+  op2 &= 31U;
+  return (op2 == 0U) ? op1 : ((op1 >> op2) | (op1 << (32U - op2)));
+}
+
+#if !defined (ARM_MATH_CM0) && !defined (ARM_MATH_CM0PLUS)
+__STATIC_INLINE int32_t __SSAT(int32_t val, uint32_t sat)
+{
+  return __host_sat(val, sat);
+}
+
+__STATIC_INLINE uint32_t __USAT(int32_t val, uint32_t sat)
+{
+  const int32_t max = (int32_t)((1ULL << sat) - 1U);
+
+  return (uint32_t)((val < 0) ? 0 : ((val > max) ? max : val));
+}
+#endif
+
+/* the Cortex-M3/M0 builds of arm_math.h provide their own versions of these */
+#if !defined (ARM_MATH_CM3) && !defined (ARM_MATH_CM0) && !defined (ARM_MATH_CM0PLUS)
+
+#define __PKHBT(ARG1, ARG2, ARG3) \
+  ((int32_t)(((uint32_t)(ARG1) & 0x0000FFFFU) | (((uint32_t)(ARG2) << (ARG3)) & 0xFFFF0000U)))
+#define __PKHTB(ARG1, ARG2, ARG3) \
+  ((int32_t)(((uint32_t)(ARG1) & 0xFFFF0000U) | ((uint32_t)((int32_t)(ARG2) >> (ARG3)) & 0x0000FFFFU)))
+
+__STATIC_INLINE uint32_t __QADD8(uint32_t op1, uint32_t op2)
+{
+  uint32_t res = 0U;
+  uint32_t n;
+
+  for (n = 0U; n < 4U; n++)
+  {
+    res |= ((uint32_t)__host_sat((int64_t)__HOST_BYTE(op1, n) + __HOST_BYTE(op2, n), 8U) & 0xFFU) << (8U * n);
+  }
+  return res;
+}
+
+__STATIC_INLINE uint32_t __QSUB8(uint32_t op1, uint32_t op2)
+{
+  uint32_t res = 0U;
+  uint32_t n;
+
+  for (n = 0U; n < 4U; n++)
+  {
+    res |= ((uint32_t)__host_sat((int64_t)__HOST_BYTE(op1, n) - __HOST_BYTE(op2, n), 8U) & 0xFFU) << (8U * n);
+  }
+  return res;
+}
+
+__STATIC_INLINE uint32_t __QADD16(uint32_t op1, uint32_t op2)
+{
+  return __HOST_PACK16(__host_sat((int64_t)__HOST_HI16(op1) + __HOST_HI16(op2), 16U),
+                       __host_sat((int64_t)__HOST_LO16(op1) + __HOST_LO16(op2), 16U));
+}
+
+__STATIC_INLINE uint32_t __QSUB16(uint32_t op1, uint32_t op2)
+{
+  return __HOST_PACK16(__host_sat((int64_t)__HOST_HI16(op1) - __HOST_HI16(op2), 16U),
+                       __host_sat((int64_t)__HOST_LO16(op1) - __HOST_LO16(op2), 16U));
+}
+
+__STATIC_INLINE uint32_t __SHADD16(uint32_t op1, uint32_t op2)
+{
+  return __HOST_PACK16((__HOST_HI16(op1) + __HOST_HI16(op2)) >> 1,
+                       (__HOST_LO16(op1) + __HOST_LO16(op2)) >> 1);
+}
+
+__STATIC_INLINE uint32_t __SHSUB16(uint32_t op1, uint32_t op2)
+{
+  return __HOST_PACK16((__HOST_HI16(op1) - __HOST_HI16(op2)) >> 1,
+                       (__HOST_LO16(op1) - __HOST_LO16(op2)) >> 1);
+}
+
+__STATIC_INLINE uint32_t __QASX(uint32_t op1, uint32_t op2)
+{
+  return __HOST_PACK16(__host_sat((int64_t)__HOST_HI16(op1) + __HOST_LO16(op2), 16U),
+                       __host_sat((int64_t)__HOST_LO16(op1) - __HOST_HI16(op2), 16U));
+}
+
+__STATIC_INLINE uint32_t __SHASX(uint32_t op1, uint32_t op2)
+{
+  return __HOST_PACK16((__HOST_HI16(op1) + __HOST_LO16(op2)) >> 1,
+                       (__HOST_LO16(op1) - __HOST_HI16(op2)) >> 1);
+}
+
+__STATIC_INLINE uint32_t __QSAX(uint32_t op1, uint32_t op2)
+{
+  return __HOST_PACK16(__host_sat((int64_t)__HOST_HI16(op1) - __HOST_LO16(op2), 16U),
+                       __host_sat((int64_t)__HOST_LO16(op1) + __HOST_HI16(op2), 16U));
+}
+
+__STATIC_INLINE uint32_t __SHSAX(uint32_t op1, uint32_t op2)
+{
+  return __HOST_PACK16((__HOST_HI16(op1) - __HOST_LO16(op2)) >> 1,
+                       (__HOST_LO16(op1) + __HOST_HI16(op2)) >> 1);
+}
+
+__STATIC_INLINE uint32_t __SMUAD(uint32_t op1, uint32_t op2)
+{
+  return (uint32_t)(__HOST_LO16(op1) * __HOST_LO16(op2)) + (uint32_t)(__HOST_HI16(op1) * __HOST_HI16(op2));
+}
+
+__STATIC_INLINE uint32_t __SMUADX(uint32_t op1, uint32_t op2)
+{
+  return (uint32_t)(__HOST_LO16(op1) * __HOST_HI16(op2)) + (uint32_t)(__HOST_HI16(op1) * __HOST_LO16(op2));
+}
+
+__STATIC_INLINE uint32_t __SMUSD(uint32_t op1, uint32_t op2)
+{
+  return (uint32_t)(__HOST_LO16(op1) * __HOST_LO16(op2)) - (uint32_t)(__HOST_HI16(op1) * __HOST_HI16(op2));
+}
+
+__STATIC_INLINE uint32_t __SMUSDX(uint32_t op1, uint32_t op2)
+{
+  return (uint32_t)(__HOST_LO16(op1) * __HOST_HI16(op2)) - (uint32_t)(__HOST_HI16(op1) * __HOST_LO16(op2));
+}
+
+__STATIC_INLINE uint32_t __SMLAD(uint32_t op1, uint32_t op2, uint32_t op3)
+{
+  return op3 + __SMUAD(op1, op2);
+}
+
+__STATIC_INLINE uint32_t __SMLADX(uint32_t op1, uint32_t op2, uint32_t op3)
+{
+  return op3 + __SMUADX(op1, op2);
+}
+
+__STATIC_INLINE uint32_t __SMLSD(uint32_t op1, uint32_t op2, uint32_t op3)
+{
+  return op3 + __SMUSD(op1, op2);
+}
+
+__STATIC_INLINE uint32_t __SMLSDX(uint32_t op1, uint32_t op2, uint32_t op3)
+{
+  return op3 + __SMUSDX(op1, op2);
+}
+
+__STATIC_INLINE uint64_t __SMLALD(uint32_t op1, uint32_t op2, uint64_t acc)
+{
+  return acc + (uint64_t)((int64_t)__HOST_LO16(op1) * __HOST_LO16(op2) + (int64_t)__HOST_HI16(op1) * __HOST_HI16(op2));
+}
+
+__STATIC_INLINE uint64_t __SMLALDX(uint32_t op1, uint32_t op2, uint64_t acc)
+{
+  return acc + (uint64_t)((int64_t)__HOST_LO16(op1) * __HOST_HI16(op2) + (int64_t)__HOST_HI16(op1) * __HOST_LO16(op2));
+}
+
+__STATIC_INLINE uint64_t __SMLSLD(uint32_t op1, uint32_t op2, uint64_t acc)
+{
+  return acc + (uint64_t)((int64_t)__HOST_LO16(op1) * __HOST_LO16(op2) - (int64_t)__HOST_HI16(op1) * __HOST_HI16(op2));
+}
+
+__STATIC_INLINE uint32_t __SXTB16(uint32_t op1)
+{
+  return __HOST_PACK16(__HOST_BYTE(op1, 2U), __HOST_BYTE(op1, 0U));
+}
+
+__STATIC_INLINE int32_t __QADD(int32_t op1, int32_t op2)
+{
+  return __host_sat((int64_t)op1 + op2, 32U);
+}
+
+__STATIC_INLINE int32_t __QSUB(int32_t op1, int32_t op2)
+{
+  return __host_sat((int64_t)op1 - op2, 32U);
+}
+
+__STATIC_INLINE int32_t __SMMLA(int32_t op1, int32_t op2, int32_t op3)
+{
+  return (int32_t)((((int64_t)op3 << 32) + (int64_t)op1 * op2) >> 32);
+}
+
+#endif /* !ARM_MATH_CM3 && !ARM_MATH_CM0_FAMILY */
+
 /*------------------ RealView Compiler -----------------*/
-#if   defined ( __CC_ARM )
+#elif defined ( __CC_ARM )
   #include "cmsis_armcc.h"
 
 /*------------------ ARM Compiler V6 -------------------*/
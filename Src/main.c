@@ -49,6 +49,13 @@
 #include "uart.h"
 #include "sdram.h"
 #include "bsp_qspi_n25q.h"
+#include "profile.h"
+#include "hrtimer.h"
+#include "sched.h"
+#include "spi_handle.h"
+#ifdef DSP_BENCH
+#include "dsp_bench.h"
+#endif
 /* USER CODE END Includes */
 
 /* Private variables ---------------------------------------------------------*/
@@ -90,7 +97,7 @@ int main(void)
   HAL_Init();
 
   /* USER CODE BEGIN Init */
-
+  prof_init();
   /* USER CODE END Init */
 
   /* Configure the system clock */
@@ -112,7 +119,13 @@ int main(void)
   MX_NVIC_Init();
 
   /* USER CODE BEGIN 2 */
-
+  hrtimer_init();
+  sched_init();
+  uart4_log_init();
+  spi2_isr_config();
+#ifdef DSP_BENCH
+  dsp_bench_run_all(PROF_OUT_UART4);
+#endif
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -122,7 +135,7 @@ int main(void)
   /* USER CODE END WHILE */
 
   /* USER CODE BEGIN 3 */
-
+    sched_run();
   }
   /* USER CODE END 3 */
 
@@ -49,14 +49,21 @@ QPP              
 
 #include "bsp_qspi_n25q.h"
 #include "quadspi.h"
+#include "profile.h"
+#include "delay.h"
 
 QSPI_Information  _QspiFlashInf;
 
+static PROF_SCOPE(s_prof_qspi_read,     "qspi_read");
+static PROF_SCOPE(s_prof_qspi_page,     "qspi_page_prog");
+static PROF_SCOPE(s_prof_qspi_erase4k,  "qspi_erase_4k");
+static PROF_SCOPE(s_prof_qspi_erase32k, "qspi_erase_32k");
+
 static uint8_t QSPI_WorkMode = N25Q_SPI_MODE;		//QSPIģʽ־:0,SPIģʽ;1,QPIģʽ.
 
 static QSPI_StaticTypeDef QSPI_WriteEnable(QSPI_HandleTypeDef *handle);
 //static QSPI_StaticTypeDef QSPI_WriteDisable(QSPI_HandleTypeDef *handle);
-static QSPI_StaticTypeDef QSPI_AutoPollingMemReady(QSPI_HandleTypeDef *handle);
+static QSPI_StaticTypeDef QSPI_AutoPollingMemReady(QSPI_HandleTypeDef *handle, uint32_t timeout);
 
 static QSPI_StaticTypeDef QSPI_EnterFourBytesAddress(QSPI_HandleTypeDef *hqspi);
 static QSPI_StaticTypeDef QSPI_Receive(uint8_t * _pBuf, uint32_t _NumByteToRead);
@@ -87,7 +94,6 @@ QSPI_StaticTypeDef QSPI_Read_SR(uint8_t ReadReg, uint8_t * RegValue, uint8_t Rea
 
 QSPI_StaticTypeDef QSPI_UserInit(void)
 {
-  uint32_t i;
   uint8_t  _RegVal;
   uint8_t  QspiID[3];
   __IO QSPI_StaticTypeDef  __QspiStatus = QSPI_OUT_TIME;
@@ -109,11 +115,7 @@ QSPI_StaticTypeDef QSPI_UserInit(void)
 	#endif
   
   // Ͻܵ ȴ tSHSL3 ʱ
-  i = 0x20000;
-  while(i --)
-  {
-		;
-  }
+  delay_us(QSPI_TSHSL3_TIME);
   
 	
   __QspiStatus = QSPI_Quad_Enter();
@@ -197,6 +199,7 @@ QSPI_StaticTypeDef QSPI_ReadBuff(uint8_t* data, uint32_t address, uint32_t size)
 {
   uint32_t  __InstructionMode, __AddressMode, __DataMode;
   uint8_t _RegVal = 0;
+  PROF_BEGIN(s_prof_qspi_read);
   
   if(QSPI_WorkMode)   // Work In QUAD Model
   {
@@ -230,6 +233,7 @@ QSPI_StaticTypeDef QSPI_ReadBuff(uint8_t* data, uint32_t address, uint32_t size)
   
   if(QSPI_Receive(  data,  size) != QSPI_OK)
     return  QSPI_ERROR;  
+  PROF_END(s_prof_qspi_read);
   return  QSPI_OK;
 
 }
@@ -333,7 +337,7 @@ QSPI_StaticTypeDef QSPI_Write_SR(uint8_t WriteReg, uint8_t  RegValue, uint8_t Wr
     return QSPI_ERROR;
   } 
 
-  if(QSPI_AutoPollingMemReady(&hqspi) != QSPI_OK)
+  if(QSPI_AutoPollingMemReady(&hqspi, QSPI_WRITE_REG_MAX_TIME) != QSPI_OK)
     return QSPI_ERROR;
   
   return QSPI_OK;
@@ -451,6 +455,7 @@ QSPI_StaticTypeDef QSPI_Quad_Enter(void)
 QSPI_StaticTypeDef QSPI_WritePageByte(uint8_t* _pBuf, uint32_t _uiWriteAddr, uint32_t _size)
 {
   uint32_t  __InstructionMode, __AddressMode, __DataMode;
+  PROF_BEGIN(s_prof_qspi_page);
   
 	if (QSPI_WriteEnable(&hqspi) != QSPI_OK)
 	{
@@ -495,9 +500,10 @@ QSPI_StaticTypeDef QSPI_WritePageByte(uint8_t* _pBuf, uint32_t _uiWriteAddr, uin
   }   
     
   // Configure automatic polling mode to wait for end of program ----- 
-  if(QSPI_AutoPollingMemReady(&hqspi) != QSPI_OK)
+  if(QSPI_AutoPollingMemReady(&hqspi, QSPI_PAGE_PROG_MAX_TIME) != QSPI_OK)
     return QSPI_ERROR;
   
+  PROF_END(s_prof_qspi_page);
   return QSPI_OK;
 }
 
@@ -687,6 +693,7 @@ QSPI_StaticTypeDef QSPI_EraseSector_4K(uint32_t Sector_address)
 {
   uint8_t _RegVal = 0;
   uint32_t  __InstructionMode, __AddressMode;
+  PROF_BEGIN(s_prof_qspi_erase4k);
   
 	if (QSPI_WriteEnable(&hqspi) != QSPI_OK)
 	{
@@ -721,9 +728,10 @@ QSPI_StaticTypeDef QSPI_EraseSector_4K(uint32_t Sector_address)
     return QSPI_ERROR;
   }   
  
-  if(QSPI_AutoPollingMemReady(&hqspi) != QSPI_OK)
+  if(QSPI_AutoPollingMemReady(&hqspi, QSPI_SUBSECTOR_ERASE_MAX_TIME) != QSPI_OK)
     return QSPI_ERROR;  
   
+  PROF_END(s_prof_qspi_erase4k);
   return QSPI_OK;  
 }
 
@@ -740,6 +748,7 @@ QSPI_StaticTypeDef QSPI_EraseSector_32K(uint32_t Sector_address)
 {
   uint8_t _RegVal = 0;
   uint32_t  __InstructionMode, __AddressMode;
+  PROF_BEGIN(s_prof_qspi_erase32k);
   
 	if (QSPI_WriteEnable(&hqspi) != QSPI_OK)
 	{
@@ -774,9 +783,10 @@ QSPI_StaticTypeDef QSPI_EraseSector_32K(uint32_t Sector_address)
   {
     return QSPI_ERROR;
   }   
-  if(QSPI_AutoPollingMemReady(&hqspi) != QSPI_OK)
+  if(QSPI_AutoPollingMemReady(&hqspi, QSPI_SECTOR_ERASE_MAX_TIME) != QSPI_OK)
     return QSPI_ERROR;  
   
+  PROF_END(s_prof_qspi_erase32k);
   return QSPI_OK;  
 }
 
@@ -824,7 +834,7 @@ QSPI_StaticTypeDef QSPI_EraseChip(void)
   }
   
   
-  if(QSPI_AutoPollingMemReady(&hqspi) != QSPI_OK)
+  if(QSPI_AutoPollingMemReady(&hqspi, QSPI_BULK_ERASE_MAX_TIME) != QSPI_OK)
     return QSPI_ERROR;  
   
   return QSPI_OK;  
@@ -987,7 +997,7 @@ QSPI_StaticTypeDef QSPI_ResetMemory(QSPI_HandleTypeDef *handle)
 	}
 
 	//Configure automatic polling mode to wait the memory is ready
-	if (QSPI_AutoPollingMemReady(handle) != QSPI_OK)
+	if (QSPI_AutoPollingMemReady(handle, QSPI_REG_READ_MAX_TIME) != QSPI_OK)
 	{
 		return QSPI_ERROR;
 	}
@@ -1035,7 +1045,7 @@ static QSPI_StaticTypeDef QSPI_EnterFourBytesAddress(QSPI_HandleTypeDef *hqspi)
 
   
   /* Configure automatic polling mode to wait the memory is ready */
-  if (QSPI_AutoPollingMemReady(hqspi) != QSPI_OK)
+  if (QSPI_AutoPollingMemReady(hqspi, QSPI_REG_READ_MAX_TIME) != QSPI_OK)
   {
     return QSPI_ERROR;
   }
@@ -1142,9 +1152,9 @@ A function to ready auto polling memory
 Return a integer value(default QSPI_OK), a parameter for QSPI handle, 
 a parameter for timeout(uint32_t).
 */
-static QSPI_StaticTypeDef QSPI_AutoPollingMemReady(QSPI_HandleTypeDef *handle)
+static QSPI_StaticTypeDef QSPI_AutoPollingMemReady(QSPI_HandleTypeDef *handle, uint32_t timeout)
 {
-  uint32_t cnt = 0;
+  uint32_t deadline = deadline_ms(timeout);
   uint8_t _RegVal;
 	
 	do
@@ -1154,9 +1164,10 @@ static QSPI_StaticTypeDef QSPI_AutoPollingMemReady(QSPI_HandleTypeDef *handle)
 		if((_RegVal & 0x01) == 0x00)
 			return QSPI_OK;
 		
-		cnt ++;
+		if(timeout >= QSPI_POLL_SLEEP_MIN_TIME)
+			delay_ms(1);       // long program/erase, sleep between status polls
 		
-	}while( cnt < QSPI_WAIT_MAX_TIME );  
+	}while( !deadline_expired_ms(deadline) );  
 
 	return QSPI_OUT_TIME;
 }
@@ -102,6 +102,10 @@ extern QSPI_Information  _QspiFlashInf;
 #define QSPI_BULK_ERASE_MAX_TIME					((uint32_t)250000)
 #define QSPI_SECTOR_ERASE_MAX_TIME		    ((uint32_t)3000)            // block
 #define QSPI_SUBSECTOR_ERASE_MAX_TIME	    ((uint32_t)800)             // sector
+#define QSPI_PAGE_PROG_MAX_TIME	          ((uint32_t)5)               // ms, page program
+#define QSPI_WRITE_REG_MAX_TIME	          ((uint32_t)10)              // ms, write status register
+#define QSPI_TSHSL3_TIME	                ((uint32_t)30)              // us, /CS high to next command
+#define QSPI_POLL_SLEEP_MIN_TIME	        ((uint32_t)100)             // waits this long (ms) or longer sleep between polls
 
 #define QSPI_WAIT_MAX_TIME	              ((uint32_t)0x3FFFFFF)
 #define QSPI_QUAD_ENTER_MAX_TIME	        QSPI_WAIT_MAX_TIME
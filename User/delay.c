@@ -1,16 +1,106 @@
 #include "delay.h"
-#include "stm32f7xx.h"
+#include "stm32f7xx_hal.h"
+#include "hrtimer.h"
 
-extern HAL_GetTick();
+#define DELAY_US_CHUNK   1000000u     //keeps us * cycles_per_us inside 32 bits
+#define DELAY_MS_CHUNK   1000000u     //keeps the hrtimer delay below 2^31 us
 
-void delay(uint32_t tick )
+uint32_t deadline_ms(uint32_t timeout_ms)
 {
-	uint32_t start_tick;
-	uint32_t end_tick;
-	start_tick=HAL_GetTick();
-	end_tick=start_tick+tick;
-	while(HAL_GetTick()<end_tick)
+	//+1: the current tick is already partly elapsed
+	return deadline_from(HAL_GetTick(), timeout_ms + 1u);
+}
+
+int deadline_expired_ms(uint32_t deadline)
+{
+	return deadline_passed(HAL_GetTick(), deadline);
+}
+
+uint32_t deadline_us(uint32_t timeout_us)
+{
+	return deadline_from(hrtimer_now(), timeout_us);
+}
+
+int deadline_expired_us(uint32_t deadline)
+{
+	return deadline_passed(hrtimer_now(), deadline);
+}
+
+void delay_us(uint32_t us)
+{
+	uint32_t start, cycles;
+
+	if(!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+	{
+		CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+		DWT->LAR = 0xC5ACCE55;
+		DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	}
+
+	while(us)
 	{
-		;
+		cycles = (us > DELAY_US_CHUNK ? DELAY_US_CHUNK : us);
+		us -= cycles;
+		cycles *= SystemCoreClock / 1000000u;
+		start = DWT->CYCCNT;
+		while(DWT->CYCCNT - start < cycles)
+		{
+			;
+		}
 	}
-}
\ No newline at end of file
+}
+
+static void delay_wakeup(hrtimer_t *t, void *arg)
+{
+	*(volatile uint8_t *)arg = 1;
+}
+
+static void delay_sleep_ms(uint32_t ms)
+{
+	hrtimer_t t;
+	volatile uint8_t done = 0;
+	uint32_t end;
+
+	if(hrtimer_running())
+	{
+		hrtimer_setup(&t, delay_wakeup, (void *)&done);
+		hrtimer_start(&t, ms * 1000u, 0);
+		while(!done)
+		{
+			__WFI();
+		}
+		return;
+	}
+
+	end = deadline_ms(ms);
+	while(!TIME_AFTER_EQ(HAL_GetTick(), end))
+	{
+		__WFI();
+	}
+}
+
+void delay_ms(uint32_t ms)
+{
+	uint32_t chunk;
+
+	while(ms)
+	{
+		chunk = (ms > DELAY_MS_CHUNK ? DELAY_MS_CHUNK : ms);
+		ms -= chunk;
+		if(__get_IPSR() == 0 && __get_PRIMASK() == 0)
+		{
+			delay_sleep_ms(chunk);
+		}
+		else
+		{
+			//no interrupt can wake us here, spin instead
+			while(chunk--)
+				delay_us(1000);
+		}
+	}
+}
+
+void delay(uint32_t tick)
+{
+	delay_ms(tick);
+}
@@ -3,7 +3,41 @@
 
 #include  <stdint.h>
 
+/*
+ * Timing helpers.
+ *
+ * delay_us()  busy waits on the DWT cycle counter, scaled by SystemCoreClock
+ * delay_ms()  sleeps in WFI until a TIM14 compare (hrtimer) wakes it, falls
+ *             back to the SysTick tick before hrtimer_init() and to delay_us()
+ *             when interrupts cannot be taken
+ *
+ * Time stamps are free running uint32_t counters, compare them with the
+ * wrap-safe macros below instead of '<'.
+ */
+
+#define TIME_AFTER(a, b)       ((int32_t)((uint32_t)(b) - (uint32_t)(a)) < 0)
+#define TIME_AFTER_EQ(a, b)    ((int32_t)((uint32_t)(a) - (uint32_t)(b)) >= 0)
+
+static __inline uint32_t deadline_from(uint32_t now, uint32_t timeout)
+{
+	return now + timeout;
+}
+
+static __inline int deadline_passed(uint32_t now, uint32_t deadline)
+{
+	return TIME_AFTER_EQ(now, deadline);
+}
+
+//deadlines on the 1 ms HAL tick, usable right after HAL_Init(), never shorter than asked
+uint32_t deadline_ms(uint32_t timeout_ms);
+int      deadline_expired_ms(uint32_t deadline);
+
+//deadlines on the 1 us hrtimer time base, need hrtimer_init()
+uint32_t deadline_us(uint32_t timeout_us);
+int      deadline_expired_us(uint32_t deadline);
+
+void delay_us(uint32_t us);
+void delay_ms(uint32_t ms);
 void delay(uint32_t tick);
 
 #endif
-
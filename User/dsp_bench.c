@@ -0,0 +1,2781 @@
+#include "dsp_bench.h"
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef HOST_BUILD
+#include "sdram.h"
+#endif
+
+/*
+ * Every memory region is split into four buffers:
+ *   a  source, in-place transforms, matrix A
+ *   b  destination, scalar results
+ *   c  coefficients, second operand, matrix B
+ *   d  filter state and scratch
+ */
+#define DSP_BENCH_A_OFS     0x0000u
+#define DSP_BENCH_B_OFS     0x4000u
+#define DSP_BENCH_C_OFS     0x8000u
+#define DSP_BENCH_D_OFS     0xA000u
+#define DSP_BENCH_A_SIZE    0x4000u
+#define DSP_BENCH_C_SIZE    0x2000u
+#define DSP_BENCH_D_SIZE    0x4000u
+#define DSP_BENCH_REGION    0xE000u
+
+#define DSP_BENCH_D_AUX1    0x2000u     //offsets inside d for tap delays and extra scratch
+#define DSP_BENCH_D_AUX2    0x2800u
+#define DSP_BENCH_D_AUX3    0x3000u
+#define DSP_BENCH_C_AUX     0x1000u     //second half of c: LMS reference, IIR lattice ladder
+
+#define DSP_BENCH_NAME_MAX  40          //longer kernel names are cut, the longest in the table has 37 characters
+
+//name, memory, cache, n, m and ticks, the two per sample/output columns, each with its separator, then "\r\n"
+#define DSP_BENCH_LINE_SIZE (DSP_BENCH_NAME_MAX + 6 + 5 + 3 * 11 + 2 * 14 + 3)
+
+#if defined(HOST_BUILD)
+static uint64_t s_bench_dtcm[DSP_BENCH_REGION / 8];
+static uint64_t s_bench_sram1[DSP_BENCH_REGION / 8];
+static uint64_t s_bench_sdram[DSP_BENCH_REGION / 8];
+#define DSP_BENCH_SDRAM_BASE    ((uint8_t *)s_bench_sdram)
+#elif defined(__CC_ARM)
+//upper half of DTCM and the top of SRAM1, reserved so the linker fails on an overlap
+static uint64_t s_bench_dtcm[DSP_BENCH_REGION / 8] __attribute__((at(0x20010000), zero_init));
+static uint64_t s_bench_sram1[DSP_BENCH_REGION / 8] __attribute__((at(0x20060000), zero_init));
+#define DSP_BENCH_SDRAM_BASE    ((uint8_t *)(Bank5_SDRAM_ADDR + 0x00100000u))
+#else
+static uint64_t s_bench_dtcm[DSP_BENCH_REGION / 8];
+static uint64_t s_bench_sram1[DSP_BENCH_REGION / 8];
+#define DSP_BENCH_SDRAM_BASE    ((uint8_t *)(Bank5_SDRAM_ADDR + 0x00100000u))
+#endif
+
+static const char *const s_bench_mem_name[DSP_BENCH_MEM_NUM] = { "dtcm", "sram1", "sdram" };
+
+enum
+{
+	SW_VEC = 0,     //n
+	SW_FIR,         //block n x taps m
+	SW_IIR,         //block n x stages m
+	SW_MC,          //block n x channels m, DSP_BENCH_MC_STAGES stages
+	SW_FFT,         //length n
+	SW_MAT,         //n x n
+	SW_SPM,         //n x n x percent of non-zero values m
+	SW_NUM
+};
+
+enum
+{
+	T_F32 = 0,
+	T_F64,
+	T_Q31,
+	T_Q15,
+	T_Q7
+};
+
+typedef struct
+{
+	arm_rfft_instance_f32        rfft;
+	arm_cfft_radix4_instance_f32 cfft;
+	arm_dct4_instance_f32        dct;
+} dsp_bench_dct4_f32_t;
+
+typedef struct
+{
+	arm_rfft_instance_q31        rfft;
+	arm_cfft_radix4_instance_q31 cfft;
+	arm_dct4_instance_q31        dct;
+} dsp_bench_dct4_q31_t;
+
+typedef struct
+{
+	arm_rfft_instance_q15        rfft;
+	arm_cfft_radix4_instance_q15 cfft;
+	arm_dct4_instance_q15        dct;
+} dsp_bench_dct4_q15_t;
+
+typedef union
+{
+	arm_fir_instance_f32                          fir_f32;
+	arm_fir_instance_f16_f32                      fir_f16;
+	arm_fir_instance_q31                          fir_q31;
+	arm_fir_instance_q15                          fir_q15;
+	arm_fir_instance_q7                           fir_q7;
+	arm_fir_decimate_instance_f32                 dec_f32;
+	arm_fir_decimate_instance_q31                 dec_q31;
+	arm_fir_decimate_instance_q15                 dec_q15;
+	arm_fir_interpolate_instance_f32              int_f32;
+	arm_fir_interpolate_instance_q31              int_q31;
+	arm_fir_interpolate_instance_q15              int_q15;
+	arm_fir_resample_instance_f32                 rs_f32;
+	arm_fir_fft_instance_f32                      ff_f32;
+	arm_fir_resample_instance_q31                 rs_q31;
+	arm_fir_resample_instance_q15                 rs_q15;
+	arm_cic_decimate_instance_q31                 cic_q31;
+	arm_fir_halfband_decimate_instance_q31        hb_q31;
+	arm_decimate_chain_instance_q31               dch_q31;
+	arm_fir_lattice_instance_f32                  fl_f32;
+	arm_fir_lattice_instance_q31                  fl_q31;
+	arm_fir_lattice_instance_q15                  fl_q15;
+	arm_fir_sparse_instance_f32                   sp_f32;
+	arm_fir_sparse_instance_q31                   sp_q31;
+	arm_fir_sparse_instance_q15                   sp_q15;
+	arm_fir_sparse_instance_q7                    sp_q7;
+	arm_iir_lattice_instance_f32                  il_f32;
+	arm_iir_lattice_instance_q31                  il_q31;
+	arm_iir_lattice_instance_q15                  il_q15;
+	arm_lms_instance_f32                          lms_f32;
+	arm_lms_instance_q31                          lms_q31;
+	arm_lms_instance_q15                          lms_q15;
+	arm_lms_norm_instance_f32                     nlms_f32;
+	arm_lms_fd_instance_f32                       lfd_f32;
+	arm_lms_norm_instance_q31                     nlms_q31;
+	arm_lms_norm_instance_q15                     nlms_q15;
+	arm_median_filter_instance_f32                med_f32;
+	arm_median_filter_instance_q31                med_q31;
+	arm_median_filter_instance_q15                med_q15;
+	arm_biquad_casd_df1_inst_f32                  df1_f32;
+	arm_biquad_casd_df1_inst_q31                  df1_q31;
+	arm_biquad_casd_df1_inst_q15                  df1_q15;
+	arm_biquad_cas_df1_32x64_ins_q31              df1_32x64;
+	arm_biquad_cascade_df2T_instance_f32          df2t_f32;
+	arm_biquad_cascade_df2T_instance_f64          df2t_f64;
+	arm_biquad_cascade_stereo_df2T_instance_f32   sdf2t_f32;
+	arm_biquad_cascade_mc_df2T_instance_f32       mdf2t_f32;
+	arm_biquad_casd_mc_df1_inst_q31               mdf1_q31;
+	arm_pid_instance_f32                          pid_f32;
+	arm_pid_instance_q31                          pid_q31;
+	arm_pid_instance_q15                          pid_q15;
+	arm_pid_batch_instance_f32                    pidb_f32;
+	arm_pid_batch_instance_q31                    pidb_q31;
+	arm_pid_batch_instance_q15                    pidb_q15;
+	arm_spline_instance_f32                       spl_f32;
+	arm_spline_instance_q31                       spl_q31;
+	const arm_cfft_instance_f32                  *cfft_f32;
+	const arm_cfft_instance_q31                  *cfft_q31;
+	const arm_cfft_instance_q15                  *cfft_q15;
+	arm_cfft_radix2_instance_f32                  r2_f32;
+	arm_cfft_radix2_instance_q31                  r2_q31;
+	arm_cfft_radix2_instance_q15                  r2_q15;
+	arm_cfft_radix4_instance_f32                  r4_f32;
+	arm_cfft_radix4_instance_q31                  r4_q31;
+	arm_cfft_radix4_instance_q15                  r4_q15;
+	struct { arm_rfft_instance_f32 rfft; arm_cfft_radix4_instance_f32 cfft; } rfft_f32;
+	arm_rfft_instance_q31                         rfft_q31;
+	arm_rfft_instance_q15                         rfft_q15;
+	arm_rfft_fast_instance_f32                    rfftf_f32;
+	arm_cfft_mixed_instance_f32                   cfftm_f32;
+	arm_rfft_mixed_instance_f32                   rfftm_f32;
+	arm_goertzel_instance_f32                     gz_f32;
+	arm_goertzel_instance_q31                     gz_q31;
+	arm_sdft_instance_f32                         sdft_f32;
+	arm_stft_instance_f32                         stft_f32;
+	arm_nn_conv_instance_q7                       nnc;
+	arm_nn_fc_instance_q7                         nnf;
+	arm_nn_pool_instance_q7                       nnp;
+	dsp_bench_dct4_f32_t                          dct4_f32;
+	dsp_bench_dct4_q31_t                          dct4_q31;
+	dsp_bench_dct4_q15_t                          dct4_q15;
+	struct { arm_matrix_instance_f32 a, c, b; }   mat_f32;
+	struct { arm_matrix_instance_f64 a, c, b; }   mat_f64;
+	struct { arm_matrix_instance_q31 a, c, b; }   mat_q31;
+	struct { arm_matrix_instance_q15 a, c, b; }   mat_q15;
+	arm_matrix_instance_f16                       mat_f16;
+	struct { arm_matrix_instance_f32 a, c, b; arm_matrix_csr_instance_f32 csr; arm_matrix_band_instance_f32 band; } spm_f32;
+	struct { arm_matrix_instance_q31 a, c, b; arm_matrix_csr_instance_q31 csr; arm_matrix_band_instance_q31 band; } spm_q31;
+	struct { arm_matrix_instance_q15 a, c, b; arm_matrix_csr_instance_q15 csr; arm_matrix_band_instance_q15 band; } spm_q15;
+} dsp_bench_inst_t;
+
+typedef struct
+{
+	uint8_t         *a;
+	uint8_t         *b;
+	uint8_t         *c;
+	uint8_t         *d;
+	uint32_t         n;
+	uint32_t         m;
+	uint32_t         samples;   //input samples consumed by one run
+	uint32_t         outputs;   //output values produced by one run
+	dsp_bench_inst_t inst;
+} dsp_bench_ctx_t;
+
+typedef struct
+{
+	const char *name;
+	uint8_t     sweep;
+	uint8_t     type;       //element type of a and c
+	int       (*setup)(dsp_bench_ctx_t *c);     //not timed, returns 0 when the point is not supported
+	void      (*run)(dsp_bench_ctx_t *c);
+} dsp_bench_kernel_t;
+
+#define F32(p)  ((float32_t *)(p))
+#define F64(p)  ((float64_t *)(p))
+#define Q31(p)  ((q31_t *)(p))
+#define Q15(p)  ((q15_t *)(p))
+#define Q7(p)   ((q7_t *)(p))
+#define F16(p)  ((float16_t *)(p))
+
+/* ---------------------------------------------------------------- setup */
+
+static int set_vec(dsp_bench_ctx_t *c)
+{
+	c->samples = c->n;
+	c->outputs = c->n;
+	return 1;
+}
+
+static int set_red(dsp_bench_ctx_t *c)
+{
+	c->samples = c->n;
+	c->outputs = 1;
+	return 1;
+}
+
+static int set_fir(dsp_bench_ctx_t *c)
+{
+	c->samples = c->n;
+	c->outputs = c->n;
+	return 1;
+}
+
+static int set_conv(dsp_bench_ctx_t *c)
+{
+	c->samples = c->n + c->m;
+	c->outputs = c->n + c->m - 1u;
+	return 1;
+}
+
+static int set_corr(dsp_bench_ctx_t *c)
+{
+	c->samples = c->n + c->m;
+	c->outputs = 2u * c->n - 1u;
+	return 1;
+}
+
+static int set_mat(dsp_bench_ctx_t *c)
+{
+	c->samples = c->n * c->n;
+	c->outputs = c->n * c->n;
+	return 1;
+}
+
+/* ---------------------------------------------------------- basic math */
+
+#define RUN_UNARY(fn, T) \
+	static void run_##fn(dsp_bench_ctx_t *c) { fn((T *)c->a, (T *)c->b, c->n); }
+#define RUN_BINARY(fn, T) \
+	static void run_##fn(dsp_bench_ctx_t *c) { fn((T *)c->a, (T *)c->c, (T *)c->b, c->n); }
+
+RUN_UNARY(arm_abs_f32, float32_t)
+RUN_UNARY(arm_abs_q31, q31_t)
+RUN_UNARY(arm_abs_q15, q15_t)
+RUN_UNARY(arm_abs_q7, q7_t)
+RUN_BINARY(arm_add_f32, float32_t)
+RUN_BINARY(arm_add_q31, q31_t)
+RUN_BINARY(arm_add_q15, q15_t)
+RUN_BINARY(arm_add_q7, q7_t)
+RUN_BINARY(arm_sub_f32, float32_t)
+RUN_BINARY(arm_sub_q31, q31_t)
+RUN_BINARY(arm_sub_q15, q15_t)
+RUN_BINARY(arm_sub_q7, q7_t)
+RUN_BINARY(arm_mult_f32, float32_t)
+RUN_BINARY(arm_mult_q31, q31_t)
+RUN_BINARY(arm_mult_q15, q15_t)
+RUN_BINARY(arm_mult_q7, q7_t)
+RUN_UNARY(arm_negate_f32, float32_t)
+RUN_UNARY(arm_negate_q31, q31_t)
+RUN_UNARY(arm_negate_q15, q15_t)
+RUN_UNARY(arm_negate_q7, q7_t)
+
+static void run_arm_dot_prod_f32(dsp_bench_ctx_t *c) { arm_dot_prod_f32(F32(c->a), F32(c->c), c->n, F32(c->b)); }
+static void run_arm_dot_prod_q31(dsp_bench_ctx_t *c) { arm_dot_prod_q31(Q31(c->a), Q31(c->c), c->n, (q63_t *)c->b); }
+static void run_arm_dot_prod_q15(dsp_bench_ctx_t *c) { arm_dot_prod_q15(Q15(c->a), Q15(c->c), c->n, (q63_t *)c->b); }
+static void run_arm_dot_prod_q7(dsp_bench_ctx_t *c)  { arm_dot_prod_q7(Q7(c->a), Q7(c->c), c->n, Q31(c->b)); }
+
+//half-precision operands: c converted to d + DSP_BENCH_D_AUX3, a to d + DSP_BENCH_D_AUX1
+static void set_f16(dsp_bench_ctx_t *c, uint32_t count)
+{
+	arm_float_to_f16(F32(c->c), F16(c->d + DSP_BENCH_D_AUX3), count);
+	arm_float_to_f16(F32(c->a), F16(c->d + DSP_BENCH_D_AUX1), count);
+}
+
+static int set_vec_f16(dsp_bench_ctx_t *c)
+{
+	set_f16(c, c->n);
+	return set_vec(c);
+}
+
+static int set_red_f16(dsp_bench_ctx_t *c)
+{
+	set_f16(c, c->n);
+	return set_red(c);
+}
+
+static void run_arm_dot_prod_f16(dsp_bench_ctx_t *c)
+{
+	arm_dot_prod_f16(F16(c->d + DSP_BENCH_D_AUX1), F16(c->d + DSP_BENCH_D_AUX3), c->n, F32(c->b));
+}
+
+static void run_arm_dot_prod_f16_f32(dsp_bench_ctx_t *c)
+{
+	arm_dot_prod_f16_f32(F16(c->d + DSP_BENCH_D_AUX3), F32(c->a), c->n, F32(c->b));
+}
+
+static void run_arm_mult_f16_f32(dsp_bench_ctx_t *c)
+{
+	arm_mult_f16_f32(F16(c->d + DSP_BENCH_D_AUX3), F32(c->a), F32(c->b), c->n);
+}
+static void run_arm_offset_f32(dsp_bench_ctx_t *c)   { arm_offset_f32(F32(c->a), 0.25f, F32(c->b), c->n); }
+static void run_arm_offset_q31(dsp_bench_ctx_t *c)   { arm_offset_q31(Q31(c->a), 0x20000000, Q31(c->b), c->n); }
+static void run_arm_offset_q15(dsp_bench_ctx_t *c)   { arm_offset_q15(Q15(c->a), 0x2000, Q15(c->b), c->n); }
+static void run_arm_offset_q7(dsp_bench_ctx_t *c)    { arm_offset_q7(Q7(c->a), 0x20, Q7(c->b), c->n); }
+static void run_arm_scale_f32(dsp_bench_ctx_t *c)    { arm_scale_f32(F32(c->a), 0.75f, F32(c->b), c->n); }
+static void run_arm_scale_q31(dsp_bench_ctx_t *c)    { arm_scale_q31(Q31(c->a), 0x60000000, 1, Q31(c->b), c->n); }
+static void run_arm_scale_q15(dsp_bench_ctx_t *c)    { arm_scale_q15(Q15(c->a), 0x6000, 1, Q15(c->b), c->n); }
+static void run_arm_scale_q7(dsp_bench_ctx_t *c)     { arm_scale_q7(Q7(c->a), 0x60, 1, Q7(c->b), c->n); }
+static void run_arm_shift_q31(dsp_bench_ctx_t *c)    { arm_shift_q31(Q31(c->a), 1, Q31(c->b), c->n); }
+static void run_arm_shift_q15(dsp_bench_ctx_t *c)    { arm_shift_q15(Q15(c->a), 1, Q15(c->b), c->n); }
+static void run_arm_shift_q7(dsp_bench_ctx_t *c)     { arm_shift_q7(Q7(c->a), 1, Q7(c->b), c->n); }
+
+/* -------------------------------------------------------- complex math */
+
+RUN_UNARY(arm_cmplx_conj_f32, float32_t)
+RUN_UNARY(arm_cmplx_conj_q31, q31_t)
+RUN_UNARY(arm_cmplx_conj_q15, q15_t)
+RUN_UNARY(arm_cmplx_mag_f32, float32_t)
+RUN_UNARY(arm_cmplx_mag_q31, q31_t)
+RUN_UNARY(arm_cmplx_mag_q15, q15_t)
+RUN_UNARY(arm_cmplx_mag_squared_f32, float32_t)
+RUN_UNARY(arm_cmplx_mag_squared_q31, q31_t)
+RUN_UNARY(arm_cmplx_mag_squared_q15, q15_t)
+RUN_BINARY(arm_cmplx_mult_cmplx_f32, float32_t)
+RUN_BINARY(arm_cmplx_mult_cmplx_q31, q31_t)
+RUN_BINARY(arm_cmplx_mult_cmplx_q15, q15_t)
+RUN_BINARY(arm_cmplx_mult_real_f32, float32_t)
+RUN_BINARY(arm_cmplx_mult_real_q31, q31_t)
+RUN_BINARY(arm_cmplx_mult_real_q15, q15_t)
+
+static void run_arm_cmplx_dot_prod_f32(dsp_bench_ctx_t *c)
+{
+	arm_cmplx_dot_prod_f32(F32(c->a), F32(c->c), c->n, F32(c->b), F32(c->b) + 1);
+}
+
+static void run_arm_cmplx_dot_prod_q31(dsp_bench_ctx_t *c)
+{
+	arm_cmplx_dot_prod_q31(Q31(c->a), Q31(c->c), c->n, (q63_t *)c->b, (q63_t *)c->b + 1);
+}
+
+static void run_arm_cmplx_dot_prod_q15(dsp_bench_ctx_t *c)
+{
+	arm_cmplx_dot_prod_q15(Q15(c->a), Q15(c->c), c->n, Q31(c->b), Q31(c->b) + 1);
+}
+
+/* ----------------------------------------------------------- fast math */
+
+static void run_arm_sin_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		F32(c->b)[i] = arm_sin_f32(F32(c->a)[i]);
+}
+
+static void run_arm_sin_q31(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		Q31(c->b)[i] = arm_sin_q31(Q31(c->a)[i] & 0x7FFFFFFF);
+}
+
+static void run_arm_sin_q15(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		Q15(c->b)[i] = arm_sin_q15(Q15(c->a)[i] & 0x7FFF);
+}
+
+static void run_arm_cos_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		F32(c->b)[i] = arm_cos_f32(F32(c->a)[i]);
+}
+
+static void run_arm_cos_q31(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		Q31(c->b)[i] = arm_cos_q31(Q31(c->a)[i] & 0x7FFFFFFF);
+}
+
+static void run_arm_cos_q15(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		Q15(c->b)[i] = arm_cos_q15(Q15(c->a)[i] & 0x7FFF);
+}
+
+static void run_arm_sqrt_q31(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		arm_sqrt_q31(Q31(c->a)[i] & 0x7FFFFFFF, Q31(c->b) + i);
+}
+
+static void run_arm_sqrt_q15(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		arm_sqrt_q15(Q15(c->a)[i] & 0x7FFF, Q15(c->b) + i);
+}
+
+//block kernels, the logarithms and square roots get positive inputs
+static int set_pos_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		F32(c->a)[i] = (F32(c->a)[i] < 0.0f ? -F32(c->a)[i] : F32(c->a)[i]) + 1e-3f;
+	return set_vec(c);
+}
+
+static int set_pos_q31(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		Q31(c->a)[i] = (Q31(c->a)[i] & 0x7FFFFFFF) | 1;
+	return set_vec(c);
+}
+
+static int set_pos_q15(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		Q15(c->a)[i] = (q15_t)((Q15(c->a)[i] & 0x7FFF) | 1);
+	return set_vec(c);
+}
+
+//negative inputs, so the exponentials do not take the saturation path
+static int set_neg_q31(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		Q31(c->a)[i] = (q31_t)(Q31(c->a)[i] | 0x80000000);
+	return set_vec(c);
+}
+
+static int set_neg_q15(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		Q15(c->a)[i] = (q15_t)(Q15(c->a)[i] | 0x8000);
+	return set_vec(c);
+}
+
+static void run_arm_vexp_f32(dsp_bench_ctx_t *c)     { arm_vexp_f32(F32(c->a), F32(c->b), c->n); }
+static void run_arm_vexp_q31(dsp_bench_ctx_t *c)     { arm_vexp_q31(Q31(c->a), Q31(c->b), c->n); }
+static void run_arm_vexp_q15(dsp_bench_ctx_t *c)     { arm_vexp_q15(Q15(c->a), Q15(c->b), c->n); }
+static void run_arm_vlog_f32(dsp_bench_ctx_t *c)     { arm_vlog_f32(F32(c->a), F32(c->b), c->n); }
+static void run_arm_vlog10_f32(dsp_bench_ctx_t *c)   { arm_vlog10_f32(F32(c->a), F32(c->b), c->n); }
+static void run_arm_vlog_q31(dsp_bench_ctx_t *c)     { arm_vlog_q31(Q31(c->a), Q31(c->b), c->n); }
+static void run_arm_vlog_q15(dsp_bench_ctx_t *c)     { arm_vlog_q15(Q15(c->a), Q15(c->b), c->n); }
+static void run_arm_vlog10_q15(dsp_bench_ctx_t *c)   { arm_vlog10_q15(Q15(c->a), Q15(c->b), c->n); }
+static void run_arm_vlog10_q31(dsp_bench_ctx_t *c)   { arm_vlog10_q31(Q31(c->a), Q31(c->b), c->n); }
+static void run_arm_vatan2_f32(dsp_bench_ctx_t *c)   { arm_vatan2_f32(F32(c->a), F32(c->c), F32(c->b), c->n); }
+static void run_arm_vatan2_q31(dsp_bench_ctx_t *c)   { arm_vatan2_q31(Q31(c->a), Q31(c->c), Q31(c->b), c->n); }
+static void run_arm_vatan2_q15(dsp_bench_ctx_t *c)   { arm_vatan2_q15(Q15(c->a), Q15(c->c), Q15(c->b), c->n); }
+static void run_arm_vtanh_f32(dsp_bench_ctx_t *c)    { arm_vtanh_f32(F32(c->a), F32(c->b), c->n); }
+static void run_arm_vtanh_q31(dsp_bench_ctx_t *c)    { arm_vtanh_q31(Q31(c->a), Q31(c->b), c->n); }
+static void run_arm_vtanh_q15(dsp_bench_ctx_t *c)    { arm_vtanh_q15(Q15(c->a), Q15(c->b), c->n); }
+static void run_arm_vsigmoid_f32(dsp_bench_ctx_t *c) { arm_vsigmoid_f32(F32(c->a), F32(c->b), c->n); }
+static void run_arm_vsigmoid_q31(dsp_bench_ctx_t *c) { arm_vsigmoid_q31(Q31(c->a), Q31(c->b), c->n); }
+static void run_arm_vsigmoid_q15(dsp_bench_ctx_t *c) { arm_vsigmoid_q15(Q15(c->a), Q15(c->b), c->n); }
+static void run_arm_vsqrt_f32(dsp_bench_ctx_t *c)    { arm_vsqrt_f32(F32(c->a), F32(c->b), c->n); }
+static void run_arm_vrsqrt_f32(dsp_bench_ctx_t *c)   { arm_vrsqrt_f32(F32(c->a), F32(c->b), c->n); }
+static void run_arm_vsqrt_q31(dsp_bench_ctx_t *c)    { arm_vsqrt_q31(Q31(c->a), Q31(c->b), c->n); }
+static void run_arm_vsqrt_q15(dsp_bench_ctx_t *c)    { arm_vsqrt_q15(Q15(c->a), Q15(c->b), c->n); }
+static void run_arm_vrsqrt_q15(dsp_bench_ctx_t *c)   { arm_vrsqrt_q15(Q15(c->a), Q15(c->b), (int16_t *)(c->c), c->n); }
+static void run_arm_vrsqrt_q31(dsp_bench_ctx_t *c)   { arm_vrsqrt_q31(Q31(c->a), Q31(c->b), (int16_t *)(c->c), c->n); }
+
+/* ---------------------------------------------------------- controller */
+
+static void run_arm_sin_cos_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		arm_sin_cos_f32(F32(c->a)[i] * 360.0f, F32(c->b) + 2u * i, F32(c->b) + 2u * i + 1u);
+}
+
+static void run_arm_sin_cos_q31(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		arm_sin_cos_q31(Q31(c->a)[i], Q31(c->b) + 2u * i, Q31(c->b) + 2u * i + 1u);
+}
+
+static int set_pid_f32(dsp_bench_ctx_t *c)
+{
+	c->inst.pid_f32.Kp = 0.5f;
+	c->inst.pid_f32.Ki = 0.1f;
+	c->inst.pid_f32.Kd = 0.01f;
+	arm_pid_init_f32(&c->inst.pid_f32, 1);
+	return set_vec(c);
+}
+
+static int set_pid_q31(dsp_bench_ctx_t *c)
+{
+	c->inst.pid_q31.Kp = 0x40000000;
+	c->inst.pid_q31.Ki = 0x0CCCCCCC;
+	c->inst.pid_q31.Kd = 0x0147AE14;
+	arm_pid_init_q31(&c->inst.pid_q31, 1);
+	return set_vec(c);
+}
+
+static int set_pid_q15(dsp_bench_ctx_t *c)
+{
+	c->inst.pid_q15.Kp = 0x4000;
+	c->inst.pid_q15.Ki = 0x0CCC;
+	c->inst.pid_q15.Kd = 0x0147;
+	arm_pid_init_q15(&c->inst.pid_q15, 1);
+	return set_vec(c);
+}
+
+//n loops per call, the same gains from c for Kp, Ki and Kd; derived gains and state in d
+static int set_pid_batch_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+
+	if(6u * c->n * sizeof(float32_t) > DSP_BENCH_D_SIZE)
+		return 0;
+	for(i = 0; i < c->n; i++)
+		F32(c->c)[i] = 0.1f;
+	arm_pid_batch_init_f32(&c->inst.pidb_f32, c->n, F32(c->c), F32(c->c), F32(c->c), F32(c->d), F32(c->d) + 3u * c->n, 0, 0);
+	return set_vec(c);
+}
+
+static int set_pid_batch_q31(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+
+	if(6u * c->n * sizeof(q31_t) > DSP_BENCH_D_SIZE)
+		return 0;
+	for(i = 0; i < c->n; i++)
+		Q31(c->c)[i] = 0x0CCCCCCC;
+	arm_pid_batch_init_q31(&c->inst.pidb_q31, c->n, Q31(c->c), Q31(c->c), Q31(c->c), Q31(c->d), Q31(c->d) + 3u * c->n, 0, 0);
+	return set_vec(c);
+}
+
+static int set_pid_batch_q15(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+
+	for(i = 0; i < c->n; i++)
+		Q15(c->c)[i] = 0x0CCC;
+	arm_pid_batch_init_q15(&c->inst.pidb_q15, c->n, Q15(c->c), Q15(c->c), Q15(c->c), Q15(c->d), Q15(c->d) + 3u * c->n, 0, 0);
+	return set_vec(c);
+}
+
+static void run_arm_pid_batch_f32(dsp_bench_ctx_t *c) { arm_pid_batch_f32(&c->inst.pidb_f32, F32(c->a), F32(c->b)); }
+static void run_arm_pid_batch_q31(dsp_bench_ctx_t *c) { arm_pid_batch_q31(&c->inst.pidb_q31, Q31(c->a), Q31(c->b)); }
+static void run_arm_pid_batch_q15(dsp_bench_ctx_t *c) { arm_pid_batch_q15(&c->inst.pidb_q15, Q15(c->a), Q15(c->b)); }
+
+static void run_arm_pid_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		F32(c->b)[i] = arm_pid_f32(&c->inst.pid_f32, F32(c->a)[i]);
+}
+
+static void run_arm_pid_q31(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		Q31(c->b)[i] = arm_pid_q31(&c->inst.pid_q31, Q31(c->a)[i]);
+}
+
+static void run_arm_pid_q15(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		Q15(c->b)[i] = arm_pid_q15(&c->inst.pid_q15, Q15(c->a)[i]);
+}
+
+static void run_arm_clarke_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		arm_clarke_f32(F32(c->a)[2u * i], F32(c->a)[2u * i + 1u], F32(c->b) + 2u * i, F32(c->b) + 2u * i + 1u);
+}
+
+static void run_arm_clarke_q31(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		arm_clarke_q31(Q31(c->a)[2u * i], Q31(c->a)[2u * i + 1u], Q31(c->b) + 2u * i, Q31(c->b) + 2u * i + 1u);
+}
+
+static void run_arm_inv_clarke_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		arm_inv_clarke_f32(F32(c->a)[2u * i], F32(c->a)[2u * i + 1u], F32(c->b) + 2u * i, F32(c->b) + 2u * i + 1u);
+}
+
+static void run_arm_inv_clarke_q31(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		arm_inv_clarke_q31(Q31(c->a)[2u * i], Q31(c->a)[2u * i + 1u], Q31(c->b) + 2u * i, Q31(c->b) + 2u * i + 1u);
+}
+
+//sin/cos pairs come from c
+static void run_arm_park_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		arm_park_f32(F32(c->a)[2u * i], F32(c->a)[2u * i + 1u], F32(c->b) + 2u * i, F32(c->b) + 2u * i + 1u,
+		             F32(c->c)[2u * i], F32(c->c)[2u * i + 1u]);
+}
+
+static void run_arm_park_q31(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		arm_park_q31(Q31(c->a)[2u * i], Q31(c->a)[2u * i + 1u], Q31(c->b) + 2u * i, Q31(c->b) + 2u * i + 1u,
+		             Q31(c->c)[2u * i], Q31(c->c)[2u * i + 1u]);
+}
+
+static void run_arm_inv_park_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		arm_inv_park_f32(F32(c->a)[2u * i], F32(c->a)[2u * i + 1u], F32(c->b) + 2u * i, F32(c->b) + 2u * i + 1u,
+		                 F32(c->c)[2u * i], F32(c->c)[2u * i + 1u]);
+}
+
+static void run_arm_inv_park_q31(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		arm_inv_park_q31(Q31(c->a)[2u * i], Q31(c->a)[2u * i + 1u], Q31(c->b) + 2u * i, Q31(c->b) + 2u * i + 1u,
+		                 Q31(c->c)[2u * i], Q31(c->c)[2u * i + 1u]);
+}
+
+//batch forms: the two inputs at a and a + n, outputs at b and b + n, sin and cos at c and c + n
+static void run_arm_clarke_batch_f32(dsp_bench_ctx_t *c)
+{
+	arm_clarke_batch_f32(F32(c->a), F32(c->a) + c->n, F32(c->b), F32(c->b) + c->n, c->n);
+}
+
+static void run_arm_clarke_batch_q31(dsp_bench_ctx_t *c)
+{
+	arm_clarke_batch_q31(Q31(c->a), Q31(c->a) + c->n, Q31(c->b), Q31(c->b) + c->n, c->n);
+}
+
+static void run_arm_inv_clarke_batch_f32(dsp_bench_ctx_t *c)
+{
+	arm_inv_clarke_batch_f32(F32(c->a), F32(c->a) + c->n, F32(c->b), F32(c->b) + c->n, c->n);
+}
+
+static void run_arm_inv_clarke_batch_q31(dsp_bench_ctx_t *c)
+{
+	arm_inv_clarke_batch_q31(Q31(c->a), Q31(c->a) + c->n, Q31(c->b), Q31(c->b) + c->n, c->n);
+}
+
+static void run_arm_park_batch_f32(dsp_bench_ctx_t *c)
+{
+	arm_park_batch_f32(F32(c->a), F32(c->a) + c->n, F32(c->b), F32(c->b) + c->n, F32(c->c), F32(c->c) + c->n, c->n);
+}
+
+static void run_arm_park_batch_q31(dsp_bench_ctx_t *c)
+{
+	arm_park_batch_q31(Q31(c->a), Q31(c->a) + c->n, Q31(c->b), Q31(c->b) + c->n, Q31(c->c), Q31(c->c) + c->n, c->n);
+}
+
+static void run_arm_inv_park_batch_f32(dsp_bench_ctx_t *c)
+{
+	arm_inv_park_batch_f32(F32(c->a), F32(c->a) + c->n, F32(c->b), F32(c->b) + c->n, F32(c->c), F32(c->c) + c->n, c->n);
+}
+
+static void run_arm_inv_park_batch_q31(dsp_bench_ctx_t *c)
+{
+	arm_inv_park_batch_q31(Q31(c->a), Q31(c->a) + c->n, Q31(c->b), Q31(c->b) + c->n, Q31(c->c), Q31(c->c) + c->n, c->n);
+}
+
+/* ---------------------------------------------------------- statistics */
+
+static void run_arm_max_f32(dsp_bench_ctx_t *c)   { arm_max_f32(F32(c->a), c->n, F32(c->b), (uint32_t *)c->b + 1); }
+static void run_arm_max_q31(dsp_bench_ctx_t *c)   { arm_max_q31(Q31(c->a), c->n, Q31(c->b), (uint32_t *)c->b + 1); }
+static void run_arm_max_q15(dsp_bench_ctx_t *c)   { arm_max_q15(Q15(c->a), c->n, Q15(c->b), (uint32_t *)c->b + 1); }
+static void run_arm_max_q7(dsp_bench_ctx_t *c)    { arm_max_q7(Q7(c->a), c->n, Q7(c->b), (uint32_t *)c->b + 1); }
+static void run_arm_min_f32(dsp_bench_ctx_t *c)   { arm_min_f32(F32(c->a), c->n, F32(c->b), (uint32_t *)c->b + 1); }
+static void run_arm_min_q31(dsp_bench_ctx_t *c)   { arm_min_q31(Q31(c->a), c->n, Q31(c->b), (uint32_t *)c->b + 1); }
+static void run_arm_min_q15(dsp_bench_ctx_t *c)   { arm_min_q15(Q15(c->a), c->n, Q15(c->b), (uint32_t *)c->b + 1); }
+static void run_arm_min_q7(dsp_bench_ctx_t *c)    { arm_min_q7(Q7(c->a), c->n, Q7(c->b), (uint32_t *)c->b + 1); }
+static void run_arm_mean_f32(dsp_bench_ctx_t *c)  { arm_mean_f32(F32(c->a), c->n, F32(c->b)); }
+static void run_arm_mean_q31(dsp_bench_ctx_t *c)  { arm_mean_q31(Q31(c->a), c->n, Q31(c->b)); }
+static void run_arm_mean_q15(dsp_bench_ctx_t *c)  { arm_mean_q15(Q15(c->a), c->n, Q15(c->b)); }
+static void run_arm_mean_q7(dsp_bench_ctx_t *c)   { arm_mean_q7(Q7(c->a), c->n, Q7(c->b)); }
+static void run_arm_power_f32(dsp_bench_ctx_t *c) { arm_power_f32(F32(c->a), c->n, F32(c->b)); }
+static void run_arm_power_q31(dsp_bench_ctx_t *c) { arm_power_q31(Q31(c->a), c->n, (q63_t *)c->b); }
+static void run_arm_power_q15(dsp_bench_ctx_t *c) { arm_power_q15(Q15(c->a), c->n, (q63_t *)c->b); }
+static void run_arm_power_q7(dsp_bench_ctx_t *c)  { arm_power_q7(Q7(c->a), c->n, Q31(c->b)); }
+static void run_arm_rms_f32(dsp_bench_ctx_t *c)   { arm_rms_f32(F32(c->a), c->n, F32(c->b)); }
+static void run_arm_rms_q31(dsp_bench_ctx_t *c)   { arm_rms_q31(Q31(c->a), c->n, Q31(c->b)); }
+static void run_arm_rms_q15(dsp_bench_ctx_t *c)   { arm_rms_q15(Q15(c->a), c->n, Q15(c->b)); }
+static void run_arm_std_f32(dsp_bench_ctx_t *c)   { arm_std_f32(F32(c->a), c->n, F32(c->b)); }
+static void run_arm_std_q31(dsp_bench_ctx_t *c)   { arm_std_q31(Q31(c->a), c->n, Q31(c->b)); }
+static void run_arm_std_q15(dsp_bench_ctx_t *c)   { arm_std_q15(Q15(c->a), c->n, Q15(c->b)); }
+static void run_arm_var_f32(dsp_bench_ctx_t *c)   { arm_var_f32(F32(c->a), c->n, F32(c->b)); }
+static void run_arm_var_q31(dsp_bench_ctx_t *c)   { arm_var_q31(Q31(c->a), c->n, Q31(c->b)); }
+static void run_arm_var_q15(dsp_bench_ctx_t *c)   { arm_var_q15(Q15(c->a), c->n, Q15(c->b)); }
+
+//median of n values, reordered in c
+static void run_arm_percentile_f32(dsp_bench_ctx_t *c) { arm_percentile_f32(F32(c->a), c->n, c->n / 2u, F32(c->c), F32(c->b)); }
+static void run_arm_percentile_q31(dsp_bench_ctx_t *c) { arm_percentile_q31(Q31(c->a), c->n, c->n / 2u, Q31(c->c), Q31(c->b)); }
+static void run_arm_percentile_q15(dsp_bench_ctx_t *c) { arm_percentile_q15(Q15(c->a), c->n, c->n / 2u, Q15(c->c), Q15(c->b)); }
+
+//sliding median over a window of m samples, the window and the heap indexes in d
+static int set_med_f32(dsp_bench_ctx_t *c)
+{
+	arm_median_filter_init_f32(&c->inst.med_f32, c->m, c->m / 2u, F32(c->d), (int16_t *)(F32(c->d) + c->m));
+	return set_fir(c);
+}
+
+static int set_med_q31(dsp_bench_ctx_t *c)
+{
+	arm_median_filter_init_q31(&c->inst.med_q31, c->m, c->m / 2u, Q31(c->d), (int16_t *)(Q31(c->d) + c->m));
+	return set_fir(c);
+}
+
+static int set_med_q15(dsp_bench_ctx_t *c)
+{
+	arm_median_filter_init_q15(&c->inst.med_q15, c->m, c->m / 2u, Q15(c->d), (int16_t *)(Q15(c->d) + c->m));
+	return set_fir(c);
+}
+
+static void run_arm_median_filter_f32(dsp_bench_ctx_t *c) { arm_median_filter_f32(&c->inst.med_f32, F32(c->a), F32(c->b), c->n); }
+static void run_arm_median_filter_q31(dsp_bench_ctx_t *c) { arm_median_filter_q31(&c->inst.med_q31, Q31(c->a), Q31(c->b), c->n); }
+static void run_arm_median_filter_q15(dsp_bench_ctx_t *c) { arm_median_filter_q15(&c->inst.med_q15, Q15(c->a), Q15(c->b), c->n); }
+
+//baseline for the median filters: the window of m samples in d is shifted and copied after it, then sorted for every output
+static int dsp_bench_cmp_f32(const void *x, const void *y)
+{
+	float32_t a = *(const float32_t *)x, b = *(const float32_t *)y;
+
+	return (a > b) - (a < b);
+}
+
+static int set_med_qsort_f32(dsp_bench_ctx_t *c)
+{
+	memset(F32(c->d), 0, c->m * sizeof(float32_t));
+	return set_fir(c);
+}
+
+static void run_median_qsort_f32(dsp_bench_ctx_t *c)
+{
+	float32_t *win = F32(c->d), *sorted = F32(c->d) + c->m;
+	uint32_t i;
+
+	for(i = 0; i < c->n; i++)
+	{
+		memmove(win, win + 1, (c->m - 1u) * sizeof(float32_t));
+		win[c->m - 1u] = F32(c->a)[i];
+		memcpy(sorted, win, c->m * sizeof(float32_t));
+		qsort(sorted, c->m, sizeof(float32_t), dsp_bench_cmp_f32);
+		F32(c->b)[i] = sorted[c->m / 2u];
+	}
+}
+
+/* ------------------------------------------------------------- support */
+
+RUN_UNARY(arm_copy_f32, float32_t)
+RUN_UNARY(arm_copy_q31, q31_t)
+RUN_UNARY(arm_copy_q15, q15_t)
+RUN_UNARY(arm_copy_q7, q7_t)
+
+static void run_arm_fill_f32(dsp_bench_ctx_t *c)      { arm_fill_f32(0.5f, F32(c->b), c->n); }
+static void run_arm_fill_q31(dsp_bench_ctx_t *c)      { arm_fill_q31(0x40000000, Q31(c->b), c->n); }
+static void run_arm_fill_q15(dsp_bench_ctx_t *c)      { arm_fill_q15(0x4000, Q15(c->b), c->n); }
+static void run_arm_fill_q7(dsp_bench_ctx_t *c)       { arm_fill_q7(0x40, Q7(c->b), c->n); }
+static void run_arm_float_to_q31(dsp_bench_ctx_t *c)  { arm_float_to_q31(F32(c->a), Q31(c->b), c->n); }
+static void run_arm_float_to_q15(dsp_bench_ctx_t *c)  { arm_float_to_q15(F32(c->a), Q15(c->b), c->n); }
+static void run_arm_float_to_q7(dsp_bench_ctx_t *c)   { arm_float_to_q7(F32(c->a), Q7(c->b), c->n); }
+static void run_arm_q31_to_float(dsp_bench_ctx_t *c)  { arm_q31_to_float(Q31(c->a), F32(c->b), c->n); }
+static void run_arm_q31_to_q15(dsp_bench_ctx_t *c)    { arm_q31_to_q15(Q31(c->a), Q15(c->b), c->n); }
+static void run_arm_q31_to_q7(dsp_bench_ctx_t *c)     { arm_q31_to_q7(Q31(c->a), Q7(c->b), c->n); }
+static void run_arm_q15_to_float(dsp_bench_ctx_t *c)  { arm_q15_to_float(Q15(c->a), F32(c->b), c->n); }
+static void run_arm_q15_to_q31(dsp_bench_ctx_t *c)    { arm_q15_to_q31(Q15(c->a), Q31(c->b), c->n); }
+static void run_arm_q15_to_q7(dsp_bench_ctx_t *c)     { arm_q15_to_q7(Q15(c->a), Q7(c->b), c->n); }
+static void run_arm_q7_to_float(dsp_bench_ctx_t *c)   { arm_q7_to_float(Q7(c->a), F32(c->b), c->n); }
+static void run_arm_q7_to_q31(dsp_bench_ctx_t *c)     { arm_q7_to_q31(Q7(c->a), Q31(c->b), c->n); }
+static void run_arm_q7_to_q15(dsp_bench_ctx_t *c)     { arm_q7_to_q15(Q7(c->a), Q15(c->b), c->n); }
+static void run_arm_float_to_f16(dsp_bench_ctx_t *c)  { arm_float_to_f16(F32(c->a), F16(c->b), c->n); }
+static void run_arm_f16_to_float(dsp_bench_ctx_t *c)  { arm_f16_to_float(F16(c->d + DSP_BENCH_D_AUX3), F32(c->b), c->n); }
+
+/* ------------------------------------------------------- interpolation */
+
+//block n x knots m on a uniform grid over the input range, values from c, coefficients in d
+static int set_spline_f32(dsp_bench_ctx_t *c)
+{
+	if(arm_spline_init_f32(&c->inst.spl_f32, 0, -1.0f, 2.0f / (float32_t)(c->m - 1u), F32(c->c), c->m, 0,
+	                       F32(c->d)) != ARM_MATH_SUCCESS)
+		return 0;
+	return set_fir(c);
+}
+
+static int set_spline_q31(dsp_bench_ctx_t *c)
+{
+	uint8_t l2 = 31;
+
+	while(((uint64_t)(c->m - 1u) << l2) > 0xFFFFFFFFu)
+		l2--;
+	if(arm_spline_init_q31(&c->inst.spl_q31, 0, INT32_MIN, l2, Q31(c->c), c->m, 0, Q31(c->d)) != ARM_MATH_SUCCESS)
+		return 0;
+	return set_fir(c);
+}
+
+static void run_arm_spline_f32(dsp_bench_ctx_t *c) { arm_spline_f32(&c->inst.spl_f32, F32(c->a), F32(c->b), c->n); }
+static void run_arm_spline_q31(dsp_bench_ctx_t *c) { arm_spline_q31(&c->inst.spl_q31, Q31(c->a), Q31(c->b), c->n); }
+
+/* ----------------------------------------------------------------- FIR */
+
+static int set_fir_f32(dsp_bench_ctx_t *c)
+{
+	arm_fir_init_f32(&c->inst.fir_f32, c->m, F32(c->c), F32(c->d), c->n);
+	return set_fir(c);
+}
+
+//partitions of the block size, the state in d
+static int set_fir_fft_f32(dsp_bench_ctx_t *c)
+{
+	if(arm_fir_fft_init_f32(&c->inst.ff_f32, c->m, F32(c->c), F32(c->d), DSP_BENCH_D_SIZE / sizeof(float32_t),
+	                        c->n, c->n) != ARM_MATH_SUCCESS)
+		return 0;
+	return set_fir(c);
+}
+
+//coefficients converted to d + DSP_BENCH_D_AUX3
+static int set_fir_f16_f32(dsp_bench_ctx_t *c)
+{
+	set_f16(c, c->m);
+	arm_fir_init_f16_f32(&c->inst.fir_f16, c->m, F16(c->d + DSP_BENCH_D_AUX3), F32(c->d), c->n);
+	return set_fir(c);
+}
+
+static int set_fir_q31(dsp_bench_ctx_t *c)
+{
+	arm_fir_init_q31(&c->inst.fir_q31, c->m, Q31(c->c), Q31(c->d), c->n);
+	return set_fir(c);
+}
+
+static int set_fir_q15(dsp_bench_ctx_t *c)
+{
+	if(arm_fir_init_q15(&c->inst.fir_q15, c->m, Q15(c->c), Q15(c->d), c->n) != ARM_MATH_SUCCESS)
+		return 0;
+	return set_fir(c);
+}
+
+static int set_fir_q7(dsp_bench_ctx_t *c)
+{
+	arm_fir_init_q7(&c->inst.fir_q7, c->m, Q7(c->c), Q7(c->d), c->n);
+	return set_fir(c);
+}
+
+static void run_arm_fir_f32(dsp_bench_ctx_t *c)      { arm_fir_f32(&c->inst.fir_f32, F32(c->a), F32(c->b), c->n); }
+static void run_arm_fir_fft_f32(dsp_bench_ctx_t *c)  { arm_fir_fft_f32(&c->inst.ff_f32, F32(c->a), F32(c->b), c->n); }
+static void run_arm_fir_f16_f32(dsp_bench_ctx_t *c)  { arm_fir_f16_f32(&c->inst.fir_f16, F32(c->a), F32(c->b), c->n); }
+static void run_arm_fir_q31(dsp_bench_ctx_t *c)      { arm_fir_q31(&c->inst.fir_q31, Q31(c->a), Q31(c->b), c->n); }
+static void run_arm_fir_fast_q31(dsp_bench_ctx_t *c) { arm_fir_fast_q31(&c->inst.fir_q31, Q31(c->a), Q31(c->b), c->n); }
+static void run_arm_fir_q15(dsp_bench_ctx_t *c)      { arm_fir_q15(&c->inst.fir_q15, Q15(c->a), Q15(c->b), c->n); }
+static void run_arm_fir_fast_q15(dsp_bench_ctx_t *c) { arm_fir_fast_q15(&c->inst.fir_q15, Q15(c->a), Q15(c->b), c->n); }
+static void run_arm_fir_q7(dsp_bench_ctx_t *c)       { arm_fir_q7(&c->inst.fir_q7, Q7(c->a), Q7(c->b), c->n); }
+
+//decimate by 4, interpolate by 4
+#define DSP_BENCH_RATE  4u
+
+static int set_dec(dsp_bench_ctx_t *c, arm_status st)
+{
+	if(st != ARM_MATH_SUCCESS)
+		return 0;
+	c->samples = c->n;
+	c->outputs = c->n / DSP_BENCH_RATE;
+	return 1;
+}
+
+static int set_dec_f32(dsp_bench_ctx_t *c)
+{
+	return set_dec(c, arm_fir_decimate_init_f32(&c->inst.dec_f32, c->m, DSP_BENCH_RATE, F32(c->c), F32(c->d), c->n));
+}
+
+static int set_dec_q31(dsp_bench_ctx_t *c)
+{
+	return set_dec(c, arm_fir_decimate_init_q31(&c->inst.dec_q31, c->m, DSP_BENCH_RATE, Q31(c->c), Q31(c->d), c->n));
+}
+
+static int set_dec_q15(dsp_bench_ctx_t *c)
+{
+	return set_dec(c, arm_fir_decimate_init_q15(&c->inst.dec_q15, c->m, DSP_BENCH_RATE, Q15(c->c), Q15(c->d), c->n));
+}
+
+static void run_arm_fir_decimate_f32(dsp_bench_ctx_t *c)
+{
+	arm_fir_decimate_f32(&c->inst.dec_f32, F32(c->a), F32(c->b), c->n);
+}
+
+static void run_arm_fir_decimate_q31(dsp_bench_ctx_t *c)
+{
+	arm_fir_decimate_q31(&c->inst.dec_q31, Q31(c->a), Q31(c->b), c->n);
+}
+
+static void run_arm_fir_decimate_fast_q31(dsp_bench_ctx_t *c)
+{
+	arm_fir_decimate_fast_q31(&c->inst.dec_q31, Q31(c->a), Q31(c->b), c->n);
+}
+
+static void run_arm_fir_decimate_q15(dsp_bench_ctx_t *c)
+{
+	arm_fir_decimate_q15(&c->inst.dec_q15, Q15(c->a), Q15(c->b), c->n);
+}
+
+static void run_arm_fir_decimate_fast_q15(dsp_bench_ctx_t *c)
+{
+	arm_fir_decimate_fast_q15(&c->inst.dec_q15, Q15(c->a), Q15(c->b), c->n);
+}
+
+static int set_int(dsp_bench_ctx_t *c, arm_status st)
+{
+	if(st != ARM_MATH_SUCCESS)
+		return 0;
+	c->samples = c->n;
+	c->outputs = c->n * DSP_BENCH_RATE;
+	return 1;
+}
+
+static int set_int_f32(dsp_bench_ctx_t *c)
+{
+	return set_int(c, arm_fir_interpolate_init_f32(&c->inst.int_f32, DSP_BENCH_RATE, c->m, F32(c->c), F32(c->d), c->n));
+}
+
+static int set_int_q31(dsp_bench_ctx_t *c)
+{
+	return set_int(c, arm_fir_interpolate_init_q31(&c->inst.int_q31, DSP_BENCH_RATE, c->m, Q31(c->c), Q31(c->d), c->n));
+}
+
+static int set_int_q15(dsp_bench_ctx_t *c)
+{
+	return set_int(c, arm_fir_interpolate_init_q15(&c->inst.int_q15, DSP_BENCH_RATE, c->m, Q15(c->c), Q15(c->d), c->n));
+}
+
+static void run_arm_fir_interpolate_f32(dsp_bench_ctx_t *c)
+{
+	arm_fir_interpolate_f32(&c->inst.int_f32, F32(c->a), F32(c->b), c->n);
+}
+
+static void run_arm_fir_interpolate_q31(dsp_bench_ctx_t *c)
+{
+	arm_fir_interpolate_q31(&c->inst.int_q31, Q31(c->a), Q31(c->b), c->n);
+}
+
+static void run_arm_fir_interpolate_q15(dsp_bench_ctx_t *c)
+{
+	arm_fir_interpolate_q15(&c->inst.int_q15, Q15(c->a), Q15(c->b), c->n);
+}
+
+//resample by 2/3, the first output is at the first input
+#define DSP_BENCH_RS_L  2u
+#define DSP_BENCH_RS_M  3u
+
+static int set_rs(dsp_bench_ctx_t *c, arm_status st)
+{
+	if(st != ARM_MATH_SUCCESS)
+		return 0;
+	c->samples = c->n;
+	c->outputs = (c->n * DSP_BENCH_RS_L + DSP_BENCH_RS_M - 1u) / DSP_BENCH_RS_M;
+	return 1;
+}
+
+static int set_rs_f32(dsp_bench_ctx_t *c)
+{
+	return set_rs(c, arm_fir_resample_init_f32(&c->inst.rs_f32, DSP_BENCH_RS_L, DSP_BENCH_RS_M, c->m, F32(c->c), F32(c->d), c->n));
+}
+
+static int set_rs_q31(dsp_bench_ctx_t *c)
+{
+	return set_rs(c, arm_fir_resample_init_q31(&c->inst.rs_q31, DSP_BENCH_RS_L, DSP_BENCH_RS_M, c->m, Q31(c->c), Q31(c->d), c->n));
+}
+
+static int set_rs_q15(dsp_bench_ctx_t *c)
+{
+	return set_rs(c, arm_fir_resample_init_q15(&c->inst.rs_q15, DSP_BENCH_RS_L, DSP_BENCH_RS_M, c->m, Q15(c->c), Q15(c->d), c->n));
+}
+
+static void run_arm_fir_resample_f32(dsp_bench_ctx_t *c)
+{
+	arm_fir_resample_f32(&c->inst.rs_f32, F32(c->a), F32(c->b), c->n);
+}
+
+static void run_arm_fir_resample_q31(dsp_bench_ctx_t *c)
+{
+	arm_fir_resample_q31(&c->inst.rs_q31, Q31(c->a), Q31(c->b), c->n);
+}
+
+static void run_arm_fir_resample_q15(dsp_bench_ctx_t *c)
+{
+	arm_fir_resample_q15(&c->inst.rs_q15, Q15(c->a), Q15(c->b), c->n);
+}
+
+//CIC and decimation chain decimate by m, 4 CIC stages; the half-band filter has about m taps
+#define DSP_BENCH_CIC_STAGES    4u
+
+static int set_cic_q31(dsp_bench_ctx_t *c)
+{
+	if(c->n % c->m != 0u ||
+	   arm_cic_decimate_init_q31(&c->inst.cic_q31, DSP_BENCH_CIC_STAGES, c->m, 1u, (q63_t *)c->d) != ARM_MATH_SUCCESS)
+		return 0;
+	c->samples = c->n;
+	c->outputs = c->n / c->m;
+	return 1;
+}
+
+static int set_hb_q31(dsp_bench_ctx_t *c)
+{
+	if(arm_fir_halfband_decimate_init_q31(&c->inst.hb_q31, (c->m + 2u) / 4u, Q31(c->c), Q31(c->d), c->n) != ARM_MATH_SUCCESS)
+		return 0;
+	c->samples = c->n;
+	c->outputs = c->n / 2u;
+	return 1;
+}
+
+//passband 0.4 of the output rate, 80 dB; coefficients designed into c, CIC state at d + DSP_BENCH_D_AUX3
+static int set_dch_q31(dsp_bench_ctx_t *c)
+{
+	arm_decimate_chain_plan_q31 plan;
+
+	if(arm_decimate_chain_design_q31(&plan, c->m, DSP_BENCH_CIC_STAGES, 0.4f, 80.0f, c->n) != ARM_MATH_SUCCESS ||
+	   plan.numCoeffs * sizeof(q31_t) > DSP_BENCH_C_SIZE ||
+	   plan.stateLength * sizeof(q31_t) > DSP_BENCH_D_AUX3 ||
+	   arm_decimate_chain_init_q31(&c->inst.dch_q31, &plan, Q31(c->c), (q63_t *)(c->d + DSP_BENCH_D_AUX3),
+	                               Q31(c->d)) != ARM_MATH_SUCCESS)
+		return 0;
+	c->samples = c->n;
+	c->outputs = c->n / c->m;
+	return 1;
+}
+
+static void run_arm_cic_decimate_q31(dsp_bench_ctx_t *c)
+{
+	arm_cic_decimate_q31(&c->inst.cic_q31, Q31(c->a), Q31(c->b), c->n);
+}
+
+static void run_arm_cic_decimate_fast_q31(dsp_bench_ctx_t *c)
+{
+	arm_cic_decimate_fast_q31(&c->inst.cic_q31, Q31(c->a), Q31(c->b), c->n);
+}
+
+static void run_arm_fir_halfband_decimate_q31(dsp_bench_ctx_t *c)
+{
+	arm_fir_halfband_decimate_q31(&c->inst.hb_q31, Q31(c->a), Q31(c->b), c->n);
+}
+
+static void run_arm_decimate_chain_q31(dsp_bench_ctx_t *c)
+{
+	arm_decimate_chain_q31(&c->inst.dch_q31, Q31(c->a), Q31(c->b), c->n);
+}
+
+static int set_fl_f32(dsp_bench_ctx_t *c)
+{
+	arm_fir_lattice_init_f32(&c->inst.fl_f32, c->m, F32(c->c), F32(c->d));
+	return set_fir(c);
+}
+
+static int set_fl_q31(dsp_bench_ctx_t *c)
+{
+	arm_fir_lattice_init_q31(&c->inst.fl_q31, c->m, Q31(c->c), Q31(c->d));
+	return set_fir(c);
+}
+
+static int set_fl_q15(dsp_bench_ctx_t *c)
+{
+	arm_fir_lattice_init_q15(&c->inst.fl_q15, c->m, Q15(c->c), Q15(c->d));
+	return set_fir(c);
+}
+
+static void run_arm_fir_lattice_f32(dsp_bench_ctx_t *c) { arm_fir_lattice_f32(&c->inst.fl_f32, F32(c->a), F32(c->b), c->n); }
+static void run_arm_fir_lattice_q31(dsp_bench_ctx_t *c) { arm_fir_lattice_q31(&c->inst.fl_q31, Q31(c->a), Q31(c->b), c->n); }
+static void run_arm_fir_lattice_q15(dsp_bench_ctx_t *c) { arm_fir_lattice_q15(&c->inst.fl_q15, Q15(c->a), Q15(c->b), c->n); }
+
+//taps at every other delay, tap delays live in d after the state
+static uint16_t set_sparse_delays(dsp_bench_ctx_t *c)
+{
+	int32_t *delay = (int32_t *)(c->d + DSP_BENCH_D_AUX1);
+	uint32_t i;
+
+	for(i = 0; i < c->m; i++)
+		delay[i] = (int32_t)(2u * i);
+	return (uint16_t)(2u * (c->m - 1u));
+}
+
+static int set_sp_f32(dsp_bench_ctx_t *c)
+{
+	uint16_t max_delay = set_sparse_delays(c);
+	arm_fir_sparse_init_f32(&c->inst.sp_f32, c->m, F32(c->c), F32(c->d), (int32_t *)(c->d + DSP_BENCH_D_AUX1), max_delay, c->n);
+	return set_fir(c);
+}
+
+static int set_sp_q31(dsp_bench_ctx_t *c)
+{
+	uint16_t max_delay = set_sparse_delays(c);
+	arm_fir_sparse_init_q31(&c->inst.sp_q31, c->m, Q31(c->c), Q31(c->d), (int32_t *)(c->d + DSP_BENCH_D_AUX1), max_delay, c->n);
+	return set_fir(c);
+}
+
+static int set_sp_q15(dsp_bench_ctx_t *c)
+{
+	uint16_t max_delay = set_sparse_delays(c);
+	arm_fir_sparse_init_q15(&c->inst.sp_q15, c->m, Q15(c->c), Q15(c->d), (int32_t *)(c->d + DSP_BENCH_D_AUX1), max_delay, c->n);
+	return set_fir(c);
+}
+
+static int set_sp_q7(dsp_bench_ctx_t *c)
+{
+	uint16_t max_delay = set_sparse_delays(c);
+	arm_fir_sparse_init_q7(&c->inst.sp_q7, c->m, Q7(c->c), Q7(c->d), (int32_t *)(c->d + DSP_BENCH_D_AUX1), max_delay, c->n);
+	return set_fir(c);
+}
+
+static void run_arm_fir_sparse_f32(dsp_bench_ctx_t *c)
+{
+	arm_fir_sparse_f32(&c->inst.sp_f32, F32(c->a), F32(c->b), F32(c->d + DSP_BENCH_D_AUX2), c->n);
+}
+
+static void run_arm_fir_sparse_q31(dsp_bench_ctx_t *c)
+{
+	arm_fir_sparse_q31(&c->inst.sp_q31, Q31(c->a), Q31(c->b), Q31(c->d + DSP_BENCH_D_AUX2), c->n);
+}
+
+static void run_arm_fir_sparse_q15(dsp_bench_ctx_t *c)
+{
+	arm_fir_sparse_q15(&c->inst.sp_q15, Q15(c->a), Q15(c->b), Q15(c->d + DSP_BENCH_D_AUX2),
+	                   Q31(c->d + DSP_BENCH_D_AUX3), c->n);
+}
+
+static void run_arm_fir_sparse_q7(dsp_bench_ctx_t *c)
+{
+	arm_fir_sparse_q7(&c->inst.sp_q7, Q7(c->a), Q7(c->b), Q7(c->d + DSP_BENCH_D_AUX2),
+	                  Q31(c->d + DSP_BENCH_D_AUX3), c->n);
+}
+
+/* -------------------------------------------------------- IIR lattice */
+
+//reflection coefficients in c scaled down to keep the lattice stable, ladder in the second half of c
+static int set_il_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->m; i++)
+		F32(c->c)[i] *= 0.2f;
+	arm_iir_lattice_init_f32(&c->inst.il_f32, c->m, F32(c->c), F32(c->c + DSP_BENCH_C_AUX), F32(c->d), c->n);
+	return set_fir(c);
+}
+
+static int set_il_q31(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->m; i++)
+		Q31(c->c)[i] >>= 3;
+	arm_iir_lattice_init_q31(&c->inst.il_q31, c->m, Q31(c->c), Q31(c->c + DSP_BENCH_C_AUX), Q31(c->d), c->n);
+	return set_fir(c);
+}
+
+static int set_il_q15(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->m; i++)
+		Q15(c->c)[i] >>= 3;
+	arm_iir_lattice_init_q15(&c->inst.il_q15, c->m, Q15(c->c), Q15(c->c + DSP_BENCH_C_AUX), Q15(c->d), c->n);
+	return set_fir(c);
+}
+
+static void run_arm_iir_lattice_f32(dsp_bench_ctx_t *c) { arm_iir_lattice_f32(&c->inst.il_f32, F32(c->a), F32(c->b), c->n); }
+static void run_arm_iir_lattice_q31(dsp_bench_ctx_t *c) { arm_iir_lattice_q31(&c->inst.il_q31, Q31(c->a), Q31(c->b), c->n); }
+static void run_arm_iir_lattice_q15(dsp_bench_ctx_t *c) { arm_iir_lattice_q15(&c->inst.il_q15, Q15(c->a), Q15(c->b), c->n); }
+
+/* ----------------------------------------------------------------- LMS */
+
+//reference in the second half of c, error output in d after the state
+static int set_lms_f32(dsp_bench_ctx_t *c)
+{
+	arm_lms_init_f32(&c->inst.lms_f32, c->m, F32(c->c), F32(c->d), 0.01f, c->n);
+	return set_fir(c);
+}
+
+static int set_lms_q31(dsp_bench_ctx_t *c)
+{
+	arm_lms_init_q31(&c->inst.lms_q31, c->m, Q31(c->c), Q31(c->d), 0x01000000, c->n, 0);
+	return set_fir(c);
+}
+
+static int set_lms_q15(dsp_bench_ctx_t *c)
+{
+	arm_lms_init_q15(&c->inst.lms_q15, c->m, Q15(c->c), Q15(c->d), 0x0100, c->n, 0);
+	return set_fir(c);
+}
+
+static int set_nlms_f32(dsp_bench_ctx_t *c)
+{
+	arm_lms_norm_init_f32(&c->inst.nlms_f32, c->m, F32(c->c), F32(c->d), 0.01f, c->n);
+	return set_fir(c);
+}
+
+//partitions of the block size, one constrained per block; the state in d below the error output
+static int set_lms_fd_f32(dsp_bench_ctx_t *c)
+{
+	if(arm_lms_fd_init_f32(&c->inst.lfd_f32, c->m, 0, F32(c->d), DSP_BENCH_D_AUX1 / sizeof(float32_t),
+	                       c->n, 0.01f, 1) != ARM_MATH_SUCCESS)
+		return 0;
+	return set_fir(c);
+}
+
+static int set_nlms_q31(dsp_bench_ctx_t *c)
+{
+	arm_lms_norm_init_q31(&c->inst.nlms_q31, c->m, Q31(c->c), Q31(c->d), 0x01000000, c->n, 0);
+	return set_fir(c);
+}
+
+static int set_nlms_q15(dsp_bench_ctx_t *c)
+{
+	arm_lms_norm_init_q15(&c->inst.nlms_q15, c->m, Q15(c->c), Q15(c->d), 0x0100, c->n, 0);
+	return set_fir(c);
+}
+
+static void run_arm_lms_f32(dsp_bench_ctx_t *c)
+{
+	arm_lms_f32(&c->inst.lms_f32, F32(c->a), F32(c->c + DSP_BENCH_C_AUX), F32(c->b), F32(c->d + DSP_BENCH_D_AUX1), c->n);
+}
+
+static void run_arm_lms_q31(dsp_bench_ctx_t *c)
+{
+	arm_lms_q31(&c->inst.lms_q31, Q31(c->a), Q31(c->c + DSP_BENCH_C_AUX), Q31(c->b), Q31(c->d + DSP_BENCH_D_AUX1), c->n);
+}
+
+static void run_arm_lms_q15(dsp_bench_ctx_t *c)
+{
+	arm_lms_q15(&c->inst.lms_q15, Q15(c->a), Q15(c->c + DSP_BENCH_C_AUX), Q15(c->b), Q15(c->d + DSP_BENCH_D_AUX1), c->n);
+}
+
+static void run_arm_lms_norm_f32(dsp_bench_ctx_t *c)
+{
+	arm_lms_norm_f32(&c->inst.nlms_f32, F32(c->a), F32(c->c + DSP_BENCH_C_AUX), F32(c->b), F32(c->d + DSP_BENCH_D_AUX1), c->n);
+}
+
+static void run_arm_lms_fd_f32(dsp_bench_ctx_t *c)
+{
+	arm_lms_fd_f32(&c->inst.lfd_f32, F32(c->a), F32(c->c + DSP_BENCH_C_AUX), F32(c->b), F32(c->d + DSP_BENCH_D_AUX1), c->n);
+}
+
+static void run_arm_lms_norm_q31(dsp_bench_ctx_t *c)
+{
+	arm_lms_norm_q31(&c->inst.nlms_q31, Q31(c->a), Q31(c->c + DSP_BENCH_C_AUX), Q31(c->b), Q31(c->d + DSP_BENCH_D_AUX1), c->n);
+}
+
+static void run_arm_lms_norm_q15(dsp_bench_ctx_t *c)
+{
+	arm_lms_norm_q15(&c->inst.nlms_q15, Q15(c->a), Q15(c->c + DSP_BENCH_C_AUX), Q15(c->b), Q15(c->d + DSP_BENCH_D_AUX1), c->n);
+}
+
+/* ------------------------------------------------------------- biquads */
+
+//every stage is the same stable low pass: b = 0.25 0.5 0.25, a1 = 0.5, a2 = -0.25
+static const float32_t s_bench_sos[5] = { 0.25f, 0.5f, 0.25f, 0.5f, -0.25f };
+
+static int set_df1_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t s, i;
+	for(s = 0; s < c->m; s++)
+		for(i = 0; i < 5u; i++)
+			F32(c->c)[5u * s + i] = s_bench_sos[i];
+	arm_biquad_cascade_df1_init_f32(&c->inst.df1_f32, (uint8_t)c->m, F32(c->c), F32(c->d));
+	return set_fir(c);
+}
+
+//Q31 and Q15 coefficients are stored halved with a post shift of 1
+static void set_sos_q31(dsp_bench_ctx_t *c)
+{
+	uint32_t s, i;
+	for(s = 0; s < c->m; s++)
+		for(i = 0; i < 5u; i++)
+			Q31(c->c)[5u * s + i] = (q31_t)(s_bench_sos[i] * 1073741824.0f);
+}
+
+static int set_df1_q31(dsp_bench_ctx_t *c)
+{
+	set_sos_q31(c);
+	arm_biquad_cascade_df1_init_q31(&c->inst.df1_q31, (uint8_t)c->m, Q31(c->c), Q31(c->d), 1);
+	return set_fir(c);
+}
+
+static int set_df1_32x64(dsp_bench_ctx_t *c)
+{
+	set_sos_q31(c);
+	arm_biquad_cas_df1_32x64_init_q31(&c->inst.df1_32x64, (uint8_t)c->m, Q31(c->c), (q63_t *)c->d, 1);
+	return set_fir(c);
+}
+
+//Q15 stages are b0 0 b1 b2 a1 a2
+static int set_df1_q15(dsp_bench_ctx_t *c)
+{
+	uint32_t s;
+	for(s = 0; s < c->m; s++)
+	{
+		Q15(c->c)[6u * s + 0u] = (q15_t)(s_bench_sos[0] * 16384.0f);
+		Q15(c->c)[6u * s + 1u] = 0;
+		Q15(c->c)[6u * s + 2u] = (q15_t)(s_bench_sos[1] * 16384.0f);
+		Q15(c->c)[6u * s + 3u] = (q15_t)(s_bench_sos[2] * 16384.0f);
+		Q15(c->c)[6u * s + 4u] = (q15_t)(s_bench_sos[3] * 16384.0f);
+		Q15(c->c)[6u * s + 5u] = (q15_t)(s_bench_sos[4] * 16384.0f);
+	}
+	arm_biquad_cascade_df1_init_q15(&c->inst.df1_q15, (uint8_t)c->m, Q15(c->c), Q15(c->d), 1);
+	return set_fir(c);
+}
+
+static int set_df2t_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t s, i;
+	for(s = 0; s < c->m; s++)
+		for(i = 0; i < 5u; i++)
+			F32(c->c)[5u * s + i] = s_bench_sos[i];
+	arm_biquad_cascade_df2T_init_f32(&c->inst.df2t_f32, (uint8_t)c->m, F32(c->c), F32(c->d));
+	return set_fir(c);
+}
+
+static int set_df2t_f64(dsp_bench_ctx_t *c)
+{
+	uint32_t s, i;
+	for(s = 0; s < c->m; s++)
+		for(i = 0; i < 5u; i++)
+			F64(c->c)[5u * s + i] = s_bench_sos[i];
+	arm_biquad_cascade_df2T_init_f64(&c->inst.df2t_f64, (uint8_t)c->m, F64(c->c), F64(c->d));
+	return set_fir(c);
+}
+
+//n stereo frames
+static int set_sdf2t_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t s, i;
+	for(s = 0; s < c->m; s++)
+		for(i = 0; i < 5u; i++)
+			F32(c->c)[5u * s + i] = s_bench_sos[i];
+	arm_biquad_cascade_stereo_df2T_init_f32(&c->inst.sdf2t_f32, (uint8_t)c->m, F32(c->c), F32(c->d));
+	c->samples = 2u * c->n;
+	c->outputs = 2u * c->n;
+	return 1;
+}
+
+//n frames of m channels
+#define DSP_BENCH_MC_STAGES 4u
+
+static int set_mc(dsp_bench_ctx_t *c)
+{
+	c->samples = c->n * c->m;
+	c->outputs = c->n * c->m;
+	return 1;
+}
+
+static int set_mdf2t_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t s, i;
+	for(s = 0; s < DSP_BENCH_MC_STAGES; s++)
+		for(i = 0; i < 5u; i++)
+			F32(c->c)[5u * s + i] = s_bench_sos[i];
+	arm_biquad_cascade_mc_df2T_init_f32(&c->inst.mdf2t_f32, DSP_BENCH_MC_STAGES, c->m, F32(c->c), F32(c->d));
+	return set_mc(c);
+}
+
+static int set_mdf1_q31(dsp_bench_ctx_t *c)
+{
+	uint32_t s, i;
+	for(s = 0; s < DSP_BENCH_MC_STAGES; s++)
+		for(i = 0; i < 5u; i++)
+			Q31(c->c)[5u * s + i] = (q31_t)(s_bench_sos[i] * 1073741824.0f);
+	arm_biquad_cascade_mc_df1_init_q31(&c->inst.mdf1_q31, DSP_BENCH_MC_STAGES, c->m, Q31(c->c), Q31(c->d), 1);
+	return set_mc(c);
+}
+
+static void run_arm_biquad_cascade_df1_f32(dsp_bench_ctx_t *c)
+{
+	arm_biquad_cascade_df1_f32(&c->inst.df1_f32, F32(c->a), F32(c->b), c->n);
+}
+
+static void run_arm_biquad_cascade_df1_q31(dsp_bench_ctx_t *c)
+{
+	arm_biquad_cascade_df1_q31(&c->inst.df1_q31, Q31(c->a), Q31(c->b), c->n);
+}
+
+static void run_arm_biquad_cascade_df1_fast_q31(dsp_bench_ctx_t *c)
+{
+	arm_biquad_cascade_df1_fast_q31(&c->inst.df1_q31, Q31(c->a), Q31(c->b), c->n);
+}
+
+static void run_arm_biquad_cas_df1_32x64_q31(dsp_bench_ctx_t *c)
+{
+	arm_biquad_cas_df1_32x64_q31(&c->inst.df1_32x64, Q31(c->a), Q31(c->b), c->n);
+}
+
+static void run_arm_biquad_cascade_df1_q15(dsp_bench_ctx_t *c)
+{
+	arm_biquad_cascade_df1_q15(&c->inst.df1_q15, Q15(c->a), Q15(c->b), c->n);
+}
+
+static void run_arm_biquad_cascade_df1_fast_q15(dsp_bench_ctx_t *c)
+{
+	arm_biquad_cascade_df1_fast_q15(&c->inst.df1_q15, Q15(c->a), Q15(c->b), c->n);
+}
+
+static void run_arm_biquad_cascade_df2T_f32(dsp_bench_ctx_t *c)
+{
+	arm_biquad_cascade_df2T_f32(&c->inst.df2t_f32, F32(c->a), F32(c->b), c->n);
+}
+
+static void run_arm_biquad_cascade_df2T_f64(dsp_bench_ctx_t *c)
+{
+	arm_biquad_cascade_df2T_f64(&c->inst.df2t_f64, F64(c->a), F64(c->b), c->n);
+}
+
+static void run_arm_biquad_cascade_stereo_df2T_f32(dsp_bench_ctx_t *c)
+{
+	arm_biquad_cascade_stereo_df2T_f32(&c->inst.sdf2t_f32, F32(c->a), F32(c->b), c->n);
+}
+
+static void run_arm_biquad_cascade_mc_df2T_f32(dsp_bench_ctx_t *c)
+{
+	arm_biquad_cascade_mc_df2T_f32(&c->inst.mdf2t_f32, F32(c->a), F32(c->b), c->n);
+}
+
+static void run_arm_biquad_cascade_mc_planar_df2T_f32(dsp_bench_ctx_t *c)
+{
+	arm_biquad_cascade_mc_planar_df2T_f32(&c->inst.mdf2t_f32, F32(c->a), F32(c->b), c->n);
+}
+
+static void run_arm_biquad_cascade_mc_df1_q31(dsp_bench_ctx_t *c)
+{
+	arm_biquad_cascade_mc_df1_q31(&c->inst.mdf1_q31, Q31(c->a), Q31(c->b), c->n);
+}
+
+static void run_arm_biquad_cascade_mc_planar_df1_q31(dsp_bench_ctx_t *c)
+{
+	arm_biquad_cascade_mc_planar_df1_q31(&c->inst.mdf1_q31, Q31(c->a), Q31(c->b), c->n);
+}
+
+/* ------------------------------------------------ convolution family */
+
+static void run_arm_conv_f32(dsp_bench_ctx_t *c)      { arm_conv_f32(F32(c->a), c->n, F32(c->c), c->m, F32(c->b)); }
+static void run_arm_conv_q31(dsp_bench_ctx_t *c)      { arm_conv_q31(Q31(c->a), c->n, Q31(c->c), c->m, Q31(c->b)); }
+static void run_arm_conv_fast_q31(dsp_bench_ctx_t *c) { arm_conv_fast_q31(Q31(c->a), c->n, Q31(c->c), c->m, Q31(c->b)); }
+static void run_arm_conv_q15(dsp_bench_ctx_t *c)      { arm_conv_q15(Q15(c->a), c->n, Q15(c->c), c->m, Q15(c->b)); }
+static void run_arm_conv_fast_q15(dsp_bench_ctx_t *c) { arm_conv_fast_q15(Q15(c->a), c->n, Q15(c->c), c->m, Q15(c->b)); }
+static void run_arm_conv_q7(dsp_bench_ctx_t *c)       { arm_conv_q7(Q7(c->a), c->n, Q7(c->c), c->m, Q7(c->b)); }
+
+static void run_arm_conv_opt_q15(dsp_bench_ctx_t *c)
+{
+	arm_conv_opt_q15(Q15(c->a), c->n, Q15(c->c), c->m, Q15(c->b), Q15(c->d), Q15(c->d + DSP_BENCH_D_AUX1));
+}
+
+static void run_arm_conv_fast_opt_q15(dsp_bench_ctx_t *c)
+{
+	arm_conv_fast_opt_q15(Q15(c->a), c->n, Q15(c->c), c->m, Q15(c->b), Q15(c->d), Q15(c->d + DSP_BENCH_D_AUX1));
+}
+
+static void run_arm_conv_opt_q7(dsp_bench_ctx_t *c)
+{
+	arm_conv_opt_q7(Q7(c->a), c->n, Q7(c->c), c->m, Q7(c->b), Q15(c->d), Q15(c->d + DSP_BENCH_D_AUX1));
+}
+
+//partial convolutions compute the first n outputs
+static int set_conv_partial(dsp_bench_ctx_t *c)
+{
+	c->samples = c->n + c->m;
+	c->outputs = c->n;
+	return 1;
+}
+
+static void run_arm_conv_partial_f32(dsp_bench_ctx_t *c)
+{
+	arm_conv_partial_f32(F32(c->a), c->n, F32(c->c), c->m, F32(c->b), 0, c->n);
+}
+
+static void run_arm_conv_partial_q31(dsp_bench_ctx_t *c)
+{
+	arm_conv_partial_q31(Q31(c->a), c->n, Q31(c->c), c->m, Q31(c->b), 0, c->n);
+}
+
+static void run_arm_conv_partial_fast_q31(dsp_bench_ctx_t *c)
+{
+	arm_conv_partial_fast_q31(Q31(c->a), c->n, Q31(c->c), c->m, Q31(c->b), 0, c->n);
+}
+
+static void run_arm_conv_partial_q15(dsp_bench_ctx_t *c)
+{
+	arm_conv_partial_q15(Q15(c->a), c->n, Q15(c->c), c->m, Q15(c->b), 0, c->n);
+}
+
+static void run_arm_conv_partial_fast_q15(dsp_bench_ctx_t *c)
+{
+	arm_conv_partial_fast_q15(Q15(c->a), c->n, Q15(c->c), c->m, Q15(c->b), 0, c->n);
+}
+
+static void run_arm_conv_partial_opt_q15(dsp_bench_ctx_t *c)
+{
+	arm_conv_partial_opt_q15(Q15(c->a), c->n, Q15(c->c), c->m, Q15(c->b), 0, c->n,
+	                         Q15(c->d), Q15(c->d + DSP_BENCH_D_AUX1));
+}
+
+static void run_arm_conv_partial_fast_opt_q15(dsp_bench_ctx_t *c)
+{
+	arm_conv_partial_fast_opt_q15(Q15(c->a), c->n, Q15(c->c), c->m, Q15(c->b), 0, c->n,
+	                              Q15(c->d), Q15(c->d + DSP_BENCH_D_AUX1));
+}
+
+static void run_arm_conv_partial_q7(dsp_bench_ctx_t *c)
+{
+	arm_conv_partial_q7(Q7(c->a), c->n, Q7(c->c), c->m, Q7(c->b), 0, c->n);
+}
+
+static void run_arm_conv_partial_opt_q7(dsp_bench_ctx_t *c)
+{
+	arm_conv_partial_opt_q7(Q7(c->a), c->n, Q7(c->c), c->m, Q7(c->b), 0, c->n,
+	                        Q15(c->d), Q15(c->d + DSP_BENCH_D_AUX1));
+}
+
+static void run_arm_correlate_f32(dsp_bench_ctx_t *c)      { arm_correlate_f32(F32(c->a), c->n, F32(c->c), c->m, F32(c->b)); }
+static void run_arm_correlate_q31(dsp_bench_ctx_t *c)      { arm_correlate_q31(Q31(c->a), c->n, Q31(c->c), c->m, Q31(c->b)); }
+static void run_arm_correlate_fast_q31(dsp_bench_ctx_t *c) { arm_correlate_fast_q31(Q31(c->a), c->n, Q31(c->c), c->m, Q31(c->b)); }
+static void run_arm_correlate_q15(dsp_bench_ctx_t *c)      { arm_correlate_q15(Q15(c->a), c->n, Q15(c->c), c->m, Q15(c->b)); }
+static void run_arm_correlate_fast_q15(dsp_bench_ctx_t *c) { arm_correlate_fast_q15(Q15(c->a), c->n, Q15(c->c), c->m, Q15(c->b)); }
+static void run_arm_correlate_q7(dsp_bench_ctx_t *c)       { arm_correlate_q7(Q7(c->a), c->n, Q7(c->c), c->m, Q7(c->b)); }
+
+static void run_arm_correlate_opt_q15(dsp_bench_ctx_t *c)
+{
+	arm_correlate_opt_q15(Q15(c->a), c->n, Q15(c->c), c->m, Q15(c->b), Q15(c->d));
+}
+
+static void run_arm_correlate_fast_opt_q15(dsp_bench_ctx_t *c)
+{
+	arm_correlate_fast_opt_q15(Q15(c->a), c->n, Q15(c->c), c->m, Q15(c->b), Q15(c->d));
+}
+
+static void run_arm_correlate_opt_q7(dsp_bench_ctx_t *c)
+{
+	arm_correlate_opt_q7(Q7(c->a), c->n, Q7(c->c), c->m, Q7(c->b), Q15(c->d), Q15(c->d + DSP_BENCH_D_AUX1));
+}
+
+/* ---------------------------------------------------------- transforms */
+
+static int set_fft(dsp_bench_ctx_t *c, arm_status st)
+{
+	if(st != ARM_MATH_SUCCESS)
+		return 0;
+	c->samples = c->n;
+	c->outputs = c->n;
+	return 1;
+}
+
+static int set_cfft_f32(dsp_bench_ctx_t *c)
+{
+	switch(c->n)
+	{
+		case 16:   c->inst.cfft_f32 = &arm_cfft_sR_f32_len16;   break;
+		case 32:   c->inst.cfft_f32 = &arm_cfft_sR_f32_len32;   break;
+		case 64:   c->inst.cfft_f32 = &arm_cfft_sR_f32_len64;   break;
+		case 128:  c->inst.cfft_f32 = &arm_cfft_sR_f32_len128;  break;
+		case 256:  c->inst.cfft_f32 = &arm_cfft_sR_f32_len256;  break;
+		case 512:  c->inst.cfft_f32 = &arm_cfft_sR_f32_len512;  break;
+		case 1024: c->inst.cfft_f32 = &arm_cfft_sR_f32_len1024; break;
+		case 2048: c->inst.cfft_f32 = &arm_cfft_sR_f32_len2048; break;
+		default:   return 0;
+	}
+	return set_fft(c, ARM_MATH_SUCCESS);
+}
+
+static int set_cfft_q31(dsp_bench_ctx_t *c)
+{
+	switch(c->n)
+	{
+		case 16:   c->inst.cfft_q31 = &arm_cfft_sR_q31_len16;   break;
+		case 32:   c->inst.cfft_q31 = &arm_cfft_sR_q31_len32;   break;
+		case 64:   c->inst.cfft_q31 = &arm_cfft_sR_q31_len64;   break;
+		case 128:  c->inst.cfft_q31 = &arm_cfft_sR_q31_len128;  break;
+		case 256:  c->inst.cfft_q31 = &arm_cfft_sR_q31_len256;  break;
+		case 512:  c->inst.cfft_q31 = &arm_cfft_sR_q31_len512;  break;
+		case 1024: c->inst.cfft_q31 = &arm_cfft_sR_q31_len1024; break;
+		case 2048: c->inst.cfft_q31 = &arm_cfft_sR_q31_len2048; break;
+		default:   return 0;
+	}
+	return set_fft(c, ARM_MATH_SUCCESS);
+}
+
+static int set_cfft_q15(dsp_bench_ctx_t *c)
+{
+	switch(c->n)
+	{
+		case 16:   c->inst.cfft_q15 = &arm_cfft_sR_q15_len16;   break;
+		case 32:   c->inst.cfft_q15 = &arm_cfft_sR_q15_len32;   break;
+		case 64:   c->inst.cfft_q15 = &arm_cfft_sR_q15_len64;   break;
+		case 128:  c->inst.cfft_q15 = &arm_cfft_sR_q15_len128;  break;
+		case 256:  c->inst.cfft_q15 = &arm_cfft_sR_q15_len256;  break;
+		case 512:  c->inst.cfft_q15 = &arm_cfft_sR_q15_len512;  break;
+		case 1024: c->inst.cfft_q15 = &arm_cfft_sR_q15_len1024; break;
+		case 2048: c->inst.cfft_q15 = &arm_cfft_sR_q15_len2048; break;
+		default:   return 0;
+	}
+	return set_fft(c, ARM_MATH_SUCCESS);
+}
+
+static int set_r2_f32(dsp_bench_ctx_t *c) { return set_fft(c, arm_cfft_radix2_init_f32(&c->inst.r2_f32, c->n, 0, 1)); }
+static int set_r2_q31(dsp_bench_ctx_t *c) { return set_fft(c, arm_cfft_radix2_init_q31(&c->inst.r2_q31, c->n, 0, 1)); }
+static int set_r2_q15(dsp_bench_ctx_t *c) { return set_fft(c, arm_cfft_radix2_init_q15(&c->inst.r2_q15, c->n, 0, 1)); }
+static int set_r4_f32(dsp_bench_ctx_t *c) { return set_fft(c, arm_cfft_radix4_init_f32(&c->inst.r4_f32, c->n, 0, 1)); }
+static int set_r4_q31(dsp_bench_ctx_t *c) { return set_fft(c, arm_cfft_radix4_init_q31(&c->inst.r4_q31, c->n, 0, 1)); }
+static int set_r4_q15(dsp_bench_ctx_t *c) { return set_fft(c, arm_cfft_radix4_init_q15(&c->inst.r4_q15, c->n, 0, 1)); }
+
+static int set_rfft_f32(dsp_bench_ctx_t *c)
+{
+	return set_fft(c, arm_rfft_init_f32(&c->inst.rfft_f32.rfft, &c->inst.rfft_f32.cfft, c->n, 0, 1));
+}
+
+static int set_rfft_q31(dsp_bench_ctx_t *c)     { return set_fft(c, arm_rfft_init_q31(&c->inst.rfft_q31, c->n, 0, 1)); }
+static int set_rfft_q15(dsp_bench_ctx_t *c)     { return set_fft(c, arm_rfft_init_q15(&c->inst.rfft_q15, c->n, 0, 1)); }
+static int set_rfft_fast_f32(dsp_bench_ctx_t *c) { return set_fft(c, arm_rfft_fast_init_f32(&c->inst.rfftf_f32, c->n)); }
+
+//mixed radix: twiddles in d, the complex scratch in b and the real one in c
+static int set_cfft_mixed_f32(dsp_bench_ctx_t *c)
+{
+	return set_fft(c, arm_cfft_mixed_init_f32(&c->inst.cfftm_f32, c->n, F32(c->d), F32(c->b)));
+}
+
+static int set_rfft_mixed_f32(dsp_bench_ctx_t *c)
+{
+	return set_fft(c, arm_rfft_mixed_init_f32(&c->inst.rfftm_f32, c->n, F32(c->d), F32(c->c)));
+}
+
+//DCT4 exists for 128, 512 and 2048 points, normalised by sqrt(2/N)
+static int set_dct4_f32(dsp_bench_ctx_t *c)
+{
+	dsp_bench_dct4_f32_t *s = &c->inst.dct4_f32;
+
+	if(c->n != 128u && c->n != 512u && c->n != 2048u)
+		return 0;
+	return set_fft(c, arm_dct4_init_f32(&s->dct, &s->rfft, &s->cfft, c->n, c->n / 2u,
+	                                    (float32_t)sqrt(2.0 / c->n)));
+}
+
+static int set_dct4_q31(dsp_bench_ctx_t *c)
+{
+	dsp_bench_dct4_q31_t *s = &c->inst.dct4_q31;
+
+	if(c->n != 128u && c->n != 512u && c->n != 2048u)
+		return 0;
+	return set_fft(c, arm_dct4_init_q31(&s->dct, &s->rfft, &s->cfft, c->n, c->n / 2u,
+	                                    (q31_t)(sqrt(2.0 / c->n) * 2147483648.0)));
+}
+
+static int set_dct4_q15(dsp_bench_ctx_t *c)
+{
+	dsp_bench_dct4_q15_t *s = &c->inst.dct4_q15;
+
+	if(c->n != 128u && c->n != 512u && c->n != 2048u)
+		return 0;
+	return set_fft(c, arm_dct4_init_q15(&s->dct, &s->rfft, &s->cfft, c->n, c->n / 2u,
+	                                    (q15_t)(sqrt(2.0 / c->n) * 32768.0)));
+}
+
+static void run_arm_cfft_f32(dsp_bench_ctx_t *c)        { arm_cfft_f32(c->inst.cfft_f32, F32(c->a), 0, 1); }
+static void run_arm_cfft_q31(dsp_bench_ctx_t *c)        { arm_cfft_q31(c->inst.cfft_q31, Q31(c->a), 0, 1); }
+static void run_arm_cfft_q15(dsp_bench_ctx_t *c)        { arm_cfft_q15(c->inst.cfft_q15, Q15(c->a), 0, 1); }
+static void run_arm_cfft_bfp_q31(dsp_bench_ctx_t *c)    { int32_t e; arm_cfft_bfp_q31(c->inst.cfft_q31, Q31(c->a), 0, 1, &e); }
+static void run_arm_cfft_bfp_q15(dsp_bench_ctx_t *c)    { int32_t e; arm_cfft_bfp_q15(c->inst.cfft_q15, Q15(c->a), 0, 1, &e); }
+static void run_arm_cfft_radix2_f32(dsp_bench_ctx_t *c) { arm_cfft_radix2_f32(&c->inst.r2_f32, F32(c->a)); }
+static void run_arm_cfft_radix2_q31(dsp_bench_ctx_t *c) { arm_cfft_radix2_q31(&c->inst.r2_q31, Q31(c->a)); }
+static void run_arm_cfft_radix2_q15(dsp_bench_ctx_t *c) { arm_cfft_radix2_q15(&c->inst.r2_q15, Q15(c->a)); }
+static void run_arm_cfft_radix4_f32(dsp_bench_ctx_t *c) { arm_cfft_radix4_f32(&c->inst.r4_f32, F32(c->a)); }
+static void run_arm_cfft_radix4_q31(dsp_bench_ctx_t *c) { arm_cfft_radix4_q31(&c->inst.r4_q31, Q31(c->a)); }
+static void run_arm_cfft_radix4_q15(dsp_bench_ctx_t *c) { arm_cfft_radix4_q15(&c->inst.r4_q15, Q15(c->a)); }
+static void run_arm_rfft_f32(dsp_bench_ctx_t *c)        { arm_rfft_f32(&c->inst.rfft_f32.rfft, F32(c->a), F32(c->b)); }
+static void run_arm_rfft_q31(dsp_bench_ctx_t *c)        { arm_rfft_q31(&c->inst.rfft_q31, Q31(c->a), Q31(c->b)); }
+static void run_arm_rfft_q15(dsp_bench_ctx_t *c)        { arm_rfft_q15(&c->inst.rfft_q15, Q15(c->a), Q15(c->b)); }
+static void run_arm_rfft_bfp_q31(dsp_bench_ctx_t *c)    { int32_t e; arm_rfft_bfp_q31(&c->inst.rfft_q31, Q31(c->a), Q31(c->b), &e); }
+static void run_arm_rfft_bfp_q15(dsp_bench_ctx_t *c)    { int32_t e; arm_rfft_bfp_q15(&c->inst.rfft_q15, Q15(c->a), Q15(c->b), &e); }
+static void run_arm_rfft_fast_f32(dsp_bench_ctx_t *c)   { arm_rfft_fast_f32(&c->inst.rfftf_f32, F32(c->a), F32(c->b), 0); }
+static void run_arm_cfft_mixed_f32(dsp_bench_ctx_t *c)  { arm_cfft_mixed_f32(&c->inst.cfftm_f32, F32(c->a), 0); }
+static void run_arm_rfft_mixed_f32(dsp_bench_ctx_t *c)  { arm_rfft_mixed_f32(&c->inst.rfftm_f32, F32(c->a), F32(c->b), 0); }
+static void run_arm_dct4_f32(dsp_bench_ctx_t *c)        { arm_dct4_f32(&c->inst.dct4_f32.dct, F32(c->d), F32(c->a)); }
+static void run_arm_dct4_q31(dsp_bench_ctx_t *c)        { arm_dct4_q31(&c->inst.dct4_q31.dct, Q31(c->d), Q31(c->a)); }
+static void run_arm_dct4_q15(dsp_bench_ctx_t *c)        { arm_dct4_q15(&c->inst.dct4_q15.dct, Q15(c->d), Q15(c->a)); }
+
+//tone detectors: m bins spread over the spectrum, coefficients and state in d
+#define DSP_BENCH_SDFT_LEN  256u
+
+static int set_tone(dsp_bench_ctx_t *c)
+{
+	c->samples = c->n;
+	c->outputs = c->m;
+	return 1;
+}
+
+//one block of n samples per run, the bin numbers in b until the run overwrites them
+static int set_goertzel_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+
+	for(i = 0; i < c->m; i++)
+		F32(c->b)[i] = (float32_t)(c->n / 2u) * ((float32_t)i + 0.5f) / (float32_t)c->m;
+	arm_goertzel_init_f32(&c->inst.gz_f32, c->m, c->n, F32(c->b), F32(c->d), F32(c->d) + 7u * c->m);
+	return set_tone(c);
+}
+
+static int set_goertzel_q31(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+
+	for(i = 0; i < c->m; i++)
+		F32(c->b)[i] = (float32_t)(c->n / 2u) * ((float32_t)i + 0.5f) / (float32_t)c->m;
+	arm_goertzel_init_q31(&c->inst.gz_q31, c->m, c->n, F32(c->b), Q31(c->d), (q63_t *)(Q31(c->d) + 6u * c->m));
+	return set_tone(c);
+}
+
+//n samples into a window of DSP_BENCH_SDFT_LEN, the delay line in c
+static int set_sdft_f32(dsp_bench_ctx_t *c)
+{
+	uint16_t *bins = (uint16_t *)c->b;
+	uint32_t i;
+
+	for(i = 0; i < c->m; i++)
+		bins[i] = (uint16_t)((DSP_BENCH_SDFT_LEN / 2u) * i / c->m);
+	arm_sdft_init_f32(&c->inst.sdft_f32, c->m, DSP_BENCH_SDFT_LEN, bins, 0.9999f,
+	                  F32(c->d), F32(c->d) + 2u * c->m, F32(c->c));
+	return set_tone(c);
+}
+
+static void run_arm_goertzel_f32(dsp_bench_ctx_t *c) { arm_goertzel_f32(&c->inst.gz_f32, F32(c->a), F32(c->b), c->n); }
+static void run_arm_goertzel_q31(dsp_bench_ctx_t *c) { arm_goertzel_q31(&c->inst.gz_q31, Q31(c->a), Q31(c->b), c->n); }
+static void run_arm_sdft_f32(dsp_bench_ctx_t *c)     { arm_sdft_f32(&c->inst.sdft_f32, F32(c->a), F32(c->b), c->n); }
+
+//frames of n samples with hop n/2, the n + 3*hop samples of a run give four rows;
+//Hann window in c, ring and work buffer in d
+static int set_stft_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+
+	if(3u * c->n > DSP_BENCH_D_SIZE / sizeof(float32_t))
+		return 0;
+	for(i = 0; i < c->n; i++)
+		F32(c->c)[i] = 0.5f - 0.5f * arm_cos_f32(6.28318531f * (float32_t)i / (float32_t)c->n);
+	if(arm_stft_init_f32(&c->inst.stft_f32, c->n, c->n / 2u, 1, 1.0f, F32(c->c),
+	                     F32(c->d), F32(c->d) + c->n, 0) != ARM_MATH_SUCCESS)
+		return 0;
+	c->samples = c->n + 3u * (c->n / 2u);
+	c->outputs = 4u * (c->n / 2u + 1u);
+	return 1;
+}
+
+static void run_arm_stft_f32(dsp_bench_ctx_t *c)     { arm_stft_f32(&c->inst.stft_f32, F32(c->a), F32(c->b), c->samples); }
+
+/* ------------------------------------------------------------ matrices */
+
+static int set_mat_f32(dsp_bench_ctx_t *c)
+{
+	arm_mat_init_f32(&c->inst.mat_f32.a, c->n, c->n, F32(c->a));
+	arm_mat_init_f32(&c->inst.mat_f32.c, c->n, c->n, F32(c->c));
+	arm_mat_init_f32(&c->inst.mat_f32.b, c->n, c->n, F32(c->b));
+	return set_mat(c);
+}
+
+static int set_mat_q31(dsp_bench_ctx_t *c)
+{
+	arm_mat_init_q31(&c->inst.mat_q31.a, c->n, c->n, Q31(c->a));
+	arm_mat_init_q31(&c->inst.mat_q31.c, c->n, c->n, Q31(c->c));
+	arm_mat_init_q31(&c->inst.mat_q31.b, c->n, c->n, Q31(c->b));
+	return set_mat(c);
+}
+
+static int set_mat_q15(dsp_bench_ctx_t *c)
+{
+	arm_mat_init_q15(&c->inst.mat_q15.a, c->n, c->n, Q15(c->a));
+	arm_mat_init_q15(&c->inst.mat_q15.c, c->n, c->n, Q15(c->c));
+	arm_mat_init_q15(&c->inst.mat_q15.b, c->n, c->n, Q15(c->b));
+	return set_mat(c);
+}
+
+//diagonally dominant, so the inverse exists and pivoting does not dominate the timing
+static int set_inv_f32(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		F32(c->a)[i * c->n + i] += (float32_t)c->n;
+	return set_mat_f32(c);
+}
+
+static int set_mat_f64(dsp_bench_ctx_t *c)
+{
+	arm_mat_init_f64(&c->inst.mat_f64.a, c->n, c->n, F64(c->a));
+	arm_mat_init_f64(&c->inst.mat_f64.c, c->n, c->n, F64(c->c));
+	arm_mat_init_f64(&c->inst.mat_f64.b, c->n, c->n, F64(c->b));
+	return set_mat(c);
+}
+
+//n x n half-precision matrix converted from c, vector a
+static int set_mat_vec_f16(dsp_bench_ctx_t *c)
+{
+	set_f16(c, c->n * c->n);
+	arm_mat_init_f16(&c->inst.mat_f16, c->n, c->n, F16(c->d + DSP_BENCH_D_AUX3));
+	c->samples = c->n * c->n;
+	c->outputs = c->n;
+	return 1;
+}
+
+static void run_arm_mat_vec_mult_f16_f32(dsp_bench_ctx_t *c)
+{
+	arm_mat_vec_mult_f16_f32(&c->inst.mat_f16, F32(c->a), F32(c->b));
+}
+
+static int set_inv_f64(dsp_bench_ctx_t *c)
+{
+	uint32_t i;
+	for(i = 0; i < c->n; i++)
+		F64(c->a)[i * c->n + i] += (float64_t)c->n;
+	return set_mat_f64(c);
+}
+
+//complex matrices use the same instances, n x n complex elements
+static void run_arm_mat_add_f32(dsp_bench_ctx_t *c)  { arm_mat_add_f32(&c->inst.mat_f32.a, &c->inst.mat_f32.c, &c->inst.mat_f32.b); }
+static void run_arm_mat_add_q31(dsp_bench_ctx_t *c)  { arm_mat_add_q31(&c->inst.mat_q31.a, &c->inst.mat_q31.c, &c->inst.mat_q31.b); }
+static void run_arm_mat_add_q15(dsp_bench_ctx_t *c)  { arm_mat_add_q15(&c->inst.mat_q15.a, &c->inst.mat_q15.c, &c->inst.mat_q15.b); }
+static void run_arm_mat_sub_f32(dsp_bench_ctx_t *c)  { arm_mat_sub_f32(&c->inst.mat_f32.a, &c->inst.mat_f32.c, &c->inst.mat_f32.b); }
+static void run_arm_mat_sub_q31(dsp_bench_ctx_t *c)  { arm_mat_sub_q31(&c->inst.mat_q31.a, &c->inst.mat_q31.c, &c->inst.mat_q31.b); }
+static void run_arm_mat_sub_q15(dsp_bench_ctx_t *c)  { arm_mat_sub_q15(&c->inst.mat_q15.a, &c->inst.mat_q15.c, &c->inst.mat_q15.b); }
+static void run_arm_mat_mult_f32(dsp_bench_ctx_t *c) { arm_mat_mult_f32(&c->inst.mat_f32.a, &c->inst.mat_f32.c, &c->inst.mat_f32.b); }
+static void run_arm_mat_mult_q31(dsp_bench_ctx_t *c) { arm_mat_mult_q31(&c->inst.mat_q31.a, &c->inst.mat_q31.c, &c->inst.mat_q31.b); }
+static void run_arm_mat_trans_f32(dsp_bench_ctx_t *c) { arm_mat_trans_f32(&c->inst.mat_f32.a, &c->inst.mat_f32.b); }
+static void run_arm_mat_trans_q31(dsp_bench_ctx_t *c) { arm_mat_trans_q31(&c->inst.mat_q31.a, &c->inst.mat_q31.b); }
+static void run_arm_mat_trans_q15(dsp_bench_ctx_t *c) { arm_mat_trans_q15(&c->inst.mat_q15.a, &c->inst.mat_q15.b); }
+static void run_arm_mat_scale_f32(dsp_bench_ctx_t *c) { arm_mat_scale_f32(&c->inst.mat_f32.a, 0.75f, &c->inst.mat_f32.b); }
+static void run_arm_mat_scale_q31(dsp_bench_ctx_t *c) { arm_mat_scale_q31(&c->inst.mat_q31.a, 0x60000000, 1, &c->inst.mat_q31.b); }
+static void run_arm_mat_scale_q15(dsp_bench_ctx_t *c) { arm_mat_scale_q15(&c->inst.mat_q15.a, 0x6000, 1, &c->inst.mat_q15.b); }
+static void run_arm_mat_inverse_f32(dsp_bench_ctx_t *c) { arm_mat_inverse_f32(&c->inst.mat_f32.a, &c->inst.mat_f32.b); }
+static void run_arm_mat_inverse_f64(dsp_bench_ctx_t *c) { arm_mat_inverse_f64(&c->inst.mat_f64.a, &c->inst.mat_f64.b); }
+static void run_arm_mat_mult_f64(dsp_bench_ctx_t *c)    { arm_mat_mult_f64(&c->inst.mat_f64.a, &c->inst.mat_f64.c, &c->inst.mat_f64.b); }
+
+//decompositions of the diagonally dominant a, solves with its triangles and n right-hand sides in c
+static void run_arm_mat_cholesky_f32(dsp_bench_ctx_t *c) { arm_mat_cholesky_f32(&c->inst.mat_f32.a, &c->inst.mat_f32.b); }
+static void run_arm_mat_cholesky_f64(dsp_bench_ctx_t *c) { arm_mat_cholesky_f64(&c->inst.mat_f64.a, &c->inst.mat_f64.b); }
+static void run_arm_mat_ldlt_f32(dsp_bench_ctx_t *c)     { arm_mat_ldlt_f32(&c->inst.mat_f32.a, &c->inst.mat_f32.b); }
+static void run_arm_mat_ldlt_f64(dsp_bench_ctx_t *c)     { arm_mat_ldlt_f64(&c->inst.mat_f64.a, &c->inst.mat_f64.b); }
+static void run_arm_mat_qr_f32(dsp_bench_ctx_t *c)       { arm_mat_qr_f32(&c->inst.mat_f32.a, &c->inst.mat_f32.b, F32(c->d)); }
+static void run_arm_mat_qr_f64(dsp_bench_ctx_t *c)       { arm_mat_qr_f64(&c->inst.mat_f64.a, &c->inst.mat_f64.b, F64(c->d)); }
+
+static void run_arm_mat_cholesky_solve_f32(dsp_bench_ctx_t *c)
+{
+	arm_mat_cholesky_solve_f32(&c->inst.mat_f32.a, &c->inst.mat_f32.c, &c->inst.mat_f32.b);
+}
+
+static void run_arm_mat_cholesky_solve_f64(dsp_bench_ctx_t *c)
+{
+	arm_mat_cholesky_solve_f64(&c->inst.mat_f64.a, &c->inst.mat_f64.c, &c->inst.mat_f64.b);
+}
+
+static void run_arm_mat_solve_lower_triangular_f32(dsp_bench_ctx_t *c)
+{
+	arm_mat_solve_lower_triangular_f32(&c->inst.mat_f32.a, &c->inst.mat_f32.c, &c->inst.mat_f32.b);
+}
+
+static void run_arm_mat_solve_lower_triangular_f64(dsp_bench_ctx_t *c)
+{
+	arm_mat_solve_lower_triangular_f64(&c->inst.mat_f64.a, &c->inst.mat_f64.c, &c->inst.mat_f64.b);
+}
+
+static void run_arm_mat_qr_solve_f32(dsp_bench_ctx_t *c)
+{
+	arm_mat_qr_solve_f32(&c->inst.mat_f32.a, F32(c->d), &c->inst.mat_f32.c, &c->inst.mat_f32.b, F32(c->d) + c->n);
+}
+
+static void run_arm_mat_qr_solve_f64(dsp_bench_ctx_t *c)
+{
+	arm_mat_qr_solve_f64(&c->inst.mat_f64.a, F64(c->d), &c->inst.mat_f64.c, &c->inst.mat_f64.b, F64(c->d) + c->n);
+}
+
+static void run_arm_mat_mult_fast_q31(dsp_bench_ctx_t *c)
+{
+	arm_mat_mult_fast_q31(&c->inst.mat_q31.a, &c->inst.mat_q31.c, &c->inst.mat_q31.b);
+}
+
+static void run_arm_mat_mult_q15(dsp_bench_ctx_t *c)
+{
+	arm_mat_mult_q15(&c->inst.mat_q15.a, &c->inst.mat_q15.c, &c->inst.mat_q15.b, Q15(c->d));
+}
+
+static void run_arm_mat_mult_fast_q15(dsp_bench_ctx_t *c)
+{
+	arm_mat_mult_fast_q15(&c->inst.mat_q15.a, &c->inst.mat_q15.c, &c->inst.mat_q15.b, Q15(c->d));
+}
+
+static void run_arm_mat_cmplx_mult_f32(dsp_bench_ctx_t *c)
+{
+	arm_mat_cmplx_mult_f32(&c->inst.mat_f32.a, &c->inst.mat_f32.c, &c->inst.mat_f32.b);
+}
+
+static void run_arm_mat_cmplx_mult_q31(dsp_bench_ctx_t *c)
+{
+	arm_mat_cmplx_mult_q31(&c->inst.mat_q31.a, &c->inst.mat_q31.c, &c->inst.mat_q31.b);
+}
+
+static void run_arm_mat_cmplx_mult_q15(dsp_bench_ctx_t *c)
+{
+	arm_mat_cmplx_mult_q15(&c->inst.mat_q15.a, &c->inst.mat_q15.c, &c->inst.mat_q15.b, Q15(c->d));
+}
+
+/* ------------------------------------------------------ sparse matrices */
+
+//n x n matrix in a with about m percent of the values kept, vector and matrix B (n x 8) in c;
+//CSR values in d, column indices at d + DSP_BENCH_D_AUX2, row offsets at c + DSP_BENCH_C_AUX
+#define DSP_BENCH_CSR_MAX   (DSP_BENCH_D_AUX2 / sizeof(float32_t))
+
+static void set_sparse(dsp_bench_ctx_t *c, uint32_t size)
+{
+	uint32_t i;
+
+	for(i = 0; i < c->n * c->n; i++)
+		if(((i * 2654435761u) >> 16) % 100u >= c->m)
+			memset(c->a + i * size, 0, size);
+	c->samples = c->n * c->n;
+	c->outputs = c->n;
+}
+
+//m * n / 200 diagonals on either side of the main diagonal kept, band in d
+static uint16_t set_banded(dsp_bench_ctx_t *c, uint32_t size)
+{
+	uint32_t i, j, k = c->m * c->n / 200u;
+
+	for(i = 0; i < c->n; i++)
+		for(j = 0; j < c->n; j++)
+			if(j + k < i || j > i + k)
+				memset(c->a + (i * c->n + j) * size, 0, size);
+	c->samples = c->n * c->n;
+	c->outputs = c->n;
+	return (uint16_t)k;
+}
+
+static int set_spm_f32(dsp_bench_ctx_t *c)
+{
+	set_sparse(c, sizeof(float32_t));
+	arm_mat_init_f32(&c->inst.spm_f32.a, c->n, c->n, F32(c->a));
+	arm_mat_init_f32(&c->inst.spm_f32.c, c->n, 8, F32(c->c));
+	arm_mat_init_f32(&c->inst.spm_f32.b, c->n, 8, F32(c->b));
+	return arm_mat_csr_from_dense_f32(&c->inst.spm_f32.a, &c->inst.spm_f32.csr, (uint32_t *)(c->c + DSP_BENCH_C_AUX),
+	                                  (uint16_t *)(c->d + DSP_BENCH_D_AUX2), F32(c->d), DSP_BENCH_CSR_MAX) == ARM_MATH_SUCCESS;
+}
+
+static int set_spm_mult_f32(dsp_bench_ctx_t *c)
+{
+	if(!set_spm_f32(c))
+		return 0;
+	c->outputs = 8u * c->n;
+	return 1;
+}
+
+static int set_band_f32(dsp_bench_ctx_t *c)
+{
+	uint16_t k = set_banded(c, sizeof(float32_t));
+
+	arm_mat_init_f32(&c->inst.spm_f32.a, c->n, c->n, F32(c->a));
+	return arm_mat_band_from_dense_f32(&c->inst.spm_f32.a, &c->inst.spm_f32.band, k, k, F32(c->d)) == ARM_MATH_SUCCESS;
+}
+
+static int set_spm_q31(dsp_bench_ctx_t *c)
+{
+	set_sparse(c, sizeof(q31_t));
+	arm_mat_init_q31(&c->inst.spm_q31.a, c->n, c->n, Q31(c->a));
+	arm_mat_init_q31(&c->inst.spm_q31.c, c->n, 8, Q31(c->c));
+	arm_mat_init_q31(&c->inst.spm_q31.b, c->n, 8, Q31(c->b));
+	return arm_mat_csr_from_dense_q31(&c->inst.spm_q31.a, &c->inst.spm_q31.csr, (uint32_t *)(c->c + DSP_BENCH_C_AUX),
+	                                  (uint16_t *)(c->d + DSP_BENCH_D_AUX2), Q31(c->d), DSP_BENCH_CSR_MAX) == ARM_MATH_SUCCESS;
+}
+
+static int set_spm_mult_q31(dsp_bench_ctx_t *c)
+{
+	if(!set_spm_q31(c))
+		return 0;
+	c->outputs = 8u * c->n;
+	return 1;
+}
+
+static int set_band_q31(dsp_bench_ctx_t *c)
+{
+	uint16_t k = set_banded(c, sizeof(q31_t));
+
+	arm_mat_init_q31(&c->inst.spm_q31.a, c->n, c->n, Q31(c->a));
+	return arm_mat_band_from_dense_q31(&c->inst.spm_q31.a, &c->inst.spm_q31.band, k, k, Q31(c->d)) == ARM_MATH_SUCCESS;
+}
+
+static int set_spm_q15(dsp_bench_ctx_t *c)
+{
+	set_sparse(c, sizeof(q15_t));
+	arm_mat_init_q15(&c->inst.spm_q15.a, c->n, c->n, Q15(c->a));
+	arm_mat_init_q15(&c->inst.spm_q15.c, c->n, 8, Q15(c->c));
+	arm_mat_init_q15(&c->inst.spm_q15.b, c->n, 8, Q15(c->b));
+	return arm_mat_csr_from_dense_q15(&c->inst.spm_q15.a, &c->inst.spm_q15.csr, (uint32_t *)(c->c + DSP_BENCH_C_AUX),
+	                                  (uint16_t *)(c->d + DSP_BENCH_D_AUX2), Q15(c->d), DSP_BENCH_CSR_MAX) == ARM_MATH_SUCCESS;
+}
+
+static int set_spm_mult_q15(dsp_bench_ctx_t *c)
+{
+	if(!set_spm_q15(c))
+		return 0;
+	c->outputs = 8u * c->n;
+	return 1;
+}
+
+static int set_band_q15(dsp_bench_ctx_t *c)
+{
+	uint16_t k = set_banded(c, sizeof(q15_t));
+
+	arm_mat_init_q15(&c->inst.spm_q15.a, c->n, c->n, Q15(c->a));
+	return arm_mat_band_from_dense_q15(&c->inst.spm_q15.a, &c->inst.spm_q15.band, k, k, Q15(c->d)) == ARM_MATH_SUCCESS;
+}
+
+static void run_arm_mat_vec_mult_f32(dsp_bench_ctx_t *c) { arm_mat_vec_mult_f32(&c->inst.spm_f32.a, F32(c->c), F32(c->b)); }
+static void run_arm_mat_vec_mult_q31(dsp_bench_ctx_t *c) { arm_mat_vec_mult_q31(&c->inst.spm_q31.a, Q31(c->c), Q31(c->b)); }
+static void run_arm_mat_vec_mult_q15(dsp_bench_ctx_t *c) { arm_mat_vec_mult_q15(&c->inst.spm_q15.a, Q15(c->c), Q15(c->b)); }
+static void run_arm_mat_csr_vec_mult_f32(dsp_bench_ctx_t *c) { arm_mat_csr_vec_mult_f32(&c->inst.spm_f32.csr, F32(c->c), F32(c->b)); }
+static void run_arm_mat_csr_vec_mult_q31(dsp_bench_ctx_t *c) { arm_mat_csr_vec_mult_q31(&c->inst.spm_q31.csr, Q31(c->c), Q31(c->b)); }
+static void run_arm_mat_csr_vec_mult_q15(dsp_bench_ctx_t *c) { arm_mat_csr_vec_mult_q15(&c->inst.spm_q15.csr, Q15(c->c), Q15(c->b)); }
+static void run_arm_mat_band_vec_mult_f32(dsp_bench_ctx_t *c) { arm_mat_band_vec_mult_f32(&c->inst.spm_f32.band, F32(c->c), F32(c->b)); }
+static void run_arm_mat_band_vec_mult_q31(dsp_bench_ctx_t *c) { arm_mat_band_vec_mult_q31(&c->inst.spm_q31.band, Q31(c->c), Q31(c->b)); }
+static void run_arm_mat_band_vec_mult_q15(dsp_bench_ctx_t *c) { arm_mat_band_vec_mult_q15(&c->inst.spm_q15.band, Q15(c->c), Q15(c->b)); }
+static void run_arm_mat_csr_mult_f32(dsp_bench_ctx_t *c) { arm_mat_csr_mult_f32(&c->inst.spm_f32.csr, &c->inst.spm_f32.c, &c->inst.spm_f32.b); }
+static void run_arm_mat_csr_mult_q31(dsp_bench_ctx_t *c) { arm_mat_csr_mult_q31(&c->inst.spm_q31.csr, &c->inst.spm_q31.c, &c->inst.spm_q31.b); }
+static void run_arm_mat_csr_mult_q15(dsp_bench_ctx_t *c) { arm_mat_csr_mult_q15(&c->inst.spm_q15.csr, &c->inst.spm_q15.c, &c->inst.spm_q15.b); }
+
+/* ------------------------------------------------------ neural network */
+
+#define DSP_BENCH_NN_CH     8u          //channels of the n x n HWC images, FC outputs
+
+//per-channel quantization in d + DSP_BENCH_D_AUX1, im2col/expansion buffer at d
+static arm_nn_quant_q7 set_nn_quant(dsp_bench_ctx_t *c)
+{
+	arm_nn_quant_q7 q;
+	q31_t *mult = Q31(c->d + DSP_BENCH_D_AUX1);
+	int32_t *shift = (int32_t *)(mult + DSP_BENCH_NN_CH);
+	uint32_t i;
+
+	for(i = 0; i < DSP_BENCH_NN_CH; i++)
+	{
+		mult[i] = 0x50000000 + (q31_t)(i << 24);
+		shift[i] = -6;
+	}
+	q.pMult = mult;
+	q.pShift = shift;
+	q.inOffset = 3;
+	q.outOffset = -2;
+	q.actMin = -128;
+	q.actMax = 127;
+	return q;
+}
+
+//n x n x DSP_BENCH_NN_CH image in a, k x k kernel, same padding, weights in c
+static int set_nn_conv(dsp_bench_ctx_t *c, uint16_t k)
+{
+	arm_nn_conv_instance_q7 *s = &c->inst.nnc;
+
+	s->in.height = s->out.height = (uint16_t)c->n;
+	s->in.width = s->out.width = (uint16_t)c->n;
+	s->in.channels = s->out.channels = DSP_BENCH_NN_CH;
+	s->kernelH = s->kernelW = k;
+	s->strideH = s->strideW = 1;
+	s->padH = s->padW = k / 2u;
+	s->pWeights = Q7(c->c);
+	s->pBias = 0;
+	s->quant = set_nn_quant(c);
+	c->samples = c->n * c->n * DSP_BENCH_NN_CH;
+	c->outputs = c->samples;
+	return 1;
+}
+
+static int set_nn_conv3(dsp_bench_ctx_t *c) { return set_nn_conv(c, 3); }
+static int set_nn_conv1(dsp_bench_ctx_t *c) { return set_nn_conv(c, 1); }
+
+//2 x 2 windows, stride 2
+static int set_nn_pool(dsp_bench_ctx_t *c)
+{
+	arm_nn_pool_instance_q7 *s = &c->inst.nnp;
+
+	if(c->n < 2u)
+		return 0;
+	s->in.height = s->in.width = (uint16_t)c->n;
+	s->out.height = s->out.width = (uint16_t)(c->n / 2u);
+	s->in.channels = s->out.channels = DSP_BENCH_NN_CH;
+	s->kernelH = s->kernelW = 2;
+	s->strideH = s->strideW = 2;
+	s->padH = s->padW = 0;
+	s->actMin = -128;
+	s->actMax = 127;
+	c->samples = c->n * c->n * DSP_BENCH_NN_CH;
+	c->outputs = c->samples / 4u;
+	return 1;
+}
+
+//n inputs, DSP_BENCH_NN_CH outputs
+static int set_nn_fc(dsp_bench_ctx_t *c)
+{
+	arm_nn_fc_instance_q7 *s = &c->inst.nnf;
+
+	s->inLen = (uint16_t)c->n;
+	s->outLen = DSP_BENCH_NN_CH;
+	s->pWeights = Q7(c->c);
+	s->pBias = 0;
+	s->quant = set_nn_quant(c);
+	c->samples = c->n;
+	c->outputs = DSP_BENCH_NN_CH;
+	return 1;
+}
+
+static int set_nn_softmax(dsp_bench_ctx_t *c)
+{
+	arm_softmax_init_q7(Q15(c->d), 0.0625f);
+	return set_vec(c);
+}
+
+static void run_arm_convolve_q7(dsp_bench_ctx_t *c)      { arm_convolve_q7(&c->inst.nnc, Q7(c->a), Q7(c->b), Q15(c->d)); }
+static void run_arm_convolve_1x1_q7(dsp_bench_ctx_t *c)  { arm_convolve_1x1_q7(&c->inst.nnc, Q7(c->a), Q7(c->b), Q15(c->d)); }
+static void run_arm_depthwise_conv_q7(dsp_bench_ctx_t *c) { arm_depthwise_conv_q7(&c->inst.nnc, Q7(c->a), Q7(c->b)); }
+static void run_arm_fully_connected_q7(dsp_bench_ctx_t *c) { arm_fully_connected_q7(&c->inst.nnf, Q7(c->a), Q7(c->b), Q15(c->d)); }
+static void run_arm_max_pool_q7(dsp_bench_ctx_t *c)      { arm_max_pool_q7(&c->inst.nnp, Q7(c->a), Q7(c->b)); }
+static void run_arm_avg_pool_q7(dsp_bench_ctx_t *c)      { arm_avg_pool_q7(&c->inst.nnp, Q7(c->a), Q7(c->b)); }
+static void run_arm_relu_q7(dsp_bench_ctx_t *c)          { arm_relu_q7(Q7(c->a), c->n); }
+static void run_arm_softmax_q7(dsp_bench_ctx_t *c)       { arm_softmax_q7(Q7(c->a), Q7(c->b), c->n, Q15(c->d)); }
+
+/* --------------------------------------------------------------- table */
+
+#define K(fn, sweep, type, setup)   { #fn, sweep, type, setup, run_##fn }
+
+static const dsp_bench_kernel_t s_bench_kernels[] =
+{
+	/* BasicMathFunctions */
+	K(arm_abs_f32,      SW_VEC, T_F32, set_vec),
+	K(arm_abs_q31,      SW_VEC, T_Q31, set_vec),
+	K(arm_abs_q15,      SW_VEC, T_Q15, set_vec),
+	K(arm_abs_q7,       SW_VEC, T_Q7,  set_vec),
+	K(arm_add_f32,      SW_VEC, T_F32, set_vec),
+	K(arm_add_q31,      SW_VEC, T_Q31, set_vec),
+	K(arm_add_q15,      SW_VEC, T_Q15, set_vec),
+	K(arm_add_q7,       SW_VEC, T_Q7,  set_vec),
+	K(arm_dot_prod_f32, SW_VEC, T_F32, set_red),
+	K(arm_dot_prod_q31, SW_VEC, T_Q31, set_red),
+	K(arm_dot_prod_q15, SW_VEC, T_Q15, set_red),
+	K(arm_dot_prod_q7,  SW_VEC, T_Q7,  set_red),
+	K(arm_dot_prod_f16, SW_VEC, T_F32, set_red_f16),
+	K(arm_dot_prod_f16_f32, SW_VEC, T_F32, set_red_f16),
+	K(arm_mult_f32,     SW_VEC, T_F32, set_vec),
+	K(arm_mult_q31,     SW_VEC, T_Q31, set_vec),
+	K(arm_mult_q15,     SW_VEC, T_Q15, set_vec),
+	K(arm_mult_q7,      SW_VEC, T_Q7,  set_vec),
+	K(arm_mult_f16_f32, SW_VEC, T_F32, set_vec_f16),
+	K(arm_negate_f32,   SW_VEC, T_F32, set_vec),
+	K(arm_negate_q31,   SW_VEC, T_Q31, set_vec),
+	K(arm_negate_q15,   SW_VEC, T_Q15, set_vec),
+	K(arm_negate_q7,    SW_VEC, T_Q7,  set_vec),
+	K(arm_offset_f32,   SW_VEC, T_F32, set_vec),
+	K(arm_offset_q31,   SW_VEC, T_Q31, set_vec),
+	K(arm_offset_q15,   SW_VEC, T_Q15, set_vec),
+	K(arm_offset_q7,    SW_VEC, T_Q7,  set_vec),
+	K(arm_scale_f32,    SW_VEC, T_F32, set_vec),
+	K(arm_scale_q31,    SW_VEC, T_Q31, set_vec),
+	K(arm_scale_q15,    SW_VEC, T_Q15, set_vec),
+	K(arm_scale_q7,     SW_VEC, T_Q7,  set_vec),
+	K(arm_shift_q31,    SW_VEC, T_Q31, set_vec),
+	K(arm_shift_q15,    SW_VEC, T_Q15, set_vec),
+	K(arm_shift_q7,     SW_VEC, T_Q7,  set_vec),
+	K(arm_sub_f32,      SW_VEC, T_F32, set_vec),
+	K(arm_sub_q31,      SW_VEC, T_Q31, set_vec),
+	K(arm_sub_q15,      SW_VEC, T_Q15, set_vec),
+	K(arm_sub_q7,       SW_VEC, T_Q7,  set_vec),
+
+	/* ComplexMathFunctions, n complex samples */
+	K(arm_cmplx_conj_f32,         SW_VEC, T_F32, set_vec),
+	K(arm_cmplx_conj_q31,         SW_VEC, T_Q31, set_vec),
+	K(arm_cmplx_conj_q15,         SW_VEC, T_Q15, set_vec),
+	K(arm_cmplx_dot_prod_f32,     SW_VEC, T_F32, set_red),
+	K(arm_cmplx_dot_prod_q31,     SW_VEC, T_Q31, set_red),
+	K(arm_cmplx_dot_prod_q15,     SW_VEC, T_Q15, set_red),
+	K(arm_cmplx_mag_f32,          SW_VEC, T_F32, set_vec),
+	K(arm_cmplx_mag_q31,          SW_VEC, T_Q31, set_vec),
+	K(arm_cmplx_mag_q15,          SW_VEC, T_Q15, set_vec),
+	K(arm_cmplx_mag_squared_f32,  SW_VEC, T_F32, set_vec),
+	K(arm_cmplx_mag_squared_q31,  SW_VEC, T_Q31, set_vec),
+	K(arm_cmplx_mag_squared_q15,  SW_VEC, T_Q15, set_vec),
+	K(arm_cmplx_mult_cmplx_f32,   SW_VEC, T_F32, set_vec),
+	K(arm_cmplx_mult_cmplx_q31,   SW_VEC, T_Q31, set_vec),
+	K(arm_cmplx_mult_cmplx_q15,   SW_VEC, T_Q15, set_vec),
+	K(arm_cmplx_mult_real_f32,    SW_VEC, T_F32, set_vec),
+	K(arm_cmplx_mult_real_q31,    SW_VEC, T_Q31, set_vec),
+	K(arm_cmplx_mult_real_q15,    SW_VEC, T_Q15, set_vec),
+
+	/* ControllerFunctions, one call per sample */
+	K(arm_pid_f32,        SW_VEC, T_F32, set_pid_f32),
+	K(arm_pid_q31,        SW_VEC, T_Q31, set_pid_q31),
+	K(arm_pid_q15,        SW_VEC, T_Q15, set_pid_q15),
+	K(arm_sin_cos_f32,    SW_VEC, T_F32, set_vec),
+	K(arm_sin_cos_q31,    SW_VEC, T_Q31, set_vec),
+	K(arm_clarke_f32,     SW_VEC, T_F32, set_vec),
+	K(arm_clarke_q31,     SW_VEC, T_Q31, set_vec),
+	K(arm_inv_clarke_f32, SW_VEC, T_F32, set_vec),
+	K(arm_inv_clarke_q31, SW_VEC, T_Q31, set_vec),
+	K(arm_park_f32,       SW_VEC, T_F32, set_vec),
+	K(arm_park_q31,       SW_VEC, T_Q31, set_vec),
+	K(arm_inv_park_f32,   SW_VEC, T_F32, set_vec),
+	K(arm_inv_park_q31,   SW_VEC, T_Q31, set_vec),
+
+	/* ControllerFunctions, n loops or samples per call */
+	K(arm_pid_batch_f32,        SW_VEC, T_F32, set_pid_batch_f32),
+	K(arm_pid_batch_q31,        SW_VEC, T_Q31, set_pid_batch_q31),
+	K(arm_pid_batch_q15,        SW_VEC, T_Q15, set_pid_batch_q15),
+	K(arm_clarke_batch_f32,     SW_VEC, T_F32, set_vec),
+	K(arm_clarke_batch_q31,     SW_VEC, T_Q31, set_vec),
+	K(arm_inv_clarke_batch_f32, SW_VEC, T_F32, set_vec),
+	K(arm_inv_clarke_batch_q31, SW_VEC, T_Q31, set_vec),
+	K(arm_park_batch_f32,       SW_VEC, T_F32, set_vec),
+	K(arm_park_batch_q31,       SW_VEC, T_Q31, set_vec),
+	K(arm_inv_park_batch_f32,   SW_VEC, T_F32, set_vec),
+	K(arm_inv_park_batch_q31,   SW_VEC, T_Q31, set_vec),
+
+	/* FastMathFunctions, one call per sample */
+	K(arm_cos_f32,  SW_VEC, T_F32, set_vec),
+	K(arm_cos_q31,  SW_VEC, T_Q31, set_vec),
+	K(arm_cos_q15,  SW_VEC, T_Q15, set_vec),
+	K(arm_sin_f32,  SW_VEC, T_F32, set_vec),
+	K(arm_sin_q31,  SW_VEC, T_Q31, set_vec),
+	K(arm_sin_q15,  SW_VEC, T_Q15, set_vec),
+	K(arm_sqrt_q31, SW_VEC, T_Q31, set_vec),
+	K(arm_sqrt_q15, SW_VEC, T_Q15, set_vec),
+
+	/* FastMathFunctions, block kernels */
+	K(arm_vexp_f32,     SW_VEC, T_F32, set_vec),
+	K(arm_vexp_q31,     SW_VEC, T_Q31, set_neg_q31),
+	K(arm_vexp_q15,     SW_VEC, T_Q15, set_neg_q15),
+	K(arm_vlog_f32,     SW_VEC, T_F32, set_pos_f32),
+	K(arm_vlog10_f32,   SW_VEC, T_F32, set_pos_f32),
+	K(arm_vlog_q31,     SW_VEC, T_Q31, set_pos_q31),
+	K(arm_vlog_q15,     SW_VEC, T_Q15, set_pos_q15),
+	K(arm_vlog10_q15,   SW_VEC, T_Q15, set_pos_q15),
+	K(arm_vlog10_q31,   SW_VEC, T_Q31, set_pos_q31),
+	K(arm_vatan2_f32,   SW_VEC, T_F32, set_vec),
+	K(arm_vatan2_q31,   SW_VEC, T_Q31, set_vec),
+	K(arm_vatan2_q15,   SW_VEC, T_Q15, set_vec),
+	K(arm_vtanh_f32,    SW_VEC, T_F32, set_vec),
+	K(arm_vtanh_q31,    SW_VEC, T_Q31, set_vec),
+	K(arm_vtanh_q15,    SW_VEC, T_Q15, set_vec),
+	K(arm_vsigmoid_f32, SW_VEC, T_F32, set_vec),
+	K(arm_vsigmoid_q31, SW_VEC, T_Q31, set_vec),
+	K(arm_vsigmoid_q15, SW_VEC, T_Q15, set_vec),
+	K(arm_vsqrt_f32,    SW_VEC, T_F32, set_pos_f32),
+	K(arm_vrsqrt_f32,   SW_VEC, T_F32, set_pos_f32),
+	K(arm_vsqrt_q31,    SW_VEC, T_Q31, set_pos_q31),
+	K(arm_vsqrt_q15,    SW_VEC, T_Q15, set_pos_q15),
+	K(arm_vrsqrt_q15,   SW_VEC, T_Q15, set_pos_q15),
+	K(arm_vrsqrt_q31,   SW_VEC, T_Q31, set_pos_q31),
+
+	/* FilteringFunctions */
+	K(arm_fir_f32,                   SW_FIR, T_F32, set_fir_f32),
+	K(arm_fir_fft_f32,               SW_FIR, T_F32, set_fir_fft_f32),
+	K(arm_fir_f16_f32,               SW_FIR, T_F32, set_fir_f16_f32),
+	K(arm_fir_q31,                   SW_FIR, T_Q31, set_fir_q31),
+	K(arm_fir_fast_q31,              SW_FIR, T_Q31, set_fir_q31),
+	K(arm_fir_q15,                   SW_FIR, T_Q15, set_fir_q15),
+	K(arm_fir_fast_q15,              SW_FIR, T_Q15, set_fir_q15),
+	K(arm_fir_q7,                    SW_FIR, T_Q7,  set_fir_q7),
+	K(arm_fir_decimate_f32,          SW_FIR, T_F32, set_dec_f32),
+	K(arm_fir_decimate_q31,          SW_FIR, T_Q31, set_dec_q31),
+	K(arm_fir_decimate_fast_q31,     SW_FIR, T_Q31, set_dec_q31),
+	K(arm_fir_decimate_q15,          SW_FIR, T_Q15, set_dec_q15),
+	K(arm_fir_decimate_fast_q15,     SW_FIR, T_Q15, set_dec_q15),
+	K(arm_fir_interpolate_f32,       SW_FIR, T_F32, set_int_f32),
+	K(arm_fir_interpolate_q31,       SW_FIR, T_Q31, set_int_q31),
+	K(arm_fir_interpolate_q15,       SW_FIR, T_Q15, set_int_q15),
+	K(arm_fir_resample_f32,          SW_FIR, T_F32, set_rs_f32),
+	K(arm_fir_resample_q31,          SW_FIR, T_Q31, set_rs_q31),
+	K(arm_fir_resample_q15,          SW_FIR, T_Q15, set_rs_q15),
+	K(arm_cic_decimate_q31,          SW_FIR, T_Q31, set_cic_q31),
+	K(arm_cic_decimate_fast_q31,     SW_FIR, T_Q31, set_cic_q31),
+	K(arm_fir_halfband_decimate_q31, SW_FIR, T_Q31, set_hb_q31),
+	K(arm_decimate_chain_q31,        SW_FIR, T_Q31, set_dch_q31),
+	K(arm_fir_lattice_f32,           SW_FIR, T_F32, set_fl_f32),
+	K(arm_fir_lattice_q31,           SW_FIR, T_Q31, set_fl_q31),
+	K(arm_fir_lattice_q15,           SW_FIR, T_Q15, set_fl_q15),
+	K(arm_fir_sparse_f32,            SW_FIR, T_F32, set_sp_f32),
+	K(arm_fir_sparse_q31,            SW_FIR, T_Q31, set_sp_q31),
+	K(arm_fir_sparse_q15,            SW_FIR, T_Q15, set_sp_q15),
+	K(arm_fir_sparse_q7,             SW_FIR, T_Q7,  set_sp_q7),
+	K(arm_iir_lattice_f32,           SW_FIR, T_F32, set_il_f32),
+	K(arm_iir_lattice_q31,           SW_FIR, T_Q31, set_il_q31),
+	K(arm_iir_lattice_q15,           SW_FIR, T_Q15, set_il_q15),
+	K(arm_lms_f32,                   SW_FIR, T_F32, set_lms_f32),
+	K(arm_lms_q31,                   SW_FIR, T_Q31, set_lms_q31),
+	K(arm_lms_q15,                   SW_FIR, T_Q15, set_lms_q15),
+	K(arm_lms_norm_f32,              SW_FIR, T_F32, set_nlms_f32),
+	K(arm_lms_fd_f32,                SW_FIR, T_F32, set_lms_fd_f32),
+	K(arm_lms_norm_q31,              SW_FIR, T_Q31, set_nlms_q31),
+	K(arm_lms_norm_q15,              SW_FIR, T_Q15, set_nlms_q15),
+	K(arm_biquad_cascade_df1_f32,        SW_IIR, T_F32, set_df1_f32),
+	K(arm_biquad_cascade_df1_q31,        SW_IIR, T_Q31, set_df1_q31),
+	K(arm_biquad_cascade_df1_fast_q31,   SW_IIR, T_Q31, set_df1_q31),
+	K(arm_biquad_cas_df1_32x64_q31,      SW_IIR, T_Q31, set_df1_32x64),
+	K(arm_biquad_cascade_df1_q15,        SW_IIR, T_Q15, set_df1_q15),
+	K(arm_biquad_cascade_df1_fast_q15,   SW_IIR, T_Q15, set_df1_q15),
+	K(arm_biquad_cascade_df2T_f32,       SW_IIR, T_F32, set_df2t_f32),
+	K(arm_biquad_cascade_df2T_f64,       SW_IIR, T_F64, set_df2t_f64),
+	K(arm_biquad_cascade_stereo_df2T_f32, SW_IIR, T_F32, set_sdf2t_f32),
+	K(arm_biquad_cascade_mc_df2T_f32,    SW_MC,  T_F32, set_mdf2t_f32),
+	K(arm_biquad_cascade_mc_planar_df2T_f32, SW_MC, T_F32, set_mdf2t_f32),
+	K(arm_biquad_cascade_mc_df1_q31,     SW_MC,  T_Q31, set_mdf1_q31),
+	K(arm_biquad_cascade_mc_planar_df1_q31, SW_MC, T_Q31, set_mdf1_q31),
+	K(arm_conv_f32,                  SW_FIR, T_F32, set_conv),
+	K(arm_conv_q31,                  SW_FIR, T_Q31, set_conv),
+	K(arm_conv_fast_q31,             SW_FIR, T_Q31, set_conv),
+	K(arm_conv_q15,                  SW_FIR, T_Q15, set_conv),
+	K(arm_conv_fast_q15,             SW_FIR, T_Q15, set_conv),
+	K(arm_conv_opt_q15,              SW_FIR, T_Q15, set_conv),
+	K(arm_conv_fast_opt_q15,         SW_FIR, T_Q15, set_conv),
+	K(arm_conv_q7,                   SW_FIR, T_Q7,  set_conv),
+	K(arm_conv_opt_q7,               SW_FIR, T_Q7,  set_conv),
+	K(arm_conv_partial_f32,          SW_FIR, T_F32, set_conv_partial),
+	K(arm_conv_partial_q31,          SW_FIR, T_Q31, set_conv_partial),
+	K(arm_conv_partial_fast_q31,     SW_FIR, T_Q31, set_conv_partial),
+	K(arm_conv_partial_q15,          SW_FIR, T_Q15, set_conv_partial),
+	K(arm_conv_partial_fast_q15,     SW_FIR, T_Q15, set_conv_partial),
+	K(arm_conv_partial_opt_q15,      SW_FIR, T_Q15, set_conv_partial),
+	K(arm_conv_partial_fast_opt_q15, SW_FIR, T_Q15, set_conv_partial),
+	K(arm_conv_partial_q7,           SW_FIR, T_Q7,  set_conv_partial),
+	K(arm_conv_partial_opt_q7,       SW_FIR, T_Q7,  set_conv_partial),
+	K(arm_correlate_f32,             SW_FIR, T_F32, set_corr),
+	K(arm_correlate_q31,             SW_FIR, T_Q31, set_corr),
+	K(arm_correlate_fast_q31,        SW_FIR, T_Q31, set_corr),
+	K(arm_correlate_q15,             SW_FIR, T_Q15, set_corr),
+	K(arm_correlate_fast_q15,        SW_FIR, T_Q15, set_corr),
+	K(arm_correlate_opt_q15,         SW_FIR, T_Q15, set_corr),
+	K(arm_correlate_fast_opt_q15,    SW_FIR, T_Q15, set_corr),
+	K(arm_correlate_q7,              SW_FIR, T_Q7,  set_corr),
+	K(arm_correlate_opt_q7,          SW_FIR, T_Q7,  set_corr),
+
+	/* MatrixFunctions, n x n */
+	K(arm_mat_add_f32,         SW_MAT, T_F32, set_mat_f32),
+	K(arm_mat_add_q31,         SW_MAT, T_Q31, set_mat_q31),
+	K(arm_mat_add_q15,         SW_MAT, T_Q15, set_mat_q15),
+	K(arm_mat_cmplx_mult_f32,  SW_MAT, T_F32, set_mat_f32),
+	K(arm_mat_cmplx_mult_q31,  SW_MAT, T_Q31, set_mat_q31),
+	K(arm_mat_cmplx_mult_q15,  SW_MAT, T_Q15, set_mat_q15),
+	K(arm_mat_inverse_f32,     SW_MAT, T_F32, set_inv_f32),
+	K(arm_mat_inverse_f64,     SW_MAT, T_F64, set_inv_f64),
+	K(arm_mat_mult_f32,        SW_MAT, T_F32, set_mat_f32),
+	K(arm_mat_mult_f64,        SW_MAT, T_F64, set_mat_f64),
+	K(arm_mat_vec_mult_f16_f32, SW_MAT, T_F32, set_mat_vec_f16),
+	K(arm_mat_cholesky_f32,    SW_MAT, T_F32, set_inv_f32),
+	K(arm_mat_cholesky_f64,    SW_MAT, T_F64, set_inv_f64),
+	K(arm_mat_cholesky_solve_f32, SW_MAT, T_F32, set_inv_f32),
+	K(arm_mat_cholesky_solve_f64, SW_MAT, T_F64, set_inv_f64),
+	K(arm_mat_ldlt_f32,        SW_MAT, T_F32, set_inv_f32),
+	K(arm_mat_ldlt_f64,        SW_MAT, T_F64, set_inv_f64),
+	K(arm_mat_qr_f32,          SW_MAT, T_F32, set_inv_f32),
+	K(arm_mat_qr_f64,          SW_MAT, T_F64, set_inv_f64),
+	K(arm_mat_qr_solve_f32,    SW_MAT, T_F32, set_inv_f32),
+	K(arm_mat_qr_solve_f64,    SW_MAT, T_F64, set_inv_f64),
+	K(arm_mat_solve_lower_triangular_f32, SW_MAT, T_F32, set_inv_f32),
+	K(arm_mat_solve_lower_triangular_f64, SW_MAT, T_F64, set_inv_f64),
+	K(arm_mat_mult_q31,        SW_MAT, T_Q31, set_mat_q31),
+	K(arm_mat_mult_fast_q31,   SW_MAT, T_Q31, set_mat_q31),
+	K(arm_mat_mult_q15,        SW_MAT, T_Q15, set_mat_q15),
+	K(arm_mat_mult_fast_q15,   SW_MAT, T_Q15, set_mat_q15),
+	K(arm_mat_scale_f32,       SW_MAT, T_F32, set_mat_f32),
+	K(arm_mat_scale_q31,       SW_MAT, T_Q31, set_mat_q31),
+	K(arm_mat_scale_q15,       SW_MAT, T_Q15, set_mat_q15),
+	K(arm_mat_sub_f32,         SW_MAT, T_F32, set_mat_f32),
+	K(arm_mat_sub_q31,         SW_MAT, T_Q31, set_mat_q31),
+	K(arm_mat_sub_q15,         SW_MAT, T_Q15, set_mat_q15),
+	K(arm_mat_trans_f32,       SW_MAT, T_F32, set_mat_f32),
+	K(arm_mat_trans_q31,       SW_MAT, T_Q31, set_mat_q31),
+	K(arm_mat_trans_q15,       SW_MAT, T_Q15, set_mat_q15),
+	K(arm_mat_vec_mult_f32,     SW_SPM, T_F32, set_spm_f32),
+	K(arm_mat_vec_mult_q31,     SW_SPM, T_Q31, set_spm_q31),
+	K(arm_mat_vec_mult_q15,     SW_SPM, T_Q15, set_spm_q15),
+	K(arm_mat_csr_vec_mult_f32, SW_SPM, T_F32, set_spm_f32),
+	K(arm_mat_csr_vec_mult_q31, SW_SPM, T_Q31, set_spm_q31),
+	K(arm_mat_csr_vec_mult_q15, SW_SPM, T_Q15, set_spm_q15),
+	K(arm_mat_csr_mult_f32,     SW_SPM, T_F32, set_spm_mult_f32),
+	K(arm_mat_csr_mult_q31,     SW_SPM, T_Q31, set_spm_mult_q31),
+	K(arm_mat_csr_mult_q15,     SW_SPM, T_Q15, set_spm_mult_q15),
+	K(arm_mat_band_vec_mult_f32, SW_SPM, T_F32, set_band_f32),
+	K(arm_mat_band_vec_mult_q31, SW_SPM, T_Q31, set_band_q31),
+	K(arm_mat_band_vec_mult_q15, SW_SPM, T_Q15, set_band_q15),
+
+	/* StatisticsFunctions */
+	K(arm_max_f32,   SW_VEC, T_F32, set_red),
+	K(arm_max_q31,   SW_VEC, T_Q31, set_red),
+	K(arm_max_q15,   SW_VEC, T_Q15, set_red),
+	K(arm_max_q7,    SW_VEC, T_Q7,  set_red),
+	K(arm_mean_f32,  SW_VEC, T_F32, set_red),
+	K(arm_mean_q31,  SW_VEC, T_Q31, set_red),
+	K(arm_mean_q15,  SW_VEC, T_Q15, set_red),
+	K(arm_mean_q7,   SW_VEC, T_Q7,  set_red),
+	K(arm_min_f32,   SW_VEC, T_F32, set_red),
+	K(arm_min_q31,   SW_VEC, T_Q31, set_red),
+	K(arm_min_q15,   SW_VEC, T_Q15, set_red),
+	K(arm_min_q7,    SW_VEC, T_Q7,  set_red),
+	K(arm_power_f32, SW_VEC, T_F32, set_red),
+	K(arm_power_q31, SW_VEC, T_Q31, set_red),
+	K(arm_power_q15, SW_VEC, T_Q15, set_red),
+	K(arm_power_q7,  SW_VEC, T_Q7,  set_red),
+	K(arm_rms_f32,   SW_VEC, T_F32, set_red),
+	K(arm_rms_q31,   SW_VEC, T_Q31, set_red),
+	K(arm_rms_q15,   SW_VEC, T_Q15, set_red),
+	K(arm_std_f32,   SW_VEC, T_F32, set_red),
+	K(arm_std_q31,   SW_VEC, T_Q31, set_red),
+	K(arm_std_q15,   SW_VEC, T_Q15, set_red),
+	K(arm_var_f32,   SW_VEC, T_F32, set_red),
+	K(arm_var_q31,   SW_VEC, T_Q31, set_red),
+	K(arm_var_q15,   SW_VEC, T_Q15, set_red),
+	K(arm_percentile_f32,    SW_VEC, T_F32, set_red),
+	K(arm_percentile_q31,    SW_VEC, T_Q31, set_red),
+	K(arm_percentile_q15,    SW_VEC, T_Q15, set_red),
+	K(arm_median_filter_f32, SW_FIR, T_F32, set_med_f32),
+	K(median_qsort_f32,      SW_FIR, T_F32, set_med_qsort_f32),
+	K(arm_median_filter_q31, SW_FIR, T_Q31, set_med_q31),
+	K(arm_median_filter_q15, SW_FIR, T_Q15, set_med_q15),
+
+	/* SupportFunctions */
+	K(arm_copy_f32,      SW_VEC, T_F32, set_vec),
+	K(arm_copy_q31,      SW_VEC, T_Q31, set_vec),
+	K(arm_copy_q15,      SW_VEC, T_Q15, set_vec),
+	K(arm_copy_q7,       SW_VEC, T_Q7,  set_vec),
+	K(arm_fill_f32,      SW_VEC, T_F32, set_vec),
+	K(arm_fill_q31,      SW_VEC, T_Q31, set_vec),
+	K(arm_fill_q15,      SW_VEC, T_Q15, set_vec),
+	K(arm_fill_q7,       SW_VEC, T_Q7,  set_vec),
+	K(arm_float_to_q31,  SW_VEC, T_F32, set_vec),
+	K(arm_float_to_q15,  SW_VEC, T_F32, set_vec),
+	K(arm_float_to_q7,   SW_VEC, T_F32, set_vec),
+	K(arm_q31_to_float,  SW_VEC, T_Q31, set_vec),
+	K(arm_q31_to_q15,    SW_VEC, T_Q31, set_vec),
+	K(arm_q31_to_q7,     SW_VEC, T_Q31, set_vec),
+	K(arm_q15_to_float,  SW_VEC, T_Q15, set_vec),
+	K(arm_q15_to_q31,    SW_VEC, T_Q15, set_vec),
+	K(arm_q15_to_q7,     SW_VEC, T_Q15, set_vec),
+	K(arm_q7_to_float,   SW_VEC, T_Q7,  set_vec),
+	K(arm_q7_to_q31,     SW_VEC, T_Q7,  set_vec),
+	K(arm_q7_to_q15,     SW_VEC, T_Q7,  set_vec),
+	K(arm_float_to_f16,  SW_VEC, T_F32, set_vec),
+	K(arm_f16_to_float,  SW_VEC, T_F32, set_vec_f16),
+
+	/* InterpolationFunctions, m knots */
+	K(arm_spline_f32,    SW_FIR, T_F32, set_spline_f32),
+	K(arm_spline_q31,    SW_FIR, T_Q31, set_spline_q31),
+
+	/* TransformFunctions, in place on a except the real transforms */
+	K(arm_cfft_f32,          SW_FFT, T_F32, set_cfft_f32),
+	K(arm_cfft_q31,          SW_FFT, T_Q31, set_cfft_q31),
+	K(arm_cfft_q15,          SW_FFT, T_Q15, set_cfft_q15),
+	K(arm_cfft_bfp_q31,      SW_FFT, T_Q31, set_cfft_q31),
+	K(arm_cfft_bfp_q15,      SW_FFT, T_Q15, set_cfft_q15),
+	K(arm_cfft_mixed_f32,    SW_FFT, T_F32, set_cfft_mixed_f32),
+	K(arm_cfft_radix2_f32,   SW_FFT, T_F32, set_r2_f32),
+	K(arm_cfft_radix2_q31,   SW_FFT, T_Q31, set_r2_q31),
+	K(arm_cfft_radix2_q15,   SW_FFT, T_Q15, set_r2_q15),
+	K(arm_cfft_radix4_f32,   SW_FFT, T_F32, set_r4_f32),
+	K(arm_cfft_radix4_q31,   SW_FFT, T_Q31, set_r4_q31),
+	K(arm_cfft_radix4_q15,   SW_FFT, T_Q15, set_r4_q15),
+	K(arm_rfft_f32,          SW_FFT, T_F32, set_rfft_f32),
+	K(arm_rfft_fast_f32,     SW_FFT, T_F32, set_rfft_fast_f32),
+	K(arm_rfft_mixed_f32,    SW_FFT, T_F32, set_rfft_mixed_f32),
+	K(arm_rfft_q31,          SW_FFT, T_Q31, set_rfft_q31),
+	K(arm_rfft_q15,          SW_FFT, T_Q15, set_rfft_q15),
+	K(arm_rfft_bfp_q31,      SW_FFT, T_Q31, set_rfft_q31),
+	K(arm_rfft_bfp_q15,      SW_FFT, T_Q15, set_rfft_q15),
+	K(arm_dct4_f32,          SW_FFT, T_F32, set_dct4_f32),
+	K(arm_dct4_q31,          SW_FFT, T_Q31, set_dct4_q31),
+	K(arm_dct4_q15,          SW_FFT, T_Q15, set_dct4_q15),
+	K(arm_goertzel_f32,      SW_FIR, T_F32, set_goertzel_f32),
+	K(arm_goertzel_q31,      SW_FIR, T_Q31, set_goertzel_q31),
+	K(arm_sdft_f32,          SW_FIR, T_F32, set_sdft_f32),
+	K(arm_stft_f32,          SW_FFT, T_F32, set_stft_f32),
+
+	/* NNFunctions, n x n images of DSP_BENCH_NN_CH channels */
+	K(arm_convolve_q7,           SW_MAT, T_Q7,  set_nn_conv3),
+	K(arm_convolve_1x1_q7,       SW_MAT, T_Q7,  set_nn_conv1),
+	K(arm_depthwise_conv_q7,     SW_MAT, T_Q7,  set_nn_conv3),
+	K(arm_max_pool_q7,           SW_MAT, T_Q7,  set_nn_pool),
+	K(arm_avg_pool_q7,           SW_MAT, T_Q7,  set_nn_pool),
+	K(arm_fully_connected_q7,    SW_VEC, T_Q7,  set_nn_fc),
+	K(arm_relu_q7,               SW_VEC, T_Q7,  set_vec),
+	K(arm_softmax_q7,            SW_VEC, T_Q7,  set_nn_softmax),
+};
+
+#define DSP_BENCH_KERNELS   (sizeof(s_bench_kernels) / sizeof(s_bench_kernels[0]))
+
+/* --------------------------------------------------------------- sweeps */
+
+typedef struct
+{
+	const uint16_t *n;
+	uint8_t         nn;
+	const uint16_t *m;
+	uint8_t         nm;
+} dsp_bench_sweep_t;
+
+static const uint16_t s_bench_vec_n[] = { 16, 64, 256, 1024 };
+static const uint16_t s_bench_blk_n[] = { 64, 256 };
+static const uint16_t s_bench_fir_m[] = { 8, 32, 128 };
+static const uint16_t s_bench_iir_m[] = { 1, 2, 4, 8 };
+static const uint16_t s_bench_mc_m[]  = { 1, 2, 4, 8, 16 };
+static const uint16_t s_bench_fft_n[] = { 16, 32, 64, 128, 256, 512, 1024, 2048 };
+static const uint16_t s_bench_mat_n[] = { 4, 8, 16, 32 };
+static const uint16_t s_bench_spm_n[] = { 16, 32, 64 };
+static const uint16_t s_bench_spm_m[] = { 5, 10, 25, 50 };
+static const uint16_t s_bench_none[]  = { 0 };
+
+#define SWEEP(n, m)     { n, sizeof(n) / sizeof(n[0]), m, sizeof(m) / sizeof(m[0]) }
+
+static const dsp_bench_sweep_t s_bench_sweeps[SW_NUM] =
+{
+	SWEEP(s_bench_vec_n, s_bench_none),
+	SWEEP(s_bench_blk_n, s_bench_fir_m),
+	SWEEP(s_bench_blk_n, s_bench_iir_m),
+	SWEEP(s_bench_blk_n, s_bench_mc_m),
+	SWEEP(s_bench_fft_n, s_bench_none),
+	SWEEP(s_bench_mat_n, s_bench_none),
+	SWEEP(s_bench_spm_n, s_bench_spm_m),
+};
+
+static const uint8_t s_bench_type_size[] = { 4, 8, 4, 2, 1 };
+
+/* ---------------------------------------------------------------- engine */
+
+static uint32_t s_bench_seed;
+
+static uint32_t dsp_bench_rand(void)
+{
+	s_bench_seed = s_bench_seed * 1664525u + 1013904223u;
+	return s_bench_seed;
+}
+
+//uniform values a quarter of full scale, so sums and products do not saturate
+static void dsp_bench_fill(uint8_t *p, uint8_t type, uint32_t count)
+{
+	uint32_t i;
+
+	for(i = 0; i < count; i++)
+	{
+		int32_t r = (int32_t)dsp_bench_rand() >> 2;
+		switch(type)
+		{
+			case T_F32: F32(p)[i] = (float32_t)r * (1.0f / 2147483648.0f); break;
+			case T_F64: F64(p)[i] = (float64_t)r * (1.0 / 2147483648.0);   break;
+			case T_Q31: Q31(p)[i] = r;                                     break;
+			case T_Q15: Q15(p)[i] = (q15_t)(r >> 16);                      break;
+			default:    Q7(p)[i] = (q7_t)(r >> 24);                        break;
+		}
+	}
+}
+
+static uint32_t dsp_bench_min(uint32_t a, uint32_t b)
+{
+	return a < b ? a : b;
+}
+
+//fresh inputs and zeroed state for every run, in-place kernels destroy their input
+static void dsp_bench_prepare(const dsp_bench_kernel_t *k, dsp_bench_ctx_t *c)
+{
+	uint32_t size = s_bench_type_size[k->type];
+	uint32_t count = (k->sweep == SW_MAT) ? 2u * c->n * c->n :
+	                 (k->sweep == SW_SPM) ? c->n * c->n :
+	                 (k->sweep == SW_MC) ? c->n * c->m : 2u * (c->n > c->m ? c->n : c->m);
+
+	s_bench_seed = 0x12345678u;
+	dsp_bench_fill(c->a, k->type, dsp_bench_min(count, DSP_BENCH_A_SIZE / size));
+	dsp_bench_fill(c->c, k->type, dsp_bench_min(count, DSP_BENCH_C_SIZE / size));
+	memset(c->d, 0, DSP_BENCH_D_SIZE);
+	memset(&c->inst, 0, sizeof(c->inst));
+}
+
+static void dsp_bench_flush(void)
+{
+#ifndef HOST_BUILD
+	SCB_CleanInvalidateDCache();
+#endif
+}
+
+static void dsp_bench_nop(dsp_bench_ctx_t *c)
+{
+	(void)c;
+}
+
+//fastest of DSP_BENCH_REPS runs, 0xFFFFFFFF when the point is not supported
+static uint32_t dsp_bench_point(const dsp_bench_kernel_t *k, dsp_bench_ctx_t *c, uint32_t flags)
+{
+	void (*volatile fn)(dsp_bench_ctx_t *c) = k->run;
+	uint32_t best = 0xFFFFFFFFu;
+	uint32_t rep, t0, dt;
+
+	for(rep = 0; rep < DSP_BENCH_REPS; rep++)
+	{
+		dsp_bench_prepare(k, c);
+		if(!k->setup(c))
+			return 0xFFFFFFFFu;
+		if(flags & DSP_BENCH_COLD)
+			dsp_bench_flush();
+		t0 = prof_now();
+		fn(c);
+		dt = prof_now() - t0;
+		if(dt < best)
+			best = dt;
+	}
+	return best;
+}
+
+static uint8_t *dsp_bench_base(dsp_bench_mem_t mem)
+{
+	switch(mem)
+	{
+		case DSP_BENCH_DTCM:  return (uint8_t *)s_bench_dtcm;
+		case DSP_BENCH_SRAM1: return (uint8_t *)s_bench_sram1;
+		default:              return DSP_BENCH_SDRAM_BASE;
+	}
+}
+
+#ifndef HOST_BUILD
+/*
+ * The SDRAM is not brought up by the application. 0xC0000000 is Device
+ * memory in the default map, which faults on the unaligned accesses of the
+ * SIMD kernels and is not cached, so map it as normal write-back memory.
+ */
+static void dsp_bench_sdram_init(void)
+{
+	static uint8_t done = 0;
+	MPU_Region_InitTypeDef region;
+
+	if(done)
+		return;
+	SDRAM_Initialization_Sequence(&hsdram1);
+
+	HAL_MPU_Disable();
+	region.Enable = MPU_REGION_ENABLE;
+	region.Number = DSP_BENCH_MPU_REGION;
+	region.BaseAddress = Bank5_SDRAM_ADDR;
+	region.Size = MPU_REGION_SIZE_32MB;
+	region.SubRegionDisable = 0x00;
+	region.TypeExtField = MPU_TEX_LEVEL1;
+	region.AccessPermission = MPU_REGION_FULL_ACCESS;
+	region.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
+	region.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+	region.IsCacheable = MPU_ACCESS_CACHEABLE;
+	region.IsBufferable = MPU_ACCESS_BUFFERABLE;
+	HAL_MPU_ConfigRegion(&region);
+	HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+	done = 1;
+}
+#endif
+
+void dsp_bench_header(prof_out_t out)
+{
+	static const char hdr[] = "kernel,mem,cache,n,m,ticks,ticks_per_sample,ticks_per_output\r\n";
+	prof_write(out, hdr, sizeof(hdr) - 1u);
+}
+
+//ticks * 100 / div printed with two decimals
+static int dsp_bench_fixed(char *buf, uint32_t size, uint32_t ticks, uint32_t div)
+{
+	uint64_t v = ((uint64_t)ticks * 100u + div / 2u) / div;
+	return snprintf(buf, size, "%lu.%02lu", (unsigned long)(v / 100u), (unsigned long)(v % 100u));
+}
+
+uint32_t dsp_bench_run(prof_out_t out, dsp_bench_mem_t mem, uint32_t flags, const char *filter)
+{
+	static dsp_bench_ctx_t ctx;
+	dsp_bench_ctx_t *c = &ctx;
+	const dsp_bench_kernel_t *k;
+	const dsp_bench_sweep_t *sw;
+	dsp_bench_kernel_t nop;
+	char line[DSP_BENCH_LINE_SIZE];
+	uint32_t i, in, im, ticks, overhead, points = 0;
+	uint8_t *base;
+	int len;
+
+	if(mem >= DSP_BENCH_MEM_NUM)
+		return 0;
+#ifndef HOST_BUILD
+	if(mem == DSP_BENCH_SDRAM)
+		dsp_bench_sdram_init();
+#endif
+	base = dsp_bench_base(mem);
+	c->a = base + DSP_BENCH_A_OFS;
+	c->b = base + DSP_BENCH_B_OFS;
+	c->c = base + DSP_BENCH_C_OFS;
+	c->d = base + DSP_BENCH_D_OFS;
+
+	//cost of timing an empty call, subtracted from every point
+	nop.name = "nop";
+	nop.sweep = SW_VEC;
+	nop.type = T_Q7;
+	nop.setup = set_vec;
+	nop.run = dsp_bench_nop;
+	c->n = 16;
+	c->m = 0;
+	overhead = dsp_bench_point(&nop, c, flags);
+
+	for(i = 0; i < DSP_BENCH_KERNELS; i++)
+	{
+		k = &s_bench_kernels[i];
+		if(filter && strstr(k->name, filter) == 0)
+			continue;
+		sw = &s_bench_sweeps[k->sweep];
+		for(in = 0; in < sw->nn; in++)
+		{
+			for(im = 0; im < sw->nm; im++)
+			{
+				c->n = sw->n[in];
+				c->m = sw->m[im];
+				ticks = dsp_bench_point(k, c, flags);
+				if(ticks == 0xFFFFFFFFu)
+					continue;
+				ticks = ticks > overhead ? ticks - overhead : 0;
+
+				len = snprintf(line, sizeof(line), "%.*s,%s,%s,%lu,%lu,%lu,", DSP_BENCH_NAME_MAX, k->name, s_bench_mem_name[mem],
+				               (flags & DSP_BENCH_COLD) ? "cold" : "warm", (unsigned long)c->n,
+				               (unsigned long)c->m, (unsigned long)ticks);
+				len += dsp_bench_fixed(line + len, sizeof(line) - len, ticks, c->samples);
+				line[len++] = ',';
+				len += dsp_bench_fixed(line + len, sizeof(line) - len, ticks, c->outputs);
+				len += snprintf(line + len, sizeof(line) - len, "\r\n");
+				prof_write(out, line, (uint32_t)len);
+				points++;
+			}
+		}
+	}
+	return points;
+}
+
+void dsp_bench_run_all(prof_out_t out)
+{
+	uint32_t mem;
+
+	dsp_bench_header(out);
+	for(mem = 0; mem < DSP_BENCH_MEM_NUM; mem++)
+	{
+		dsp_bench_run(out, (dsp_bench_mem_t)mem, 0, 0);
+		dsp_bench_run(out, (dsp_bench_mem_t)mem, DSP_BENCH_COLD, 0);
+	}
+}
+
+#if defined(HOST_BUILD) && defined(DSP_BENCH_MAIN)
+int main(int argc, char **argv)
+{
+	prof_init();
+	dsp_bench_header(PROF_OUT_STDOUT);
+	dsp_bench_run(PROF_OUT_STDOUT, DSP_BENCH_DTCM, 0, argc > 1 ? argv[1] : 0);
+	return 0;
+}
+#endif
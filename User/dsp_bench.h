@@ -0,0 +1,64 @@
+#ifndef _dsp_bench_H_
+#define _dsp_bench_H_
+
+/*
+ * CMSIS-DSP kernel benchmark.
+ *
+ * Every kernel in DSP_Lib/Source is swept over a fixed grid of sizes:
+ *   vector kernels     n = 16, 64, 256, 1024
+ *   FIR, conv, LMS     block n = 64, 256  x  taps m = 8, 32, 128
+ *   CIC, chain         block n = 64, 256  x  decimation factor m = 8, 32, 128
+ *   biquads            block n = 64, 256  x  stages m = 1, 2, 4, 8
+ *   multichannel IIR   block n = 64, 256  x  channels m = 1, 2, 4, 8, 16 (4 stages)
+ *   transforms         length n = 16 ... 2048 (lengths a kernel rejects are skipped)
+ *   matrices           n x n, n = 4, 8, 16, 32
+ *   sparse matrices    n x n, n = 16, 32, 64  x  percent non-zero m = 5, 10, 25, 50
+ *   NN layers          n x n x 8 images, fully connected n inputs x 8 outputs
+ * median_qsort_f32, next to arm_median_filter_f32, is not a library kernel
+ * but the sort-per-window baseline the sliding median is measured against.
+ * All buffers (source, destination, coefficients, state) are placed in
+ * DTCM, SRAM1 or SDRAM. Each point is set up again before every run, timed
+ * DSP_BENCH_REPS times with prof_now() and the fastest run is kept, minus
+ * the cost of an empty call. With DSP_BENCH_COLD the D-cache is cleaned and
+ * invalidated before each timed run.
+ *
+ * Results are CSV, one line per point in table order, so two runs diff
+ * line by line:
+ *   kernel,mem,cache,n,m,ticks,ticks_per_sample,ticks_per_output
+ * ticks are core cycles on target and nanoseconds with HOST_BUILD, the
+ * per sample/output columns have two fixed decimals.
+ *
+ * The DSP library is not part of the firmware project. To benchmark on
+ * target add DSP_Lib/Source and this file to the build, define
+ * ARM_MATH_CM7 and DSP_BENCH; main() then runs dsp_bench_run_all() on
+ * UART4 before entering the scheduler. On the host build everything with
+ * HOST_BUILD, ARM_MATH_HOST and DSP_BENCH_MAIN (and -fno-strict-aliasing)
+ * together with profile.c:
+ *   ./dsp_bench [filter]     only kernels whose name contains filter
+ */
+
+#include <stdint.h>
+#include "profile.h"
+
+#define DSP_BENCH_REPS      8
+
+#define DSP_BENCH_COLD      0x01u   //flush the D-cache before each timed run
+
+//MPU region the first SDRAM run programs to map SDRAM as write-back cacheable, whatever it held is replaced
+#ifndef DSP_BENCH_MPU_REGION
+#define DSP_BENCH_MPU_REGION    7u
+#endif
+
+typedef enum
+{
+	DSP_BENCH_DTCM = 0,
+	DSP_BENCH_SRAM1,
+	DSP_BENCH_SDRAM,
+	DSP_BENCH_MEM_NUM
+} dsp_bench_mem_t;
+
+void     dsp_bench_header(prof_out_t out);
+uint32_t dsp_bench_run(prof_out_t out, dsp_bench_mem_t mem, uint32_t flags, const char *filter);
+void     dsp_bench_run_all(prof_out_t out);
+
+#endif /*_dsp_bench_H_*/
@@ -0,0 +1,123 @@
+#include "hrtimer.h"
+#include "tim.h"
+
+static tw_wheel_t s_hrtimer_wheel;
+static volatile uint32_t s_hrtimer_ovf;     //TIM14 wraps, upper 16 bits of the time base
+static uint8_t s_hrtimer_running;
+
+#define HRTIMER_LOCK_DECL   uint32_t primask
+#define HRTIMER_LOCK()      do { primask = __get_PRIMASK(); __disable_irq(); } while(0)
+#define HRTIMER_UNLOCK()    __set_PRIMASK(primask)
+
+//a wrap that is flagged but not yet counted is accounted for here
+uint32_t hrtimer_now(void)
+{
+	uint32_t hi, cnt;
+	HRTIMER_LOCK_DECL;
+
+	HRTIMER_LOCK();
+	hi = s_hrtimer_ovf;
+	cnt = TIM14->CNT;
+	if((TIM14->SR & TIM_SR_UIF) && cnt < 0x8000u)
+		hi++;
+	HRTIMER_UNLOCK();
+	return (hi << 16) | cnt;
+}
+
+//arm CC1 for the next wheel event, events further than one counter wrap are picked up by the update interrupt
+static void hrtimer_reprogram(void)
+{
+	uint32_t next, now;
+
+	if(!tw_next_event(&s_hrtimer_wheel, &next))
+	{
+		__HAL_TIM_DISABLE_IT(&htim14, TIM_IT_CC1);
+		return;
+	}
+	now = hrtimer_now();
+	if(next - now >= 0x10000u && TW_TIME_AFTER(next, now))
+	{
+		__HAL_TIM_DISABLE_IT(&htim14, TIM_IT_CC1);
+		return;
+	}
+	__HAL_TIM_SET_COMPARE(&htim14, TIM_CHANNEL_1, next & 0xFFFFu);
+	__HAL_TIM_CLEAR_FLAG(&htim14, TIM_FLAG_CC1);
+	__HAL_TIM_ENABLE_IT(&htim14, TIM_IT_CC1);
+	if(!TW_TIME_AFTER(next, hrtimer_now() + 1u))
+		TIM14->EGR = TIM_EGR_CC1G;          //deadline already reached, raise the interrupt now
+}
+
+static void hrtimer_service(void)
+{
+	tw_advance(&s_hrtimer_wheel, hrtimer_now());
+	hrtimer_reprogram();
+}
+
+void hrtimer_init(void)
+{
+	TIM_OC_InitTypeDef oc;
+
+	oc.OCMode = TIM_OCMODE_TIMING;
+	oc.Pulse = 0;
+	oc.OCPolarity = TIM_OCPOLARITY_HIGH;
+	oc.OCFastMode = TIM_OCFAST_DISABLE;
+	if(HAL_TIM_OC_ConfigChannel(&htim14, &oc, TIM_CHANNEL_1) != HAL_OK)
+	{
+		_Error_Handler(__FILE__, __LINE__);
+	}
+	s_hrtimer_ovf = 0;
+	__HAL_TIM_SET_COUNTER(&htim14, 0);
+	tw_init(&s_hrtimer_wheel, 0);
+	HAL_TIM_Base_Start_IT(&htim14);
+	s_hrtimer_running = 1;
+}
+
+int hrtimer_running(void)
+{
+	return s_hrtimer_running;
+}
+
+void hrtimer_setup(hrtimer_t *t, tw_callback_t cb, void *arg)
+{
+	tw_timer_init(t, cb, arg);
+}
+
+void hrtimer_start_at(hrtimer_t *t, uint32_t expires_us, uint32_t period_us)
+{
+	HRTIMER_LOCK_DECL;
+
+	HRTIMER_LOCK();
+	tw_start(&s_hrtimer_wheel, t, expires_us, period_us);
+	hrtimer_reprogram();
+	HRTIMER_UNLOCK();
+}
+
+void hrtimer_start(hrtimer_t *t, uint32_t delay_us, uint32_t period_us)
+{
+	hrtimer_start_at(t, hrtimer_now() + delay_us, period_us);
+}
+
+void hrtimer_cancel(hrtimer_t *t)
+{
+	HRTIMER_LOCK_DECL;
+
+	HRTIMER_LOCK();
+	tw_cancel(&s_hrtimer_wheel, t);
+	hrtimer_reprogram();
+	HRTIMER_UNLOCK();
+}
+
+void HAL_TIM_OC_DelayElapsedCallback(TIM_HandleTypeDef *htim)
+{
+	if(htim->Instance == TIM14)
+		hrtimer_service();
+}
+
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+{
+	if(htim->Instance == TIM14)
+	{
+		s_hrtimer_ovf++;
+		hrtimer_service();
+	}
+}
@@ -0,0 +1,26 @@
+#ifndef _hrtimer_H_
+#define _hrtimer_H_
+
+/*
+ * Microsecond software timers on TIM14.
+ *
+ * TIM14 free-runs at 1 MHz, its update interrupt extends the 16 bit counter
+ * to a 32 bit microsecond time base and compare channel 1 is reprogrammed
+ * for the next deadline of the timer wheel only, so there is no periodic
+ * tick. Callbacks run in the TIM14 interrupt.
+ */
+
+#include <stdint.h>
+#include "timer_wheel.h"
+
+typedef tw_timer_t hrtimer_t;
+
+void     hrtimer_init(void);
+uint32_t hrtimer_now(void);
+int      hrtimer_running(void);
+void     hrtimer_setup(hrtimer_t *t, tw_callback_t cb, void *arg);
+void     hrtimer_start(hrtimer_t *t, uint32_t delay_us, uint32_t period_us);
+void     hrtimer_start_at(hrtimer_t *t, uint32_t expires_us, uint32_t period_us);
+void     hrtimer_cancel(hrtimer_t *t);
+
+#endif /*_hrtimer_H_*/
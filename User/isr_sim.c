@@ -0,0 +1,63 @@
+#include "isr_sim.h"
+
+#ifdef HOST_BUILD
+
+#include <time.h>
+
+static pthread_mutex_t s_isr_sim_lock = PTHREAD_MUTEX_INITIALIZER;
+
+//run a handler the way the NVIC would: one at a time
+void isr_sim_raise(isr_sim_handler_t handler, void *arg)
+{
+	pthread_mutex_lock(&s_isr_sim_lock);
+	handler(arg);
+	pthread_mutex_unlock(&s_isr_sim_lock);
+}
+
+static void *isr_sim_thread(void *p)
+{
+	isr_sim_t *s = (isr_sim_t *)p;
+	struct timespec next;
+
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	while(s->running)
+	{
+		next.tv_nsec += (long)s->period_us * 1000L;
+		while(next.tv_nsec >= 1000000000L)
+		{
+			next.tv_nsec -= 1000000000L;
+			next.tv_sec++;
+		}
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, 0);
+		if(!s->running)
+			break;
+		isr_sim_raise(s->handler, s->arg);
+		s->count++;
+	}
+	return 0;
+}
+
+int isr_sim_start(isr_sim_t *s, isr_sim_handler_t handler, void *arg, uint32_t period_us)
+{
+	s->handler = handler;
+	s->arg = arg;
+	s->period_us = period_us;
+	s->count = 0;
+	s->running = 1;
+	if(pthread_create(&s->thread, 0, isr_sim_thread, s) != 0)
+	{
+		s->running = 0;
+		return -1;
+	}
+	return 0;
+}
+
+void isr_sim_stop(isr_sim_t *s)
+{
+	if(!s->running)
+		return;
+	s->running = 0;
+	pthread_join(s->thread, 0);
+}
+
+#endif /*HOST_BUILD*/
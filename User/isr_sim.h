@@ -0,0 +1,36 @@
+#ifndef _isr_sim_H_
+#define _isr_sim_H_
+
+/*
+ * Host-only interrupt simulator (HOST_BUILD).
+ *
+ * Each source is a thread that calls its handler periodically. Handlers of
+ * all sources are serialised by one lock, like interrupts of one priority
+ * on a single core, but run concurrently with the main thread, which is
+ * what sched_post() and the other ISR-safe paths have to cope with.
+ */
+
+#ifdef HOST_BUILD
+
+#include <stdint.h>
+#include <pthread.h>
+
+typedef void (*isr_sim_handler_t)(void *arg);
+
+typedef struct
+{
+	pthread_t          thread;
+	isr_sim_handler_t  handler;
+	void              *arg;
+	uint32_t           period_us;
+	volatile int       running;
+	volatile uint32_t  count;       //number of times the handler ran
+} isr_sim_t;
+
+int  isr_sim_start(isr_sim_t *s, isr_sim_handler_t handler, void *arg, uint32_t period_us);
+void isr_sim_stop(isr_sim_t *s);
+void isr_sim_raise(isr_sim_handler_t handler, void *arg);
+
+#endif /*HOST_BUILD*/
+
+#endif /*_isr_sim_H_*/
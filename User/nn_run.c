@@ -0,0 +1,160 @@
+#include "nn_run.h"
+#include "profile.h"
+#include <string.h>
+
+void nn_arena_init(nn_arena_t *a, void *base, uint32_t size)
+{
+	uint32_t skip = (uint32_t)(-(uintptr_t)base) & (NN_ARENA_ALIGN - 1u);
+
+	if(skip > size)
+		skip = size;
+	a->base = (uint8_t *)base + skip;
+	a->size = size - skip;
+	a->used = 0;
+}
+
+void *nn_arena_alloc(nn_arena_t *a, uint32_t size)
+{
+	void *p;
+
+	size = (size + NN_ARENA_ALIGN - 1u) & ~(NN_ARENA_ALIGN - 1u);
+	if(size > a->size - a->used)
+		return 0;
+	p = a->base + a->used;
+	a->used += size;
+	return p;
+}
+
+void nn_arena_reset(nn_arena_t *a)
+{
+	a->used = 0;
+}
+
+static uint32_t nn_dims_len(const arm_nn_dims *d)
+{
+	return (uint32_t)d->height * (uint32_t)d->width * d->channels;
+}
+
+int32_t nn_net_init(nn_net_t *net, const nn_layer_t *layers, uint32_t count, nn_arena_t *arena)
+{
+	const arm_nn_conv_instance_q7 *conv;
+	const arm_nn_fc_instance_q7 *fc;
+	uint32_t i, len = 0, act = 0, col = 0, need;
+
+	if(count == 0)
+		return -1;
+
+	net->layers = layers;
+	net->count = count;
+	net->len = nn_arena_alloc(arena, count * sizeof(uint32_t));
+	net->act[0] = net->act[1] = 0;
+	net->col = 0;
+	if(net->len == 0)
+		return -1;
+
+	for(i = 0; i < count; i++)
+	{
+		need = 0;
+		switch(layers[i].op)
+		{
+		case NN_CONV:
+		case NN_CONV_1X1:
+		case NN_DW_CONV:
+			conv = layers[i].inst;
+			if(layers[i].op != NN_DW_CONV)
+				need = 2u * conv->kernelH * conv->kernelW * conv->in.channels;
+			len = nn_dims_len(&conv->out);
+			break;
+		case NN_FC:
+			fc = layers[i].inst;
+			need = fc->inLen;
+			len = fc->outLen;
+			break;
+		case NN_MAX_POOL:
+		case NN_AVG_POOL:
+			len = nn_dims_len(&((const arm_nn_pool_instance_q7 *)layers[i].inst)->out);
+			break;
+		case NN_RELU:
+		case NN_SOFTMAX:
+			if(i == 0)
+				return -1;
+			break;
+		default:
+			return -1;
+		}
+		net->len[i] = len;
+		if(need > col)
+			col = need;
+		if(i + 1u < count && len > act)
+			act = len;
+	}
+
+	if(act)
+	{
+		net->act[0] = nn_arena_alloc(arena, act);
+		net->act[1] = nn_arena_alloc(arena, act);
+		if(net->act[1] == 0)
+			return -1;
+	}
+	if(col)
+	{
+		net->col = nn_arena_alloc(arena, col * sizeof(q15_t));
+		if(net->col == 0)
+			return -1;
+	}
+	return 0;
+}
+
+int32_t nn_net_run(const nn_net_t *net, const q7_t *in, q7_t *out, uint32_t *ticks)
+{
+	const nn_layer_t *l;
+	const q7_t *src = in;
+	q7_t *dst;
+	arm_status st = ARM_MATH_SUCCESS;
+	uint32_t i, t0 = 0;
+
+	for(i = 0; i < net->count; i++)
+	{
+		l = &net->layers[i];
+		dst = (i + 1u == net->count) ? out : net->act[i & 1u];
+		if(ticks)
+			t0 = prof_now();
+
+		switch(l->op)
+		{
+		case NN_CONV:
+			st = arm_convolve_q7(l->inst, src, dst, net->col);
+			break;
+		case NN_CONV_1X1:
+			st = arm_convolve_1x1_q7(l->inst, src, dst, net->col);
+			break;
+		case NN_DW_CONV:
+			st = arm_depthwise_conv_q7(l->inst, src, dst);
+			break;
+		case NN_FC:
+			arm_fully_connected_q7(l->inst, src, dst, net->col);
+			break;
+		case NN_MAX_POOL:
+			arm_max_pool_q7(l->inst, src, dst);
+			break;
+		case NN_AVG_POOL:
+			arm_avg_pool_q7(l->inst, src, dst);
+			break;
+		case NN_RELU:
+			if(dst != src)
+				memcpy(dst, src, net->len[i]);
+			arm_relu_q7(dst, net->len[i]);
+			break;
+		case NN_SOFTMAX:
+			arm_softmax_q7(src, dst, net->len[i], l->inst);
+			break;
+		}
+
+		if(ticks)
+			ticks[i] = prof_now() - t0;
+		if(st != ARM_MATH_SUCCESS)
+			return -1;
+		src = dst;
+	}
+	return 0;
+}
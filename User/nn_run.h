@@ -0,0 +1,79 @@
+#ifndef _nn_run_H_
+#define _nn_run_H_
+
+/*
+ * Layer list runner for the Q7 network kernels (DSP_Lib/Source/NNFunctions).
+ *
+ * A network is a const array of layers, each naming a kernel and pointing
+ * at its filled in instance structure (weights usually stay in flash):
+ *
+ *     static const nn_layer_t s_layers[] =
+ *     {
+ *         { NN_CONV,     &s_conv1 },
+ *         { NN_MAX_POOL, &s_pool1 },
+ *         { NN_FC,       &s_fc1   },
+ *         { NN_SOFTMAX,  s_softmax_table },
+ *     };
+ *
+ * nn_net_init() walks the list once and carves two ping-pong activation
+ * buffers and the im2col/Q15 expansion buffer out of an arena, normally a
+ * slice of the external SDRAM (Bank5_SDRAM_ADDR, after
+ * SDRAM_Initialization_Sequence()). nn_net_run() then executes the layers
+ * without touching the allocator: layer 0 reads the caller's input, the
+ * last layer writes the caller's output.
+ *
+ * NN_RELU and NN_SOFTMAX keep the shape of the layer before them. The
+ * instance of NN_RELU is unused (NULL), the instance of NN_SOFTMAX is the
+ * q15_t[256] table built by arm_softmax_init_q7(). The first layer must be
+ * one that carries a shape (conv, pooling or fully connected).
+ */
+
+#include <stdint.h>
+#include "arm_math.h"
+
+#define NN_ARENA_ALIGN      8u
+
+typedef enum
+{
+	NN_CONV = 0,        //arm_nn_conv_instance_q7
+	NN_CONV_1X1,        //arm_nn_conv_instance_q7, 1x1 kernel without padding
+	NN_DW_CONV,         //arm_nn_conv_instance_q7, depthwise
+	NN_FC,              //arm_nn_fc_instance_q7
+	NN_MAX_POOL,        //arm_nn_pool_instance_q7
+	NN_AVG_POOL,        //arm_nn_pool_instance_q7
+	NN_RELU,            //no instance
+	NN_SOFTMAX          //q15_t[256] table
+} nn_op_t;
+
+typedef struct
+{
+	nn_op_t     op;
+	const void *inst;
+} nn_layer_t;
+
+typedef struct
+{
+	uint8_t  *base;
+	uint32_t  size;
+	uint32_t  used;
+} nn_arena_t;
+
+typedef struct
+{
+	const nn_layer_t *layers;
+	uint32_t          count;
+	uint32_t         *len;          //output length of every layer, from the arena
+	q7_t             *act[2];       //ping-pong activations
+	q15_t            *col;          //im2col and input expansion buffer, NULL if unused
+} nn_net_t;
+
+void     nn_arena_init(nn_arena_t *a, void *base, uint32_t size);
+void    *nn_arena_alloc(nn_arena_t *a, uint32_t size);
+void     nn_arena_reset(nn_arena_t *a);
+
+//returns 0, or -1 when a layer is invalid or the arena is too small
+int32_t  nn_net_init(nn_net_t *net, const nn_layer_t *layers, uint32_t count, nn_arena_t *arena);
+//ticks (count entries) receives the prof_now() time of every layer, may be NULL
+int32_t  nn_net_run(const nn_net_t *net, const q7_t *in, q7_t *out, uint32_t *ticks);
+
+#endif /*_nn_run_H_*/
@@ -0,0 +1,1258 @@
+#include "os_kernel.h"
+#include "delay.h"
+#include "profile.h"
+#include <string.h>
+
+#ifdef HOST_BUILD
+#define os_clz(v)       ((uint32_t)__builtin_clz(v))
+#else
+#include "stm32f7xx.h"
+#define os_clz(v)       __CLZ(v)
+#endif
+
+#define OS_THREAD_OF(n, member) \
+	((struct os_thread_cb *)((uint8_t *)(n) - offsetof(struct os_thread_cb, member)))
+#define OS_TIMER_OF(n, member) \
+	((struct os_timer_cb *)((uint8_t *)(n) - offsetof(struct os_timer_cb, member)))
+
+#define OS_SIGNAL_MASK      ((int32_t)((1u << osFeature_Signals) - 1u))
+#define OS_TIMER_SIGNAL     0x01
+
+enum
+{
+	OS_THREAD_FREE = 0,
+	OS_THREAD_READY,            //in a ready list, the running thread included
+	OS_THREAD_WAIT,
+	OS_THREAD_WAIT_SIGNAL
+};
+
+struct os_thread_cb *volatile os_cur;
+struct os_thread_cb *volatile os_next;
+
+static os_node_t s_os_ready[OS_PRIO_LEVELS];
+static uint32_t  s_os_ready_map;            //bit n: ready list n is not empty
+static os_node_t s_os_delay;                //timed waits, ordered by wake tick
+static os_node_t s_os_timers;               //active timers, ordered by expiry
+static os_node_t s_os_timers_due;
+static volatile uint32_t s_os_time;
+static uint32_t  s_os_slice;
+static uint8_t   s_os_inited;
+static volatile uint8_t s_os_running;
+static osThreadId s_os_idle;
+static osThreadId s_os_timer_thread;
+
+static void os_idle_thread(void const *argument);
+static void os_timer_thread(void const *argument);
+
+osThreadDef(os_idle_thread, osPriorityIdle, 1, OS_IDLE_STACK);
+osThreadDef(os_timer_thread, osPriorityHigh, 1, OS_TIMER_STACK);
+
+/* ---- lists ---- */
+
+static void os_list_init(os_node_t *l)
+{
+	l->next = l;
+	l->prev = l;
+}
+
+static int os_list_empty(const os_node_t *l)
+{
+	return l->next == l;
+}
+
+//link n in front of pos, pos being the list head appends
+static void os_list_insert(os_node_t *pos, os_node_t *n)
+{
+	n->next = pos;
+	n->prev = pos->prev;
+	pos->prev->next = n;
+	pos->prev = n;
+}
+
+static void os_list_remove(os_node_t *n)
+{
+	n->prev->next = n->next;
+	n->next->prev = n->prev;
+	os_list_init(n);
+}
+
+/* ---- scheduling, all of it runs under os_port_lock() ---- */
+
+static int os_prio_valid(osPriority priority)
+{
+	return priority >= osPriorityIdle && priority <= osPriorityRealtime;
+}
+
+static void os_ready_add(struct os_thread_cb *t)
+{
+	os_list_insert(&s_os_ready[t->prio], &t->link);
+	s_os_ready_map |= 1u << t->prio;
+	t->state = OS_THREAD_READY;
+}
+
+static void os_ready_remove(struct os_thread_cb *t)
+{
+	os_list_remove(&t->link);
+	if(os_list_empty(&s_os_ready[t->prio]))
+		s_os_ready_map &= ~(1u << t->prio);
+}
+
+//pick the head of the highest non-empty ready list, the idle thread keeps the map non-zero
+static void os_schedule(void)
+{
+	struct os_thread_cb *t;
+
+	if(!s_os_running)
+		return;
+	t = OS_THREAD_OF(s_os_ready[31u - os_clz(s_os_ready_map)].next, link);
+	os_next = t;
+	if(t != os_cur)
+	{
+		s_os_slice = 0;
+		os_port_pend_switch();
+	}
+}
+
+//wait lists are ordered by priority, FIFO within a priority
+static void os_wait_insert(os_node_t *q, struct os_thread_cb *t)
+{
+	os_node_t *n;
+
+	for(n = q->next; n != q; n = n->next)
+	{
+		if(OS_THREAD_OF(n, link)->prio < t->prio)
+			break;
+	}
+	os_list_insert(n, &t->link);
+	t->waitq = q;
+}
+
+static void os_delay_insert(struct os_thread_cb *t, uint32_t ticks)
+{
+	os_node_t *n;
+
+	t->wake = s_os_time + ticks;
+	for(n = s_os_delay.next; n != &s_os_delay; n = n->next)
+	{
+		if(TIME_AFTER(OS_THREAD_OF(n, tlink)->wake, t->wake))
+			break;
+	}
+	os_list_insert(n, &t->tlink);
+	t->timed = 1;
+}
+
+//take the running thread off the CPU, the switch happens when the caller leaves its critical section
+static void os_block(os_node_t *q, uint32_t millisec)
+{
+	struct os_thread_cb *t = os_cur;
+
+	os_ready_remove(t);
+	t->state = OS_THREAD_WAIT;
+	t->waitq = NULL;
+	t->ret.status = osEventTimeout;
+	if(q)
+		os_wait_insert(q, t);
+	if(millisec != osWaitForever)
+		os_delay_insert(t, millisec);
+	os_schedule();
+}
+
+static void os_wake(struct os_thread_cb *t, osStatus status)
+{
+	if(t->waitq)
+	{
+		os_list_remove(&t->link);
+		t->waitq = NULL;
+	}
+	if(t->timed)
+	{
+		os_list_remove(&t->tlink);
+		t->timed = 0;
+	}
+	t->wait_mutex = NULL;
+	t->ret.status = status;
+	os_ready_add(t);
+}
+
+//blocking is only possible from a thread that runs with interrupts enabled
+static osStatus os_can_block(uint32_t state)
+{
+	if(os_port_in_isr() || state)
+		return osErrorISR;
+	if(!s_os_running)
+		return osErrorOS;
+	return osOK;
+}
+
+static void os_thread_set_prio(struct os_thread_cb *t, uint8_t prio)
+{
+	os_node_t *q;
+
+	if(t->prio == prio)
+		return;
+	if(t->state == OS_THREAD_READY)
+	{
+		os_ready_remove(t);
+		t->prio = prio;
+		os_ready_add(t);
+	}
+	else
+	{
+		t->prio = prio;
+		q = t->waitq;
+		if(q)
+		{
+			os_list_remove(&t->link);
+			os_wait_insert(q, t);
+		}
+	}
+}
+
+/* ---- mutex priority inheritance ---- */
+
+//running priority = max(own priority, first waiter of every owned mutex)
+//a change is passed along the chain of owners: when t itself waits for a
+//mutex, its new priority reorders that wait list and the owner is recomputed
+static void os_mutex_reprio(struct os_thread_cb *t)
+{
+	struct os_mutex_cb *m;
+	uint8_t prio;
+
+	while(t)
+	{
+		prio = t->base_prio;
+		for(m = t->mutex; m; m = m->next)
+		{
+			if(!os_list_empty(&m->waiters) && OS_THREAD_OF(m->waiters.next, link)->prio > prio)
+				prio = OS_THREAD_OF(m->waiters.next, link)->prio;
+		}
+		if(prio == t->prio)
+			break;
+		os_thread_set_prio(t, prio);
+		t = t->wait_mutex ? t->wait_mutex->owner : NULL;
+	}
+}
+
+static void os_mutex_own(struct os_mutex_cb *m, struct os_thread_cb *t)
+{
+	m->owner = t;
+	m->level = 1;
+	m->next = t->mutex;
+	t->mutex = m;
+}
+
+//detach m from its owner and hand it to the first waiter
+static void os_mutex_pass(struct os_mutex_cb *m)
+{
+	struct os_thread_cb *owner = m->owner;
+	struct os_thread_cb *t;
+	struct os_mutex_cb **pp;
+
+	for(pp = &owner->mutex; *pp != m; pp = &(*pp)->next)
+	{
+		;
+	}
+	*pp = m->next;
+	m->owner = NULL;
+	m->level = 0;
+	if(!os_list_empty(&m->waiters))
+	{
+		t = OS_THREAD_OF(m->waiters.next, link);
+		os_wake(t, osOK);
+		os_mutex_own(m, t);
+		os_mutex_reprio(t);
+	}
+	os_mutex_reprio(owner);
+}
+
+/* ---- kernel ---- */
+
+osStatus osKernelInitialize(void)
+{
+	uint32_t i;
+
+	if(s_os_inited)
+		return s_os_running ? osErrorOS : osOK;
+	for(i = 0; i < OS_PRIO_LEVELS; i++)
+		os_list_init(&s_os_ready[i]);
+	os_list_init(&s_os_delay);
+	os_list_init(&s_os_timers);
+	os_list_init(&s_os_timers_due);
+	s_os_ready_map = 0;
+	s_os_time = 0;
+	os_cur = NULL;
+	os_next = NULL;
+	s_os_inited = 1;
+	s_os_idle = osThreadCreate(osThread(os_idle_thread), NULL);
+	s_os_timer_thread = osThreadCreate(osThread(os_timer_thread), NULL);
+	return (s_os_idle && s_os_timer_thread) ? osOK : osErrorNoMemory;
+}
+
+//switches to the highest priority thread and does not return, main is not a thread
+osStatus osKernelStart(void)
+{
+	if(!s_os_inited || s_os_running || s_os_idle == NULL)
+		return osErrorOS;
+	os_port_lock();
+	s_os_running = 1;
+	os_schedule();
+	os_port_start();
+	return osErrorOS;
+}
+
+int32_t osKernelRunning(void)
+{
+	return s_os_running;
+}
+
+uint32_t osKernelSysTick(void)
+{
+	return prof_now();
+}
+
+static void os_timer_tick(void);
+
+void osSystickHandler(void)
+{
+	struct os_thread_cb *t;
+	uint32_t state;
+
+	if(!s_os_running)
+		return;
+	state = os_port_lock();
+	s_os_time++;
+	while(!os_list_empty(&s_os_delay))
+	{
+		t = OS_THREAD_OF(s_os_delay.next, tlink);
+		if(TIME_AFTER(t->wake, s_os_time))
+			break;
+		os_wake(t, osEventTimeout);
+	}
+	os_timer_tick();
+	t = os_cur;
+	if(t && t->state == OS_THREAD_READY && ++s_os_slice >= OS_ROBIN_TICKS)
+	{
+		s_os_slice = 0;
+		os_ready_remove(t);         //round robin: to the back of its ready list
+		os_ready_add(t);
+	}
+	os_schedule();
+	os_port_unlock(state);
+}
+
+static void os_idle_thread(void const *argument)
+{
+	(void)argument;
+	for(;;)
+		os_port_idle();
+}
+
+/* ---- threads ---- */
+
+osThreadId osThreadCreate(const osThreadDef_t *thread_def, void *argument)
+{
+	struct os_thread_cb *t = NULL;
+	uint32_t i, state;
+
+	if(!s_os_inited || os_port_in_isr())
+		return NULL;
+	if(thread_def == NULL || thread_def->pthread == NULL || !os_prio_valid(thread_def->tpriority))
+		return NULL;
+	state = os_port_lock();
+	for(i = 0; i < thread_def->instances; i++)
+	{
+		if(thread_def->cb[i].state == OS_THREAD_FREE)
+		{
+			t = &thread_def->cb[i];
+			break;
+		}
+	}
+	if(t == NULL)
+	{
+		os_port_unlock(state);
+		return NULL;
+	}
+	memset(t, 0, sizeof(*t));
+	os_list_init(&t->link);
+	os_list_init(&t->tlink);
+	t->entry = thread_def->pthread;
+	t->arg = argument;
+	t->prio = (uint8_t)(thread_def->tpriority - osPriorityIdle);
+	t->base_prio = t->prio;
+	t->sp = os_port_stack_init(t, thread_def->stack + i * (thread_def->stacksize / 8u),
+	                           thread_def->stacksize);
+	os_ready_add(t);
+	os_schedule();
+	os_port_unlock(state);
+	return t;
+}
+
+osThreadId osThreadGetId(void)
+{
+	return os_cur;
+}
+
+//owned mutexes go to their next waiter, the stack is reused by the next osThreadCreate
+osStatus osThreadTerminate(osThreadId thread_id)
+{
+	struct os_thread_cb *t = thread_id;
+	struct os_mutex_cb *m;
+	uint32_t state;
+
+	if(os_port_in_isr())
+		return osErrorISR;
+	if(t == NULL || t->state == OS_THREAD_FREE || t == s_os_idle)
+		return osErrorParameter;
+	state = os_port_lock();
+	m = t->wait_mutex;
+	if(t->state != OS_THREAD_READY)
+		os_wake(t, osErrorResource);    //unlinks it from wait and delay lists
+	os_ready_remove(t);
+	if(m && m->owner)
+		os_mutex_reprio(m->owner);      //withdraw what the owner inherited from t
+	while(t->mutex)
+		os_mutex_pass(t->mutex);
+	t->state = OS_THREAD_FREE;
+	os_schedule();
+	os_port_unlock(state);
+	return osOK;
+}
+
+//a thread function that returns ends up here
+void os_thread_exit(void)
+{
+	osThreadTerminate(os_cur);
+	for(;;)
+	{
+		;
+	}
+}
+
+osStatus osThreadYield(void)
+{
+	struct os_thread_cb *t = os_cur;
+	uint32_t state;
+
+	if(os_port_in_isr())
+		return osErrorISR;
+	if(t == NULL)
+		return osErrorOS;
+	state = os_port_lock();
+	os_ready_remove(t);
+	os_ready_add(t);
+	os_schedule();
+	os_port_unlock(state);
+	return osOK;
+}
+
+osStatus osThreadSetPriority(osThreadId thread_id, osPriority priority)
+{
+	struct os_thread_cb *t = thread_id;
+	uint32_t state;
+
+	if(os_port_in_isr())
+		return osErrorISR;
+	if(t == NULL || t->state == OS_THREAD_FREE)
+		return osErrorParameter;
+	if(!os_prio_valid(priority))
+		return osErrorValue;
+	state = os_port_lock();
+	t->base_prio = (uint8_t)(priority - osPriorityIdle);
+	os_mutex_reprio(t);
+	os_schedule();
+	os_port_unlock(state);
+	return osOK;
+}
+
+osPriority osThreadGetPriority(osThreadId thread_id)
+{
+	struct os_thread_cb *t = thread_id;
+
+	if(t == NULL || t->state == OS_THREAD_FREE)
+		return osPriorityError;
+	return (osPriority)(t->base_prio + osPriorityIdle);
+}
+
+osStatus osDelay(uint32_t millisec)
+{
+	uint32_t state;
+	osStatus st;
+
+	if(millisec == 0)
+		return osThreadYield();
+	state = os_port_lock();
+	st = os_can_block(state);
+	if(st == osOK)
+	{
+		os_block(NULL, millisec);
+		st = osEventTimeout;
+	}
+	os_port_unlock(state);
+	return st;
+}
+
+/* ---- timers, callbacks run in the timer thread ---- */
+
+static void os_timer_insert(struct os_timer_cb *tm, uint32_t expires)
+{
+	os_node_t *n;
+
+	tm->expires = expires;
+	for(n = s_os_timers.next; n != &s_os_timers; n = n->next)
+	{
+		if(TIME_AFTER(OS_TIMER_OF(n, link)->expires, expires))
+			break;
+	}
+	os_list_insert(n, &tm->link);
+	tm->active = 1;
+}
+
+static int32_t os_signal_set(struct os_thread_cb *t, int32_t signals);
+
+static void os_timer_tick(void)
+{
+	struct os_timer_cb *tm;
+	int fired = 0;
+
+	while(!os_list_empty(&s_os_timers))
+	{
+		tm = OS_TIMER_OF(s_os_timers.next, link);
+		if(TIME_AFTER(tm->expires, s_os_time))
+			break;
+		os_list_remove(&tm->link);
+		tm->active = 0;
+		if(tm->type == osTimerPeriodic)
+			os_timer_insert(tm, tm->expires + tm->period);
+		if(os_list_empty(&tm->due))
+			os_list_insert(&s_os_timers_due, &tm->due);
+		fired = 1;
+	}
+	if(fired)
+		os_signal_set(s_os_timer_thread, OS_TIMER_SIGNAL);
+}
+
+static void os_timer_thread(void const *argument)
+{
+	struct os_timer_cb *tm;
+	os_ptimer fn;
+	void *arg;
+	uint32_t state;
+
+	(void)argument;
+	for(;;)
+	{
+		osSignalWait(OS_TIMER_SIGNAL, osWaitForever);
+		for(;;)
+		{
+			state = os_port_lock();
+			if(os_list_empty(&s_os_timers_due))
+			{
+				os_port_unlock(state);
+				break;
+			}
+			tm = OS_TIMER_OF(s_os_timers_due.next, due);
+			os_list_remove(&tm->due);
+			fn = tm->ptimer;
+			arg = tm->arg;
+			os_port_unlock(state);
+			fn(arg);
+		}
+	}
+}
+
+osTimerId osTimerCreate(const osTimerDef_t *timer_def, os_timer_type type, void *argument)
+{
+	struct os_timer_cb *tm;
+
+	if(timer_def == NULL || timer_def->ptimer == NULL || timer_def->cb == NULL)
+		return NULL;
+	if(type != osTimerOnce && type != osTimerPeriodic)
+		return NULL;
+	tm = timer_def->cb;
+	memset(tm, 0, sizeof(*tm));
+	os_list_init(&tm->link);
+	os_list_init(&tm->due);
+	tm->ptimer = timer_def->ptimer;
+	tm->arg = argument;
+	tm->type = (uint8_t)type;
+	return tm;
+}
+
+osStatus osTimerStart(osTimerId timer_id, uint32_t millisec)
+{
+	struct os_timer_cb *tm = timer_id;
+	uint32_t state;
+
+	if(tm == NULL || tm->ptimer == NULL)
+		return osErrorParameter;
+	if(millisec == 0 || millisec == osWaitForever)
+		return osErrorValue;
+	state = os_port_lock();
+	if(tm->active)
+		os_list_remove(&tm->link);
+	tm->period = millisec;
+	os_timer_insert(tm, s_os_time + millisec);
+	os_port_unlock(state);
+	return osOK;
+}
+
+osStatus osTimerStop(osTimerId timer_id)
+{
+	struct os_timer_cb *tm = timer_id;
+	uint32_t state;
+	osStatus st = osOK;
+
+	if(tm == NULL || tm->ptimer == NULL)
+		return osErrorParameter;
+	state = os_port_lock();
+	if(tm->active)
+	{
+		os_list_remove(&tm->link);
+		tm->active = 0;
+	}
+	else
+	{
+		st = osErrorResource;
+	}
+	os_list_remove(&tm->due);
+	os_port_unlock(state);
+	return st;
+}
+
+osStatus osTimerDelete(osTimerId timer_id)
+{
+	struct os_timer_cb *tm = timer_id;
+
+	if(tm == NULL || tm->ptimer == NULL)
+		return osErrorParameter;
+	osTimerStop(tm);
+	tm->ptimer = NULL;
+	return osOK;
+}
+
+/* ---- signals ---- */
+
+//signals == 0 waits for any flag
+static int32_t os_signal_take(struct os_thread_cb *t)
+{
+	int32_t got;
+
+	if(t->wait_signals)
+		got = ((t->signals & t->wait_signals) == t->wait_signals) ? t->wait_signals : 0;
+	else
+		got = t->signals;
+	t->signals &= ~got;
+	return got;
+}
+
+static int32_t os_signal_set(struct os_thread_cb *t, int32_t signals)
+{
+	int32_t old = t->signals;
+	int32_t got;
+
+	t->signals |= signals;
+	if(t->state == OS_THREAD_WAIT_SIGNAL && (got = os_signal_take(t)) != 0)
+	{
+		os_wake(t, osEventSignal);
+		t->ret.value.signals = got;
+		os_schedule();
+	}
+	return old;
+}
+
+int32_t osSignalSet(osThreadId thread_id, int32_t signals)
+{
+	uint32_t state;
+	int32_t old;
+
+	if(thread_id == NULL || thread_id->state == OS_THREAD_FREE || (signals & ~OS_SIGNAL_MASK))
+		return (int32_t)0x80000000;
+	state = os_port_lock();
+	old = os_signal_set(thread_id, signals);
+	os_port_unlock(state);
+	return old;
+}
+
+int32_t osSignalClear(osThreadId thread_id, int32_t signals)
+{
+	uint32_t state;
+	int32_t old;
+
+	if(os_port_in_isr() || thread_id == NULL || thread_id->state == OS_THREAD_FREE ||
+	   (signals & ~OS_SIGNAL_MASK))
+		return (int32_t)0x80000000;
+	state = os_port_lock();
+	old = thread_id->signals;
+	thread_id->signals &= ~signals;
+	os_port_unlock(state);
+	return old;
+}
+
+osEvent osSignalWait(int32_t signals, uint32_t millisec)
+{
+	struct os_thread_cb *t = os_cur;
+	uint32_t state;
+	osEvent ev;
+
+	memset(&ev, 0, sizeof(ev));
+	if(signals & ~OS_SIGNAL_MASK)
+	{
+		ev.status = osErrorValue;
+		return ev;
+	}
+	state = os_port_lock();
+	ev.status = os_can_block(state);
+	if(ev.status == osOK)
+	{
+		t->wait_signals = signals;
+		ev.value.signals = os_signal_take(t);
+		if(ev.value.signals)
+		{
+			ev.status = osEventSignal;
+		}
+		else if(millisec != 0)
+		{
+			os_block(NULL, millisec);
+			t->state = OS_THREAD_WAIT_SIGNAL;
+			os_port_unlock(state);
+			ev.status = t->ret.status;
+			ev.value.signals = (ev.status == osEventSignal) ? t->ret.value.signals : 0;
+			return ev;
+		}
+	}
+	os_port_unlock(state);
+	return ev;
+}
+
+/* ---- mutexes, recursive with priority inheritance ---- */
+
+osMutexId osMutexCreate(const osMutexDef_t *mutex_def)
+{
+	struct os_mutex_cb *m;
+
+	if(mutex_def == NULL || mutex_def->cb == NULL)
+		return NULL;
+	m = mutex_def->cb;
+	m->owner = NULL;
+	m->level = 0;
+	m->next = NULL;
+	os_list_init(&m->waiters);
+	return m;
+}
+
+osStatus osMutexWait(osMutexId mutex_id, uint32_t millisec)
+{
+	struct os_mutex_cb *m = mutex_id;
+	struct os_thread_cb *t = os_cur;
+	uint32_t state;
+	osStatus st;
+
+	if(m == NULL || m->waiters.next == NULL)
+		return osErrorParameter;
+	state = os_port_lock();
+	st = os_can_block(state);
+	if(st != osOK)
+	{
+		os_port_unlock(state);
+		return st;
+	}
+	if(m->owner == NULL)
+	{
+		os_mutex_own(m, t);
+	}
+	else if(m->owner == t)
+	{
+		m->level++;
+	}
+	else if(millisec == 0)
+	{
+		st = osErrorResource;
+	}
+	else
+	{
+		os_block(&m->waiters, millisec);
+		t->wait_mutex = m;
+		os_mutex_reprio(m->owner);
+		os_schedule();
+		os_port_unlock(state);
+		if(t->ret.status != osEventTimeout)
+			return t->ret.status;
+		//a waiter that gave up no longer lends its priority
+		state = os_port_lock();
+		if(m->owner)
+		{
+			os_mutex_reprio(m->owner);
+			os_schedule();
+		}
+		os_port_unlock(state);
+		return osErrorTimeoutResource;
+	}
+	os_port_unlock(state);
+	return st;
+}
+
+osStatus osMutexRelease(osMutexId mutex_id)
+{
+	struct os_mutex_cb *m = mutex_id;
+	uint32_t state;
+	osStatus st = osOK;
+
+	if(os_port_in_isr())
+		return osErrorISR;
+	if(m == NULL || m->waiters.next == NULL)
+		return osErrorParameter;
+	state = os_port_lock();
+	if(m->owner != os_cur || os_cur == NULL)
+	{
+		st = osErrorResource;
+	}
+	else if(--m->level == 0)
+	{
+		os_mutex_pass(m);
+		os_schedule();
+	}
+	os_port_unlock(state);
+	return st;
+}
+
+osStatus osMutexDelete(osMutexId mutex_id)
+{
+	struct os_mutex_cb *m = mutex_id;
+	uint32_t state;
+
+	if(os_port_in_isr())
+		return osErrorISR;
+	if(m == NULL || m->waiters.next == NULL)
+		return osErrorParameter;
+	state = os_port_lock();
+	while(!os_list_empty(&m->waiters))
+		os_wake(OS_THREAD_OF(m->waiters.next, link), osErrorResource);
+	if(m->owner)
+		os_mutex_pass(m);
+	m->waiters.next = NULL;
+	os_schedule();
+	os_port_unlock(state);
+	return osOK;
+}
+
+/* ---- semaphores ---- */
+
+osSemaphoreId osSemaphoreCreate(const osSemaphoreDef_t *semaphore_def, int32_t count)
+{
+	struct os_semaphore_cb *s;
+
+	if(semaphore_def == NULL || semaphore_def->cb == NULL || count < 0 || count > osFeature_Semaphore)
+		return NULL;
+	s = semaphore_def->cb;
+	s->tokens = count;
+	os_list_init(&s->waiters);
+	return s;
+}
+
+int32_t osSemaphoreWait(osSemaphoreId semaphore_id, uint32_t millisec)
+{
+	struct os_semaphore_cb *s = semaphore_id;
+	struct os_thread_cb *t = os_cur;
+	uint32_t state;
+	int32_t n;
+
+	if(s == NULL || s->waiters.next == NULL)
+		return -1;
+	state = os_port_lock();
+	if(s->tokens > 0)
+	{
+		n = s->tokens--;
+	}
+	else if(millisec == 0)
+	{
+		n = 0;
+	}
+	else if(os_can_block(state) != osOK)
+	{
+		n = -1;
+	}
+	else
+	{
+		os_block(&s->waiters, millisec);
+		os_port_unlock(state);
+		return (t->ret.status == osOK) ? s->tokens + 1 : 0;
+	}
+	os_port_unlock(state);
+	return n;
+}
+
+osStatus osSemaphoreRelease(osSemaphoreId semaphore_id)
+{
+	struct os_semaphore_cb *s = semaphore_id;
+	uint32_t state;
+	osStatus st = osOK;
+
+	if(s == NULL || s->waiters.next == NULL)
+		return osErrorParameter;
+	state = os_port_lock();
+	if(!os_list_empty(&s->waiters))
+	{
+		os_wake(OS_THREAD_OF(s->waiters.next, link), osOK);     //the token goes straight to the waiter
+		os_schedule();
+	}
+	else if(s->tokens >= osFeature_Semaphore)
+	{
+		st = osErrorResource;
+	}
+	else
+	{
+		s->tokens++;
+	}
+	os_port_unlock(state);
+	return st;
+}
+
+osStatus osSemaphoreDelete(osSemaphoreId semaphore_id)
+{
+	struct os_semaphore_cb *s = semaphore_id;
+	uint32_t state;
+
+	if(os_port_in_isr())
+		return osErrorISR;
+	if(s == NULL || s->waiters.next == NULL)
+		return osErrorParameter;
+	state = os_port_lock();
+	while(!os_list_empty(&s->waiters))
+		os_wake(OS_THREAD_OF(s->waiters.next, link), osErrorResource);
+	s->waiters.next = NULL;
+	os_schedule();
+	os_port_unlock(state);
+	return osOK;
+}
+
+/* ---- memory pools ---- */
+
+static void os_pool_init(struct os_pool_cb *p, void *mem, uint32_t blocks, uint32_t item_sz)
+{
+	uint8_t *b;
+	uint32_t i;
+
+	p->base = (uint8_t *)mem;
+	p->blocks = blocks;
+	p->item_sz = OS_BLOCK_SIZE(item_sz);
+	p->free = NULL;
+	for(i = blocks; i > 0; i--)
+	{
+		b = p->base + (i - 1u) * p->item_sz;
+		*(void **)b = p->free;
+		p->free = b;
+	}
+	os_list_init(&p->waiters);
+}
+
+static void *os_pool_get(struct os_pool_cb *p)
+{
+	void *b = p->free;
+
+	if(b)
+		p->free = *(void **)b;
+	return b;
+}
+
+static osStatus os_pool_put(struct os_pool_cb *p, void *block)
+{
+	struct os_thread_cb *t;
+	uint8_t *b = (uint8_t *)block;
+
+	if(b < p->base || b >= p->base + p->blocks * p->item_sz || (uint32_t)(b - p->base) % p->item_sz)
+		return osErrorValue;
+	if(!os_list_empty(&p->waiters))
+	{
+		t = OS_THREAD_OF(p->waiters.next, link);
+		os_wake(t, osOK);
+		t->ret.value.p = block;     //the block goes straight to the waiting allocator
+		os_schedule();
+	}
+	else
+	{
+		*(void **)b = p->free;
+		p->free = b;
+	}
+	return osOK;
+}
+
+osPoolId osPoolCreate(const osPoolDef_t *pool_def)
+{
+	if(pool_def == NULL || pool_def->cb == NULL || pool_def->pool == NULL ||
+	   pool_def->pool_sz == 0 || pool_def->item_sz == 0)
+		return NULL;
+	os_pool_init(pool_def->cb, pool_def->pool, pool_def->pool_sz, pool_def->item_sz);
+	return pool_def->cb;
+}
+
+void *osPoolAlloc(osPoolId pool_id)
+{
+	uint32_t state;
+	void *b;
+
+	if(pool_id == NULL || pool_id->waiters.next == NULL)
+		return NULL;
+	state = os_port_lock();
+	b = os_pool_get(pool_id);
+	os_port_unlock(state);
+	return b;
+}
+
+void *osPoolCAlloc(osPoolId pool_id)
+{
+	void *b = osPoolAlloc(pool_id);
+
+	if(b)
+		memset(b, 0, pool_id->item_sz);
+	return b;
+}
+
+osStatus osPoolFree(osPoolId pool_id, void *block)
+{
+	uint32_t state;
+	osStatus st;
+
+	if(pool_id == NULL || pool_id->waiters.next == NULL || block == NULL)
+		return osErrorParameter;
+	state = os_port_lock();
+	st = os_pool_put(pool_id, block);
+	os_port_unlock(state);
+	return st;
+}
+
+/* ---- message queues ---- */
+
+static void os_queue_init(struct os_messageQ_cb *q, uint32_t *buf, uint32_t size)
+{
+	q->buf = buf;
+	q->size = size;
+	q->head = 0;
+	q->count = 0;
+	os_list_init(&q->getters);
+	os_list_init(&q->putters);
+}
+
+static void os_queue_push(struct os_messageQ_cb *q, uint32_t info)
+{
+	uint32_t i = q->head + q->count;
+
+	if(i >= q->size)
+		i -= q->size;
+	q->buf[i] = info;
+	q->count++;
+}
+
+static int os_queue_try_put(struct os_messageQ_cb *q, uint32_t info)
+{
+	struct os_thread_cb *t;
+
+	if(!os_list_empty(&q->getters))
+	{
+		t = OS_THREAD_OF(q->getters.next, link);
+		os_wake(t, osEventMessage);
+		t->ret.value.v = info;      //a waiting receiver gets the message without queueing it
+		os_schedule();
+		return 1;
+	}
+	if(q->count == q->size)
+		return 0;
+	os_queue_push(q, info);
+	return 1;
+}
+
+static int os_queue_try_get(struct os_messageQ_cb *q, uint32_t *info)
+{
+	struct os_thread_cb *t;
+
+	if(q->count == 0)
+		return 0;
+	*info = q->buf[q->head];
+	if(++q->head == q->size)
+		q->head = 0;
+	q->count--;
+	if(!os_list_empty(&q->putters))
+	{
+		t = OS_THREAD_OF(q->putters.next, link);
+		os_queue_push(q, t->ret.value.v);
+		os_wake(t, osOK);
+		os_schedule();
+	}
+	return 1;
+}
+
+static osStatus os_queue_put(struct os_messageQ_cb *q, uint32_t info, uint32_t millisec)
+{
+	struct os_thread_cb *t = os_cur;
+	uint32_t state;
+	osStatus st = osOK;
+
+	state = os_port_lock();
+	if(!os_queue_try_put(q, info))
+	{
+		if(millisec == 0)
+			st = osErrorResource;
+		else if((st = os_can_block(state)) == osOK)
+		{
+			os_block(&q->putters, millisec);
+			t->ret.value.v = info;
+			os_port_unlock(state);
+			return (t->ret.status == osOK) ? osOK : osErrorTimeoutResource;
+		}
+	}
+	os_port_unlock(state);
+	return st;
+}
+
+static osEvent os_queue_get(struct os_messageQ_cb *q, uint32_t millisec)
+{
+	struct os_thread_cb *t = os_cur;
+	uint32_t state;
+	osEvent ev;
+
+	memset(&ev, 0, sizeof(ev));
+	state = os_port_lock();
+	if(os_queue_try_get(q, &ev.value.v))
+	{
+		ev.status = osEventMessage;
+	}
+	else if(millisec == 0)
+	{
+		ev.status = osOK;
+	}
+	else if((ev.status = os_can_block(state)) == osOK)
+	{
+		os_block(&q->getters, millisec);
+		os_port_unlock(state);
+		ev.status = t->ret.status;
+		if(ev.status == osEventMessage)
+			ev.value.v = t->ret.value.v;
+		return ev;
+	}
+	os_port_unlock(state);
+	return ev;
+}
+
+osMessageQId osMessageCreate(const osMessageQDef_t *queue_def, osThreadId thread_id)
+{
+	(void)thread_id;
+	if(queue_def == NULL || queue_def->cb == NULL || queue_def->pool == NULL || queue_def->queue_sz == 0)
+		return NULL;
+	os_queue_init(queue_def->cb, (uint32_t *)queue_def->pool, queue_def->queue_sz);
+	return queue_def->cb;
+}
+
+osStatus osMessagePut(osMessageQId queue_id, uint32_t info, uint32_t millisec)
+{
+	if(queue_id == NULL || queue_id->buf == NULL)
+		return osErrorParameter;
+	return os_queue_put(queue_id, info, millisec);
+}
+
+osEvent osMessageGet(osMessageQId queue_id, uint32_t millisec)
+{
+	osEvent ev;
+
+	if(queue_id == NULL || queue_id->buf == NULL)
+	{
+		memset(&ev, 0, sizeof(ev));
+		ev.status = osErrorParameter;
+		return ev;
+	}
+	ev = os_queue_get(queue_id, millisec);
+	ev.def.message_id = queue_id;
+	return ev;
+}
+
+/* ---- mail queues: pool blocks passed by index, never copied ---- */
+
+osMailQId osMailCreate(const osMailQDef_t *queue_def, osThreadId thread_id)
+{
+	struct os_mailQ_cb *mq;
+
+	(void)thread_id;
+	if(queue_def == NULL || queue_def->cb == NULL || queue_def->pool == NULL ||
+	   queue_def->queue == NULL || queue_def->queue_sz == 0 || queue_def->item_sz == 0)
+		return NULL;
+	mq = queue_def->cb;
+	os_pool_init(&mq->pool, queue_def->pool, queue_def->queue_sz, queue_def->item_sz);
+	os_queue_init(&mq->queue, queue_def->queue, queue_def->queue_sz);
+	return mq;
+}
+
+void *osMailAlloc(osMailQId queue_id, uint32_t millisec)
+{
+	struct os_thread_cb *t = os_cur;
+	uint32_t state;
+	void *b;
+
+	if(queue_id == NULL || queue_id->queue.buf == NULL)
+		return NULL;
+	state = os_port_lock();
+	b = os_pool_get(&queue_id->pool);
+	if(b == NULL && millisec != 0 && os_can_block(state) == osOK)
+	{
+		os_block(&queue_id->pool.waiters, millisec);
+		os_port_unlock(state);
+		return (t->ret.status == osOK) ? t->ret.value.p : NULL;
+	}
+	os_port_unlock(state);
+	return b;
+}
+
+void *osMailCAlloc(osMailQId queue_id, uint32_t millisec)
+{
+	void *b = osMailAlloc(queue_id, millisec);
+
+	if(b)
+		memset(b, 0, queue_id->pool.item_sz);
+	return b;
+}
+
+osStatus osMailPut(osMailQId queue_id, void *mail)
+{
+	struct os_pool_cb *p;
+	uint32_t off;
+
+	if(queue_id == NULL || queue_id->queue.buf == NULL || mail == NULL)
+		return osErrorParameter;
+	p = &queue_id->pool;
+	if((uint8_t *)mail < p->base || (uint8_t *)mail >= p->base + p->blocks * p->item_sz)
+		return osErrorValue;
+	off = (uint32_t)((uint8_t *)mail - p->base);
+	if(off % p->item_sz)
+		return osErrorValue;
+	return os_queue_put(&queue_id->queue, off / p->item_sz, 0);
+}
+
+osEvent osMailGet(osMailQId queue_id, uint32_t millisec)
+{
+	osEvent ev;
+
+	if(queue_id == NULL || queue_id->queue.buf == NULL)
+	{
+		memset(&ev, 0, sizeof(ev));
+		ev.status = osErrorParameter;
+		return ev;
+	}
+	ev = os_queue_get(&queue_id->queue, millisec);
+	if(ev.status == osEventMessage)
+	{
+		ev.status = osEventMail;
+		ev.value.p = queue_id->pool.base + ev.value.v * queue_id->pool.item_sz;
+	}
+	ev.def.mail_id = queue_id;
+	return ev;
+}
+
+osStatus osMailFree(osMailQId queue_id, void *mail)
+{
+	uint32_t state;
+	osStatus st;
+
+	if(queue_id == NULL || queue_id->queue.buf == NULL || mail == NULL)
+		return osErrorParameter;
+	state = os_port_lock();
+	st = os_pool_put(&queue_id->pool, mail);
+	os_port_unlock(state);
+	return st;
+}
@@ -0,0 +1,35 @@
+#ifndef _os_kernel_H_
+#define _os_kernel_H_
+
+/*
+ * Kernel internals shared with the ports, applications use cmsis_os.h.
+ *
+ * Scheduling is preemptive by priority: one ready list per osPriority level
+ * and a bitmap of non-empty lists, the next thread is found with one CLZ.
+ * Threads of equal priority are rotated every OS_ROBIN_TICKS ticks.
+ *
+ * Kernel state is guarded by os_port_lock(), the API may be called from
+ * interrupts where CMSIS-RTOS allows it. A reschedule only records os_next
+ * and pends the switch, the port performs it once no critical section and
+ * no interrupt is active (PendSV on target).
+ */
+
+#include "cmsis_os.h"
+
+#define OS_PRIO_LEVELS      (osPriorityRealtime - osPriorityIdle + 1)
+
+extern struct os_thread_cb *volatile os_cur;    //running thread, NULL before the first switch
+extern struct os_thread_cb *volatile os_next;   //thread the pending switch resumes
+
+void os_thread_exit(void);
+
+/* port */
+uint32_t os_port_lock(void);
+void     os_port_unlock(uint32_t state);
+void     os_port_pend_switch(void);
+int      os_port_in_isr(void);
+void    *os_port_stack_init(struct os_thread_cb *t, uint64_t *stack, uint32_t size);
+void     os_port_start(void);
+void     os_port_idle(void);
+
+#endif /*_os_kernel_H_*/
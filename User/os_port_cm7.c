@@ -0,0 +1,150 @@
+#include "os_kernel.h"
+
+#ifndef HOST_BUILD
+
+#include "stm32f7xx.h"
+
+/*
+ * Cortex-M7 port: threads run on PSP, the switch is done in PendSV at the
+ * lowest priority so it only runs once every other interrupt has finished.
+ *
+ * PendSV stores r4-r11 and EXC_RETURN on the thread stack, plus s16-s31
+ * when EXC_RETURN says the thread has an FP context (bit 4 clear). Lazy
+ * stacking stays enabled, so s0-s15/FPSCR are only written to the frame
+ * when the FPU was used, and threads that never touch it pay nothing.
+ */
+
+#define OS_INITIAL_XPSR     0x01000000u     //Thumb state
+#define OS_EXC_RETURN_PSP   0xFFFFFFFDu     //thread mode, PSP, basic frame
+
+uint32_t os_port_lock(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	return primask;
+}
+
+//a switch pended inside the critical section is taken right here
+void os_port_unlock(uint32_t state)
+{
+	__set_PRIMASK(state);
+	__ISB();
+}
+
+void os_port_pend_switch(void)
+{
+	SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+	__DSB();
+}
+
+int os_port_in_isr(void)
+{
+	return __get_IPSR() != 0;
+}
+
+//exception frame as if the thread had been interrupted at its first instruction
+void *os_port_stack_init(struct os_thread_cb *t, uint64_t *stack, uint32_t size)
+{
+	uint32_t *sp = (uint32_t *)(stack + size / 8u);
+
+	*--sp = OS_INITIAL_XPSR;
+	*--sp = (uint32_t)t->entry & ~1u;       //pc
+	*--sp = (uint32_t)os_thread_exit;       //lr
+	sp -= 4;                                //r12, r3, r2, r1
+	*--sp = (uint32_t)t->arg;               //r0
+	*--sp = OS_EXC_RETURN_PSP;
+	sp -= 8;                                //r11..r4
+	return sp;
+}
+
+//called with interrupts disabled and the first switch pended, does not return
+void os_port_start(void)
+{
+	NVIC_SetPriority(PendSV_IRQn, (1u << __NVIC_PRIO_BITS) - 1u);
+	FPU->FPCCR |= FPU_FPCCR_ASPEN_Msk | FPU_FPCCR_LSPEN_Msk;
+	__enable_irq();
+	__ISB();
+	for(;;)
+	{
+		;
+	}
+}
+
+void os_port_idle(void)
+{
+	__DSB();
+	__WFI();
+}
+
+#if defined(__CC_ARM)
+
+__asm void PendSV_Handler(void)
+{
+	IMPORT  os_cur
+	IMPORT  os_next
+
+	PRESERVE8
+
+	mrs     r0, psp
+	ldr     r3, =os_cur
+	ldr     r2, [r3]
+	cbz     r2, os_port_restore         ; first switch: nothing to save
+	tst     lr, #0x10
+	it      eq
+	vstmdbeq r0!, {s16-s31}             ; thread has an FP context
+	stmdb   r0!, {r4-r11, lr}
+	str     r0, [r2]
+os_port_restore
+	ldr     r1, =os_next
+	cpsid   i
+	ldr     r2, [r1]
+	str     r2, [r3]
+	cpsie   i
+	ldr     r0, [r2]
+	ldmia   r0!, {r4-r11, lr}
+	tst     lr, #0x10
+	it      eq
+	vldmiaeq r0!, {s16-s31}
+	msr     psp, r0
+	isb
+	bx      lr
+
+	ALIGN
+}
+
+#elif defined(__GNUC__)
+
+__attribute__((naked)) void PendSV_Handler(void)
+{
+	__asm volatile(
+	"	mrs     r0, psp                 \n"
+	"	ldr     r3, =os_cur             \n"
+	"	ldr     r2, [r3]                \n"
+	"	cbz     r2, 1f                  \n"
+	"	tst     lr, #0x10               \n"
+	"	it      eq                      \n"
+	"	vstmdbeq r0!, {s16-s31}         \n"
+	"	stmdb   r0!, {r4-r11, lr}       \n"
+	"	str     r0, [r2]                \n"
+	"1:                                 \n"
+	"	ldr     r1, =os_next            \n"
+	"	cpsid   i                       \n"
+	"	ldr     r2, [r1]                \n"
+	"	str     r2, [r3]                \n"
+	"	cpsie   i                       \n"
+	"	ldr     r0, [r2]                \n"
+	"	ldmia   r0!, {r4-r11, lr}       \n"
+	"	tst     lr, #0x10               \n"
+	"	it      eq                      \n"
+	"	vldmiaeq r0!, {s16-s31}         \n"
+	"	msr     psp, r0                 \n"
+	"	isb                             \n"
+	"	bx      lr                      \n"
+	"	.ltorg                          \n"
+	);
+}
+
+#endif
+
+#endif /*HOST_BUILD*/
@@ -0,0 +1,127 @@
+#include "os_kernel.h"
+
+#ifdef HOST_BUILD
+
+#include <signal.h>
+#include <string.h>
+#include <sys/time.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+/*
+ * Host port: every thread is a ucontext, SIGALRM at OS_TICK_FREQ is the
+ * SysTick interrupt and blocking SIGALRM is the critical section. A switch
+ * pended in the tick is done on the way out of the signal handler, one
+ * pended by thread code when it leaves its critical section, which matches
+ * PendSV on target.
+ */
+
+static ucontext_t s_os_main_ctx;
+static volatile sig_atomic_t s_os_in_tick;
+static volatile sig_atomic_t s_os_switch_pending;
+
+static void os_port_tick_set(sigset_t *set)
+{
+	sigemptyset(set);
+	sigaddset(set, SIGALRM);
+}
+
+static void os_port_switch(void)
+{
+	struct os_thread_cb *prev = os_cur;
+
+	s_os_switch_pending = 0;
+	os_cur = os_next;
+	if(prev != os_cur)
+		swapcontext(prev ? (ucontext_t *)prev->sp : &s_os_main_ctx, (ucontext_t *)os_cur->sp);
+}
+
+uint32_t os_port_lock(void)
+{
+	sigset_t set, old;
+
+	os_port_tick_set(&set);
+	sigprocmask(SIG_BLOCK, &set, &old);
+	return (uint32_t)sigismember(&old, SIGALRM);
+}
+
+void os_port_unlock(uint32_t state)
+{
+	sigset_t set;
+
+	if(state)
+		return;
+	if(s_os_switch_pending)
+		os_port_switch();
+	os_port_tick_set(&set);
+	sigprocmask(SIG_UNBLOCK, &set, 0);
+}
+
+void os_port_pend_switch(void)
+{
+	s_os_switch_pending = 1;
+}
+
+int os_port_in_isr(void)
+{
+	return s_os_in_tick;
+}
+
+static void os_port_entry(void)
+{
+	struct os_thread_cb *t = os_cur;
+
+	os_port_unlock(0);
+	t->entry(t->arg);
+	os_thread_exit();
+}
+
+//the ucontext sits at the bottom of the thread stack, sp points to it
+void *os_port_stack_init(struct os_thread_cb *t, uint64_t *stack, uint32_t size)
+{
+	ucontext_t *ctx = (ucontext_t *)stack;
+	uint32_t skip = (sizeof(ucontext_t) + 15u) & ~15u;
+
+	(void)t;
+	getcontext(ctx);
+	ctx->uc_stack.ss_sp = (uint8_t *)stack + skip;
+	ctx->uc_stack.ss_size = size - skip;
+	ctx->uc_link = 0;
+	os_port_tick_set(&ctx->uc_sigmask);     //starts inside the critical section of the switch
+	makecontext(ctx, os_port_entry, 0);
+	return ctx;
+}
+
+static void os_port_tick(int sig)
+{
+	(void)sig;
+	s_os_in_tick = 1;
+	osSystickHandler();
+	s_os_in_tick = 0;
+	if(s_os_switch_pending)
+		os_port_switch();
+}
+
+void os_port_start(void)
+{
+	struct sigaction sa;
+	struct itimerval it;
+
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = os_port_tick;
+	sa.sa_flags = SA_RESTART;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGALRM, &sa, 0);
+	it.it_interval.tv_sec = 0;
+	it.it_interval.tv_usec = 1000000 / OS_TICK_FREQ;
+	it.it_value = it.it_interval;
+	setitimer(ITIMER_REAL, &it, 0);
+	os_port_switch();
+}
+
+void os_port_idle(void)
+{
+	pause();
+}
+
+#endif /*HOST_BUILD*/
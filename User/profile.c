@@ -0,0 +1,169 @@
+#include "profile.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifdef HOST_BUILD
+#include <time.h>
+#include <pthread.h>
+
+static pthread_mutex_t s_prof_lock = PTHREAD_MUTEX_INITIALIZER;
+
+#define PROF_LOCK_DECL
+#define PROF_LOCK()       pthread_mutex_lock(&s_prof_lock)
+#define PROF_UNLOCK()     pthread_mutex_unlock(&s_prof_lock)
+
+uint32_t prof_now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
+
+static uint32_t prof_clz(uint32_t v)
+{
+	return v ? (uint32_t)__builtin_clz(v) : 32u;
+}
+#else
+#include "stm32f7xx_hal.h"
+
+extern UART_HandleTypeDef huart4;
+extern SPI_HandleTypeDef hspi2;
+
+#define PROF_LOCK_DECL    uint32_t primask
+#define PROF_LOCK()       do { primask = __get_PRIMASK(); __disable_irq(); } while(0)
+#define PROF_UNLOCK()     __set_PRIMASK(primask)
+
+#define prof_clz(v)       __CLZ(v)
+#endif
+
+//name, five 10 digit numbers and every histogram bin, each with its separator, then "\r\n"
+#define PROF_LINE_SIZE    (PROF_NAME_MAX + 1 + 5 * 11 + PROF_HIST_BINS * 11 + 3)
+
+static prof_scope_t *s_prof_head = 0;
+
+//enable the DWT cycle counter, it runs from reset once TRCENA is set
+void prof_init(void)
+{
+#ifndef HOST_BUILD
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;                 //M7 DWT is locked after reset
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+void prof_record(prof_scope_t *s, uint32_t ticks)
+{
+	uint32_t bin = 32u - prof_clz(ticks);
+	PROF_LOCK_DECL;
+
+	if(bin >= PROF_HIST_BINS)
+		bin = PROF_HIST_BINS - 1;
+
+	PROF_LOCK();
+	if(!s->linked)
+	{
+		s->next = s_prof_head;
+		s_prof_head = s;
+		s->linked = 1;
+	}
+	s->count++;
+	s->total += ticks;
+	if(ticks < s->min)
+		s->min = ticks;
+	if(ticks > s->max)
+		s->max = ticks;
+	s->hist[bin]++;
+	PROF_UNLOCK();
+}
+
+void prof_reset(prof_scope_t *s)
+{
+	PROF_LOCK_DECL;
+
+	PROF_LOCK();
+	s->count = 0;
+	s->total = 0;
+	s->min = 0xFFFFFFFFu;
+	s->max = 0;
+	memset(s->hist, 0, sizeof(s->hist));
+	PROF_UNLOCK();
+}
+
+void prof_reset_all(void)
+{
+	prof_scope_t *s;
+
+	for(s = s_prof_head; s != 0; s = s->next)
+		prof_reset(s);
+}
+
+uint32_t prof_ticks_to_ns(uint32_t ticks)
+{
+#ifdef HOST_BUILD
+	return ticks;
+#else
+	return (uint32_t)(((uint64_t)ticks * 1000000000u) / SystemCoreClock);
+#endif
+}
+
+void prof_write(prof_out_t out, const char *buf, uint32_t len)
+{
+	switch(out)
+	{
+#ifndef HOST_BUILD
+		case PROF_OUT_UART4:
+			HAL_UART_Transmit(&huart4, (uint8_t *)buf, len, 100);
+			break;
+		case PROF_OUT_SPI2:
+			HAL_SPI_Transmit(&hspi2, (uint8_t *)buf, len, 100);
+			break;
+#endif
+		default:
+			fwrite(buf, 1, len, stdout);
+			break;
+	}
+}
+
+/*
+ * One line per scope, comma separated:
+ *   name,count,min,max,mean,mean_ns,h0;h1;...;hN
+ * the histogram is cut after the last non empty bin.
+ */
+void prof_dump(prof_out_t out)
+{
+	char line[PROF_LINE_SIZE];
+	prof_scope_t snap;
+	prof_scope_t *s;
+	uint32_t mean, last, i;
+	int len;
+	PROF_LOCK_DECL;
+
+	len = snprintf(line, sizeof(line), "name,count,min,max,mean,mean_ns,hist\r\n");
+	prof_write(out, line, (uint32_t)len);
+
+	for(s = s_prof_head; s != 0; s = s->next)
+	{
+		PROF_LOCK();
+		snap = *s;
+		PROF_UNLOCK();
+
+		if(snap.count == 0)
+			continue;
+		mean = (uint32_t)(snap.total / snap.count);
+		len = snprintf(line, sizeof(line), "%.*s,%lu,%lu,%lu,%lu,%lu,",
+		               PROF_NAME_MAX, snap.name, (unsigned long)snap.count, (unsigned long)snap.min,
+		               (unsigned long)snap.max, (unsigned long)mean,
+		               (unsigned long)prof_ticks_to_ns(mean));
+
+		for(last = PROF_HIST_BINS - 1; last > 0 && snap.hist[last] == 0; last--)
+			;
+		for(i = 0; i <= last; i++)
+		{
+			len += snprintf(line + len, sizeof(line) - len, i ? ";%lu" : "%lu",
+			                (unsigned long)snap.hist[i]);
+		}
+		len += snprintf(line + len, sizeof(line) - len, "\r\n");
+		prof_write(out, line, (uint32_t)len);
+	}
+}
@@ -0,0 +1,79 @@
+#ifndef _profile_H_
+#define _profile_H_
+
+/*
+ * Cycle-counter profiling.
+ *
+ * A scope is a named set of statistics (count/min/max/total and a log2
+ * histogram) fed with elapsed counter ticks:
+ *
+ *     static PROF_SCOPE(s_qspi_read, "qspi_read");
+ *     ...
+ *     PROF_BEGIN(s_qspi_read);
+ *     ... hot path ...
+ *     PROF_END(s_qspi_read);
+ *
+ * On target the counter is DWT->CYCCNT (one tick per core clock).
+ * Built with HOST_BUILD the counter is CLOCK_MONOTONIC in nanoseconds, so
+ * the same instrumented code runs on Linux.
+ * Recording is ISR safe, scopes may be fed from interrupts and thread code.
+ * Paths that return between PROF_BEGIN and PROF_END are not recorded.
+ */
+
+#include <stdint.h>
+
+#ifndef PROF_ENABLE
+#define PROF_ENABLE       1
+#endif
+
+#define PROF_HIST_BINS    32    //bin n counts samples in [2^(n-1), 2^n) ticks, bin 0 counts 0
+#define PROF_NAME_MAX     40    //longer names are cut in prof_dump
+
+typedef struct prof_scope
+{
+	const char        *name;
+	struct prof_scope *next;     //registry link, filled in on first record
+	uint8_t            linked;
+	uint32_t           count;
+	uint32_t           min;
+	uint32_t           max;
+	uint64_t           total;
+	uint32_t           hist[PROF_HIST_BINS];
+} prof_scope_t;
+
+typedef enum
+{
+	PROF_OUT_UART4 = 0,
+	PROF_OUT_SPI2,
+	PROF_OUT_STDOUT
+} prof_out_t;
+
+#define PROF_SCOPE(var, label)  prof_scope_t var = { (label), 0, 0, 0, 0xFFFFFFFFu, 0, 0, {0} }
+
+#ifdef HOST_BUILD
+uint32_t prof_now(void);
+#else
+#include "stm32f7xx.h"
+static __inline uint32_t prof_now(void)
+{
+	return DWT->CYCCNT;
+}
+#endif
+
+#if PROF_ENABLE
+#define PROF_BEGIN(s)   uint32_t _prof_t0_##s = prof_now()
+#define PROF_END(s)     prof_record(&(s), prof_now() - _prof_t0_##s)
+#else
+#define PROF_BEGIN(s)
+#define PROF_END(s)
+#endif
+
+void     prof_init(void);
+void     prof_record(prof_scope_t *s, uint32_t ticks);
+void     prof_reset(prof_scope_t *s);
+void     prof_reset_all(void);
+uint32_t prof_ticks_to_ns(uint32_t ticks);
+void     prof_write(prof_out_t out, const char *buf, uint32_t len);
+void     prof_dump(prof_out_t out);
+
+#endif /*_profile_H_*/
@@ -0,0 +1,278 @@
+#include "sched.h"
+#include "profile.h"
+#include <stdio.h>
+#include <string.h>
+
+#define SCHED_QUEUE_MASK    (SCHED_QUEUE_LEN - 1u)
+
+#ifdef HOST_BUILD
+#include <pthread.h>
+
+static pthread_mutex_t s_sched_idle_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  s_sched_idle_cond = PTHREAD_COND_INITIALIZER;
+
+#define sched_barrier()     __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+static uint32_t sched_clz(uint32_t v)
+{
+	return v ? (uint32_t)__builtin_clz(v) : 32u;
+}
+
+static void sched_atomic_or(volatile uint32_t *p, uint32_t v)
+{
+	__atomic_fetch_or(p, v, __ATOMIC_SEQ_CST);
+}
+
+static void sched_atomic_and(volatile uint32_t *p, uint32_t v)
+{
+	__atomic_fetch_and(p, v, __ATOMIC_SEQ_CST);
+}
+
+static void sched_atomic_add(volatile uint32_t *p, uint32_t v)
+{
+	__atomic_fetch_add(p, v, __ATOMIC_SEQ_CST);
+}
+
+static int sched_cas(volatile uint32_t *p, uint32_t expect, uint32_t desired)
+{
+	return __atomic_compare_exchange_n(p, &expect, desired, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+#else
+#include "stm32f7xx.h"
+
+#define sched_barrier()     __DMB()
+#define sched_clz(v)        __CLZ(v)
+
+static void sched_atomic_or(volatile uint32_t *p, uint32_t v)
+{
+	uint32_t old;
+	do
+	{
+		old = __LDREXW(p);
+	} while(__STREXW(old | v, p));
+}
+
+static void sched_atomic_and(volatile uint32_t *p, uint32_t v)
+{
+	uint32_t old;
+	do
+	{
+		old = __LDREXW(p);
+	} while(__STREXW(old & v, p));
+}
+
+static void sched_atomic_add(volatile uint32_t *p, uint32_t v)
+{
+	uint32_t old;
+	do
+	{
+		old = __LDREXW(p);
+	} while(__STREXW(old + v, p));
+}
+
+static int sched_cas(volatile uint32_t *p, uint32_t expect, uint32_t desired)
+{
+	do
+	{
+		if(__LDREXW(p) != expect)
+		{
+			__CLREX();
+			return 0;
+		}
+	} while(__STREXW(desired, p));
+	return 1;
+}
+#endif
+
+static sched_task_t *s_sched_tasks[SCHED_MAX_TASKS];
+static volatile uint32_t s_sched_ready;     //bit n: task of priority n has events
+static uint64_t s_sched_idle_cycles;
+static uint32_t s_sched_stats_start;
+
+void sched_init(void)
+{
+	memset(s_sched_tasks, 0, sizeof(s_sched_tasks));
+	s_sched_ready = 0;
+	sched_stats_reset();
+}
+
+int sched_task_create(sched_task_t *t, uint8_t prio, const char *name,
+                      sched_handler_t handler, void *ctx)
+{
+	uint32_t i;
+
+	if(prio >= SCHED_MAX_TASKS || s_sched_tasks[prio] != 0 || handler == 0)
+		return -1;
+
+	memset(t, 0, sizeof(*t));
+	for(i = 0; i < SCHED_QUEUE_LEN; i++)
+		t->cell[i].seq = i;
+	t->name = name;
+	t->prio = prio;
+	t->ctx = ctx;
+	sched_barrier();
+	t->handler = handler;
+	s_sched_tasks[prio] = t;
+	return 0;
+}
+
+//reserve a cell with CAS on tail, fill it, then publish it through its sequence number
+int sched_post(sched_task_t *t, uint32_t sig, uint32_t arg)
+{
+	sched_cell_t *cell;
+	uint32_t pos;
+	int32_t dif;
+
+	if(t->handler == 0)
+		return -1;
+
+	for(;;)
+	{
+		pos = t->tail;
+		cell = &t->cell[pos & SCHED_QUEUE_MASK];
+		dif = (int32_t)(cell->seq - pos);
+		if(dif == 0)
+		{
+			if(sched_cas(&t->tail, pos, pos + 1u))
+				break;
+		}
+		else if(dif < 0)
+		{
+			//posts from nested interrupts can race here
+			sched_atomic_add(&t->dropped, 1u);
+			return -1;
+		}
+	}
+	cell->evt.sig = sig;
+	cell->evt.arg = arg;
+	sched_barrier();
+	cell->seq = pos + 1u;
+	sched_atomic_or(&s_sched_ready, 1u << t->prio);
+
+#ifdef HOST_BUILD
+	pthread_mutex_lock(&s_sched_idle_lock);
+	pthread_cond_signal(&s_sched_idle_cond);
+	pthread_mutex_unlock(&s_sched_idle_lock);
+#endif
+	return 0;
+}
+
+static int sched_pop(sched_task_t *t, sched_evt_t *evt)
+{
+	uint32_t pos = t->head;
+	sched_cell_t *cell = &t->cell[pos & SCHED_QUEUE_MASK];
+
+	if((int32_t)(cell->seq - (pos + 1u)) < 0)
+		return 0;                   //empty, or the producer has not published yet
+	*evt = cell->evt;
+	sched_barrier();
+	cell->seq = pos + SCHED_QUEUE_LEN;
+	t->head = pos + 1u;
+	return 1;
+}
+
+static int sched_has_event(const sched_task_t *t)
+{
+	return (int32_t)(t->cell[t->head & SCHED_QUEUE_MASK].seq - (t->head + 1u)) >= 0;
+}
+
+//run one event of the highest priority ready task, returns 0 when nothing is ready
+int sched_dispatch(void)
+{
+	sched_task_t *t;
+	sched_evt_t evt;
+	uint32_t ready, prio, t0, dt;
+
+	while((ready = s_sched_ready) != 0)
+	{
+		prio = 31u - sched_clz(ready);
+		t = s_sched_tasks[prio];
+		if(sched_pop(t, &evt))
+		{
+			t0 = prof_now();
+			t->handler(&evt, t->ctx);
+			dt = prof_now() - t0;
+			t->runs++;
+			t->cycles += dt;
+			if(dt > t->max_cycles)
+				t->max_cycles = dt;
+			return 1;
+		}
+		//drained: clear the bit, then look again in case a post raced with us
+		sched_atomic_and(&s_sched_ready, ~(1u << prio));
+		if(sched_has_event(t))
+			sched_atomic_or(&s_sched_ready, 1u << prio);
+	}
+	return 0;
+}
+
+static void sched_idle(void)
+{
+	uint32_t t0 = prof_now();
+
+#ifdef HOST_BUILD
+	pthread_mutex_lock(&s_sched_idle_lock);
+	while(s_sched_ready == 0)
+		pthread_cond_wait(&s_sched_idle_cond, &s_sched_idle_lock);
+	pthread_mutex_unlock(&s_sched_idle_lock);
+#else
+	//with PRIMASK set a pending interrupt still ends WFI, and runs once it is cleared
+	__disable_irq();
+	if(s_sched_ready == 0)
+	{
+		__DSB();
+		__WFI();
+	}
+	__enable_irq();
+#endif
+	s_sched_idle_cycles += prof_now() - t0;
+}
+
+void sched_run(void)
+{
+	while(sched_dispatch())
+	{
+		;
+	}
+	sched_idle();
+}
+
+void sched_stats_reset(void)
+{
+	uint32_t i;
+
+	for(i = 0; i < SCHED_MAX_TASKS; i++)
+	{
+		if(s_sched_tasks[i])
+		{
+			s_sched_tasks[i]->runs = 0;
+			s_sched_tasks[i]->cycles = 0;
+			s_sched_tasks[i]->max_cycles = 0;
+		}
+	}
+	s_sched_idle_cycles = 0;
+	s_sched_stats_start = prof_now();
+}
+
+//per task load in 0.1 % of the time since the last reset, the counter wraps after 2^32 ticks
+void sched_report(void)
+{
+	uint32_t total = prof_now() - s_sched_stats_start;
+	sched_task_t *t;
+	int i;
+
+	if(total == 0)
+		total = 1;
+	printf("task,prio,runs,cycles,max,load_permille,dropped\r\n");
+	for(i = SCHED_MAX_TASKS - 1; i >= 0; i--)
+	{
+		t = s_sched_tasks[i];
+		if(t == 0)
+			continue;
+		printf("%s,%d,%lu,%lu,%lu,%lu,%lu\r\n", t->name, i, (unsigned long)t->runs,
+		       (unsigned long)t->cycles, (unsigned long)t->max_cycles,
+		       (unsigned long)(t->cycles * 1000u / total), (unsigned long)t->dropped);
+	}
+	printf("idle,-,-,%lu,-,%lu,-\r\n", (unsigned long)s_sched_idle_cycles,
+	       (unsigned long)(s_sched_idle_cycles * 1000u / total));
+}
@@ -0,0 +1,70 @@
+#ifndef _sched_H_
+#define _sched_H_
+
+/*
+ * Run-to-completion scheduler for the main loop.
+ *
+ * One task per priority (SCHED_MAX_TASKS, higher number runs first). Every
+ * task owns a bounded event queue, sched_post() may be called from any
+ * interrupt or from thread code and never blocks: the queue is lock-free
+ * (multi producer, the scheduler is the only consumer) and the ready mask
+ * is updated with LDREX/STREX. Handlers run one event at a time and are
+ * never preempted by another task.
+ *
+ * sched_run() dispatches until nothing is ready, then sleeps in WFI until
+ * the next interrupt. Cycles spent in each task and in idle are accounted
+ * with the profiling counter.
+ *
+ * Built with HOST_BUILD the idle sleep is a condition variable and
+ * interrupts are simulated by threads (isr_sim.h).
+ */
+
+#include <stdint.h>
+
+#define SCHED_MAX_TASKS     32
+#define SCHED_QUEUE_LEN     16      //events per task, power of two
+
+//task priorities on this board
+#define SCHED_PRIO_SPI2     20
+#define SCHED_PRIO_UART4    4
+
+typedef struct
+{
+	uint32_t sig;
+	uint32_t arg;
+} sched_evt_t;
+
+typedef void (*sched_handler_t)(const sched_evt_t *evt, void *ctx);
+
+typedef struct
+{
+	volatile uint32_t seq;
+	sched_evt_t       evt;
+} sched_cell_t;
+
+typedef struct
+{
+	const char       *name;
+	sched_handler_t   handler;
+	void             *ctx;
+	uint8_t           prio;
+	volatile uint32_t head;         //consumer position
+	volatile uint32_t tail;         //next position a producer reserves
+	sched_cell_t      cell[SCHED_QUEUE_LEN];
+	/* accounting */
+	uint32_t          runs;
+	uint32_t          max_cycles;
+	uint64_t          cycles;
+	volatile uint32_t dropped;      //posts rejected because the queue was full
+} sched_task_t;
+
+void sched_init(void);
+int  sched_task_create(sched_task_t *t, uint8_t prio, const char *name,
+                       sched_handler_t handler, void *ctx);
+int  sched_post(sched_task_t *t, uint32_t sig, uint32_t arg);
+int  sched_dispatch(void);
+void sched_run(void);
+void sched_stats_reset(void);
+void sched_report(void);
+
+#endif /*_sched_H_*/
@@ -1,4 +1,6 @@
 #include "sdram.h"
+#include "profile.h"
+#include "delay.h"
 
 #ifdef DEBUG
 #define DBG_LOG(x) printf x
@@ -6,33 +8,17 @@
 #define DBG_LOG(x) 
 #endif
 
-static volatile void delay(uint32_t t);
-
-static volatile void delay(uint32_t t)
-{
-	uint32_t i,j,k;
-	while(t--)
-	{
-		for(i=0;i<10;i++)
-		{
-			for(j=0;j<100;j++)
-				{
-					for(k=0;k<1000;k++)
-					{
-						k=k;
-					}
-				}
-		}
-	}
-}
+static PROF_SCOPE(s_prof_sdram_init,  "sdram_init");
+static PROF_SCOPE(s_prof_sdram_write, "sdram_write");
+static PROF_SCOPE(s_prof_sdram_read,  "sdram_read");
 
 void SDRAM_Initialization_Sequence(SDRAM_HandleTypeDef *hsdram)
 {
 	uint32_t temp=0;
+	PROF_BEGIN(s_prof_sdram_init);
   //SDRAMʼԺҪ˳ʼSDRAM
   SDRAM_Send_Cmd(0,FMC_SDRAM_CMD_CLK_ENABLE,1,0); //ʱʹ
-  //delay_us(500);                                  //ʱ200us
-	delay(100);
+  delay_us(500);                                  //ʱ200us
   SDRAM_Send_Cmd(0,FMC_SDRAM_CMD_PALL,1,0);       //д洢Ԥ
   SDRAM_Send_Cmd(0,FMC_SDRAM_CMD_AUTOREFRESH_MODE,8,0);//ˢ´ 
   //ģʽĴ,SDRAMbit0~bit2Ϊָͻʵĳȣ
@@ -50,6 +36,7 @@ void SDRAM_Initialization_Sequence(SDRAM_HandleTypeDef *hsdram)
   //ʹõSDRAMˢΪ64ms,SDCLK=216/2=108Mhz,Ϊ8192(2^13).
 	//,COUNT=64*1000*108/8192-20=823
 	HAL_SDRAM_ProgramRefreshRate(&hsdram1,823);	
+	PROF_END(s_prof_sdram_init);
 }	
 
 //SDRAM
@@ -83,12 +70,14 @@ uint8_t SDRAM_Send_Cmd(uint8_t bankx,uint8_t cmd,uint8_t refresh,uint16_t regval
 //n:Ҫдֽ
 void FMC_SDRAM_WriteBuffer(uint8_t *pBuffer,uint32_t WriteAddr,uint32_t n)
 {
+	PROF_BEGIN(s_prof_sdram_write);
 	for(;n!=0;n--)
 	{
 		*(volatile uint8_t*)(Bank5_SDRAM_ADDR+WriteAddr)=*pBuffer;
 		WriteAddr++;
 		pBuffer++;
 	}
+	PROF_END(s_prof_sdram_write);
 }
 
 //ַָ((WriteAddr+Bank5_SDRAM_ADDR))ʼ,nֽ.
@@ -97,11 +86,13 @@ void FMC_SDRAM_WriteBuffer(uint8_t *pBuffer,uint32_t WriteAddr,uint32_t n)
 //n:Ҫдֽ
 void FMC_SDRAM_ReadBuffer(uint8_t *pBuffer,uint32_t ReadAddr,uint32_t n)
 {
+	PROF_BEGIN(s_prof_sdram_read);
 	for(;n!=0;n--)
 	{
 		*pBuffer++=*(volatile uint8_t*)(Bank5_SDRAM_ADDR+ReadAddr);
 		ReadAddr++;
 	}
+	PROF_END(s_prof_sdram_read);
 }
 
 void fsmc_sdram_test(void)
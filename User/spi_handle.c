@@ -1,5 +1,8 @@
 #include "spi_handle.h"
 #include "spi.h"
+#include "profile.h"
+#include "hrtimer.h"
+#include "sched.h"
 
 #ifdef DEBUG
 #define DBG_LOG(x) printf x
@@ -7,19 +10,35 @@
 #define DBG_LOG(x) 
 #endif
 
-#define SPI2_RX_BUFFER_size 1024
+#define SPI2_RX_BUFFER_size 1024      //power of two, receive ring between the ISR and spi2_task
+#define SPI2_FRAME_TIMEOUT_US 2000   //a frame that stalls this long drops the state machine back to idle
 #define NULL 0
 
 enum spi_rx_state{spi_idle=0,spi_rx_cmd,spi_rx_dat,spi_reply};//global
+enum spi2_evt{spi2_evt_rx=0,spi2_evt_timeout};
 
 /*global variable*/
 uint8_t g_spi2_state;
 uint8_t g_spi2_rx_buffer[SPI2_RX_BUFFER_size]={"0"};
 
-static void __handle_spi2_idle(void);
-static void __handle_spi2_rx_cmd(void);
-static void __handle_spi2_rx_dat(void);
-static void __handle_spi2_reply(void);
+static void __handle_spi2_idle(uint8_t dat);
+static void __handle_spi2_rx_cmd(uint8_t dat);
+static void __handle_spi2_rx_dat(uint8_t dat);
+static void __handle_spi2_reply(uint8_t dat);
+static void spi2_task(const sched_evt_t *evt, void *ctx);
+
+static PROF_SCOPE(s_prof_spi2_isr, "spi2_rx_isr");
+static hrtimer_t s_spi2_frame_timer;
+static sched_task_t s_spi2_task;
+static volatile uint32_t s_spi2_rx_head;       //written by the ISR
+static volatile uint32_t s_spi2_rx_tail;       //written by spi2_task
+static volatile uint8_t s_spi2_rx_pending;     //an rx event is queued and not yet taken
+static volatile uint32_t s_spi2_rx_overrun;    //bytes lost because the ring was full
+
+static void spi2_frame_timeout(hrtimer_t *t, void *arg)
+{
+	sched_post(&s_spi2_task, spi2_evt_timeout, 0);
+}
 
 void spi2_isr_config(void)
 {
@@ -28,49 +47,92 @@ void spi2_isr_config(void)
 	hspi2.RxXferCount=0;
 	hspi2.RxXferSize=0;
 	hspi2.pRxBuffPtr= NULL;
+	hrtimer_setup(&s_spi2_frame_timer, spi2_frame_timeout, NULL);
+	sched_task_create(&s_spi2_task, SCHED_PRIO_SPI2, "spi2", spi2_task, NULL);
 }
 
+//interrupt side: queue the byte, and wake spi2_task only when no rx event is queued yet,
+//so a frame of any length needs one event instead of one per byte
 void spi2_rx_isr(SPI_HandleTypeDef *hspi)
 {
-	hspi=hspi;//
-	//to add rx data from spi2
-	DBG_LOG(("enter spi2 int\r\n"));
-	switch (g_spi2_state)
-		{
-		case spi_idle:
-			__handle_spi2_idle();
-			break;
-		case spi_rx_cmd:
-			__handle_spi2_rx_cmd();
-			break;
-		case spi_rx_dat:
-			__handle_spi2_rx_dat();
-			break;
-		case spi_reply:
-			__handle_spi2_reply();
-			break;
-		default:break;
+	uint8_t dat;
+	uint32_t head;
+	PROF_BEGIN(s_prof_spi2_isr);
+	dat=*(__IO uint8_t *)&hspi->Instance->DR;   //reading DR clears RXNE
+	head = s_spi2_rx_head;
+	if(head - s_spi2_rx_tail < SPI2_RX_BUFFER_size)
+	{
+		g_spi2_rx_buffer[head & (SPI2_RX_BUFFER_size - 1)] = dat;
+		__DMB();
+		s_spi2_rx_head = head + 1;
+	}
+	else
+	{
+		s_spi2_rx_overrun++;
+	}
+	if(!s_spi2_rx_pending && sched_post(&s_spi2_task, spi2_evt_rx, 0) == 0)
+		s_spi2_rx_pending = 1;
+	PROF_END(s_prof_spi2_isr);
+}
+
+static void spi2_task(const sched_evt_t *evt, void *ctx)
+{
+	uint32_t tail;
+	uint8_t dat;
+
+	if(evt->sig == spi2_evt_timeout)
+	{
+		DBG_LOG(("spi2 frame timeout\r\n"));
+		g_spi2_state = spi_idle;
+		return;
+	}
+	//clear pending before draining: a byte queued after this posts a new event
+	s_spi2_rx_pending = 0;
+	__DMB();
+	for(tail = s_spi2_rx_tail; tail != s_spi2_rx_head; tail++)
+	{
+		dat = g_spi2_rx_buffer[tail & (SPI2_RX_BUFFER_size - 1)];
+		s_spi2_rx_tail = tail + 1;
+		switch (g_spi2_state)
+			{
+			case spi_idle:
+				__handle_spi2_idle(dat);
+				break;
+			case spi_rx_cmd:
+				__handle_spi2_rx_cmd(dat);
+				break;
+			case spi_rx_dat:
+				__handle_spi2_rx_dat(dat);
+				break;
+			case spi_reply:
+				__handle_spi2_reply(dat);
+				break;
+			default:break;
+		}
 	}
-	;
+	if(g_spi2_state != spi_idle)
+		hrtimer_start(&s_spi2_frame_timer, SPI2_FRAME_TIMEOUT_US, 0);
+	else
+		hrtimer_cancel(&s_spi2_frame_timer);
 }
 
 
-void __handle_spi2_idle(void)
+void __handle_spi2_idle(uint8_t dat)
 {
 
 }
 
-void __handle_spi2_rx_cmd(void)
+void __handle_spi2_rx_cmd(uint8_t dat)
 {
 
 }
 
-void __handle_spi2_rx_dat(void)
+void __handle_spi2_rx_dat(uint8_t dat)
 {
 
 }
 
-void __handle_spi2_reply(void)
+void __handle_spi2_reply(uint8_t dat)
 {
 
 }
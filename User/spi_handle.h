@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include "stm32f7xx.h"
 
+void spi2_isr_config(void);
 void spi2_rx_isr(SPI_HandleTypeDef *hspi);
 
 #endif
@@ -0,0 +1,17 @@
+/*
+ * The Cortex-M4 paths of the q15 and q31 FIR filters, built from the library
+ * sources under an _m4 suffix so test_fir_m7.c can run them next to the
+ * Cortex-M7 paths the host library is built with.
+ */
+
+#define ARM_MATH_CM4
+
+#define arm_fir_q15         arm_fir_q15_m4
+#define arm_fir_fast_q15    arm_fir_fast_q15_m4
+#define arm_fir_q31         arm_fir_q31_m4
+#define arm_fir_fast_q31    arm_fir_fast_q31_m4
+
+#include "../../Drivers/CMSIS/DSP_Lib/Source/FilteringFunctions/arm_fir_q15.c"
+#include "../../Drivers/CMSIS/DSP_Lib/Source/FilteringFunctions/arm_fir_fast_q15.c"
+#include "../../Drivers/CMSIS/DSP_Lib/Source/FilteringFunctions/arm_fir_q31.c"
+#include "../../Drivers/CMSIS/DSP_Lib/Source/FilteringFunctions/arm_fir_fast_q31.c"
@@ -0,0 +1,411 @@
+/*
+ * Generates ref_dsp.h, the golden vectors of test_dsp_golden.c, in double
+ * precision from the definitions of the functions, never from the library:
+ *   gcc -std=gnu99 -O2 -o gen_ref_dsp User/test/gen_ref_dsp.c -lm
+ *   ./gen_ref_dsp > User/test/ref_dsp.h
+ *
+ * The inputs are multiples of 2^-15, so the f32, q31 and q15 versions of a
+ * function all see exactly the same input and differ only in their own
+ * arithmetic.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+
+#define REF_N           128
+#define REF_FIR_TAPS    30
+#define REF_CONV_LEN    64
+#define REF_MAT_DIM     8
+#define REF_CFFT_LEN    64
+#define REF_TABLE_LEN   65
+#define REF_PI          3.14159265358979323846
+
+static int16_t s_x[REF_N];      //[-0.5, 0.5)
+static int16_t s_y[REF_N];      //[-0.5, 0.5)
+static int16_t s_s[REF_N];      //[-0.125, 0.125), matrix operand
+static int16_t s_h[REF_FIR_TAPS];
+static int16_t s_biquad[10];    //2 stages {b0, b1, b2, a1, a2} in 2.14, a with the CMSIS sign
+static int16_t s_table[REF_TABLE_LEN];
+static double  s_out[REF_N * 2 + REF_FIR_TAPS];
+
+static uint32_t s_seed = 20261019u;
+
+static uint32_t gen_rand(void)
+{
+	s_seed = s_seed * 1664525u + 1013904223u;
+	return s_seed;
+}
+
+static double q15(int16_t v)
+{
+	return v / 32768.0;
+}
+
+static void gen_q15(const char *name, const int16_t *v, uint32_t n)
+{
+	uint32_t i;
+
+	printf("static const int16_t %s[%u] =\n{", name, n);
+	for(i = 0; i < n; i++)
+		printf("%s%6d%s", (i % 10u) ? " " : "\n\t", v[i], (i + 1u < n) ? "," : "\n");
+	printf("};\n\n");
+}
+
+static void gen_double(const char *name, const double *v, uint32_t n)
+{
+	uint32_t i;
+
+	printf("static const double %s[%u] =\n{", name, n);
+	for(i = 0; i < n; i++)
+		printf("%s%.17g%s", (i % 4u) ? " " : "\n\t", v[i], (i + 1u < n) ? "," : "\n");
+	printf("};\n\n");
+}
+
+//RBJ cookbook biquad, quantised to 2.14
+static void gen_biquad(int16_t *c, double w, double q, int high)
+{
+	double alpha = sin(w) / (2.0 * q), cw = cos(w), a0 = 1.0 + alpha;
+	double b0 = high ? (1.0 + cw) / 2.0 : (1.0 - cw) / 2.0;
+	double b1 = high ? -(1.0 + cw) : 1.0 - cw;
+
+	c[0] = (int16_t)lrint(b0 / a0 * 16384.0);
+	c[1] = (int16_t)lrint(b1 / a0 * 16384.0);
+	c[2] = c[0];
+	c[3] = (int16_t)lrint(2.0 * cw / a0 * 16384.0);
+	c[4] = (int16_t)lrint(-(1.0 - alpha) / a0 * 16384.0);
+}
+
+static void gen_inputs(void)
+{
+	double h[REF_FIR_TAPS], m, sum = 0;
+	uint32_t i;
+
+	for(i = 0; i < REF_N; i++)
+	{
+		s_x[i] = (int16_t)((int32_t)gen_rand() >> 17);
+		s_y[i] = (int16_t)((int32_t)gen_rand() >> 17);
+		s_s[i] = (int16_t)((int32_t)gen_rand() >> 19);
+	}
+	//Hamming windowed sinc low pass at 0.2 fs, unity gain at DC
+	for(i = 0; i < REF_FIR_TAPS; i++)
+	{
+		m = i - (REF_FIR_TAPS - 1) / 2.0;
+		h[i] = 0.4 * (m == 0 ? 1.0 : sin(0.4 * REF_PI * m) / (0.4 * REF_PI * m));
+		h[i] *= 0.54 - 0.46 * cos(2.0 * REF_PI * i / (REF_FIR_TAPS - 1));
+		sum += h[i];
+	}
+	for(i = 0; i < REF_FIR_TAPS; i++)
+		s_h[i] = (int16_t)lrint(h[i] / sum * 32768.0);
+	gen_biquad(&s_biquad[0], 2.0 * REF_PI * 0.1, 0.7071, 0);
+	gen_biquad(&s_biquad[5], 2.0 * REF_PI * 0.05, 0.7071, 1);
+	//positive table, the fixed-point interpolation doubles its result with a shift
+	for(i = 0; i < REF_TABLE_LEN; i++)
+		s_table[i] = (int16_t)lrint((0.5 + 0.4 * sin(2.0 * REF_PI * i / (REF_TABLE_LEN - 1))) * 32768.0);
+}
+
+static void gen_basic(void)
+{
+	double dot = 0;
+	uint32_t i;
+
+	for(i = 0; i < REF_N; i++)
+		s_out[i] = q15(s_x[i]) + q15(s_y[i]);
+	gen_double("ref_add", s_out, REF_N);
+	for(i = 0; i < REF_N; i++)
+		s_out[i] = q15(s_x[i]) * q15(s_y[i]);
+	gen_double("ref_mult", s_out, REF_N);
+	for(i = 0; i < REF_N; i++)
+		s_out[i] = q15(s_x[i]) * 0.75;
+	gen_double("ref_scale", s_out, REF_N);
+	for(i = 0; i < REF_N; i++)
+		s_out[i] = fabs(q15(s_x[i]));
+	gen_double("ref_abs", s_out, REF_N);
+	for(i = 0; i < REF_N; i++)
+		dot += q15(s_x[i]) * q15(s_y[i]);
+	gen_double("ref_dot", &dot, 1);
+}
+
+//x and y read as REF_N / 2 complex samples
+static void gen_complex(void)
+{
+	double ar, ai, br, bi;
+	uint32_t i;
+
+	for(i = 0; i < REF_N / 2; i++)
+	{
+		ar = q15(s_x[2 * i]);
+		ai = q15(s_x[2 * i + 1]);
+		br = q15(s_y[2 * i]);
+		bi = q15(s_y[2 * i + 1]);
+		s_out[2 * i] = ar * br - ai * bi;
+		s_out[2 * i + 1] = ar * bi + ai * br;
+	}
+	gen_double("ref_cmplx_mult", s_out, REF_N);
+	for(i = 0; i < REF_N / 2; i++)
+		s_out[i] = hypot(q15(s_x[2 * i]), q15(s_x[2 * i + 1]));
+	gen_double("ref_cmplx_mag", s_out, REF_N / 2);
+}
+
+//sin_cos takes degrees, x * 360 covers [-180, 180)
+static void gen_controller(void)
+{
+	double y = 0, x1 = 0, x2 = 0, x, a0, a1, a2;
+	double kp = 0.1, ki = 0.01, kd = 0.05;
+	uint32_t i;
+
+	for(i = 0; i < REF_N; i++)
+		s_out[i] = sin(q15(s_x[i]) * 2.0 * REF_PI);
+	gen_double("ref_sin_cos_sin", s_out, REF_N);
+	for(i = 0; i < REF_N; i++)
+		s_out[i] = cos(q15(s_x[i]) * 2.0 * REF_PI);
+	gen_double("ref_sin_cos_cos", s_out, REF_N);
+
+	//PID with Kp 0.1, Ki 0.01, Kd 0.05, in the incremental form of arm_pid_f32
+	a0 = kp + ki + kd;
+	a1 = -kp - 2.0 * kd;
+	a2 = kd;
+	for(i = 0; i < REF_N; i++)
+	{
+		x = q15(s_x[i]);
+		y += a0 * x + a1 * x1 + a2 * x2;
+		x2 = x1;
+		x1 = x;
+		s_out[i] = y;
+	}
+	gen_double("ref_pid", s_out, REF_N);
+}
+
+//angles x + 0.5 of a full turn, square roots of |x|
+static void gen_fast_math(void)
+{
+	uint32_t i;
+
+	for(i = 0; i < REF_N; i++)
+		s_out[i] = sin((q15(s_x[i]) + 0.5) * 2.0 * REF_PI);
+	gen_double("ref_sin", s_out, REF_N);
+	for(i = 0; i < REF_N; i++)
+		s_out[i] = cos((q15(s_x[i]) + 0.5) * 2.0 * REF_PI);
+	gen_double("ref_cos", s_out, REF_N);
+	for(i = 0; i < REF_N; i++)
+		s_out[i] = sqrt(fabs(q15(s_x[i])));
+	gen_double("ref_sqrt", s_out, REF_N);
+}
+
+static void gen_filtering(void)
+{
+	double w[2][4] = { { 0 } }, v, y;
+	uint32_t i, k, st;
+	const int16_t *c;
+
+	for(i = 0; i < REF_N; i++)
+	{
+		s_out[i] = 0;
+		for(k = 0; k < REF_FIR_TAPS && k <= i; k++)
+			s_out[i] += q15(s_h[k]) * q15(s_x[i - k]);
+	}
+	gen_double("ref_fir", s_out, REF_N);
+
+	//direct form I, state {x[n-1], x[n-2], y[n-1], y[n-2]} per stage
+	for(i = 0; i < REF_N; i++)
+	{
+		v = q15(s_x[i]);
+		for(st = 0; st < 2; st++)
+		{
+			c = &s_biquad[5 * st];
+			y = (c[0] * v + c[1] * w[st][0] + c[2] * w[st][1] + c[3] * w[st][2] + c[4] * w[st][3]) / 16384.0;
+			w[st][1] = w[st][0];
+			w[st][0] = v;
+			w[st][3] = w[st][2];
+			w[st][2] = y;
+			v = y;
+		}
+		s_out[i] = v;
+	}
+	gen_double("ref_biquad", s_out, REF_N);
+
+	for(i = 0; i < REF_CONV_LEN + REF_FIR_TAPS - 1; i++)
+	{
+		s_out[i] = 0;
+		for(k = 0; k < REF_FIR_TAPS; k++)
+		{
+			if(i >= k && i - k < REF_CONV_LEN)
+				s_out[i] += q15(s_h[k]) * q15(s_x[i - k]);
+		}
+	}
+	gen_double("ref_conv", s_out, REF_CONV_LEN + REF_FIR_TAPS - 1);
+}
+
+//A is x, B is s, both row major; the inverse is of x with 4 added to the diagonal
+static void gen_matrix(void)
+{
+	double a[REF_MAT_DIM][2 * REF_MAT_DIM], t, f;
+	uint32_t r, c, k, p, n = REF_MAT_DIM;
+
+	for(r = 0; r < n; r++)
+	{
+		for(c = 0; c < n; c++)
+		{
+			s_out[r * n + c] = 0;
+			for(k = 0; k < n; k++)
+				s_out[r * n + c] += q15(s_x[r * n + k]) * q15(s_s[k * n + c]);
+		}
+	}
+	gen_double("ref_mat_mult", s_out, n * n);
+
+	//Gauss-Jordan with partial pivoting
+	for(r = 0; r < n; r++)
+	{
+		for(c = 0; c < n; c++)
+		{
+			a[r][c] = q15(s_x[r * n + c]) + (r == c ? 4.0 : 0.0);
+			a[r][n + c] = (r == c) ? 1.0 : 0.0;
+		}
+	}
+	for(c = 0; c < n; c++)
+	{
+		p = c;
+		for(r = c + 1; r < n; r++)
+		{
+			if(fabs(a[r][c]) > fabs(a[p][c]))
+				p = r;
+		}
+		for(k = 0; k < 2 * n; k++)
+		{
+			t = a[c][k];
+			a[c][k] = a[p][k];
+			a[p][k] = t;
+		}
+		f = a[c][c];
+		for(k = 0; k < 2 * n; k++)
+			a[c][k] /= f;
+		for(r = 0; r < n; r++)
+		{
+			if(r == c)
+				continue;
+			f = a[r][c];
+			for(k = 0; k < 2 * n; k++)
+				a[r][k] -= f * a[c][k];
+		}
+	}
+	for(r = 0; r < n; r++)
+	{
+		for(c = 0; c < n; c++)
+			s_out[r * n + c] = a[r][n + c];
+	}
+	gen_double("ref_mat_inverse", s_out, n * n);
+}
+
+//{mean, variance (N - 1), standard deviation, rms, power}
+static void gen_statistics(void)
+{
+	double sum = 0, sq = 0, st[5];
+	uint32_t i;
+
+	for(i = 0; i < REF_N; i++)
+	{
+		sum += q15(s_x[i]);
+		sq += q15(s_x[i]) * q15(s_x[i]);
+	}
+	st[0] = sum / REF_N;
+	st[1] = (sq - sum * sum / REF_N) / (REF_N - 1);
+	st[2] = sqrt(st[1]);
+	st[3] = sqrt(sq / REF_N);
+	st[4] = sq;
+	gen_double("ref_stats", st, 5);
+}
+
+static void gen_transform(void)
+{
+	double re, im, a;
+	uint32_t k, n;
+
+	//x read as REF_CFFT_LEN complex samples
+	for(k = 0; k < REF_CFFT_LEN; k++)
+	{
+		re = im = 0;
+		for(n = 0; n < REF_CFFT_LEN; n++)
+		{
+			a = -2.0 * REF_PI * (double)((k * n) % REF_CFFT_LEN) / REF_CFFT_LEN;
+			re += q15(s_x[2 * n]) * cos(a) - q15(s_x[2 * n + 1]) * sin(a);
+			im += q15(s_x[2 * n]) * sin(a) + q15(s_x[2 * n + 1]) * cos(a);
+		}
+		s_out[2 * k] = re;
+		s_out[2 * k + 1] = im;
+	}
+	gen_double("ref_cfft", s_out, 2 * REF_CFFT_LEN);
+
+	//real x of length REF_N, bins 0 .. REF_N / 2
+	for(k = 0; k <= REF_N / 2; k++)
+	{
+		re = im = 0;
+		for(n = 0; n < REF_N; n++)
+		{
+			a = -2.0 * REF_PI * (double)((k * n) % REF_N) / REF_N;
+			re += q15(s_x[n]) * cos(a);
+			im += q15(s_x[n]) * sin(a);
+		}
+		s_out[2 * k] = re;
+		s_out[2 * k + 1] = im;
+	}
+	gen_double("ref_rfft", s_out, REF_N + 2);
+
+	//DCT-IV normalised by sqrt(2 / N)
+	for(k = 0; k < REF_N; k++)
+	{
+		s_out[k] = 0;
+		for(n = 0; n < REF_N; n++)
+			s_out[k] += q15(s_x[n]) * cos(REF_PI / REF_N * (n + 0.5) * (k + 0.5));
+		s_out[k] *= sqrt(2.0 / REF_N);
+	}
+	gen_double("ref_dct4", s_out, REF_N);
+}
+
+//table positions (x + 0.5) * (REF_TABLE_LEN - 1)
+static void gen_interpolation(void)
+{
+	double t, f;
+	uint32_t i, k;
+
+	for(i = 0; i < REF_N; i++)
+	{
+		t = (q15(s_x[i]) + 0.5) * (REF_TABLE_LEN - 1);
+		k = (uint32_t)t;
+		f = t - k;
+		s_out[i] = (1.0 - f) * q15(s_table[k]) + f * q15(s_table[k + 1]);
+	}
+	gen_double("ref_interp", s_out, REF_N);
+}
+
+int main(void)
+{
+	gen_inputs();
+	printf("#ifndef _ref_dsp_H_\n#define _ref_dsp_H_\n\n");
+	printf("/*\n * Golden vectors of test_dsp_golden.c, generated by gen_ref_dsp.c. Do not edit.\n */\n\n");
+	printf("#define REF_N           %d\n", REF_N);
+	printf("#define REF_FIR_TAPS    %d\n", REF_FIR_TAPS);
+	printf("#define REF_CONV_LEN    %d\n", REF_CONV_LEN);
+	printf("#define REF_MAT_DIM     %d\n", REF_MAT_DIM);
+	printf("#define REF_CFFT_LEN    %d\n", REF_CFFT_LEN);
+	printf("#define REF_TABLE_LEN   %d\n\n", REF_TABLE_LEN);
+	printf("/* inputs in 1.15 */\n\n");
+	gen_q15("ref_x", s_x, REF_N);
+	gen_q15("ref_y", s_y, REF_N);
+	gen_q15("ref_s", s_s, REF_N);
+	gen_q15("ref_fir_coeffs", s_h, REF_FIR_TAPS);
+	printf("/* two stages {b0, b1, b2, a1, a2} in 2.14 */\n");
+	gen_q15("ref_biquad_coeffs", s_biquad, 10);
+	gen_q15("ref_table", s_table, REF_TABLE_LEN);
+	printf("/* outputs */\n\n");
+	gen_basic();
+	gen_complex();
+	gen_controller();
+	gen_fast_math();
+	gen_filtering();
+	gen_matrix();
+	gen_statistics();
+	gen_transform();
+	gen_interpolation();
+	printf("#endif /*_ref_dsp_H_*/\n");
+	return 0;
+}
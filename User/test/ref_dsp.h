@@ -0,0 +1,806 @@
+#ifndef _ref_dsp_H_
+#define _ref_dsp_H_
+
+/*
+ * Golden vectors of test_dsp_golden.c, generated by gen_ref_dsp.c. Do not edit.
+ */
+
+#define REF_N           128
+#define REF_FIR_TAPS    30
+#define REF_CONV_LEN    64
+#define REF_MAT_DIM     8
+#define REF_CFFT_LEN    64
+#define REF_TABLE_LEN   65
+
+/* inputs in 1.15 */
+
+static const int16_t ref_x[128] =
+{
+	 14521,  -1282,  -5099, -13071,  -9409,  -9529,  -6807,  10022,  15445,  11740,
+	 12063,  12549, -16003, -11380,  -6188,  12242, -14790,   8066,   8452,   5796,
+	 12597, -12231,  -4680,  -8790,  -1038,   -874,   1747,  12180,   6966,   -354,
+	   768, -15595, -10752,    326, -16316, -10610,  14634,  -2193,  15651,  -7217,
+	 -2653,  -7684,  16249, -15873,   5971,  -5373, -14624,   2979,   8851,   -985,
+	 -5952,  16067, -14769,   5648, -11265,  11567,  -3903, -12551,  -9650,  -3351,
+	 13523,   -400,   -747, -14172,   3609,  15396,   7172,  10354,  12658,  -2080,
+	   831,  -9596,  14402,   4253,  14125,   8210,   5206,  -3908,  -1052, -11677,
+	 -9637, -10918,  13884,  -5138,   4356,   1733,  -7050,   4519, -11585,  -6124,
+	  3217, -11683,  12314,  -7204,   7729,  -3512,  -8000,  -9210,  -6605,  14504,
+	 -3821,  -7483, -11815, -10863,  14958,   8876,  -8298,   5579,   5121,  -1051,
+	 15230,  15069, -13744,   -890,   9557,  -4814,   2896,  -1531,  -8646,  -8612,
+	  5415,  12755,  -1033, -11907,   5512,  -2291,   8175,  -8243
+};
+
+static const int16_t ref_y[128] =
+{
+	  -397,  -3423,   6739,  -7254,  -5834,   3693,  -5858,  -9567,   2961,   3676,
+	  3130,  -8712,  12328,  -1012,  -3302,  12963,  12687,   7818,  13884,  12303,
+	   209,    591,  10758,   4784,  15888, -12834, -13644,  -4562,  -1708,  12543,
+	 -6282,   7475, -11929,  -9055,   4768,  11483, -14619,   4441,   -766,  -7745,
+	 14681,  -3462,    607,   5287,   9354,  -5159, -13054, -15148, -11300,   6183,
+	  5748,  -8721,  -7717,  13809,  11089, -12391,  -1573,  -9920,  -1983,  13464,
+	 -3645,  10193,   1547,  -6238,  -3600,   3577,  -5427,    976,    318,  -1504,
+	-10673,  -4438,  -5335, -13089,   -129,  10707,   5658, -13376,  -9986, -13736,
+	   -59,   1177,   4833,   5026,  13750,  12173,   3963, -11267,  16373,  15784,
+	  4446, -16180,   5063,  -7651,   2154,  12370, -15205,   1061,   1029,  12071,
+	-14066,  10111,  -3983,   3901, -13810,  -1656,  -6844,  11926,   4644, -12034,
+	 -5382, -11380, -11563,   3678,  15791,   7363,   5679,  -5410,  13040,   8887,
+	-11672,  -7152,   2231,   2277,  13738,   4637,    894,  -9056
+};
+
+static const int16_t ref_s[128] =
+{
+	  1104,  -2406,   4026,    986,   1614,    924,    392,    887,  -3070,   2630,
+	 -3102,  -3375,  -4092,   1140,  -1102,   2479,   2664,   1812,    898,   2000,
+	  3820,   2338,  -1616,   1593,   -489,  -3158,  -4019,   -184,  -1860,  -1967,
+	 -1493,   -234,   3429,  -3099,  -1916,  -2664,   -217,   2680,  -2858,   3089,
+	  1371,  -3453,   2660,   1858,   3016,   3212,   2777,   2028,    677,   3290,
+	 -3685,    789,  -2539,   1197,    322,  -3180,   3200,    130,   3766,   3685,
+	 -3247,  -1831,   1399,   2891,   2476,  -1270,  -1905,  -1229,    119,  -2150,
+	 -1116,   3551,   3933,   2979,   1983,  -3999,   1581,    694,  -2261,  -2604,
+	  2599,  -2349,   3085,    996,  -2382,  -1057,   -748,   1176,    244,   3111,
+	  3039,   1774,   1492,  -3226,  -3968,    -79,  -3604,   -548,   3499,   1060,
+	 -1322,  -1819,   2322,    -19,   2413,  -1383,   2914,   4043,   -918,   3574,
+	 -3223,  -3437,  -3338,   2324,   4071,   2551,  -2406,  -1316,  -1146,   3218,
+	  1050,   1483,   -391,  -3394,  -1350,   1338,    323,   4019
+};
+
+static const int16_t ref_fir_coeffs[30] =
+{
+	   -34,    -67,      0,    150,    142,   -210,   -488,      0,    940,    794,
+	 -1090,  -2483,      0,   6470,  12260,  12260,   6470,      0,  -2483,  -1090,
+	   794,    940,      0,   -488,   -210,    142,    150,      0,    -67,    -34
+};
+
+/* two stages {b0, b1, b2, a1, a2} in 2.14 */
+static const int16_t ref_biquad_coeffs[10] =
+{
+	  1105,   2210,   1105,  18727,  -6763,  13117, -26234,  13117,  25576, -10508
+};
+
+static const int16_t ref_table[65] =
+{
+	 16384,  17669,  18941,  20189,  21400,  22563,  23666,  24699,  25652,  26516,
+	 27282,  27944,  28493,  28927,  29239,  29428,  29491,  29428,  29239,  28927,
+	 28493,  27944,  27282,  26516,  25652,  24699,  23666,  22563,  21400,  20189,
+	 18941,  17669,  16384,  15099,  13827,  12579,  11368,  10205,   9102,   8069,
+	  7116,   6252,   5486,   4824,   4275,   3841,   3529,   3340,   3277,   3340,
+	  3529,   3841,   4275,   4824,   5486,   6252,   7116,   8069,   9102,  10205,
+	 11368,  12579,  13827,  15099,  16384
+};
+
+/* outputs */
+
+static const double ref_add[128] =
+{
+	0.4310302734375, -0.143585205078125, 0.050048828125, -0.620269775390625,
+	-0.465179443359375, -0.1781005859375, -0.386505126953125, 0.013885498046875,
+	0.56170654296875, 0.470458984375, 0.463653564453125, 0.117095947265625,
+	-0.112152099609375, -0.378173828125, -0.28961181640625, 0.769195556640625,
+	-0.064178466796875, 0.4847412109375, 0.681640625, 0.552337646484375,
+	0.39080810546875, -0.355224609375, 0.18548583984375, -0.12225341796875,
+	0.45318603515625, -0.4183349609375, -0.363067626953125, 0.23248291015625,
+	0.16046142578125, 0.371978759765625, -0.16827392578125, -0.247802734375,
+	-0.692169189453125, -0.266387939453125, -0.3524169921875, 0.026641845703125,
+	0.000457763671875, 0.068603515625, 0.454254150390625, -0.45660400390625,
+	0.3670654296875, -0.34014892578125, 0.514404296875, -0.32305908203125,
+	0.467681884765625, -0.3214111328125, -0.84466552734375, -0.371368408203125,
+	-0.074737548828125, 0.15863037109375, -0.0062255859375, 0.22418212890625,
+	-0.68621826171875, 0.593780517578125, -0.00537109375, -0.025146484375,
+	-0.1671142578125, -0.685760498046875, -0.355010986328125, 0.308624267578125,
+	0.30145263671875, 0.298858642578125, 0.0244140625, -0.62286376953125,
+	0.000274658203125, 0.579010009765625, 0.053253173828125, 0.34576416015625,
+	0.39599609375, -0.109375, -0.30035400390625, -0.42828369140625,
+	0.276702880859375, -0.2696533203125, 0.4271240234375, 0.577301025390625,
+	0.33154296875, -0.5274658203125, -0.33685302734375, -0.775543212890625,
+	-0.2958984375, -0.297271728515625, 0.571197509765625, -0.00341796875,
+	0.55255126953125, 0.42437744140625, -0.094207763671875, -0.2059326171875,
+	0.1461181640625, 0.2947998046875, 0.233856201171875, -0.850311279296875,
+	0.530303955078125, -0.453338623046875, 0.301605224609375, 0.27032470703125,
+	-0.708160400390625, -0.248687744140625, -0.170166015625, 0.811004638671875,
+	-0.545867919921875, 0.0802001953125, -0.48211669921875, -0.21246337890625,
+	0.0350341796875, 0.2203369140625, -0.46209716796875, 0.534210205078125,
+	0.298004150390625, -0.399322509765625, 0.300537109375, 0.112579345703125,
+	-0.772308349609375, 0.0850830078125, 0.7735595703125, 0.077789306640625,
+	0.261688232421875, -0.211822509765625, 0.13409423828125, 0.008392333984375,
+	-0.190948486328125, 0.170989990234375, 0.03656005859375, -0.29388427734375,
+	0.58746337890625, 0.07159423828125, 0.276763916015625, -0.527923583984375
+};
+
+static const double ref_mult[128] =
+{
+	-0.0053689228370785713, 0.0040869098156690598, -0.032002256251871586, 0.088305244222283363,
+	0.051122257485985756, -0.032773797400295734, 0.0371368657797575, -0.089295649901032448,
+	0.04259184468537569, 0.040192380547523499, 0.035164123401045799, -0.10181859880685806,
+	-0.18373595923185349, 0.010725632309913635, 0.019029505550861359, 0.14779441617429256,
+	-0.17475404776632786, 0.05872919037938118, 0.10928843915462494, 0.06641092523932457,
+	0.0024519609287381172, -0.0067320847883820534, -0.046889707446098328, -0.039163380861282349,
+	-0.01535913348197937, 0.010446567088365555, -0.02219906821846962, -0.051749087870121002,
+	-0.011080808937549591, -0.0041352789849042892, -0.0044932365417480469, -0.1085667172446847,
+	0.11945199966430664, -0.0027491990476846695, -0.072451949119567871, -0.11346734128892422,
+	-0.19924197904765606, -0.0090702557936310768, -0.01116531528532505, 0.052056894637644291,
+	-0.036273797042667866, 0.024775050580501556, 0.0091857677325606346, -0.07815710362046957,
+	0.052016912028193474, 0.025815616361796856, 0.1777910590171814, -0.042026761919260025,
+	-0.093147438019514084, -0.0056719919666647911, -0.031862497329711914, -0.13049720507115126,
+	0.10614504385739565, 0.072636857628822327, -0.11633856687694788, -0.13348338846117258,
+	0.0057177795097231865, 0.1159551739692688, 0.017821742221713066, -0.042019285261631012,
+	-0.045906133018434048, -0.003797188401222229, -0.0010762447491288185, 0.082333512604236603,
+	-0.012100115418434143, 0.051289323717355728, -0.036249350756406784, 0.0094114840030670166,
+	0.0037488006055355072, 0.0029134750366210938, -0.0082601448521018028, 0.039662279188632965,
+	-0.071557862684130669, -0.051844415254890919, -0.0016969861462712288, 0.081867417320609093,
+	0.027432616800069809, 0.048683404922485352, 0.0097837969660758972, 0.14937973767518997,
+	0.00052953418344259262, -0.011967947706580162, 0.062493022531270981, -0.024050090461969376,
+	0.055781565606594086, 0.019647003151476383, -0.026020361110568047, -0.047418822534382343,
+	-0.17665438819676638, -0.090022772550582886, 0.013320503756403923, 0.17604878172278404,
+	0.058064034208655357, 0.05133245512843132, 0.015504905954003334, -0.040459856390953064,
+	0.11328607797622681, -0.0091007072478532791, -0.0063297757878899574, 0.16305389255285263,
+	0.050055036321282387, -0.070464436896145344, 0.043827244080603123, -0.039466249756515026,
+	-0.1923832856118679, -0.013689190149307251, 0.052891217172145844, 0.061965690925717354,
+	0.022148642688989639, 0.011779120191931725, -0.076338518410921097, -0.15970805659890175,
+	0.14800752699375153, -0.0030486099421977997, 0.14055016171187162, -0.033011177554726601,
+	0.015316888689994812, 0.0077138748019933701, -0.10500088334083557, -0.071278627961874008,
+	-0.05886320024728775, -0.084958747029304504, -0.0021463474258780479, -0.025250240229070187,
+	0.07052333652973175, -0.0098937815055251122, 0.006806524470448494, 0.069521933794021606
+};
+
+static const double ref_scale[128] =
+{
+	0.33235931396484375, -0.0293426513671875, -0.11670684814453125, -0.29917144775390625,
+	-0.21535491943359375, -0.21810150146484375, -0.15579986572265625, 0.2293853759765625,
+	0.35350799560546875, 0.268707275390625, 0.27610015869140625, 0.28722381591796875,
+	-0.36627960205078125, -0.260467529296875, -0.141632080078125, 0.2801971435546875,
+	-0.3385162353515625, 0.1846160888671875, 0.193450927734375, 0.132659912109375,
+	0.28832244873046875, -0.27994537353515625, -0.10711669921875, -0.2011871337890625,
+	-0.0237579345703125, -0.0200042724609375, 0.03998565673828125, 0.278778076171875,
+	0.1594390869140625, -0.0081024169921875, 0.017578125, -0.35694122314453125,
+	-0.24609375, 0.0074615478515625, -0.373443603515625, -0.2428436279296875,
+	0.3349456787109375, -0.05019378662109375, 0.35822296142578125, -0.16518402099609375,
+	-0.06072235107421875, -0.175872802734375, 0.37191009521484375, -0.36330413818359375,
+	0.13666534423828125, -0.12297821044921875, -0.334716796875, 0.06818389892578125,
+	0.20258331298828125, -0.02254486083984375, -0.13623046875, 0.36774444580078125,
+	-0.33803558349609375, 0.1292724609375, -0.25783538818359375, 0.26474761962890625,
+	-0.08933258056640625, -0.28726959228515625, -0.2208709716796875, -0.07669830322265625,
+	0.30951690673828125, -0.0091552734375, -0.01709747314453125, -0.324371337890625,
+	0.08260345458984375, 0.352386474609375, 0.164154052734375, 0.2369842529296875,
+	0.2897186279296875, -0.047607421875, 0.01902008056640625, -0.219635009765625,
+	0.3296356201171875, 0.09734344482421875, 0.32329559326171875, 0.1879119873046875,
+	0.1191558837890625, -0.089447021484375, -0.024078369140625, -0.26726531982421875,
+	-0.22057342529296875, -0.2498931884765625, 0.317779541015625, -0.1175994873046875,
+	0.099700927734375, 0.03966522216796875, -0.1613616943359375, 0.10343170166015625,
+	-0.26515960693359375, -0.140167236328125, 0.07363128662109375, -0.26740264892578125,
+	0.2818450927734375, -0.164886474609375, 0.17690277099609375, -0.08038330078125,
+	-0.18310546875, -0.2108001708984375, -0.15117645263671875, 0.33197021484375,
+	-0.08745574951171875, -0.17127227783203125, -0.27042388916015625, -0.24863433837890625,
+	0.3423614501953125, 0.203155517578125, -0.1899261474609375, 0.12769317626953125,
+	0.11721038818359375, -0.02405548095703125, 0.3485870361328125, 0.34490203857421875,
+	-0.3145751953125, -0.0203704833984375, 0.21874237060546875, -0.1101837158203125,
+	0.0662841796875, -0.03504180908203125, -0.1978912353515625, -0.197113037109375,
+	0.12393951416015625, 0.29193878173828125, -0.02364349365234375, -0.27252960205078125,
+	0.12615966796875, -0.05243682861328125, 0.18711090087890625, -0.18866729736328125
+};
+
+static const double ref_abs[128] =
+{
+	0.443145751953125, 0.03912353515625, 0.155609130859375, 0.398895263671875,
+	0.287139892578125, 0.290802001953125, 0.207733154296875, 0.30584716796875,
+	0.471343994140625, 0.3582763671875, 0.368133544921875, 0.382965087890625,
+	0.488372802734375, 0.3472900390625, 0.1888427734375, 0.37359619140625,
+	0.45135498046875, 0.24615478515625, 0.2579345703125, 0.1768798828125,
+	0.384429931640625, 0.373260498046875, 0.142822265625, 0.26824951171875,
+	0.03167724609375, 0.02667236328125, 0.053314208984375, 0.3717041015625,
+	0.21258544921875, 0.01080322265625, 0.0234375, 0.475921630859375,
+	0.328125, 0.00994873046875, 0.4979248046875, 0.32379150390625,
+	0.44659423828125, 0.066925048828125, 0.477630615234375, 0.220245361328125,
+	0.080963134765625, 0.2344970703125, 0.495880126953125, 0.484405517578125,
+	0.182220458984375, 0.163970947265625, 0.4462890625, 0.090911865234375,
+	0.270111083984375, 0.030059814453125, 0.181640625, 0.490325927734375,
+	0.450714111328125, 0.17236328125, 0.343780517578125, 0.352996826171875,
+	0.119110107421875, 0.383026123046875, 0.29449462890625, 0.102264404296875,
+	0.412689208984375, 0.01220703125, 0.022796630859375, 0.4324951171875,
+	0.110137939453125, 0.4698486328125, 0.2188720703125, 0.31597900390625,
+	0.38629150390625, 0.0634765625, 0.025360107421875, 0.2928466796875,
+	0.43951416015625, 0.129791259765625, 0.431060791015625, 0.25054931640625,
+	0.15887451171875, 0.1192626953125, 0.0321044921875, 0.356353759765625,
+	0.294097900390625, 0.33319091796875, 0.4237060546875, 0.15679931640625,
+	0.1329345703125, 0.052886962890625, 0.21514892578125, 0.137908935546875,
+	0.353546142578125, 0.1868896484375, 0.098175048828125, 0.356536865234375,
+	0.37579345703125, 0.2198486328125, 0.235870361328125, 0.107177734375,
+	0.244140625, 0.28106689453125, 0.201568603515625, 0.442626953125,
+	0.116607666015625, 0.228363037109375, 0.360565185546875, 0.331512451171875,
+	0.45648193359375, 0.2708740234375, 0.25323486328125, 0.170257568359375,
+	0.156280517578125, 0.032073974609375, 0.46478271484375, 0.459869384765625,
+	0.41943359375, 0.02716064453125, 0.291656494140625, 0.14691162109375,
+	0.08837890625, 0.046722412109375, 0.26385498046875, 0.2628173828125,
+	0.165252685546875, 0.389251708984375, 0.031524658203125, 0.363372802734375,
+	0.168212890625, 0.069915771484375, 0.249481201171875, 0.251556396484375
+};
+
+static const double ref_dot[1] =
+{
+	-0.21823534369468689
+};
+
+static const double ref_cmplx_mult[128] =
+{
+	-0.0094558326527476311, -0.045817744918167591, -0.12030750047415495, -0.047588090412318707,
+	0.08389605488628149, 0.019413185305893421, 0.12643251568078995, 0.0059732170775532722,
+	0.0023994641378521919, 0.085251368582248688, 0.13698272220790386, -0.061294516548514366,
+	-0.19446159154176712, -0.11557490006089211, -0.12876491062343121, -0.11235301196575165,
+	-0.23348323814570904, -0.012381820008158684, 0.042877513915300369, 0.17178861424326897,
+	0.0091840457171201706, 0.0045528151094913483, -0.007726326584815979, -0.10891998186707497,
+	-0.025805700570344925, -0.00052565708756446838, 0.029550019651651382, -0.1621933039277792,
+	-0.0069455299526453018, 0.081936987116932869, 0.10407348070293665, 0.096586151048541069,
+	0.12220119871199131, 0.087051192298531532, 0.041015392169356346, -0.22160365059971809,
+	-0.19017172325402498, 0.090383981354534626, -0.063222209922969341, -0.10774356592446566,
+	-0.061048847623169422, -0.09650748036801815, 0.087342871353030205, 0.071035280823707581,
+	0.026201295666396618, -0.075496203266084194, 0.21981782093644142, 0.1700934823602438,
+	-0.087475446052849293, 0.061333396472036839, 0.098634707741439342, 0.13435306772589684,
+	0.033508186228573322, -0.23053096327930689, 0.017144821584224701, 0.24945575557649136,
+	-0.11023739445954561, 0.054445567540824413, 0.059841027483344078, -0.11481583770364523,
+	-0.042108944617211819, 0.12973131518810987, -0.083409757353365421, -0.016078630462288857,
+	-0.063389439135789871, -0.03959630336612463, -0.045660834759473801, -0.045812955126166344,
+	0.00083532556891441345, -0.018346190452575684, -0.047922424040734768, 0.091949598863720894,
+	-0.01971344742923975, -0.19669303018599749, -0.083564403466880322, 0.13986349571496248,
+	-0.021250788122415543, -0.085445977747440338, -0.13959594070911407, 0.1220561508089304,
+	0.012497481890022755, -0.0099638355895876884, 0.086543112993240356, 0.041862046346068382,
+	0.036134562455117702, 0.071576179936528206, 0.021398461423814297, 0.090656007640063763,
+	-0.086631615646183491, -0.26368153467774391, -0.16272827796638012, -0.096851659938693047,
+	0.0067315790802240372, -0.1217129323631525, 0.055964762344956398, 0.08199632354080677,
+	0.12238678522408009, 0.12251553125679493, -0.16938366834074259, -0.060353743843734264,
+	0.12051947321742773, 0.062046336941421032, 0.083293493837118149, -0.0026291105896234512,
+	-0.17869409546256065, -0.13722852617502213, -0.0090744737535715103, -0.12772588431835175,
+	0.010369522497057915, -0.061939431354403496, 0.083369538187980652, -0.23694593273103237,
+	0.15105613693594933, -0.03749445267021656, 0.17356133926659822, -0.0052616773173213005,
+	0.007603013888001442, -0.022688795812427998, -0.033722255378961563, -0.17614800669252872,
+	0.026095546782016754, -0.17472025007009506, 0.023103892803192139, -0.026930736377835274,
+	0.080417118035256863, -0.0055084135383367538, -0.062715409323573112, -0.075811559334397316
+};
+
+static const double ref_cmplx_mag[64] =
+{
+	0.44486942857115158, 0.42817243370710445, 0.40867483681983957, 0.36972361778581858,
+	0.59205330511492782, 0.53121047188456316, 0.59926485436963639, 0.41861164259110417,
+	0.51411428364641387, 0.31275667140135915, 0.5358262514504275, 0.30390129992417908,
+	0.041410902949476636, 0.37550811442366316, 0.21285977271269046, 0.47649838942655115,
+	0.32827578781101086, 0.59394448320104476, 0.45158097372083428, 0.52596485034241969,
+	0.24808044093846318, 0.6932141124985689, 0.24513418207109075, 0.45545460207085631,
+	0.27177856820612323, 0.52288892898871564, 0.48254772911450744, 0.49273908263268545,
+	0.40111872136110827, 0.3117452402857574, 0.41286970683750535, 0.43309550074962444,
+	0.48258481478674364, 0.38437964835884053, 0.39147209348428497, 0.29394270334955119,
+	0.45827771939011142, 0.49858636714480625, 0.19865724493980441, 0.35779701021349247,
+	0.44442070477311502, 0.45178849742364408, 0.14306862279327132, 0.25555417188631052,
+	0.39990325783239655, 0.36980653926554574, 0.43537816171349636, 0.2590789341085421,
+	0.37229456613927558, 0.48636254127549766, 0.25641182595861162, 0.48980379572889921,
+	0.53079986084277386, 0.30514838286433804, 0.15953789525291309, 0.65383700037718961,
+	0.42031207474612592, 0.32656781070214802, 0.09996906953285381, 0.37241432226295568,
+	0.42287745627747869, 0.36473771102239877, 0.18216418878219054, 0.35429012172281299
+};
+
+static const double ref_sin_cos_sin[128] =
+{
+	0.34967649354942504, -0.24335216435328474, -0.82922576308700757, -0.59338664695757848,
+	-0.97289562948234776, -0.96731768904188631, -0.96494294456999141, 0.93906437572924195,
+	0.17907974428056567, 0.77737116359505631, 0.7369461944835205, 0.67084826832016975,
+	-0.072990867309709967, -0.81890756569965906, -0.9270752726647401, 0.7133161515468025,
+	-0.30090898482792194, 0.99970815662710488, 0.99875752799118334, 0.89630662360447966,
+	0.66399439908394664, -0.71479279705800824, -0.78169483207105939, -0.99343316140182936,
+	-0.19772250101884192, -0.16680403825208373, 0.32875316637329499, 0.72159740887044377,
+	0.97249511549282119, -0.067826536598810869, 0.14673047445536175, -0.15071239075195578,
+	-0.88192126434835505, 0.062469015973224996, -0.013038467241987494, -0.8944280477979738,
+	0.32929638038167286, -0.4082192136701201, 0.14008869223951662, -0.98257495985315924,
+	-0.48704783791383638, -0.99525961214913339, 0.025883034947254271, -0.097826314247435972,
+	0.91067908406953157, -0.8574327342038327, -0.33110630575987648, 0.54065548176842415,
+	0.99202698192586336, -0.18775046973757678, -0.90916798309052227, 0.060746565934766246,
+	-0.30474660850928675, 0.88336333866573158, -0.83136306775984603, 0.79780646285027368,
+	-0.68046050058732388, -0.67056382101663015, -0.96117473465771408, -0.59923580154817457,
+	0.52148454715949455, -0.076623861392031492, -0.14274617902866946, -0.4115423199137655,
+	0.63809155342788082, 0.18831545175673217, 0.98093462430614164, 0.91529431701948705,
+	0.65520318870473182, -0.38834504669882625, 0.15866882773872831, -0.96398034841599411,
+	0.37096108903380187, 0.72807018049980121, 0.41973907392169846, 0.99999404372898582,
+	0.84051766516686244, -0.68116273633879543, -0.20035325516294045, -0.78491315077318025,
+	-0.96185958967742669, -0.86647246807174294, 0.46121938649209232, -0.83338218268057973,
+	0.74146598663056329, 0.32621673218302971, -0.97612045745897191, 0.76207215708857456,
+	-0.79572078469122509, -0.92240516985220988, 0.57847021623330663, -0.78419978392484657,
+	0.70357277167773569, -0.98210859411251361, 0.996061720045614, -0.62366111752569453,
+	-0.99932238458834954, -0.98100907986611263, -0.95405589372417066, 0.35272855575521095,
+	-0.66885506766454361, -0.99077315240106978, -0.76824479105679822, -0.87168907038322974,
+	0.27003759368675079, 0.99141145819333854, -0.99979344930983527, 0.87708517808471831,
+	0.83157612627448363, -0.20016539180984444, 0.2194754011167904, 0.24948469988636329,
+	-0.48486924800079112, -0.16982822813571985, 0.96594236695948554, -0.79745950914744246,
+	0.52719913478190128, -0.28936708892694701, -0.99621324426483204, -0.996758890430818,
+	0.86154913167329472, 0.6410396155663135, -0.1967825996724141, -0.75683298827329071,
+	0.87084206347007886, -0.42530037633823264, 0.99999468715275408, -0.99995218471350178
+};
+
+static const double ref_sin_cos_cos[128] =
+{
+	-0.93687050858642085, 0.96993800013432396, 0.55891379821289977, -0.80491756547639226,
+	-0.231244662931161, -0.25356752249975645, 0.26245973734002409, -0.34374132459779849,
+	-0.98383456189971652, -0.62904218778303589, -0.67595140833957679, -0.74159463380733104,
+	-0.99733260915773547, -0.57392542968565052, 0.3748752309950576, -0.70084239879052623,
+	-0.9536528628645905, 0.02415784703230002, -0.049833726340107132, 0.44343481649813843,
+	-0.74773754619194333, -0.69933629769517125, 0.62366111752569464, -0.11441395818328694,
+	0.98025803367830355, 0.98599006730433014, 0.94441588063709125, -0.69231292022571811,
+	0.23292327136334912, 0.9976971288587585, 0.98917650996478101, -0.98857765262716202,
+	-0.4713967368259977, 0.99804690372914684, -0.99991499557311347, -0.44721188189973837,
+	-0.9442266115014597, 0.9128839321570672, -0.99013895908939065, 0.18586674869261172,
+	0.873375293664446, 0.097253814448363354, -0.99966497813113331, -0.99520350292830151,
+	0.41311451903591956, 0.51459606130997504, -0.94359345816196039, 0.84124410846897058,
+	-0.12602566060554032, 0.98221675872147451, 0.41642956009763732, -0.99815322206920376,
+	-0.95243346465886403, 0.46868882203582796, -0.5557296551066333, -0.60291363215168303,
+	0.73278476180966579, -0.74185184635719337, -0.27594044548719721, 0.80057257893517486,
+	-0.85326072631632177, 0.99706007033948296, 0.9897593285100752, -0.91139065110412221,
+	0.76996049862573723, -0.9821085941125135, 0.1943380118179886, -0.40278569144376353,
+	-0.75545269971795825, 0.92151403934204201, 0.98733186067503043, -0.26597347211287542,
+	-0.92864841055313052, 0.68550259829338867, -0.90764481479450698, -0.0034514499201358517,
+	0.54178414017249166, 0.73213204179536129, 0.97972372286559117, -0.61960579866824905,
+	-0.27354365235839861, -0.49922486123355508, -0.88728613058238326, 0.55269714816574977,
+	0.67099045497679422, 0.94529500350093121, 0.21722995311440679, 0.6474921060448281,
+	-0.60566363008718049, 0.38622364328186298, 0.81570350552819826, -0.62050841967875336,
+	-0.71062321588427491, 0.18831545175673212, 0.088662561770867121, 0.78169483207105939,
+	0.036807222941358991, -0.1939618138197389, 0.29962868963130679, -0.93572568948108026,
+	0.74339282916870997, 0.13553066251312462, -0.64015618485967662, -0.4900593480124838,
+	-0.96284977955850892, -0.13077966417971168, -0.020323846022389451, 0.48033487317089307,
+	0.55541079050584174, 0.97976212211006175, -0.97561803401978175, -0.96837874022647319,
+	-0.87458665227817611, 0.98547367947007181, -0.25875730658805873, 0.60337246479295037,
+	0.84974176800085255, 0.95721820283880121, -0.086943498614549364, -0.080446966052949972,
+	0.50767420036179889, -0.76750779232174127, 0.98044714720690906, -0.653608313794524,
+	0.49156291610655006, 0.90505225809704359, 0.0032597034014760439, -0.0097789716583460123
+};
+
+static const double ref_pid[128] =
+{
+	0.070903320312500004, -0.023985595703125001, -0.018901062011718751, -0.053558654785156243,
+	-0.027502441406249988, -0.036547546386718741, -0.02598144531249999, 0.049960632324218768,
+	0.053819580078125026, 0.032167358398437526, 0.042980651855468774, 0.048542175292968781,
+	-0.0877838134765625, -0.026527404785156236, -0.011702880859374987, 0.068476562500000018,
+	-0.087901611328124976, 0.060433959960937519, 0.029904785156250016, 0.018926391601562516,
+	0.057955932617187518, -0.069807739257812501, 0.0012142944335937489, -0.031804199218750009,
+	0.0096362304687499928, -0.0017083740234375075, 0.010572509765624991, 0.058048706054687482,
+	0.020387268066406228, -0.0052731323242187766, 0.011266784667968724, -0.070108337402343776,
+	-0.026252136230468771, 0.017168579101562477, -0.08089538574218752, -0.032619628906250017,
+	0.078697509765624993, -0.037518920898437516, 0.074616699218749985, -0.059494934082031256,
+	-0.0045184326171874983, -0.03685760498046875, 0.085334472656250007, -0.10307128906249997,
+	0.047759094238281272, -0.039140624999999984, -0.068641662597656236, 0.026963500976562513,
+	0.029684448242187512, -0.024601745605468735, -0.034146728515624988, 0.079130554199218772,
+	-0.10013092041015625, 0.042106323242187521, -0.069906921386718723, 0.063946838378906273,
+	-0.04289916992187498, -0.062711486816406231, -0.039180908203124976, -0.015795593261718723,
+	0.055962829589843777, -0.03364135742187499, -0.014212951660156237, -0.079463195800781233,
+	0.023518066406250024, 0.055041503906250025, 0.0015982055664062675, 0.031872863769531273,
+	0.041427307128906271, -0.030188293457031251, 0.0058792114257812528, -0.049222106933593752,
+	0.080937500000000023, -0.00084106445312498446, 0.064146118164062516, 0.024511413574218772,
+	0.021374511718750024, -0.016954956054687477, 0.0097045898437500208, -0.046854248046874977,
+	-0.024244384765624977, -0.036553039550781229, 0.08317321777343753, -0.043315429687499962,
+	0.030499267578125044, 0.0045343017578125394, -0.033820190429687459, 0.033919372558593792,
+	-0.06098724365234371, -0.013284912109374963, 0.022123718261718786, -0.063901672363281217,
+	0.072441406250000048, -0.055719909667968706, 0.044778747558593804, -0.030536193847656198,
+	-0.036369628906249944, -0.037871093749999946, -0.026115722656249944, 0.070964965820312559,
+	-0.046296081542968701, -0.037381286621093697, -0.055229492187499944, -0.047576599121093695,
+	0.073734741210937566, 0.0092025756835938111, -0.062665710449218689, 0.028766174316406323,
+	0.0070578002929688258, -0.020817260742187427, 0.067776794433593829, 0.046795654296875079,
+	-0.089048461914062432, 0.013486022949218829, 0.044611511230468831, -0.038583679199218679,
+	0.019522094726562578, -0.012974853515624926, -0.04142822265624993, -0.03304412841796868,
+	0.03276702880859382, 0.048855895996093815, -0.025775756835937441, -0.058147888183593691,
+	0.039864501953125062, -0.023133239746093687, 0.039177551269531319, -0.05446350097656244
+};
+
+static const double ref_sin[128] =
+{
+	-0.34967649354942471, 0.24335216435328472, 0.82922576308700768, 0.59338664695757848,
+	0.97289562948234776, 0.96731768904188631, 0.96494294456999141, -0.93906437572924195,
+	-0.17907974428056578, -0.77737116359505642, -0.73694619448352028, -0.67084826832016986,
+	0.072990867309710036, 0.81890756569965895, 0.9270752726647401, -0.71331615154680261,
+	0.30090898482792189, -0.99970815662710488, -0.99875752799118334, -0.89630662360447955,
+	-0.66399439908394675, 0.71479279705800813, 0.78169483207105928, 0.99343316140182936,
+	0.1977225010188419, 0.16680403825208392, -0.32875316637329494, -0.72159740887044388,
+	-0.97249511549282119, 0.067826536598810799, -0.14673047445536158, 0.15071239075195561,
+	0.88192126434835494, -0.06246901597322501, 0.013038467241987334, 0.8944280477979738,
+	-0.32929638038167341, 0.40821921367012015, -0.14008869223951673, 0.98257495985315924,
+	0.48704783791383643, 0.99525961214913339, -0.025883034947254836, 0.097826314247435861,
+	-0.91067908406953169, 0.85743273420383281, 0.33110630575987643, -0.54065548176842404,
+	-0.99202698192586336, 0.18775046973757689, 0.90916798309052249, -0.060746565934766815,
+	0.30474660850928653, -0.88336333866573158, 0.83136306775984592, -0.79780646285027368,
+	0.68046050058732399, 0.67056382101663004, 0.96117473465771408, 0.59923580154817468,
+	-0.52148454715949466, 0.076623861392031686, 0.14274617902866946, 0.41154231991376522,
+	-0.63809155342788082, -0.18831545175673228, -0.98093462430614176, -0.91529431701948705,
+	-0.65520318870473226, 0.38834504669882658, -0.1586688277387284, 0.96398034841599411,
+	-0.37096108903380198, -0.72807018049980121, -0.41973907392169857, -0.99999404372898582,
+	-0.84051766516686244, 0.68116273633879565, 0.20035325516294047, 0.78491315077318002,
+	0.96185958967742657, 0.86647246807174305, -0.46121938649209282, 0.83338218268057973,
+	-0.74146598663056318, -0.3262167321830296, 0.97612045745897191, -0.76207215708857445,
+	0.79572078469122509, 0.92240516985220999, -0.57847021623330663, 0.78419978392484657,
+	-0.7035727716777358, 0.98210859411251361, -0.996061720045614, 0.62366111752569486,
+	0.99932238458834954, 0.98100907986611263, 0.95405589372417066, -0.35272855575521067,
+	0.66885506766454361, 0.99077315240106978, 0.76824479105679822, 0.87168907038322974,
+	-0.27003759368675051, -0.99141145819333854, 0.99979344930983527, -0.87708517808471809,
+	-0.83157612627448352, 0.20016539180984477, -0.21947540111679095, -0.24948469988636299,
+	0.48486924800079106, 0.16982822813571993, -0.96594236695948554, 0.79745950914744257,
+	-0.52719913478190106, 0.28936708892694724, 0.99621324426483204, 0.996758890430818,
+	-0.86154913167329472, -0.64103961556631317, 0.19678259967241429, 0.75683298827329082,
+	-0.87084206347007886, 0.42530037633823264, -0.99999468715275408, 0.99995218471350178
+};
+
+static const double ref_cos[128] =
+{
+	0.93687050858642096, -0.96993800013432396, -0.55891379821289955, 0.80491756547639226,
+	0.23124466293116111, 0.25356752249975661, -0.26245973734002398, 0.34374132459779855,
+	0.98383456189971652, 0.62904218778303578, 0.67595140833957701, 0.74159463380733104,
+	0.99733260915773547, 0.57392542968565075, -0.37487523099505748, 0.70084239879052623,
+	0.9536528628645905, -0.024157847032299701, 0.049833726340107451, -0.44343481649813854,
+	0.74773754619194321, 0.69933629769517125, -0.62366111752569464, 0.11441395818328705,
+	-0.98025803367830355, -0.98599006730433003, -0.94441588063709125, 0.69231292022571811,
+	-0.23292327136334923, -0.9976971288587585, -0.98917650996478101, 0.98857765262716202,
+	0.47139673682599781, -0.99804690372914684, 0.99991499557311347, 0.44721188189973826,
+	0.94422661150145959, -0.9128839321570672, 0.99013895908939065, -0.18586674869261161,
+	-0.873375293664446, -0.097253814448363243, 0.99966497813113331, 0.99520350292830151,
+	-0.41311451903591923, -0.51459606130997493, 0.94359345816196039, -0.84124410846897069,
+	0.12602566060553999, -0.98221675872147451, -0.41642956009763699, 0.99815322206920365,
+	0.95243346465886403, -0.4686888220358279, 0.55572965510663352, 0.60291363215168292,
+	-0.73278476180966567, 0.74185184635719348, 0.27594044548719732, -0.80057257893517475,
+	0.85326072631632166, -0.99706007033948296, -0.9897593285100752, 0.91139065110412243,
+	-0.76996049862573723, 0.9821085941125135, -0.19433801181798849, 0.40278569144376364,
+	0.75545269971795781, -0.92151403934204179, -0.98733186067503043, 0.26597347211287553,
+	0.92864841055313052, -0.68550259829338855, 0.90764481479450698, 0.0034514499201355074,
+	-0.54178414017249177, -0.73213204179536107, -0.97972372286559117, 0.61960579866824939,
+	0.27354365235839873, 0.49922486123355503, 0.88728613058238293, -0.55269714816574977,
+	-0.67099045497679444, -0.94529500350093121, -0.21722995311440665, -0.64749210604482821,
+	0.60566363008718049, -0.38622364328186287, -0.81570350552819837, 0.62050841967875336,
+	0.71062321588427479, -0.18831545175673201, -0.088662561770867232, -0.78169483207105916,
+	-0.036807222941358866, 0.19396181381973901, -0.29962868963130668, 0.93572568948108037,
+	-0.74339282916870997, -0.13553066251312451, 0.64015618485967662, 0.49005934801248391,
+	0.96284977955850903, 0.13077966417971157, 0.020323846022389572, -0.48033487317089357,
+	-0.55541079050584186, -0.97976212211006164, 0.97561803401978164, 0.9683787402264733,
+	0.87458665227817611, -0.98547367947007181, 0.25875730658805862, -0.60337246479295026,
+	-0.84974176800085266, -0.9572182028388011, 0.086943498614549489, 0.080446966052950097,
+	-0.50767420036179878, 0.76750779232174138, -0.98044714720690906, 0.65360831379452389,
+	-0.49156291610654995, -0.90505225809704359, -0.0032597034014761666, 0.0097789716583461337
+};
+
+static const double ref_sqrt[128] =
+{
+	0.6656919347214032, 0.19779670158081505, 0.39447323212022256, 0.63158155741905175,
+	0.53585435761793054, 0.53926060671360465, 0.45577752719597203, 0.55303450884076844,
+	0.68654496876797877, 0.59856191591806107, 0.60674009668215845, 0.61884173088975258,
+	0.69883674970222842, 0.58931319267644089, 0.43456043703666813, 0.61122515606464534,
+	0.67182957695292789, 0.49613988466585712, 0.50787259259828144, 0.42057090105296158,
+	0.62002413794998734, 0.61095048739392543, 0.37791833195149449, 0.51792809512397564,
+	0.17798102734210183, 0.1633167575028662, 0.23089869853330702, 0.60967540672270848,
+	0.4610698962399844, 0.10393855230976617, 0.15309310892394862, 0.68987073489123674,
+	0.57282196186947998, 0.099743322928153938, 0.7056378707860711, 0.56902680420719198,
+	0.66827706700234002, 0.25869876077810078, 0.69110825145875299, 0.46930305915061432,
+	0.28454021642928612, 0.48424897554099172, 0.7041875651792816, 0.69599246948377613,
+	0.426872883871036, 0.40493326273057023, 0.6680486977009984, 0.30151594524067049,
+	0.51972212189243494, 0.1733776642279074, 0.42619317803080797, 0.70023276682427182,
+	0.67135244940949235, 0.41516657048707573, 0.58632799487839993, 0.59413536014268242,
+	0.34512332204861929, 0.61889104295253372, 0.54267359333788301, 0.31978806152962463,
+	0.64240891104060427, 0.11048543456039805, 0.15098553195381006, 0.65764360955421741,
+	0.33187036543374132, 0.6854550552826203, 0.46783765379937087, 0.56212009740468272,
+	0.62152353447496256, 0.25194555463432966, 0.15924857117687116, 0.54115310189215404,
+	0.66295864136177451, 0.36026554063027594, 0.65655219976451606, 0.50054901498879212,
+	0.39859065683825307, 0.34534431414531785, 0.17917726470593304, 0.59695373335429025,
+	0.54230793871252247, 0.57722692068955861, 0.65092707324822496, 0.39597893429606834,
+	0.36460193404931357, 0.22997165671148478, 0.46384148777491863, 0.37136092355937911,
+	0.59459746264016722, 0.43230735413302884, 0.31332897859617931, 0.59710708020787606,
+	0.61301994831428608, 0.46888019025386429, 0.48566486523952401, 0.32738010687120256,
+	0.49410588440130926, 0.53015742429136081, 0.44896392228733145, 0.66530215175136775,
+	0.34147864650022408, 0.47787345302849266, 0.60047080324265145, 0.57577117952523027,
+	0.67563446744060507, 0.52045559218582715, 0.50322446609962235, 0.41262279185640605,
+	0.39532330765858598, 0.17909208416168204, 0.68174974502653829, 0.67813670064790399,
+	0.64763693050195958, 0.16480486804475772, 0.5400523068561276, 0.3832905178761275,
+	0.29728589985063197, 0.21615367706651442, 0.51366816182118002, 0.51265717864134119,
+	0.40651283564836549, 0.62390039989118051, 0.17755184652130487, 0.60280411638804776,
+	0.410137648387709, 0.26441590626203826, 0.49948093174001645, 0.5015539816254827
+};
+
+static const double ref_fir[128] =
+{
+	-0.00045980699360370636, -0.00086549576371908188, 0.00024145469069480896, 0.0027606235817074776,
+	0.002854824997484684, -0.0028330041095614433, -0.0080390414223074913, -0.0013557309284806252,
+	0.013896198943257332, 0.01384968776255846, -0.014627531170845032, -0.039496459066867828,
+	-0.005221937783062458, 0.094280146062374115, 0.17978717107325792, 0.14733729418367147,
+	-0.026181777007877827, -0.24889502208679914, -0.38839263934642076, -0.37029221747070551,
+	-0.20429619494825602, 0.056270384229719639, 0.33201806712895632, 0.5068112313747406,
+	0.46948780212551355, 0.21900235489010811, -0.090903273783624172, -0.26771715935319662,
+	-0.24936085566878319, -0.12904014531522989, -0.016510225832462311, 0.075303083285689354,
+	0.17707651946693659, 0.2513319430872798, 0.20843647886067629, 0.031587518751621246,
+	-0.17086157854646444, -0.26472072768956423, -0.21060670260339975, -0.062232107855379581,
+	0.10606393031775951, 0.22899526264518499, 0.24735773447901011, 0.14009031374007463,
+	-0.038856059312820435, -0.1984977601096034, -0.2927170442417264, -0.3343033455312252,
+	-0.32226595748215914, -0.2125849649310112, -0.0050940215587615967, 0.18583586532622576,
+	0.21647390816360712, 0.076401837170124054, -0.080256301909685135, -0.10289415251463652,
+	-0.012067967094480991, 0.041391279548406601, -0.032884136773645878, -0.16232314892113209,
+	-0.20919402036815882, -0.12256627902388573, 0.026281684637069702, 0.12605863343924284,
+	0.11645296029746532, 0.020650226622819901, -0.074128230102360249, -0.081214875914156437,
+	-0.0048003252595663071, 0.040119660086929798, -0.051642549224197865, -0.22336760256439447,
+	-0.28593820706009865, -0.13813636731356382, 0.085017653182148933, 0.15052271634340286,
+	0.0054327817633748055, -0.15775146707892418, -0.12398841697722673, 0.11169467773288488,
+	0.36048369016498327, 0.44001137837767601, 0.32025215402245522, 0.10728973802179098,
+	-0.055540105327963829, -0.073074346408247948, 0.053599630482494831, 0.23108067270368338,
+	0.34291890729218721, 0.3339782701805234, 0.22499729692935944, 0.062235140241682529,
+	-0.11785371880978346, -0.26529514044523239, -0.30890833213925362, -0.2160635432228446,
+	-0.046480265446007252, 0.084708441980183125, 0.10793420020490885, 0.045912327244877815,
+	-0.035299269482493401, -0.095915011130273342, -0.1361169246956706, -0.16122111119329929,
+	-0.15752833988517523, -0.10255161114037037, 0.0021845875307917595, 0.10007865075021982,
+	0.099376021884381771, -0.037760219536721706, -0.21513125207275152, -0.25975771527737379,
+	-0.11144866701215506, 0.072505846619606018, 0.072185478173196316, -0.13080283254384995,
+	-0.30793810822069645, -0.24258681572973728, 0.012895114719867706, 0.20056546200066805,
+	0.16431970521807671, 0.022856311872601509, 0.0017862645909190178, 0.15247187484055758,
+	0.30104972328990698, 0.26888160407543182, 0.084713303484022617, -0.058312036097049713
+};
+
+static const double ref_biquad[128] =
+{
+	0.023927840684905277, 0.062589359258797245, 0.04506928604373317, -0.040139434248419911,
+	-0.13135734908286581, -0.17049052582427443, -0.14399896773188392, -0.049387679361561687,
+	0.1074962741736194, 0.2482570544032498, 0.29403242619340408, 0.25006708408838801,
+	0.11443319333602303, -0.10183583979586497, -0.27114553791088958, -0.27435957020147655,
+	-0.1731727938981856, -0.081853939036002799, 0.016540975528834573, 0.11430198769948299,
+	0.16375577960245058, 0.1368560728308976, 0.023024093674750848, -0.095516861887313967,
+	-0.14400439374664306, -0.11542074126646358, -0.042435228909105255, 0.048260908737947458,
+	0.13409733701972906, 0.1555607472569899, 0.098917157098888278, -0.0065952830719470668,
+	-0.12859627152106401, -0.18259105526519964, -0.15418228641076398, -0.11828978325439544,
+	-0.039523442051241531, 0.096734209461499077, 0.2023141761623248, 0.22722105921710328,
+	0.15203612711204406, 0.026740722700438119, -0.038501651766385307, -0.043469361316703009,
+	-0.059758827014143853, -0.067523584918642798, -0.079650443500558943, -0.0980640552085906,
+	-0.043658774689044333, 0.048158920262719951, 0.077079595961409356, 0.072186089889667002,
+	0.06416868279840697, 0.016776990452370695, -0.037442719236415595, -0.052666711922961289,
+	-0.02365661064637482, -0.019990626383056188, -0.071142106953014358, -0.099370419363473392,
+	-0.040389584785448483, 0.069840048411463754, 0.12375092988209466, 0.079509623398594464,
+	0.0013267294577862798, 0.0012927584862722913, 0.075181091056353899, 0.12337076701563865,
+	0.1248030086534771, 0.078330214522982028, -0.020930107994789476, -0.1315776671973769,
+	-0.17967721632322331, -0.12674480747369143, -0.031243737084764314, 0.046308476279085645,
+	0.07264650232861572, 0.029026158961272152, -0.051269182894684025, -0.12604924707819154,
+	-0.1784044118751201, -0.18888545111162891, -0.11151682675562921, 0.030490797527821162,
+	0.13157270726219186, 0.16742808435888659, 0.14770270140173408, 0.090594691791592477,
+	0.032842653396716395, -0.031338688269846107, -0.060412338157874404, -0.044773155389767977,
+	-0.010856144854404212, 0.039352034021615988, 0.068999569636127675, 0.070483163941545593,
+	0.033456224001206937, -0.040441317412632904, -0.097280943933761077, -0.072372977698855423,
+	0.018149822783662221, 0.055903229403990395, 0.0079525783976226068, -0.062351068121754456,
+	-0.061684726256990723, 0.044429966608477339, 0.12479846400642446, 0.10493051277492323,
+	0.067470632047230486, 0.039255422914016139, 0.020681071999188907, 0.047144606469108667,
+	0.040588058703512009, -0.058829573373721564, -0.1286800826222072, -0.11771577454416007,
+	-0.094212595405123334, -0.070427895994213618, -0.059148574534892022, -0.075722959842112622,
+	-0.066749573053698025, 0.018487573218815855, 0.11701400329786589, 0.11619162656610262,
+	0.04659997696622474, 0.0089777906762003867, 0.01467842093292995, 0.021983411843213223
+};
+
+static const double ref_conv[93] =
+{
+	-0.00045980699360370636, -0.00086549576371908188, 0.00024145469069480896, 0.0027606235817074776,
+	0.002854824997484684, -0.0028330041095614433, -0.0080390414223074913, -0.0013557309284806252,
+	0.013896198943257332, 0.01384968776255846, -0.014627531170845032, -0.039496459066867828,
+	-0.005221937783062458, 0.094280146062374115, 0.17978717107325792, 0.14733729418367147,
+	-0.026181777007877827, -0.24889502208679914, -0.38839263934642076, -0.37029221747070551,
+	-0.20429619494825602, 0.056270384229719639, 0.33201806712895632, 0.5068112313747406,
+	0.46948780212551355, 0.21900235489010811, -0.090903273783624172, -0.26771715935319662,
+	-0.24936085566878319, -0.12904014531522989, -0.016510225832462311, 0.075303083285689354,
+	0.17707651946693659, 0.2513319430872798, 0.20843647886067629, 0.031587518751621246,
+	-0.17086157854646444, -0.26472072768956423, -0.21060670260339975, -0.062232107855379581,
+	0.10606393031775951, 0.22899526264518499, 0.24735773447901011, 0.14009031374007463,
+	-0.038856059312820435, -0.1984977601096034, -0.2927170442417264, -0.3343033455312252,
+	-0.32226595748215914, -0.2125849649310112, -0.0050940215587615967, 0.18583586532622576,
+	0.21647390816360712, 0.076401837170124054, -0.080256301909685135, -0.10289415251463652,
+	-0.012067967094480991, 0.041391279548406601, -0.032884136773645878, -0.16232314892113209,
+	-0.20919402036815882, -0.12256627902388573, 0.026281684637069702, 0.12605863343924284,
+	0.11656723916530609, 0.021362937055528164, -0.07294043991714716, -0.080943665467202663,
+	-0.0063815135508775711, 0.038511474616825581, -0.049489590339362621, -0.21835726127028465,
+	-0.28533925861120224, -0.14590975176542997, 0.078307109884917736, 0.15974539518356323,
+	0.02625767607241869, -0.16382063552737236, -0.21627822425216436, -0.11112760845571756,
+	0.016036117449402809, 0.053128963336348534, 0.015213322825729847, -0.020018956623971462,
+	-0.016783763654530048, 0.002644742839038372, 0.0094228796660900116, 0.0031317239627242088,
+	-0.0027162777259945869, -0.0023830514401197433, 5.9277750551700592e-05, 0.00090796686708927155,
+	0.00044875591993331909
+};
+
+static const double ref_mat_mult[64] =
+{
+	-0.0047411322593688965, 0.032316522672772408, 0.15450539812445641, 0.046354309655725956,
+	-0.0078598540276288986, -0.052690887823700905, 0.043881867080926895, 0.0063968868926167488,
+	-0.026526201516389847, 0.042901673354208469, 0.05165052879601717, 0.055079016834497452,
+	-0.05146507266908884, -0.072725626640021801, -0.014756032265722752, 0.038780852220952511,
+	-0.02447408065199852, 0.037686169147491455, -0.16092988848686218, -0.11020845733582973,
+	-0.032195492647588253, 0.0082476455718278885, -0.11247597169131041, 0.021013273857533932,
+	-0.02397947758436203, -0.051191048696637154, -0.11613573879003525, -0.067891196347773075,
+	0.029827973805367947, 0.023447467945516109, -0.058592888526618481, -0.027829617261886597,
+	-0.01534247025847435, 0.04046011995524168, -0.12576045747846365, -0.092840807512402534,
+	-0.081373561173677444, 0.034723088145256042, -0.014284200966358185, -0.057849123142659664,
+	0.078650870360434055, 0.01682664267718792, 0.12192476261407137, 0.030068471096456051,
+	0.11987313069403172, 0.031465616077184677, -0.025759869255125523, 0.065995078533887863,
+	-0.022751218639314175, -0.088198314420878887, 0.090492291375994682, 0.075219239108264446,
+	-0.021441000513732433, -0.088072444312274456, 0.056470431387424469, 0.025391027331352234,
+	0.0094245607033371925, -0.070173685438930988, -0.046166993677616119, -0.064963310956954956,
+	0.054204218089580536, 0.024332495406270027, -0.02507867943495512, -0.043584640137851238
+};
+
+static const double ref_mat_inverse[64] =
+{
+	0.22599410973252201, 0.001280343559319439, 0.007003312718190869, 0.021444571077219643,
+	0.015279193875328615, 0.017614441282246891, 0.013090960053828742, -0.016922381028011885,
+	-0.025238546293671574, 0.22893209242791687, -0.020502807891342064, -0.019015418304057431,
+	0.02865373758222477, 0.016830170721756188, 0.0078645590179016282, -0.025326976073338895,
+	0.023096123792314478, -0.010555902342633382, 0.23325356884523377, -0.0068304225832159235,
+	-0.020024530161018017, 0.022472515640450167, 0.01535879290844773, 0.012424436423946205,
+	0.0007089148007898531, 0.0041649871668843815, -0.0027429170494462189, 0.22828317199153991,
+	-0.012817905055287449, 0.00064731224850021296, 0.00061844667218885247, 0.028881818414742664,
+	0.021002270083022408, 0.00035578748756493633, 0.02516157153746082, 0.021325164667593228,
+	0.21842752924860692, 0.0091371775804763491, -0.025244884128983219, 0.018649061222459209,
+	-0.002344867523363331, 0.015066037656329767, -0.031454015972836452, 0.02428390576711659,
+	-0.0033784651525530099, 0.25739299087118456, 0.031055594305931661, -0.01034292235056147,
+	-0.013560593004810309, -0.0022659652138154111, 0.01447550155431449, -0.031410209119726147,
+	0.029187923586100423, -0.011529089511808347, 0.26800272985858903, -0.02612447833546366,
+	0.0042383043244721315, 0.023866028333773277, 0.014282979241997704, 0.0020698794823809066,
+	-0.02352664881929253, 0.0040187893104432094, 0.0073061908356867504, 0.27651760860549135
+};
+
+static const double ref_stats[5] =
+{
+	-0.0033249855041503906, 0.085790166966607947, 0.29289958512535991, 0.29177214880071078,
+	10.896766312420368
+};
+
+static const double ref_cfft[128] =
+{
+	2.07135009765625, -2.4969482421875, -0.43354945493746372, 1.147278794907644,
+	0.79720132538717614, 0.8697079939811857, 2.3695877266325533, 0.35685122658124224,
+	2.0762780937273817, -4.3984219458657519, -0.67780657740711558, 2.106830134472482,
+	4.789016331570406, -2.0777674278979439, -1.8063778682481169, -3.0334946115693313,
+	-0.84376644013155766, 2.0153269603594572, -2.8661352478762159, 0.34759262419416004,
+	-1.523925593058904, 1.0246443750857068, 4.2030772335471749, -2.3687906180094309,
+	-0.14115094720866223, 5.7396727256218991, -1.525000688967604, -0.30021246928784284,
+	2.9736712312622453, 0.45068169909610201, -0.19418885571992223, 2.6836439010215458,
+	-0.18255615234375011, 0.38201904296874994, 0.360586324221286, 2.2876465702592217,
+	1.4753150288012282, -0.42743232761187711, -2.2135718922829177, -3.0118375120323626,
+	2.4422892229288169, 0.54706387350321495, 4.7528622798868287, 0.85346982008121675,
+	-2.4075943996992786, -0.49461346008726725, -5.1191032882774703, 3.032167882262748,
+	-1.9580745086452529, 0.24683021517799192, -0.65763919215093392, -2.6758862457826975,
+	2.4199198836069118, 1.2808334069743341, 2.8516922017269843, -1.5961095895536639,
+	3.3588914898027831, 2.5663184142581503, 3.0207143578284112, 1.3097529364120519,
+	1.8469394055030988, -0.71712363686486302, -0.68393445649159679, 0.46487437252623148,
+	1.5206298828125, -0.47747802734375006, -0.80335081794109486, -0.34783102961571416,
+	-0.018335022152827896, 2.6083645399124977, -4.51861839446806, 0.30416795792050771,
+	2.0294438563327026, 2.8599583397886081, 2.2063778474652582, -0.46127366250844259,
+	-0.67511850576569077, 1.511515472203568, -1.9387678911061941, 0.1760922006038608,
+	-2.6161944973684426, -1.4306101634844572, 0.8993849291545134, -5.1635897293766693,
+	-0.49211798716757005, 1.5992343826495781, 3.1286064396155799, 0.5202461720222038,
+	-2.7373108099248711, -0.47928935488472491, 2.6299017140571737, 1.7499456275520393,
+	0.51833729750183855, 0.337405219023998, 2.2971173080432803, 1.324205860146304,
+	-3.2752685546875, 3.9222412109375, 2.9836800810227282, 1.2546575432096467,
+	5.5189297443661385, 3.7464005289409812, 4.3832644681640112, -3.4979236398684068,
+	-0.11771332142640056, -4.2949772205510728, -1.8103134280601727, -2.8092352311292021,
+	0.8368219306560768, -0.70959153123375818, 0.41486324769295629, -2.9281675700925027,
+	-2.0261784210422475, -2.0385782620529911, 3.979850777303171, 0.032830154040927595,
+	0.58888176084284916, -0.31796383743240175, -1.81699213982082, -1.755004083904304,
+	0.095620072018248112, -0.10941662874532362, -2.0751879035987746, -6.131780524928816,
+	1.3608466308463041, 2.5451967907601656, -0.68477883900744407, -0.15822663555464089
+};
+
+static const double ref_rfft[130] =
+{
+	-0.42559814453125, 0, -0.071397366416118407, 0.50302408696999956,
+	2.80587797102458, -0.72463839951182496, -3.0351043113352572, 1.4696611109570161,
+	-1.3178653829629281, -2.6760849356038654, -1.2151579826936414, 1.3356509312928875,
+	0.93304575137746248, -2.5418188497765897, 0.64876840877859576, 1.696278942288268,
+	-1.6719578691186081, 1.4851984410959869, -1.6906382515301399, 3.672542833566363,
+	0.35179840956646424, 1.8338572323609368, -2.5700388748391929, -1.0276876509518551,
+	0.47768869503934297, 4.6257539007004365, 1.6635608477968502, 5.1029106406826665,
+	6.67584215934873, -1.9954040856271937, 3.9208532270963334, 0.56941516048076701,
+	-1.3005655027297061, -4.3853358467272958, 3.2590751436185101, -0.20613534464386665,
+	0.59839297164622895, -0.65117294822095972, 1.7774680914923819, -0.43148410771562429,
+	-2.282024056546748, -0.95381541076631593, 3.5972645883121062, -0.84004312256915714,
+	-0.34484915448591869, -1.0825435965270147, 0.1548151416215065, 6.3478877163364889,
+	-2.8176527836572478, 1.2596294138536976, -2.3224007279425702, -0.4649557292680857,
+	-0.20319480220752723, -1.9006177795501942, 1.9660958023536499, 0.35204576468068893,
+	2.5715233777283664, -2.9375073301054968, -4.3594117587303005, -0.84855876547244291,
+	0.078842893442947676, -2.6952255516383947, -0.80040737450643862, 0.34497177996544259,
+	1.5206298828125, 0.47747802734375, -0.68687789992625192, -0.46773362217650288,
+	1.7497614899073239, 0.63026262513896603, 2.8615077220906535, -1.8541437439639865,
+	2.8168119684071198, -2.6438674045750394, 3.0919742468385931, 1.4868816917259096,
+	1.9479961800487486, -1.6699357143209579, -0.27400635531455853, 2.3870227171184744,
+	-1.7566162223564457, -0.41781096480874991, -4.3745335007444659, -1.8478698953029293,
+	-2.5548632323809315, 1.0113042462098298, 4.2842041311903083, -1.1732667706281681,
+	1.9870024695506934, -1.9801686391542543, -1.3611382697181278, 4.3302990318687762,
+	1.3952593546568393, 0.11366459841491741, -0.60137151135394185, -1.1695760547567853,
+	-2.1572592043015435, -0.84511367875854737, -1.1313620017935275, -0.85957119733113341,
+	1.8167588162796482, 1.300314744217685, 1.1947029313995599, 1.9051994701021,
+	-0.73655296367440382, -5.4088960454725381, 4.9628026803261962, -1.4681322640716243,
+	-1.0389020719692914, 0.09962132604146888, -0.76063374865312139, 0.39678263927970248,
+	-1.1979869920551973, -2.5687067813164615, 1.5247045002764565, 4.7626037078985251,
+	4.4448523410357934, -0.78201525931104754, -1.2796407345342928, -2.5261832870838967,
+	3.4897635487085577, 1.6129203815165656, 3.3295041343690337, -5.0189706405530412,
+	-0.64783001479110136, 0.95085039726715626, -1.0469309275287895, -0.80248134349228462,
+	4.56829833984375, 3.0578796724315321e-16
+};
+
+static const double ref_dct4[128] =
+{
+	-0.0439969215855915, -0.012040961094239249, 0.012697812312160675, 0.24238235992241589,
+	0.22209912845764926, -0.44348632986302738, 0.026147785961182984, 0.14494664642770028,
+	-0.35377303024128393, -0.15944643018632118, -0.030012957531974683, 0.29471924850974607,
+	-0.30238122878033885, -0.15901093749717027, 0.075086858008500179, -0.28927133032076358,
+	-0.081373648244991437, -0.2714765386066989, 0.16701505804779662, 0.12150213012302549,
+	0.23382572262061205, -0.02234481268828805, -0.39645521905976694, 0.06930473167922685,
+	0.29903867282613916, 0.2955713331598509, 0.69507156939978165, 1.0240755762846199,
+	0.31408158844715672, 0.27447430413501356, 0.5606733958923783, -0.017326700364302408,
+	-0.36889585121069013, 0.30764615229123177, 0.15716590537302425, -0.031642658497720924,
+	0.035417366420840951, 0.090776775730332604, 0.11855638906133877, -0.27919927825762469,
+	-0.14039173634136376, 0.38556681624586175, 0.013494975340646049, -0.21913616267679364,
+	-0.28491684932007161, -0.27413143011246155, 0.75475612378256951, -0.35194400350906802,
+	0.34548195241204144, -0.10239532527715553, 0.14814276710071517, 0.19661290728325934,
+	-0.078552027758678256, 0.30980078849594284, 0.24891308873760087, 0.22459604678231287,
+	-0.14948072473198259, -0.54892460364008355, -0.028836846153320571, 0.18469471266129839,
+	-0.30690431110511623, 0.031186050644228532, 0.0018539483429363089, 0.28922212611411546,
+	0.096566707150211456, 0.013131731903626589, 0.0057458292819168172, 0.34680182006528698,
+	0.1902816705834996, 0.3530737510173787, -0.10147439892799029, 0.24473249691759522,
+	-0.37058505152698196, 0.23276291756105827, 0.10695717345917449, -0.04205482120163552,
+	-0.29256241990720511, -0.22151349924106029, 0.25391737163998984, -0.38194334276293807,
+	0.068874555028460127, -0.50640880588701698, -0.083039302835329315, 0.015401157799514476,
+	0.28621919541249607, 0.60832411458231628, -0.15902743338836509, 0.085228797249349592,
+	-0.42689367928439476, -0.042051015244194606, 0.5126609500554028, 0.093166309022195928,
+	0.10543607213083167, -0.20564837130292779, -0.018497364167426946, -0.23280684254944922,
+	0.074517497743558259, 0.0095602803490464454, 0.031359571522948416, 0.38123761616778129,
+	0.13470426657542045, 0.16540510896926169, 0.39544201524653744, -0.34174672162064906,
+	-0.29584849374075894, 0.50396536079683685, -0.47886432236033943, -0.16585680534279687,
+	-0.015353731528875911, -0.014640897723110093, 0.12314488036330937, -0.1169109274878422,
+	-0.18204494558120249, 0.62982834172380309, 0.49573889679512556, 0.24902233892676906,
+	-0.20007767788417211, -0.33708048899067966, -0.050849106429611865, 0.46440237273180107,
+	0.06592420143085212, -0.18353981127675847, -0.73726106445657325, 0.027180646079771709,
+	0.0071854043520105937, -0.068158011978861649, 0.061180824514954157, 0.44055037498702126
+};
+
+static const double ref_interp[128] =
+{
+	0.36027735471725464, 0.59722518920898438, 0.83162176609039307, 0.73706775903701782,
+	0.88871431350708008, 0.88648271560668945, 0.8855900764465332, 0.12482333183288574,
+	0.42841100692749023, 0.18915224075317383, 0.20557594299316406, 0.23198872804641724,
+	0.52918154001235962, 0.82728433609008789, 0.87067556381225586, 0.21479415893554688,
+	0.62030589580535889, 0.10047924518585205, 0.1009824275970459, 0.14185023307800293,
+	0.23471528291702271, 0.78577232360839844, 0.81249141693115234, 0.8971024751663208,
+	0.57907485961914062, 0.56666088104248047, 0.36865037679672241, 0.21160125732421875,
+	0.11145305633544922, 0.52711355686187744, 0.441375732421875, 0.56021642684936523,
+	0.852783203125, 0.47503101825714111, 0.50520825386047363, 0.8574298620223999,
+	0.36843383312225342, 0.663127601146698, 0.44402933120727539, 0.89285546541213989,
+	0.69468230009078979, 0.8980863094329834, 0.48966008424758911, 0.53913849592208862,
+	0.13612371683120728, 0.84256350994110107, 0.63228797912597656, 0.28388518095016479,
+	0.10358470678329468, 0.57507658004760742, 0.86325454711914062, 0.47572034597396851,
+	0.62182170152664185, 0.14669322967529297, 0.83253490924835205, 0.18125355243682861,
+	0.77187389135360718, 0.76789766550064087, 0.88423252105712891, 0.73940747976303101,
+	0.29164296388626099, 0.53063678741455078, 0.55703210830688477, 0.6644446849822998,
+	0.24482625722885132, 0.42469596862792969, 0.1076514720916748, 0.1341930627822876,
+	0.23818027973175049, 0.65529441833496094, 0.4365992546081543, 0.88523674011230469,
+	0.35168778896331787, 0.20907783508300781, 0.33229726552963257, 0.10007369518280029,
+	0.16402602195739746, 0.77215790748596191, 0.58011627197265625, 0.81372416019439697,
+	0.88447427749633789, 0.84623312950134277, 0.31559109687805176, 0.83329081535339355,
+	0.20377349853515625, 0.36966091394424438, 0.89010906219482422, 0.19537925720214844,
+	0.8179246187210083, 0.86888289451599121, 0.26884311437606812, 0.81345021724700928,
+	0.21863996982574463, 0.89270901679992676, 0.10174471139907837, 0.74932050704956055,
+	0.89927291870117188, 0.89237105846405029, 0.8814626932144165, 0.35905027389526367,
+	0.7672160267829895, 0.89585202932357788, 0.80719566345214844, 0.84840333461761475,
+	0.39206314086914062, 0.1038663387298584, 0.89959585666656494, 0.14930808544158936,
+	0.16737997531890869, 0.58004188537597656, 0.41229629516601562, 0.40032005310058594,
+	0.69382762908935547, 0.56787395477294922, 0.11403799057006836, 0.81860947608947754,
+	0.28934192657470703, 0.61574745178222656, 0.89828908443450928, 0.89841675758361816,
+	0.15577924251556396, 0.24369019269943237, 0.57870292663574219, 0.80245780944824219,
+	0.15195178985595703, 0.66992098093032837, 0.10006994009017944, 0.89980238676071167
+};
+
+#endif /*_ref_dsp_H_*/
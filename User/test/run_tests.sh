@@ -0,0 +1,39 @@
+#!/bin/sh
+# Builds and runs the host unit tests (see test.h), from the repository root:
+#   sh User/test/run_tests.sh [filter]
+# Objects, the DSP library and the test programs go to _test_build/, or to
+# $TEST_OUT. The DSP library is rebuilt when a source or header is newer.
+
+OUT=${TEST_OUT:-_test_build}
+CC=${CC:-gcc}
+CFLAGS="-std=gnu99 -O2 -fno-strict-aliasing -Wall -DHOST_BUILD -DARM_MATH_HOST -IUser -IUser/test -IDrivers/CMSIS/Include"
+export CC CFLAGS OUT
+
+mkdir -p "$OUT/dsp" || exit 1
+
+if [ ! -f "$OUT/libdsp.a" ] || [ -n "$(find Drivers/CMSIS/DSP_Lib/Source Drivers/CMSIS/Include -name '*.[ch]' -newer "$OUT/libdsp.a")" ]; then
+	echo "building the DSP library"
+	rm -f "$OUT"/dsp/*.o "$OUT/libdsp.a"
+	ls Drivers/CMSIS/DSP_Lib/Source/*/*.c | xargs -P "$(nproc 2>/dev/null || echo 4)" -I{} \
+		sh -c '$CC $CFLAGS -c "{}" -o "$OUT/dsp/$(basename "{}" .c).o"' || exit 1
+	ar rcs "$OUT/libdsp.a" "$OUT"/dsp/*.o || exit 1
+fi
+
+failed=0
+for t in User/test/test_*.c; do
+	name=$(basename "$t" .c)
+	case "$name" in
+	*"$1"*) ;;
+	*) continue ;;
+	esac
+	srcs=$(sed -n 's/^ \* sources:\(.*\)$/\1/p' "$t" | tr -d '\r')
+	if ! $CC $CFLAGS -o "$OUT/$name" "$t" $srcs "$OUT/libdsp.a" -lm -lpthread; then
+		echo "$name: build failed"
+		failed=$((failed + 1))
+		continue
+	fi
+	"$OUT/$name" || failed=$((failed + 1))
+done
+
+echo "$failed test programs failed"
+[ "$failed" -eq 0 ]
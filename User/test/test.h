@@ -0,0 +1,83 @@
+#ifndef _test_H_
+#define _test_H_
+
+/*
+ * Host unit tests.
+ *
+ * Every test_*.c builds into one program that runs all of its cases, prints
+ * the failed checks and returns non-zero when one failed. run_tests.sh
+ * builds the DSP library once and then builds and runs every test with
+ * HOST_BUILD and ARM_MATH_HOST, from the repository root:
+ *   sh User/test/run_tests.sh [filter]    only tests whose name contains filter
+ * Sources a test needs besides the DSP library are listed on the
+ * "sources:" line of its header comment.
+ *
+ * Reference data (golden vectors) lives next to the tests in ref_*.h.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+
+static int s_test_checks;
+static int s_test_fails;
+
+#define CHECK(cond, ...)                                            \
+	do                                                              \
+	{                                                               \
+		s_test_checks++;                                            \
+		if(!(cond))                                                 \
+		{                                                           \
+			s_test_fails++;                                         \
+			printf("FAIL %s:%d: ", __FILE__, __LINE__);             \
+			printf(__VA_ARGS__);                                    \
+			printf("\n");                                           \
+		}                                                           \
+	} while(0)
+
+//prints the summary, the return value is the exit code of the test
+static __inline int test_done(const char *name)
+{
+	printf("%s: %d checks, %d failed\n", name, s_test_checks, s_test_fails);
+	return s_test_fails != 0;
+}
+
+//deterministic LCG, the same sequence on every host
+static uint32_t s_test_seed = 12345u;
+
+static __inline void test_srand(uint32_t seed)
+{
+	s_test_seed = seed;
+}
+
+static __inline uint32_t test_rand(void)
+{
+	s_test_seed = s_test_seed * 1664525u + 1013904223u;
+	return s_test_seed;
+}
+
+//uniform in [-1, 1)
+static __inline double test_uniform(void)
+{
+	return (double)(int32_t)test_rand() / 2147483648.0;
+}
+
+//signal to noise ratio of got against ref in dB, 300 when they are equal
+static __inline double test_snr(const double *ref, const double *got, uint32_t n)
+{
+	double sig = 0, err = 0;
+	uint32_t i;
+
+	for(i = 0; i < n; i++)
+	{
+		sig += ref[i] * ref[i];
+		err += (ref[i] - got[i]) * (ref[i] - got[i]);
+	}
+	if(err == 0)
+		return 300.0;
+	return 10.0 * log10(sig / err);
+}
+
+#define TEST_PI     3.14159265358979323846
+
+#endif /*_test_H_*/
@@ -0,0 +1,134 @@
+/*
+ * Multichannel interleaved and planar biquad cascades against the single
+ * channel filters run on each deinterleaved channel: bit exact in f32 and q31.
+ * sources:
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_STAGES     4
+#define TEST_BLOCK      96
+#define TEST_CALLS      4
+#define TEST_MAX_CH     16
+
+static float32_t s_cf[5 * TEST_STAGES];
+static q31_t s_cq[5 * TEST_STAGES];
+
+//resonant sections with poles of radius 0.9 down to 0.75, q31 coefficients in 2.30 (postShift 1)
+static void test_coeffs(void)
+{
+	double r, w, b[5];
+	uint32_t s, k;
+
+	for(s = 0; s < TEST_STAGES; s++)
+	{
+		r = 0.9 - 0.05 * s;
+		w = 0.1 + 0.2 * s;
+		b[0] = 0.2;
+		b[1] = 0.1;
+		b[2] = 0.05;
+		b[3] = 2.0 * r * cos(w);
+		b[4] = -r * r;
+		for(k = 0; k < 5; k++)
+		{
+			s_cf[5 * s + k] = (float32_t)b[k];
+			s_cq[5 * s + k] = (q31_t)(b[k] / 2.0 * 2147483648.0);
+		}
+	}
+}
+
+static void test_channels(uint16_t numCh)
+{
+	uint32_t n = TEST_BLOCK * numCh, i, c, k, bad = 0, bad_q = 0;
+	float32_t *x = malloc(4u * n), *yi = malloc(4u * n), *yp = malloc(4u * n), *yr = malloc(4u * n);
+	q31_t *xq = malloc(4u * n), *yqi = malloc(4u * n), *yqp = malloc(4u * n), *yqr = malloc(4u * n);
+	float32_t sm[2 * TEST_STAGES * TEST_MAX_CH], sp[2 * TEST_STAGES * TEST_MAX_CH];
+	float32_t sr[TEST_MAX_CH][2 * TEST_STAGES], t[TEST_BLOCK];
+	q31_t smq[4 * TEST_STAGES * TEST_MAX_CH], spq[4 * TEST_STAGES * TEST_MAX_CH];
+	q31_t srq[TEST_MAX_CH][4 * TEST_STAGES], tq[TEST_BLOCK];
+	arm_biquad_cascade_mc_df2T_instance_f32 M, P;
+	arm_biquad_casd_mc_df1_inst_q31 MQ, PQ;
+	arm_biquad_cascade_df2T_instance_f32 R[TEST_MAX_CH];
+	arm_biquad_casd_df1_inst_q31 RQ[TEST_MAX_CH];
+
+	arm_biquad_cascade_mc_df2T_init_f32(&M, TEST_STAGES, numCh, s_cf, sm);
+	arm_biquad_cascade_mc_df2T_init_f32(&P, TEST_STAGES, numCh, s_cf, sp);
+	arm_biquad_cascade_mc_df1_init_q31(&MQ, TEST_STAGES, numCh, s_cq, smq, 1);
+	arm_biquad_cascade_mc_df1_init_q31(&PQ, TEST_STAGES, numCh, s_cq, spq, 1);
+	for(c = 0; c < numCh; c++)
+	{
+		arm_biquad_cascade_df2T_init_f32(&R[c], TEST_STAGES, s_cf, sr[c]);
+		arm_biquad_cascade_df1_init_q31(&RQ[c], TEST_STAGES, s_cq, srq[c], 1);
+	}
+
+	//consecutive calls, so the state carried between blocks is checked as well
+	for(k = 0; k < TEST_CALLS; k++)
+	{
+		for(i = 0; i < n; i++)
+		{
+			x[i] = (float32_t)(test_uniform() * 0.5);
+			xq[i] = (q31_t)(x[i] * 0.25 * 2147483648.0);
+		}
+
+		for(c = 0; c < numCh; c++)
+		{
+			for(i = 0; i < TEST_BLOCK; i++)
+			{
+				t[i] = x[i * numCh + c];
+				tq[i] = xq[i * numCh + c];
+			}
+			arm_biquad_cascade_df2T_f32(&R[c], t, t, TEST_BLOCK);
+			arm_biquad_cascade_df1_q31(&RQ[c], tq, tq, TEST_BLOCK);
+			for(i = 0; i < TEST_BLOCK; i++)
+			{
+				yr[i * numCh + c] = t[i];
+				yqr[i * numCh + c] = tq[i];
+			}
+		}
+
+		arm_biquad_cascade_mc_df2T_f32(&M, x, yi, TEST_BLOCK);
+		arm_biquad_cascade_mc_df1_q31(&MQ, xq, yqi, TEST_BLOCK);
+
+		//planar runs in place
+		for(c = 0; c < numCh; c++)
+			for(i = 0; i < TEST_BLOCK; i++)
+			{
+				yp[c * TEST_BLOCK + i] = x[i * numCh + c];
+				yqp[c * TEST_BLOCK + i] = xq[i * numCh + c];
+			}
+		arm_biquad_cascade_mc_planar_df2T_f32(&P, yp, yp, TEST_BLOCK);
+		arm_biquad_cascade_mc_planar_df1_q31(&PQ, yqp, yqp, TEST_BLOCK);
+
+		for(c = 0; c < numCh; c++)
+			for(i = 0; i < TEST_BLOCK; i++)
+			{
+				bad += memcmp(&yi[i * numCh + c], &yr[i * numCh + c], sizeof(float32_t)) != 0;
+				bad += memcmp(&yp[c * TEST_BLOCK + i], &yr[i * numCh + c], sizeof(float32_t)) != 0;
+				bad_q += yqi[i * numCh + c] != yqr[i * numCh + c];
+				bad_q += yqp[c * TEST_BLOCK + i] != yqr[i * numCh + c];
+			}
+	}
+	CHECK(bad == 0, "%u channels: %u f32 outputs differ from arm_biquad_cascade_df2T_f32", numCh, bad);
+	CHECK(bad_q == 0, "%u channels: %u q31 outputs differ from arm_biquad_cascade_df1_q31", numCh, bad_q);
+	free(x);
+	free(yi);
+	free(yp);
+	free(yr);
+	free(xq);
+	free(yqi);
+	free(yqp);
+	free(yqr);
+}
+
+int main(void)
+{
+	uint16_t c;
+
+	test_coeffs();
+	for(c = 1; c <= TEST_MAX_CH; c++)
+		test_channels(c);
+	return test_done("test_biquad_mc");
+}
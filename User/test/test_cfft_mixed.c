@@ -0,0 +1,199 @@
+/*
+ * Mixed-radix CFFT/RFFT and the four-step large CFFT against a DFT in
+ * double precision.
+ * sources:
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_SNR_MIN    120.0       //float FFTs up to 64k points reach 130 dB and more
+#define TEST_DFT_MAX    4096u       //longer transforms are checked against the mixed-radix FFT
+
+//X = DFT(x) of n complex values, scaled by 1 / n for the inverse like the CMSIS inverse FFTs
+static void test_dft(const float32_t *x, double *X, uint32_t n, int inverse)
+{
+	double re, im, a;
+	uint32_t k, i;
+
+	for(k = 0; k < n; k++)
+	{
+		re = im = 0;
+		for(i = 0; i < n; i++)
+		{
+			a = (inverse ? 2.0 : -2.0) * TEST_PI * (double)((uint64_t)k * i % n) / n;
+			re += x[2 * i] * cos(a) - x[2 * i + 1] * sin(a);
+			im += x[2 * i] * sin(a) + x[2 * i + 1] * cos(a);
+		}
+		X[2 * k] = inverse ? re / n : re;
+		X[2 * k + 1] = inverse ? im / n : im;
+	}
+}
+
+static double test_snr_f32(const double *ref, const float32_t *y, uint32_t n)
+{
+	double *got = malloc(n * sizeof(double)), snr;
+	uint32_t i;
+
+	for(i = 0; i < n; i++)
+		got[i] = y[i];
+	snr = test_snr(ref, got, n);
+	free(got);
+	return snr;
+}
+
+static void test_random(float32_t *x, uint32_t n)
+{
+	uint32_t i;
+
+	for(i = 0; i < n; i++)
+		x[i] = (float32_t)(test_uniform() * 0.5);
+}
+
+static double test_mixed(uint32_t n)
+{
+	float32_t *x = malloc(8u * n), *y = malloc(8u * n), *tw = malloc(8u * n), *sc = malloc(8u * n);
+	double *X = malloc(16u * n), snr, worst = 300.0;
+	arm_cfft_mixed_instance_f32 S;
+	int inverse;
+
+	test_random(x, 2u * n);
+	CHECK(arm_cfft_mixed_init_f32(&S, n, tw, sc) == ARM_MATH_SUCCESS, "cfft_mixed_init %u", n);
+	for(inverse = 0; inverse < 2; inverse++)
+	{
+		memcpy(y, x, 8u * n);
+		arm_cfft_mixed_f32(&S, y, (uint8_t)inverse);
+		test_dft(x, X, n, inverse);
+		snr = test_snr_f32(X, y, 2u * n);
+		CHECK(snr >= TEST_SNR_MIN, "cfft_mixed %u inverse %d: SNR %.1f dB", n, inverse, snr);
+		worst = fmin(worst, snr);
+	}
+	free(x);
+	free(y);
+	free(tw);
+	free(sc);
+	free(X);
+	return worst;
+}
+
+//packed output like arm_rfft_fast_f32: X[0] and X[n / 2] share the first complex slot
+static double test_rfft_mixed(uint32_t n)
+{
+	float32_t *r = malloc(4u * n), *o = malloc(4u * n), *r2 = malloc(4u * n);
+	float32_t *tw = malloc(8u * n), *sc = malloc(4u * n), *c = malloc(8u * n);
+	double *X = malloc(16u * n), *ref = malloc(8u * n), *back = malloc(8u * n), snr, snr_back;
+	arm_rfft_mixed_instance_f32 S;
+	uint32_t i;
+
+	test_random(r, n);
+	for(i = 0; i < n; i++)
+	{
+		c[2 * i] = r[i];
+		c[2 * i + 1] = 0;
+	}
+	test_dft(c, X, n, 0);
+	ref[0] = X[0];
+	ref[1] = X[n];
+	for(i = 2; i < n; i++)
+		ref[i] = X[i];
+	for(i = 0; i < n; i++)
+		back[i] = r[i];
+
+	CHECK(arm_rfft_mixed_init_f32(&S, n, tw, sc) == ARM_MATH_SUCCESS, "rfft_mixed_init %u", n);
+	memcpy(r2, r, 4u * n);
+	arm_rfft_mixed_f32(&S, r2, o, 0);
+	snr = test_snr_f32(ref, o, n);
+	CHECK(snr >= TEST_SNR_MIN, "rfft_mixed %u: SNR %.1f dB", n, snr);
+	arm_rfft_mixed_f32(&S, o, r2, 1);
+	snr_back = test_snr_f32(back, r2, n);
+	CHECK(snr_back >= TEST_SNR_MIN, "rfft_mixed %u: inverse SNR %.1f dB", n, snr_back);
+	free(r);
+	free(o);
+	free(r2);
+	free(tw);
+	free(sc);
+	free(c);
+	free(X);
+	free(ref);
+	free(back);
+	return fmin(snr, snr_back);
+}
+
+//every work buffer size from the minimum up, so blockSize takes several values
+static void test_large(uint32_t n1, uint32_t n2)
+{
+	uint32_t n = n1 * n2, lm = n1 > n2 ? n1 : n2, wl, i;
+	float32_t *x = malloc(8u * n), *s = malloc(8u * n), *y = malloc(8u * n), *tw = malloc(8u * (n1 + 2u * n2));
+	float32_t *ref = malloc(8u * n), *sc = malloc(8u * n), *tw_ref = malloc(8u * n), *wk;
+	double *X = malloc(16u * n), snr;
+	arm_cfft_large_instance_f32 L;
+	arm_cfft_mixed_instance_f32 M;
+	int inverse;
+
+	test_random(x, 2u * n);
+	CHECK(arm_cfft_mixed_init_f32(&M, n, tw_ref, sc) == ARM_MATH_SUCCESS, "cfft_mixed_init %u", n);
+	for(wl = 4u * lm; wl <= 40u * lm; wl *= 3u)
+	{
+		wk = malloc(4u * wl);
+		CHECK(arm_cfft_large_init_f32(&L, n1, n2, tw, wk, wl) == ARM_MATH_SUCCESS, "cfft_large_init %ux%u", n1, n2);
+		for(inverse = 0; inverse < 2; inverse++)
+		{
+			memcpy(s, x, 8u * n);
+			arm_cfft_large_f32(&L, s, y, (uint8_t)inverse);
+			if(n <= TEST_DFT_MAX)
+			{
+				test_dft(x, X, n, inverse);
+			}
+			else
+			{
+				memcpy(ref, x, 8u * n);
+				arm_cfft_mixed_f32(&M, ref, (uint8_t)inverse);
+				for(i = 0; i < 2u * n; i++)
+					X[i] = ref[i];
+			}
+			snr = test_snr_f32(X, y, 2u * n);
+			printf("cfft_large %3ux%-3u blockSize %2u inverse %d: %.1f dB\n", n1, n2, L.blockSize, inverse, snr);
+			CHECK(snr >= TEST_SNR_MIN, "cfft_large %ux%u blockSize %u: SNR %.1f dB", n1, n2, L.blockSize, snr);
+		}
+		free(wk);
+	}
+	CHECK(arm_cfft_large_init_f32(&L, n1, n2, tw, y, 4u * lm - 1u) == ARM_MATH_LENGTH_ERROR,
+	      "cfft_large %ux%u: short work buffer accepted", n1, n2);
+	free(x);
+	free(s);
+	free(y);
+	free(tw);
+	free(ref);
+	free(sc);
+	free(tw_ref);
+	free(X);
+}
+
+int main(void)
+{
+	static const uint16_t len[] =
+	{
+		2, 3, 4, 5, 6, 8, 10, 12, 15, 16, 30, 60, 64, 120, 240, 256, 360, 480, 1000, 1536, 3000, 4096
+	};
+	static const uint16_t large[][2] = { { 8, 12 }, { 30, 40 }, { 64, 128 }, { 96, 128 }, { 256, 256 } };
+	float32_t tw[16], sc[16];
+	arm_cfft_mixed_instance_f32 S;
+	double worst = 300.0, worst_r = 300.0;
+	uint32_t i;
+
+	for(i = 0; i < sizeof(len) / sizeof(len[0]); i++)
+	{
+		worst = fmin(worst, test_mixed(len[i]));
+		if(!(len[i] & 1u))
+			worst_r = fmin(worst_r, test_rfft_mixed(len[i]));
+	}
+	printf("cfft_mixed: worst %.1f dB, rfft_mixed: worst %.1f dB\n", worst, worst_r);
+	CHECK(arm_cfft_mixed_init_f32(&S, 7, tw, sc) == ARM_MATH_ARGUMENT_ERROR, "length 7 accepted");
+	CHECK(arm_cfft_mixed_init_f32(&S, 0, tw, sc) == ARM_MATH_ARGUMENT_ERROR, "length 0 accepted");
+
+	for(i = 0; i < sizeof(large) / sizeof(large[0]); i++)
+		test_large(large[i][0], large[i][1]);
+	return test_done("test_cfft_mixed");
+}
@@ -0,0 +1,286 @@
+/*
+ * Batched PID controls against one arm_pid_f32/q31/q15 instance per loop,
+ * without limits, clamped and clamped with anti-windup, and the batched
+ * Clarke and Park transforms against the inline functions, in place
+ * included: all bit exact. The q15 batch forms A0 * x[n] exactly, so loops
+ * with a negative A0 are checked against the exact arithmetic instead.
+ * sources:
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_MAX_LOOPS  48
+#define TEST_TICKS      2000
+#define TEST_SAMPLES    37
+
+enum { TEST_NO_LIMITS = -1, TEST_CLAMP, TEST_ANTI_WINDUP };
+
+static float32_t test_f32(void)
+{
+	return (float32_t)test_uniform();
+}
+
+static q31_t test_q31(void)
+{
+	return (q31_t)test_rand();
+}
+
+//a square wave plus noise, so the outputs run into the limits and back
+static float32_t test_step(uint32_t t)
+{
+	return t % 300u < 150u ? 0.8f : -0.8f;
+}
+
+static void test_pid_f32(uint16_t n, int mode)
+{
+	float32_t kp[TEST_MAX_LOOPS], ki[TEST_MAX_LOOPS], kd[TEST_MAX_LOOPS], lim[2 * TEST_MAX_LOOPS];
+	float32_t co[3 * TEST_MAX_LOOPS], st[3 * TEST_MAX_LOOPS], in[TEST_MAX_LOOPS], out[TEST_MAX_LOOPS], r;
+	arm_pid_instance_f32 s[TEST_MAX_LOOPS];
+	arm_pid_batch_instance_f32 B;
+	uint32_t i, t, bad = 0;
+
+	for(i = 0; i < n; i++)
+	{
+		kp[i] = s[i].Kp = test_f32();
+		ki[i] = s[i].Ki = test_f32() * 0.1f;
+		kd[i] = s[i].Kd = test_f32() * 0.2f;
+		arm_pid_init_f32(&s[i], 1);
+		lim[i] = -0.5f - test_f32() * 0.2f;
+		lim[n + i] = 0.5f + test_f32() * 0.2f;
+	}
+	arm_pid_batch_init_f32(&B, n, kp, ki, kd, co, st, mode == TEST_NO_LIMITS ? NULL : lim, mode == TEST_ANTI_WINDUP);
+	for(t = 0; t < TEST_TICKS; t++)
+	{
+		for(i = 0; i < n; i++)
+			in[i] = test_f32() + test_step(t);
+		arm_pid_batch_f32(&B, in, out);
+		for(i = 0; i < n; i++)
+		{
+			r = arm_pid_f32(&s[i], in[i]);
+			if(mode != TEST_NO_LIMITS)
+			{
+				r = r < lim[i] ? lim[i] : r > lim[n + i] ? lim[n + i] : r;
+				//the integrator of the velocity form is y[n-1]
+				if(mode == TEST_ANTI_WINDUP)
+					s[i].state[2] = r;
+			}
+			bad += memcmp(&r, &out[i], sizeof(r)) != 0;
+		}
+	}
+	CHECK(bad == 0, "f32 %u loops mode %d: %u outputs differ", n, mode, bad);
+}
+
+static void test_pid_q31(uint16_t n, int mode)
+{
+	q31_t kp[TEST_MAX_LOOPS], ki[TEST_MAX_LOOPS], kd[TEST_MAX_LOOPS], lim[2 * TEST_MAX_LOOPS];
+	q31_t co[3 * TEST_MAX_LOOPS], st[3 * TEST_MAX_LOOPS], in[TEST_MAX_LOOPS], out[TEST_MAX_LOOPS], r;
+	arm_pid_instance_q31 s[TEST_MAX_LOOPS];
+	arm_pid_batch_instance_q31 B;
+	uint32_t i, t, bad = 0;
+
+	for(i = 0; i < n; i++)
+	{
+		kp[i] = s[i].Kp = test_q31() >> 2;
+		ki[i] = s[i].Ki = test_q31() >> 6;
+		kd[i] = s[i].Kd = test_q31() >> 4;
+		arm_pid_init_q31(&s[i], 1);
+		lim[i] = -(0x30000000 + (test_q31() >> 8));
+		lim[n + i] = 0x30000000 + (test_q31() >> 8);
+	}
+	arm_pid_batch_init_q31(&B, n, kp, ki, kd, co, st, mode == TEST_NO_LIMITS ? NULL : lim, mode == TEST_ANTI_WINDUP);
+	for(t = 0; t < TEST_TICKS; t++)
+	{
+		for(i = 0; i < n; i++)
+			in[i] = (test_q31() >> 3) + (q31_t)(test_step(t) * 0x0A000000);
+		arm_pid_batch_q31(&B, in, out);
+		for(i = 0; i < n; i++)
+		{
+			r = arm_pid_q31(&s[i], in[i]);
+			if(mode != TEST_NO_LIMITS)
+			{
+				r = r < lim[i] ? lim[i] : r > lim[n + i] ? lim[n + i] : r;
+				if(mode == TEST_ANTI_WINDUP)
+					s[i].state[2] = r;
+			}
+			bad += r != out[i];
+		}
+	}
+	CHECK(bad == 0, "q31 %u loops mode %d: %u outputs differ", n, mode, bad);
+}
+
+//arm_pid_q15 as built for the Cortex-M0, whose __SMUAD of the sign-extended A0 and x[n]
+//elsewhere adds 1 at 2.30 when both are negative, and the integrator keeps the difference
+static q15_t test_ref_q15(arm_pid_instance_q15 *S, q15_t in)
+{
+	q63_t acc;
+	q15_t out;
+
+	acc = (q31_t)S->A0 * in;
+	//A1 holds the gain of x[n-1] in its low half and the gain of x[n-2] in its high half
+	acc += (q31_t)(q15_t)S->A1 * S->state[0];
+	acc += (q31_t)(q15_t)(S->A1 >> 16) * S->state[1];
+	acc += (q31_t)S->state[2] * 32768;
+	out = (q15_t)__SSAT((acc >> 15), 16);
+	S->state[1] = S->state[0];
+	S->state[0] = in;
+	S->state[2] = out;
+	return out;
+}
+
+//the q15 gains and state are read as pairs, so the buffers are word aligned
+static void test_pid_q15(uint16_t n, int mode)
+{
+	int32_t cob[3 * TEST_MAX_LOOPS / 2 + 1], stb[3 * TEST_MAX_LOOPS / 2 + 1];
+	q15_t kp[TEST_MAX_LOOPS], ki[TEST_MAX_LOOPS], kd[TEST_MAX_LOOPS], lim[2 * TEST_MAX_LOOPS];
+	q15_t in[TEST_MAX_LOOPS], out[TEST_MAX_LOOPS], r;
+	arm_pid_instance_q15 s[TEST_MAX_LOOPS];
+	arm_pid_batch_instance_q15 B;
+	uint32_t i, t, bad = 0;
+
+	for(i = 0; i < n; i++)
+	{
+		kp[i] = s[i].Kp = (q15_t)(test_rand() >> 18);
+		ki[i] = s[i].Ki = (q15_t)((int32_t)test_rand() >> 21);
+		kd[i] = s[i].Kd = (q15_t)((int32_t)test_rand() >> 20);
+		arm_pid_init_q15(&s[i], 1);
+		lim[i] = (q15_t)(-0x3000 - (int32_t)(test_rand() >> 20));
+		lim[n + i] = (q15_t)(0x3000 + (int32_t)(test_rand() >> 20));
+	}
+	arm_pid_batch_init_q15(&B, n, kp, ki, kd, (q15_t *)cob, (q15_t *)stb, mode == TEST_NO_LIMITS ? NULL : lim,
+	                       mode == TEST_ANTI_WINDUP);
+	for(t = 0; t < TEST_TICKS; t++)
+	{
+		for(i = 0; i < n; i++)
+			in[i] = (q15_t)(((int32_t)test_rand() >> 19) + (int32_t)(test_step(t) * 0x0A00));
+		arm_pid_batch_q15(&B, in, out);
+		for(i = 0; i < n; i++)
+		{
+			r = s[i].A0 < 0 ? test_ref_q15(&s[i], in[i]) : arm_pid_q15(&s[i], in[i]);
+			if(mode != TEST_NO_LIMITS)
+			{
+				r = r < lim[i] ? lim[i] : r > lim[n + i] ? lim[n + i] : r;
+				if(mode == TEST_ANTI_WINDUP)
+					s[i].state[2] = r;
+			}
+			bad += r != out[i];
+		}
+	}
+	CHECK(bad == 0, "q15 %u loops mode %d: %u outputs differ", n, mode, bad);
+}
+
+static void test_transforms(void)
+{
+	float32_t a[TEST_SAMPLES], b[TEST_SAMPLES], c[TEST_SAMPLES], d[TEST_SAMPLES], sn[TEST_SAMPLES], cs[TEST_SAMPLES];
+	q31_t qa[TEST_SAMPLES], qb[TEST_SAMPLES], qc[TEST_SAMPLES], qd[TEST_SAMPLES], qs[TEST_SAMPLES], qcs[TEST_SAMPLES];
+	float32_t x, y;
+	q31_t qx, qy;
+	uint32_t i, n, bad[9] = { 0 };
+	double th;
+
+	//every length up to the block, so the unrolled loops and their tails both run
+	for(n = 0; n <= TEST_SAMPLES; n++)
+	{
+		for(i = 0; i < n; i++)
+		{
+			a[i] = test_f32();
+			b[i] = test_f32();
+			th = test_uniform() * TEST_PI;
+			sn[i] = (float32_t)sin(th);
+			cs[i] = (float32_t)cos(th);
+			qa[i] = test_q31();
+			qb[i] = test_q31();
+			qs[i] = (q31_t)(sin(th) * 2147483647.0);
+			qcs[i] = (q31_t)(cos(th) * 2147483647.0);
+		}
+		arm_clarke_batch_f32(a, b, c, d, n);
+		for(i = 0; i < n; i++)
+		{
+			arm_clarke_f32(a[i], b[i], &x, &y);
+			bad[0] += x != c[i] || y != d[i];
+		}
+		arm_inv_clarke_batch_f32(a, b, c, d, n);
+		for(i = 0; i < n; i++)
+		{
+			arm_inv_clarke_f32(a[i], b[i], &x, &y);
+			bad[1] += x != c[i] || y != d[i];
+		}
+		arm_park_batch_f32(a, b, c, d, sn, cs, n);
+		for(i = 0; i < n; i++)
+		{
+			arm_park_f32(a[i], b[i], &x, &y, sn[i], cs[i]);
+			bad[2] += x != c[i] || y != d[i];
+		}
+		arm_inv_park_batch_f32(a, b, c, d, sn, cs, n);
+		for(i = 0; i < n; i++)
+		{
+			arm_inv_park_f32(a[i], b[i], &x, &y, sn[i], cs[i]);
+			bad[3] += x != c[i] || y != d[i];
+		}
+		arm_clarke_batch_q31(qa, qb, qc, qd, n);
+		for(i = 0; i < n; i++)
+		{
+			arm_clarke_q31(qa[i], qb[i], &qx, &qy);
+			bad[4] += qx != qc[i] || qy != qd[i];
+		}
+		arm_inv_clarke_batch_q31(qa, qb, qc, qd, n);
+		for(i = 0; i < n; i++)
+		{
+			arm_inv_clarke_q31(qa[i], qb[i], &qx, &qy);
+			bad[5] += qx != qc[i] || qy != qd[i];
+		}
+		arm_park_batch_q31(qa, qb, qc, qd, qs, qcs, n);
+		for(i = 0; i < n; i++)
+		{
+			arm_park_q31(qa[i], qb[i], &qx, &qy, qs[i], qcs[i]);
+			bad[6] += qx != qc[i] || qy != qd[i];
+		}
+		arm_inv_park_batch_q31(qa, qb, qc, qd, qs, qcs, n);
+		for(i = 0; i < n; i++)
+		{
+			arm_inv_park_q31(qa[i], qb[i], &qx, &qy, qs[i], qcs[i]);
+			bad[7] += qx != qc[i] || qy != qd[i];
+		}
+
+		//in place, the outputs over the inputs
+		memcpy(c, a, sizeof(a));
+		memcpy(d, b, sizeof(b));
+		arm_park_batch_f32(c, d, c, d, sn, cs, n);
+		memcpy(qc, qa, sizeof(qa));
+		memcpy(qd, qb, sizeof(qb));
+		arm_inv_park_batch_q31(qc, qd, qc, qd, qs, qcs, n);
+		for(i = 0; i < n; i++)
+		{
+			arm_park_f32(a[i], b[i], &x, &y, sn[i], cs[i]);
+			arm_inv_park_q31(qa[i], qb[i], &qx, &qy, qs[i], qcs[i]);
+			bad[8] += x != c[i] || y != d[i] || qx != qc[i] || qy != qd[i];
+		}
+	}
+	CHECK(bad[0] == 0, "arm_clarke_batch_f32: %u samples differ", bad[0]);
+	CHECK(bad[1] == 0, "arm_inv_clarke_batch_f32: %u samples differ", bad[1]);
+	CHECK(bad[2] == 0, "arm_park_batch_f32: %u samples differ", bad[2]);
+	CHECK(bad[3] == 0, "arm_inv_park_batch_f32: %u samples differ", bad[3]);
+	CHECK(bad[4] == 0, "arm_clarke_batch_q31: %u samples differ", bad[4]);
+	CHECK(bad[5] == 0, "arm_inv_clarke_batch_q31: %u samples differ", bad[5]);
+	CHECK(bad[6] == 0, "arm_park_batch_q31: %u samples differ", bad[6]);
+	CHECK(bad[7] == 0, "arm_inv_park_batch_q31: %u samples differ", bad[7]);
+	CHECK(bad[8] == 0, "in place: %u samples differ", bad[8]);
+}
+
+int main(void)
+{
+	uint16_t n;
+	int mode;
+
+	for(n = 1; n <= TEST_MAX_LOOPS; n += n < 8u ? 1u : 13u)
+		for(mode = TEST_NO_LIMITS; mode <= TEST_ANTI_WINDUP; mode++)
+		{
+			test_pid_f32(n, mode);
+			test_pid_q31(n, mode);
+			test_pid_q15(n, mode);
+		}
+	test_transforms();
+	return test_done("test_controller_batch");
+}
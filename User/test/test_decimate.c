@@ -0,0 +1,274 @@
+/*
+ * CIC decimators against the exact integer response, half-band decimation
+ * against arm_fir_decimate_q31 with the full filter, the responses of the
+ * half-band and CIC compensation designs, and decimation chains: passband
+ * flatness, aliases and cost against a single FIR decimator.
+ * sources:
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_CIC_LEN    4000
+#define TEST_HB_LEN     2048
+#define TEST_HB_BLOCK   256
+#define TEST_OUT        512
+#define TEST_SETTLE     128         //outputs dropped while the chain fills
+#define TEST_MAX_IN     ((TEST_OUT + TEST_SETTLE) * 1000)
+#define TEST_MAX_COEFFS 16384
+#define TEST_MAX_STATE  32768
+#define TEST_PASS_MAX   0.2         //dB of passband deviation of a chain
+#define TEST_ALIAS_SLACK 3.0        //dB of alias above the specified attenuation
+#define TEST_HB_SLACK   2.5         //dB, the Kaiser length estimate is 2.1 dB short for 19 taps at 50 dB
+
+static q31_t s_x[TEST_MAX_IN], s_y[TEST_MAX_IN / 8], s_yf[TEST_CIC_LEN], s_yr[TEST_CIC_LEN];
+static q31_t s_coeffs[TEST_MAX_COEFFS], s_state[TEST_MAX_STATE];
+
+//y[k] of the CIC, the input convolved with numStages boxcars of M*D ones, every M-th sample
+//from M - 1, shifted down by postShift
+static uint32_t test_cic_ref(uint32_t n, uint32_t N, uint32_t M, uint32_t D, uint32_t shift)
+{
+	static int64_t h[4096], t[4096];
+	uint32_t len = (M * D - 1u) * N + 1u, i, j, s, k, ny = 0;
+	__int128 acc;
+
+	memset(h, 0, sizeof(h));
+	h[0] = 1;
+	for(s = 0; s < N; s++)
+	{
+		memset(t, 0, len * sizeof(t[0]));
+		for(i = 0; i < len; i++)
+			for(j = 0; j < M * D && i + j < len; j++)
+				t[i + j] += h[i];
+		memcpy(h, t, len * sizeof(t[0]));
+	}
+	for(k = M - 1u; k < n; k += M)
+	{
+		acc = 0;
+		for(i = 0; i < len && i <= k; i++)
+			acc += (__int128)h[i] * s_x[k - i];
+		s_yr[ny++] = (q31_t)(int64_t)(acc >> shift);
+	}
+	return ny;
+}
+
+//lowZero clears the bits the fast version drops, so that it is exact too
+static void test_cic(uint8_t N, uint16_t M, uint8_t D, int lowZero)
+{
+	arm_cic_decimate_instance_q31 S, F;
+	q63_t st[64], stf[64];
+	uint32_t i, pos, b, ny = 0, nf = 0, nr, bad = 0, badf = 0;
+
+	CHECK(arm_cic_decimate_init_q31(&S, N, M, D, st) == ARM_MATH_SUCCESS, "CIC %u/%u/%u: init", N, M, D);
+	arm_cic_decimate_init_q31(&F, N, M, D, stf);
+	for(i = 0; i < TEST_CIC_LEN; i++)
+	{
+		s_x[i] = (q31_t)test_rand();
+		if(lowZero)
+			s_x[i] &= ~(q31_t)((1u << S.postShift) - 1u);
+	}
+	//blocks of any length, not multiples of M
+	for(pos = 0; pos < TEST_CIC_LEN; pos += b)
+	{
+		b = 1u + test_rand() % 97u;
+		if(b > TEST_CIC_LEN - pos)
+			b = TEST_CIC_LEN - pos;
+		ny += arm_cic_decimate_q31(&S, s_x + pos, s_y + ny, b);
+		nf += arm_cic_decimate_fast_q31(&F, s_x + pos, s_yf + nf, b);
+	}
+	nr = test_cic_ref(TEST_CIC_LEN, N, M, D, S.postShift);
+	CHECK(ny == nr && nf == nr, "CIC %u/%u/%u: %u and %u outputs, expected %u", N, M, D, ny, nf, nr);
+	for(i = 0; i < nr; i++)
+	{
+		bad += s_y[i] != s_yr[i];
+		badf += s_yf[i] != s_yr[i];
+	}
+	printf("CIC %u stages M %2u D %u, postShift %2u: %3u outputs, %u differ, fast %u%s\n", N, M, D, S.postShift, nr, bad, badf,
+	       lowZero ? "" : " with the low bits set");
+	CHECK(bad == 0, "CIC %u/%u/%u: %u outputs differ", N, M, D, bad);
+	if(lowZero)
+		CHECK(badf == 0, "fast CIC %u/%u/%u: %u outputs differ", N, M, D, badf);
+}
+
+//the design meets its attenuation outside the Kaiser transition band, and the decimator is the
+//full filter through arm_fir_decimate_q31
+static void test_halfband(uint16_t K, float32_t A)
+{
+	static float32_t cf[256];
+	static q31_t c[256], full[1024], st1[TEST_HB_BLOCK + 1024], st2[TEST_HB_BLOCK + 1024], y1[TEST_HB_BLOCK], y2[TEST_HB_BLOCK];
+	arm_fir_halfband_decimate_instance_q31 H;
+	arm_fir_decimate_instance_q31 D;
+	uint32_t taps = 4u * K - 1u, i, p, bad = 0;
+	double pass = 0, stop = 0, df = (A - 7.95) / (14.36 * (taps - 1u)), f, r;
+
+	CHECK(arm_fir_halfband_design_f32(K, A, cf) == ARM_MATH_SUCCESS, "half-band %u: design", K);
+	for(f = 0; f <= 0.5; f += 0.0005)
+	{
+		r = 0.5;
+		for(i = 0; i < K; i++)
+			r += 2.0 * cf[i] * cos(2.0 * TEST_PI * f * (2u * i + 1u));
+		if(f < 0.25 - df / 2)
+			pass = fmax(pass, fabs(r - 1.0));
+		if(f > 0.25 + df / 2)
+			stop = fmax(stop, fabs(r));
+	}
+	printf("half-band %2u coefficients %3.0f dB: passband ripple %.1e, stopband %.1f dB\n", K, A, pass, 20.0 * log10(stop));
+	CHECK(20.0 * log10(stop) < -A + TEST_HB_SLACK, "half-band %u %.0f dB: stopband %.1f dB", K, A, 20.0 * log10(stop));
+
+	arm_float_to_q31(cf, c, K);
+	memset(full, 0, sizeof(full));
+	full[2u * K - 1u] = 0x40000000;
+	for(i = 0; i < K; i++)
+		full[2u * K - 2u - 2u * i] = full[2u * K + 2u * i] = c[i];
+	arm_fir_halfband_decimate_init_q31(&H, K, c, st1, TEST_HB_BLOCK);
+	arm_fir_decimate_init_q31(&D, (uint16_t)taps, 2, full, st2, TEST_HB_BLOCK);
+	for(i = 0; i < TEST_HB_LEN; i++)
+		s_x[i] = (q31_t)test_rand() >> 1;
+	for(p = 0; p < TEST_HB_LEN; p += TEST_HB_BLOCK)
+	{
+		arm_fir_halfband_decimate_q31(&H, s_x + p, y1, TEST_HB_BLOCK);
+		arm_fir_decimate_q31(&D, s_x + p, y2, TEST_HB_BLOCK);
+		bad += memcmp(y1, y2, sizeof(y1) / 2) != 0;
+	}
+	CHECK(bad == 0, "half-band %u: %u blocks differ from arm_fir_decimate_q31", K, bad);
+
+	//in place
+	arm_fir_halfband_decimate_init_q31(&H, K, c, st1, TEST_HB_BLOCK);
+	memcpy(y2, s_x, sizeof(y2));
+	arm_fir_halfband_decimate_q31(&H, y2, y2, TEST_HB_BLOCK);
+	arm_fir_halfband_decimate_init_q31(&H, K, c, st1, TEST_HB_BLOCK);
+	arm_fir_halfband_decimate_q31(&H, s_x, y1, TEST_HB_BLOCK);
+	CHECK(memcmp(y1, y2, sizeof(y1) / 2) == 0, "half-band %u: in place differs", K);
+}
+
+static double test_cic_gain(uint32_t N, uint32_t M, uint32_t D, double f)
+{
+	if(f == 0)
+		return 1.0;
+	return fabs(pow(sin(TEST_PI * M * D * f) / (M * D * sin(TEST_PI * f)), N));
+}
+
+//the compensator times the CIC droop is flat to the cutoff, with unit gain at DC
+static void test_comp(uint8_t N, uint16_t M, uint8_t D, uint16_t ratio, float32_t fc, float32_t A, uint16_t taps)
+{
+	static float32_t h[1024];
+	double df = (A - 7.95) / (14.36 * (taps - 1u)), rip = 0, stop = 0, dc = 0, re, im, mag, f;
+	uint32_t i;
+
+	CHECK(arm_cic_comp_design_f32(N, M, D, ratio, fc, A, taps, h) == ARM_MATH_SUCCESS, "compensator %u/%u: design", N, M);
+	for(i = 0; i < taps; i++)
+		dc += h[i];
+	for(f = 0; f < 0.5; f += 0.0005)
+	{
+		re = im = 0;
+		for(i = 0; i < taps; i++)
+		{
+			re += h[i] * cos(2.0 * TEST_PI * f * i);
+			im -= h[i] * sin(2.0 * TEST_PI * f * i);
+		}
+		mag = sqrt(re * re + im * im);
+		if(f < fc - df / 2)
+			rip = fmax(rip, fabs(20.0 * log10(mag * test_cic_gain(N, M, D, f / ((double)ratio * M)))));
+		if(f > fc + df / 2)
+			stop = fmax(stop, mag);
+	}
+	printf("compensator %u stages M %2u D %u ratio %u cutoff %.2f: droop %.3f dB left of %.2f dB, stopband %.1f dB\n", N, M,
+	       D, ratio, fc, rip, -20.0 * log10(test_cic_gain(N, M, D, (fc - df / 2) / ((double)ratio * M))), 20.0 * log10(stop));
+	CHECK(fabs(dc - 1.0) < 1e-5, "compensator %u/%u: DC gain %.6f", N, M, dc);
+	CHECK(rip < 0.1, "compensator %u/%u: droop %.3f dB left", N, M, rip);
+}
+
+//amplitude of the tone at f cycles per sample
+static double test_tone(const q31_t *y, uint32_t n, double f)
+{
+	double re = 0, im = 0;
+	uint32_t i;
+
+	for(i = 0; i < n; i++)
+	{
+		re += y[i] * cos(2.0 * TEST_PI * f * i);
+		im += y[i] * sin(2.0 * TEST_PI * f * i);
+	}
+	return 2.0 * sqrt(re * re + im * im) / n / 2147483648.0;
+}
+
+//12 tones across the passband and 12 that alias into it, from just past the transition band to
+//several output rates away
+static void test_chain(uint32_t M, uint8_t N, float32_t p, float32_t A, uint32_t blk)
+{
+	arm_decimate_chain_plan_q31 P;
+	arm_decimate_chain_instance_q31 S;
+	q63_t cicState[32];
+	uint32_t nin = (TEST_OUT + TEST_SETTLE) * M, i, k, taps;
+	double worstPass = 0, worstAlias = -300, fo, fr, a;
+	int t;
+
+	CHECK(arm_decimate_chain_design_q31(&P, M, N, p, A, blk) == ARM_MATH_SUCCESS, "chain M %u: design", M);
+	printf("chain M %4u: CIC %u x %u, %u half-bands (", M, P.cicM, P.cicStages, P.numHalfbands);
+	for(k = 0; k < P.numHalfbands; k++)
+		printf("%s%u", k ? "," : "", P.halfbandCoeffs[k]);
+	printf("), FIR %u taps / %u, cost %.2f, %u coefficients, state %u\n", P.firTaps, P.firM, P.cost, P.numCoeffs, P.stateLength);
+	if(P.numCoeffs > TEST_MAX_COEFFS || P.stateLength > TEST_MAX_STATE || 2u * P.cicStages > 32u)
+	{
+		CHECK(0, "chain M %u: buffers too small", M);
+		return;
+	}
+	CHECK(arm_decimate_chain_init_q31(&S, &P, s_coeffs, cicState, s_state) == ARM_MATH_SUCCESS, "chain M %u: init", M);
+
+	for(t = 0; t < 24; t++)
+	{
+		if(t < 12)
+			fo = p * t / 11.0;
+		else if(t < 18)
+			fo = 1.0 - p + (t - 12) * 0.1;
+		else
+			fo = 2.0 + (t - 18) * 3.3 - p;
+		for(i = 0; i < nin; i++)
+			s_x[i] = (q31_t)(0.5 * 2147483647.0 * cos(2.0 * TEST_PI * fo / M * i + 0.3));
+		arm_decimate_chain_init_q31(&S, &P, s_coeffs, cicState, s_state);
+		for(i = 0; i < nin; i += blk)
+			arm_decimate_chain_q31(&S, s_x + i, s_y + i / M, blk);
+		fr = fabs(fo - floor(fo + 0.5));
+		a = 20.0 * log10(test_tone(s_y + TEST_SETTLE, TEST_OUT, fr) / 0.5);
+		if(t < 12)
+			worstPass = fo > 0 ? fmax(worstPass, fabs(a)) : worstPass;
+		else
+			worstAlias = fmax(worstAlias, a);
+	}
+	//a single polyphase FIR decimator meeting the same specification costs taps / M per input sample
+	taps = (uint32_t)ceil((A - 7.95) / (14.36 * (1.0 - 2.0 * p) / M)) + 1u;
+	printf("  passband deviation %.3f dB, worst alias %.1f dB, cost %.2f against %.2f for one FIR of %u taps\n", worstPass,
+	       worstAlias, P.cost, (double)taps / M, taps);
+	CHECK(worstPass < TEST_PASS_MAX, "chain M %u: passband deviation %.3f dB", M, worstPass);
+	CHECK(worstAlias < -A + TEST_ALIAS_SLACK, "chain M %u: alias %.1f dB", M, worstAlias);
+	CHECK(P.cost < (double)taps / M, "chain M %u: cost %.2f, one FIR %.2f", M, P.cost, (double)taps / M);
+}
+
+int main(void)
+{
+	arm_decimate_chain_plan_q31 P;
+
+	test_cic(1, 8, 1, 0);
+	test_cic(4, 16, 1, 0);
+	test_cic(5, 25, 2, 0);
+	test_cic(3, 7, 1, 1);
+	test_cic(4, 16, 1, 1);
+	test_cic(6, 32, 1, 0);
+	test_halfband(5, 50.0f);
+	test_halfband(3, 60.0f);
+	test_halfband(8, 80.0f);
+	test_halfband(20, 100.0f);
+	test_comp(4, 16, 1, 1, 0.2f, 80.0f, 63);
+	test_comp(5, 32, 1, 4, 0.1f, 80.0f, 95);
+	test_comp(3, 8, 2, 1, 0.15f, 60.0f, 41);
+	test_chain(64, 4, 0.4f, 80.0f, 1024);
+	test_chain(256, 5, 0.4f, 90.0f, 2048);
+	test_chain(48, 3, 0.3f, 70.0f, 960);
+	test_chain(1000, 5, 0.45f, 80.0f, 4000);
+	CHECK(arm_decimate_chain_design_q31(&P, 64, 4, 0.4f, 80.0f, 1000) == ARM_MATH_LENGTH_ERROR,
+	      "block of 1000 for M 64 accepted");
+	CHECK(arm_decimate_chain_design_q31(&P, 3, 4, 0.4f, 80.0f, 999) == ARM_MATH_ARGUMENT_ERROR, "M 3 accepted");
+	return test_done("test_decimate");
+}
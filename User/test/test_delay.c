@@ -0,0 +1,131 @@
+/*
+ * Wrap-safe deadline helpers and timer expiry order across the 32-bit wrap.
+ * sources: User/timer_wheel.c
+ */
+
+#include "test.h"
+#include "delay.h"
+#include "timer_wheel.h"
+#include <string.h>
+
+#define TEST_TIMERS     500
+
+//the helpers against 64-bit time stamps that never wrap
+static void test_compare(void)
+{
+	static const uint32_t base[] = { 0, 1, 0x7FFFFFFFu, 0x80000000u, 0xFFFFFF00u, 0xFFFFFFFFu };
+	uint64_t now64, dl64;
+	uint32_t i, k, timeout, now, dl, bad = 0;
+
+	for(i = 0; i < sizeof(base) / sizeof(base[0]); i++)
+	{
+		for(k = 0; k < 20000u; k++)
+		{
+			//deadlines up to 2^31 - 1 ahead, polled anywhere up to 2^31 - 1 after they were set
+			timeout = test_rand() & 0x7FFFFFFFu;
+			if(k & 1u)
+				timeout &= 0x3FFu;
+			now64 = 0x100000000ull + base[i];
+			dl64 = now64 + timeout;
+			dl = deadline_from((uint32_t)now64, timeout);
+			now64 += (k & 2u) ? (test_rand() & 0x7FFFFFFFu) : (test_rand() & 0x7FFu);
+			if((int64_t)(now64 - dl64) >= 0x80000000ll)
+				continue;
+			now = (uint32_t)now64;
+			bad += deadline_passed(now, dl) != (now64 >= dl64);
+			bad += TIME_AFTER_EQ(now, dl) != (now64 >= dl64);
+			bad += TIME_AFTER(now, dl) != (now64 > dl64);
+		}
+	}
+	CHECK(bad == 0, "%u wrong comparisons", bad);
+
+	CHECK(TIME_AFTER(0x00000001u, 0xFFFFFFFFu), "1 is not after 0xFFFFFFFF");
+	CHECK(!TIME_AFTER(0xFFFFFFFFu, 0x00000001u), "0xFFFFFFFF is after 1");
+	CHECK(deadline_passed(0x00000004u, deadline_from(0xFFFFFFFEu, 6u)), "deadline across the wrap not passed");
+	CHECK(!deadline_passed(0x00000003u, deadline_from(0xFFFFFFFEu, 6u)), "deadline across the wrap passed early");
+}
+
+//a polling loop like the QSPI timeouts waits exactly to its deadline, also across the wrap
+static void test_poll(void)
+{
+	uint32_t start, timeout, clock, end, bad = 0, k;
+
+	for(k = 0; k < 2000u; k++)
+	{
+		start = 0xFFFFFFFFu - (test_rand() & 0xFFFu);
+		timeout = test_rand() & 0x1FFFu;
+		end = deadline_from(start, timeout);
+		clock = start;
+		while(!deadline_passed(clock, end))
+			clock++;
+		bad += clock - start != timeout;
+	}
+	CHECK(bad == 0, "%u polling loops ended at the wrong tick", bad);
+}
+
+static tw_wheel_t s_wheel;
+static tw_timer_t s_timer[TEST_TIMERS];
+static uint64_t s_due[TEST_TIMERS];     //unwrapped deadline of every timer
+static uint32_t s_deadline[TEST_TIMERS];
+static uint64_t s_clock64;
+static uint64_t s_prev_due;
+static uint32_t s_fired, s_order_errors, s_early, s_late;
+
+static void test_cb(tw_timer_t *t, void *arg)
+{
+	uint32_t i = (uint32_t)(uintptr_t)arg;
+
+	if(s_due[i] < s_prev_due)
+		s_order_errors++;
+	s_prev_due = s_due[i];
+	if(!deadline_passed(s_wheel.now, s_deadline[i]))
+		s_early++;
+	if(s_wheel.now != s_deadline[i])
+		s_late++;
+	s_fired++;
+}
+
+//microsecond timers set just before the time base wraps fire in deadline order
+static void test_timer_order(uint32_t start)
+{
+	uint32_t i, next, timeout;
+
+	s_fired = s_order_errors = s_early = s_late = 0;
+	s_prev_due = 0;
+	s_clock64 = 0x100000000ull + start;
+	tw_init(&s_wheel, start);
+	for(i = 0; i < TEST_TIMERS; i++)
+	{
+		//half of them within 4096 ticks, so many land on either side of the wrap
+		timeout = (i & 1u) ? (test_rand() & 0xFFFu) : (test_rand() & 0xFFFFFFu);
+		s_deadline[i] = deadline_from(start, timeout);
+		s_due[i] = s_clock64 + timeout;
+		tw_timer_init(&s_timer[i], test_cb, (void *)(uintptr_t)i);
+		tw_start(&s_wheel, &s_timer[i], s_deadline[i], 0);
+	}
+
+	//advance like hrtimer.c, to the next event or in 1000 tick steps when that is further
+	while(tw_next_event(&s_wheel, &next))
+	{
+		if(next - (uint32_t)s_clock64 > 1000u && TW_TIME_AFTER(next, (uint32_t)s_clock64))
+			s_clock64 += 1000u;
+		else if(TW_TIME_AFTER(next, (uint32_t)s_clock64))
+			s_clock64 += next - (uint32_t)s_clock64;
+		tw_advance(&s_wheel, (uint32_t)s_clock64);
+	}
+
+	CHECK(s_fired == TEST_TIMERS, "from %08x: %u of %u timers fired", start, s_fired, TEST_TIMERS);
+	CHECK(s_order_errors == 0, "from %08x: %u timers out of deadline order", start, s_order_errors);
+	CHECK(s_early == 0, "from %08x: %u timers before their deadline", start, s_early);
+	CHECK(s_late == 0, "from %08x: %u timers after their deadline", start, s_late);
+}
+
+int main(void)
+{
+	test_compare();
+	test_poll();
+	test_timer_order(0xFFFFF800u);
+	test_timer_order(0xFFFFFFFFu);
+	test_timer_order(0x7FFFF800u);
+	return test_done("test_delay");
+}
@@ -0,0 +1,492 @@
+/*
+ * Every DSP function family against the golden vectors of ref_dsp.h, which
+ * gen_ref_dsp.c computes in double precision. The minimum SNR of every
+ * output is what the current code reaches, less 5 to 10 dB, and 250 dB for
+ * exact results; a change that costs accuracy fails here before it reaches
+ * the target. Regenerate ref_dsp.h only when the vectors themselves change.
+ * sources:
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include "ref_dsp.h"
+#include <string.h>
+
+#define TEST_LEN        (2 * REF_N + REF_FIR_TAPS)
+
+static float32_t s_xf[REF_N], s_yf[REF_N], s_sf[REF_N];
+static q31_t s_x31[REF_N], s_y31[REF_N], s_s31[REF_N];
+static q15_t s_x15[REF_N], s_y15[REF_N], s_s15[REF_N];
+
+static float32_t s_f32[TEST_LEN], s_f32b[TEST_LEN];
+static q31_t s_q31[TEST_LEN], s_q31b[TEST_LEN];
+static q15_t s_q15[TEST_LEN];
+static double s_got[TEST_LEN];
+
+static void test_inputs(void)
+{
+	uint32_t i;
+
+	for(i = 0; i < REF_N; i++)
+	{
+		s_x15[i] = ref_x[i];
+		s_y15[i] = ref_y[i];
+		s_s15[i] = ref_s[i];
+		s_x31[i] = (q31_t)ref_x[i] * 65536;
+		s_y31[i] = (q31_t)ref_y[i] * 65536;
+		s_s31[i] = (q31_t)ref_s[i] * 65536;
+		s_xf[i] = ref_x[i] / 32768.0f;
+		s_yf[i] = ref_y[i] / 32768.0f;
+		s_sf[i] = ref_s[i] / 32768.0f;
+	}
+}
+
+static const double *test_f32(const float32_t *p, uint32_t n)
+{
+	uint32_t i;
+
+	for(i = 0; i < n; i++)
+		s_got[i] = p[i];
+	return s_got;
+}
+
+//fixed-point results with frac fractional bits
+static const double *test_q31(const q31_t *p, uint32_t n, int frac)
+{
+	uint32_t i;
+
+	for(i = 0; i < n; i++)
+		s_got[i] = ldexp(p[i], -frac);
+	return s_got;
+}
+
+static const double *test_q15(const q15_t *p, uint32_t n, int frac)
+{
+	uint32_t i;
+
+	for(i = 0; i < n; i++)
+		s_got[i] = ldexp(p[i], -frac);
+	return s_got;
+}
+
+static void test_expect(const char *name, const double *ref, const double *got, uint32_t n, double min_snr)
+{
+	double snr = test_snr(ref, got, n);
+
+	printf("%-28s %6.1f dB  (min %5.1f)\n", name, snr, min_snr);
+	CHECK(snr >= min_snr, "%s: SNR %.1f dB, below %.1f dB", name, snr, min_snr);
+}
+
+static void test_scalar(const char *name, double ref, double got, double min_snr)
+{
+	test_expect(name, &ref, &got, 1, min_snr);
+}
+
+static void test_basic(void)
+{
+	q63_t acc;
+	float32_t f;
+
+	arm_add_f32(s_xf, s_yf, s_f32, REF_N);
+	test_expect("add_f32", ref_add, test_f32(s_f32, REF_N), REF_N, 250.0);
+	arm_add_q31(s_x31, s_y31, s_q31, REF_N);
+	test_expect("add_q31", ref_add, test_q31(s_q31, REF_N, 31), REF_N, 250.0);
+	arm_add_q15(s_x15, s_y15, s_q15, REF_N);
+	test_expect("add_q15", ref_add, test_q15(s_q15, REF_N, 15), REF_N, 250.0);
+
+	arm_mult_f32(s_xf, s_yf, s_f32, REF_N);
+	test_expect("mult_f32", ref_mult, test_f32(s_f32, REF_N), REF_N, 145.0);
+	arm_mult_q31(s_x31, s_y31, s_q31, REF_N);
+	test_expect("mult_q31", ref_mult, test_q31(s_q31, REF_N, 31), REF_N, 250.0);
+	arm_mult_q15(s_x15, s_y15, s_q15, REF_N);
+	test_expect("mult_q15", ref_mult, test_q15(s_q15, REF_N, 15), REF_N, 65.0);
+
+	arm_scale_f32(s_xf, 0.75f, s_f32, REF_N);
+	test_expect("scale_f32", ref_scale, test_f32(s_f32, REF_N), REF_N, 250.0);
+	arm_scale_q31(s_x31, 0x60000000, 0, s_q31, REF_N);
+	test_expect("scale_q31", ref_scale, test_q31(s_q31, REF_N, 31), REF_N, 250.0);
+	arm_scale_q15(s_x15, 0x6000, 0, s_q15, REF_N);
+	test_expect("scale_q15", ref_scale, test_q15(s_q15, REF_N, 15), REF_N, 75.0);
+
+	arm_abs_f32(s_xf, s_f32, REF_N);
+	test_expect("abs_f32", ref_abs, test_f32(s_f32, REF_N), REF_N, 250.0);
+	arm_abs_q31(s_x31, s_q31, REF_N);
+	test_expect("abs_q31", ref_abs, test_q31(s_q31, REF_N, 31), REF_N, 250.0);
+	arm_abs_q15(s_x15, s_q15, REF_N);
+	test_expect("abs_q15", ref_abs, test_q15(s_q15, REF_N, 15), REF_N, 250.0);
+
+	arm_dot_prod_f32(s_xf, s_yf, REF_N, &f);
+	test_scalar("dot_prod_f32", ref_dot[0], f, 130.0);
+	arm_dot_prod_q31(s_x31, s_y31, REF_N, &acc);
+	test_scalar("dot_prod_q31", ref_dot[0], ldexp((double)acc, -48), 250.0);
+	arm_dot_prod_q15(s_x15, s_y15, REF_N, &acc);
+	test_scalar("dot_prod_q15", ref_dot[0], ldexp((double)acc, -30), 250.0);
+}
+
+static void test_complex(void)
+{
+	arm_cmplx_mult_cmplx_f32(s_xf, s_yf, s_f32, REF_N / 2);
+	test_expect("cmplx_mult_cmplx_f32", ref_cmplx_mult, test_f32(s_f32, REF_N), REF_N, 140.0);
+	arm_cmplx_mult_cmplx_q31(s_x31, s_y31, s_q31, REF_N / 2);
+	test_expect("cmplx_mult_cmplx_q31", ref_cmplx_mult, test_q31(s_q31, REF_N, 29), REF_N, 155.0);
+	arm_cmplx_mult_cmplx_q15(s_x15, s_y15, s_q15, REF_N / 2);
+	test_expect("cmplx_mult_cmplx_q15", ref_cmplx_mult, test_q15(s_q15, REF_N, 13), REF_N, 55.0);
+
+	arm_cmplx_mag_f32(s_xf, s_f32, REF_N / 2);
+	test_expect("cmplx_mag_f32", ref_cmplx_mag, test_f32(s_f32, REF_N / 2), REF_N / 2, 145.0);
+	arm_cmplx_mag_q31(s_x31, s_q31, REF_N / 2);
+	test_expect("cmplx_mag_q31", ref_cmplx_mag, test_q31(s_q31, REF_N / 2, 30), REF_N / 2, 160.0);
+	arm_cmplx_mag_q15(s_x15, s_q15, REF_N / 2);
+	test_expect("cmplx_mag_q15", ref_cmplx_mag, test_q15(s_q15, REF_N / 2, 14), REF_N / 2, 60.0);
+}
+
+static void test_controller(void)
+{
+	arm_pid_instance_f32 pf;
+	arm_pid_instance_q31 p31;
+	arm_pid_instance_q15 p15;
+	uint32_t i;
+
+	//theta in degrees, in 1.31 as a fraction of 180 degrees
+	for(i = 0; i < REF_N; i++)
+		arm_sin_cos_f32(s_xf[i] * 360.0f, &s_f32[i], &s_f32b[i]);
+	test_expect("sin_cos_f32 sin", ref_sin_cos_sin, test_f32(s_f32, REF_N), REF_N, 145.0);
+	test_expect("sin_cos_f32 cos", ref_sin_cos_cos, test_f32(s_f32b, REF_N), REF_N, 145.0);
+	for(i = 0; i < REF_N; i++)
+		arm_sin_cos_q31(s_x31[i] * 2, &s_q31[i], &s_q31b[i]);
+	test_expect("sin_cos_q31 sin", ref_sin_cos_sin, test_q31(s_q31, REF_N, 31), REF_N, 175.0);
+	//the cosine next to -90 degrees negates the table entry -1.0, which overflows
+	test_expect("sin_cos_q31 cos", ref_sin_cos_cos, test_q31(s_q31b, REF_N, 31), REF_N, 70.0);
+
+	pf.Kp = 0.1f;
+	pf.Ki = 0.01f;
+	pf.Kd = 0.05f;
+	arm_pid_init_f32(&pf, 1);
+	for(i = 0; i < REF_N; i++)
+		s_f32[i] = arm_pid_f32(&pf, s_xf[i]);
+	test_expect("pid_f32", ref_pid, test_f32(s_f32, REF_N), REF_N, 110.0);
+	p31.Kp = 0x0CCCCCCD;
+	p31.Ki = 0x0147AE14;
+	p31.Kd = 0x06666666;
+	arm_pid_init_q31(&p31, 1);
+	for(i = 0; i < REF_N; i++)
+		s_q31[i] = arm_pid_q31(&p31, s_x31[i]);
+	test_expect("pid_q31", ref_pid, test_q31(s_q31, REF_N, 31), REF_N, 120.0);
+	p15.Kp = 0x0CCD;
+	p15.Ki = 0x0148;
+	p15.Kd = 0x0666;
+	//the 1.15 output is fed back, its truncation accumulates like an integrator
+	arm_pid_init_q15(&p15, 1);
+	for(i = 0; i < REF_N; i++)
+		s_q15[i] = arm_pid_q15(&p15, s_x15[i]);
+	test_expect("pid_q15", ref_pid, test_q15(s_q15, REF_N, 15), REF_N, 25.0);
+}
+
+//angles in [0, 1) of a full turn in the fixed-point formats
+static void test_fast_math(void)
+{
+	uint32_t i;
+
+	for(i = 0; i < REF_N; i++)
+	{
+		s_f32[i] = arm_sin_f32((s_xf[i] + 0.5f) * 2.0f * PI);
+		s_q31[i] = arm_sin_q31(s_x31[i] + 0x40000000);
+		s_q15[i] = arm_sin_q15(s_x15[i] + 0x4000);
+	}
+	test_expect("sin_f32", ref_sin, test_f32(s_f32, REF_N), REF_N, 90.0);
+	test_expect("sin_q31", ref_sin, test_q31(s_q31, REF_N, 31), REF_N, 90.0);
+	test_expect("sin_q15", ref_sin, test_q15(s_q15, REF_N, 15), REF_N, 75.0);
+
+	for(i = 0; i < REF_N; i++)
+	{
+		s_f32[i] = arm_cos_f32((s_xf[i] + 0.5f) * 2.0f * PI);
+		s_q31[i] = arm_cos_q31(s_x31[i] + 0x40000000);
+		s_q15[i] = arm_cos_q15(s_x15[i] + 0x4000);
+	}
+	test_expect("cos_f32", ref_cos, test_f32(s_f32, REF_N), REF_N, 90.0);
+	test_expect("cos_q31", ref_cos, test_q31(s_q31, REF_N, 31), REF_N, 90.0);
+	test_expect("cos_q15", ref_cos, test_q15(s_q15, REF_N, 15), REF_N, 75.0);
+
+	for(i = 0; i < REF_N; i++)
+	{
+		arm_sqrt_f32(fabsf(s_xf[i]), &s_f32[i]);
+		arm_sqrt_q31(s_x31[i] < 0 ? -s_x31[i] : s_x31[i], &s_q31[i]);
+		arm_sqrt_q15(s_x15[i] < 0 ? -s_x15[i] : s_x15[i], &s_q15[i]);
+	}
+	test_expect("sqrt_f32", ref_sqrt, test_f32(s_f32, REF_N), REF_N, 145.0);
+	test_expect("sqrt_q31", ref_sqrt, test_q31(s_q31, REF_N, 31), REF_N, 170.0);
+	test_expect("sqrt_q15", ref_sqrt, test_q15(s_q15, REF_N, 15), REF_N, 75.0);
+}
+
+static void test_filtering(void)
+{
+	static float32_t hf[REF_FIR_TAPS], stf[REF_FIR_TAPS + REF_N];
+	static q31_t h31[REF_FIR_TAPS], st31[REF_FIR_TAPS + REF_N];
+	static q15_t h15[REF_FIR_TAPS], st15[REF_FIR_TAPS + REF_N];
+	static float32_t bf[10], bstf[8];
+	static q31_t b31[10], bst31[8];
+	static q15_t b15[12], bst15[8];
+	arm_fir_instance_f32 ff;
+	arm_fir_instance_q31 f31;
+	arm_fir_instance_q15 f15;
+	arm_biquad_casd_df1_inst_f32 bqf;
+	arm_biquad_casd_df1_inst_q31 bq31;
+	arm_biquad_casd_df1_inst_q15 bq15;
+	uint32_t i, k;
+
+	//CMSIS takes the taps time reversed
+	for(i = 0; i < REF_FIR_TAPS; i++)
+	{
+		k = REF_FIR_TAPS - 1u - i;
+		hf[i] = ref_fir_coeffs[k] / 32768.0f;
+		h31[i] = (q31_t)ref_fir_coeffs[k] * 65536;
+		h15[i] = ref_fir_coeffs[k];
+	}
+	arm_fir_init_f32(&ff, REF_FIR_TAPS, hf, stf, REF_N);
+	arm_fir_f32(&ff, s_xf, s_f32, REF_N);
+	test_expect("fir_f32", ref_fir, test_f32(s_f32, REF_N), REF_N, 135.0);
+	arm_fir_init_q31(&f31, REF_FIR_TAPS, h31, st31, REF_N);
+	arm_fir_q31(&f31, s_x31, s_q31, REF_N);
+	test_expect("fir_q31", ref_fir, test_q31(s_q31, REF_N, 31), REF_N, 250.0);
+	CHECK(arm_fir_init_q15(&f15, REF_FIR_TAPS, h15, st15, REF_N) == ARM_MATH_SUCCESS, "fir_init_q15");
+	arm_fir_q15(&f15, s_x15, s_q15, REF_N);
+	test_expect("fir_q15", ref_fir, test_q15(s_q15, REF_N, 15), REF_N, 75.0);
+
+	//coefficients in 2.14, the fixed-point versions take them halved with a post shift of 1
+	for(i = 0; i < 2; i++)
+	{
+		for(k = 0; k < 5; k++)
+		{
+			bf[5 * i + k] = ref_biquad_coeffs[5 * i + k] / 16384.0f;
+			b31[5 * i + k] = (q31_t)ref_biquad_coeffs[5 * i + k] * 65536;
+		}
+		b15[6 * i] = ref_biquad_coeffs[5 * i];
+		b15[6 * i + 1] = 0;
+		for(k = 1; k < 5; k++)
+			b15[6 * i + k + 1] = ref_biquad_coeffs[5 * i + k];
+	}
+	arm_biquad_cascade_df1_init_f32(&bqf, 2, bf, bstf);
+	arm_biquad_cascade_df1_f32(&bqf, s_xf, s_f32, REF_N);
+	test_expect("biquad_cascade_df1_f32", ref_biquad, test_f32(s_f32, REF_N), REF_N, 120.0);
+	arm_biquad_cascade_df1_init_q31(&bq31, 2, b31, bst31, 1);
+	arm_biquad_cascade_df1_q31(&bq31, s_x31, s_q31, REF_N);
+	test_expect("biquad_cascade_df1_q31", ref_biquad, test_q31(s_q31, REF_N, 31), REF_N, 145.0);
+	arm_biquad_cascade_df1_init_q15(&bq15, 2, b15, bst15, 1);
+	arm_biquad_cascade_df1_q15(&bq15, s_x15, s_q15, REF_N);
+	test_expect("biquad_cascade_df1_q15", ref_biquad, test_q15(s_q15, REF_N, 15), REF_N, 50.0);
+
+	//the filter taps in natural order against the first REF_CONV_LEN inputs
+	for(i = 0; i < REF_FIR_TAPS; i++)
+	{
+		hf[i] = ref_fir_coeffs[i] / 32768.0f;
+		h31[i] = (q31_t)ref_fir_coeffs[i] * 65536;
+		h15[i] = ref_fir_coeffs[i];
+	}
+	k = REF_CONV_LEN + REF_FIR_TAPS - 1;
+	arm_conv_f32(s_xf, REF_CONV_LEN, hf, REF_FIR_TAPS, s_f32);
+	test_expect("conv_f32", ref_conv, test_f32(s_f32, k), k, 135.0);
+	arm_conv_q31(s_x31, REF_CONV_LEN, h31, REF_FIR_TAPS, s_q31);
+	test_expect("conv_q31", ref_conv, test_q31(s_q31, k, 31), k, 250.0);
+	arm_conv_q15(s_x15, REF_CONV_LEN, h15, REF_FIR_TAPS, s_q15);
+	test_expect("conv_q15", ref_conv, test_q15(s_q15, k, 15), k, 70.0);
+}
+
+static void test_matrix(void)
+{
+	static float32_t inv[REF_MAT_DIM * REF_MAT_DIM];
+	static float64_t inv64[REF_MAT_DIM * REF_MAT_DIM], out64[REF_MAT_DIM * REF_MAT_DIM];
+	static q15_t scratch[REF_MAT_DIM * REF_MAT_DIM];
+	arm_matrix_instance_f32 af, bf, cf;
+	arm_matrix_instance_f64 a64, c64;
+	arm_matrix_instance_q31 a31, b31, c31;
+	arm_matrix_instance_q15 a15, b15, c15;
+	uint32_t n = REF_MAT_DIM, i;
+
+	arm_mat_init_f32(&af, n, n, s_xf);
+	arm_mat_init_f32(&bf, n, n, s_sf);
+	arm_mat_init_f32(&cf, n, n, s_f32);
+	CHECK(arm_mat_mult_f32(&af, &bf, &cf) == ARM_MATH_SUCCESS, "mat_mult_f32");
+	test_expect("mat_mult_f32", ref_mat_mult, test_f32(s_f32, n * n), n * n, 140.0);
+	arm_mat_init_q31(&a31, n, n, s_x31);
+	arm_mat_init_q31(&b31, n, n, s_s31);
+	arm_mat_init_q31(&c31, n, n, s_q31);
+	CHECK(arm_mat_mult_q31(&a31, &b31, &c31) == ARM_MATH_SUCCESS, "mat_mult_q31");
+	test_expect("mat_mult_q31", ref_mat_mult, test_q31(s_q31, n * n, 31), n * n, 250.0);
+	arm_mat_init_q15(&a15, n, n, s_x15);
+	arm_mat_init_q15(&b15, n, n, s_s15);
+	arm_mat_init_q15(&c15, n, n, s_q15);
+	CHECK(arm_mat_mult_q15(&a15, &b15, &c15, scratch) == ARM_MATH_SUCCESS, "mat_mult_q15");
+	test_expect("mat_mult_q15", ref_mat_mult, test_q15(s_q15, n * n, 15), n * n, 65.0);
+
+	//the inverse overwrites its source
+	for(i = 0; i < n * n; i++)
+	{
+		inv[i] = s_xf[i] + ((i % (n + 1u)) == 0 ? 4.0f : 0.0f);
+		inv64[i] = inv[i];
+	}
+	arm_mat_init_f32(&af, n, n, inv);
+	CHECK(arm_mat_inverse_f32(&af, &cf) == ARM_MATH_SUCCESS, "mat_inverse_f32");
+	test_expect("mat_inverse_f32", ref_mat_inverse, test_f32(s_f32, n * n), n * n, 140.0);
+	arm_mat_init_f64(&a64, n, n, inv64);
+	arm_mat_init_f64(&c64, n, n, out64);
+	CHECK(arm_mat_inverse_f64(&a64, &c64) == ARM_MATH_SUCCESS, "mat_inverse_f64");
+	test_expect("mat_inverse_f64", ref_mat_inverse, out64, n * n, 250.0);
+}
+
+//ref_stats: mean, variance, standard deviation, rms, power
+static void test_statistics(void)
+{
+	float32_t f;
+	q31_t v31;
+	q15_t v15;
+	q63_t acc;
+	uint32_t i;
+
+	arm_mean_f32(s_xf, REF_N, &f);
+	test_scalar("mean_f32", ref_stats[0], f, 250.0);
+	arm_mean_q31(s_x31, REF_N, &v31);
+	test_scalar("mean_q31", ref_stats[0], ldexp(v31, -31), 250.0);
+	//the mean is only a few LSB of 1.15
+	arm_mean_q15(s_x15, REF_N, &v15);
+	test_scalar("mean_q15", ref_stats[0], ldexp(v15, -15), 35.0);
+
+	arm_var_f32(s_xf, REF_N, &f);
+	test_scalar("var_f32", ref_stats[1], f, 135.0);
+	arm_var_q31(s_x31, REF_N, &v31);
+	test_scalar("var_q31", ref_stats[1], ldexp(v31, -31), 160.0);
+	arm_var_q15(s_x15, REF_N, &v15);
+	test_scalar("var_q15", ref_stats[1], ldexp(v15, -15), 75.0);
+
+	arm_std_f32(s_xf, REF_N, &f);
+	test_scalar("std_f32", ref_stats[2], f, 135.0);
+	arm_std_q31(s_x31, REF_N, &v31);
+	test_scalar("std_q31", ref_stats[2], ldexp(v31, -31), 165.0);
+	arm_std_q15(s_x15, REF_N, &v15);
+	test_scalar("std_q15", ref_stats[2], ldexp(v15, -15), 65.0);
+
+	arm_rms_f32(s_xf, REF_N, &f);
+	test_scalar("rms_f32", ref_stats[3], f, 145.0);
+	//the 2.62 accumulator has a single guard bit, the input must be scaled down
+	for(i = 0; i < REF_N; i++)
+		s_q31[i] = s_x31[i] / 8;
+	arm_rms_q31(s_q31, REF_N, &v31);
+	test_scalar("rms_q31", ref_stats[3], ldexp(v31, -28), 130.0);
+	arm_rms_q15(s_x15, REF_N, &v15);
+	test_scalar("rms_q15", ref_stats[3], ldexp(v15, -15), 65.0);
+
+	arm_power_f32(s_xf, REF_N, &f);
+	test_scalar("power_f32", ref_stats[4], f, 130.0);
+	arm_power_q31(s_x31, REF_N, &acc);
+	test_scalar("power_q31", ref_stats[4], ldexp((double)acc, -48), 250.0);
+	arm_power_q15(s_x15, REF_N, &acc);
+	test_scalar("power_q15", ref_stats[4], ldexp((double)acc, -30), 250.0);
+}
+
+//conversions of values that every format holds exactly are exact
+static void test_support(void)
+{
+	uint32_t i;
+	double ref[REF_N];
+
+	for(i = 0; i < REF_N; i++)
+		ref[i] = ref_x[i] / 32768.0;
+	arm_float_to_q31(s_xf, s_q31, REF_N);
+	test_expect("float_to_q31", ref, test_q31(s_q31, REF_N, 31), REF_N, 250.0);
+	arm_float_to_q15(s_xf, s_q15, REF_N);
+	test_expect("float_to_q15", ref, test_q15(s_q15, REF_N, 15), REF_N, 250.0);
+	arm_q31_to_float(s_x31, s_f32, REF_N);
+	test_expect("q31_to_float", ref, test_f32(s_f32, REF_N), REF_N, 250.0);
+	arm_q15_to_float(s_x15, s_f32, REF_N);
+	test_expect("q15_to_float", ref, test_f32(s_f32, REF_N), REF_N, 250.0);
+	arm_q31_to_q15(s_x31, s_q15, REF_N);
+	test_expect("q31_to_q15", ref, test_q15(s_q15, REF_N, 15), REF_N, 250.0);
+	arm_q15_to_q31(s_x15, s_q31, REF_N);
+	test_expect("q15_to_q31", ref, test_q31(s_q31, REF_N, 31), REF_N, 250.0);
+}
+
+static void test_transform(void)
+{
+	static float32_t state[REF_N];
+	arm_rfft_fast_instance_f32 rf;
+	arm_rfft_instance_f32 dct_rfft;
+	arm_cfft_radix4_instance_f32 dct_cfft;
+	arm_dct4_instance_f32 dct;
+	double ref[REF_N];
+	uint32_t i, n = 2 * REF_CFFT_LEN;
+
+	//the fixed-point FFTs scale down by the length
+	memcpy(s_f32, s_xf, sizeof(s_xf));
+	arm_cfft_f32(&arm_cfft_sR_f32_len64, s_f32, 0, 1);
+	test_expect("cfft_f32", ref_cfft, test_f32(s_f32, n), n, 135.0);
+	memcpy(s_q31, s_x31, sizeof(s_x31));
+	arm_cfft_q31(&arm_cfft_sR_q31_len64, s_q31, 0, 1);
+	test_expect("cfft_q31", ref_cfft, test_q31(s_q31, n, 31 - 6), n, 145.0);
+	memcpy(s_q15, s_x15, sizeof(s_x15));
+	arm_cfft_q15(&arm_cfft_sR_q15_len64, s_q15, 0, 1);
+	test_expect("cfft_q15", ref_cfft, test_q15(s_q15, n, 15 - 6), n, 55.0);
+
+	//packed output: bins 0 and N / 2 share the first complex slot
+	memcpy(s_f32, s_xf, sizeof(s_xf));
+	CHECK(arm_rfft_fast_init_f32(&rf, REF_N) == ARM_MATH_SUCCESS, "rfft_fast_init_f32");
+	arm_rfft_fast_f32(&rf, s_f32, s_f32b, 0);
+	ref[0] = ref_rfft[0];
+	ref[1] = ref_rfft[REF_N];
+	for(i = 2; i < REF_N; i++)
+		ref[i] = ref_rfft[i];
+	test_expect("rfft_fast_f32", ref, test_f32(s_f32b, REF_N), REF_N, 135.0);
+
+	memcpy(s_f32, s_xf, sizeof(s_xf));
+	CHECK(arm_dct4_init_f32(&dct, &dct_rfft, &dct_cfft, REF_N, REF_N / 2, 0.125f) == ARM_MATH_SUCCESS,
+	      "dct4_init_f32");
+	arm_dct4_f32(&dct, state, s_f32);
+	test_expect("dct4_f32", ref_dct4, test_f32(s_f32, REF_N), REF_N, 110.0);
+}
+
+//table positions (x + 0.5) * (REF_TABLE_LEN - 1), 12.20 in the fixed-point formats
+static void test_interpolation(void)
+{
+	static float32_t tf[REF_TABLE_LEN];
+	static q31_t t31[REF_TABLE_LEN];
+	static q15_t t15[REF_TABLE_LEN];
+	arm_linear_interp_instance_f32 lf;
+	q31_t pos;
+	uint32_t i;
+
+	for(i = 0; i < REF_TABLE_LEN; i++)
+	{
+		tf[i] = ref_table[i] / 32768.0f;
+		t31[i] = (q31_t)ref_table[i] * 65536;
+		t15[i] = ref_table[i];
+	}
+	lf.nValues = REF_TABLE_LEN;
+	lf.x1 = 0.0f;
+	lf.xSpacing = 1.0f;
+	lf.pYData = tf;
+	for(i = 0; i < REF_N; i++)
+	{
+		s_f32[i] = arm_linear_interp_f32(&lf, (s_xf[i] + 0.5f) * (REF_TABLE_LEN - 1));
+		pos = ((q31_t)s_x15[i] + 0x4000) * 2048;
+		s_q31[i] = arm_linear_interp_q31(t31, pos, REF_TABLE_LEN);
+		s_q15[i] = arm_linear_interp_q15(t15, pos, REF_TABLE_LEN);
+	}
+	test_expect("linear_interp_f32", ref_interp, test_f32(s_f32, REF_N), REF_N, 250.0);
+	test_expect("linear_interp_q31", ref_interp, test_q31(s_q31, REF_N, 31), REF_N, 170.0);
+	test_expect("linear_interp_q15", ref_interp, test_q15(s_q15, REF_N, 15), REF_N, 85.0);
+}
+
+int main(void)
+{
+	test_inputs();
+	test_basic();
+	test_complex();
+	test_controller();
+	test_fast_math();
+	test_filtering();
+	test_matrix();
+	test_statistics();
+	test_support();
+	test_transform();
+	test_interpolation();
+	return test_done("test_dsp_golden");
+}
@@ -0,0 +1,255 @@
+/*
+ * Half-precision conversions against a reference built on double rounding
+ * to nearest even, over every f16 and every f32 input, the block
+ * conversions on odd lengths, and the mixed f16 kernels against double
+ * sums of the widened operands.
+ * sources:
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_LEN        1031
+#define TEST_SUM_MAX    2.4e-7      //4 roundings of float32_t, relative to sum |a*b| of the widened operands
+#define TEST_COEF_MAX   (1.0 / 2048.0)  //rounding of the f16 coefficients relative to sum |b|*|x|
+
+static float32_t s_a[TEST_LEN], s_b[TEST_LEN], s_o[TEST_LEN];
+static float16_t s_ha[TEST_LEN], s_hb[TEST_LEN];
+
+static uint32_t test_bits(float32_t f)
+{
+	uint32_t u;
+
+	memcpy(&u, &f, sizeof(u));
+	return u;
+}
+
+static float32_t test_float(uint32_t u)
+{
+	float32_t f;
+
+	memcpy(&f, &u, sizeof(f));
+	return f;
+}
+
+//value of the binary16 bits
+static double test_h2d(float16_t h)
+{
+	uint32_t e = (h >> 10) & 0x1Fu, m = h & 0x3FFu;
+	double v;
+
+	if(e == 31u)
+		v = m ? NAN : INFINITY;
+	else if(e == 0u)
+		v = ldexp(m, -24);
+	else
+		v = ldexp(1024 + m, (int)e - 25);
+	return (h & 0x8000u) ? -v : v;
+}
+
+//binary16 bits of a finite or infinite f32, rounded to nearest even by nearbyint in double
+static float16_t test_f2h(float32_t f)
+{
+	double a = fabs((double)f), q;
+	uint32_t sign = (test_bits(f) >> 16) & 0x8000u, bits;
+	int e;
+
+	if(a >= 65520.0)
+		bits = 0x7C00u;
+	else if(a < ldexp(1.0, -14))
+		bits = (uint32_t)nearbyint(ldexp(a, 24));
+	else
+	{
+		frexp(a, &e);
+		q = nearbyint(ldexp(a, 11 - e));
+		//a carry out of the significand moves into the exponent field
+		bits = ((uint32_t)(e + 14) << 10) + (uint32_t)q - 1024u;
+	}
+	return (float16_t)(sign | bits);
+}
+
+static void test_scalar(void)
+{
+	uint32_t i, bad = 0, u;
+	uint64_t k;
+	float32_t f;
+	float16_t h;
+
+	for(i = 0; i < 65536u; i++)
+	{
+		f = arm_f16_to_f32_1((float16_t)i);
+		if((i & 0x7FFFu) > 0x7C00u)
+			bad += !isnan(f) || (test_bits(f) >> 31) != (i >> 15) || ((test_bits(f) >> 13) & 0x3FFu) != (i & 0x3FFu);
+		else
+			bad += (double)f != test_h2d((float16_t)i) || (test_bits(f) >> 31) != (i >> 15);
+	}
+	CHECK(bad == 0, "f16 to f32: %u of 65536 inputs differ", bad);
+
+	//NaNs come out quiet with the top of the payload
+	bad = 0;
+	for(k = 0; k < 0x100000000ull; k++)
+	{
+		u = (uint32_t)k;
+		f = test_float(u);
+		h = arm_f32_to_f16_1(f);
+		if(isnan(f))
+			bad += h != (float16_t)(((u >> 16) & 0x8000u) | 0x7E00u | ((u >> 13) & 0x1FFu));
+		else
+			bad += h != test_f2h(f);
+	}
+	CHECK(bad == 0, "f32 to f16: %u of 2^32 inputs differ", bad);
+}
+
+//lengths around the unrolled loops, and no write past the end
+static void test_block(void)
+{
+	static float32_t x[TEST_LEN + 1], y[TEST_LEN + 1];
+	static float16_t h[TEST_LEN + 1];
+	uint32_t n, i, bad = 0;
+
+	for(i = 0; i < TEST_LEN; i++)
+		x[i] = (float32_t)(test_uniform() * 100.0);
+	for(n = 0; n <= TEST_LEN; n += n < 20u ? 1u : 113u)
+	{
+		memset(h, 0, sizeof(h));
+		memset(y, 0, sizeof(y));
+		arm_float_to_f16(x, h, n);
+		arm_f16_to_float(h, y, n);
+		for(i = 0; i < n; i++)
+			bad += h[i] != test_f2h(x[i]) || (double)y[i] != test_h2d(h[i]);
+		bad += h[n] != 0 || y[n] != 0.0f;
+	}
+	CHECK(bad == 0, "block conversions: %u values differ", bad);
+}
+
+static void test_dot(void)
+{
+	float32_t r16, r32;
+	double s16, s32, m16, m32, e = 0;
+	uint32_t n, i, bad = 0;
+
+	for(i = 0; i < TEST_LEN; i++)
+	{
+		s_a[i] = (float32_t)(test_uniform() * 0.5);
+		s_b[i] = (float32_t)(test_uniform() * 0.5);
+	}
+	arm_float_to_f16(s_a, s_ha, TEST_LEN);
+	arm_float_to_f16(s_b, s_hb, TEST_LEN);
+	for(n = 1; n <= TEST_LEN; n += n < 20u ? 1u : 97u)
+	{
+		arm_dot_prod_f16(s_ha, s_hb, n, &r16);
+		arm_dot_prod_f16_f32(s_ha, s_b, n, &r32);
+		s16 = s32 = m16 = m32 = 0;
+		for(i = 0; i < n; i++)
+		{
+			s16 += test_h2d(s_ha[i]) * test_h2d(s_hb[i]);
+			m16 += fabs(test_h2d(s_ha[i]) * test_h2d(s_hb[i]));
+			s32 += test_h2d(s_ha[i]) * s_b[i];
+			m32 += fabs(test_h2d(s_ha[i]) * s_b[i]);
+		}
+		e = fmax(e, fmax(fabs(r16 - s16) / m16, fabs(r32 - s32) / m32));
+
+		//one rounding of an exact product
+		arm_mult_f16_f32(s_ha, s_b, s_o, n);
+		for(i = 0; i < n; i++)
+			bad += s_o[i] != (float32_t)(test_h2d(s_ha[i]) * s_b[i]);
+	}
+	printf("dot products: error %.2e of sum |ab|\n", e);
+	CHECK(e <= TEST_SUM_MAX, "dot products: error %.2e of sum |ab|", e);
+	CHECK(bad == 0, "arm_mult_f16_f32: %u products differ", bad);
+}
+
+//against the widened coefficients, and against the f32 coefficients they were rounded from
+static void test_fir(void)
+{
+	float32_t c[67], st[67 + 37], x[5 * 37], y[5 * 37];
+	float16_t hc[67];
+	arm_fir_instance_f16_f32 S;
+	double r, r32, m, m32, e = 0, e32 = 0;
+	uint32_t taps, blk, k, n;
+	int32_t j, idx;
+
+	for(taps = 1; taps <= 67; taps += taps < 9u ? 1u : 11u)
+		for(blk = 1; blk <= 37; blk += blk < 6u ? 1u : 9u)
+		{
+			n = 5u * blk;
+			for(k = 0; k < taps; k++)
+				c[k] = (float32_t)(sin(k * 0.37 + taps) / taps);
+			arm_float_to_f16(c, hc, taps);
+			arm_fir_init_f16_f32(&S, (uint16_t)taps, hc, st, blk);
+			for(k = 0; k < n; k++)
+				x[k] = (float32_t)(test_uniform() * 0.5);
+			for(k = 0; k < n; k += blk)
+				arm_fir_f16_f32(&S, x + k, y + k, blk);
+
+			for(k = 0; k < n; k++)
+			{
+				r = r32 = m = m32 = 0;
+				for(j = 0; j < (int32_t)taps; j++)
+				{
+					idx = (int32_t)k - (int32_t)taps + 1 + j;
+					if(idx < 0)
+						continue;
+					r += test_h2d(hc[j]) * x[idx];
+					m += fabs(test_h2d(hc[j]) * x[idx]);
+					r32 += (double)c[j] * x[idx];
+					m32 += fabs((double)c[j] * x[idx]);
+				}
+				if(m == 0)
+					continue;
+				e = fmax(e, fabs(y[k] - r) / m);
+				e32 = fmax(e32, fabs(y[k] - r32) / m32);
+			}
+		}
+	printf("FIR: error %.2e of sum |bx| with the widened coefficients, %.2e with the f32 coefficients\n", e, e32);
+	CHECK(e <= TEST_SUM_MAX, "FIR: error %.2e of sum |bx|", e);
+	CHECK(e32 <= TEST_COEF_MAX, "FIR: error %.2e of sum |b||x| against the f32 coefficients", e32);
+}
+
+static void test_mat_vec(void)
+{
+	static float32_t m[13 * 41], v[41], o[14];
+	static float16_t hm[13 * 41];
+	arm_matrix_instance_f16 A;
+	double s, sa, e = 0;
+	uint32_t r, c, k, j, bad = 0;
+
+	for(r = 1; r <= 13; r++)
+		for(c = 1; c <= 41; c += c < 8u ? 1u : 11u)
+		{
+			for(k = 0; k < r * c; k++)
+				m[k] = (float32_t)(test_uniform() * 0.5);
+			for(k = 0; k < c; k++)
+				v[k] = (float32_t)(test_uniform() * 0.5);
+			arm_float_to_f16(m, hm, r * c);
+			arm_mat_init_f16(&A, (uint16_t)r, (uint16_t)c, hm);
+			o[r] = 12345.0f;
+			arm_mat_vec_mult_f16_f32(&A, v, o);
+			bad += o[r] != 12345.0f;
+			for(k = 0; k < r; k++)
+			{
+				s = sa = 0;
+				for(j = 0; j < c; j++)
+				{
+					s += test_h2d(hm[k * c + j]) * v[j];
+					sa += fabs(test_h2d(hm[k * c + j]) * v[j]);
+				}
+				e = fmax(e, fabs(o[k] - s) / sa);
+			}
+		}
+	printf("mat-vec: error %.2e of sum |mv|\n", e);
+	CHECK(e <= TEST_SUM_MAX, "mat-vec: error %.2e of sum |mv|", e);
+	CHECK(bad == 0, "mat-vec: %u writes past the output", bad);
+}
+
+int main(void)
+{
+	test_scalar();
+	test_block();
+	test_dot();
+	test_fir();
+	test_mat_vec();
+	return test_done("test_f16");
+}
@@ -0,0 +1,382 @@
+/*
+ * Vector exp, log, atan2, tanh, sigmoid and square root kernels against the
+ * C library in long double: f32 over their whole range in ulp, q15 for every
+ * input and q31 on sweeps and random inputs in LSB, plus the documented
+ * values at the ends of the ranges.
+ * sources:
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include <float.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_LEN        100003u     //odd, so the tail loops run
+#define TEST_RANDOM     1000000u
+
+typedef void (*test_vec_f32)(const float32_t *, float32_t *, uint32_t);
+typedef void (*test_vec_q31)(const q31_t *, q31_t *, uint32_t);
+typedef void (*test_vec_q15)(const q15_t *, q15_t *, uint32_t);
+
+static float32_t s_x[TEST_LEN], s_y[TEST_LEN], s_z[TEST_LEN];
+static q31_t s_a[TEST_LEN], s_b[TEST_LEN], s_c[TEST_LEN];
+static q15_t s_a15[65536], s_b15[65536], s_c15[65536];
+static int16_t s_sh15[65536], s_sh[TEST_LEN];
+
+static long double test_sigmoid(long double x)
+{
+	return 1.0L / (1.0L + expl(-x));
+}
+
+static long double test_rsqrt(long double x)
+{
+	return 1.0L / sqrtl(x);
+}
+
+//the fixed-point square roots return 0 for negative inputs
+static long double test_sqrt(long double x)
+{
+	return x < 0 ? 0.0L : sqrtl(x);
+}
+
+//error of y in units in the last place of the float nearest to t
+static double test_ulp(float32_t y, long double t)
+{
+	int e;
+
+	if(fabsl(t) < FLT_MIN)
+		return fabsl(y - t) / ldexp(1.0, -149);
+	frexpl(t, &e);
+	return (double)(fabsl(y - t) / ldexpl(1.0L, e - 24));
+}
+
+//points spread linearly or logarithmically over [lo hi], run in place half of the time
+static void test_f32(const char *name, test_vec_f32 f, long double (*ref)(long double),
+                     float32_t lo, float32_t hi, int logScale, double maxUlp)
+{
+	uint32_t i;
+	double e, m = 0;
+	float32_t at = 0;
+
+	for(i = 0; i < TEST_LEN; i++)
+	{
+		e = (double)i / (TEST_LEN - 1u);
+		s_x[i] = logScale ? (float32_t)(lo * pow((double)hi / lo, e)) : (float32_t)(lo + ((double)hi - lo) * e);
+	}
+	f(s_x, s_y, TEST_LEN);
+	memcpy(s_z, s_x, sizeof(s_x));
+	f(s_z, s_z, TEST_LEN);
+	CHECK(memcmp(s_y, s_z, sizeof(s_y)) == 0, "%s [%g %g]: in place differs", name, lo, hi);
+	for(i = 0; i < TEST_LEN; i++)
+	{
+		e = test_ulp(s_y[i], ref(s_x[i]));
+		if(e > m)
+		{
+			m = e;
+			at = s_x[i];
+		}
+	}
+	printf("%-8s f32 [%10.3g %10.3g]: %.2f ulp at %g\n", name, lo, hi, m, at);
+	CHECK(m <= maxUlp, "%s [%g %g]: %.2f ulp at %g", name, lo, hi, m, at);
+}
+
+static void test_f32_ends(void)
+{
+	float32_t x[8] = { 0.0f, -1.0f, 1e-40f, -200.0f, 200.0f, -88.0f, -88.5f, 1e30f };
+	float32_t y[8];
+
+	arm_vexp_f32(x, y, 8);
+	CHECK(y[0] == 1.0f && y[3] == 0.0f, "exp of 0, -200: %g %g", y[0], y[3]);
+	CHECK(fabs(y[4] / exp(88.3762589) - 1.0) < 1e-6, "exp(200) is %g, not exp(88.38)", y[4]);
+
+	arm_vlog_f32(x, y, 8);
+	CHECK(y[0] == -FLT_MAX && y[1] == -FLT_MAX && y[2] == -FLT_MAX, "log of 0, -1, 1e-40: %g %g %g", y[0], y[1], y[2]);
+	//log10 scales the -FLT_MAX of the natural logarithm
+	arm_vlog10_f32(x, y, 8);
+	CHECK(y[0] == -FLT_MAX * 0.434294482f && y[1] == y[0], "log10 of 0, -1: %g %g", y[0], y[1]);
+
+	arm_vtanh_f32(x, y, 8);
+	CHECK(y[0] == 0.0f && y[3] == -1.0f && y[4] == 1.0f && y[7] == 1.0f, "tanh: %g %g %g", y[0], y[3], y[4]);
+
+	//denormal between -87.3 and -88.4, flushed to 0 below
+	arm_vsigmoid_f32(x, y, 8);
+	CHECK(y[0] == 0.5f && y[3] == 0.0f && y[4] == 1.0f && y[6] == 0.0f, "sigmoid: %g %g %g %g", y[0], y[3], y[4], y[6]);
+	CHECK(y[5] > 0.0f && y[5] < FLT_MIN, "sigmoid(-88) is %g", y[5]);
+
+	arm_vsqrt_f32(x, y, 8);
+	CHECK(y[0] == 0.0f && y[1] == 0.0f, "sqrt of 0, -1: %g %g", y[0], y[1]);
+	arm_vrsqrt_f32(x, y, 8);
+	CHECK(y[0] == 0.0f && y[1] == 0.0f && y[2] == 0.0f, "rsqrt of 0, -1, 1e-40: %g %g %g", y[0], y[1], y[2]);
+}
+
+//random pairs of magnitudes from 2^-60 to 2^60 and the axes, against atan2l
+static void test_atan2_f32(void)
+{
+	uint32_t i;
+	double e, m = 0;
+
+	for(i = 0; i < TEST_LEN; i++)
+	{
+		s_x[i] = (float32_t)ldexp(test_uniform(), (int)(test_rand() % 121u) - 60);
+		s_z[i] = (float32_t)ldexp(test_uniform(), (int)(test_rand() % 121u) - 60);
+		if(i % 17u == 0u)
+			s_x[i] = 0.0f;
+		if(i % 19u == 0u)
+			s_z[i] = 0.0f;
+	}
+	arm_vatan2_f32(s_x, s_z, s_y, TEST_LEN);
+	for(i = 0; i < TEST_LEN; i++)
+	{
+		e = (double)fabsl(s_y[i] - atan2l(s_x[i], s_z[i]));
+		m = fmax(m, e);
+	}
+	printf("atan2    f32: %.2e rad\n", m);
+	CHECK(m <= 2.6e-7, "atan2 f32: error %.2e rad", m);
+
+	s_x[0] = 0.0f;
+	s_z[0] = 0.0f;
+	s_x[1] = -0.0f;
+	s_z[1] = -1.0f;
+	arm_vatan2_f32(s_x, s_z, s_y, 2);
+	CHECK(s_y[0] == 0.0f && s_y[1] == (float32_t)TEST_PI, "atan2 f32 of (0, 0), (-0, -1): %g %g", s_y[0], s_y[1]);
+}
+
+//every q15 input, the result in LSB of the output format against the rounded reference
+static void test_q15(const char *name, test_vec_q15 f, long double (*ref)(long double), double inScale,
+                     double outScale, double maxLsb)
+{
+	uint32_t i;
+	double e, m = 0;
+	long double t;
+	int32_t at = 0;
+
+	for(i = 0; i < 65536u; i++)
+		s_a15[i] = (q15_t)(i - 32768u);
+	f(s_a15, s_b15, 65536u);
+	for(i = 0; i < 65536u; i++)
+	{
+		t = ref(s_a15[i] * inScale) * outScale;
+		if(t > 32767.0L)
+			t = 32767.0L;
+		if(t < -32768.0L || t != t)
+			t = -32768.0L;
+		e = (double)fabsl(s_b15[i] - t);
+		if(e > m)
+		{
+			m = e;
+			at = s_a15[i];
+		}
+	}
+	printf("%-8s q15: %.2f LSB at %d\n", name, m, at);
+	CHECK(m <= maxLsb, "%s q15: %.2f LSB at %d", name, m, at);
+}
+
+static void test_rsqrt_q15(void)
+{
+	uint32_t i, bad = 0;
+	double e, m = 0;
+
+	for(i = 0; i < 65536u; i++)
+		s_a15[i] = (q15_t)(i - 32768u);
+	arm_vrsqrt_q15(s_a15, s_b15, s_sh15, 65536u);
+	for(i = 0; i < 65536u; i++)
+	{
+		if(s_a15[i] <= 0)
+		{
+			bad += s_b15[i] != 0 || s_sh15[i] != 0;
+			continue;
+		}
+		bad += s_b15[i] < 0x4000;
+		e = fabs(s_b15[i] - 32768.0 / sqrt(s_a15[i] / 32768.0) / ldexp(1.0, s_sh15[i]));
+		m = fmax(m, e);
+	}
+	printf("rsqrt    q15: %.2f LSB of the mantissa\n", m);
+	CHECK(m <= 0.51 && bad == 0, "rsqrt q15: %.2f LSB, %u bad mantissas", m, bad);
+}
+
+static void test_atan2_q15(void)
+{
+	uint32_t i;
+	double m = 0;
+
+	for(i = 0; i < 65536u; i++)
+	{
+		s_a15[i] = (q15_t)test_rand();
+		s_c15[i] = (q15_t)(test_rand() >> (test_rand() % 16u));
+	}
+	s_a15[0] = 0;
+	s_c15[0] = 0;
+	arm_vatan2_q15(s_a15, s_c15, s_b15, 65536u);
+	CHECK(s_b15[0] == 0, "atan2 q15 (0, 0) is %d", s_b15[0]);
+	for(i = 1; i < 65536u; i++)
+		m = fmax(m, fabs(s_b15[i] - atan2(s_a15[i], s_c15[i]) * 8192.0));
+	printf("atan2    q15: %.2f LSB\n", m);
+	CHECK(m <= 1.0, "atan2 q15: %.2f LSB", m);
+}
+
+//a sweep over the whole input range and random inputs with random magnitudes
+static void test_q31(const char *name, test_vec_q31 f, long double (*ref)(long double), double inScale,
+                     double outScale, double maxLsb)
+{
+	uint32_t i, k;
+	double e, m = 0;
+	long double t;
+	q31_t at = 0;
+
+	for(k = 0; k < TEST_RANDOM / TEST_LEN + 1u; k++)
+	{
+		for(i = 0; i < TEST_LEN; i++)
+			s_a[i] = k == 0 ? (q31_t)(0x80000000u + i * (0xFFFFFFFFu / (TEST_LEN - 1u))) :
+			                  (q31_t)test_rand() >> (test_rand() % 31u);
+		f(s_a, s_b, TEST_LEN);
+		memcpy(s_c, s_a, sizeof(s_a));
+		f(s_c, s_c, TEST_LEN);
+		CHECK(memcmp(s_b, s_c, sizeof(s_b)) == 0, "%s q31: in place differs", name);
+		for(i = 0; i < TEST_LEN; i++)
+		{
+			t = ref(s_a[i] * (long double)inScale) * outScale;
+			if(t > 2147483647.0L)
+				t = 2147483647.0L;
+			if(t < -2147483648.0L || t != t)
+				t = -2147483648.0L;
+			e = (double)fabsl(s_b[i] - t);
+			if(e > m)
+			{
+				m = e;
+				at = s_a[i];
+			}
+		}
+	}
+	printf("%-8s q31: %.2f LSB at 0x%08X\n", name, m, (uint32_t)at);
+	CHECK(m <= maxLsb, "%s q31: %.2f LSB at 0x%08X", name, m, (uint32_t)at);
+}
+
+static void test_rsqrt_q31(void)
+{
+	uint32_t i, k, bad = 0;
+	double e, m = 0;
+	q31_t at = 0;
+
+	for(k = 0; k < TEST_RANDOM / TEST_LEN + 1u; k++)
+	{
+		for(i = 0; i < TEST_LEN; i++)
+			s_a[i] = k == 0 ? (q31_t)(0x80000000u + i * (0xFFFFFFFFu / (TEST_LEN - 1u))) :
+			                  (q31_t)test_rand() >> (test_rand() % 31u);
+		//powers of 4 give a mantissa of exactly 0.5, 1 the largest shift
+		if(k == 1)
+		{
+			s_a[0] = 0x20000000;
+			s_a[1] = 0x08000000;
+			s_a[2] = 1;
+			s_a[3] = 0x7FFFFFFF;
+			s_a[4] = 0;
+		}
+		arm_vrsqrt_q31(s_a, s_b, s_sh, TEST_LEN);
+		for(i = 0; i < TEST_LEN; i++)
+		{
+			if(s_a[i] <= 0)
+			{
+				bad += s_b[i] != 0 || s_sh[i] != 0;
+				continue;
+			}
+			bad += s_b[i] < 0x40000000;
+			e = (double)fabsl(s_b[i] - 2147483648.0L / sqrtl(s_a[i] / 2147483648.0L) / ldexpl(1.0L, s_sh[i]));
+			if(e > m)
+			{
+				m = e;
+				at = s_a[i];
+			}
+		}
+		if(k == 1)
+			CHECK(s_b[0] == 0x40000000 && s_sh[0] == 2 && s_b[1] == 0x40000000 && s_sh[1] == 3 && s_sh[2] == 16,
+			      "rsqrt q31 of 1/4, 1/16, 2^-31: 0x%08X 2^%d, 0x%08X 2^%d, 2^%d",
+			      (uint32_t)s_b[0], s_sh[0], (uint32_t)s_b[1], s_sh[1], s_sh[2]);
+	}
+	printf("rsqrt    q31: %.2f LSB of the mantissa at 0x%08X\n", m, (uint32_t)at);
+	CHECK(m <= 1.0 && bad == 0, "rsqrt q31: %.2f LSB, %u bad mantissas", m, bad);
+}
+
+static void test_atan2_q31(void)
+{
+	uint32_t i, k;
+	double e, m = 0;
+
+	for(k = 0; k < TEST_RANDOM / TEST_LEN; k++)
+	{
+		for(i = 0; i < TEST_LEN; i++)
+		{
+			s_a[i] = (q31_t)test_rand() >> (test_rand() % 32u);
+			s_c[i] = (q31_t)test_rand() >> (test_rand() % 32u);
+		}
+		//the axes, the diagonals and the most negative values
+		if(k == 0)
+		{
+			s_a[0] = 0;
+			s_c[0] = 0;
+			s_a[1] = 0;
+			s_c[1] = (q31_t)0x80000000;
+			s_a[2] = (q31_t)0x80000000;
+			s_c[2] = 0;
+			s_a[3] = (q31_t)0x80000000;
+			s_c[3] = (q31_t)0x80000000;
+			s_a[4] = 0x7FFFFFFF;
+			s_c[4] = (q31_t)0x80000000;
+			s_a[5] = 1;
+			s_c[5] = -1;
+			s_a[6] = 0;
+			s_c[6] = 5;
+		}
+		arm_vatan2_q31(s_a, s_c, s_b, TEST_LEN);
+		if(k == 0)
+			CHECK(s_b[0] == 0 && s_b[1] == 0x6487ED51 && s_b[6] == 0, "atan2 q31 of (0, 0), (0, -1), (0, 5): 0x%08X 0x%08X 0x%08X",
+			      (uint32_t)s_b[0], (uint32_t)s_b[1], (uint32_t)s_b[6]);
+		for(i = 0; i < TEST_LEN; i++)
+		{
+			if(s_a[i] == 0 && s_c[i] == 0)
+				continue;
+			e = (double)fabsl(s_b[i] - atan2l(s_a[i], s_c[i]) * 536870912.0L);
+			m = fmax(m, e);
+		}
+	}
+	printf("atan2    q31: %.2f LSB\n", m);
+	CHECK(m <= 1.0, "atan2 q31: %.2f LSB", m);
+}
+
+int main(void)
+{
+	test_f32("exp", arm_vexp_f32, expl, -87.3f, 88.3f, 0, 1.0);
+	test_f32("exp", arm_vexp_f32, expl, -1.0f, 1.0f, 0, 1.0);
+	test_f32("log", arm_vlog_f32, logl, 1.2e-38f, 3e38f, 1, 1.0);
+	test_f32("log", arm_vlog_f32, logl, 0.5f, 2.0f, 0, 1.0);
+	test_f32("log10", arm_vlog10_f32, log10l, 1.2e-38f, 3e38f, 1, 2.0);
+	test_f32("log10", arm_vlog10_f32, log10l, 0.5f, 2.0f, 0, 2.0);
+	test_f32("tanh", arm_vtanh_f32, tanhl, -12.0f, 12.0f, 0, 2.5);
+	test_f32("tanh", arm_vtanh_f32, tanhl, 1e-30f, 1.0f, 1, 2.5);
+	test_f32("sigmoid", arm_vsigmoid_f32, test_sigmoid, -87.3f, 30.0f, 0, 2.5);
+	test_f32("sigmoid", arm_vsigmoid_f32, test_sigmoid, -8.0f, 8.0f, 0, 2.5);
+	test_f32("sqrt", arm_vsqrt_f32, sqrtl, 1e-37f, 1e37f, 1, 0.5);
+	test_f32("rsqrt", arm_vrsqrt_f32, test_rsqrt, 1.2e-38f, 3e38f, 1, 2.5);
+	test_f32("rsqrt", arm_vrsqrt_f32, test_rsqrt, 1.0f, 4.0f, 0, 2.5);
+	test_f32_ends();
+	test_atan2_f32();
+
+	test_q15("exp", arm_vexp_q15, expl, 1.0 / 2048, 32768.0, 1.0);
+	test_q15("log", arm_vlog_q15, logl, 1.0 / 32768, 2048.0, 1.0);
+	test_q15("log10", arm_vlog10_q15, log10l, 1.0 / 32768, 4096.0, 1.0);
+	test_q15("tanh", arm_vtanh_q15, tanhl, 1.0 / 4096, 32768.0, 1.0);
+	test_q15("sigmoid", arm_vsigmoid_q15, test_sigmoid, 1.0 / 4096, 32768.0, 1.0);
+	test_q15("sqrt", arm_vsqrt_q15, test_sqrt, 1.0 / 32768, 32768.0, 1.0);
+	test_rsqrt_q15();
+	test_atan2_q15();
+
+	test_q31("exp", arm_vexp_q31, expl, 1.0 / 67108864, 2147483648.0, 2.0);
+	test_q31("log", arm_vlog_q31, logl, 1.0 / 2147483648.0, 67108864.0, 1.0);
+	test_q31("log10", arm_vlog10_q31, log10l, 1.0 / 2147483648.0, 134217728.0, 1.0);
+	test_q31("tanh", arm_vtanh_q31, tanhl, 1.0 / 268435456, 2147483648.0, 2.0);
+	test_q31("sigmoid", arm_vsigmoid_q31, test_sigmoid, 1.0 / 268435456, 2147483648.0, 2.0);
+	test_q31("sqrt", arm_vsqrt_q31, test_sqrt, 1.0 / 2147483648.0, 2147483648.0, 1.0);
+	test_rsqrt_q31();
+	test_atan2_q31();
+	return test_done("test_fast_math");
+}
@@ -0,0 +1,310 @@
+/*
+ * Block floating-point Q15/Q31 CFFT and RFFT against a DFT in double
+ * precision, without any gain fit, on full scale, quiet (-48 dBFS), tone
+ * and DC blocks, with the scaling arm_cfft_q15/q31 on the quiet blocks for
+ * comparison.
+ * sources:
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_MAX_LEN    8192u
+#define TEST_QUIET      (1.0 / 256.0)
+//SNR floors in dB at 16 points, lowered by 3 dB per doubling of the length
+#define TEST_Q15_SNR    68.0
+#define TEST_Q31_SNR    164.0
+#define TEST_SNR_STEP   3.0
+#define TEST_RFFT_LOSS  5.0         //the split into the real spectrum costs a few more dB
+
+enum { TEST_FULL, TEST_QUIET_NOISE, TEST_TONE, TEST_DC };
+static const char *s_names[] = { "full scale", "quiet", "tone", "dc" };
+
+static double s_x[2 * TEST_MAX_LEN], s_ref[2 * TEST_MAX_LEN], s_got[2 * TEST_MAX_LEN];
+static double s_cos[TEST_MAX_LEN], s_sin[TEST_MAX_LEN];
+static q15_t s_q15[2 * TEST_MAX_LEN + 2], s_o15[2 * TEST_MAX_LEN + 2];
+static q31_t s_q31[2 * TEST_MAX_LEN + 2], s_o31[2 * TEST_MAX_LEN + 2];
+
+static const arm_cfft_instance_q15 *test_cfft_q15(uint32_t n)
+{
+	switch(n)
+	{
+	case 16:   return &arm_cfft_sR_q15_len16;
+	case 32:   return &arm_cfft_sR_q15_len32;
+	case 64:   return &arm_cfft_sR_q15_len64;
+	case 128:  return &arm_cfft_sR_q15_len128;
+	case 256:  return &arm_cfft_sR_q15_len256;
+	case 512:  return &arm_cfft_sR_q15_len512;
+	case 1024: return &arm_cfft_sR_q15_len1024;
+	case 2048: return &arm_cfft_sR_q15_len2048;
+	default:   return &arm_cfft_sR_q15_len4096;
+	}
+}
+
+static const arm_cfft_instance_q31 *test_cfft_q31(uint32_t n)
+{
+	switch(n)
+	{
+	case 16:   return &arm_cfft_sR_q31_len16;
+	case 32:   return &arm_cfft_sR_q31_len32;
+	case 64:   return &arm_cfft_sR_q31_len64;
+	case 128:  return &arm_cfft_sR_q31_len128;
+	case 256:  return &arm_cfft_sR_q31_len256;
+	case 512:  return &arm_cfft_sR_q31_len512;
+	case 1024: return &arm_cfft_sR_q31_len1024;
+	case 2048: return &arm_cfft_sR_q31_len2048;
+	default:   return &arm_cfft_sR_q31_len4096;
+	}
+}
+
+//X = DFT(x) of n complex values, not scaled for the inverse
+static void test_dft(const double *x, double *X, uint32_t n, int inverse)
+{
+	double re, im, s;
+	uint32_t k, i, j;
+
+	for(i = 0; i < n; i++)
+	{
+		s_cos[i] = cos(2.0 * TEST_PI * i / n);
+		s_sin[i] = sin(2.0 * TEST_PI * i / n);
+	}
+	for(k = 0; k < n; k++)
+	{
+		re = im = 0;
+		for(i = 0, j = 0; i < n; i++, j = (j + k) % n)
+		{
+			s = inverse ? s_sin[j] : -s_sin[j];
+			re += x[2 * i] * s_cos[j] - x[2 * i + 1] * s;
+			im += x[2 * i] * s + x[2 * i + 1] * s_cos[j];
+		}
+		X[2 * k] = re;
+		X[2 * k + 1] = im;
+	}
+}
+
+//n values of the given kind, complex when step is 2
+static void test_signal(double *x, uint32_t n, uint32_t step, int kind)
+{
+	double a = kind == TEST_QUIET_NOISE ? TEST_QUIET : 0.999;
+	uint32_t i;
+
+	for(i = 0; i < n; i++)
+	{
+		switch(kind)
+		{
+		case TEST_TONE:
+			x[step * i] = a * 0.7 * cos(2.0 * TEST_PI * 5.3 * i / n);
+			if(step == 2u)
+				x[2 * i + 1] = a * 0.7 * sin(2.0 * TEST_PI * 5.3 * i / n);
+			break;
+		case TEST_DC:
+			x[step * i] = a;
+			if(step == 2u)
+				x[2 * i + 1] = -a;
+			break;
+		default:
+			x[step * i] = a * test_uniform();
+			if(step == 2u)
+				x[2 * i + 1] = a * test_uniform();
+			break;
+		}
+	}
+}
+
+//q15 and q31 copies of x, and x set to the q15 or q31 values
+static void test_quantize_q15(double *x, uint32_t n)
+{
+	uint32_t i;
+
+	for(i = 0; i < n; i++)
+	{
+		s_q15[i] = (q15_t)lrint(x[i] * 32767.0);
+		x[i] = s_q15[i] / 32768.0;
+	}
+}
+
+static void test_quantize_q31(double *x, uint32_t n)
+{
+	uint32_t i;
+
+	for(i = 0; i < n; i++)
+	{
+		s_q31[i] = (q31_t)fmax(fmin(x[i] * 2147483648.0, 2147483647.0), -2147483648.0);
+		x[i] = s_q31[i] / 2147483648.0;
+	}
+}
+
+static double test_snr_q15(const q15_t *y, uint32_t n, int32_t exp)
+{
+	uint32_t i;
+
+	for(i = 0; i < n; i++)
+		s_got[i] = ldexp(y[i] / 32768.0, exp);
+	return test_snr(s_ref, s_got, n);
+}
+
+static double test_snr_q31(const q31_t *y, uint32_t n, int32_t exp)
+{
+	uint32_t i;
+
+	for(i = 0; i < n; i++)
+		s_got[i] = ldexp(y[i] / 2147483648.0, exp);
+	return test_snr(s_ref, s_got, n);
+}
+
+static double test_floor(double snr16, uint32_t n)
+{
+	return snr16 - TEST_SNR_STEP * (log2((double)n) - 4.0);
+}
+
+static void test_cfft(uint32_t n, int kind, int inverse)
+{
+	double snr15, snr31, old15 = 0, num, den;
+	int32_t e15, e31;
+	uint32_t i;
+
+	test_signal(s_x, n, 2u, kind);
+	test_quantize_q15(s_x, 2u * n);
+	test_dft(s_x, s_ref, n, inverse);
+	CHECK(arm_cfft_bfp_q15(test_cfft_q15(n), s_q15, (uint8_t)inverse, 1, &e15) == ARM_MATH_SUCCESS,
+	      "cfft q15 %u status", n);
+	snr15 = test_snr_q15(s_q15, 2u * n, e15);
+
+	//arm_cfft_q15 with the least squares gain, which its fixed scaling leaves out
+	if(kind == TEST_QUIET_NOISE)
+	{
+		for(i = 0; i < 2u * n; i++)
+			s_q15[i] = (q15_t)lrint(s_x[i] * 32768.0);
+		arm_cfft_q15(test_cfft_q15(n), s_q15, (uint8_t)inverse, 1);
+		num = den = 0;
+		for(i = 0; i < 2u * n; i++)
+		{
+			num += s_ref[i] * s_q15[i];
+			den += (double)s_q15[i] * s_q15[i];
+		}
+		for(i = 0; i < 2u * n; i++)
+			s_got[i] = den != 0 ? s_q15[i] * num / den : 0;
+		old15 = test_snr(s_ref, s_got, 2u * n);
+	}
+
+	test_signal(s_x, n, 2u, kind);
+	test_quantize_q31(s_x, 2u * n);
+	test_dft(s_x, s_ref, n, inverse);
+	CHECK(arm_cfft_bfp_q31(test_cfft_q31(n), s_q31, (uint8_t)inverse, 1, &e31) == ARM_MATH_SUCCESS,
+	      "cfft q31 %u status", n);
+	snr31 = test_snr_q31(s_q31, 2u * n, e31);
+
+	if(kind == TEST_QUIET_NOISE)
+	{
+		printf("CFFT %4u %s: q15 %5.1f dB (arm_cfft_q15 %5.1f dB), q31 %5.1f dB\n",
+		       n, inverse ? "inverse" : "forward", snr15, old15, snr31);
+		CHECK(snr15 >= old15 + 40.0, "cfft q15 %u quiet inverse %d: SNR %.1f dB, arm_cfft_q15 %.1f dB",
+		      n, inverse, snr15, old15);
+	}
+	CHECK(snr15 >= test_floor(TEST_Q15_SNR, n), "cfft q15 %u %s inverse %d: SNR %.1f dB",
+	      n, s_names[kind], inverse, snr15);
+	CHECK(snr31 >= test_floor(TEST_Q31_SNR, n), "cfft q31 %u %s inverse %d: SNR %.1f dB",
+	      n, s_names[kind], inverse, snr31);
+}
+
+//the forward transform gives all n complex bins, the inverse takes bins 0 ... n/2 and gives n real values
+static void test_rfft(uint32_t n, int kind, int inverse)
+{
+	arm_rfft_instance_q15 R15;
+	arm_rfft_instance_q31 R31;
+	double snr15 = 0, snr31 = 0, m;
+	uint32_t i, nin = inverse ? n + 2u : n, nout = inverse ? n : 2u * n;
+	int32_t e15, e31;
+	int q31;
+
+	CHECK(arm_rfft_init_q15(&R15, n, inverse, 1) == ARM_MATH_SUCCESS, "rfft q15 init %u", n);
+	CHECK(arm_rfft_init_q31(&R31, n, inverse, 1) == ARM_MATH_SUCCESS, "rfft q31 init %u", n);
+	for(q31 = 0; q31 < 2; q31++)
+	{
+		memset(s_x, 0, sizeof(s_x));
+		if(!inverse)
+		{
+			test_signal(s_x, n, 2u, kind);
+			for(i = 0; i < n; i++)
+				s_x[2 * i + 1] = 0;
+		}
+		else
+		{
+			//the spectrum of a real signal, scaled to the level of the kind
+			test_signal(s_got, n, 2u, kind == TEST_TONE ? TEST_TONE : TEST_FULL);
+			for(i = 0; i < n; i++)
+				s_got[2 * i + 1] = 0;
+			test_dft(s_got, s_x, n, 0);
+			m = 0;
+			for(i = 0; i < nin; i++)
+				m = fmax(m, fabs(s_x[i]));
+			for(i = 0; i < nin; i++)
+				s_x[i] *= (kind == TEST_QUIET_NOISE ? TEST_QUIET : 0.999) / m;
+			s_x[1] = s_x[n + 1] = 0;
+		}
+
+		//the packed input, then the full input for the reference
+		for(i = 0; i < nin; i++)
+			s_ref[i] = s_x[inverse ? i : 2u * i];
+		if(q31)
+			test_quantize_q31(s_ref, nin);
+		else
+			test_quantize_q15(s_ref, nin);
+		for(i = 0; i < nin; i++)
+			s_x[inverse ? i : 2u * i] = s_ref[i];
+		if(inverse)
+			for(i = n / 2u + 1u; i < n; i++)
+			{
+				s_x[2 * i] = s_x[2 * (n - i)];
+				s_x[2 * i + 1] = -s_x[2 * (n - i) + 1];
+			}
+		test_dft(s_x, s_ref, n, inverse);
+		if(inverse)
+			for(i = 0; i < n; i++)
+				s_ref[i] = s_ref[2 * i];
+
+		if(q31)
+		{
+			CHECK(arm_rfft_bfp_q31(&R31, s_q31, s_o31, &e31) == ARM_MATH_SUCCESS, "rfft q31 %u status", n);
+			snr31 = test_snr_q31(s_o31, nout, e31);
+		}
+		else
+		{
+			CHECK(arm_rfft_bfp_q15(&R15, s_q15, s_o15, &e15) == ARM_MATH_SUCCESS, "rfft q15 %u status", n);
+			snr15 = test_snr_q15(s_o15, nout, e15);
+		}
+	}
+	if(kind == TEST_QUIET_NOISE && (n == 4096u || n == 32u))
+		printf("RFFT %4u %s quiet: q15 %5.1f dB, q31 %5.1f dB\n", n, inverse ? "inverse" : "forward", snr15, snr31);
+	CHECK(snr15 >= test_floor(TEST_Q15_SNR, n) - TEST_RFFT_LOSS, "rfft q15 %u %s inverse %d: SNR %.1f dB",
+	      n, s_names[kind], inverse, snr15);
+	CHECK(snr31 >= test_floor(TEST_Q31_SNR, n) - TEST_RFFT_LOSS, "rfft q31 %u %s inverse %d: SNR %.1f dB",
+	      n, s_names[kind], inverse, snr31);
+}
+
+int main(void)
+{
+	arm_cfft_instance_q15 C15 = arm_cfft_sR_q15_len16;
+	arm_cfft_instance_q31 C31 = arm_cfft_sR_q31_len16;
+	int32_t e;
+	uint32_t n;
+	int kind, inverse;
+
+	for(inverse = 0; inverse < 2; inverse++)
+		for(n = 16; n <= 4096u; n *= 2u)
+			for(kind = TEST_FULL; kind <= TEST_DC; kind++)
+				test_cfft(n, kind, inverse);
+	for(inverse = 0; inverse < 2; inverse++)
+		for(n = 32; n <= TEST_MAX_LEN; n *= 2u)
+			for(kind = TEST_FULL; kind <= TEST_TONE; kind++)
+				test_rfft(n, kind, inverse);
+
+	C15.fftLen = 8;
+	C31.fftLen = 8;
+	CHECK(arm_cfft_bfp_q15(&C15, s_q15, 0, 1, &e) == ARM_MATH_ARGUMENT_ERROR, "q15 length 8 accepted");
+	CHECK(arm_cfft_bfp_q31(&C31, s_q31, 0, 1, &e) == ARM_MATH_ARGUMENT_ERROR, "q31 length 8 accepted");
+	return test_done("test_fft_bfp");
+}
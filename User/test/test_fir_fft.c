@@ -0,0 +1,81 @@
+/*
+ * Partitioned FFT FIR filter against arm_fir_f32 on the same input, in
+ * place and with call sizes that vary between multiples of the block size.
+ * sources:
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_LEN        16384u
+#define TEST_ERR_MAX    2e-5        //relative to the peak output, float rounding of long sums
+
+static float32_t s_x[TEST_LEN], s_direct[TEST_LEN], s_fft[TEST_LEN];
+
+static void test_filter(uint32_t numTaps, uint16_t blockSize, uint16_t maxPartSize)
+{
+	float32_t *h = malloc(numTaps * sizeof(float32_t));
+	float32_t *fs = calloc(numTaps + blockSize, sizeof(float32_t)), *ss;
+	arm_fir_instance_f32 F;
+	arm_fir_fft_instance_f32 S;
+	uint32_t i, n;
+	double e = 0, m = 0;
+
+	//a decaying random response, like a measured room or cabinet impulse response
+	for(i = 0; i < numTaps; i++)
+		h[i] = (float32_t)(test_uniform() * 0.5 * exp(-(double)i / (numTaps / 3 + 1)));
+	arm_fir_init_f32(&F, numTaps, h, fs, blockSize);
+	for(i = 0; i < TEST_LEN; i += blockSize)
+		arm_fir_f32(&F, s_x + i, s_direct + i, blockSize);
+
+	//a call without a state buffer reports the length it needs
+	CHECK(arm_fir_fft_init_f32(&S, numTaps, h, NULL, 0, blockSize, maxPartSize) == ARM_MATH_LENGTH_ERROR,
+	      "%u taps: size query", numTaps);
+	ss = malloc(S.stateLen * sizeof(float32_t));
+	CHECK(arm_fir_fft_init_f32(&S, numTaps, h, ss, S.stateLen, blockSize, maxPartSize) == ARM_MATH_SUCCESS,
+	      "%u taps: init", numTaps);
+	memcpy(s_fft, s_x, sizeof(s_x));
+	for(i = 0; i < TEST_LEN; i += n)
+	{
+		n = blockSize * (1u + (i / blockSize) % 3u);
+		if(n > TEST_LEN - i)
+			n = TEST_LEN - i;
+		arm_fir_fft_f32(&S, s_fft + i, s_fft + i, n);
+	}
+
+	for(i = 0; i < TEST_LEN; i++)
+	{
+		e = fmax(e, fabs(s_direct[i] - s_fft[i]));
+		m = fmax(m, fabs(s_direct[i]));
+	}
+	printf("%5u taps, blockSize %4u, maxPartSize %4u: %u levels, state %7u words, error %.1e\n",
+	       numTaps, blockSize, maxPartSize, S.numLevels, S.stateLen, e / m);
+	CHECK(e <= TEST_ERR_MAX * m, "%u taps, blockSize %u, maxPartSize %u: error %.2e of the peak",
+	      numTaps, blockSize, maxPartSize, e / m);
+	CHECK((numTaps < ARM_FIR_FFT_DIRECT_TAPS) == (S.numLevels == 0), "%u taps: %u levels", numTaps, S.numLevels);
+	free(h);
+	free(fs);
+	free(ss);
+}
+
+int main(void)
+{
+	static const uint16_t taps[] = { 1, 64, 127, 128, 192, 384, 1024, 4096, 12000 };
+	static const uint16_t sizes[][2] = { { 16, 16 }, { 16, 64 }, { 16, 2048 }, { 64, 1024 }, { 128, 512 }, { 256, 256 } };
+	arm_fir_fft_instance_f32 S;
+	float32_t h[256];
+	uint32_t i, k;
+
+	for(i = 0; i < TEST_LEN; i++)
+		s_x[i] = (float32_t)(test_uniform() * 0.5);
+	for(i = 0; i < sizeof(taps) / sizeof(taps[0]); i++)
+		for(k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++)
+			test_filter(taps[i], sizes[k][0], sizes[k][1]);
+
+	memset(h, 0, sizeof(h));
+	CHECK(arm_fir_fft_init_f32(&S, 256, h, NULL, 0, 24, 24) == ARM_MATH_ARGUMENT_ERROR, "blockSize 24 accepted");
+	CHECK(arm_fir_fft_init_f32(&S, 256, h, NULL, 0, 64, 32) == ARM_MATH_ARGUMENT_ERROR, "maxPartSize below blockSize accepted");
+	return test_done("test_fir_fft");
+}
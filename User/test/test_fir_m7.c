@@ -0,0 +1,140 @@
+/*
+ * Cortex-M7 paths of arm_fir_q15, arm_fir_fast_q15, arm_fir_q31 and
+ * arm_fir_fast_q31 against their Cortex-M4 paths, built from the same sources
+ * by fir_m4.c. The outputs and the states must be bit exact over several tap
+ * counts, odd block sizes, unaligned buffers and saturating inputs.
+ * sources: User/test/fir_m4.c
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include <string.h>
+
+#define TEST_LEN        1000u
+#define TEST_MAX_TAPS   64u
+#define TEST_MAX_BLOCK  67u
+#define TEST_OFFSETS    4u          //element offsets of every buffer, 0 is word (q15) or doubleword (q31) aligned
+
+void arm_fir_q15_m4(const arm_fir_instance_q15 *S, q15_t *pSrc, q15_t *pDst, uint32_t blockSize);
+void arm_fir_fast_q15_m4(const arm_fir_instance_q15 *S, q15_t *pSrc, q15_t *pDst, uint32_t blockSize);
+void arm_fir_q31_m4(const arm_fir_instance_q31 *S, q31_t *pSrc, q31_t *pDst, uint32_t blockSize);
+void arm_fir_fast_q31_m4(const arm_fir_instance_q31 *S, q31_t *pSrc, q31_t *pDst, uint32_t blockSize);
+
+typedef void (*test_fir_q15_t)(const arm_fir_instance_q15 *, q15_t *, q15_t *, uint32_t);
+typedef void (*test_fir_q31_t)(const arm_fir_instance_q31 *, q31_t *, q31_t *, uint32_t);
+
+typedef enum
+{
+	TEST_RANDOM = 0,        //full-scale input, coefficients scaled so the sum cannot overflow
+	TEST_SATURATE           //runs of full-scale samples, into full-scale coefficients for q15 and into
+	                        //coefficients scaled by the tap count for q31, whose 2.62 sum does not saturate
+} test_signal_t;
+
+static const uint32_t s_blocks[] = { 1, 3, 7, 13, 5, 31, 67, 9 };
+
+static uint64_t s_h[TEST_MAX_TAPS + TEST_OFFSETS];
+static uint64_t s_st[2][TEST_MAX_TAPS + TEST_MAX_BLOCK + TEST_OFFSETS];
+static uint64_t s_x[TEST_LEN + TEST_OFFSETS];
+static uint64_t s_y[2][TEST_LEN + TEST_OFFSETS];
+
+static q31_t test_sample(test_signal_t sig, uint32_t n)
+{
+	if(sig == TEST_SATURATE)
+		return ((n / 40u) & 1u) ? (q31_t)0x80000000 : 0x7FFFFFFF;
+	return (q31_t)test_rand();
+}
+
+//both paths run the same sequence of odd block sizes, the outputs and the final states are compared
+static void test_q15(const char *name, test_fir_q15_t m7, test_fir_q15_t m4, uint16_t numTaps, uint32_t off,
+                     test_signal_t sig)
+{
+	q15_t *h = (q15_t *)s_h + off, *x = (q15_t *)s_x + off;
+	q15_t *st[2] = { (q15_t *)s_st[0] + off, (q15_t *)s_st[1] + off };
+	q15_t *y[2] = { (q15_t *)s_y[0] + off, (q15_t *)s_y[1] + off };
+	arm_fir_instance_q15 S[2];
+	uint32_t i, n, k;
+	int32_t sat = 0;
+
+	for(i = 0; i < numTaps; i++)
+		h[i] = sig == TEST_SATURATE ? 0x7FFF : (q15_t)((q15_t)(test_rand() >> 16) / numTaps);
+	for(i = 0; i < TEST_LEN; i++)
+		x[i] = (q15_t)(test_sample(sig, i) >> 16);
+	for(k = 0; k < 2; k++)
+		CHECK(arm_fir_init_q15(&S[k], numTaps, h, st[k], TEST_MAX_BLOCK) == ARM_MATH_SUCCESS, "%s init", name);
+
+	for(i = 0, k = 0; i < TEST_LEN; i += n, k++)
+	{
+		n = s_blocks[k % (sizeof(s_blocks) / sizeof(s_blocks[0]))];
+		if(n > TEST_LEN - i)
+			n = TEST_LEN - i;
+		m7(&S[0], x + i, y[0] + i, n);
+		m4(&S[1], x + i, y[1] + i, n);
+	}
+	for(i = 0; i < TEST_LEN; i++)
+		sat += y[0][i] == 0x7FFF || y[0][i] == -0x8000;
+
+	CHECK(memcmp(y[0], y[1], TEST_LEN * sizeof(q15_t)) == 0, "%s, %u taps, offset %u: outputs differ",
+	      name, numTaps, off);
+	CHECK(memcmp(st[0], st[1], (numTaps - 1u) * sizeof(q15_t)) == 0, "%s, %u taps, offset %u: states differ",
+	      name, numTaps, off);
+	if(sig == TEST_SATURATE)
+		CHECK(sat > (int32_t)(TEST_LEN / 2), "%s, %u taps: only %d saturated outputs", name, numTaps, sat);
+}
+
+static void test_q31(const char *name, test_fir_q31_t m7, test_fir_q31_t m4, uint16_t numTaps, uint32_t off,
+                     test_signal_t sig)
+{
+	q31_t *h = (q31_t *)s_h + off, *x = (q31_t *)s_x + off;
+	q31_t *st[2] = { (q31_t *)s_st[0] + off, (q31_t *)s_st[1] + off };
+	q31_t *y[2] = { (q31_t *)s_y[0] + off, (q31_t *)s_y[1] + off };
+	arm_fir_instance_q31 S[2];
+	uint32_t i, n, k;
+
+	for(i = 0; i < numTaps; i++)
+		h[i] = (sig == TEST_SATURATE ? 0x7FFFFFFF : (q31_t)test_rand()) / (q31_t)numTaps;
+	for(i = 0; i < TEST_LEN; i++)
+		x[i] = test_sample(sig, i);
+	for(k = 0; k < 2; k++)
+		arm_fir_init_q31(&S[k], numTaps, h, st[k], TEST_MAX_BLOCK);
+
+	for(i = 0, k = 0; i < TEST_LEN; i += n, k++)
+	{
+		n = s_blocks[k % (sizeof(s_blocks) / sizeof(s_blocks[0]))];
+		if(n > TEST_LEN - i)
+			n = TEST_LEN - i;
+		m7(&S[0], x + i, y[0] + i, n);
+		m4(&S[1], x + i, y[1] + i, n);
+	}
+	CHECK(memcmp(y[0], y[1], TEST_LEN * sizeof(q31_t)) == 0, "%s, %u taps, offset %u: outputs differ",
+	      name, numTaps, off);
+	CHECK(memcmp(st[0], st[1], (numTaps - 1u) * sizeof(q31_t)) == 0, "%s, %u taps, offset %u: states differ",
+	      name, numTaps, off);
+}
+
+int main(void)
+{
+	//every remainder of the unrolled tap loops, q15 needs an even count of at least 4
+	static const uint16_t taps15[] = { 4, 6, 8, 10, 12, 14, 16, 18, 30, 32, 62, 64 };
+	static const uint16_t taps31[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 13, 16, 31, 32, 33, 63, 64 };
+	uint32_t i, off, runs = 0;
+
+	for(off = 0; off < TEST_OFFSETS; off++)
+	{
+		for(i = 0; i < sizeof(taps15) / sizeof(taps15[0]); i++)
+		{
+			test_q15("fir q15", arm_fir_q15, arm_fir_q15_m4, taps15[i], off, TEST_RANDOM);
+			test_q15("fir q15", arm_fir_q15, arm_fir_q15_m4, taps15[i], off, TEST_SATURATE);
+			test_q15("fir fast q15", arm_fir_fast_q15, arm_fir_fast_q15_m4, taps15[i], off, TEST_RANDOM);
+			runs += 3;
+		}
+		for(i = 0; i < sizeof(taps31) / sizeof(taps31[0]); i++)
+		{
+			test_q31("fir q31", arm_fir_q31, arm_fir_q31_m4, taps31[i], off, TEST_RANDOM);
+			test_q31("fir q31", arm_fir_q31, arm_fir_q31_m4, taps31[i], off, TEST_SATURATE);
+			test_q31("fir fast q31", arm_fir_fast_q31, arm_fir_fast_q31_m4, taps31[i], off, TEST_RANDOM);
+			runs += 3;
+		}
+	}
+	printf("%u filter runs of %u samples compared\n", runs, TEST_LEN);
+	return test_done("test_fir_m7");
+}
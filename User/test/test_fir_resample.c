@@ -0,0 +1,138 @@
+/*
+ * Polyphase L/M resampler against upsampling, filtering and downsampling
+ * in double precision, fed in random block lengths.
+ * sources:
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include <stdlib.h>
+
+#define TEST_IN         3000
+#define TEST_MAX_BLOCK  37
+#define TEST_MAX_OUT    (TEST_IN * 4 + 1)       //the largest ratio is 4/1
+
+static double s_ref[TEST_MAX_OUT];
+static float32_t s_x[TEST_IN], s_y[TEST_MAX_OUT];
+static q31_t s_x31[TEST_IN], s_y31[TEST_MAX_OUT];
+static q15_t s_x15[TEST_IN], s_y15[TEST_MAX_OUT];
+
+//h in natural order, the resampler takes it time reversed
+static uint32_t test_reference(const float32_t *h, uint32_t numTaps, uint32_t L, uint32_t M)
+{
+	uint32_t n = 0, k;
+	uint64_t t, u;
+	double s;
+
+	for(t = 0; t / L < TEST_IN; t += M)
+	{
+		s = 0;
+		for(k = 0; k < numTaps && k <= t; k++)
+		{
+			u = t - k;
+			if(u % L == 0)
+				s += h[k] * (double)s_x[u / L];
+		}
+		s_ref[n++] = s;
+	}
+	return n;
+}
+
+static void test_ratio(uint32_t L, uint32_t M, uint32_t phaseLength)
+{
+	uint32_t numTaps = L * phaseLength, i, k, b, n, lo, nref, o = 0, o31 = 0, o15 = 0, bad_count = 0;
+	float32_t *h = malloc(numTaps * sizeof(float32_t)), *hr = malloc(numTaps * sizeof(float32_t));
+	q31_t *h31 = malloc(numTaps * sizeof(q31_t));
+	q15_t *h15 = malloc(numTaps * sizeof(q15_t));
+	float32_t *st = malloc((phaseLength + TEST_MAX_BLOCK) * sizeof(float32_t));
+	q31_t *st31 = malloc((phaseLength + TEST_MAX_BLOCK) * sizeof(q31_t));
+	q15_t *st15 = malloc((phaseLength + TEST_MAX_BLOCK) * sizeof(q15_t));
+	arm_fir_resample_instance_f32 S;
+	arm_fir_resample_instance_q31 S31;
+	arm_fir_resample_instance_q15 S15;
+	double e = 0, e31 = 0, e15 = 0;
+
+	//random taps with a gain of at most 1 per phase, inputs below 0.5
+	for(k = 0; k < numTaps; k++)
+		h[k] = (float32_t)((int32_t)(test_rand() >> 21) - 1024) / 1024.0f / phaseLength;
+	for(k = 0; k < numTaps; k++)
+	{
+		hr[k] = h[numTaps - 1u - k];
+		h31[k] = (q31_t)(hr[k] * 2147483648.0);
+		h15[k] = (q15_t)(hr[k] * 32768.0f);
+	}
+	for(i = 0; i < TEST_IN; i++)
+	{
+		s_x[i] = (float32_t)((int32_t)(test_rand() >> 21) - 1024) / 1024.0f * 0.5f;
+		s_x31[i] = (q31_t)(s_x[i] * 2147483648.0);
+		s_x15[i] = (q15_t)(s_x[i] * 32768.0f);
+	}
+	nref = test_reference(h, numTaps, L, M);
+
+	CHECK(arm_fir_resample_init_f32(&S, L, M, numTaps, hr, st, TEST_MAX_BLOCK) == ARM_MATH_SUCCESS, "init f32");
+	CHECK(arm_fir_resample_init_q31(&S31, L, M, numTaps, h31, st31, TEST_MAX_BLOCK) == ARM_MATH_SUCCESS, "init q31");
+	CHECK(arm_fir_resample_init_q15(&S15, L, M, numTaps, h15, st15, TEST_MAX_BLOCK) == ARM_MATH_SUCCESS, "init q15");
+	for(i = 0; i < TEST_IN; i += b)
+	{
+		b = test_rand() % (TEST_MAX_BLOCK + 1u);
+		if(b > TEST_IN - i)
+			b = TEST_IN - i;
+		//every call writes floor or ceil of b * L / M outputs
+		n = arm_fir_resample_f32(&S, s_x + i, s_y + o, b);
+		lo = b * L / M;
+		bad_count += n < lo || n > lo + 1u;
+		o += n;
+		o31 += arm_fir_resample_q31(&S31, s_x31 + i, s_y31 + o31, b);
+		o15 += arm_fir_resample_q15(&S15, s_x15 + i, s_y15 + o15, b);
+	}
+	CHECK(bad_count == 0, "L %u M %u: %u calls with a wrong output count", L, M, bad_count);
+	CHECK(o == nref && o31 == nref && o15 == nref, "L %u M %u: %u, %u, %u outputs, expected %u",
+	      L, M, o, o31, o15, nref);
+	if(o == nref && o31 == nref && o15 == nref)
+	{
+		for(k = 0; k < nref; k++)
+		{
+			e = fmax(e, fabs(s_y[k] - s_ref[k]));
+			e31 = fmax(e31, fabs(s_y31[k] / 2147483648.0 - s_ref[k]));
+			e15 = fmax(e15, fabs(s_y15[k] / 32768.0 - s_ref[k]));
+		}
+		printf("L %3u M %3u taps %4u: %5u outputs, max error f32 %.1e q31 %.1e q15 %.1e\n",
+		       L, M, numTaps, nref, e, e31, e15);
+		CHECK(e < 1e-5, "L %u M %u: f32 error %.2e", L, M, e);
+		CHECK(e31 < 1e-6 * phaseLength + 1e-8, "L %u M %u: q31 error %.2e", L, M, e31);
+		CHECK(e15 < (phaseLength + 1u) * 4e-5, "L %u M %u: q15 error %.2e", L, M, e15);
+	}
+	free(h);
+	free(hr);
+	free(h31);
+	free(h15);
+	free(st);
+	free(st31);
+	free(st15);
+}
+
+static void test_init_errors(void)
+{
+	static float32_t h[12], st[12 + TEST_MAX_BLOCK];
+	arm_fir_resample_instance_f32 S;
+
+	CHECK(arm_fir_resample_init_f32(&S, 0, 2, 12, h, st, TEST_MAX_BLOCK) == ARM_MATH_ARGUMENT_ERROR, "L of 0");
+	CHECK(arm_fir_resample_init_f32(&S, 3, 0, 12, h, st, TEST_MAX_BLOCK) == ARM_MATH_ARGUMENT_ERROR, "M of 0");
+	CHECK(arm_fir_resample_init_f32(&S, 5, 2, 12, h, st, TEST_MAX_BLOCK) == ARM_MATH_LENGTH_ERROR,
+	      "numTaps not a multiple of L");
+}
+
+int main(void)
+{
+	static const uint16_t ratio[][2] =
+	{
+		{ 1, 1 }, { 2, 1 }, { 1, 2 }, { 3, 2 }, { 2, 3 }, { 147, 160 },
+		{ 160, 147 }, { 5, 7 }, { 7, 5 }, { 1, 6 }, { 4, 1 }, { 3, 7 }
+	};
+	uint32_t i;
+
+	for(i = 0; i < sizeof(ratio) / sizeof(ratio[0]); i++)
+		test_ratio(ratio[i][0], ratio[i][1], 1u + i % 9u);
+	test_init_errors();
+	return test_done("test_fir_resample");
+}
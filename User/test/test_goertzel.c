@@ -0,0 +1,216 @@
+/*
+ * Goertzel banks against a DFT in double precision, up to 32768-sample
+ * blocks with bins next to DC and N/2, and the sliding DFT against the
+ * DFT of its window and arm_rfft_fast_f32.
+ * sources:
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_BINS       10
+#define TEST_FRAMES     2
+#define TEST_MAX_PIECE  97
+#define TEST_EPS        5.96e-8     //rounding of float32_t
+#define TEST_F32_MAX    16.0        //error in roundings of |X| + norm(x), times sqrt(N) like a direct sum
+#define TEST_RFFT_MAX   2e-6        //error relative to the norm of the block
+#define TEST_Q31_MAX    4.0         //error in LSB, after the 2^-outShift of the output
+
+//X = sum x[n] * exp(-j*2*pi*k*n/N), k need not be an integer
+static void test_dft(const double *x, uint32_t n, double k, double *re, double *im)
+{
+	double a = 0, b = 0, w;
+	uint32_t i;
+
+	for(i = 0; i < n; i++)
+	{
+		w = -2.0 * TEST_PI * k * i / n;
+		a += x[i] * cos(w);
+		b += x[i] * sin(w);
+	}
+	*re = a;
+	*im = b;
+}
+
+//dc adds an offset, which makes the states of the bins next to DC grow the most
+static void test_block(uint32_t n, double dc)
+{
+	float32_t bins[TEST_BINS] = { 0.0f, 0.25f, 1.0f, 2.5f, 17.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+	float32_t cf[7 * TEST_BINS], sf[2 * TEST_BINS], of[2 * TEST_BINS * TEST_FRAMES];
+	q31_t cq[6 * TEST_BINS], oq[2 * TEST_BINS * TEST_FRAMES];
+	q63_t sq[2 * TEST_BINS];
+	uint32_t len = n * TEST_FRAMES, i, b, f, k, pos, frames, frames_q;
+	float32_t *x = malloc(len * sizeof(float32_t));
+	q31_t *xq = malloc(len * sizeof(q31_t));
+	double *xd = malloc(n * sizeof(double)), re, im, norm, e, ef = 0, eq = 0, scale;
+	arm_goertzel_instance_f32 S;
+	arm_goertzel_instance_q31 Q;
+
+	bins[5] = (float32_t)n / 4.0f + 0.5f;
+	bins[6] = (float32_t)n / 2.0f - 2.5f;
+	bins[7] = (float32_t)n / 2.0f - 1.0f;
+	bins[8] = (float32_t)n / 2.0f - 0.25f;
+	bins[9] = (float32_t)n / 2.0f;
+
+	//q31 input exactly representable in float, so both see the same samples
+	for(i = 0; i < len; i++)
+	{
+		xq[i] = (q31_t)((dc + test_uniform() * (0.95 - fabs(dc))) * 8388608.0) * 256;
+		x[i] = (float32_t)(xq[i] / 2147483648.0);
+	}
+
+	CHECK(arm_goertzel_init_f32(&S, TEST_BINS, n, bins, cf, sf) == ARM_MATH_SUCCESS, "init f32 %u", n);
+	CHECK(arm_goertzel_init_q31(&Q, TEST_BINS, n, bins, cq, sq) == ARM_MATH_SUCCESS, "init q31 %u", n);
+
+	//pieces of random length, so blocks end inside a call
+	frames = frames_q = 0;
+	for(pos = 0; pos < len; pos += k)
+	{
+		k = 1u + test_rand() % TEST_MAX_PIECE;
+		if(k > len - pos)
+			k = len - pos;
+		frames += arm_goertzel_f32(&S, x + pos, of + 2u * TEST_BINS * frames, k);
+		frames_q += arm_goertzel_q31(&Q, xq + pos, oq + 2u * TEST_BINS * frames_q, k);
+	}
+	CHECK(frames == TEST_FRAMES && frames_q == TEST_FRAMES, "N %u: %u and %u blocks", n, frames, frames_q);
+
+	scale = 2147483648.0 / (double)(1u << Q.outShift);
+	for(f = 0; f < TEST_FRAMES; f++)
+	{
+		norm = 0;
+		for(i = 0; i < n; i++)
+		{
+			xd[i] = x[f * n + i];
+			norm += xd[i] * xd[i];
+		}
+		norm = sqrt(norm);
+		for(b = 0; b < TEST_BINS; b++)
+		{
+			test_dft(xd, n, bins[b], &re, &im);
+			e = hypot(of[2u * (TEST_BINS * f + b)] - re, of[2u * (TEST_BINS * f + b) + 1u] - im) /
+			    ((hypot(re, im) + norm) * sqrt(n) * TEST_EPS);
+			CHECK(e <= TEST_F32_MAX, "f32 N %u dc %.1f bin %.2f: error %.2e", n, dc, bins[b], e);
+			ef = fmax(ef, e);
+			e = hypot(oq[2u * (TEST_BINS * f + b)] - re * scale, oq[2u * (TEST_BINS * f + b) + 1u] - im * scale);
+			CHECK(e <= TEST_Q31_MAX, "q31 N %u dc %.1f bin %.2f: error %.2e", n, dc, bins[b], e);
+			eq = fmax(eq, e);
+		}
+	}
+	printf("N %5u dc %.1f: f32 error %4.1f sqrt(N) roundings, q31 error %.1f LSB\n", n, dc, ef, eq);
+	free(x);
+	free(xq);
+	free(xd);
+}
+
+//integer bins against arm_rfft_fast_f32 of the same block, which packs X[N/2] into the imaginary part of X[0]
+static void test_rfft(uint32_t n)
+{
+	float32_t bins[4] = { 0.0f, 1.0f, 100.0f, (float32_t)n / 2.0f - 1.0f };
+	float32_t cf[28], sf[8], out[8], *x = malloc(n * sizeof(float32_t)), *y = malloc(n * sizeof(float32_t));
+	arm_goertzel_instance_f32 S;
+	arm_rfft_fast_instance_f32 R;
+	double e = 0, norm = 0;
+	uint32_t i, k;
+
+	for(i = 0; i < n; i++)
+	{
+		x[i] = (float32_t)(test_uniform() * 0.5);
+		norm += (double)x[i] * x[i];
+	}
+	arm_goertzel_init_f32(&S, 4, n, bins, cf, sf);
+	CHECK(arm_goertzel_f32(&S, x, out, n) == 1u, "rfft N %u: no block", n);
+	arm_rfft_fast_init_f32(&R, (uint16_t)n);
+	arm_rfft_fast_f32(&R, x, y, 0);
+	for(i = 0; i < 4; i++)
+	{
+		k = (uint32_t)bins[i];
+		e = fmax(e, fabs(out[2 * i] - y[2 * k]));
+		if(k != 0)
+			e = fmax(e, fabs(out[2 * i + 1] - y[2 * k + 1]));
+	}
+	e /= sqrt(norm);
+	printf("N %5u: Goertzel against arm_rfft_fast_f32 %.1e of the norm\n", n, e);
+	CHECK(e <= TEST_RFFT_MAX, "rfft N %u: error %.2e", n, e);
+	free(x);
+	free(y);
+}
+
+//the bins after every piece against the damped DFT of the last N samples, and for r = 1 the window's FFT
+static void test_sdft(float32_t r)
+{
+	static const uint16_t bins[5] = { 0, 1, 5, 64, 127 };
+	float32_t c[10], st[10], dl[256], o[10], y[256], win[256];
+	uint32_t n = 256, len = 5000, pos, k, b, m;
+	float32_t *x = malloc(len * sizeof(float32_t));
+	arm_sdft_instance_f32 D;
+	arm_rfft_fast_instance_f32 R;
+	double a, im, g, w, e = 0, ef = 0;
+
+	for(pos = 0; pos < len; pos++)
+		x[pos] = (float32_t)(sin(0.1 * pos) * 0.5 + test_uniform() * 0.4);
+	CHECK(arm_sdft_init_f32(&D, 5, n, bins, r, c, st, dl) == ARM_MATH_SUCCESS, "sdft init");
+	arm_rfft_fast_init_f32(&R, (uint16_t)n);
+	for(pos = 0; pos < len; pos += k)
+	{
+		k = 1u + test_rand() % 61u;
+		if(k > len - pos)
+			k = len - pos;
+		arm_sdft_f32(&D, x + pos, o, k);
+		if(pos + k < n)
+			continue;
+		for(b = 0; b < 5; b++)
+		{
+			a = im = 0;
+			for(m = 0; m < n; m++)
+			{
+				g = pow(r, n - m) * x[pos + k - n + m];
+				w = 2.0 * TEST_PI * bins[b] * m / n;
+				a += g * cos(w);
+				im -= g * sin(w);
+			}
+			e = fmax(e, hypot(a - o[2 * b], im - o[2 * b + 1]) / n);
+		}
+		if(r == 1.0f)
+		{
+			//arm_rfft_fast_f32 overwrites its input
+			memcpy(win, x + pos + k - n, sizeof(win));
+			arm_rfft_fast_f32(&R, win, y, 0);
+			for(b = 1; b < 5; b++)
+				ef = fmax(ef, hypot(y[2 * bins[b]] - o[2 * b], y[2 * bins[b] + 1] - o[2 * b + 1]) / n);
+			ef = fmax(ef, fabs(y[0] - o[0]) / n);
+		}
+	}
+	printf("sdft r %.4f: error %.1e of N against the DFT", r, e);
+	if(r == 1.0f)
+		printf(", %.1e against arm_rfft_fast_f32", ef);
+	printf("\n");
+	CHECK(e <= 1e-5, "sdft r %f: error %.2e", r, e);
+	CHECK(ef <= 1e-5, "sdft r %f: error %.2e against the FFT", r, ef);
+	free(x);
+}
+
+int main(void)
+{
+	static const uint16_t len[] = { 7, 205, 1024, 4096, 32768 };
+	float32_t bin = 1.0f;
+	q31_t cq[6];
+	q63_t sq[2];
+	arm_goertzel_instance_q31 Q;
+	uint32_t i;
+
+	for(i = 0; i < sizeof(len) / sizeof(len[0]); i++)
+	{
+		test_block(len[i], 0.0);
+		test_block(len[i], 0.5);
+	}
+	test_rfft(1024);
+	test_rfft(4096);
+	test_sdft(1.0f);
+	test_sdft(0.9999f);
+
+	CHECK(arm_goertzel_init_q31(&Q, 1, 65536, &bin, cq, sq) == ARM_MATH_ARGUMENT_ERROR, "q31 block of 65536 accepted");
+	CHECK(arm_goertzel_init_q31(&Q, 0, 64, &bin, cq, sq) == ARM_MATH_ARGUMENT_ERROR, "q31 bank of 0 bins accepted");
+	return test_done("test_goertzel");
+}
@@ -0,0 +1,242 @@
+/*
+ * Partitioned frequency-domain block LMS against arm_lms_norm_f32 on a
+ * 1024-tap echo path with -40 dB noise: steady-state misalignment and ERLE
+ * on white input, convergence speed on AR(1) input, preloaded coefficients
+ * and the init errors.
+ * sources:
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_TAPS       1024
+#define TEST_LEN        (512 * 384)
+#define TEST_BLOCK      512
+#define TEST_EARLY      24576       //end of the early ERLE window on AR(1) input
+#define TEST_MIS_SLACK  1.0         //dB of misalignment and ERLE above NLMS allowed for a fully constrained filter
+#define TEST_ALT_SLACK  6.0         //the same with one constrained partition per block, which loses ~4 dB at mu 1
+
+static float32_t s_x[TEST_LEN], s_d[TEST_LEN], s_o[TEST_LEN], s_e[TEST_LEN], s_h[TEST_TAPS];
+static float32_t s_state[200000], s_nstate[TEST_TAPS + TEST_BLOCK], s_ncoeffs[TEST_TAPS], s_t[8192], s_w[8192];
+
+static double test_gauss(void)
+{
+	double u = ((double)test_rand() + 0.5) / 4294967296.0, v = ((double)test_rand() + 0.5) / 4294967296.0;
+
+	return sqrt(-2.0 * log(u)) * cos(2.0 * TEST_PI * v);
+}
+
+//a decaying random echo path of unit energy, white or AR(1) 0.95 input, and the echo plus -40 dB noise
+static void test_signals(int colored)
+{
+	double s = 0, a;
+	uint32_t i, k;
+
+	test_srand(1);
+	for(i = 0; i < TEST_TAPS; i++)
+	{
+		s_h[i] = (float32_t)(test_gauss() * exp(-(double)i / 200.0));
+		s += (double)s_h[i] * s_h[i];
+	}
+	for(i = 0; i < TEST_TAPS; i++)
+		s_h[i] = (float32_t)(s_h[i] / sqrt(s));
+	s = 0;
+	for(i = 0; i < TEST_LEN; i++)
+	{
+		s = colored ? 0.95 * s + 0.3 * test_gauss() : test_gauss();
+		s_x[i] = (float32_t)s;
+	}
+	for(i = 0; i < TEST_LEN; i++)
+	{
+		a = 0;
+		for(k = 0; k < TEST_TAPS && k <= i; k++)
+			a += (double)s_h[k] * s_x[i - k];
+		s_d[i] = (float32_t)(a + 1e-2 * test_gauss());
+	}
+}
+
+static double test_mis(const double *h)
+{
+	double n = 0, hh = 0;
+	uint32_t j;
+
+	for(j = 0; j < TEST_TAPS; j++)
+	{
+		n += (h[j] - s_h[j]) * (h[j] - s_h[j]);
+		hh += (double)s_h[j] * s_h[j];
+	}
+	return 10.0 * log10(n / hh);
+}
+
+//the filter in the time domain, the first P values of the inverse FFT of every partition
+static double test_mis_fd(arm_lms_fd_instance_f32 *S)
+{
+	static double h[TEST_TAPS];
+	uint32_t p = S->blockSize, k, j;
+
+	for(k = 0; k < S->numParts; k++)
+	{
+		memcpy(s_t, S->pCoeffs + 2u * p * k, 2u * p * sizeof(float32_t));
+		arm_rfft_fast_f32(&S->rfft, s_t, s_w, 1);
+		for(j = 0; j < p && k * p + j < TEST_TAPS; j++)
+			h[k * p + j] = s_w[j];
+	}
+	return test_mis(h);
+}
+
+//arm_lms_norm_f32 keeps its coefficients time reversed
+static double test_mis_nlms(void)
+{
+	static double h[TEST_TAPS];
+	uint32_t j;
+
+	for(j = 0; j < TEST_TAPS; j++)
+		h[j] = s_ncoeffs[TEST_TAPS - 1 - j];
+	return test_mis(h);
+}
+
+//ERLE in dB, error power over echo power, of samples [from, to)
+static double test_erle(uint32_t from, uint32_t to)
+{
+	double se = 0, sd = 0;
+	uint32_t i;
+
+	for(i = from; i < to; i++)
+	{
+		se += (double)s_e[i] * s_e[i];
+		sd += (double)s_d[i] * s_d[i];
+	}
+	return 10.0 * log10(se / sd);
+}
+
+static void test_nlms(float32_t mu, double *mis, double *early, double *late)
+{
+	arm_lms_norm_instance_f32 N;
+	uint32_t i;
+
+	memset(s_ncoeffs, 0, sizeof(s_ncoeffs));
+	arm_lms_norm_init_f32(&N, TEST_TAPS, s_ncoeffs, s_nstate, mu, TEST_BLOCK);
+	for(i = 0; i < TEST_LEN; i += TEST_BLOCK)
+		arm_lms_norm_f32(&N, s_x + i, s_d + i, s_o + i, s_e + i, TEST_BLOCK);
+	*mis = test_mis_nlms();
+	*early = test_erle(TEST_EARLY - 8192, TEST_EARLY);
+	*late = test_erle(TEST_LEN - TEST_LEN / 8, TEST_LEN);
+}
+
+//con 0 constrains one partition per block, 1 all of them
+static void test_fd(uint16_t p, float32_t mu, int con, double *mis, double *early, double *late)
+{
+	arm_lms_fd_instance_f32 S;
+	uint16_t numConstrain;
+	uint32_t i;
+
+	CHECK(arm_lms_fd_init_f32(&S, TEST_TAPS, NULL, s_state, 0, p, mu, 0) == ARM_MATH_LENGTH_ERROR, "P %u: size query", p);
+	numConstrain = con ? S.numParts : 1;
+	CHECK(arm_lms_fd_init_f32(&S, TEST_TAPS, NULL, s_state, sizeof(s_state) / sizeof(s_state[0]), p, mu, numConstrain) ==
+	      ARM_MATH_SUCCESS, "P %u: init", p);
+	//calls of several blocks at once
+	for(i = 0; i < TEST_LEN; i += 2u * TEST_BLOCK)
+		arm_lms_fd_f32(&S, s_x + i, s_d + i, s_o + i, s_e + i, 2u * TEST_BLOCK);
+	*mis = test_mis_fd(&S);
+	*early = test_erle(TEST_EARLY - 8192, TEST_EARLY);
+	*late = test_erle(TEST_LEN - TEST_LEN / 8, TEST_LEN);
+}
+
+static void test_white(void)
+{
+	double nm, ne, nl, m, e, l;
+	float32_t mu;
+	uint16_t p;
+	int con;
+
+	test_signals(0);
+	for(mu = 0.25f; mu <= 1.0f; mu *= 2.0f)
+	{
+		test_nlms(mu, &nm, &ne, &nl);
+		printf("white mu %.2f: NLMS misalignment %5.1f dB, ERLE %5.1f dB\n", mu, nm, nl);
+		for(p = 64; p <= 256; p *= 2)
+			for(con = 0; con <= 1; con++)
+			{
+				test_fd(p, mu, con, &m, &e, &l);
+				printf("  P %3u %-11s misalignment %5.1f dB, ERLE %5.1f dB\n", p, con ? "constrained" : "alternating", m, l);
+				CHECK(m <= nm + (con ? TEST_MIS_SLACK : TEST_ALT_SLACK),
+				      "white mu %.2f P %u constrain %d: misalignment %.1f dB, NLMS %.1f dB", mu, p, con, m, nm);
+				CHECK(l <= nl + (con ? TEST_MIS_SLACK : TEST_ALT_SLACK),
+				      "white mu %.2f P %u constrain %d: ERLE %.1f dB, NLMS %.1f dB", mu, p, con, l, nl);
+			}
+	}
+}
+
+//the normalization per bin converges much faster than NLMS on coloured input
+static void test_colored(void)
+{
+	double nm, ne, nl, m, e, l;
+	uint16_t p;
+
+	test_signals(1);
+	test_nlms(0.5f, &nm, &ne, &nl);
+	printf("AR(1) mu 0.50: NLMS ERLE %5.1f dB before %u samples, %5.1f dB at the end\n", ne, TEST_EARLY, nl);
+	for(p = 64; p <= 256; p *= 2)
+	{
+		test_fd(p, 0.5f, 0, &m, &e, &l);
+		printf("  P %3u alternating: ERLE %5.1f dB before %u samples, %5.1f dB at the end\n", p, e, TEST_EARLY, l);
+		CHECK(e <= -35.0 && e <= ne - 10.0, "AR(1) P %u: early ERLE %.1f dB, NLMS %.1f dB", p, e, ne);
+	}
+}
+
+//the exact filter given at init cancels the echo from the first block
+static void test_preload(void)
+{
+	static float32_t h[300], hr[300], x[4096], d[4096], o[4096], e[4096];
+	arm_lms_fd_instance_f32 S;
+	double se = 0, sd = 0, a;
+	uint32_t i, k;
+
+	for(i = 0; i < 300; i++)
+	{
+		h[i] = (float32_t)(sin(i * 0.37) * exp(-(double)i / 60.0));
+		hr[299 - i] = h[i];
+	}
+	for(i = 0; i < 4096; i++)
+		x[i] = (float32_t)(sin(i * 0.1) + 0.5 * sin(i * 1.3 + i * i * 1e-4));
+	for(i = 0; i < 4096; i++)
+	{
+		a = 0;
+		for(k = 0; k < 300 && k <= i; k++)
+			a += (double)h[k] * x[i - k];
+		d[i] = (float32_t)a;
+	}
+	CHECK(arm_lms_fd_init_f32(&S, 300, hr, s_state, sizeof(s_state) / sizeof(s_state[0]), 32, 0.5f, 1) == ARM_MATH_SUCCESS,
+	      "preload init");
+	arm_lms_fd_f32(&S, x, d, o, e, 4096);
+	for(i = 0; i < 4096; i++)
+	{
+		se += (double)e[i] * e[i];
+		sd += (double)d[i] * d[i];
+	}
+	printf("preloaded coefficients: error %.1f dB of the echo\n", 10.0 * log10(se / sd));
+	CHECK(10.0 * log10(se / sd) <= -60.0, "preloaded coefficients: error %.1f dB of the echo", 10.0 * log10(se / sd));
+}
+
+static void test_errors(void)
+{
+	arm_lms_fd_instance_f32 S;
+
+	CHECK(arm_lms_fd_init_f32(&S, 300, NULL, s_state, 0, 24, 0.5f, 1) == ARM_MATH_ARGUMENT_ERROR, "block of 24 accepted");
+	CHECK(arm_lms_fd_init_f32(&S, 0, NULL, s_state, 0, 32, 0.5f, 1) == ARM_MATH_ARGUMENT_ERROR, "0 taps accepted");
+	CHECK(arm_lms_fd_init_f32(&S, 300, NULL, s_state, 0, 32, 0.5f, 11) == ARM_MATH_ARGUMENT_ERROR,
+	      "11 constrained partitions of 10 accepted");
+	CHECK(arm_lms_fd_init_f32(&S, 300, NULL, s_state, 0, 32, 0.5f, 10) == ARM_MATH_LENGTH_ERROR, "size query");
+	CHECK(S.stateLen == (4u * 10u + 9u) * 32u + 1u, "state of %u words for 10 partitions of 32", S.stateLen);
+}
+
+int main(void)
+{
+	test_white();
+	test_colored();
+	test_preload();
+	test_errors();
+	return test_done("test_lms_fd");
+}
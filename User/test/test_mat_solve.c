@@ -0,0 +1,466 @@
+/*
+ * f64 multiply and the f32/f64 Cholesky, LDL^T, QR and triangular solves
+ * against residuals accumulated in long double: the products and the
+ * factorizations rebuilt, A*X - B of the solves and A^T*(A*X - B) of the
+ * least-squares solve, each relative to the rounding of its precision.
+ * sources:
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_CASES      300
+#define TEST_MAX_N      40
+#define TEST_MAX_MUL    70
+#define TEST_EPS_F32    5.96e-8
+#define TEST_EPS_F64    1.11e-16
+#define TEST_ERR_MAX    4.0         //error in roundings times the length of the sums
+
+typedef arm_status (*test_fact_f32)(const arm_matrix_instance_f32 *, arm_matrix_instance_f32 *);
+typedef arm_status (*test_fact_f64)(const arm_matrix_instance_f64 *, arm_matrix_instance_f64 *);
+typedef arm_status (*test_solve_f32)(const arm_matrix_instance_f32 *, const arm_matrix_instance_f32 *, arm_matrix_instance_f32 *);
+typedef arm_status (*test_solve_f64)(const arm_matrix_instance_f64 *, const arm_matrix_instance_f64 *, arm_matrix_instance_f64 *);
+
+static double s_worst[2][7];
+static const char *s_names[7] = { "mult", "cholesky", "ldlt", "qr", "cholesky_solve", "ldlt_solve", "triangular" };
+
+static void test_random(double *x, uint32_t n)
+{
+	uint32_t i;
+
+	for(i = 0; i < n; i++)
+		x[i] = test_uniform();
+}
+
+//f32 inputs are the double values rounded, so the residuals are of what the function saw
+static void test_round(double *x, uint32_t n, int f32)
+{
+	uint32_t i;
+
+	if(f32)
+		for(i = 0; i < n; i++)
+			x[i] = (float32_t)x[i];
+}
+
+static double test_norm(const double *x, uint32_t n)
+{
+	long double s = 0;
+	uint32_t i;
+
+	for(i = 0; i < n; i++)
+		s += (long double)x[i] * x[i];
+	return sqrt((double)s);
+}
+
+//C = A * B in long double, or A^T * B when transA
+static void test_mul(const double *A, const double *B, double *C, uint32_t m, uint32_t k, uint32_t n, int transA)
+{
+	long double s;
+	uint32_t i, j, l;
+
+	for(i = 0; i < m; i++)
+		for(j = 0; j < n; j++)
+		{
+			s = 0;
+			for(l = 0; l < k; l++)
+				s += (long double)(transA ? A[l * m + i] : A[i * k + l]) * B[l * n + j];
+			C[i * n + j] = (double)s;
+		}
+}
+
+//the worst error in roundings over the cases, checked against the limit
+static void test_record(int f32, uint32_t what, double e, uint32_t n, uint32_t len)
+{
+	e /= (f32 ? TEST_EPS_F32 : TEST_EPS_F64) * len;
+	CHECK(e <= TEST_ERR_MAX, "%s %s n %u: error %.2f roundings", s_names[what], f32 ? "f32" : "f64", n, e);
+	s_worst[f32][what] = fmax(s_worst[f32][what], e);
+}
+
+static arm_status test_fact(int f32, test_fact_f32 f, test_fact_f64 d, uint32_t n, const double *A, double *L)
+{
+	arm_matrix_instance_f32 sf, df;
+	arm_matrix_instance_f64 sd, dd;
+	float32_t *a, *l;
+	arm_status st;
+	uint32_t i;
+
+	if(!f32)
+	{
+		arm_mat_init_f64(&sd, n, n, (float64_t *)A);
+		arm_mat_init_f64(&dd, n, n, L);
+		return d(&sd, &dd);
+	}
+	a = malloc(n * n * sizeof(float32_t));
+	l = malloc(n * n * sizeof(float32_t));
+	for(i = 0; i < n * n; i++)
+		a[i] = (float32_t)A[i];
+	arm_mat_init_f32(&sf, n, n, a);
+	arm_mat_init_f32(&df, n, n, l);
+	st = f(&sf, &df);
+	for(i = 0; i < n * n; i++)
+		L[i] = l[i];
+	free(a);
+	free(l);
+	return st;
+}
+
+static arm_status test_solve(int f32, test_solve_f32 f, test_solve_f64 d, uint32_t n, uint32_t p,
+                             const double *L, const double *B, double *X)
+{
+	arm_matrix_instance_f32 lf, bf, xf;
+	arm_matrix_instance_f64 ld, bd, xd;
+	float32_t *l, *b;
+	arm_status st;
+	uint32_t i;
+
+	if(!f32)
+	{
+		arm_mat_init_f64(&ld, n, n, (float64_t *)L);
+		arm_mat_init_f64(&bd, n, p, (float64_t *)B);
+		arm_mat_init_f64(&xd, n, p, X);
+		return d(&ld, &bd, &xd);
+	}
+	//f32 solves run in place
+	l = malloc(n * n * sizeof(float32_t));
+	b = malloc(n * p * sizeof(float32_t));
+	for(i = 0; i < n * n; i++)
+		l[i] = (float32_t)L[i];
+	for(i = 0; i < n * p; i++)
+		b[i] = (float32_t)B[i];
+	arm_mat_init_f32(&lf, n, n, l);
+	arm_mat_init_f32(&bf, n, p, b);
+	arm_mat_init_f32(&xf, n, p, b);
+	st = f(&lf, &bf, &xf);
+	for(i = 0; i < n * p; i++)
+		X[i] = b[i];
+	free(l);
+	free(b);
+	return st;
+}
+
+//|A*X - B| / (|A| |X| + |B|), the backward error of a solve
+static double test_backward(const double *A, const double *X, const double *B, uint32_t n, uint32_t p)
+{
+	double *R = malloc(n * p * sizeof(double)), e;
+	uint32_t i;
+
+	test_mul(A, X, R, n, n, p, 0);
+	for(i = 0; i < n * p; i++)
+		R[i] -= B[i];
+	e = test_norm(R, n * p) / (test_norm(A, n * n) * test_norm(X, n * p) + test_norm(B, n * p));
+	free(R);
+	return e;
+}
+
+static void test_mult(uint32_t m, uint32_t k, uint32_t n)
+{
+	double *A = malloc(m * k * sizeof(double)), *B = malloc(k * n * sizeof(double));
+	double *C = malloc(m * n * sizeof(double)), *R = malloc(m * n * sizeof(double)), *Aa, *Ba, *Ra, e = 0;
+	arm_matrix_instance_f64 a, b, c;
+	uint32_t i;
+
+	test_random(A, m * k);
+	test_random(B, k * n);
+	arm_mat_init_f64(&a, m, k, A);
+	arm_mat_init_f64(&b, k, n, B);
+	arm_mat_init_f64(&c, m, n, C);
+	CHECK(arm_mat_mult_f64(&a, &b, &c) == ARM_MATH_SUCCESS, "mult %ux%ux%u", m, k, n);
+	test_mul(A, B, R, m, k, n, 0);
+
+	//elementwise against |A| * |B|, which bounds the rounding of every sum
+	Aa = malloc(m * k * sizeof(double));
+	Ba = malloc(k * n * sizeof(double));
+	Ra = malloc(m * n * sizeof(double));
+	for(i = 0; i < m * k; i++)
+		Aa[i] = fabs(A[i]);
+	for(i = 0; i < k * n; i++)
+		Ba[i] = fabs(B[i]);
+	test_mul(Aa, Ba, Ra, m, k, n, 0);
+	for(i = 0; i < m * n; i++)
+		e = fmax(e, fabs(C[i] - R[i]) / Ra[i]);
+	test_record(0, 0, e, m, k);
+	free(A);
+	free(B);
+	free(C);
+	free(R);
+	free(Aa);
+	free(Ba);
+	free(Ra);
+}
+
+//SPD A = G*G^T + n*I, and a symmetric indefinite one for LDL^T
+static void test_spd(int f32, uint32_t n, uint32_t p)
+{
+	double *G = malloc(n * n * sizeof(double)), *A = malloc(n * n * sizeof(double)), *S = malloc(n * n * sizeof(double));
+	double *L = malloc(n * n * sizeof(double)), *D = malloc(n * n * sizeof(double)), *U = malloc(n * n * sizeof(double));
+	double *R = malloc(n * n * sizeof(double)), *B = malloc(n * p * sizeof(double)), *X = malloc(n * p * sizeof(double));
+	double e, nrm;
+	uint32_t i, j, k, bad = 0;
+
+	test_random(G, n * n);
+	test_mul(G, G, A, n, n, n, 1);
+	for(i = 0; i < n; i++)
+		for(j = 0; j <= i; j++)
+		{
+			A[i * n + j] = A[j * n + i] = A[j * n + i] + (i == j ? n : 0);
+			S[i * n + j] = S[j * n + i] = G[i * n + j] + G[j * n + i] + (i == j ? (i & 1u ? -2.0 * n : 2.0 * n) : 0.0);
+		}
+	test_round(A, n * n, f32);
+	test_round(S, n * n, f32);
+	test_random(B, n * p);
+	test_round(B, n * p, f32);
+	nrm = test_norm(A, n * n);
+
+	//Cholesky: L * L^T, with the upper triangle cleared
+	CHECK(test_fact(f32, arm_mat_cholesky_f32, arm_mat_cholesky_f64, n, A, L) == ARM_MATH_SUCCESS, "cholesky n %u", n);
+	for(i = 0; i < n; i++)
+		for(j = i + 1u; j < n; j++)
+			bad += L[i * n + j] != 0.0;
+	CHECK(bad == 0, "cholesky n %u: %u values above the diagonal", n, bad);
+	for(i = 0; i < n; i++)
+		for(j = 0; j < n; j++)
+			U[i * n + j] = L[j * n + i];
+	test_mul(L, U, R, n, n, n, 0);
+	for(i = 0; i < n * n; i++)
+		R[i] -= A[i];
+	test_record(f32, 1, test_norm(R, n * n) / nrm, n, n);
+
+	//in place gives the same factor
+	if(!f32)
+	{
+		arm_matrix_instance_f64 s;
+
+		memcpy(R, A, n * n * sizeof(double));
+		arm_mat_init_f64(&s, n, n, R);
+		arm_mat_cholesky_f64(&s, &s);
+		CHECK(memcmp(R, L, n * n * sizeof(double)) == 0, "cholesky n %u: in place differs", n);
+	}
+
+	CHECK(test_solve(f32, arm_mat_cholesky_solve_f32, arm_mat_cholesky_solve_f64, n, p, L, B, X) == ARM_MATH_SUCCESS,
+	      "cholesky_solve n %u", n);
+	test_record(f32, 4, test_backward(A, X, B, n, p), n, n);
+
+	//triangular solves with L and L^T
+	CHECK(test_solve(f32, arm_mat_solve_lower_triangular_f32, arm_mat_solve_lower_triangular_f64, n, p, L, B, X) ==
+	      ARM_MATH_SUCCESS, "lower triangular n %u", n);
+	e = test_backward(L, X, B, n, p);
+	CHECK(test_solve(f32, arm_mat_solve_upper_triangular_f32, arm_mat_solve_upper_triangular_f64, n, p, U, B, X) ==
+	      ARM_MATH_SUCCESS, "upper triangular n %u", n);
+	test_record(f32, 6, fmax(e, test_backward(U, X, B, n, p)), n, n);
+
+	//LDL^T of the SPD and of the indefinite matrix: L with a unit diagonal times D times L^T
+	for(k = 0; k < 2; k++)
+	{
+		const double *M = k ? S : A;
+
+		CHECK(test_fact(f32, arm_mat_ldlt_f32, arm_mat_ldlt_f64, n, M, D) == ARM_MATH_SUCCESS, "ldlt n %u", n);
+		for(i = 0; i < n; i++)
+			for(j = 0; j < n; j++)
+			{
+				L[i * n + j] = j < i ? D[i * n + j] : (i == j ? 1.0 : 0.0);
+				U[j * n + i] = L[i * n + j] * D[j * n + j];
+			}
+		test_mul(L, U, R, n, n, n, 0);
+		for(i = 0; i < n * n; i++)
+			R[i] -= M[i];
+		test_record(f32, 2, test_norm(R, n * n) / test_norm(M, n * n), n, n);
+
+		CHECK(test_solve(f32, arm_mat_ldlt_solve_f32, arm_mat_ldlt_solve_f64, n, p, D, B, X) == ARM_MATH_SUCCESS,
+		      "ldlt_solve n %u", n);
+		test_record(f32, 5, test_backward(M, X, B, n, p), n, n);
+	}
+	free(G);
+	free(A);
+	free(S);
+	free(L);
+	free(D);
+	free(U);
+	free(R);
+	free(B);
+	free(X);
+}
+
+//QR of an m x n matrix: Q*R rebuilt from the Householder vectors, and A^T*(A*X - B) of the least-squares solve
+static void test_qr(int f32, uint32_t m, uint32_t n, uint32_t p)
+{
+	double *A = malloc(m * n * sizeof(double)), *F = malloc(m * n * sizeof(double)), *Q = malloc(m * n * sizeof(double));
+	double *B = malloc(m * p * sizeof(double)), *X = malloc(n * p * sizeof(double)), *Rs = malloc(m * p * sizeof(double));
+	double *G = malloc(n * p * sizeof(double)), tau[TEST_MAX_N], nrm, e;
+	long double w;
+	uint32_t i, j, c;
+	arm_status st;
+
+	test_random(A, m * n);
+	test_round(A, m * n, f32);
+	test_random(B, m * p);
+	test_round(B, m * p, f32);
+	nrm = test_norm(A, m * n);
+
+	if(f32)
+	{
+		float32_t *a = malloc(m * n * sizeof(float32_t)), *b = malloc(m * p * sizeof(float32_t));
+		float32_t *x = malloc(n * p * sizeof(float32_t)), *s = malloc(m * sizeof(float32_t)), t[TEST_MAX_N];
+		arm_matrix_instance_f32 sa, sb, sx;
+
+		for(i = 0; i < m * n; i++)
+			a[i] = (float32_t)A[i];
+		for(i = 0; i < m * p; i++)
+			b[i] = (float32_t)B[i];
+		arm_mat_init_f32(&sa, m, n, a);
+		arm_mat_init_f32(&sb, m, p, b);
+		arm_mat_init_f32(&sx, n, p, x);
+		CHECK(arm_mat_qr_f32(&sa, &sa, t) == ARM_MATH_SUCCESS, "qr f32 %ux%u", m, n);
+		st = arm_mat_qr_solve_f32(&sa, t, &sb, &sx, s);
+		for(i = 0; i < m * n; i++)
+			F[i] = a[i];
+		for(i = 0; i < n; i++)
+			tau[i] = t[i];
+		for(i = 0; i < n * p; i++)
+			X[i] = x[i];
+		free(a);
+		free(b);
+		free(x);
+		free(s);
+	}
+	else
+	{
+		double *s = malloc(m * sizeof(double));
+		arm_matrix_instance_f64 sa, sf, sb, sx;
+
+		arm_mat_init_f64(&sa, m, n, A);
+		arm_mat_init_f64(&sf, m, n, F);
+		arm_mat_init_f64(&sb, m, p, B);
+		arm_mat_init_f64(&sx, n, p, X);
+		CHECK(arm_mat_qr_f64(&sa, &sf, tau) == ARM_MATH_SUCCESS, "qr f64 %ux%u", m, n);
+		st = arm_mat_qr_solve_f64(&sf, tau, &sb, &sx, s);
+		free(s);
+	}
+	CHECK(st == ARM_MATH_SUCCESS, "qr_solve %s %ux%u", f32 ? "f32" : "f64", m, n);
+
+	//Q*R = H(0) * ... * H(n-1) * R, H(j) = I - tau(j) * v * v^T with v(j) = 1 and v below it in column j
+	for(i = 0; i < m; i++)
+		for(c = 0; c < n; c++)
+			Q[i * n + c] = c >= i ? F[i * n + c] : 0.0;
+	for(j = n; j-- > 0; )
+		for(c = 0; c < n; c++)
+		{
+			w = Q[j * n + c];
+			for(i = j + 1u; i < m; i++)
+				w += (long double)F[i * n + j] * Q[i * n + c];
+			w *= tau[j];
+			Q[j * n + c] -= (double)w;
+			for(i = j + 1u; i < m; i++)
+				Q[i * n + c] -= (double)(w * F[i * n + j]);
+		}
+	for(i = 0; i < m * n; i++)
+		Q[i] -= A[i];
+	test_record(f32, 3, test_norm(Q, m * n) / nrm, m, m);
+
+	//the residual of a least-squares solution is orthogonal to the columns of A
+	test_mul(A, X, Rs, m, n, p, 0);
+	for(i = 0; i < m * p; i++)
+		Rs[i] -= B[i];
+	test_mul(A, Rs, G, n, m, p, 1);
+	e = test_norm(G, n * p) / (nrm * (nrm * test_norm(X, n * p) + test_norm(B, m * p)));
+	test_record(f32, 3, e, m, m);
+	free(A);
+	free(F);
+	free(Q);
+	free(B);
+	free(X);
+	free(Rs);
+	free(G);
+}
+
+static void test_errors(void)
+{
+	float64_t A[4] = { 1, 2, 2, 1 }, Z[4] = { 0, 1, 1, 0 }, L[4];
+	float64_t Q[6] = { 1, 0, 2, 0, 3, 0 }, tau[2], B[3] = { 1, 2, 3 }, X[2], s[3];
+	arm_matrix_instance_f64 a, z, l, q, b, x;
+
+	arm_mat_init_f64(&a, 2, 2, A);
+	arm_mat_init_f64(&z, 2, 2, Z);
+	arm_mat_init_f64(&l, 2, 2, L);
+	CHECK(arm_mat_cholesky_f64(&a, &l) == ARM_MATH_SINGULAR, "indefinite matrix accepted by cholesky");
+	CHECK(arm_mat_ldlt_f64(&a, &l) == ARM_MATH_SUCCESS && L[0] == 1.0 && L[3] == -3.0,
+	      "ldlt of an indefinite matrix: D %g %g", L[0], L[3]);
+	CHECK(arm_mat_ldlt_f64(&z, &l) == ARM_MATH_SINGULAR, "zero pivot accepted by ldlt");
+
+	//a zero column leaves a zero on the diagonal of R
+	arm_mat_init_f64(&q, 3, 2, Q);
+	arm_mat_init_f64(&b, 3, 1, B);
+	arm_mat_init_f64(&x, 2, 1, X);
+	arm_mat_qr_f64(&q, &q, tau);
+	CHECK(arm_mat_qr_solve_f64(&q, tau, &b, &x, s) == ARM_MATH_SINGULAR, "rank deficient matrix accepted by qr_solve");
+}
+
+//x of ones from the Hilbert matrix: from n = 8 the Cholesky solve beats the inverse times b
+static void test_hilbert(uint32_t n)
+{
+	double *H = malloc(n * n * sizeof(double)), *L = malloc(n * n * sizeof(double)), *I = malloc(n * n * sizeof(double));
+	double *b = malloc(n * sizeof(double)), *x = malloc(n * sizeof(double)), *y = malloc(n * sizeof(double)), e = 0, ei = 0;
+	arm_matrix_instance_f64 h, l, mb, mx, mi;
+	uint32_t i, j;
+
+	for(i = 0; i < n; i++)
+		for(j = 0; j < n; j++)
+			H[i * n + j] = 1.0 / (i + j + 1u);
+	for(i = 0; i < n; i++)
+		x[i] = 1.0;
+	test_mul(H, x, b, n, n, 1, 0);
+
+	arm_mat_init_f64(&h, n, n, H);
+	arm_mat_init_f64(&l, n, n, L);
+	arm_mat_init_f64(&mb, n, 1, b);
+	arm_mat_init_f64(&mx, n, 1, x);
+	arm_mat_init_f64(&mi, n, n, I);
+	CHECK(arm_mat_cholesky_f64(&h, &l) == ARM_MATH_SUCCESS, "hilbert n %u: cholesky", n);
+	arm_mat_cholesky_solve_f64(&l, &mb, &mx);
+	arm_mat_inverse_f64(&h, &mi);
+	test_mul(I, b, y, n, n, 1, 0);
+	for(i = 0; i < n; i++)
+	{
+		e = fmax(e, fabs(x[i] - 1.0));
+		ei = fmax(ei, fabs(y[i] - 1.0));
+	}
+	printf("hilbert n %2u: cholesky solve error %.1e, inverse times b %.1e\n", n, e, ei);
+	CHECK(n < 8u || e <= ei, "hilbert n %u: cholesky solve error %.2e above the inverse's %.2e", n, e, ei);
+	free(H);
+	free(L);
+	free(I);
+	free(b);
+	free(x);
+	free(y);
+}
+
+int main(void)
+{
+	uint32_t t, n, m, p, k;
+	int f32;
+
+	for(t = 0; t < TEST_CASES; t++)
+	{
+		test_mult(1u + test_rand() % TEST_MAX_MUL, 1u + test_rand() % TEST_MAX_MUL, 1u + test_rand() % TEST_MAX_MUL);
+		n = 1u + test_rand() % TEST_MAX_N;
+		p = 1u + test_rand() % 5u;
+		m = n + test_rand() % 20u;
+		for(f32 = 0; f32 < 2; f32++)
+		{
+			test_spd(f32, n, p);
+			test_qr(f32, m, n, p);
+		}
+	}
+	for(f32 = 0; f32 < 2; f32++)
+	{
+		printf("%s worst in roundings times length:", f32 ? "f32" : "f64");
+		for(k = f32; k < 7; k++)
+			printf(" %s %.2f", s_names[k], s_worst[f32][k]);
+		printf("\n");
+	}
+	test_errors();
+	for(n = 4; n <= 12; n += 4)
+		test_hilbert(n);
+	return test_done("test_mat_solve");
+}
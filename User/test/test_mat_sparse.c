@@ -0,0 +1,197 @@
+/*
+ * Dense, CSR and banded matrix products over random shapes and densities:
+ * f32 against double sums, q31 and q15 bit exact against the truncated
+ * 64-bit sums of the same operands, and the CSR length and band errors.
+ * sources:
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_SHAPES     300
+#define TEST_MAX_DIM    70
+#define TEST_MAX_P      13
+#define TEST_F32_MAX    1e-6        //relative to sum |a*b|, float rounding of up to 70 terms
+
+static float32_t s_a[TEST_MAX_DIM * TEST_MAX_DIM], s_b[TEST_MAX_DIM * TEST_MAX_P], s_v[TEST_MAX_DIM];
+static q31_t s_a31[TEST_MAX_DIM * TEST_MAX_DIM], s_b31[TEST_MAX_DIM * TEST_MAX_P], s_v31[TEST_MAX_DIM];
+static q15_t s_a15[TEST_MAX_DIM * TEST_MAX_DIM], s_b15[TEST_MAX_DIM * TEST_MAX_P], s_v15[TEST_MAX_DIM];
+static float32_t s_y[TEST_MAX_DIM * TEST_MAX_P], s_cd[TEST_MAX_DIM * TEST_MAX_DIM], s_bd[TEST_MAX_DIM * (2 * TEST_MAX_DIM + 1) + 1];
+static q31_t s_y31[TEST_MAX_DIM * TEST_MAX_P], s_cd31[TEST_MAX_DIM * TEST_MAX_DIM], s_bd31[TEST_MAX_DIM * (2 * TEST_MAX_DIM + 1)];
+static q15_t s_y15[TEST_MAX_DIM * TEST_MAX_P], s_cd15[TEST_MAX_DIM * TEST_MAX_DIM], s_bd15[TEST_MAX_DIM * (2 * TEST_MAX_DIM + 1)];
+static uint32_t s_rp[TEST_MAX_DIM + 1], s_rp31[TEST_MAX_DIM + 1], s_rp15[TEST_MAX_DIM + 1];
+static uint16_t s_ci[TEST_MAX_DIM * TEST_MAX_DIM], s_ci31[TEST_MAX_DIM * TEST_MAX_DIM], s_ci15[TEST_MAX_DIM * TEST_MAX_DIM];
+
+static double s_err;
+static uint32_t s_bad31, s_bad15, s_outside;
+
+//the m x p products of A with b, b31 and b15 of p columns in s_y, s_y31 and s_y15
+static void test_check(uint32_t m, uint32_t n, uint32_t p, const float32_t *b, const q31_t *b31, const q15_t *b15)
+{
+	double s, sa;
+	q63_t s31, s15;
+	uint32_t i, j, k;
+
+	for(i = 0; i < m; i++)
+		for(k = 0; k < p; k++)
+		{
+			s = sa = 0;
+			s31 = s15 = 0;
+			for(j = 0; j < n; j++)
+			{
+				s += (double)s_a[i * n + j] * b[j * p + k];
+				sa += fabs((double)s_a[i * n + j] * b[j * p + k]);
+				s31 += (q63_t)s_a31[i * n + j] * b31[j * p + k];
+				s15 += (q31_t)s_a15[i * n + j] * b15[j * p + k];
+			}
+			s_err = fmax(s_err, sa > 0 ? fabs(s_y[i * p + k] - s) / sa : fabs(s_y[i * p + k]));
+			s_bad31 += s_y31[i * p + k] != clip_q63_to_q31(s31 >> 31);
+			s_bad15 += s_y15[i * p + k] != (q15_t)__SSAT(s15 >> 15, 16);
+		}
+}
+
+//a random m x n matrix of the given density in percent, zero outside the band when kl is not negative,
+//scaled by 1/(n+1) in the fixed-point types so that the sums stay in range, an n x p matrix and a vector
+static uint32_t test_operands(uint32_t m, uint32_t n, uint32_t p, uint32_t dens, int32_t kl, int32_t ku)
+{
+	double sc = 1.0 / (n + 1u);
+	uint32_t i, j, nnz = 0;
+	float32_t v;
+
+	for(i = 0; i < m; i++)
+		for(j = 0; j < n; j++)
+		{
+			v = test_rand() % 100u < dens ? (float32_t)test_uniform() : 0.0f;
+			if(kl >= 0 && ((int32_t)j < (int32_t)i - kl || (int32_t)j > (int32_t)i + ku))
+				v = 0.0f;
+			nnz += v != 0.0f;
+			s_a[i * n + j] = v;
+			s_a31[i * n + j] = (q31_t)(v * sc * 2147483647.0);
+			s_a15[i * n + j] = (q15_t)(v * sc * 32767.0);
+		}
+	for(i = 0; i < n * p; i++)
+	{
+		s_b[i] = (float32_t)test_uniform();
+		s_b31[i] = (q31_t)(s_b[i] * 2147483647.0);
+		s_b15[i] = (q15_t)(s_b[i] * 32767.0);
+	}
+	for(j = 0; j < n; j++)
+	{
+		s_v[j] = (float32_t)test_uniform();
+		s_v31[j] = (q31_t)(s_v[j] * 2147483647.0);
+		s_v15[j] = (q15_t)(s_v[j] * 32767.0);
+	}
+	return nnz;
+}
+
+//band storage of a banded matrix; for any other matrix only the status, random band widths
+static uint32_t test_band(uint32_t m, uint32_t n, int32_t kl, int32_t ku)
+{
+	arm_matrix_instance_f32 A = { (uint16_t)m, (uint16_t)n, s_a };
+	arm_matrix_instance_q31 A31 = { (uint16_t)m, (uint16_t)n, s_a31 };
+	arm_matrix_instance_q15 A15 = { (uint16_t)m, (uint16_t)n, s_a15 };
+	arm_matrix_band_instance_f32 D;
+	arm_matrix_band_instance_q31 D31;
+	arm_matrix_band_instance_q15 D15;
+	uint32_t i, j, band, inside = 1, bad = 0;
+	int32_t c;
+
+	if(kl < 0)
+	{
+		kl = (int32_t)(test_rand() % (m + 1u));
+		ku = (int32_t)(test_rand() % (n + 1u));
+		for(i = 0; i < m; i++)
+			for(j = 0; j < n; j++)
+				inside &= s_a[i * n + j] == 0.0f || ((int32_t)j >= (int32_t)i - kl && (int32_t)j <= (int32_t)i + ku);
+		s_outside += !inside;
+		if(!inside)
+			return arm_mat_band_from_dense_f32(&A, &D, (uint16_t)kl, (uint16_t)ku, s_bd) != ARM_MATH_ARGUMENT_ERROR;
+	}
+	band = (uint32_t)(kl + ku + 1);
+	s_bd[m * band] = 12345.0f;
+	bad += arm_mat_band_from_dense_f32(&A, &D, (uint16_t)kl, (uint16_t)ku, s_bd) != ARM_MATH_SUCCESS;
+	bad += arm_mat_band_from_dense_q31(&A31, &D31, (uint16_t)kl, (uint16_t)ku, s_bd31) != ARM_MATH_SUCCESS;
+	bad += arm_mat_band_from_dense_q15(&A15, &D15, (uint16_t)kl, (uint16_t)ku, s_bd15) != ARM_MATH_SUCCESS;
+	bad += s_bd[m * band] != 12345.0f;
+	//row i holds columns i - kl to i + ku, zero outside the matrix
+	for(i = 0; i < m; i++)
+		for(j = 0; j < band; j++)
+		{
+			c = (int32_t)i - kl + (int32_t)j;
+			bad += s_bd[i * band + j] != (c >= 0 && c < (int32_t)n ? s_a[i * n + (uint32_t)c] : 0.0f);
+		}
+	arm_mat_band_vec_mult_f32(&D, s_v, s_y);
+	arm_mat_band_vec_mult_q31(&D31, s_v31, s_y31);
+	arm_mat_band_vec_mult_q15(&D15, s_v15, s_y15);
+	test_check(m, n, 1, s_v, s_v31, s_v15);
+	return bad;
+}
+
+static void test_shape(uint32_t m, uint32_t n, uint32_t p, uint32_t dens, int32_t kl, int32_t ku)
+{
+	arm_matrix_instance_f32 A = { (uint16_t)m, (uint16_t)n, s_a }, B = { (uint16_t)n, (uint16_t)p, s_b };
+	arm_matrix_instance_f32 Y = { (uint16_t)m, (uint16_t)p, s_y };
+	arm_matrix_instance_q31 A31 = { (uint16_t)m, (uint16_t)n, s_a31 }, B31 = { (uint16_t)n, (uint16_t)p, s_b31 };
+	arm_matrix_instance_q31 Y31 = { (uint16_t)m, (uint16_t)p, s_y31 };
+	arm_matrix_instance_q15 A15 = { (uint16_t)m, (uint16_t)n, s_a15 }, B15 = { (uint16_t)n, (uint16_t)p, s_b15 };
+	arm_matrix_instance_q15 Y15 = { (uint16_t)m, (uint16_t)p, s_y15 };
+	arm_matrix_csr_instance_f32 C;
+	arm_matrix_csr_instance_q31 C31;
+	arm_matrix_csr_instance_q15 C15;
+	uint32_t nnz, bad = 0;
+
+	nnz = test_operands(m, n, p, dens, kl, ku);
+	arm_mat_vec_mult_f32(&A, s_v, s_y);
+	arm_mat_vec_mult_q31(&A31, s_v31, s_y31);
+	arm_mat_vec_mult_q15(&A15, s_v15, s_y15);
+	test_check(m, n, 1, s_v, s_v31, s_v15);
+
+	//one value short reports the count in pRowPtr[numRows]
+	if(nnz > 0u)
+		bad += arm_mat_csr_from_dense_f32(&A, &C, s_rp, s_ci, s_cd, nnz - 1u) != ARM_MATH_LENGTH_ERROR || s_rp[m] != nnz;
+	bad += arm_mat_csr_from_dense_f32(&A, &C, s_rp, s_ci, s_cd, nnz) != ARM_MATH_SUCCESS;
+	bad += arm_mat_csr_from_dense_q31(&A31, &C31, s_rp31, s_ci31, s_cd31, nnz) != ARM_MATH_SUCCESS;
+	bad += arm_mat_csr_from_dense_q15(&A15, &C15, s_rp15, s_ci15, s_cd15, nnz) != ARM_MATH_SUCCESS;
+	arm_mat_csr_vec_mult_f32(&C, s_v, s_y);
+	arm_mat_csr_vec_mult_q31(&C31, s_v31, s_y31);
+	arm_mat_csr_vec_mult_q15(&C15, s_v15, s_y15);
+	test_check(m, n, 1, s_v, s_v31, s_v15);
+
+	bad += arm_mat_csr_mult_f32(&C, &B, &Y) != ARM_MATH_SUCCESS;
+	bad += arm_mat_csr_mult_q31(&C31, &B31, &Y31) != ARM_MATH_SUCCESS;
+	bad += arm_mat_csr_mult_q15(&C15, &B15, &Y15) != ARM_MATH_SUCCESS;
+	test_check(m, n, p, s_b, s_b31, s_b15);
+
+	bad += test_band(m, n, kl, ku);
+	CHECK(bad == 0, "%u x %u x %u, %u%%, band %d/%d: %u status or storage errors", m, n, p, dens, kl, ku, bad);
+}
+
+int main(void)
+{
+	uint32_t it, m, n, p, dens;
+	int32_t kl, ku;
+
+	for(it = 0; it < TEST_SHAPES; it++)
+	{
+		m = 1u + test_rand() % TEST_MAX_DIM;
+		n = 1u + test_rand() % TEST_MAX_DIM;
+		p = 1u + test_rand() % TEST_MAX_P;
+		dens = test_rand() % 101u;
+		kl = ku = -1;
+		if(test_rand() & 1u)
+		{
+			kl = (int32_t)(test_rand() % (m + 1u));
+			ku = (int32_t)(test_rand() % (n + 1u));
+		}
+		test_shape(m, n, p, dens, kl, ku);
+	}
+	printf("%u shapes, %u outside their band: f32 error %.1e of sum |ab|, %u q31 and %u q15 values differ\n", TEST_SHAPES,
+	       s_outside, s_err, s_bad31, s_bad15);
+	CHECK(s_err <= TEST_F32_MAX, "f32 error %.2e of sum |ab|", s_err);
+	CHECK(s_bad31 == 0, "%u q31 values differ", s_bad31);
+	CHECK(s_bad15 == 0, "%u q15 values differ", s_bad15);
+	CHECK(s_outside > 0u, "no matrix outside its band");
+	return test_done("test_mat_sparse");
+}
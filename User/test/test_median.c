@@ -0,0 +1,187 @@
+/*
+ * Running median and rank filters and percentiles against qsort of the
+ * same samples, with many ties and blocks split at random points.
+ * sources:
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_LEN        3000
+#define TEST_MAX_WIN    70
+#define TEST_MAX_PIECE  53
+
+static float32_t s_x[TEST_LEN], s_y[TEST_LEN];
+static q31_t s_x31[TEST_LEN], s_y31[TEST_LEN];
+static q15_t s_x15[TEST_LEN], s_y15[TEST_LEN];
+
+static int test_cmp_f32(const void *a, const void *b)
+{
+	float32_t x = *(const float32_t *)a, y = *(const float32_t *)b;
+	return (x > y) - (x < y);
+}
+
+static int test_cmp_q31(const void *a, const void *b)
+{
+	q31_t x = *(const q31_t *)a, y = *(const q31_t *)b;
+	return (x > y) - (x < y);
+}
+
+static int test_cmp_q15(const void *a, const void *b)
+{
+	q15_t x = *(const q15_t *)a, y = *(const q15_t *)b;
+	return (x > y) - (x < y);
+}
+
+//the window starts out filled with zeros, q15 runs in place
+static void test_filter(uint16_t windowLen, uint16_t rank, int noIndex)
+{
+	float32_t d[TEST_MAX_WIN], wf[TEST_MAX_WIN];
+	q31_t d31[TEST_MAX_WIN], w31[TEST_MAX_WIN];
+	q15_t d15[TEST_MAX_WIN], w15[TEST_MAX_WIN];
+	int16_t ix[2 * TEST_MAX_WIN], ix31[2 * TEST_MAX_WIN], ix15[2 * TEST_MAX_WIN];
+	arm_median_filter_instance_f32 S;
+	arm_median_filter_instance_q31 S31;
+	arm_median_filter_instance_q15 S15;
+	uint32_t pos, k, n, j, bad = 0;
+	int32_t m;
+
+	CHECK(arm_median_filter_init_f32(&S, windowLen, rank, d, noIndex ? NULL : ix) == ARM_MATH_SUCCESS,
+	      "init f32 window %u rank %u", windowLen, rank);
+	CHECK(arm_median_filter_init_q31(&S31, windowLen, rank, d31, noIndex ? NULL : ix31) == ARM_MATH_SUCCESS,
+	      "init q31 window %u rank %u", windowLen, rank);
+	CHECK(arm_median_filter_init_q15(&S15, windowLen, rank, d15, noIndex ? NULL : ix15) == ARM_MATH_SUCCESS,
+	      "init q15 window %u rank %u", windowLen, rank);
+	memcpy(s_y15, s_x15, sizeof(s_x15));
+	for(pos = 0; pos < TEST_LEN; pos += k)
+	{
+		k = test_rand() % (TEST_MAX_PIECE + 1u);
+		if(k > TEST_LEN - pos)
+			k = TEST_LEN - pos;
+		arm_median_filter_f32(&S, s_x + pos, s_y + pos, k);
+		arm_median_filter_q31(&S31, s_x31 + pos, s_y31 + pos, k);
+		arm_median_filter_q15(&S15, s_y15 + pos, s_y15 + pos, k);
+	}
+
+	for(n = 0; n < TEST_LEN; n++)
+	{
+		for(j = 0; j < windowLen; j++)
+		{
+			m = (int32_t)n - windowLen + 1 + (int32_t)j;
+			wf[j] = m < 0 ? 0.0f : s_x[m];
+			w31[j] = m < 0 ? 0 : s_x31[m];
+			w15[j] = m < 0 ? 0 : s_x15[m];
+		}
+		qsort(wf, windowLen, sizeof(float32_t), test_cmp_f32);
+		qsort(w31, windowLen, sizeof(q31_t), test_cmp_q31);
+		qsort(w15, windowLen, sizeof(q15_t), test_cmp_q15);
+		bad += wf[rank] != s_y[n] || w31[rank] != s_y31[n] || w15[rank] != s_y15[n];
+	}
+	CHECK(bad == 0, "window %u rank %u%s: %u outputs differ from qsort", windowLen, rank,
+	      noIndex ? " without index" : "", bad);
+}
+
+//random, sorted, reversed, few distinct and tent shaped vectors, with ranks past the end clamped
+static void test_percentile(uint32_t n, uint32_t mode)
+{
+	float32_t *a = malloc(n * sizeof(float32_t)), *c = malloc(n * sizeof(float32_t)), *s = malloc(n * sizeof(float32_t));
+	q31_t *a31 = malloc(n * sizeof(q31_t)), *c31 = malloc(n * sizeof(q31_t)), r31;
+	q15_t *a15 = malloc(n * sizeof(q15_t)), *c15 = malloc(n * sizeof(q15_t)), *s15 = malloc(n * sizeof(q15_t)), r15;
+	float32_t r;
+	uint32_t i, rank, k;
+	int32_t v;
+
+	for(i = 0; i < n; i++)
+	{
+		switch(mode)
+		{
+		case 0:  v = (int32_t)(test_rand() >> 9);             break;
+		case 1:  v = (int32_t)i;                              break;
+		case 2:  v = (int32_t)(n - i);                        break;
+		case 3:  v = (int32_t)(test_rand() % 5u);             break;
+		default: v = (int32_t)(i < n / 2 ? i : n - i);        break;
+		}
+		a[i] = (float32_t)v;
+		a31[i] = v * 97;
+		a15[i] = (q15_t)(v % 30000);
+	}
+	memcpy(c, a, n * sizeof(float32_t));
+	memcpy(c31, a31, n * sizeof(q31_t));
+	memcpy(c15, a15, n * sizeof(q15_t));
+	qsort(c, n, sizeof(float32_t), test_cmp_f32);
+	qsort(c31, n, sizeof(q31_t), test_cmp_q31);
+	qsort(c15, n, sizeof(q15_t), test_cmp_q15);
+
+	for(i = 0; i < 5; i++)
+	{
+		rank = i < 4 ? test_rand() % n : n + test_rand() % 3u;
+		k = rank < n ? rank : n - 1u;
+		arm_percentile_f32(a, n, rank, s, &r);
+		arm_percentile_q15(a15, n, rank, s15, &r15);
+		CHECK(r == c[k] && r15 == c15[k], "n %u mode %u rank %u: f32 %g q15 %d, expected %g %d",
+		      n, mode, rank, r, r15, c[k], c15[k]);
+	}
+	//q31 reorders its input in place, which leaves the values the same
+	rank = test_rand() % n;
+	arm_percentile_q31(a31, n, rank, a31, &r31);
+	CHECK(r31 == c31[rank], "n %u mode %u rank %u: q31 %d, expected %d", n, mode, rank, r31, c31[rank]);
+	free(a);
+	free(c);
+	free(s);
+	free(a31);
+	free(c31);
+	free(a15);
+	free(c15);
+	free(s15);
+}
+
+static void test_errors(void)
+{
+	float32_t d[4], r = 1.0f;
+	q31_t r31 = 1;
+	q15_t r15 = 1;
+	int16_t ix[8];
+	arm_median_filter_instance_f32 S;
+
+	CHECK(arm_median_filter_init_f32(&S, 0, 0, d, ix) == ARM_MATH_ARGUMENT_ERROR, "window of 0 accepted");
+	CHECK(arm_median_filter_init_f32(&S, 4, 4, d, ix) == ARM_MATH_ARGUMENT_ERROR, "rank past the window accepted");
+	CHECK(arm_median_filter_init_f32(&S, 4, 1, d, NULL) == ARM_MATH_ARGUMENT_ERROR, "window of 4 without index accepted");
+
+	//an empty vector gives 0 and reads nothing
+	arm_percentile_f32(NULL, 0, 0, NULL, &r);
+	arm_percentile_q31(NULL, 0, 3, NULL, &r31);
+	arm_percentile_q15(NULL, 0, 0, NULL, &r15);
+	CHECK(r == 0.0f && r31 == 0 && r15 == 0, "empty vector: %g %d %d", r, r31, r15);
+}
+
+int main(void)
+{
+	uint16_t w, r, ranks[4];
+	uint32_t i, t;
+
+	//few distinct values, so the windows hold many ties
+	for(i = 0; i < TEST_LEN; i++)
+	{
+		s_x[i] = (float32_t)(test_rand() % 50u) / 7.0f - 3.0f;
+		s_x31[i] = ((int32_t)(test_rand() % 100u) - 50) * 12345;
+		s_x15[i] = (q15_t)((int32_t)(test_rand() % 200u) - 100);
+	}
+	for(w = 1; w <= TEST_MAX_WIN; w++)
+	{
+		ranks[0] = 0;
+		ranks[1] = (w - 1u) / 2u;
+		ranks[2] = w - 1u;
+		ranks[3] = w / 3u;
+		for(r = 0; r < 4; r++)
+			test_filter(w, ranks[r], 0);
+	}
+	test_filter(3, 1, 1);
+	test_filter(5, 2, 1);
+
+	for(t = 0; t < 400; t++)
+		test_percentile(1u + test_rand() % (t < 300 ? 100u : 5000u), t % 5u);
+	test_errors();
+	return test_done("test_median");
+}
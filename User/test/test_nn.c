@@ -0,0 +1,396 @@
+/*
+ * Q7 network kernels against a plain integer reference with the TensorFlow
+ * Lite requantization, bit exact on random shapes with odd channel counts,
+ * padding, strides and channel multipliers, softmax against float, and the
+ * layer runner against the kernels called one by one.
+ * sources: User/nn_run.c User/profile.c
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include "nn_run.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_SHAPES     6000
+#define TEST_MAX_OUT    512
+
+static q7_t s_x[8192], s_ref[32768], s_out[32768], s_w[409600];
+static q31_t s_bias[TEST_MAX_OUT], s_mult[TEST_MAX_OUT];
+static int32_t s_shift[TEST_MAX_OUT];
+static q15_t s_buf[16384];
+
+static int32_t test_range(uint32_t n)
+{
+	return (int32_t)(test_rand() % n);
+}
+
+static void test_fill(q7_t *p, uint32_t n)
+{
+	while(n--)
+		*p++ = (q7_t)(test_rand() >> 24);
+}
+
+//multipliers in [0.5 1), shifts mostly right and sometimes left
+static void test_quant(uint32_t n)
+{
+	uint32_t i;
+
+	for(i = 0; i < n; i++)
+	{
+		s_mult[i] = (q31_t)(0x40000000u + (test_rand() >> 2));
+		s_shift[i] = -test_range(12) + (test_range(8) == 0 ? 2 : 0);
+		s_bias[i] = test_range(20000) - 10000;
+	}
+}
+
+//rounding doubling high multiply and rounding right shift, written out as in the TensorFlow Lite reference
+static int32_t test_requantize(int32_t x, int32_t m, int32_t s)
+{
+	int64_t p;
+	int32_t r, mask, rem, th;
+
+	if(s > 0)
+		x = (int32_t)((uint32_t)x << s);
+	if(x == m && x == INT32_MIN)
+		r = INT32_MAX;
+	else
+	{
+		p = (int64_t)x * m;
+		r = (int32_t)((p + (p >= 0 ? (1 << 30) : 1 - (1 << 30))) / (1ll << 31));
+	}
+	s = s > 0 ? 0 : -s;
+	mask = (int32_t)((1u << s) - 1u);
+	rem = r & mask;
+	th = (mask >> 1) + (r < 0);
+	return (r >> s) + (rem > th);
+}
+
+//convolution on HWC tensors, depthwise when dw is set
+static void test_ref_conv(const arm_nn_conv_instance_q7 *S, const q7_t *x, q7_t *y, int dw)
+{
+	const arm_nn_quant_q7 *q = &S->quant;
+	int32_t oy, ox, oc, ky, kx, ic, iy, ix, acc, mult = S->out.channels / S->in.channels;
+
+	for(oy = 0; oy < S->out.height; oy++)
+		for(ox = 0; ox < S->out.width; ox++)
+			for(oc = 0; oc < S->out.channels; oc++)
+			{
+				acc = S->pBias ? S->pBias[oc] : 0;
+				for(ky = 0; ky < S->kernelH; ky++)
+					for(kx = 0; kx < S->kernelW; kx++)
+					{
+						iy = oy * S->strideH - S->padH + ky;
+						ix = ox * S->strideW - S->padW + kx;
+						if(iy < 0 || iy >= S->in.height || ix < 0 || ix >= S->in.width)
+							continue;
+						if(dw)
+						{
+							ic = oc / mult;
+							acc += (x[(iy * S->in.width + ix) * S->in.channels + ic] + q->inOffset) *
+							       S->pWeights[(ky * S->kernelW + kx) * S->out.channels + oc];
+						}
+						else
+							for(ic = 0; ic < S->in.channels; ic++)
+								acc += (x[(iy * S->in.width + ix) * S->in.channels + ic] + q->inOffset) *
+								       S->pWeights[((oc * S->kernelH + ky) * S->kernelW + kx) * S->in.channels + ic];
+					}
+				acc = test_requantize(acc, q->pMult[oc], q->pShift[oc]) + q->outOffset;
+				acc = acc < q->actMin ? q->actMin : acc;
+				acc = acc > q->actMax ? q->actMax : acc;
+				y[(oy * S->out.width + ox) * S->out.channels + oc] = (q7_t)acc;
+			}
+}
+
+//max or average over the window part inside the input, the average rounded half away from zero
+static void test_ref_pool(const arm_nn_pool_instance_q7 *S, const q7_t *x, q7_t *y, int avg)
+{
+	int32_t oy, ox, c, ky, kx, iy, ix, v, acc, n;
+
+	for(oy = 0; oy < S->out.height; oy++)
+		for(ox = 0; ox < S->out.width; ox++)
+			for(c = 0; c < S->in.channels; c++)
+			{
+				acc = avg ? 0 : -128;
+				n = 0;
+				for(ky = 0; ky < S->kernelH; ky++)
+					for(kx = 0; kx < S->kernelW; kx++)
+					{
+						iy = oy * S->strideH - S->padH + ky;
+						ix = ox * S->strideW - S->padW + kx;
+						if(iy < 0 || iy >= S->in.height || ix < 0 || ix >= S->in.width)
+							continue;
+						v = x[(iy * S->in.width + ix) * S->in.channels + c];
+						n++;
+						if(avg)
+							acc += v;
+						else if(v > acc)
+							acc = v;
+					}
+				if(avg && n)
+					acc = acc > 0 ? (acc + n / 2) / n : (acc - n / 2) / n;
+				acc = acc < S->actMin ? S->actMin : acc;
+				acc = acc > S->actMax ? S->actMax : acc;
+				y[(oy * S->out.width + ox) * S->out.channels + c] = (q7_t)acc;
+			}
+}
+
+static uint32_t test_diff(uint32_t n)
+{
+	uint32_t i, bad = 0;
+
+	for(i = 0; i < n; i++)
+		bad += s_ref[i] != s_out[i];
+	return bad;
+}
+
+//one random layer of the given kind: 0 convolution, 1 pointwise, 2 depthwise, 3 fully connected and pooling
+static uint32_t test_shape(uint32_t kind)
+{
+	arm_nn_conv_instance_q7 C;
+	arm_nn_fc_instance_q7 F;
+	arm_nn_pool_instance_q7 P;
+	arm_nn_quant_q7 q;
+	int32_t h, w, c, kh, kw, sh, sw, ph, pw, oh, ow, oc, len;
+	uint32_t bad;
+
+	q.pMult = s_mult;
+	q.pShift = s_shift;
+	q.inOffset = test_range(256) - 128;
+	q.outOffset = test_range(256) - 128;
+	//a ReLU bound at the zero point, which may lie above actMax, and then actMax wins as in TensorFlow Lite
+	q.actMin = test_range(3) == 0 ? q.outOffset : -128;
+	q.actMax = test_range(5) == 0 ? 100 : 127;
+
+	h = 1 + test_range(12);
+	w = 1 + test_range(12);
+	c = 1 + test_range(kind == 3 ? 40 : 24);
+	kh = 1 + test_range(5);
+	kw = 1 + test_range(5);
+	sh = 1 + test_range(3);
+	sw = 1 + test_range(3);
+	ph = test_range(kh);
+	pw = test_range(kw);
+	if(kind == 1)
+	{
+		kh = kw = 1;
+		ph = pw = 0;
+	}
+	if(kh > h + 2 * ph)
+		kh = 1;
+	if(kw > w + 2 * pw)
+		kw = 1;
+	ph = ph < kh ? ph : kh - 1;
+	pw = pw < kw ? pw : kw - 1;
+	oh = (h + 2 * ph - kh) / sh + 1;
+	ow = (w + 2 * pw - kw) / sw + 1;
+	test_fill(s_x, h * w * c);
+
+	C.in.height = P.in.height = h;
+	C.in.width = P.in.width = w;
+	C.in.channels = P.in.channels = c;
+	C.out.height = P.out.height = oh;
+	C.out.width = P.out.width = ow;
+	C.kernelH = P.kernelH = kh;
+	C.kernelW = P.kernelW = kw;
+	C.strideH = P.strideH = sh;
+	C.strideW = P.strideW = sw;
+	C.padH = P.padH = ph;
+	C.padW = P.padW = pw;
+	C.pWeights = F.pWeights = s_w;
+	C.pBias = F.pBias = test_range(5) != 0 ? s_bias : NULL;
+	C.quant = F.quant = q;
+
+	switch(kind)
+	{
+	case 0:
+	case 1:
+		oc = 1 + test_range(33);
+		C.out.channels = oc;
+		test_quant(oc);
+		test_fill(s_w, oc * kh * kw * c);
+		test_ref_conv(&C, s_x, s_ref, 0);
+		if(kind == 0)
+			CHECK(arm_convolve_q7(&C, s_x, s_out, s_buf) == ARM_MATH_SUCCESS, "convolution status");
+		else
+			CHECK(arm_convolve_1x1_q7(&C, s_x, s_out, s_buf) == ARM_MATH_SUCCESS, "pointwise status");
+		bad = test_diff(oh * ow * oc);
+		CHECK(bad == 0, "%s %dx%dx%d -> %dx%dx%d kernel %dx%d stride %dx%d pad %dx%d: %u outputs differ",
+		      kind ? "pointwise" : "convolution", h, w, c, oh, ow, oc, kh, kw, sh, sw, ph, pw, bad);
+		return 1;
+
+	case 2:
+		oc = c * (test_range(3) == 0 ? 1 + test_range(3) : 1);
+		C.out.channels = oc;
+		test_quant(oc);
+		test_fill(s_w, kh * kw * oc);
+		test_ref_conv(&C, s_x, s_ref, 1);
+		CHECK(arm_depthwise_conv_q7(&C, s_x, s_out) == ARM_MATH_SUCCESS, "depthwise status");
+		bad = test_diff(oh * ow * oc);
+		CHECK(bad == 0, "depthwise %dx%dx%d -> %dx%dx%d kernel %dx%d stride %dx%d pad %dx%d: %u outputs differ",
+		      h, w, c, oh, ow, oc, kh, kw, sh, sw, ph, pw, bad);
+		return 1;
+
+	default:
+		//the input tensor as a flat vector
+		len = h * w * c;
+		oc = 1 + test_range(70);
+		F.inLen = len;
+		F.outLen = oc;
+		test_quant(oc);
+		test_fill(s_w, oc * len);
+		C.in.height = C.in.width = C.out.height = C.out.width = 1;
+		C.in.channels = len;
+		C.out.channels = oc;
+		C.kernelH = C.kernelW = C.strideH = C.strideW = 1;
+		C.padH = C.padW = 0;
+		test_ref_conv(&C, s_x, s_ref, 0);
+		arm_fully_connected_q7(&F, s_x, s_out, s_buf);
+		bad = test_diff(oc);
+		CHECK(bad == 0, "fully connected %d -> %d: %u outputs differ", len, oc, bad);
+
+		P.out.channels = c;
+		P.actMin = q.actMin;
+		P.actMax = q.actMax;
+		test_ref_pool(&P, s_x, s_ref, 0);
+		arm_max_pool_q7(&P, s_x, s_out);
+		bad = test_diff(oh * ow * c);
+		CHECK(bad == 0, "max pool %dx%dx%d window %dx%d stride %dx%d pad %dx%d: %u outputs differ",
+		      h, w, c, kh, kw, sh, sw, ph, pw, bad);
+		test_ref_pool(&P, s_x, s_ref, 1);
+		arm_avg_pool_q7(&P, s_x, s_out);
+		bad = test_diff(oh * ow * c);
+		CHECK(bad == 0, "average pool %dx%dx%d window %dx%d stride %dx%d pad %dx%d: %u outputs differ",
+		      h, w, c, kh, kw, sh, sw, ph, pw, bad);
+		return 3;
+	}
+}
+
+static void test_relu(void)
+{
+	uint32_t n, i, bad = 0;
+
+	for(n = 0; n < 40; n++)
+	{
+		test_fill(s_out, n);
+		for(i = 0; i < n; i++)
+			s_ref[i] = s_out[i] < 0 ? 0 : s_out[i];
+		arm_relu_q7(s_out, n);
+		bad += test_diff(n);
+	}
+	CHECK(bad == 0, "relu: %u outputs differ", bad);
+}
+
+//the table against exp, the outputs against float and against the integer division they stand for
+static void test_softmax(float32_t scale)
+{
+	q15_t tab[256];
+	double sum, p, e, emax = 0;
+	uint32_t n, i, su, bad = 0;
+	int32_t mx, r;
+
+	arm_softmax_init_q7(tab, scale);
+	for(i = 0; i < 256; i++)
+	{
+		r = (int32_t)lround(32768.0 * exp(-(double)i * scale));
+		r = r > 32767 ? 32767 : r;
+		bad += abs(tab[i] - r) > 1;
+	}
+	CHECK(bad == 0, "softmax scale %g: %u table entries off by more than 1", scale, bad);
+
+	for(n = 1; n <= 100; n++)
+	{
+		test_fill(s_x, n);
+		arm_softmax_q7(s_x, s_out, n, tab);
+		mx = -128;
+		for(i = 0; i < n; i++)
+			mx = s_x[i] > mx ? s_x[i] : mx;
+		sum = 0;
+		su = 0;
+		for(i = 0; i < n; i++)
+		{
+			sum += exp((s_x[i] - mx) * (double)scale);
+			su += tab[mx - s_x[i]];
+		}
+		for(i = 0; i < n; i++)
+		{
+			p = exp((s_x[i] - mx) * (double)scale) / sum;
+			e = fabs((s_out[i] + 128) / 256.0 - p);
+			emax = fmax(emax, e);
+			r = (int32_t)(((uint32_t)tab[mx - s_x[i]] * 256u + su / 2u) / su) - 128;
+			s_ref[i] = (q7_t)(r > 127 ? 127 : r);
+		}
+		bad = test_diff(n);
+		CHECK(bad == 0, "softmax scale %g, %u logits: %u outputs differ", scale, n, bad);
+	}
+	printf("softmax scale %g: error %.4f against float, 1 LSB is %.4f\n", scale, emax, 1.0 / 256.0);
+	CHECK(emax <= 1.0 / 256.0, "softmax scale %g: error %.4f against float", scale, emax);
+}
+
+//a small network through nn_net_run against the same kernels called one by one
+static void test_net(void)
+{
+	static q7_t w1[16 * 3 * 3 * 3], w2[3 * 3 * 16], w3[10 * 4 * 4 * 16];
+	static uint8_t mem[65536];
+	static q15_t tab[256];
+	static const arm_nn_conv_instance_q7 c1 = { { 16, 16, 3 }, { 16, 16, 16 }, 3, 3, 1, 1, 1, 1, w1, s_bias,
+	                                            { s_mult, s_shift, 5, -3, -128, 127 } };
+	static const arm_nn_pool_instance_q7 p1 = { { 16, 16, 16 }, { 8, 8, 16 }, 2, 2, 2, 2, 0, 0, -128, 127 };
+	static const arm_nn_conv_instance_q7 d1 = { { 8, 8, 16 }, { 8, 8, 16 }, 3, 3, 1, 1, 1, 1, w2, s_bias,
+	                                            { s_mult, s_shift, 3, 0, -128, 127 } };
+	static const arm_nn_pool_instance_q7 p2 = { { 8, 8, 16 }, { 4, 4, 16 }, 2, 2, 2, 2, 0, 0, -128, 127 };
+	static const arm_nn_fc_instance_q7 f1 = { 256, 10, w3, s_bias, { s_mult, s_shift, 0, 0, -128, 127 } };
+	static const nn_layer_t layers[] =
+	{
+		{ NN_CONV,     &c1 },
+		{ NN_RELU,     NULL },
+		{ NN_MAX_POOL, &p1 },
+		{ NN_DW_CONV,  &d1 },
+		{ NN_AVG_POOL, &p2 },
+		{ NN_FC,       &f1 },
+		{ NN_SOFTMAX,  tab },
+	};
+	q7_t in[768], out[10], t1[4096], t2[4096], ref[10];
+	q15_t col[512];
+	uint32_t ticks[7];
+	nn_arena_t a;
+	nn_net_t net;
+
+	test_quant(16);
+	test_fill(w1, sizeof(w1));
+	test_fill(w2, sizeof(w2));
+	test_fill(w3, sizeof(w3));
+	test_fill(in, sizeof(in));
+	arm_softmax_init_q7(tab, 0.125f);
+
+	//an arena that does not start aligned
+	nn_arena_init(&a, mem + 3, sizeof(mem) - 3);
+	CHECK(nn_net_init(&net, layers, 7, &a) == 0, "network init");
+	CHECK(nn_net_run(&net, in, out, ticks) == 0, "network run");
+
+	arm_convolve_q7(&c1, in, t1, col);
+	arm_relu_q7(t1, 4096);
+	arm_max_pool_q7(&p1, t1, t2);
+	arm_depthwise_conv_q7(&d1, t2, t1);
+	arm_avg_pool_q7(&p2, t1, t2);
+	arm_fully_connected_q7(&f1, t2, t1, col);
+	arm_softmax_q7(t1, ref, 10, tab);
+	CHECK(memcmp(out, ref, sizeof(out)) == 0, "network output differs from the kernels");
+
+	nn_arena_init(&a, mem, 1000);
+	CHECK(nn_net_init(&net, layers, 7, &a) == -1, "network init in a 1000 byte arena");
+}
+
+int main(void)
+{
+	uint32_t t, shapes = 0;
+
+	for(t = 0; t < TEST_SHAPES; t++)
+		shapes += test_shape(t % 4u);
+	printf("%u layer shapes against the reference\n", shapes);
+	test_relu();
+	test_softmax(0.1f);
+	test_softmax(0.0625f);
+	test_net();
+	return test_done("test_nn");
+}
@@ -0,0 +1,346 @@
+/*
+ * CMSIS-RTOS kernel on the host port: preemption, mail and message queues,
+ * semaphores, mutex priority inheritance, signals, timers, round robin and
+ * memory pools.
+ * sources: User/os_kernel.c User/os_port_host.c User/profile.c
+ */
+
+#include "test.h"
+#include "os_kernel.h"
+#include <stdlib.h>
+
+#define TEST_MAILS      100u
+#define TEST_MESSAGES   50u
+
+#define TEST_PRIO(p)    ((uint8_t)((p) - osPriorityIdle))
+
+typedef struct
+{
+	uint32_t seq;
+	double   x;
+} test_mail_t;
+
+osMailQDef(test_mq, 4, test_mail_t);
+osMessageQDef(test_q, 3, uint32_t);
+osSemaphoreDef(test_sem);
+osMutexDef(test_mtx);
+osMutexDef(test_m1);
+osMutexDef(test_m2);
+osPoolDef(test_pool, 5, test_mail_t);
+
+static osMailQId s_mq;
+static osMessageQId s_q;
+static osSemaphoreId s_sem;
+static osMutexId s_mtx, s_m1, s_m2;
+
+static volatile int s_order[16];
+static volatile int s_order_len;
+
+static void test_hi(void const *arg)
+{
+	s_order[s_order_len++] = (int)(intptr_t)arg;
+}
+osThreadDef(test_hi, osPriorityHigh, 2, 0);
+
+//a higher priority thread runs as soon as it is created
+static void test_preempt(void)
+{
+	s_order_len = 0;
+	osThreadCreate(osThread(test_hi), (void *)1);
+	s_order[s_order_len++] = 2;
+	osThreadCreate(osThread(test_hi), (void *)3);
+	CHECK(s_order_len == 3 && s_order[0] == 1 && s_order[1] == 2 && s_order[2] == 3,
+	      "order %d %d %d", s_order[0], s_order[1], s_order[2]);
+}
+
+static void test_producer(void const *arg)
+{
+	test_mail_t *m;
+	uint32_t i;
+
+	for(i = 0; i < TEST_MAILS; i++)
+	{
+		m = osMailAlloc(s_mq, osWaitForever);
+		m->seq = i;
+		m->x = i * 0.5;
+		osMailPut(s_mq, m);
+	}
+	for(i = 0; i < TEST_MESSAGES; i++)
+		CHECK(osMessagePut(s_q, i, osWaitForever) == osOK, "message %u", i);
+}
+osThreadDef(test_producer, osPriorityBelowNormal, 1, 0);
+
+//a slower consumer: the producer blocks on the full queues and every item arrives once, in order
+static void test_queues(void)
+{
+	test_mail_t *m;
+	osEvent ev;
+	uint32_t i, bad = 0;
+
+	osThreadCreate(osThread(test_producer), NULL);
+	for(i = 0; i < TEST_MAILS; i++)
+	{
+		ev = osMailGet(s_mq, osWaitForever);
+		m = ev.value.p;
+		bad += ev.status != osEventMail || m->seq != i || m->x != i * 0.5;
+		bad += osMailFree(s_mq, m) != osOK;
+		if(i % 7u == 0)
+			osDelay(1);
+	}
+	CHECK(bad == 0, "%u bad mails", bad);
+	m = osMailAlloc(s_mq, 0);
+	CHECK(osMailPut(s_mq, (char *)m + 1) == osErrorValue, "put of a pointer into a mail");
+	CHECK(osMailFree(s_mq, (char *)m + 1) == osErrorValue, "free of a pointer into a mail");
+	CHECK(osMailFree(s_mq, m) == osOK, "free of the mail");
+	for(i = 0; i < TEST_MESSAGES; i++)
+	{
+		ev = osMessageGet(s_q, osWaitForever);
+		bad += ev.status != osEventMessage || ev.value.v != i;
+	}
+	CHECK(bad == 0, "%u bad messages", bad);
+	ev = osMessageGet(s_q, 0);
+	CHECK(ev.status == osOK, "get from an empty queue: %d", ev.status);
+	ev = osMessageGet(s_q, 5);
+	CHECK(ev.status == osEventTimeout, "timed get from an empty queue: %d", ev.status);
+}
+
+static void test_semaphore(void)
+{
+	CHECK(osSemaphoreWait(s_sem, 0) == 2, "first token");
+	CHECK(osSemaphoreWait(s_sem, 0) == 1, "second token");
+	CHECK(osSemaphoreWait(s_sem, 0) == 0, "no token left");
+	CHECK(osSemaphoreWait(s_sem, 3) == 0, "timed wait without a token");
+	CHECK(osSemaphoreRelease(s_sem) == osOK, "release");
+}
+
+static volatile int s_low_has_mutex, s_low_prio, s_low_prio_after;
+
+static void test_low(void const *arg)
+{
+	CHECK(osMutexWait(s_mtx, osWaitForever) == osOK, "low takes the mutex");
+	s_low_has_mutex = 1;
+	osDelay(5);         //the high priority waiter arrives
+	s_low_prio = osThreadGetId()->prio;
+	CHECK(osThreadGetPriority(osThreadGetId()) == osPriorityLow, "inheriting changes the own priority");
+	CHECK(osMutexRelease(s_mtx) == osOK, "low releases the mutex");
+	s_low_prio_after = osThreadGetId()->prio;
+}
+osThreadDef(test_low, osPriorityLow, 1, 0);
+
+static void test_high(void const *arg)
+{
+	while(!s_low_has_mutex)
+		osDelay(1);
+	CHECK(osMutexWait(s_mtx, 0) == osErrorResource, "owned mutex without waiting");
+	CHECK(osMutexWait(s_mtx, osWaitForever) == osOK, "high takes the mutex");
+	CHECK(osMutexRelease(s_mtx) == osOK, "high releases the mutex");
+}
+osThreadDef(test_high, osPriorityHigh, 1, 0);
+
+static void test_inherit(void)
+{
+	osThreadCreate(osThread(test_low), NULL);
+	osThreadCreate(osThread(test_high), NULL);
+	osDelay(30);
+	CHECK(s_low_prio == TEST_PRIO(osPriorityHigh), "owner runs at %d while high waits", s_low_prio);
+	CHECK(s_low_prio_after == TEST_PRIO(osPriorityLow), "owner runs at %d after release", s_low_prio_after);
+}
+
+static volatile int s_chain_done[3];
+static volatile int s_chain_len;
+static volatile uint32_t s_chain_hold;     //ticks the end of the chain keeps m2
+
+//c holds m2, b holds m1 and waits for m2, a waits for m1
+static void test_chain_c(void const *arg)
+{
+	osMutexWait(s_m2, osWaitForever);
+	osDelay(s_chain_hold);
+	osMutexRelease(s_m2);
+	s_chain_done[s_chain_len++] = 'c';
+}
+osThreadDef(test_chain_c, osPriorityLow, 1, 0);
+
+static void test_chain_b(void const *arg)
+{
+	osMutexWait(s_m1, osWaitForever);
+	osMutexWait(s_m2, osWaitForever);
+	osMutexRelease(s_m2);
+	osMutexRelease(s_m1);
+	s_chain_done[s_chain_len++] = 'b';
+}
+osThreadDef(test_chain_b, osPriorityBelowNormal, 1, 0);
+
+static volatile osStatus s_chain_a_status;
+
+static void test_chain_a(void const *arg)
+{
+	s_chain_a_status = osMutexWait(s_m1, (uint32_t)(uintptr_t)arg);
+	if(s_chain_a_status == osOK)
+		osMutexRelease(s_m1);
+	s_chain_done[s_chain_len++] = 'a';
+}
+osThreadDef(test_chain_a, osPriorityHigh, 1, 0);
+
+//inheritance follows a chain of owners, and is withdrawn along it when the waiter gives up
+static void test_inherit_chain(void)
+{
+	osThreadId a, b, c;
+
+	s_chain_len = 0;
+	s_chain_hold = 20;
+	c = osThreadCreate(osThread(test_chain_c), NULL);
+	osDelay(2);
+	b = osThreadCreate(osThread(test_chain_b), NULL);
+	osDelay(2);
+	CHECK(c->prio == TEST_PRIO(osPriorityBelowNormal), "c runs at %d below b", c->prio);
+	a = osThreadCreate(osThread(test_chain_a), (void *)osWaitForever);
+	CHECK(b->prio == TEST_PRIO(osPriorityHigh), "b runs at %d below a", b->prio);
+	CHECK(c->prio == TEST_PRIO(osPriorityHigh), "c runs at %d at the end of the chain", c->prio);
+	CHECK(osThreadGetPriority(c) == osPriorityLow, "priority of c changed");
+	osDelay(40);
+	CHECK(s_chain_len == 3 && s_chain_done[0] == 'a' && s_chain_done[1] == 'b' && s_chain_done[2] == 'c',
+	      "chain finished in the order %c%c%c", s_chain_done[0], s_chain_done[1], s_chain_done[2]);
+	CHECK(s_chain_a_status == osOK, "a got m1: %d", s_chain_a_status);
+
+	s_chain_len = 0;
+	c = osThreadCreate(osThread(test_chain_c), NULL);
+	osDelay(2);
+	b = osThreadCreate(osThread(test_chain_b), NULL);
+	osDelay(2);
+	a = osThreadCreate(osThread(test_chain_a), (void *)5);
+	CHECK(c->prio == TEST_PRIO(osPriorityHigh), "c runs at %d before the timeout", c->prio);
+	osDelay(8);
+	CHECK(s_chain_a_status == osErrorTimeoutResource, "a timed out: %d", s_chain_a_status);
+	CHECK(b->prio == TEST_PRIO(osPriorityBelowNormal), "b runs at %d after the timeout", b->prio);
+	CHECK(c->prio == TEST_PRIO(osPriorityBelowNormal), "c runs at %d after the timeout", c->prio);
+	osDelay(30);
+	CHECK(s_chain_len == 3, "%d of 3 chain threads finished", s_chain_len);
+
+	//the same when the waiter is terminated instead
+	s_chain_len = 0;
+	c = osThreadCreate(osThread(test_chain_c), NULL);
+	osDelay(2);
+	b = osThreadCreate(osThread(test_chain_b), NULL);
+	osDelay(2);
+	a = osThreadCreate(osThread(test_chain_a), (void *)osWaitForever);
+	CHECK(c->prio == TEST_PRIO(osPriorityHigh), "c runs at %d before a ends", c->prio);
+	CHECK(osThreadTerminate(a) == osOK, "terminate a");
+	CHECK(b->prio == TEST_PRIO(osPriorityBelowNormal), "b runs at %d after a ends", b->prio);
+	CHECK(c->prio == TEST_PRIO(osPriorityBelowNormal), "c runs at %d after a ends", c->prio);
+	osDelay(30);
+	CHECK(s_chain_len == 2, "%d of 2 chain threads finished", s_chain_len);
+}
+
+static volatile int s_signalled;
+
+static void test_sig_thread(void const *arg)
+{
+	osEvent ev;
+
+	ev = osSignalWait(0x3, osWaitForever);
+	CHECK(ev.status == osEventSignal && ev.value.signals == 3, "signal wait: %d %x", ev.status, ev.value.signals);
+	s_signalled = 1;
+	ev = osSignalWait(0x4, 10);
+	CHECK(ev.status == osEventTimeout, "timed signal wait: %d", ev.status);
+}
+osThreadDef(test_sig_thread, osPriorityAboveNormal, 1, 0);
+
+//the waiter wakes only once all of its signals are set
+static void test_signals(void)
+{
+	osThreadId t = osThreadCreate(osThread(test_sig_thread), NULL);
+
+	osSignalSet(t, 1);
+	CHECK(!s_signalled, "woke on one of two signals");
+	osSignalSet(t, 2);
+	CHECK(s_signalled, "did not wake on both signals");
+	osDelay(20);
+}
+
+static volatile int s_timer_count;
+
+static void test_timer_cb(void const *arg)
+{
+	s_timer_count++;
+}
+osTimerDef(test_tm, test_timer_cb);
+
+static void test_timer(void)
+{
+	osTimerId t = osTimerCreate(osTimer(test_tm), osTimerPeriodic, NULL);
+
+	CHECK(osTimerStart(t, 10) == osOK, "timer start");
+	osDelay(105);
+	CHECK(osTimerStop(t) == osOK, "timer stop");
+	CHECK(s_timer_count >= 9 && s_timer_count <= 11, "periodic timer fired %d times in 105 ticks", s_timer_count);
+}
+
+static volatile double s_fsum[2];
+
+static void test_fpu(void const *arg)
+{
+	int k = (int)(intptr_t)arg, i;
+	double s = 0;
+
+	for(i = 0; i < 2000000; i++)
+		s += 1.0 / (i + 1);
+	s_fsum[k] = s;
+}
+osThreadDef(test_fpu, osPriorityNormal, 2, 0);
+
+//two threads of one priority share the CPU and keep their floating point state
+static void test_round_robin(void)
+{
+	osThreadCreate(osThread(test_fpu), (void *)0);
+	osThreadCreate(osThread(test_fpu), (void *)1);
+	while(s_fsum[0] == 0 || s_fsum[1] == 0)
+		osDelay(5);
+	CHECK(s_fsum[0] == s_fsum[1], "sums differ: %.17g %.17g", s_fsum[0], s_fsum[1]);
+}
+
+static void test_pool(void)
+{
+	osPoolId p = osPoolCreate(osPool(test_pool));
+	void *b[5];
+	int k;
+
+	for(k = 0; k < 5; k++)
+	{
+		b[k] = osPoolCAlloc(p);
+		CHECK(b[k] != NULL, "block %d", k);
+	}
+	CHECK(osPoolAlloc(p) == NULL, "allocation from an empty pool");
+	CHECK(osPoolFree(p, (char *)b[0] + 1) == osErrorValue, "free of a pointer into a block");
+	for(k = 0; k < 5; k++)
+		CHECK(osPoolFree(p, b[k]) == osOK, "free block %d", k);
+}
+
+//osKernelStart does not return, the test ends from this thread
+static void test_app(void const *arg)
+{
+	test_preempt();
+	test_queues();
+	test_semaphore();
+	test_inherit();
+	test_inherit_chain();
+	test_signals();
+	test_timer();
+	test_round_robin();
+	test_pool();
+	exit(test_done("test_os"));
+}
+osThreadDef(test_app, osPriorityNormal, 1, 0);
+
+int main(void)
+{
+	osKernelInitialize();
+	s_mq = osMailCreate(osMailQ(test_mq), NULL);
+	s_q = osMessageCreate(osMessageQ(test_q), NULL);
+	s_sem = osSemaphoreCreate(osSemaphore(test_sem), 2);
+	s_mtx = osMutexCreate(osMutex(test_mtx));
+	s_m1 = osMutexCreate(osMutex(test_m1));
+	s_m2 = osMutexCreate(osMutex(test_m2));
+	osThreadCreate(osThread(test_app), NULL);
+	osKernelStart();
+	return 2;
+}
@@ -0,0 +1,207 @@
+/*
+ * Run-to-completion scheduler, fed by simulated interrupts.
+ * sources: User/sched.c User/isr_sim.c User/profile.c
+ */
+
+#include "test.h"
+#include "sched.h"
+#include "isr_sim.h"
+#include <pthread.h>
+#include <string.h>
+
+#define TEST_SOURCES    3
+#define TEST_POSTS      4000u       //posts per simulated interrupt source
+#define TEST_PRODUCERS  4           //unsynchronised producers, like nested interrupts
+#define TEST_ATTEMPTS   20000u
+
+enum { test_evt_data = 0, test_evt_stop };
+
+typedef struct
+{
+	sched_task_t *task;
+	uint32_t      id;
+	uint32_t      seq;          //next sequence number to post
+	uint32_t      ok;
+	uint32_t      rejected;
+} test_source_t;
+
+static sched_task_t s_fast, s_slow, s_stop, s_tick;
+static isr_sim_t s_sim[TEST_SOURCES], s_tick_sim;
+static test_source_t s_src[TEST_SOURCES];
+static uint32_t s_next[TEST_SOURCES];      //next sequence number expected from each source
+static uint32_t s_received[TEST_SOURCES];
+static uint32_t s_order_errors;
+static volatile uint32_t s_stopped;     //sources that have posted all their events
+
+static void test_data(const sched_evt_t *evt, void *ctx)
+{
+	uint32_t src = evt->arg >> 24, seq = evt->arg & 0xFFFFFFu;
+
+	if(src >= TEST_SOURCES || seq < s_next[src])
+	{
+		s_order_errors++;
+		return;
+	}
+	//drops leave gaps, but a source's events never arrive out of order
+	s_next[src] = seq + 1u;
+	s_received[src]++;
+}
+
+static void test_stop(const sched_evt_t *evt, void *ctx)
+{
+	s_stopped++;
+}
+
+static void test_nop(const sched_evt_t *evt, void *ctx)
+{
+}
+
+//like SysTick: wakes the idle loop so it sees the stop count
+static void test_tick_isr(void *arg)
+{
+	sched_post(&s_tick, 0, 0);
+}
+
+static void test_isr(void *arg)
+{
+	test_source_t *s = arg;
+
+	if(s->seq >= TEST_POSTS)
+		return;
+	if(sched_post(s->task, test_evt_data, (s->id << 24) | s->seq) == 0)
+		s->ok++;
+	else
+		s->rejected++;
+	if(++s->seq == TEST_POSTS)
+		sched_post(&s_stop, test_evt_stop, s->id);
+}
+
+//simulated interrupts post while the main thread dispatches and sleeps
+static void test_isr_sim(void)
+{
+	uint32_t i, ok = 0, rejected = 0, received = 0;
+
+	sched_init();
+	memset(s_src, 0, sizeof(s_src));
+	memset(s_next, 0, sizeof(s_next));
+	memset(s_received, 0, sizeof(s_received));
+	s_order_errors = 0;
+	s_stopped = 0;
+	CHECK(sched_task_create(&s_fast, 10, "fast", test_data, 0) == 0, "create fast");
+	CHECK(sched_task_create(&s_slow, 3, "slow", test_data, 0) == 0, "create slow");
+	CHECK(sched_task_create(&s_stop, 1, "stop", test_stop, 0) == 0, "create stop");
+	CHECK(sched_task_create(&s_stop, 1, "again", test_stop, 0) != 0, "priority used twice");
+	CHECK(sched_task_create(&s_tick, 0, "tick", test_nop, 0) == 0, "create tick");
+	CHECK(isr_sim_start(&s_tick_sim, test_tick_isr, 0, 1000u) == 0, "start tick");
+
+	for(i = 0; i < TEST_SOURCES; i++)
+	{
+		s_src[i].task = (i == 0) ? &s_slow : &s_fast;
+		s_src[i].id = i;
+		CHECK(isr_sim_start(&s_sim[i], test_isr, &s_src[i], 20u + 15u * i) == 0, "start source %u", i);
+	}
+
+	//every source posts a stop event after its last data event
+	while(s_stopped < TEST_SOURCES)
+		sched_run();
+	for(i = 0; i < TEST_SOURCES; i++)
+		isr_sim_stop(&s_sim[i]);
+	isr_sim_stop(&s_tick_sim);
+
+	for(i = 0; i < TEST_SOURCES; i++)
+	{
+		ok += s_src[i].ok;
+		rejected += s_src[i].rejected;
+		received += s_received[i];
+		CHECK(s_received[i] == s_src[i].ok, "source %u: %u received, %u posted", i, s_received[i], s_src[i].ok);
+	}
+	CHECK(s_order_errors == 0, "%u events out of order", s_order_errors);
+	CHECK(s_fast.dropped + s_slow.dropped == rejected, "dropped %u, rejected %u",
+	      s_fast.dropped + s_slow.dropped, rejected);
+	CHECK(s_fast.runs + s_slow.runs == received, "runs %u, received %u", s_fast.runs + s_slow.runs, received);
+	printf("isr_sim: %u posted, %u rejected\n", ok, rejected);
+}
+
+static sched_task_t s_full;
+static volatile int s_go;
+static uint32_t s_producer_ok[TEST_PRODUCERS];
+
+static void *test_producer(void *arg)
+{
+	uint32_t id = (uint32_t)(uintptr_t)arg, i;
+
+	while(!s_go)
+		;
+	for(i = 0; i < TEST_ATTEMPTS; i++)
+		if(sched_post(&s_full, test_evt_data, (id << 24) | i) == 0)
+			s_producer_ok[id]++;
+	return 0;
+}
+
+//producers racing on a full queue: every rejected post is counted exactly once
+static void test_concurrent_drops(void)
+{
+	pthread_t th[TEST_PRODUCERS];
+	uint32_t i, ok = 0, drained = 0;
+
+	sched_init();
+	memset(s_producer_ok, 0, sizeof(s_producer_ok));
+	memset(s_next, 0, sizeof(s_next));
+	memset(s_received, 0, sizeof(s_received));
+	s_order_errors = 0;
+	s_go = 0;
+	sched_task_create(&s_full, 5, "full", test_data, 0);
+	for(i = 0; i < TEST_PRODUCERS; i++)
+		pthread_create(&th[i], 0, test_producer, (void *)(uintptr_t)i);
+	s_go = 1;
+	for(i = 0; i < TEST_PRODUCERS; i++)
+	{
+		pthread_join(th[i], 0);
+		ok += s_producer_ok[i];
+	}
+	while(sched_dispatch())
+		drained++;
+
+	CHECK(ok == SCHED_QUEUE_LEN, "%u posts accepted into a queue of %u", ok, SCHED_QUEUE_LEN);
+	CHECK(drained == ok, "%u events drained, %u accepted", drained, ok);
+	CHECK(s_full.dropped == TEST_PRODUCERS * TEST_ATTEMPTS - ok, "dropped %u, expected %u",
+	      s_full.dropped, TEST_PRODUCERS * TEST_ATTEMPTS - ok);
+}
+
+static uint32_t s_trace[8];
+static uint32_t s_trace_len;
+
+static void test_trace(const sched_evt_t *evt, void *ctx)
+{
+	if(s_trace_len < 8u)
+		s_trace[s_trace_len++] = evt->arg;
+}
+
+//the highest ready priority runs first, events of one task in FIFO order
+static void test_priority(void)
+{
+	static sched_task_t lo, hi;
+
+	sched_init();
+	s_trace_len = 0;
+	sched_task_create(&lo, 2, "lo", test_trace, 0);
+	sched_task_create(&hi, 30, "hi", test_trace, 0);
+	sched_post(&lo, 0, 1);
+	sched_post(&lo, 0, 2);
+	sched_post(&hi, 0, 3);
+	sched_post(&hi, 0, 4);
+	while(sched_dispatch())
+		;
+	CHECK(s_trace_len == 4u && s_trace[0] == 3u && s_trace[1] == 4u && s_trace[2] == 1u && s_trace[3] == 2u,
+	      "dispatch order %u %u %u %u", s_trace[0], s_trace[1], s_trace[2], s_trace[3]);
+	CHECK(lo.runs == 2u && hi.runs == 2u, "runs %u %u", lo.runs, hi.runs);
+	CHECK(sched_dispatch() == 0, "dispatch with nothing ready");
+}
+
+int main(void)
+{
+	test_priority();
+	test_concurrent_drops();
+	test_isr_sim();
+	return test_done("test_sched");
+}
@@ -0,0 +1,230 @@
+/*
+ * Natural and clamped cubic splines against a double-precision spline of
+ * the same table, on a uniform grid and on an array of knots, with sorted
+ * and random inputs; exact values at the knots and outside the table, the
+ * knots needed against linear interpolation, and the init errors.
+ * sources:
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_MAX_N      257
+#define TEST_MAX_TABLE  1025        //linear table of 8 times the largest spline of test_table_size
+#define TEST_LEN        20000
+#define TEST_F32_MAX    4e-7        //single precision build and evaluation, 3.2e-7 for a clamped pair of knots
+#define TEST_Q31_MAX    8.0         //LSB, with more than 20 knots
+#define TEST_Q31_SMALL  64.0        //LSB, with fewer knots the single precision build limits large curvature
+#define TEST_Q31_KNOTS  20
+
+static double s_x[TEST_MAX_N], s_y[TEST_MAX_N], s_m[TEST_MAX_N], s_cp[TEST_MAX_N], s_dp[TEST_MAX_N];
+static float32_t s_xf[TEST_MAX_N], s_yf[TEST_MAX_TABLE], s_cf[3 * TEST_MAX_TABLE], s_in[TEST_LEN], s_out[TEST_LEN];
+static q31_t s_xq[TEST_MAX_N], s_yq[TEST_MAX_N], s_cq[4 * TEST_MAX_N], s_inq[TEST_LEN], s_outq[TEST_LEN];
+
+//a sensor-like curve on [-1, 1) and its derivative
+static double test_f(double x)
+{
+	return 0.9 * tanh(3.0 * (x - 0.1));
+}
+
+static double test_df(double x)
+{
+	double t = tanh(3.0 * (x - 0.1));
+
+	return 2.7 * (1.0 - t * t);
+}
+
+//second derivatives of the natural (sl NULL) or clamped spline by the tridiagonal sweep
+static void test_build(uint32_t n, const double *sl)
+{
+	double h0, h1, s0, s1, den;
+	uint32_t i;
+
+	h1 = s_x[1] - s_x[0];
+	s1 = (s_y[1] - s_y[0]) / h1;
+	s_cp[0] = sl ? 0.5 : 0.0;
+	s_dp[0] = sl ? 3.0 * (s1 - sl[0]) / h1 : 0.0;
+	for(i = 1; i + 1u < n; i++)
+	{
+		h0 = h1;
+		s0 = s1;
+		h1 = s_x[i + 1] - s_x[i];
+		s1 = (s_y[i + 1] - s_y[i]) / h1;
+		den = 2.0 * (h0 + h1) - h0 * s_cp[i - 1];
+		s_cp[i] = h1 / den;
+		s_dp[i] = (6.0 * (s1 - s0) - h0 * s_dp[i - 1]) / den;
+	}
+	s_m[n - 1] = sl ? (6.0 * (sl[1] - s1) - h1 * s_dp[n - 2]) / (h1 * (2.0 - s_cp[n - 2])) : 0.0;
+	for(i = n - 1u; i-- > 0u;)
+		s_m[i] = s_dp[i] - s_cp[i] * s_m[i + 1];
+}
+
+static double test_eval(uint32_t n, double v)
+{
+	uint32_t lo = 0, hi = n - 1u, mid;
+	double h, a, b;
+
+	if(v <= s_x[0])
+		return s_y[0];
+	if(v >= s_x[n - 1])
+		return s_y[n - 1];
+	while(hi - lo > 1u)
+	{
+		mid = (lo + hi) / 2u;
+		if(v >= s_x[mid])
+			lo = mid;
+		else
+			hi = mid;
+	}
+	h = s_x[lo + 1] - s_x[lo];
+	a = (s_x[lo + 1] - v) / h;
+	b = (v - s_x[lo]) / h;
+	return a * s_y[lo] + b * s_y[lo + 1] + ((a * a * a - a) * s_m[lo] + (b * b * b - b) * s_m[lo + 1]) * h * h / 6.0;
+}
+
+//the q31 grid spacing is the largest power of two that keeps n knots from -1 inside the Q31 range
+static void test_spline(uint32_t n, int clamped, int uniform, int sorted)
+{
+	arm_spline_instance_f32 Sf;
+	arm_spline_instance_q31 Sq;
+	double sl[2], t, v, ef = 0, eq = 0;
+	float32_t slf[2];
+	q31_t slq[2];
+	uint32_t i, k, bad = 0;
+	uint8_t l = 31;
+
+	while((double)(n - 1u) * ldexp(1.0, l) > 2147483647.0 * 1.999)
+		l--;
+	for(i = 0; i < n; i++)
+	{
+		t = (double)i / (n - 1u);
+		if(uniform)
+			v = -1.0 + i * ldexp(1.0, l - 31);
+		else
+			v = -1.0 + 1.999 * (t + (i > 0u && i < n - 1u ? 0.3 * sin(7.0 * t) / (n - 1u) : 0.0));
+		s_xq[i] = (q31_t)llround(v * 2147483648.0);
+		s_x[i] = s_xq[i] / 2147483648.0;
+		s_xf[i] = (float32_t)s_x[i];
+		s_yq[i] = (q31_t)llround(test_f(s_x[i]) * 2147483648.0);
+		s_y[i] = s_yq[i] / 2147483648.0;
+		s_yf[i] = (float32_t)s_y[i];
+	}
+	//the end slopes as the 8.24 values the q31 build sees
+	slq[0] = (q31_t)llround(test_df(s_x[0]) * 16777216.0);
+	slq[1] = (q31_t)llround(test_df(s_x[n - 1]) * 16777216.0);
+	sl[0] = slf[0] = (float32_t)(slq[0] / 16777216.0);
+	sl[1] = slf[1] = (float32_t)(slq[1] / 16777216.0);
+	test_build(n, clamped ? sl : NULL);
+
+	CHECK(arm_spline_init_f32(&Sf, uniform ? NULL : s_xf, s_xf[0], uniform ? (float32_t)(s_x[1] - s_x[0]) : 0.0f, s_yf, n,
+	                          clamped ? slf : NULL, s_cf) == ARM_MATH_SUCCESS, "f32 %u knots: init", n);
+	CHECK(arm_spline_init_q31(&Sq, uniform ? NULL : s_xq, s_xq[0], l, s_yq, n, clamped ? slq : NULL, s_cq) ==
+	      ARM_MATH_SUCCESS, "q31 %u knots: init", n);
+	for(k = 0; k < TEST_LEN; k++)
+	{
+		v = sorted ? -1.05 + 2.1 * k / TEST_LEN : -1.05 + 1.05 * (test_uniform() + 1.0);
+		v = fmin(v, 0.9999);
+		s_in[k] = (float32_t)v;
+		s_inq[k] = (q31_t)llround(v * 2147483648.0);
+	}
+	arm_spline_f32(&Sf, s_in, s_out, TEST_LEN);
+	arm_spline_q31(&Sq, s_inq, s_outq, TEST_LEN);
+	for(k = 0; k < TEST_LEN; k++)
+	{
+		ef = fmax(ef, fabs(s_out[k] - test_eval(n, s_in[k])));
+		eq = fmax(eq, fabs(s_outq[k] - test_eval(n, s_inq[k] / 2147483648.0) * 2147483648.0));
+	}
+	printf("%-7s %-7s %-6s %3u knots: f32 error %.1e, q31 error %4.1f LSB (postShift %u)\n", clamped ? "clamped" : "natural",
+	       uniform ? "uniform" : "knots", sorted ? "sorted" : "random", n, ef, eq, Sq.postShift);
+	CHECK(ef <= TEST_F32_MAX, "f32 %u knots clamped %d uniform %d: error %.2e", n, clamped, uniform, ef);
+	CHECK(eq <= (n > TEST_Q31_KNOTS ? TEST_Q31_MAX : TEST_Q31_SMALL), "q31 %u knots clamped %d uniform %d: error %.1f LSB",
+	      n, clamped, uniform, eq);
+
+	//every q31 segment ends on the next table value, and outside the table are the end values
+	arm_spline_q31(&Sq, s_xq, s_outq, n);
+	for(i = 0; i < n; i++)
+		bad += s_outq[i] != s_yq[i];
+	s_inq[0] = INT32_MIN;
+	s_inq[1] = s_xq[n - 1] + (s_xq[n - 1] < INT32_MAX);
+	s_in[0] = -2.0f;
+	s_in[1] = 2.0f;
+	arm_spline_q31(&Sq, s_inq, s_outq, 2);
+	arm_spline_f32(&Sf, s_in, s_out, 2);
+	bad += (s_xq[0] > INT32_MIN && s_outq[0] != s_yq[0]) || s_outq[1] != s_yq[n - 1];
+	bad += s_out[0] != s_yf[0] || s_out[1] != s_yf[n - 1];
+	CHECK(bad == 0, "%u knots clamped %d uniform %d: %u values at the knots or outside differ", n, clamped, uniform, bad);
+}
+
+//the largest error against the curve itself of a linear table and a spline of n knots over [-1, 1]
+static void test_knots(uint32_t n, double *linear, double *spline)
+{
+	arm_spline_instance_f32 S;
+	arm_linear_interp_instance_f32 L;
+	float32_t v, o;
+	uint32_t i, k;
+
+	for(i = 0; i < n; i++)
+		s_yf[i] = (float32_t)test_f(-1.0 + 2.0 * i / (n - 1u));
+	arm_spline_init_f32(&S, NULL, -1.0f, 2.0f / (n - 1u), s_yf, n, NULL, s_cf);
+	L.nValues = n;
+	L.x1 = -1.0f;
+	L.xSpacing = 2.0f / (n - 1u);
+	L.pYData = s_yf;
+	*linear = *spline = 0;
+	for(k = 0; k < TEST_LEN; k++)
+	{
+		v = (float32_t)(-1.0 + 2.0 * k / TEST_LEN);
+		arm_spline_f32(&S, &v, &o, 1);
+		*spline = fmax(*spline, fabs(o - test_f(v)));
+		*linear = fmax(*linear, fabs(arm_linear_interp_f32(&L, v) - test_f(v)));
+	}
+}
+
+static void test_table_size(void)
+{
+	double l8, s, l;
+	uint32_t n;
+
+	for(n = 33; n <= 129; n = 2u * n - 1u)
+	{
+		test_knots(8u * n - 7u, &l8, &s);
+		test_knots(n, &l, &s);
+		printf("%3u knots: spline error %.1e, linear %.1e, linear with %u knots %.1e\n", n, s, l, 8u * n - 7u, l8);
+		CHECK(s <= 1.25 * l8, "%u knots: spline error %.2e, linear with 8 times the knots %.2e", n, s, l8);
+	}
+}
+
+static void test_errors(void)
+{
+	arm_spline_instance_f32 Sf;
+	arm_spline_instance_q31 Sq;
+	static const float32_t xf[3] = { 0.0f, 0.5f, 0.5f }, yf[3] = { 0 };
+	static const q31_t xq[3] = { 0, 0x40000000, 0x40000000 }, yq[3] = { 0 };
+
+	CHECK(arm_spline_init_f32(&Sf, NULL, 0.0f, 0.5f, yf, 1, NULL, s_cf) == ARM_MATH_ARGUMENT_ERROR, "f32: 1 knot accepted");
+	CHECK(arm_spline_init_f32(&Sf, NULL, 0.0f, 0.0f, yf, 3, NULL, s_cf) == ARM_MATH_ARGUMENT_ERROR, "f32: spacing 0 accepted");
+	CHECK(arm_spline_init_f32(&Sf, xf, 0.0f, 0.0f, yf, 3, NULL, s_cf) == ARM_MATH_ARGUMENT_ERROR,
+	      "f32: repeated knot accepted");
+	CHECK(arm_spline_init_q31(&Sq, NULL, 0, 0, yq, 1, NULL, s_cq) == ARM_MATH_ARGUMENT_ERROR, "q31: 1 knot accepted");
+	CHECK(arm_spline_init_q31(&Sq, xq, 0, 0, yq, 3, NULL, s_cq) == ARM_MATH_ARGUMENT_ERROR, "q31: repeated knot accepted");
+	CHECK(arm_spline_init_q31(&Sq, NULL, 0, 30, yq, 3, NULL, s_cq) == ARM_MATH_ARGUMENT_ERROR,
+	      "q31: grid past the Q31 range accepted");
+	CHECK(arm_spline_init_q31(&Sq, NULL, 0, 32, yq, 2, NULL, s_cq) == ARM_MATH_ARGUMENT_ERROR, "q31: spacing 2^32 accepted");
+}
+
+int main(void)
+{
+	uint32_t n;
+	int clamped, uniform, sorted;
+
+	for(clamped = 0; clamped <= 1; clamped++)
+		for(uniform = 0; uniform <= 1; uniform++)
+			for(sorted = 0; sorted <= 1; sorted++)
+				for(n = 2; n < TEST_MAX_N; n = 2u * n + 1u)
+					test_spline(n, clamped, uniform, sorted);
+	test_table_size();
+	test_errors();
+	return test_done("test_spline");
+}
@@ -0,0 +1,110 @@
+/*
+ * Streaming STFT and Welch power spectrum against the mean |DFT|^2 of the
+ * windowed frames in double precision, with the input fed in chunks of
+ * random length.
+ * sources:
+ */
+
+#include "test.h"
+#include "arm_math.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_LEN        20000
+#define TEST_MAX_N      2048
+#define TEST_MAX_ROWS   200
+#define TEST_MAX_PIECE  700
+#define TEST_ERR_MAX    1e-6        //relative to the largest bin, float rounding of the FFT and the window
+
+static float32_t s_x[TEST_LEN], s_win[TEST_MAX_N], s_ring[TEST_MAX_N], s_frame[2 * TEST_MAX_N];
+static float32_t s_acc[TEST_MAX_N / 2 + 1], s_out[TEST_MAX_ROWS * (TEST_MAX_N / 2 + 1)];
+static double s_ref[TEST_MAX_ROWS * (TEST_MAX_N / 2 + 1)], s_cos[TEST_MAX_N], s_sin[TEST_MAX_N];
+
+//rows of mean(|rfft(x[f*hop ... f*hop+n-1] * w)|^2) over numAvg frames, times scale
+static uint32_t test_ref(uint32_t n, uint32_t hop, uint32_t numAvg, double scale, uint32_t len)
+{
+	uint32_t frames = len >= n ? (len - n) / hop + 1u : 0u, rows = frames / numAvg, r, k, f, i, j;
+	double s, re, im, v;
+
+	for(i = 0; i < n; i++)
+	{
+		s_cos[i] = cos(2.0 * TEST_PI * i / n);
+		s_sin[i] = sin(2.0 * TEST_PI * i / n);
+	}
+	for(r = 0; r < rows; r++)
+		for(k = 0; k <= n / 2u; k++)
+		{
+			s = 0;
+			for(f = r * numAvg; f < (r + 1u) * numAvg; f++)
+			{
+				re = im = 0;
+				for(i = 0, j = 0; i < n; i++, j = (j + k) % n)
+				{
+					v = (double)s_x[f * hop + i] * s_win[i];
+					re += v * s_cos[j];
+					im -= v * s_sin[j];
+				}
+				s += re * re + im * im;
+			}
+			s_ref[r * (n / 2u + 1u) + k] = s / numAvg * scale;
+		}
+	return rows;
+}
+
+static void test_stft(uint16_t n, uint16_t hop, uint16_t numAvg, uint32_t len)
+{
+	arm_stft_instance_f32 S;
+	float32_t scale = 1.0f / n;
+	uint32_t i, pos, k, rows = 0, rows_ref;
+	double e = 0, peak = 0;
+
+	for(i = 0; i < n; i++)
+		s_win[i] = (float32_t)(0.5 - 0.5 * cos(2.0 * TEST_PI * i / n));
+	CHECK(arm_stft_init_f32(&S, n, hop, numAvg, scale, s_win, s_ring, s_frame, numAvg > 1u ? s_acc : NULL) ==
+	      ARM_MATH_SUCCESS, "N %u hop %u average %u: init", n, hop, numAvg);
+	for(pos = 0; pos < len; pos += k)
+	{
+		k = 1u + test_rand() % TEST_MAX_PIECE;
+		if(k > len - pos)
+			k = len - pos;
+		rows += arm_stft_f32(&S, s_x + pos, s_out + rows * (n / 2u + 1u), k);
+	}
+
+	rows_ref = test_ref(n, hop, numAvg, scale, len);
+	CHECK(rows == rows_ref, "N %u hop %u average %u: %u rows, expected %u", n, hop, numAvg, rows, rows_ref);
+	for(i = 0; i < rows_ref * (n / 2u + 1u); i++)
+	{
+		e = fmax(e, fabs(s_out[i] - s_ref[i]));
+		peak = fmax(peak, s_ref[i]);
+	}
+	//a block shorter than the frame gives no row
+	printf("N %4u hop %4u average %u: %3u rows, error %.1e of the peak\n", n, hop, numAvg, rows, rows ? e / peak : 0.0);
+	CHECK(e <= TEST_ERR_MAX * peak, "N %u hop %u average %u: error %.2e of the peak", n, hop, numAvg, e / peak);
+}
+
+int main(void)
+{
+	arm_stft_instance_f32 S;
+	uint32_t i;
+
+	for(i = 0; i < TEST_LEN; i++)
+		s_x[i] = (float32_t)(0.5 * sin(0.1234 * i) + 0.1 * test_uniform());
+
+	//hops shorter than, equal to and longer than the frame
+	test_stft(32, 7, 1, 300);
+	test_stft(256, 64, 1, 5000);
+	test_stft(256, 300, 1, 5000);
+	test_stft(128, 128, 3, 9000);
+	test_stft(512, 256, 8, 20000);
+	test_stft(2048, 1024, 2, 20000);
+	test_stft(1024, 100, 4, 3000);
+	test_stft(64, 16, 1, 50);
+
+	CHECK(arm_stft_init_f32(&S, 100, 10, 1, 1.0f, s_win, s_ring, s_frame, NULL) == ARM_MATH_ARGUMENT_ERROR,
+	      "length 100 accepted");
+	CHECK(arm_stft_init_f32(&S, 256, 0, 1, 1.0f, s_win, s_ring, s_frame, NULL) == ARM_MATH_ARGUMENT_ERROR,
+	      "hop 0 accepted");
+	CHECK(arm_stft_init_f32(&S, 256, 10, 2, 1.0f, s_win, s_ring, s_frame, NULL) == ARM_MATH_ARGUMENT_ERROR,
+	      "averaging without an accumulator accepted");
+	return test_done("test_stft");
+}
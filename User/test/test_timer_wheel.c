@@ -0,0 +1,213 @@
+/*
+ * Timer wheel on a virtual clock.
+ * sources: User/timer_wheel.c
+ */
+
+#include "test.h"
+#include "timer_wheel.h"
+#include <string.h>
+
+#define TEST_TIMERS     2000
+
+typedef struct
+{
+	uint32_t expires;       //next expected expiry
+	uint32_t fired;
+	uint32_t last;          //tick of the last callback
+	uint8_t  cancelled;
+} test_expect_t;
+
+static tw_wheel_t s_wheel;
+static tw_timer_t s_timer[TEST_TIMERS];
+static test_expect_t s_expect[TEST_TIMERS];
+static uint32_t s_late;
+static uint32_t s_order_errors;
+static uint32_t s_prev_tick;
+static uint32_t s_calls;
+
+static void test_cb(tw_timer_t *t, void *arg)
+{
+	test_expect_t *e = arg;
+
+	//callbacks see the wheel at the tick the timer expires on
+	if(s_wheel.now != e->expires)
+		s_late++;
+	if(s_calls && TW_TIME_AFTER(s_prev_tick, s_wheel.now))
+		s_order_errors++;
+	s_prev_tick = s_wheel.now;
+	s_calls++;
+	e->fired++;
+	e->last = s_wheel.now;
+	if(t->period)
+		e->expires += t->period;
+}
+
+//a delay from one of four ranges: the first wheel, a few levels up, long, and up to 2^31 - 1
+static uint32_t test_delay(void)
+{
+	switch(test_rand() % 4u)
+	{
+	case 0:
+		return test_rand() % 64u;
+	case 1:
+		return test_rand() % 100000u;
+	case 2:
+		return test_rand() % 50000000u;
+	default:
+		return test_rand() % 0x7FFFFFFFu;
+	}
+}
+
+static void test_setup(uint32_t start, uint32_t periodic_every)
+{
+	uint32_t i, period;
+
+	memset(s_expect, 0, sizeof(s_expect));
+	s_late = s_order_errors = s_calls = 0;
+	tw_init(&s_wheel, start);
+	for(i = 0; i < TEST_TIMERS; i++)
+	{
+		period = (periodic_every && i % periodic_every == 0) ? 1000u + test_rand() % 200000u : 0;
+		tw_timer_init(&s_timer[i], test_cb, &s_expect[i]);
+		s_expect[i].expires = start + test_delay();
+		tw_start(&s_wheel, &s_timer[i], s_expect[i].expires, period);
+	}
+	CHECK(s_wheel.pending == TEST_TIMERS, "pending %u after start", s_wheel.pending);
+
+	//cancel every 7th one-shot timer
+	for(i = 0; i < TEST_TIMERS; i += 7)
+	{
+		if(s_timer[i].period)
+			continue;
+		tw_cancel(&s_wheel, &s_timer[i]);
+		s_expect[i].cancelled = 1;
+	}
+}
+
+static void test_check_one_shots(const char *what, uint32_t end)
+{
+	uint32_t i, missing = 0, extra = 0;
+
+	for(i = 0; i < TEST_TIMERS; i++)
+	{
+		if(s_timer[i].period)
+			continue;
+		if(s_expect[i].cancelled)
+			extra += s_expect[i].fired;
+		else if(!TW_TIME_AFTER(s_expect[i].expires, end))
+			missing += s_expect[i].fired != 1u;
+		else
+			extra += s_expect[i].fired;
+	}
+	CHECK(s_late == 0, "%s: %u callbacks not at their expiry tick", what, s_late);
+	CHECK(s_order_errors == 0, "%s: %u callbacks out of order", what, s_order_errors);
+	CHECK(missing == 0, "%s: %u due timers did not fire exactly once", what, missing);
+	CHECK(extra == 0, "%s: %u cancelled or future timers fired", what, extra);
+}
+
+//driven like hrtimer.c: jump straight to the next event, the way one compare register does
+static void test_next_event_driven(uint32_t start)
+{
+	uint32_t next, clock = start, events = 0, earliest, i;
+
+	test_setup(start, 0);
+	while(tw_next_event(&s_wheel, &next))
+	{
+		//the next event is never later than the earliest pending timer
+		earliest = clock + 0x7FFFFFFFu;
+		for(i = 0; i < TEST_TIMERS; i++)
+			if(s_timer[i].active && TW_TIME_AFTER(earliest, s_timer[i].expires))
+				earliest = s_timer[i].expires;
+		if(TW_TIME_AFTER(next, earliest))
+		{
+			CHECK(0, "next event %08x after the earliest timer %08x", next, earliest);
+			break;
+		}
+		if(TW_TIME_AFTER(next, clock))
+			clock = next;
+		tw_advance(&s_wheel, clock);
+		if(++events > 100000u)
+		{
+			CHECK(0, "wheel does not drain");
+			break;
+		}
+	}
+	CHECK(s_wheel.pending == 0, "%u timers left", s_wheel.pending);
+	test_check_one_shots("next event", clock);
+	printf("next event driven from %08x: %u events for %u callbacks\n", start, events, s_calls);
+}
+
+//driven in coarse random jumps, as after a long critical section
+static void test_jump_driven(uint32_t start)
+{
+	uint32_t clock = start, i, bad = 0;
+
+	test_setup(start, 10);
+	while((int32_t)(clock - start) < 0x7FFFFFFF - 5000000)
+	{
+		clock += 1u + test_rand() % 5000000u;
+		tw_advance(&s_wheel, clock);
+		CHECK(s_wheel.now == clock + 1u, "now %08x after advancing to %08x", s_wheel.now, clock);
+	}
+	test_check_one_shots("jumps", clock);
+
+	//a periodic timer fires at first + k * period for every k up to the clock
+	for(i = 0; i < TEST_TIMERS; i++)
+	{
+		if(!s_timer[i].period)
+			continue;
+		if(s_expect[i].expires != s_timer[i].expires || !TW_TIME_AFTER(s_expect[i].expires, clock))
+			bad++;
+	}
+	CHECK(bad == 0, "%u periodic timers with a wrong next expiry", bad);
+	printf("jump driven from %08x: %u callbacks\n", start, s_calls);
+}
+
+static void test_restart_and_past(void)
+{
+	test_expect_t e;
+	tw_timer_t t;
+	uint32_t next;
+
+	memset(&e, 0, sizeof(e));
+	s_late = s_order_errors = s_calls = 0;
+	tw_init(&s_wheel, 1000u);
+	CHECK(tw_next_event(&s_wheel, &next) == 0, "empty wheel has an event");
+
+	//restarting an active timer moves it and keeps one pending entry
+	tw_timer_init(&t, test_cb, &e);
+	tw_start(&s_wheel, &t, 500000u, 0);
+	e.expires = 3000u;
+	tw_start(&s_wheel, &t, 3000u, 0);
+	CHECK(s_wheel.pending == 1u, "pending %u after restart", s_wheel.pending);
+	//the next event may be an earlier cascade, never the old deadline or later
+	CHECK(tw_next_event(&s_wheel, &next) && !TW_TIME_AFTER(next, 3000u), "next event %u after 3000", next);
+	tw_advance(&s_wheel, 2999u);
+	CHECK(e.fired == 0, "fired early");
+	tw_advance(&s_wheel, 600000u);
+	CHECK(e.fired == 1u && e.last == 3000u, "fired %u times, last at %u", e.fired, e.last);
+
+	//a deadline in the past fires on the next advance, at the current tick
+	e.fired = 0;
+	e.expires = s_wheel.now;
+	tw_start(&s_wheel, &t, 100u, 0);
+	tw_advance(&s_wheel, s_wheel.now);
+	CHECK(e.fired == 1u, "past deadline fired %u times", e.fired);
+
+	//cancelling twice is harmless
+	tw_start(&s_wheel, &t, s_wheel.now + 10u, 0);
+	tw_cancel(&s_wheel, &t);
+	tw_cancel(&s_wheel, &t);
+	CHECK(s_wheel.pending == 0, "pending %u after cancel", s_wheel.pending);
+}
+
+int main(void)
+{
+	test_next_event_driven(0);
+	test_next_event_driven(0xFFFFF000u);
+	test_next_event_driven(0x7FFFFFF0u);
+	test_jump_driven(0x12345678u);
+	test_jump_driven(0xFFFFFFF0u);
+	test_restart_and_past();
+	return test_done("test_timer_wheel");
+}
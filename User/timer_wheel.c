@@ -0,0 +1,208 @@
+#include "timer_wheel.h"
+#include <string.h>
+
+#define NULL_TIMER  ((tw_timer_t *)0)
+
+static uint32_t tw_clz32(uint32_t v)
+{
+#if defined(__CC_ARM)
+	return __clz(v);
+#else
+	return v ? (uint32_t)__builtin_clz(v) : 32u;
+#endif
+}
+
+static uint32_t tw_ctz64(uint64_t v)   //v != 0
+{
+#if defined(__CC_ARM)
+	uint32_t lo = (uint32_t)v;
+	return lo ? __clz(__rbit(lo)) : 32u + __clz(__rbit((uint32_t)(v >> 32)));
+#else
+	return (uint32_t)__builtin_ctzll(v);
+#endif
+}
+
+//distance from slot i to the first occupied slot, searching circularly and including i itself
+static uint32_t tw_first_from(uint64_t occ, uint32_t i)
+{
+	if(i)
+		occ = (occ >> i) | (occ << (TW_SLOTS - i));
+	return tw_ctz64(occ);
+}
+
+static void tw_link(tw_wheel_t *tw, tw_timer_t *t, uint32_t level, uint32_t slot)
+{
+	tw_timer_t *head = tw->slot[level][slot];
+
+	t->level = (uint8_t)level;
+	t->slot = (uint8_t)slot;
+	t->prev = NULL_TIMER;
+	t->next = head;
+	if(head)
+		head->prev = t;
+	tw->slot[level][slot] = t;
+	tw->occupied[level] |= (uint64_t)1 << slot;
+}
+
+static void tw_unlink(tw_wheel_t *tw, tw_timer_t *t)
+{
+	if(t->prev)
+		t->prev->next = t->next;
+	else
+		tw->slot[t->level][t->slot] = t->next;
+	if(t->next)
+		t->next->prev = t->prev;
+	if(tw->slot[t->level][t->slot] == NULL_TIMER)
+		tw->occupied[t->level] &= ~((uint64_t)1 << t->slot);
+	t->next = t->prev = NULL_TIMER;
+}
+
+//pick the level and slot for t relative to tw->now
+static void tw_place(tw_wheel_t *tw, tw_timer_t *t)
+{
+	uint32_t delta = t->expires - tw->now;
+	uint32_t when = t->expires;
+	uint32_t level;
+
+	if((int32_t)delta <= 0)
+	{
+		level = 0;
+		when = tw->now;
+	}
+	else if(delta < TW_SLOTS)
+	{
+		level = 0;
+	}
+	else if(delta < (1u << TW_SPAN_BITS))
+	{
+		level = (31u - tw_clz32(delta)) / TW_SLOT_BITS;
+	}
+	else
+	{
+		//beyond the top wheel: park it as far out as possible, it is re-placed when cascaded
+		level = TW_LEVELS - 1;
+		when = tw->now + (1u << TW_SPAN_BITS) - 1u;
+	}
+	tw_link(tw, t, level, (when >> (level * TW_SLOT_BITS)) & TW_SLOT_MASK);
+}
+
+static void tw_cascade(tw_wheel_t *tw, uint32_t level, uint32_t slot)
+{
+	tw_timer_t *list = tw->slot[level][slot];
+	tw_timer_t *t;
+
+	tw->slot[level][slot] = NULL_TIMER;
+	tw->occupied[level] &= ~((uint64_t)1 << slot);
+	while(list)
+	{
+		t = list;
+		list = list->next;
+		tw_place(tw, t);
+	}
+}
+
+void tw_init(tw_wheel_t *tw, uint32_t now)
+{
+	memset(tw, 0, sizeof(*tw));
+	tw->now = now;
+}
+
+void tw_timer_init(tw_timer_t *t, tw_callback_t cb, void *arg)
+{
+	memset(t, 0, sizeof(*t));
+	t->cb = cb;
+	t->arg = arg;
+}
+
+void tw_start(tw_wheel_t *tw, tw_timer_t *t, uint32_t expires, uint32_t period)
+{
+	if(t->active)
+		tw_unlink(tw, t);
+	else
+		tw->pending++;
+	t->expires = expires;
+	t->period = period;
+	t->active = 1;
+	tw_place(tw, t);
+}
+
+void tw_cancel(tw_wheel_t *tw, tw_timer_t *t)
+{
+	if(!t->active)
+		return;
+	tw_unlink(tw, t);
+	t->active = 0;
+	tw->pending--;
+}
+
+/*
+ * Earliest tick at which the wheel has work: either a level 0 slot that
+ * expires or a higher level slot that has to be cascaded.
+ * Returns 0 when no timer is pending.
+ */
+int tw_next_event(const tw_wheel_t *tw, uint32_t *when)
+{
+	uint32_t level, shift, base, t, best = 0, best_dist = 0xFFFFFFFFu;
+
+	if(tw->pending == 0)
+		return 0;
+
+	for(level = 0; level < TW_LEVELS; level++)
+	{
+		if(tw->occupied[level] == 0)
+			continue;
+		shift = level * TW_SLOT_BITS;
+		base = tw->now >> shift;
+		if(tw->now & ((1u << shift) - 1u))
+			base++;                         //cascades happen on aligned ticks only
+		t = (base + tw_first_from(tw->occupied[level], base & TW_SLOT_MASK)) << shift;
+		if(t - tw->now < best_dist)
+		{
+			best_dist = t - tw->now;
+			best = t;
+		}
+	}
+	*when = best;
+	return 1;
+}
+
+//run every timer due up to and including tick now, callbacks run from here
+void tw_advance(tw_wheel_t *tw, uint32_t now)
+{
+	uint32_t t, level, idx;
+	tw_timer_t *tm;
+
+	while(tw_next_event(tw, &t) && !TW_TIME_AFTER(t, now))
+	{
+		tw->now = t;
+
+		for(level = 1; level < TW_LEVELS; level++)
+		{
+			if((t >> ((level - 1) * TW_SLOT_BITS)) & TW_SLOT_MASK)
+				break;
+			tw_cascade(tw, level, (t >> (level * TW_SLOT_BITS)) & TW_SLOT_MASK);
+		}
+
+		idx = t & TW_SLOT_MASK;
+		while((tm = tw->slot[0][idx]) != NULL_TIMER)
+		{
+			tw_unlink(tw, tm);
+			if(tm->period)
+			{
+				tm->expires += tm->period;
+				tw_place(tw, tm);
+			}
+			else
+			{
+				tm->active = 0;
+				tw->pending--;
+			}
+			if(tm->cb)
+				tm->cb(tm, tm->arg);
+		}
+
+		tw->now = t + 1u;
+	}
+	if(TW_TIME_AFTER(now + 1u, tw->now))
+		tw->now = now + 1u;
+}
@@ -0,0 +1,60 @@
+#ifndef _timer_wheel_H_
+#define _timer_wheel_H_
+
+/*
+ * Hierarchical timer wheel, 1 tick = 1 us.
+ *
+ * TW_LEVELS wheels of TW_SLOTS slots each, level n holds timers that expire
+ * between 64^n and 64^(n+1) ticks ahead and is cascaded into the level below
+ * when the lower wheel wraps. Insert and cancel are O(1).
+ *
+ * The wheel has no notion of hardware: the owner advances it to the current
+ * time with tw_advance() and asks tw_next_event() when it next has work, so
+ * one compare register is enough to drive it (see hrtimer.c), and a host
+ * build can drive it with a virtual clock.
+ *
+ * Times are wrap-safe uint32_t, deadlines must lie less than 2^31 ticks ahead.
+ */
+
+#include <stdint.h>
+
+#define TW_SLOT_BITS    6
+#define TW_SLOTS        (1u << TW_SLOT_BITS)
+#define TW_SLOT_MASK    (TW_SLOTS - 1u)
+#define TW_LEVELS       5
+#define TW_SPAN_BITS    (TW_SLOT_BITS * TW_LEVELS)     //delays up to 2^30 ticks are placed directly
+
+struct tw_timer;
+typedef void (*tw_callback_t)(struct tw_timer *t, void *arg);
+
+typedef struct tw_timer
+{
+	struct tw_timer *next;
+	struct tw_timer *prev;
+	uint32_t         expires;
+	uint32_t         period;    //0: one shot
+	tw_callback_t    cb;
+	void            *arg;
+	uint8_t          level;
+	uint8_t          slot;
+	uint8_t          active;
+} tw_timer_t;
+
+typedef struct
+{
+	tw_timer_t *slot[TW_LEVELS][TW_SLOTS];
+	uint64_t    occupied[TW_LEVELS];   //bit n set when slot n is not empty
+	uint32_t    now;                   //next tick that has not been processed yet
+	uint32_t    pending;               //number of active timers
+} tw_wheel_t;
+
+#define TW_TIME_AFTER(a, b)   ((int32_t)((uint32_t)(a) - (uint32_t)(b)) > 0)
+
+void tw_init(tw_wheel_t *tw, uint32_t now);
+void tw_timer_init(tw_timer_t *t, tw_callback_t cb, void *arg);
+void tw_start(tw_wheel_t *tw, tw_timer_t *t, uint32_t expires, uint32_t period);
+void tw_cancel(tw_wheel_t *tw, tw_timer_t *t);
+void tw_advance(tw_wheel_t *tw, uint32_t now);
+int  tw_next_event(const tw_wheel_t *tw, uint32_t *when);
+
+#endif /*_timer_wheel_H_*/
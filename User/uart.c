@@ -1,10 +1,85 @@
 #include "uart.h"
+#include "sched.h"
 
-static uint8_t g_usart_tmp;
+/*
+ * printf goes through a ring buffer. fputc only queues the character, the
+ * uart4 task starts interrupt driven transfers of the buffered data and the
+ * transfer complete interrupt just posts an event back to that task.
+ */
+
+#define UART4_TX_RING_SIZE   1024   //power of two
+
+enum uart4_evt{uart4_evt_kick=0,uart4_evt_tx_done};
+
+static uint8_t s_uart4_tx_ring[UART4_TX_RING_SIZE];
+static volatile uint32_t s_uart4_tx_head;      //written by fputc
+static uint32_t s_uart4_tx_tail;               //start of the data in flight
+static uint32_t s_uart4_tx_len;                //bytes handed to the HAL
+static volatile uint8_t s_uart4_tx_pending;    //a kick is queued or a transfer runs
+static sched_task_t s_uart4_task;
+
+static void uart4_task(const sched_evt_t *evt, void *ctx)
+{
+	uint32_t head, len;
+
+	if(evt->sig == uart4_evt_tx_done)
+	{
+		s_uart4_tx_tail += s_uart4_tx_len;
+		s_uart4_tx_len = 0;
+	}
+	if(s_uart4_tx_len)
+		return;
+
+	head = s_uart4_tx_head;
+	if(head == s_uart4_tx_tail)
+	{
+		//drop pending first, then look again for a fputc that saw it still set
+		s_uart4_tx_pending = 0;
+		head = s_uart4_tx_head;
+		if(head == s_uart4_tx_tail)
+			return;
+		s_uart4_tx_pending = 1;
+	}
+
+	len = head - s_uart4_tx_tail;
+	if(len > UART4_TX_RING_SIZE - (s_uart4_tx_tail & (UART4_TX_RING_SIZE - 1)))
+		len = UART4_TX_RING_SIZE - (s_uart4_tx_tail & (UART4_TX_RING_SIZE - 1));
+	if(HAL_UART_Transmit_IT(&huart4, &s_uart4_tx_ring[s_uart4_tx_tail & (UART4_TX_RING_SIZE - 1)],
+	                        (uint16_t)len) == HAL_OK)
+	{
+		s_uart4_tx_len = len;
+	}
+	else
+	{
+		sched_post(&s_uart4_task, uart4_evt_kick, 0);
+	}
+}
+
+void uart4_log_init(void)
+{
+	sched_task_create(&s_uart4_task, SCHED_PRIO_UART4, "uart4", uart4_task, 0);
+	s_uart4_tx_pending = 1;
+	sched_post(&s_uart4_task, uart4_evt_kick, 0);
+}
 
 int fputc(int ch,FILE *f)
 {
-	g_usart_tmp=(uint8_t)(ch);
-	HAL_UART_Transmit_IT(&huart4,&g_usart_tmp,1);
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	if(s_uart4_tx_head - s_uart4_tx_tail < UART4_TX_RING_SIZE)
+	{
+		s_uart4_tx_ring[s_uart4_tx_head & (UART4_TX_RING_SIZE - 1)] = (uint8_t)ch;
+		s_uart4_tx_head++;
+	}
+	if(!s_uart4_tx_pending && sched_post(&s_uart4_task, uart4_evt_kick, 0) == 0)
+		s_uart4_tx_pending = 1;
+	__set_PRIMASK(primask);
 	return ch;
 }
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+	if(huart->Instance == UART4)
+		sched_post(&s_uart4_task, uart4_evt_tx_done, 0);
+}
@@ -7,6 +7,7 @@
 
 extern UART_HandleTypeDef huart4;
 
+void uart4_log_init(void);
 int fputc(int ch, FILE *f);
 
 #endif /*_uart4_H_*/